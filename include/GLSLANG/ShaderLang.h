@@ -25,7 +25,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 195
+#define ANGLE_SH_VERSION 198
 
 enum ShShaderSpec
 {
@@ -261,6 +261,9 @@ const ShCompileOptions SH_SKIP_D3D_CONSTANT_REGISTER_ZERO = UINT64_C(1) << 37;
 // Clamp gl_FragDepth to the range [0.0, 1.0] in case it is statically used.
 const ShCompileOptions SH_CLAMP_FRAG_DEPTH = UINT64_C(1) << 38;
 
+// Append the time spent in each AST pass of the compilation to the info log.
+const ShCompileOptions SH_TIME_AST_PASSES = UINT64_C(1) << 39;
+
 // Defines alternate strategies for implementing array index clamping.
 enum ShArrayIndexClampingStrategy
 {
@@ -449,6 +452,23 @@ struct ShBuiltInResources
     int MaxGeometryImageUniforms;
 };
 
+//
+// Statistics of the memory that the compilers use during compilation, for debugging.
+//
+struct ShPoolAllocatorStatistics
+{
+    // Number of times memory was obtained from the system since the process started.
+    size_t systemAllocationCount;
+    // Memory currently used by the compilers, and the most that was used at any time.
+    size_t blocksInUse;
+    size_t bytesInUse;
+    size_t peakBytesInUse;
+    // Memory kept for reuse by later compilations.
+    size_t cachedBytes;
+    // Memory mapped in large pages, which is kept until the process exits.
+    size_t largePageBytes;
+};
+
 //
 // ShHandle held by but opaque to the driver.  It is allocated,
 // managed, and de-allocated by the compiler. Its contents
@@ -607,6 +627,36 @@ GLenum GetGeometryShaderOutputPrimitiveType(const ShHandle handle);
 int GetGeometryShaderInvocations(const ShHandle handle);
 int GetGeometryShaderMaxVertices(const ShHandle handle);
 
+//
+// The results of successful compilations are kept in a cache that is shared by all compilers in
+// the process. A compilation is looked up by a hash of the shader strings, the compiler type,
+// spec, output, compile options and built-in resources. The cache is enabled by default.
+//
+// Sets the maximum size of the cache in bytes, evicting the least recently used results that
+// don't fit. A size of 0 disables the cache.
+void SetTranslationCacheMaxSize(size_t maxSizeBytes);
+// Returns the size of the cached results in bytes.
+size_t GetTranslationCacheSize();
+void ClearTranslationCache();
+// Writes the cached results to a file, or adds the results stored in a file to the cache. Results
+// of compilers that hash names are not written. Files written by a different version of the
+// translator are rejected. Return false on failure.
+bool SaveTranslationCache(const char *path);
+bool LoadTranslationCache(const char *path);
+
+//
+// The memory that compilers use during compilation is given back to a cache that is shared by all
+// compilers in the process, so that later compilations don't need to allocate from the system.
+//
+// Sets the maximum size of the cached memory in bytes, freeing the memory that doesn't fit. The
+// default is 8 MiB. A size of 0 frees memory as soon as compilations are done with it.
+void SetPoolAllocatorCacheMaxSize(size_t maxSizeBytes);
+// On Linux, maps new memory in large pages, which makes accesses to it cheaper. Memory in large
+// pages is kept until the process exits, regardless of the cache size. Disabled by default, and
+// no-op on other platforms.
+void SetPoolAllocatorUseLargePages(bool useLargePages);
+void GetPoolAllocatorStatistics(ShPoolAllocatorStatistics *statisticsOut);
+
 }  // namespace sh
 
 #endif // GLSLANG_SHADERLANG_H_
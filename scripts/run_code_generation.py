@@ -24,6 +24,16 @@ generators = {
         ],
         'script': 'src/libANGLE/renderer/gen_angle_format_table.py',
     },
+    'built-in symbols': {
+        'inputs': [
+            'src/compiler/translator/builtin_function_declarations.txt',
+        ],
+        'outputs': [
+            'src/compiler/translator/SymbolTable_autogen.cpp',
+            'src/compiler/translator/SymbolTable_autogen.h',
+        ],
+        'script': 'src/compiler/translator/gen_builtin_symbols.py',
+    },
     'D3D11 format': {
         'inputs': [
             'src/libANGLE/renderer/angle_format.py',
@@ -39,6 +39,92 @@ constexpr float g_sharedexp_max =
      static_cast<float>(1 << g_sharedexp_mantissabits)) *
     static_cast<float>(1 << (g_sharedexp_maxexponent - g_sharedexp_bias));
 
+#if defined(ANGLE_USE_SSE)
+#if defined(__GNUC__) || defined(__clang__)
+#define ANGLE_F16C_TARGET __attribute__((target("f16c")))
+#else
+#define ANGLE_F16C_TARGET
+#endif
+
+ANGLE_F16C_TARGET size_t ConvertFloat16ToFloat32F16C(const unsigned short *input,
+                                                     float *output,
+                                                     size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i halves = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(input + i));
+        _mm_storeu_ps(output + i, _mm_cvtph_ps(halves));
+    }
+    return i;
+}
+
+ANGLE_F16C_TARGET size_t ConvertFloat32ToFloat16F16C(const float *input,
+                                                     unsigned short *output,
+                                                     size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i halves = _mm_cvtps_ph(_mm_loadu_ps(input + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(output + i), halves);
+    }
+    return i;
+}
+
+#undef ANGLE_F16C_TARGET
+
+size_t ConvertFloat16ToFloat32SSE2(const unsigned short *input, float *output, size_t count)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i halves = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(input + i));
+        _mm_storeu_ps(output + i, float16ToFloat32SSE2(_mm_unpacklo_epi16(halves, zero)));
+    }
+    return i;
+}
+
+size_t ConvertFloat32ToFloat16SSE2(const float *input, unsigned short *output, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        // The halves are sign extended, so that packing them doesn't saturate.
+        __m128i low  = float32ToFloat16SSE2(_mm_loadu_ps(input + i));
+        __m128i high = float32ToFloat16SSE2(_mm_loadu_ps(input + i + 4));
+        low          = _mm_srai_epi32(_mm_slli_epi32(low, 16), 16);
+        high         = _mm_srai_epi32(_mm_slli_epi32(high, 16), 16);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), _mm_packs_epi32(low, high));
+    }
+    return i;
+}
+#endif  // defined(ANGLE_USE_SSE)
+
+#if defined(ANGLE_USE_NEON)
+size_t ConvertFloat16ToFloat32NEON(const unsigned short *input, float *output, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        vst1q_f32(output + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(input + i))));
+    }
+    return i;
+}
+
+size_t ConvertFloat32ToFloat16NEON(const float *input, unsigned short *output, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        vst1_u16(output + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(input + i))));
+    }
+    return i;
+}
+#endif  // defined(ANGLE_USE_NEON)
+
 }  // anonymous namespace
 
 unsigned int convertRGBFloatsTo999E5(float red, float green, float blue)
@@ -70,4 +156,48 @@ void convert999E5toRGBFloats(unsigned int input, float *red, float *green, float
     *blue = inputData->B * pow(2.0f, (int)inputData->E - g_sharedexp_bias - g_sharedexp_mantissabits);
 }
 
+void convertFloat16ToFloat32(const unsigned short *input, float *output, size_t count)
+{
+    size_t converted = 0;
+#if defined(ANGLE_USE_SSE)
+    if (supportsF16C())
+    {
+        converted = ConvertFloat16ToFloat32F16C(input, output, count);
+    }
+    else if (supportsSSE2())
+    {
+        converted = ConvertFloat16ToFloat32SSE2(input, output, count);
+    }
+#elif defined(ANGLE_USE_NEON)
+    converted = ConvertFloat16ToFloat32NEON(input, output, count);
+#endif
+
+    for (size_t i = converted; i < count; i++)
+    {
+        output[i] = float16ToFloat32(input[i]);
+    }
+}
+
+void convertFloat32ToFloat16(const float *input, unsigned short *output, size_t count)
+{
+    size_t converted = 0;
+#if defined(ANGLE_USE_SSE)
+    if (supportsF16C())
+    {
+        converted = ConvertFloat32ToFloat16F16C(input, output, count);
+    }
+    else if (supportsSSE2())
+    {
+        converted = ConvertFloat32ToFloat16SSE2(input, output, count);
+    }
+#elif defined(ANGLE_USE_NEON)
+    converted = ConvertFloat32ToFloat16NEON(input, output, count);
+#endif
+
+    for (size_t i = converted; i < count; i++)
+    {
+        output[i] = float32ToFloat16(input[i]);
+    }
+}
+
 }  // namespace gl
@@ -139,6 +139,7 @@ inline unsigned int unorm(float x)
     }
 }
 
+// Gates every runtime-selected SSE2 path, including the image loaders, on all x86 builds.
 inline bool supportsSSE2()
 {
 #if defined(ANGLE_USE_SSE)
@@ -162,6 +163,43 @@ inline bool supportsSSE2()
             supports = (info[3] >> 26) & 1;
         }
     }
+#elif defined(__GNUC__)
+    supports = __builtin_cpu_supports("sse2");
+#endif  // defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM)
+    checked = true;
+    return supports;
+#else  // defined(ANGLE_USE_SSE)
+    return false;
+#endif
+}
+
+// F16C uses VEX encoded instructions, which also need the OS to save the AVX registers.
+inline bool supportsF16C()
+{
+#if defined(ANGLE_USE_SSE)
+    static bool checked = false;
+    static bool supports = false;
+
+    if (checked)
+    {
+        return supports;
+    }
+
+#if defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM)
+    {
+        int info[4];
+        __cpuid(info, 0);
+
+        if (info[0] >= 1)
+        {
+            __cpuid(info, 1);
+
+            bool osSavesAVXState = ((info[2] >> 27) & 1) && (_xgetbv(0) & 6) == 6;
+            supports             = osSavesAVXState && ((info[2] >> 29) & 1);
+        }
+    }
+#elif defined(__GNUC__)
+    supports = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
 #endif  // defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM)
     checked = true;
     return supports;
@@ -179,31 +217,29 @@ destType bitCast(const sourceType &source)
     return output;
 }
 
+// Converts to and from half floats with IEEE rounding to nearest even. NaNs are quieted and keep
+// the top bits of their payload, like the conversion instructions of F16C and NEON, so the bulk
+// conversions below give the same results whatever the CPU.
 inline unsigned short float32ToFloat16(float fp32)
 {
     unsigned int fp32i = bitCast<unsigned int>(fp32);
     unsigned int sign = (fp32i & 0x80000000) >> 16;
     unsigned int abs = fp32i & 0x7FFFFFFF;
 
-    if(abs > 0x47FFEFFF)   // Infinity
+    if (abs > 0x7F800000)  // NaN
     {
-        return static_cast<unsigned short>(sign | 0x7FFF);
+        return static_cast<unsigned short>(sign | 0x7E00 | ((abs >> 13) & 0x3FF));
     }
-    else if(abs < 0x38800000)   // Denormal
+    else if (abs >= 0x47800000)  // Infinity, or too large for a half float
     {
-        unsigned int mantissa = (abs & 0x007FFFFF) | 0x00800000;
-        int e = 113 - (abs >> 23);
-
-        if(e < 24)
-        {
-            abs = mantissa >> e;
-        }
-        else
-        {
-            abs = 0;
-        }
-
-        return static_cast<unsigned short>(sign | (abs + 0x00000FFF + ((abs >> 13) & 1)) >> 13);
+        return static_cast<unsigned short>(sign | 0x7C00);
+    }
+    else if (abs < 0x38800000)  // Denormal
+    {
+        // Adding 0.5 shifts the denormal half float into the low bits of the mantissa, where the
+        // addition rounds it to nearest even.
+        float rounded = bitCast<float>(abs) + 0.5f;
+        return static_cast<unsigned short>(sign | (bitCast<unsigned int>(rounded) - 0x3F000000));
     }
     else
     {
@@ -211,7 +247,91 @@ inline unsigned short float32ToFloat16(float fp32)
     }
 }
 
-float float16ToFloat32(unsigned short h);
+inline float float16ToFloat32(unsigned short h)
+{
+    unsigned int sign = (h & 0x8000) << 16;
+    unsigned int exponentMantissa = h & 0x7FFF;
+
+    // Multiplying by 2^112 rebiases the exponent, and normalizes denormals.
+    float magnitude = bitCast<float>(exponentMantissa << 13) * bitCast<float>(0x77800000u);
+    unsigned int fp32i = sign | bitCast<unsigned int>(magnitude);
+
+    if (exponentMantissa >= 0x7C00)  // Infinity or NaN
+    {
+        fp32i |= 0x7F800000;
+        if (exponentMantissa > 0x7C00)
+        {
+            fp32i |= 0x00400000;
+        }
+    }
+    return bitCast<float>(fp32i);
+}
+
+#if defined(ANGLE_USE_SSE)
+// Converts the half floats in the low 16 bits of the four lanes of halves, like float16ToFloat32.
+inline __m128 float16ToFloat32SSE2(__m128i halves)
+{
+    const __m128i exponentMantissaMask = _mm_set1_epi32(0x7FFF);
+    const __m128i largestFinite        = _mm_set1_epi32(0x7BFF);
+    const __m128i infinity             = _mm_set1_epi32(0x7C00);
+    const __m128i floatExponentMask    = _mm_set1_epi32(0x7F800000);
+    const __m128i floatQuietBit        = _mm_set1_epi32(0x00400000);
+    const __m128 rebias                = _mm_castsi128_ps(_mm_set1_epi32(0x77800000));
+
+    __m128i exponentMantissa = _mm_and_si128(halves, exponentMantissaMask);
+    __m128i sign             = _mm_slli_epi32(_mm_xor_si128(halves, exponentMantissa), 16);
+    __m128 magnitude = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exponentMantissa, 13)), rebias);
+
+    __m128i infinityOrNaNBits =
+        _mm_and_si128(_mm_cmpgt_epi32(exponentMantissa, largestFinite), floatExponentMask);
+    __m128i quietBit = _mm_and_si128(_mm_cmpgt_epi32(exponentMantissa, infinity), floatQuietBit);
+    __m128i bits = _mm_or_si128(sign, _mm_or_si128(infinityOrNaNBits, quietBit));
+    return _mm_or_ps(magnitude, _mm_castsi128_ps(bits));
+}
+
+// Converts four floats to half floats in the low 16 bits of each lane, like float32ToFloat16.
+inline __m128i float32ToFloat16SSE2(__m128 floats)
+{
+    const __m128i absMask           = _mm_set1_epi32(0x7FFFFFFF);
+    const __m128i floatInfinity     = _mm_set1_epi32(0x7F800000);
+    const __m128i overflowThreshold = _mm_set1_epi32(0x477FFFFF);
+    const __m128i denormalThreshold = _mm_set1_epi32(0x38800000);
+    const __m128i rebias            = _mm_set1_epi32(static_cast<int>(0xC8000FFF));
+    const __m128i one               = _mm_set1_epi32(1);
+    const __m128i infinity          = _mm_set1_epi32(0x7C00);
+    const __m128i quietNaN          = _mm_set1_epi32(0x7E00);
+    const __m128i payloadMask       = _mm_set1_epi32(0x3FF);
+    const __m128i denormalMagic     = _mm_set1_epi32(0x3F000000);
+
+    __m128i bits = _mm_castps_si128(floats);
+    __m128i abs  = _mm_and_si128(bits, absMask);
+    __m128i sign = _mm_srli_epi32(_mm_andnot_si128(absMask, bits), 16);
+
+    __m128i normal =
+        _mm_add_epi32(_mm_add_epi32(abs, rebias), _mm_and_si128(_mm_srli_epi32(abs, 13), one));
+    normal = _mm_srli_epi32(normal, 13);
+    __m128i denormal = _mm_sub_epi32(
+        _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(abs), _mm_castsi128_ps(denormalMagic))),
+        denormalMagic);
+    __m128i nan = _mm_or_si128(quietNaN, _mm_and_si128(_mm_srli_epi32(abs, 13), payloadMask));
+
+    __m128i isDenormal = _mm_cmplt_epi32(abs, denormalThreshold);
+    __m128i isOverflow = _mm_cmpgt_epi32(abs, overflowThreshold);
+    __m128i isNaN      = _mm_cmpgt_epi32(abs, floatInfinity);
+
+    __m128i result = _mm_or_si128(_mm_and_si128(isDenormal, denormal),
+                                  _mm_andnot_si128(isDenormal, normal));
+    result =
+        _mm_or_si128(_mm_and_si128(isOverflow, infinity), _mm_andnot_si128(isOverflow, result));
+    result = _mm_or_si128(_mm_and_si128(isNaN, nan), _mm_andnot_si128(isNaN, result));
+    return _mm_or_si128(sign, result);
+}
+#endif  // defined(ANGLE_USE_SSE)
+
+// Convert arrays of count values, using the conversion instructions of F16C or NEON where the CPU
+// has them. The results are the same as with the scalar conversions.
+void convertFloat16ToFloat32(const unsigned short *input, float *output, size_t count);
+void convertFloat32ToFloat16(const float *input, unsigned short *output, size_t count);
 
 unsigned int convertRGBFloatsTo999E5(float red, float green, float blue);
 void convert999E5toRGBFloats(unsigned int input, float *red, float *green, float *blue);
@@ -9,6 +9,9 @@
 
 #include "mathutil.h"
 
+#include <random>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 using namespace gl;
@@ -142,6 +145,87 @@ TEST(MathUtilTest, packAndUnpackHalf2x16)
     }
 }
 
+// Test that the conversions to half floats round to nearest even, and that they handle denormals,
+// infinities and NaNs.
+TEST(MathUtilTest, Float16Conversion)
+{
+    EXPECT_EQ(0x0000u, float32ToFloat16(0.0f));
+    EXPECT_EQ(0x8000u, float32ToFloat16(-0.0f));
+    EXPECT_EQ(0x3C00u, float32ToFloat16(1.0f));
+    EXPECT_EQ(0x2E66u, float32ToFloat16(0.1f));
+    EXPECT_EQ(0x7BFFu, float32ToFloat16(65504.0f));
+    EXPECT_EQ(0x7BFFu, float32ToFloat16(65519.0f));
+    EXPECT_EQ(0x7C00u, float32ToFloat16(65520.0f));
+    EXPECT_EQ(0x7C00u, float32ToFloat16(100000.0f));
+    EXPECT_EQ(0xFC00u, float32ToFloat16(-std::numeric_limits<float>::infinity()));
+    EXPECT_EQ(0x7E00u, float32ToFloat16(std::numeric_limits<float>::quiet_NaN()));
+
+    // The smallest denormal is 2^-24. Ties round to even.
+    EXPECT_EQ(0x0001u, float32ToFloat16(ldexp(1.0f, -24)));
+    EXPECT_EQ(0x0000u, float32ToFloat16(ldexp(1.0f, -25)));
+    EXPECT_EQ(0x0002u, float32ToFloat16(ldexp(3.0f, -25)));
+    EXPECT_EQ(0x0400u, float32ToFloat16(ldexp(1.0f, -14)));
+
+    EXPECT_EQ(1.0f, float16ToFloat32(0x3C00));
+    EXPECT_EQ(-2.0f, float16ToFloat32(0xC000));
+    EXPECT_EQ(65504.0f, float16ToFloat32(0x7BFF));
+    EXPECT_EQ(ldexp(1.0f, -24), float16ToFloat32(0x0001));
+    EXPECT_EQ(ldexp(1023.0f, -24), float16ToFloat32(0x03FF));
+    EXPECT_EQ(std::numeric_limits<float>::infinity(), float16ToFloat32(0x7C00));
+    EXPECT_TRUE(isNaN(float16ToFloat32(0x7C01)));
+
+    // Conversions of half floats to floats and back don't change them, except that NaNs are
+    // quieted.
+    for (unsigned int half = 0; half <= 0xFFFF; half++)
+    {
+        unsigned short expected = static_cast<unsigned short>(half);
+        if ((half & 0x7FFF) > 0x7C00)
+        {
+            expected |= 0x0200;
+        }
+        EXPECT_EQ(expected, float32ToFloat16(float16ToFloat32(static_cast<unsigned short>(half))));
+    }
+}
+
+// Test that the bulk conversions of half floats give the same results as the scalar conversions,
+// including for the values at the end of the arrays that don't fill a vector.
+TEST(MathUtilTest, BulkFloat16Conversion)
+{
+    std::vector<unsigned short> halves(0x10000 + 3);
+    for (size_t index = 0; index < halves.size(); index++)
+    {
+        halves[index] = static_cast<unsigned short>(index);
+    }
+
+    std::vector<float> floats(halves.size());
+    convertFloat16ToFloat32(halves.data(), floats.data(), halves.size());
+    for (size_t index = 0; index < halves.size(); index++)
+    {
+        EXPECT_EQ(bitCast<unsigned int>(float16ToFloat32(halves[index])),
+                  bitCast<unsigned int>(floats[index]))
+            << "for half " << halves[index];
+    }
+
+    // Floats with random bits cover every class of value, and also the ties between half floats.
+    std::mt19937 generator(0);
+    for (float &value : floats)
+    {
+        unsigned int bits = generator();
+        if (bits % 4 == 0)
+        {
+            bits = (bits & 0xFFFFE000) | 0x1000;
+        }
+        value = bitCast<float>(bits);
+    }
+
+    convertFloat32ToFloat16(floats.data(), halves.data(), floats.size());
+    for (size_t index = 0; index < floats.size(); index++)
+    {
+        EXPECT_EQ(float32ToFloat16(floats[index]), halves[index])
+            << "for float 0x" << std::hex << bitCast<unsigned int>(floats[index]);
+    }
+}
+
 // Test the correctness of packUnorm4x8 and unpackUnorm4x8 functions.
 // For floats f1 to f4, unpackUnorm4x8(packUnorm4x8(f1, f2, f3, f4)) should be same as f1 to f4.
 TEST(MathUtilTest, packAndUnpackUnorm4x8)
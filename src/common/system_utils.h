@@ -22,6 +22,11 @@ Optional<std::string> GetCWD();
 bool SetCWD(const char *dirName);
 bool SetEnvironmentVar(const char *variableName, const char *value);
 
+// Returns true if the directory exists once the call returns.
+bool MakeDirectory(const char *dirName);
+
+unsigned int GetCurrentProcessID();
+
 }  // namespace angle
 
 #endif  // COMMON_SYSTEM_UTILS_H_
@@ -8,6 +8,7 @@
 
 #include "system_utils.h"
 
+#include <errno.h>
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
@@ -86,4 +87,14 @@ bool SetEnvironmentVar(const char *variableName, const char *value)
     return (setenv(variableName, value, 1) == 0);
 }
 
+bool MakeDirectory(const char *dirName)
+{
+    return (mkdir(dirName, 0755) == 0 || errno == EEXIST);
+}
+
+unsigned int GetCurrentProcessID()
+{
+    return static_cast<unsigned int>(getpid());
+}
+
 }  // namespace angle
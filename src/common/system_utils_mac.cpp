@@ -8,6 +8,8 @@
 
 #include "system_utils.h"
 
+#include <errno.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include <cstdlib>
@@ -91,4 +93,14 @@ bool SetEnvironmentVar(const char *variableName, const char *value)
     return (setenv(variableName, value, 1) == 0);
 }
 
+bool MakeDirectory(const char *dirName)
+{
+    return (mkdir(dirName, 0755) == 0 || errno == EEXIST);
+}
+
+unsigned int GetCurrentProcessID()
+{
+    return static_cast<unsigned int>(getpid());
+}
+
 }  // namespace angle
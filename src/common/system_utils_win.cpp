@@ -76,4 +76,14 @@ bool SetEnvironmentVar(const char *variableName, const char *value)
     return (SetEnvironmentVariableA(variableName, value) == TRUE);
 }
 
+bool MakeDirectory(const char *dirName)
+{
+    return (CreateDirectoryA(dirName, nullptr) == TRUE || GetLastError() == ERROR_ALREADY_EXISTS);
+}
+
+unsigned int GetCurrentProcessID()
+{
+    return static_cast<unsigned int>(::GetCurrentProcessId());
+}
+
 }  // namespace angle
@@ -24,10 +24,10 @@ namespace
 {
 
 template <class IndexType>
-gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
-                                      size_t count,
-                                      bool primitiveRestartEnabled,
-                                      GLuint primitiveRestartIndex)
+gl::IndexRange ComputeTypedIndexRangeScalar(const IndexType *indices,
+                                            size_t count,
+                                            bool primitiveRestartEnabled,
+                                            GLuint primitiveRestartIndex)
 {
     ASSERT(count > 0);
 
@@ -45,12 +45,12 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
             {
                 minIndex = indices[i];
                 maxIndex = indices[i];
-                nonPrimitiveRestartIndices++;
                 break;
             }
         }
 
-        // Loop over the rest of the indices
+        // Loop over the rest of the indices, including the first one found above so it gets
+        // counted
         for (; i < count; i++)
         {
             if (indices[i] != primitiveRestartIndex)
@@ -90,6 +90,269 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                           nonPrimitiveRestartIndices);
 }
 
+// The vector kernels below rely on the primitive restart index being the largest value
+// representable by the index type: restart indices can then never lower the minimum, and only
+// need to be masked out of the maximum.
+template <class IndexType>
+gl::IndexRange MergeVectorIndexRange(const IndexType *indices,
+                                     size_t count,
+                                     size_t vectorCount,
+                                     IndexType minIndex,
+                                     IndexType maxIndex,
+                                     size_t nonPrimitiveRestartIndices,
+                                     bool primitiveRestartEnabled,
+                                     GLuint primitiveRestartIndex)
+{
+    // Handle the indices that don't fill a full vector.
+    if (vectorCount < count)
+    {
+        gl::IndexRange tailRange =
+            ComputeTypedIndexRangeScalar(indices + vectorCount, count - vectorCount,
+                                         primitiveRestartEnabled, primitiveRestartIndex);
+        if (tailRange.vertexIndexCount > 0)
+        {
+            minIndex = std::min(minIndex, static_cast<IndexType>(tailRange.start));
+            maxIndex = std::max(maxIndex, static_cast<IndexType>(tailRange.end));
+            nonPrimitiveRestartIndices += tailRange.vertexIndexCount;
+        }
+    }
+
+    if (nonPrimitiveRestartIndices == 0)
+    {
+        return gl::IndexRange();
+    }
+
+    return gl::IndexRange(static_cast<size_t>(minIndex), static_cast<size_t>(maxIndex),
+                          nonPrimitiveRestartIndices);
+}
+
+#if defined(ANGLE_USE_SSE)
+// SSE2 only has unsigned min/max for bytes. Wider index types are biased into the signed range so
+// the signed compares can be used instead.
+template <class IndexType>
+struct SSE2IndexOps;
+
+template <>
+struct SSE2IndexOps<GLubyte>
+{
+    static __m128i Bias() { return _mm_setzero_si128(); }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+};
+
+template <>
+struct SSE2IndexOps<GLushort>
+{
+    static __m128i Bias() { return _mm_set1_epi16(static_cast<short>(0x8000)); }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epi16(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epi16(a, b); }
+};
+
+template <>
+struct SSE2IndexOps<GLuint>
+{
+    static __m128i Bias() { return _mm_set1_epi32(static_cast<int>(0x80000000u)); }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+    static __m128i Min(__m128i a, __m128i b)
+    {
+        __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+    }
+    static __m128i Max(__m128i a, __m128i b)
+    {
+        __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+    }
+};
+
+template <class IndexType>
+gl::IndexRange ComputeTypedIndexRangeSSE2(const IndexType *indices,
+                                          size_t count,
+                                          bool primitiveRestartEnabled,
+                                          GLuint primitiveRestartIndex)
+{
+    using Ops                   = SSE2IndexOps<IndexType>;
+    constexpr size_t kLaneCount = sizeof(__m128i) / sizeof(IndexType);
+    const __m128i bias          = Ops::Bias();
+    const __m128i allOnes       = _mm_set1_epi32(-1);
+
+    ASSERT(primitiveRestartIndex == std::numeric_limits<IndexType>::max());
+
+    // Accumulate in the biased domain, starting from the largest and smallest index values.
+    __m128i minValues           = _mm_xor_si128(allOnes, bias);
+    __m128i maxValues           = bias;
+    size_t primitiveRestartBits = 0;
+    size_t i                    = 0;
+
+    if (primitiveRestartEnabled)
+    {
+        for (; i + kLaneCount <= count; i += kLaneCount)
+        {
+            __m128i values    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&indices[i]));
+            __m128i isRestart = Ops::Equal(values, allOnes);
+            minValues         = Ops::Min(minValues, _mm_xor_si128(values, bias));
+            maxValues =
+                Ops::Max(maxValues, _mm_xor_si128(_mm_andnot_si128(isRestart, values), bias));
+            primitiveRestartBits +=
+                gl::BitCount(static_cast<uint32_t>(_mm_movemask_epi8(isRestart)));
+        }
+    }
+    else
+    {
+        for (; i + kLaneCount <= count; i += kLaneCount)
+        {
+            __m128i values = _mm_xor_si128(
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(&indices[i])), bias);
+            minValues = Ops::Min(minValues, values);
+            maxValues = Ops::Max(maxValues, values);
+        }
+    }
+
+    IndexType minLanes[kLaneCount];
+    IndexType maxLanes[kLaneCount];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(minLanes), _mm_xor_si128(minValues, bias));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(maxLanes), _mm_xor_si128(maxValues, bias));
+
+    IndexType minIndex = minLanes[0];
+    IndexType maxIndex = maxLanes[0];
+    for (size_t lane = 1; lane < kLaneCount; lane++)
+    {
+        minIndex = std::min(minIndex, minLanes[lane]);
+        maxIndex = std::max(maxIndex, maxLanes[lane]);
+    }
+
+    // _mm_movemask_epi8 produces one bit per byte of each restart lane.
+    size_t primitiveRestartIndices = primitiveRestartBits / sizeof(IndexType);
+
+    return MergeVectorIndexRange(indices, count, i, minIndex, maxIndex,
+                                 i - primitiveRestartIndices, primitiveRestartEnabled,
+                                 primitiveRestartIndex);
+}
+#endif  // defined(ANGLE_USE_SSE)
+
+#if defined(ANGLE_USE_NEON)
+template <class IndexType>
+struct NEONIndexOps;
+
+template <>
+struct NEONIndexOps<GLubyte>
+{
+    using Vector = uint8x16_t;
+    static Vector Load(const GLubyte *indices) { return vld1q_u8(indices); }
+    static Vector Splat(GLubyte value) { return vdupq_n_u8(value); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u8(a, b); }
+    static Vector Clear(Vector a, Vector mask) { return vbicq_u8(a, mask); }
+    static Vector Min(Vector a, Vector b) { return vminq_u8(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u8(a, b); }
+    static size_t CountSet(Vector mask) { return vaddvq_u8(vshrq_n_u8(mask, 7)); }
+    static GLubyte ReduceMin(Vector a) { return vminvq_u8(a); }
+    static GLubyte ReduceMax(Vector a) { return vmaxvq_u8(a); }
+};
+
+template <>
+struct NEONIndexOps<GLushort>
+{
+    using Vector = uint16x8_t;
+    static Vector Load(const GLushort *indices) { return vld1q_u16(indices); }
+    static Vector Splat(GLushort value) { return vdupq_n_u16(value); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u16(a, b); }
+    static Vector Clear(Vector a, Vector mask) { return vbicq_u16(a, mask); }
+    static Vector Min(Vector a, Vector b) { return vminq_u16(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u16(a, b); }
+    static size_t CountSet(Vector mask) { return vaddvq_u16(vshrq_n_u16(mask, 15)); }
+    static GLushort ReduceMin(Vector a) { return vminvq_u16(a); }
+    static GLushort ReduceMax(Vector a) { return vmaxvq_u16(a); }
+};
+
+template <>
+struct NEONIndexOps<GLuint>
+{
+    using Vector = uint32x4_t;
+    static Vector Load(const GLuint *indices) { return vld1q_u32(indices); }
+    static Vector Splat(GLuint value) { return vdupq_n_u32(value); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u32(a, b); }
+    static Vector Clear(Vector a, Vector mask) { return vbicq_u32(a, mask); }
+    static Vector Min(Vector a, Vector b) { return vminq_u32(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u32(a, b); }
+    static size_t CountSet(Vector mask) { return vaddvq_u32(vshrq_n_u32(mask, 31)); }
+    static GLuint ReduceMin(Vector a) { return vminvq_u32(a); }
+    static GLuint ReduceMax(Vector a) { return vmaxvq_u32(a); }
+};
+
+template <class IndexType>
+gl::IndexRange ComputeTypedIndexRangeNEON(const IndexType *indices,
+                                          size_t count,
+                                          bool primitiveRestartEnabled,
+                                          GLuint primitiveRestartIndex)
+{
+    using Ops                   = NEONIndexOps<IndexType>;
+    using Vector                = typename Ops::Vector;
+    constexpr size_t kLaneCount = sizeof(Vector) / sizeof(IndexType);
+
+    ASSERT(primitiveRestartIndex == std::numeric_limits<IndexType>::max());
+
+    const Vector restartValues     = Ops::Splat(std::numeric_limits<IndexType>::max());
+    Vector minValues               = restartValues;
+    Vector maxValues               = Ops::Splat(0);
+    size_t primitiveRestartIndices = 0;
+    size_t i                       = 0;
+
+    if (primitiveRestartEnabled)
+    {
+        for (; i + kLaneCount <= count; i += kLaneCount)
+        {
+            Vector values    = Ops::Load(&indices[i]);
+            Vector isRestart = Ops::Equal(values, restartValues);
+            minValues        = Ops::Min(minValues, values);
+            maxValues        = Ops::Max(maxValues, Ops::Clear(values, isRestart));
+            primitiveRestartIndices += Ops::CountSet(isRestart);
+        }
+    }
+    else
+    {
+        for (; i + kLaneCount <= count; i += kLaneCount)
+        {
+            Vector values = Ops::Load(&indices[i]);
+            minValues     = Ops::Min(minValues, values);
+            maxValues     = Ops::Max(maxValues, values);
+        }
+    }
+
+    return MergeVectorIndexRange(indices, count, i, Ops::ReduceMin(minValues),
+                                 Ops::ReduceMax(maxValues), i - primitiveRestartIndices,
+                                 primitiveRestartEnabled, primitiveRestartIndex);
+}
+#endif  // defined(ANGLE_USE_NEON)
+
+template <class IndexType>
+gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
+                                      size_t count,
+                                      bool primitiveRestartEnabled,
+                                      GLuint primitiveRestartIndex)
+{
+    // Short ranges, such as the per-draw ranges of small meshes, aren't worth the vector setup.
+    constexpr size_t kMinVectorIndexCount = 64;
+
+#if defined(ANGLE_USE_SSE)
+    if (count >= kMinVectorIndexCount && gl::supportsSSE2())
+    {
+        return ComputeTypedIndexRangeSSE2(indices, count, primitiveRestartEnabled,
+                                          primitiveRestartIndex);
+    }
+#elif defined(ANGLE_USE_NEON)
+    if (count >= kMinVectorIndexCount)
+    {
+        return ComputeTypedIndexRangeNEON(indices, count, primitiveRestartEnabled,
+                                          primitiveRestartIndex);
+    }
+#endif
+
+    return ComputeTypedIndexRangeScalar(indices, count, primitiveRestartEnabled,
+                                        primitiveRestartIndex);
+}
+
 }  // anonymous namespace
 
 namespace gl
@@ -593,6 +856,23 @@ IndexRange ComputeIndexRange(GLenum indexType,
     }
 }
 
+void ComputeBlockIndexRanges(GLenum indexType,
+                             const GLvoid *indices,
+                             size_t blockSize,
+                             size_t blockCount,
+                             bool primitiveRestartEnabled,
+                             IndexRange *outRanges)
+{
+    const uint8_t *blockData     = static_cast<const uint8_t *>(indices);
+    const size_t blockIndexCount = blockSize / ElementTypeSize(indexType);
+    for (size_t block = 0; block < blockCount; ++block)
+    {
+        outRanges[block] =
+            ComputeIndexRange(indexType, blockData, blockIndexCount, primitiveRestartEnabled);
+        blockData += blockSize;
+    }
+}
+
 GLuint GetPrimitiveRestartIndex(GLenum indexType)
 {
     switch (indexType)
@@ -74,6 +74,14 @@ IndexRange ComputeIndexRange(GLenum indexType,
                              size_t count,
                              bool primitiveRestartEnabled);
 
+// Find the range of index values of each of blockCount consecutive blocks of blockSize bytes.
+void ComputeBlockIndexRanges(GLenum indexType,
+                             const GLvoid *indices,
+                             size_t blockSize,
+                             size_t blockCount,
+                             bool primitiveRestartEnabled,
+                             IndexRange *outRanges);
+
 // Get the primitive restart index value for the given index type.
 GLuint GetPrimitiveRestartIndex(GLenum indexType);
 
@@ -177,4 +177,77 @@ TEST(ParseArrayIndex, ArrayIndexOutOfRange)
     EXPECT_EQ(15u, nameLengthWithoutArrayIndex);
 }
 
+// Build an index buffer large enough to hit the vectorized index range paths, with an odd length
+// so that the scalar remainder is exercised too.
+template <typename IndexType>
+std::vector<IndexType> MakeIndexRangeTestData(size_t count)
+{
+    std::vector<IndexType> indices(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        indices[i] = static_cast<IndexType>(100 + (i * 7) % 50);
+    }
+    return indices;
+}
+
+template <typename IndexType>
+void CheckComputeIndexRange(GLenum indexType)
+{
+    const IndexType restartIndex = std::numeric_limits<IndexType>::max();
+
+    std::vector<IndexType> indices = MakeIndexRangeTestData<IndexType>(1001);
+    indices[3]                     = 10;
+    indices[997]                   = 200;
+
+    gl::IndexRange range = gl::ComputeIndexRange(indexType, indices.data(), indices.size(), false);
+    EXPECT_EQ(10u, range.start);
+    EXPECT_EQ(200u, range.end);
+    EXPECT_EQ(1001u, range.vertexIndexCount);
+
+    // Restart indices are excluded from the range only when primitive restart is enabled.
+    indices[0]   = restartIndex;
+    indices[500] = restartIndex;
+    indices[999] = restartIndex;
+
+    range = gl::ComputeIndexRange(indexType, indices.data(), indices.size(), true);
+    EXPECT_EQ(10u, range.start);
+    EXPECT_EQ(200u, range.end);
+    EXPECT_EQ(998u, range.vertexIndexCount);
+
+    range = gl::ComputeIndexRange(indexType, indices.data(), indices.size(), false);
+    EXPECT_EQ(10u, range.start);
+    EXPECT_EQ(static_cast<size_t>(restartIndex), range.end);
+    EXPECT_EQ(1001u, range.vertexIndexCount);
+
+    // A buffer made only of restart indices has no vertices.
+    std::vector<IndexType> restartOnly(257, restartIndex);
+    range = gl::ComputeIndexRange(indexType, restartOnly.data(), restartOnly.size(), true);
+    EXPECT_EQ(0u, range.vertexIndexCount);
+
+    // Short ranges with a leading restart index count each vertex index once.
+    IndexType shortIndices[] = {restartIndex, 5, 3, restartIndex, 9};
+    range = gl::ComputeIndexRange(indexType, shortIndices, 5, true);
+    EXPECT_EQ(3u, range.start);
+    EXPECT_EQ(9u, range.end);
+    EXPECT_EQ(3u, range.vertexIndexCount);
+}
+
+// Test computing the index range of unsigned byte indices.
+TEST(ComputeIndexRange, UnsignedByte)
+{
+    CheckComputeIndexRange<GLubyte>(GL_UNSIGNED_BYTE);
+}
+
+// Test computing the index range of unsigned short indices.
+TEST(ComputeIndexRange, UnsignedShort)
+{
+    CheckComputeIndexRange<GLushort>(GL_UNSIGNED_SHORT);
+}
+
+// Test computing the index range of unsigned int indices.
+TEST(ComputeIndexRange, UnsignedInt)
+{
+    CheckComputeIndexRange<GLuint>(GL_UNSIGNED_INT);
+}
+
 }  // anonymous namespace
@@ -413,6 +413,25 @@ void DirectiveParser::parseDefine(Token *token)
         // the replacement list for either form of macro.
         macro->replacements.front().setHasLeadingSpace(false);
     }
+    if (macro->type == Macro::kTypeFunc)
+    {
+        macro->replacementParameterIndices.reserve(macro->replacements.size());
+        for (const Token &repl : macro->replacements)
+        {
+            int parameterIndex = -1;
+            if (repl.type == Token::IDENTIFIER)
+            {
+                auto parameter = std::find(macro->parameters.begin(), macro->parameters.end(),
+                                           repl.text);
+                if (parameter != macro->parameters.end())
+                {
+                    parameterIndex =
+                        static_cast<int>(std::distance(macro->parameters.begin(), parameter));
+                }
+            }
+            macro->replacementParameterIndices.push_back(parameterIndex);
+        }
+    }
 
     // Check for macro redefinition.
     MacroSet::const_iterator iter = mMacroSet->find(macro->name);
@@ -7,9 +7,9 @@
 #ifndef COMPILER_PREPROCESSOR_MACRO_H_
 #define COMPILER_PREPROCESSOR_MACRO_H_
 
-#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace pp
@@ -39,9 +39,13 @@ struct Macro
     std::string name;
     Parameters parameters;
     Replacements replacements;
+    // For each replacement token of a function-like macro, the index of the parameter it names or
+    // -1, so that expanding the macro doesn't need to search the parameters.
+    std::vector<int> replacementParameterIndices;
 };
 
-typedef std::map<std::string, std::shared_ptr<Macro>> MacroSet;
+// Looked up for every identifier token, so shaders with many macros need a hashed table.
+typedef std::unordered_map<std::string, std::shared_ptr<Macro>> MacroSet;
 
 void PredefineMacro(MacroSet *macroSet, const char *name, int value);
 
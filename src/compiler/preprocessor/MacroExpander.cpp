@@ -20,6 +20,9 @@ namespace
 
 const size_t kMaxContextTokens = 10000;
 
+// Bounds the number of contexts kept for reuse, which is the deepest nesting of invocations seen.
+const size_t kMaxFreeContexts = 64;
+
 class TokenLexer : public Lexer
 {
   public:
@@ -100,6 +103,10 @@ MacroExpander::~MacroExpander()
     {
         delete context;
     }
+    for (MacroContext *context : mFreeContexts)
+    {
+        delete context;
+    }
 }
 
 void MacroExpander::lex(Token *token)
@@ -118,7 +125,7 @@ void MacroExpander::lex(Token *token)
         if (iter == mMacroSet->end())
             break;
 
-        std::shared_ptr<Macro> macro = iter->second;
+        const std::shared_ptr<Macro> &macro = iter->second;
         if (macro->disabled)
         {
             // If a particular token is not expanded, it is never expanded.
@@ -158,7 +165,7 @@ void MacroExpander::getToken(Token *token)
 
     if (!mContextStack.empty())
     {
-        *token = mContextStack.back()->get();
+        mContextStack.back()->get(token);
     }
     else
     {
@@ -173,7 +180,7 @@ void MacroExpander::ungetToken(const Token &token)
     {
         MacroContext *context = mContextStack.back();
         context->unget();
-        ASSERT(context->replacements[context->index] == token);
+        ASSERT(context->isNextToken(token));
     }
     else
     {
@@ -193,25 +200,26 @@ bool MacroExpander::isNextTokenLeftParen()
     return lparen;
 }
 
-bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identifier)
+bool MacroExpander::pushMacro(const std::shared_ptr<Macro> &macro, const Token &identifier)
 {
     ASSERT(!macro->disabled);
     ASSERT(!identifier.expansionDisabled());
     ASSERT(identifier.type == Token::IDENTIFIER);
     ASSERT(identifier.text == macro->name);
 
-    std::vector<Token> replacements;
-    if (!expandMacro(*macro, identifier, &replacements))
+    MacroContext *context = allocateContext();
+    if (!expandMacro(*macro, identifier, context))
+    {
+        releaseContext(context);
         return false;
+    }
 
     // Macro is disabled for expansion until it is popped off the stack.
     macro->disabled = true;
 
-    MacroContext *context = new MacroContext;
-    context->macro        = macro;
-    context->replacements.swap(replacements);
+    context->macro = macro;
     mContextStack.push_back(context);
-    mTotalTokensInContexts += context->replacements.size();
+    mTotalTokensInContexts += context->size();
     return true;
 }
 
@@ -234,39 +242,61 @@ void MacroExpander::popMacro()
         context->macro->disabled = false;
     }
     context->macro->expansionCount--;
-    mTotalTokensInContexts -= context->replacements.size();
-    delete context;
+    mTotalTokensInContexts -= context->size();
+    releaseContext(context);
+}
+
+MacroExpander::MacroContext *MacroExpander::allocateContext()
+{
+    if (mFreeContexts.empty())
+    {
+        return new MacroContext;
+    }
+    MacroContext *context = mFreeContexts.back();
+    mFreeContexts.pop_back();
+    return context;
+}
+
+void MacroExpander::releaseContext(MacroContext *context)
+{
+    if (mFreeContexts.size() >= kMaxFreeContexts)
+    {
+        delete context;
+        return;
+    }
+    context->reset();
+    mFreeContexts.push_back(context);
 }
 
 bool MacroExpander::expandMacro(const Macro &macro,
                                 const Token &identifier,
-                                std::vector<Token> *replacements)
+                                MacroContext *context)
 {
-    replacements->clear();
+    ASSERT(context->empty() && context->expandedReplacements.empty());
 
     // In the case of an object-like macro, the replacement list gets its location
     // from the identifier, but in the case of a function-like macro, the replacement
     // list gets its location from the closing parenthesis of the macro invocation.
     // This is tested by dEQP-GLES3.functional.shaders.preprocessor.predefined_macros.*
-    SourceLocation replacementLocation = identifier.location;
+    context->replacementLocation = identifier.location;
     if (macro.type == Macro::kTypeObj)
     {
-        replacements->assign(macro.replacements.begin(), macro.replacements.end());
+        context->replacements = &macro.replacements;
 
         if (macro.predefined)
         {
             const char kLine[] = "__LINE__";
             const char kFile[] = "__FILE__";
 
-            ASSERT(replacements->size() == 1);
-            Token &repl = replacements->front();
-            if (macro.name == kLine)
+            ASSERT(macro.replacements.size() == 1);
+            if (macro.name == kLine || macro.name == kFile)
             {
-                repl.text = ToString(identifier.location.line);
-            }
-            else if (macro.name == kFile)
-            {
-                repl.text = ToString(identifier.location.file);
+                context->expandedReplacements = macro.replacements;
+                context->replacements         = &context->expandedReplacements;
+
+                Token &repl = context->expandedReplacements.front();
+                repl.text   = ToString(macro.name == kLine ? identifier.location.line
+                                                           : identifier.location.file);
             }
         }
     }
@@ -275,24 +305,17 @@ bool MacroExpander::expandMacro(const Macro &macro,
         ASSERT(macro.type == Macro::kTypeFunc);
         std::vector<MacroArg> args;
         args.reserve(macro.parameters.size());
-        if (!collectMacroArgs(macro, identifier, &args, &replacementLocation))
+        if (!collectMacroArgs(macro, identifier, &args, &context->replacementLocation))
             return false;
 
-        replaceMacroParams(macro, args, replacements);
+        replaceMacroParams(macro, args, &context->expandedReplacements);
+        context->replacements = &context->expandedReplacements;
     }
 
-    for (std::size_t i = 0; i < replacements->size(); ++i)
-    {
-        Token &repl = replacements->at(i);
-        if (i == 0)
-        {
-            // The first token in the replacement list inherits the padding
-            // properties of the identifier token.
-            repl.setAtStartOfLine(identifier.atStartOfLine());
-            repl.setHasLeadingSpace(identifier.hasLeadingSpace());
-        }
-        repl.location = replacementLocation;
-    }
+    // The first token in the replacement list inherits the padding
+    // properties of the identifier token.
+    context->firstAtStartOfLine   = identifier.atStartOfLine();
+    context->firstHasLeadingSpace = identifier.hasLeadingSpace();
     return true;
 }
 
@@ -382,6 +405,7 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
     size_t numTokens = 0;
     for (auto &arg : *args)
     {
+        size_t numArgTokens = arg.size();
         TokenLexer lexer(&arg);
         if (mAllowedMacroExpansionDepth < 1)
         {
@@ -392,6 +416,7 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
         MacroExpander expander(&lexer, mMacroSet, mDiagnostics, mAllowedMacroExpansionDepth - 1);
 
         arg.clear();
+        arg.reserve(numArgTokens);
         expander.lex(&token);
         while (token.type != Token::LAST)
         {
@@ -412,6 +437,9 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
                                        const std::vector<MacroArg> &args,
                                        std::vector<Token> *replacements)
 {
+    ASSERT(macro.replacementParameterIndices.size() == macro.replacements.size());
+    replacements->reserve(macro.replacements.size());
+
     for (std::size_t i = 0; i < macro.replacements.size(); ++i)
     {
         if (!replacements->empty() &&
@@ -423,24 +451,13 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
         }
 
         const Token &repl = macro.replacements[i];
-        if (repl.type != Token::IDENTIFIER)
+        int iArg          = macro.replacementParameterIndices[i];
+        if (iArg < 0)
         {
             replacements->push_back(repl);
             continue;
         }
 
-        // TODO(alokp): Optimize this.
-        // There is no need to search for macro params every time.
-        // The param index can be cached with the replacement token.
-        Macro::Parameters::const_iterator iter =
-            std::find(macro.parameters.begin(), macro.parameters.end(), repl.text);
-        if (iter == macro.parameters.end())
-        {
-            replacements->push_back(repl);
-            continue;
-        }
-
-        std::size_t iArg    = std::distance(macro.parameters.begin(), iter);
         const MacroArg &arg = args[iArg];
         if (arg.empty())
         {
@@ -454,7 +471,12 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
     }
 }
 
-MacroExpander::MacroContext::MacroContext() : macro(0), index(0)
+MacroExpander::MacroContext::MacroContext()
+    : macro(0),
+      index(0),
+      replacements(&expandedReplacements),
+      firstAtStartOfLine(false),
+      firstHasLeadingSpace(false)
 {
 }
 
@@ -462,14 +484,28 @@ MacroExpander::MacroContext::~MacroContext()
 {
 }
 
+void MacroExpander::MacroContext::reset()
+{
+    macro.reset();
+    index        = 0;
+    replacements = &expandedReplacements;
+    // Keeps the storage for the next invocation.
+    expandedReplacements.clear();
+}
+
 bool MacroExpander::MacroContext::empty() const
 {
-    return index == replacements.size();
+    return index == replacements->size();
 }
 
-const Token &MacroExpander::MacroContext::get()
+size_t MacroExpander::MacroContext::size() const
 {
-    return replacements[index++];
+    return replacements->size();
+}
+
+void MacroExpander::MacroContext::get(Token *token)
+{
+    read(index++, token);
 }
 
 void MacroExpander::MacroContext::unget()
@@ -478,4 +514,22 @@ void MacroExpander::MacroContext::unget()
     --index;
 }
 
+bool MacroExpander::MacroContext::isNextToken(const Token &token) const
+{
+    Token nextToken;
+    read(index, &nextToken);
+    return nextToken == token;
+}
+
+void MacroExpander::MacroContext::read(std::size_t tokenIndex, Token *token) const
+{
+    *token          = (*replacements)[tokenIndex];
+    token->location = replacementLocation;
+    if (tokenIndex == 0)
+    {
+        token->setAtStartOfLine(firstAtStartOfLine);
+        token->setHasLeadingSpace(firstHasLeadingSpace);
+    }
+}
+
 }  // namespace pp
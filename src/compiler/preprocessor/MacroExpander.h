@@ -12,12 +12,12 @@
 
 #include "compiler/preprocessor/Lexer.h"
 #include "compiler/preprocessor/Macro.h"
+#include "compiler/preprocessor/SourceLocation.h"
 
 namespace pp
 {
 
 class Diagnostics;
-struct SourceLocation;
 
 class MacroExpander : public Lexer
 {
@@ -35,10 +35,12 @@ class MacroExpander : public Lexer
     void ungetToken(const Token &token);
     bool isNextTokenLeftParen();
 
-    bool pushMacro(std::shared_ptr<Macro> macro, const Token &identifier);
+    struct MacroContext;
+
+    bool pushMacro(const std::shared_ptr<Macro> &macro, const Token &identifier);
     void popMacro();
 
-    bool expandMacro(const Macro &macro, const Token &identifier, std::vector<Token> *replacements);
+    bool expandMacro(const Macro &macro, const Token &identifier, MacroContext *context);
 
     typedef std::vector<Token> MacroArg;
     bool collectMacroArgs(const Macro &macro,
@@ -49,25 +51,45 @@ class MacroExpander : public Lexer
                             const std::vector<MacroArg> &args,
                             std::vector<Token> *replacements);
 
+    // The replacement list of a macro invocation. The location and the padding of the invocation
+    // are given to the replacement tokens as they are read, so that the replacement list of an
+    // object-like macro can be read without copying it.
     struct MacroContext
     {
         MacroContext();
         ~MacroContext();
+        void reset();
         bool empty() const;
-        const Token &get();
+        size_t size() const;
+        void get(Token *token);
         void unget();
+        bool isNextToken(const Token &token) const;
 
         std::shared_ptr<Macro> macro;
         std::size_t index;
-        std::vector<Token> replacements;
+        // Points to the replacement list of the macro, or to expandedReplacements if the
+        // replacement list had to be modified for this invocation.
+        const std::vector<Token> *replacements;
+        std::vector<Token> expandedReplacements;
+        SourceLocation replacementLocation;
+        bool firstAtStartOfLine;
+        bool firstHasLeadingSpace;
+
+      private:
+        void read(std::size_t tokenIndex, Token *token) const;
     };
 
+    MacroContext *allocateContext();
+    void releaseContext(MacroContext *context);
+
     Lexer *mLexer;
     MacroSet *mMacroSet;
     Diagnostics *mDiagnostics;
 
     std::unique_ptr<Token> mReserveToken;
     std::vector<MacroContext *> mContextStack;
+    // Contexts of finished invocations, kept to reuse the storage of their replacement lists.
+    std::vector<MacroContext *> mFreeContexts;
     size_t mTotalTokensInContexts;
 
     int mAllowedMacroExpansionDepth;
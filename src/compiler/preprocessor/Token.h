@@ -89,6 +89,9 @@ struct Token
     int type;
     unsigned int flags;
     SourceLocation location;
+
+    // Owned instead of pointing into the source or an interned pool. The tokenizer copies it out
+    // of the flex buffer, which gets reused, and the GLSL lexer consumes it as a std::string.
     std::string text;
 };
 
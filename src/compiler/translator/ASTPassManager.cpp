@@ -0,0 +1,151 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ASTPassManager.cpp: Runs the AST passes of a compilation, fusing the passes that can share a
+// single walk over the tree.
+//
+
+#include "compiler/translator/ASTPassManager.h"
+
+#include "compiler/translator/FusedTraverser.h"
+#include "compiler/translator/InfoSink.h"
+
+namespace sh
+{
+
+TFusablePass::TFusablePass(bool preVisit,
+                           bool inVisit,
+                           bool postVisit,
+                           TSymbolTable *symbolTable)
+    : TIntermTraverser(preVisit, inVisit, postVisit, symbolTable)
+{
+}
+
+bool TFusablePass::finish()
+{
+    updateTree();
+    return true;
+}
+
+ASTPassManager::ASTPassManager(TIntermBlock *root, TInfoSinkBase *timingsOut)
+    : mRoot(root), mTimingsOut(timingsOut)
+{
+}
+
+ASTPassManager::~ASTPassManager()
+{
+    // Passes that were added after a failed compilation step are never run.
+    for (TFusablePass *pass : mFusedPasses)
+    {
+        delete pass;
+    }
+
+    if (!mTimingsOut)
+    {
+        return;
+    }
+    endPass();
+
+    Clock::duration total = Clock::duration::zero();
+    for (const PassTiming &timing : mTimings)
+    {
+        std::chrono::microseconds duration =
+            std::chrono::duration_cast<std::chrono::microseconds>(timing.duration);
+        *mTimingsOut << "AST pass " << timing.name << ": " << duration.count() << " us\n";
+        total += timing.duration;
+    }
+    *mTimingsOut << "AST passes total: "
+                 << std::chrono::duration_cast<std::chrono::microseconds>(total).count()
+                 << " us\n";
+}
+
+void ASTPassManager::beginPass(const char *name)
+{
+    if (!mTimingsOut)
+    {
+        return;
+    }
+    endPass();
+    mCurrentPassName  = name;
+    mCurrentPassStart = Clock::now();
+}
+
+void ASTPassManager::endPass()
+{
+    ASSERT(mTimingsOut);
+    if (mCurrentPassName.empty())
+    {
+        return;
+    }
+
+    PassTiming timing;
+    timing.name     = mCurrentPassName;
+    timing.duration = Clock::now() - mCurrentPassStart;
+    mTimings.push_back(timing);
+    mCurrentPassName.clear();
+}
+
+void ASTPassManager::addFusedPass(const char *name, TFusablePass *pass)
+{
+    ASSERT(pass);
+    mFusedPasses.push_back(pass);
+
+    if (mTimingsOut)
+    {
+        if (!mFusedPassNames.empty())
+        {
+            mFusedPassNames += " + ";
+        }
+        mFusedPassNames += name;
+    }
+}
+
+bool ASTPassManager::runFusedPasses()
+{
+    if (mFusedPasses.empty())
+    {
+        return true;
+    }
+
+    if (mTimingsOut)
+    {
+        beginPass(mFusedPassNames.c_str());
+        mFusedPassNames.clear();
+    }
+
+    // A single pass doesn't need the bookkeeping of the fused traverser.
+    if (mFusedPasses.size() == 1)
+    {
+        mRoot->traverse(mFusedPasses[0]);
+    }
+    else
+    {
+        TFusedTraverser fusedTraverser;
+        for (TFusablePass *pass : mFusedPasses)
+        {
+            fusedTraverser.addTraverser(pass);
+        }
+        mRoot->traverse(&fusedTraverser);
+    }
+
+    bool success = true;
+    for (TFusablePass *pass : mFusedPasses)
+    {
+        if (success)
+        {
+            success = pass->finish();
+        }
+        delete pass;
+    }
+    mFusedPasses.clear();
+
+    if (mTimingsOut)
+    {
+        endPass();
+    }
+    return success;
+}
+
+}  // namespace sh
@@ -0,0 +1,85 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ASTPassManager.h: Runs the AST passes of a compilation. Passes that only need a single
+// traversal of the tree and don't depend on each other's changes can be added as fused passes,
+// which are all run in a single walk over the tree. The manager can also time each pass.
+//
+
+#ifndef COMPILER_TRANSLATOR_ASTPASSMANAGER_H_
+#define COMPILER_TRANSLATOR_ASTPASSMANAGER_H_
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "compiler/translator/IntermTraverse.h"
+
+namespace sh
+{
+
+class TInfoSinkBase;
+
+// A pass that can be fused with other passes. The traverser must not override the traverse*()
+// functions. finish() is called after the walk over the tree, in the order in which the passes
+// were added.
+class TFusablePass : public TIntermTraverser
+{
+  public:
+    TFusablePass(bool preVisit,
+                 bool inVisit,
+                 bool postVisit,
+                 TSymbolTable *symbolTable = nullptr);
+
+    // Applies the changes that the pass queued during the walk. Returns false if the pass found
+    // an error in the shader.
+    virtual bool finish();
+};
+
+class ASTPassManager : angle::NonCopyable
+{
+  public:
+    // If timingsOut is not null, the time spent in each pass is written to it when the manager
+    // is destroyed.
+    ASTPassManager(TIntermBlock *root, TInfoSinkBase *timingsOut);
+    ~ASTPassManager();
+
+    // Starts timing a pass that is run outside the manager. The pass is timed until the next
+    // call to beginPass() or runFusedPasses(), or until the manager is destroyed.
+    void beginPass(const char *name);
+
+    // Takes ownership of a pool-allocated pass. The pass is run by the next runFusedPasses().
+    void addFusedPass(const char *name, TFusablePass *pass);
+
+    // Runs the added passes in a single walk over the tree. Returns false if any of them fails,
+    // in which case the passes that were added after the failing one are not finished.
+    bool runFusedPasses();
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct PassTiming
+    {
+        std::string name;
+        Clock::duration duration;
+    };
+
+    void endPass();
+
+    TIntermBlock *mRoot;
+    TInfoSinkBase *mTimingsOut;
+
+    std::vector<TFusablePass *> mFusedPasses;
+    std::string mFusedPassNames;
+
+    std::vector<PassTiming> mTimings;
+    std::string mCurrentPassName;
+    Clock::time_point mCurrentPassStart;
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_ASTPASSMANAGER_H_
@@ -6,18 +6,18 @@
 
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "angle_gl.h"
-#include "compiler/translator/IntermTraverse.h"
+#include "compiler/translator/ASTPassManager.h"
 #include "compiler/translator/SymbolTable.h"
 #include "compiler/translator/StaticType.h"
 
 namespace sh
 {
 
-class BuiltInFunctionEmulator::BuiltInFunctionEmulationMarker : public TIntermTraverser
+class BuiltInFunctionEmulator::BuiltInFunctionEmulationMarker : public TFusablePass
 {
   public:
     BuiltInFunctionEmulationMarker(BuiltInFunctionEmulator &emulator)
-        : TIntermTraverser(true, false, false), mEmulator(emulator)
+        : TFusablePass(true, false, false), mEmulator(emulator)
     {
     }
 
@@ -266,6 +266,14 @@ void BuiltInFunctionEmulator::markBuiltInFunctionsForEmulation(TIntermNode *root
     root->traverse(&marker);
 }
 
+TFusablePass *BuiltInFunctionEmulator::createMarkBuiltInFunctionsPass()
+{
+    if (mEmulatedFunctions.empty() && mQueryFunctions.empty())
+        return nullptr;
+
+    return new BuiltInFunctionEmulationMarker(*this);
+}
+
 void BuiltInFunctionEmulator::cleanup()
 {
     mFunctions.clear();
@@ -14,6 +14,8 @@
 namespace sh
 {
 
+class TFusablePass;
+
 struct MiniFunctionId
 {
     constexpr MiniFunctionId(TOperator op         = EOpNull,
@@ -97,6 +99,10 @@ class BuiltInFunctionEmulator
 
     void markBuiltInFunctionsForEmulation(TIntermNode *root);
 
+    // Creates a pass that does the same marking as markBuiltInFunctionsForEmulation(), so that it
+    // can be fused with other passes. Returns nullptr if there are no functions to emulate.
+    TFusablePass *createMarkBuiltInFunctionsPass();
+
     void cleanup();
 
     // "name" gets written as "name_emu".
@@ -9,6 +9,7 @@
 
 #include "angle_gl.h"
 #include "common/utilities.h"
+#include "compiler/translator/ASTPassManager.h"
 #include "compiler/translator/HashNames.h"
 #include "compiler/translator/IntermTraverse.h"
 #include "compiler/translator/SymbolTable.h"
@@ -101,7 +102,7 @@ ShaderVariable *FindVariableInInterfaceBlock(const ImmutableString &name,
 
 // Traverses the intermediate tree to collect all attributes, uniforms, varyings, fragment outputs,
 // and interface blocks.
-class CollectVariablesTraverser : public TIntermTraverser
+class CollectVariablesTraverser : public TFusablePass
 {
   public:
     CollectVariablesTraverser(std::vector<Attribute> *attribs,
@@ -215,7 +216,7 @@ CollectVariablesTraverser::CollectVariablesTraverser(
     int shaderVersion,
     GLenum shaderType,
     const TExtensionBehavior &extensionBehavior)
-    : TIntermTraverser(true, false, false, symbolTable),
+    : TFusablePass(true, false, false, symbolTable),
       mAttribs(attribs),
       mOutputVariables(outputVariables),
       mUniforms(uniforms),
@@ -900,26 +901,24 @@ bool CollectVariablesTraverser::visitBinary(Visit, TIntermBinary *binaryNode)
 
 }  // anonymous namespace
 
-void CollectVariables(TIntermBlock *root,
-                      std::vector<Attribute> *attributes,
-                      std::vector<OutputVariable> *outputVariables,
-                      std::vector<Uniform> *uniforms,
-                      std::vector<Varying> *inputVaryings,
-                      std::vector<Varying> *outputVaryings,
-                      std::vector<InterfaceBlock> *uniformBlocks,
-                      std::vector<InterfaceBlock> *shaderStorageBlocks,
-                      std::vector<InterfaceBlock> *inBlocks,
-                      ShHashFunction64 hashFunction,
-                      TSymbolTable *symbolTable,
-                      int shaderVersion,
-                      GLenum shaderType,
-                      const TExtensionBehavior &extensionBehavior)
+TFusablePass *CreateCollectVariablesPass(std::vector<Attribute> *attributes,
+                                         std::vector<OutputVariable> *outputVariables,
+                                         std::vector<Uniform> *uniforms,
+                                         std::vector<Varying> *inputVaryings,
+                                         std::vector<Varying> *outputVaryings,
+                                         std::vector<InterfaceBlock> *uniformBlocks,
+                                         std::vector<InterfaceBlock> *shaderStorageBlocks,
+                                         std::vector<InterfaceBlock> *inBlocks,
+                                         ShHashFunction64 hashFunction,
+                                         TSymbolTable *symbolTable,
+                                         int shaderVersion,
+                                         GLenum shaderType,
+                                         const TExtensionBehavior &extensionBehavior)
 {
-    CollectVariablesTraverser collect(attributes, outputVariables, uniforms, inputVaryings,
-                                      outputVaryings, uniformBlocks, shaderStorageBlocks, inBlocks,
-                                      hashFunction, symbolTable, shaderVersion, shaderType,
-                                      extensionBehavior);
-    root->traverse(&collect);
+    return new CollectVariablesTraverser(attributes, outputVariables, uniforms, inputVaryings,
+                                         outputVaryings, uniformBlocks, shaderStorageBlocks,
+                                         inBlocks, hashFunction, symbolTable, shaderVersion,
+                                         shaderType, extensionBehavior);
 }
 
 }  // namespace sh
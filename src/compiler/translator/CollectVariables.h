@@ -15,23 +15,22 @@
 namespace sh
 {
 
-class TIntermBlock;
+class TFusablePass;
 class TSymbolTable;
 
-void CollectVariables(TIntermBlock *root,
-                      std::vector<Attribute> *attributes,
-                      std::vector<OutputVariable> *outputVariables,
-                      std::vector<Uniform> *uniforms,
-                      std::vector<Varying> *inputVaryings,
-                      std::vector<Varying> *outputVaryings,
-                      std::vector<InterfaceBlock> *uniformBlocks,
-                      std::vector<InterfaceBlock> *shaderStorageBlocks,
-                      std::vector<InterfaceBlock> *inBlocks,
-                      ShHashFunction64 hashFunction,
-                      TSymbolTable *symbolTable,
-                      int shaderVersion,
-                      GLenum shaderType,
-                      const TExtensionBehavior &extensionBehavior);
+TFusablePass *CreateCollectVariablesPass(std::vector<Attribute> *attributes,
+                                         std::vector<OutputVariable> *outputVariables,
+                                         std::vector<Uniform> *uniforms,
+                                         std::vector<Varying> *inputVaryings,
+                                         std::vector<Varying> *outputVaryings,
+                                         std::vector<InterfaceBlock> *uniformBlocks,
+                                         std::vector<InterfaceBlock> *shaderStorageBlocks,
+                                         std::vector<InterfaceBlock> *inBlocks,
+                                         ShHashFunction64 hashFunction,
+                                         TSymbolTable *symbolTable,
+                                         int shaderVersion,
+                                         GLenum shaderType,
+                                         const TExtensionBehavior &extensionBehavior);
 }
 
 #endif  // COMPILER_TRANSLATOR_COLLECTVARIABLES_H_
@@ -8,8 +8,11 @@
 
 #include <sstream>
 
+#include <anglebase/sha1.h>
+
 #include "angle_gl.h"
 #include "common/utilities.h"
+#include "compiler/translator/ASTPassManager.h"
 #include "compiler/translator/AddAndTrueToLoopCondition.h"
 #include "compiler/translator/CallDAG.h"
 #include "compiler/translator/ClampFragDepth.h"
@@ -395,20 +398,31 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
                                     const TParseContext &parseContext,
                                     ShCompileOptions compileOptions)
 {
+    ASTPassManager passManager(root,
+                               (compileOptions & SH_TIME_AST_PASSES) ? &infoSink.info : nullptr);
+
     // Disallow expressions deemed too complex.
-    if ((compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY) && !limitExpressionComplexity(root))
+    if (compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY)
     {
-        return false;
+        passManager.beginPass("LimitExpressionComplexity");
+        if (!limitExpressionComplexity(root))
+        {
+            return false;
+        }
     }
 
-    if (shouldRunLoopAndIndexingValidation(compileOptions) &&
-        !ValidateLimitations(root, shaderType, &symbolTable, &mDiagnostics))
+    if (shouldRunLoopAndIndexingValidation(compileOptions))
     {
-        return false;
+        passManager.beginPass("ValidateLimitations");
+        if (!ValidateLimitations(root, shaderType, &symbolTable, &mDiagnostics))
+        {
+            return false;
+        }
     }
 
     // Fold expressions that could not be folded before validation that was done as a part of
     // parsing.
+    passManager.beginPass("FoldExpressions");
     FoldExpressions(root, &mDiagnostics);
     // Folding should only be able to generate warnings.
     ASSERT(mDiagnostics.numErrors() == 0);
@@ -420,6 +434,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     //      for float, so float literal statements would end up with no precision which is
     //      invalid ESSL.
     // After this empty declarations are not allowed in the AST.
+    passManager.beginPass("PruneNoOps");
     PruneNoOps(root, &symbolTable);
 
     // In case the last case inside a switch statement is a certain type of no-op, GLSL
@@ -427,12 +442,15 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // end of switch statements. This is also required because PruneNoOps may have left switch
     // statements that only contained an empty declaration inside the final case in an invalid
     // state. Relies on that PruneNoOps has already been run.
+    passManager.beginPass("RemoveNoOpCasesFromEndOfSwitchStatements");
     RemoveNoOpCasesFromEndOfSwitchStatements(root, &symbolTable);
 
     // Remove empty switch statements - this makes output simpler.
+    passManager.beginPass("RemoveEmptySwitchStatements");
     RemoveEmptySwitchStatements(root);
 
     // Create the function DAG and check there is no recursion
+    passManager.beginPass("CallDAG");
     if (!initCallDag(root))
     {
         return false;
@@ -453,17 +471,24 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (!(compileOptions & SH_DONT_PRUNE_UNUSED_FUNCTIONS))
     {
+        passManager.beginPass("PruneUnusedFunctions");
         pruneUnusedFunctions(root);
     }
 
-    if (shaderVersion >= 310 && !ValidateVaryingLocations(root, &mDiagnostics, shaderType))
+    // The validation passes only collect information during traversal, so they share a walk.
+    if (shaderVersion >= 310)
     {
-        return false;
+        passManager.addFusedPass("ValidateVaryingLocations",
+                                 CreateValidateVaryingLocationsPass(&mDiagnostics, shaderType));
     }
-
-    if (shaderVersion >= 300 && shaderType == GL_FRAGMENT_SHADER &&
-        !ValidateOutputs(root, getExtensionBehavior(), compileResources.MaxDrawBuffers,
-                         &mDiagnostics))
+    if (shaderVersion >= 300 && shaderType == GL_FRAGMENT_SHADER)
+    {
+        passManager.addFusedPass("ValidateOutputs",
+                                 CreateValidateOutputsPass(getExtensionBehavior(),
+                                                           compileResources.MaxDrawBuffers,
+                                                           &mDiagnostics));
+    }
+    if (!passManager.runFusedPasses())
     {
         return false;
     }
@@ -479,6 +504,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Clamping uniform array bounds needs to happen after validateLimitations pass.
     if (compileOptions & SH_CLAMP_INDIRECT_ARRAY_BOUNDS)
     {
+        passManager.beginPass("ArrayBoundsClamper");
         arrayBoundsClamper.MarkIndirectArrayBoundsForClamping(root);
     }
 
@@ -486,29 +512,39 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         parseContext.isExtensionEnabled(TExtension::OVR_multiview) &&
         getShaderType() != GL_COMPUTE_SHADER)
     {
+        passManager.beginPass("DeclareAndInitBuiltinsForInstancedMultiview");
         DeclareAndInitBuiltinsForInstancedMultiview(root, mNumViews, shaderType, compileOptions,
                                                     outputType, &symbolTable);
     }
 
     // This pass might emit short circuits so keep it before the short circuit unfolding
     if (compileOptions & SH_REWRITE_DO_WHILE_LOOPS)
+    {
+        passManager.beginPass("RewriteDoWhile");
         RewriteDoWhile(root, &symbolTable);
+    }
 
     if (compileOptions & SH_ADD_AND_TRUE_TO_LOOP_CONDITION)
+    {
+        passManager.beginPass("AddAndTrueToLoopCondition");
         AddAndTrueToLoopCondition(root);
+    }
 
     if (compileOptions & SH_UNFOLD_SHORT_CIRCUIT)
     {
+        passManager.beginPass("UnfoldShortCircuitAST");
         UnfoldShortCircuitAST(root);
     }
 
     if (compileOptions & SH_REMOVE_POW_WITH_CONSTANT_EXPONENT)
     {
+        passManager.beginPass("RemovePow");
         RemovePow(root);
     }
 
     if (compileOptions & SH_REGENERATE_STRUCT_NAMES)
     {
+        passManager.beginPass("RegenerateStructNames");
         RegenerateStructNames gen(&symbolTable);
         root->traverse(&gen);
     }
@@ -517,6 +553,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         compileResources.EXT_draw_buffers && compileResources.MaxDrawBuffers > 1 &&
         IsExtensionEnabled(extensionBehavior, TExtension::EXT_draw_buffers))
     {
+        passManager.beginPass("EmulateGLFragColorBroadcast");
         EmulateGLFragColorBroadcast(root, compileResources.MaxDrawBuffers, &outputVariables,
                                     &symbolTable, shaderVersion);
     }
@@ -528,6 +565,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Split multi declarations and remove calls to array length().
     // Note that SimplifyLoopConditions needs to be run before any other AST transformations
     // that may need to generate new statements from loop conditions or loop expressions.
+    passManager.beginPass("SimplifyLoopConditions");
     SimplifyLoopConditions(root,
                            IntermNodePatternMatcher::kMultiDeclaration |
                                IntermNodePatternMatcher::kArrayLengthMethod | simplifyScalarized,
@@ -535,43 +573,69 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
+    passManager.beginPass("SeparateDeclarations");
     SeparateDeclarations(root);
 
+    passManager.beginPass("SplitSequenceOperator");
     SplitSequenceOperator(root, IntermNodePatternMatcher::kArrayLengthMethod | simplifyScalarized,
                           &getSymbolTable());
 
+    passManager.beginPass("RemoveArrayLengthMethod");
     RemoveArrayLengthMethod(root);
 
+    passManager.beginPass("RemoveUnreferencedVariables");
     RemoveUnreferencedVariables(root, &symbolTable);
 
     // Built-in function emulation needs to happen after validateLimitations pass.
     // TODO(jmadill): Remove global pool allocator.
+    passManager.beginPass("InitBuiltInFunctionEmulator");
     GetGlobalPoolAllocator()->lock();
     initBuiltInFunctionEmulator(&builtInFunctionEmulator, compileOptions);
     GetGlobalPoolAllocator()->unlock();
-    builtInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
+
+    // Marking the emulated functions and collecting the variables don't change the structure of
+    // the tree, so they share a walk unless constructor arguments are scalarized in between.
+    TFusablePass *markBuiltInFunctions = builtInFunctionEmulator.createMarkBuiltInFunctionsPass();
+    if (markBuiltInFunctions)
+    {
+        passManager.addFusedPass("MarkBuiltInFunctionsForEmulation", markBuiltInFunctions);
+    }
 
     if (compileOptions & SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS)
     {
+        passManager.runFusedPasses();
+        passManager.beginPass("ScalarizeVecAndMatConstructorArgs");
         ScalarizeVecAndMatConstructorArgs(root, shaderType, fragmentPrecisionHigh, &symbolTable);
     }
 
-    if (shouldCollectVariables(compileOptions))
+    bool collectVariables = shouldCollectVariables(compileOptions);
+    if (collectVariables)
     {
         ASSERT(!variablesCollected);
-        CollectVariables(root, &attributes, &outputVariables, &uniforms, &inputVaryings,
-                         &outputVaryings, &uniformBlocks, &shaderStorageBlocks, &inBlocks,
-                         hashFunction, &symbolTable, shaderVersion, shaderType, extensionBehavior);
+        passManager.addFusedPass(
+            "CollectVariables",
+            CreateCollectVariablesPass(&attributes, &outputVariables, &uniforms, &inputVaryings,
+                                       &outputVaryings, &uniformBlocks, &shaderStorageBlocks,
+                                       &inBlocks, hashFunction, &symbolTable, shaderVersion,
+                                       shaderType, extensionBehavior));
+    }
+    passManager.runFusedPasses();
+
+    if (collectVariables)
+    {
+        passManager.beginPass("CollectInterfaceBlocks");
         collectInterfaceBlocks();
         variablesCollected = true;
         if (compileOptions & SH_USE_UNUSED_STANDARD_SHARED_BLOCKS)
         {
+            passManager.beginPass("UseAllMembersInUnusedStandardAndSharedBlocks");
             useAllMembersInUnusedStandardAndSharedBlocks(root);
         }
         if (compileOptions & SH_ENFORCE_PACKING_RESTRICTIONS)
         {
             // Returns true if, after applying the packing rules in the GLSL ES 1.00.17 spec
             // Appendix A, section 7, the shader does not use too many uniforms.
+            passManager.beginPass("CheckVariablesInPackingLimits");
             if (!CheckVariablesInPackingLimits(maxUniformVectors, uniforms))
             {
                 mDiagnostics.globalError("too many uniforms");
@@ -580,6 +644,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         }
         if (compileOptions & SH_INIT_OUTPUT_VARIABLES)
         {
+            passManager.beginPass("InitializeOutputVariables");
             initializeOutputVariables(root);
         }
     }
@@ -588,6 +653,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Otherwise, built-in invariant declarations don't apply.
     if (RemoveInvariant(shaderType, shaderVersion, outputType, compileOptions))
     {
+        passManager.beginPass("RemoveInvariantDeclaration");
         RemoveInvariantDeclaration(root);
     }
 
@@ -597,6 +663,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     if (shaderType == GL_VERTEX_SHADER && !mGLPositionInitialized &&
         ((compileOptions & SH_INIT_GL_POSITION) || (outputType == SH_GLSL_COMPATIBILITY_OUTPUT)))
     {
+        passManager.beginPass("InitializeGLPosition");
         initializeGLPosition(root);
         mGLPositionInitialized = true;
     }
@@ -610,6 +677,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     bool canUseLoopsToInitialize = !(compileOptions & SH_DONT_USE_LOOPS_TO_INITIALIZE_VARIABLES);
     bool highPrecisionSupported =
         shaderType != GL_FRAGMENT_SHADER || compileResources.FragmentPrecisionHigh;
+    passManager.beginPass("DeferGlobalInitializers");
     DeferGlobalInitializers(root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
                             highPrecisionSupported, &symbolTable);
 
@@ -625,28 +693,33 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
         if (!shouldRunLoopAndIndexingValidation(compileOptions))
         {
+            passManager.beginPass("SimplifyLoopConditions");
             SimplifyLoopConditions(root,
                                    IntermNodePatternMatcher::kArrayDeclaration |
                                        IntermNodePatternMatcher::kNamelessStructDeclaration,
                                    &getSymbolTable());
         }
 
+        passManager.beginPass("InitializeUninitializedLocals");
         InitializeUninitializedLocals(root, getShaderVersion(), canUseLoopsToInitialize,
                                       highPrecisionSupported, &getSymbolTable());
     }
 
     if (getShaderType() == GL_VERTEX_SHADER && (compileOptions & SH_CLAMP_POINT_SIZE))
     {
+        passManager.beginPass("ClampPointSize");
         ClampPointSize(root, compileResources.MaxPointSize, &getSymbolTable());
     }
 
     if (getShaderType() == GL_FRAGMENT_SHADER && (compileOptions & SH_CLAMP_FRAG_DEPTH))
     {
+        passManager.beginPass("ClampFragDepth");
         ClampFragDepth(root, &getSymbolTable());
     }
 
     if (compileOptions & SH_REWRITE_VECTOR_SCALAR_ARITHMETIC)
     {
+        passManager.beginPass("VectorizeVectorScalarArithmetic");
         VectorizeVectorScalarArithmetic(root, &getSymbolTable());
     }
 
@@ -673,6 +746,22 @@ bool TCompiler::compile(const char *const shaderStrings[],
         compileOptions |= SH_FLATTEN_PRAGMA_STDGL_INVARIANT_ALL;
     }
 
+    TranslationCache *translationCache = GetTranslationCache();
+    bool useTranslationCache =
+        translationCache->isEnabled() && shouldUseTranslationCache(compileOptions);
+    TranslationHash translationHash;
+    if (useTranslationCache)
+    {
+        computeTranslationHash(shaderStrings, numStrings, compileOptions, &translationHash);
+
+        TranslationResults cachedResults;
+        if (translationCache->get(translationHash, &cachedResults))
+        {
+            restoreTranslationResults(cachedResults);
+            return true;
+        }
+    }
+
     TScopedPoolAllocator scopedAlloc(&allocator);
     TIntermBlock *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
 
@@ -687,6 +776,16 @@ bool TCompiler::compile(const char *const shaderStrings[],
             translate(root, compileOptions, &perfDiagnostics);
         }
 
+        // Only successful compilations are cached, so that failing shaders keep reporting all of
+        // their errors.
+        if (useTranslationCache)
+        {
+            TranslationResults results;
+            saveTranslationResults(&results);
+            // Hashed names depend on a function pointer that is only valid in this process.
+            translationCache->put(translationHash, results, hashFunction == nullptr);
+        }
+
         // The IntermNode tree doesn't need to be deleted here, since the
         // memory will be freed in a big chunk by the PoolAllocator.
         return true;
@@ -694,6 +793,89 @@ bool TCompiler::compile(const char *const shaderStrings[],
     return false;
 }
 
+void TCompiler::computeTranslationHash(const char *const shaderStrings[],
+                                       size_t numStrings,
+                                       ShCompileOptions compileOptions,
+                                       TranslationHash *hashOut) const
+{
+    // Strings are prefixed with their length so that different splits of the source can't hash
+    // the same.
+    std::ostringstream keyStream;
+    keyStream << ANGLE_SH_VERSION << ":" << shaderType << ":" << shaderSpec << ":" << outputType
+              << ":" << compileOptions << ":" << reinterpret_cast<uintptr_t>(hashFunction) << ":"
+              << builtInResourcesString.size() << ":" << builtInResourcesString;
+    for (size_t stringIndex = 0; stringIndex < numStrings; ++stringIndex)
+    {
+        size_t length = strlen(shaderStrings[stringIndex]);
+        keyStream << ":" << length << ":";
+        keyStream.write(shaderStrings[stringIndex], length);
+    }
+
+    const std::string key = keyStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(key.data()), key.size(),
+                               hashOut->data());
+}
+
+void TCompiler::saveTranslationResults(TranslationResults *resultsOut) const
+{
+    resultsOut->infoLog       = infoSink.info.str();
+    resultsOut->objectCode    = infoSink.obj.str();
+    resultsOut->shaderVersion = shaderVersion;
+
+    resultsOut->variablesCollected  = variablesCollected;
+    resultsOut->attributes          = attributes;
+    resultsOut->outputVariables     = outputVariables;
+    resultsOut->uniforms            = uniforms;
+    resultsOut->inputVaryings       = inputVaryings;
+    resultsOut->outputVaryings      = outputVaryings;
+    resultsOut->uniformBlocks       = uniformBlocks;
+    resultsOut->shaderStorageBlocks = shaderStorageBlocks;
+    resultsOut->inBlocks            = inBlocks;
+    resultsOut->nameMap             = nameMap;
+
+    resultsOut->computeShaderLocalSizeDeclared = mComputeShaderLocalSizeDeclared;
+    resultsOut->computeShaderLocalSize         = mComputeShaderLocalSize;
+    resultsOut->numViews                       = mNumViews;
+
+    resultsOut->geometryShaderMaxVertices         = mGeometryShaderMaxVertices;
+    resultsOut->geometryShaderInvocations         = mGeometryShaderInvocations;
+    resultsOut->geometryShaderInputPrimitiveType  = mGeometryShaderInputPrimitiveType;
+    resultsOut->geometryShaderOutputPrimitiveType = mGeometryShaderOutputPrimitiveType;
+}
+
+void TCompiler::restoreTranslationResults(const TranslationResults &results)
+{
+    clearResults();
+
+    infoSink.info << results.infoLog;
+    infoSink.obj << results.objectCode;
+    shaderVersion = results.shaderVersion;
+
+    variablesCollected  = results.variablesCollected;
+    attributes          = results.attributes;
+    outputVariables     = results.outputVariables;
+    uniforms            = results.uniforms;
+    inputVaryings       = results.inputVaryings;
+    outputVaryings      = results.outputVaryings;
+    uniformBlocks       = results.uniformBlocks;
+    shaderStorageBlocks = results.shaderStorageBlocks;
+    inBlocks            = results.inBlocks;
+    nameMap             = results.nameMap;
+    if (variablesCollected)
+    {
+        collectInterfaceBlocks();
+    }
+
+    mComputeShaderLocalSizeDeclared = results.computeShaderLocalSizeDeclared;
+    mComputeShaderLocalSize         = results.computeShaderLocalSize;
+    mNumViews                       = results.numViews;
+
+    mGeometryShaderMaxVertices         = results.geometryShaderMaxVertices;
+    mGeometryShaderInvocations         = results.geometryShaderInvocations;
+    mGeometryShaderInputPrimitiveType  = results.geometryShaderInputPrimitiveType;
+    mGeometryShaderOutputPrimitiveType = results.geometryShaderOutputPrimitiveType;
+}
+
 bool TCompiler::InitBuiltInSymbolTable(const ShBuiltInResources &resources)
 {
     if (resources.MaxDrawBuffers < 1)
@@ -790,7 +972,12 @@ void TCompiler::setResourceString()
         << ":MaxGeometryAtomicCounters:" << compileResources.MaxGeometryAtomicCounters
         << ":MaxGeometryShaderStorageBlocks:" << compileResources.MaxGeometryShaderStorageBlocks
         << ":MaxGeometryShaderInvocations:" << compileResources.MaxGeometryShaderInvocations
-        << ":MaxGeometryImageUniforms:" << compileResources.MaxGeometryImageUniforms;
+        << ":MaxGeometryImageUniforms:" << compileResources.MaxGeometryImageUniforms
+        << ":ArrayIndexClampingStrategy:" << compileResources.ArrayIndexClampingStrategy
+        << ":MaxUniformLocations:" << compileResources.MaxUniformLocations
+        << ":MaxUniformBufferBindings:" << compileResources.MaxUniformBufferBindings
+        << ":MaxShaderStorageBufferBindings:" << compileResources.MaxShaderStorageBufferBindings
+        << ":MaxPointSize:" << compileResources.MaxPointSize;
     // clang-format on
 
     builtInResourcesString = strstream.str();
@@ -1028,6 +1215,12 @@ bool TCompiler::shouldCollectVariables(ShCompileOptions compileOptions)
     return (compileOptions & SH_VARIABLES) != 0;
 }
 
+bool TCompiler::shouldUseTranslationCache(ShCompileOptions compileOptions)
+{
+    // The timings would describe the compilation that filled the cache.
+    return (compileOptions & SH_TIME_AST_PASSES) == 0;
+}
+
 bool TCompiler::wereVariablesCollected() const
 {
     return variablesCollected;
@@ -24,6 +24,7 @@
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/Pragma.h"
 #include "compiler/translator/SymbolTable.h"
+#include "compiler/translator/TranslationCache.h"
 #include "third_party/compiler/ArrayBoundsClamper.h"
 
 namespace sh
@@ -189,6 +190,8 @@ class TCompiler : public TShHandleBase
 
     virtual bool shouldFlattenPragmaStdglInvariantAll() = 0;
     virtual bool shouldCollectVariables(ShCompileOptions compileOptions);
+    // Translators that expose results the translation cache doesn't hold must not use the cache.
+    virtual bool shouldUseTranslationCache(ShCompileOptions compileOptions);
 
     bool wereVariablesCollected() const;
     std::vector<sh::Attribute> attributes;
@@ -212,6 +215,14 @@ class TCompiler : public TShHandleBase
 
     void collectInterfaceBlocks();
 
+    // Hashes everything the results of compiling the shader strings depend on.
+    void computeTranslationHash(const char *const shaderStrings[],
+                                size_t numStrings,
+                                ShCompileOptions compileOptions,
+                                TranslationHash *hashOut) const;
+    void saveTranslationResults(TranslationResults *resultsOut) const;
+    void restoreTranslationResults(const TranslationResults &results);
+
     bool variablesCollected;
 
     bool mGLPositionInitialized;
@@ -0,0 +1,337 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser.cpp: Runs several AST traversers in a single walk over the tree.
+//
+// The traverse functions mirror the ones in TIntermTraverser. Instead of a single visit flag they
+// keep a mask of the fused traversers that are still visiting the node, and they update the
+// traversal context of each of those traversers as the walk enters and leaves nodes.
+//
+
+#include "compiler/translator/FusedTraverser.h"
+
+namespace sh
+{
+
+// Adds the node to the traversal path of the traversers that are active when the node is
+// entered, and restores their path and the active mask when the node is left.
+class TFusedTraverser::ScopedNodeInFusedPath : angle::NonCopyable
+{
+  public:
+    ScopedNodeInFusedPath(TFusedTraverser *fusedTraverser, TIntermNode *node)
+        : mFusedTraverser(fusedTraverser), mEnteredMask(fusedTraverser->mActiveMask)
+    {
+        for (size_t index : mEnteredMask)
+        {
+            mFusedTraverser->mTraversers[index]->incrementDepth(node);
+        }
+    }
+
+    ~ScopedNodeInFusedPath()
+    {
+        for (size_t index : mEnteredMask)
+        {
+            mFusedTraverser->mTraversers[index]->decrementDepth();
+        }
+        mFusedTraverser->mActiveMask = mEnteredMask;
+    }
+
+    TraverserMask getEnteredMask() const { return mEnteredMask; }
+
+  private:
+    TFusedTraverser *mFusedTraverser;
+    TraverserMask mEnteredMask;
+};
+
+TFusedTraverser::TFusedTraverser() : TIntermTraverser(true, true, true)
+{
+}
+
+void TFusedTraverser::addTraverser(TIntermTraverser *traverser)
+{
+    ASSERT(traverser != nullptr);
+    ASSERT(mTraversers.size() < kMaxFusedTraversers);
+
+    size_t index = mTraversers.size();
+    mTraversers.push_back(traverser);
+    mPreVisitMask.set(index, traverser->preVisit);
+    mInVisitMask.set(index, traverser->inVisit);
+    mPostVisitMask.set(index, traverser->postVisit);
+    mActiveMask.set(index);
+}
+
+template <typename NodeT>
+TFusedTraverser::TraverserMask TFusedTraverser::visitAll(Visit visit,
+                                                         TraverserMask mask,
+                                                         NodeT *node,
+                                                         VisitFunction<NodeT> visitFunction)
+{
+    TraverserMask visitMask;
+    switch (visit)
+    {
+        case PreVisit:
+            visitMask = mask & mPreVisitMask;
+            break;
+        case InVisit:
+            visitMask = mask & mInVisitMask;
+            break;
+        case PostVisit:
+            visitMask = mask & mPostVisitMask;
+            break;
+    }
+
+    for (size_t index : visitMask)
+    {
+        if (!(mTraversers[index]->*visitFunction)(visit, node))
+        {
+            mask.reset(index);
+        }
+    }
+    return mask;
+}
+
+void TFusedTraverser::traverseChild(TIntermNode *child, TraverserMask mask)
+{
+    if (child != nullptr && mask.any())
+    {
+        mActiveMask = mask;
+        child->traverse(this);
+    }
+}
+
+void TFusedTraverser::setInGlobalScope(TraverserMask mask, bool inGlobalScope)
+{
+    for (size_t index : mask)
+    {
+        mTraversers[index]->mInGlobalScope = inGlobalScope;
+    }
+}
+
+void TFusedTraverser::traverseSymbol(TIntermSymbol *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+    for (size_t index : mActiveMask)
+    {
+        mTraversers[index]->visitSymbol(node);
+    }
+}
+
+void TFusedTraverser::traverseRaw(TIntermRaw *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+    for (size_t index : mActiveMask)
+    {
+        mTraversers[index]->visitRaw(node);
+    }
+}
+
+void TFusedTraverser::traverseConstantUnion(TIntermConstantUnion *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+    for (size_t index : mActiveMask)
+    {
+        mTraversers[index]->visitConstantUnion(node);
+    }
+}
+
+void TFusedTraverser::traverseSwizzle(TIntermSwizzle *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+
+    TraverserMask visit = visitAll(PreVisit, mActiveMask, node, &TIntermTraverser::visitSwizzle);
+    traverseChild(node->getOperand(), visit);
+    visitAll(PostVisit, visit, node, &TIntermTraverser::visitSwizzle);
+}
+
+void TFusedTraverser::traverseBinary(TIntermBinary *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+
+    TraverserMask visit = visitAll(PreVisit, mActiveMask, node, &TIntermTraverser::visitBinary);
+    traverseChild(node->getLeft(), visit);
+    visit = visitAll(InVisit, visit, node, &TIntermTraverser::visitBinary);
+    traverseChild(node->getRight(), visit);
+    visitAll(PostVisit, visit, node, &TIntermTraverser::visitBinary);
+}
+
+void TFusedTraverser::traverseUnary(TIntermUnary *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+
+    TraverserMask visit = visitAll(PreVisit, mActiveMask, node, &TIntermTraverser::visitUnary);
+    traverseChild(node->getOperand(), visit);
+    visitAll(PostVisit, visit, node, &TIntermTraverser::visitUnary);
+}
+
+void TFusedTraverser::traverseTernary(TIntermTernary *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+
+    TraverserMask visit = visitAll(PreVisit, mActiveMask, node, &TIntermTraverser::visitTernary);
+    traverseChild(node->getCondition(), visit);
+    traverseChild(node->getTrueExpression(), visit);
+    traverseChild(node->getFalseExpression(), visit);
+    visitAll(PostVisit, visit, node, &TIntermTraverser::visitTernary);
+}
+
+void TFusedTraverser::traverseIfElse(TIntermIfElse *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+
+    TraverserMask visit = visitAll(PreVisit, mActiveMask, node, &TIntermTraverser::visitIfElse);
+    traverseChild(node->getCondition(), visit);
+    traverseChild(node->getTrueBlock(), visit);
+    traverseChild(node->getFalseBlock(), visit);
+    visitAll(PostVisit, visit, node, &TIntermTraverser::visitIfElse);
+}
+
+void TFusedTraverser::traverseSwitch(TIntermSwitch *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+
+    TraverserMask visit = visitAll(PreVisit, mActiveMask, node, &TIntermTraverser::visitSwitch);
+    traverseChild(node->getInit(), visit);
+    visit = visitAll(InVisit, visit, node, &TIntermTraverser::visitSwitch);
+    traverseChild(node->getStatementList(), visit);
+    visitAll(PostVisit, visit, node, &TIntermTraverser::visitSwitch);
+}
+
+void TFusedTraverser::traverseCase(TIntermCase *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+
+    TraverserMask visit = visitAll(PreVisit, mActiveMask, node, &TIntermTraverser::visitCase);
+    traverseChild(node->getCondition(), visit);
+    visitAll(PostVisit, visit, node, &TIntermTraverser::visitCase);
+}
+
+template <typename NodeT>
+void TFusedTraverser::traverseSequence(NodeT *node, VisitFunction<NodeT> visitFunction)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+
+    TraverserMask visit = visitAll(PreVisit, mActiveMask, node, visitFunction);
+
+    // Like in TIntermTraverser, returning false from an in-visit only skips the rest of the
+    // in-visits and the post-visit. The children are still traversed.
+    TraverserMask traversing  = visit;
+    TIntermSequence *sequence = node->getSequence();
+    if (traversing.any())
+    {
+        for (TIntermNode *child : *sequence)
+        {
+            traverseChild(child, traversing);
+            if (child != sequence->back())
+            {
+                visit = visitAll(InVisit, visit, node, visitFunction);
+            }
+        }
+    }
+
+    visitAll(PostVisit, visit, node, visitFunction);
+}
+
+void TFusedTraverser::traverseFunctionPrototype(TIntermFunctionPrototype *node)
+{
+    traverseSequence(node, &TIntermTraverser::visitFunctionPrototype);
+}
+
+void TFusedTraverser::traverseFunctionDefinition(TIntermFunctionDefinition *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+
+    TraverserMask visit =
+        visitAll(PreVisit, mActiveMask, node, &TIntermTraverser::visitFunctionDefinition);
+
+    // The body is traversed even if the in-visit returns false.
+    TraverserMask traversing = visit;
+    setInGlobalScope(traversing, false);
+    traverseChild(node->getFunctionPrototype(), traversing);
+    visit = visitAll(InVisit, visit, node, &TIntermTraverser::visitFunctionDefinition);
+    traverseChild(node->getBody(), traversing);
+    setInGlobalScope(traversing, true);
+
+    visitAll(PostVisit, visit, node, &TIntermTraverser::visitFunctionDefinition);
+}
+
+void TFusedTraverser::traverseAggregate(TIntermAggregate *node)
+{
+    traverseSequence(node, &TIntermTraverser::visitAggregate);
+}
+
+void TFusedTraverser::traverseBlock(TIntermBlock *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+    for (size_t index : addToPath.getEnteredMask())
+    {
+        mTraversers[index]->pushParentBlock(node);
+    }
+
+    TraverserMask visit = visitAll(PreVisit, mActiveMask, node, &TIntermTraverser::visitBlock);
+
+    TraverserMask traversing  = visit;
+    TIntermSequence *sequence = node->getSequence();
+    if (traversing.any())
+    {
+        for (TIntermNode *child : *sequence)
+        {
+            traverseChild(child, traversing);
+            if (child != sequence->back())
+            {
+                visit = visitAll(InVisit, visit, node, &TIntermTraverser::visitBlock);
+            }
+
+            for (size_t index : traversing)
+            {
+                mTraversers[index]->incrementParentBlockPos();
+            }
+        }
+    }
+
+    visitAll(PostVisit, visit, node, &TIntermTraverser::visitBlock);
+
+    for (size_t index : addToPath.getEnteredMask())
+    {
+        mTraversers[index]->popParentBlock();
+    }
+}
+
+void TFusedTraverser::traverseInvariantDeclaration(TIntermInvariantDeclaration *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+
+    TraverserMask visit =
+        visitAll(PreVisit, mActiveMask, node, &TIntermTraverser::visitInvariantDeclaration);
+    traverseChild(node->getSymbol(), visit);
+    visitAll(PostVisit, visit, node, &TIntermTraverser::visitInvariantDeclaration);
+}
+
+void TFusedTraverser::traverseDeclaration(TIntermDeclaration *node)
+{
+    traverseSequence(node, &TIntermTraverser::visitDeclaration);
+}
+
+void TFusedTraverser::traverseLoop(TIntermLoop *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+
+    TraverserMask visit = visitAll(PreVisit, mActiveMask, node, &TIntermTraverser::visitLoop);
+    traverseChild(node->getInit(), visit);
+    traverseChild(node->getCondition(), visit);
+    traverseChild(node->getBody(), visit);
+    traverseChild(node->getExpression(), visit);
+    visitAll(PostVisit, visit, node, &TIntermTraverser::visitLoop);
+}
+
+void TFusedTraverser::traverseBranch(TIntermBranch *node)
+{
+    ScopedNodeInFusedPath addToPath(this, node);
+
+    TraverserMask visit = visitAll(PreVisit, mActiveMask, node, &TIntermTraverser::visitBranch);
+    traverseChild(node->getExpression(), visit);
+    visitAll(PostVisit, visit, node, &TIntermTraverser::visitBranch);
+}
+
+}  // namespace sh
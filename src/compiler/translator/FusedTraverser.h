@@ -0,0 +1,89 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser.h: Runs several AST traversers in a single walk over the tree. Each traverser
+// sees the same visit calls and the same traversal context (parent nodes, parent blocks, global
+// scope) that it would see when traversing the tree on its own.
+//
+
+#ifndef COMPILER_TRANSLATOR_FUSEDTRAVERSER_H_
+#define COMPILER_TRANSLATOR_FUSEDTRAVERSER_H_
+
+#include "common/bitset_utils.h"
+#include "compiler/translator/IntermTraverse.h"
+
+namespace sh
+{
+
+class TFusedTraverser : public TIntermTraverser
+{
+  public:
+    static constexpr size_t kMaxFusedTraversers = 32;
+
+    TFusedTraverser();
+
+    // Traversers can only be fused if they don't override the traverse*() functions, and if they
+    // don't depend on the changes that the other fused traversers make to the tree. Only the
+    // visit*() functions of the traversers are called. Traversers may still traverse subtrees on
+    // their own from inside the visit functions.
+    void addTraverser(TIntermTraverser *traverser);
+
+    size_t getTraverserCount() const { return mTraversers.size(); }
+
+    void traverseSymbol(TIntermSymbol *node) override;
+    void traverseRaw(TIntermRaw *node) override;
+    void traverseConstantUnion(TIntermConstantUnion *node) override;
+    void traverseSwizzle(TIntermSwizzle *node) override;
+    void traverseBinary(TIntermBinary *node) override;
+    void traverseUnary(TIntermUnary *node) override;
+    void traverseTernary(TIntermTernary *node) override;
+    void traverseIfElse(TIntermIfElse *node) override;
+    void traverseSwitch(TIntermSwitch *node) override;
+    void traverseCase(TIntermCase *node) override;
+    void traverseFunctionPrototype(TIntermFunctionPrototype *node) override;
+    void traverseFunctionDefinition(TIntermFunctionDefinition *node) override;
+    void traverseAggregate(TIntermAggregate *node) override;
+    void traverseBlock(TIntermBlock *node) override;
+    void traverseInvariantDeclaration(TIntermInvariantDeclaration *node) override;
+    void traverseDeclaration(TIntermDeclaration *node) override;
+    void traverseLoop(TIntermLoop *node) override;
+    void traverseBranch(TIntermBranch *node) override;
+
+  private:
+    using TraverserMask = angle::BitSet32<kMaxFusedTraversers>;
+
+    template <typename NodeT>
+    using VisitFunction = bool (TIntermTraverser::*)(Visit, NodeT *);
+
+    class ScopedNodeInFusedPath;
+
+    // Calls the visit function of the traversers in the mask that want this kind of visit. Returns
+    // the mask without the traversers that returned false.
+    template <typename NodeT>
+    TraverserMask visitAll(Visit visit,
+                           TraverserMask mask,
+                           NodeT *node,
+                           VisitFunction<NodeT> visitFunction);
+
+    // Traverses aggregates, declarations and function prototypes.
+    template <typename NodeT>
+    void traverseSequence(NodeT *node, VisitFunction<NodeT> visitFunction);
+
+    void traverseChild(TIntermNode *child, TraverserMask mask);
+
+    void setInGlobalScope(TraverserMask mask, bool inGlobalScope);
+
+    std::vector<TIntermTraverser *> mTraversers;
+    TraverserMask mPreVisitMask;
+    TraverserMask mInVisitMask;
+    TraverserMask mPostVisitMask;
+
+    // The traversers that traverse the node that is currently being visited.
+    TraverserMask mActiveMask;
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_FUSEDTRAVERSER_H_
@@ -101,6 +101,9 @@ class TIntermTraverser : angle::NonCopyable
     void updateTree();
 
   protected:
+    // TFusedTraverser keeps the traversal context of the traversers that it fuses up to date.
+    friend class TFusedTraverser;
+
     // Should only be called from traverse*() functions
     void incrementDepth(TIntermNode *current)
     {
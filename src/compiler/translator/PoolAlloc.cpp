@@ -10,40 +10,304 @@
 #include <stdio.h>
 #include <assert.h>
 
+#include <algorithm>
+
+#include "GLSLANG/ShaderLang.h"
 #include "common/angleutils.h"
 #include "common/debug.h"
 #include "common/platform.h"
-#include "common/tls.h"
 #include "compiler/translator/InitializeGlobals.h"
 
-TLSIndex PoolIndex = TLS_INVALID_INDEX;
+#if defined(ANGLE_PLATFORM_LINUX)
+#include <sys/mman.h>
+#endif
 
-bool InitializePoolIndex()
+namespace
 {
-    assert(PoolIndex == TLS_INVALID_INDEX);
 
-    PoolIndex = CreateTLSIndex();
-    return PoolIndex != TLS_INVALID_INDEX;
+// Each thread translates with its own pool, so that shaders can be compiled on several threads at
+// once. A native thread local is much cheaper than a TLS index lookup on every pool allocation.
+thread_local TPoolAllocator *gPoolAllocator = nullptr;
+
+}  // anonymous namespace
+
+// The pool is a native thread local that needs no setup. These are kept for the callers that
+// manage the lifetime of the process state explicitly.
+bool InitializePoolIndex()
+{
+    return true;
 }
 
 void FreePoolIndex()
 {
-    assert(PoolIndex != TLS_INVALID_INDEX);
-
-    DestroyTLSIndex(PoolIndex);
-    PoolIndex = TLS_INVALID_INDEX;
 }
 
 TPoolAllocator *GetGlobalPoolAllocator()
 {
-    assert(PoolIndex != TLS_INVALID_INDEX);
-    return static_cast<TPoolAllocator *>(GetTLSValue(PoolIndex));
+    return gPoolAllocator;
 }
 
 void SetGlobalPoolAllocator(TPoolAllocator *poolAllocator)
 {
-    assert(PoolIndex != TLS_INVALID_INDEX);
-    SetTLSValue(PoolIndex, poolAllocator);
+    gPoolAllocator = poolAllocator;
+}
+
+TPoolPageArena::TPoolPageArena()
+    : mMaxCachedSize(kDefaultPoolPageArenaMaxCachedSize),
+      mCachedSize(0),
+      mUseLargePages(false),
+      mLargePageCursor(0),
+      mLargePageRemaining(0),
+      mSystemAllocationCount(0),
+      mBlocksInUse(0),
+      mBytesInUse(0),
+      mPeakBytesInUse(0)
+{
+    for (tFreeBlock *&freeList : mFreeLists)
+    {
+        freeList = 0;
+    }
+}
+
+TPoolPageArena::~TPoolPageArena()
+{
+    trimToSize(0);
+
+#if defined(ANGLE_PLATFORM_LINUX)
+    for (unsigned char *chunk : mLargePageChunks)
+    {
+        munmap(chunk, kLargePageChunkSize);
+    }
+#endif
+}
+
+void *TPoolPageArena::allocate(size_t numBytes, size_t *blockSizeOut)
+{
+    // Round up to the smallest size class that fits.
+    size_t sizeClass = 0;
+    size_t blockSize = static_cast<size_t>(1) << kMinBlockSizeLog2;
+    while (blockSize < numBytes && sizeClass + 1 < kSizeClassCount)
+    {
+        blockSize <<= 1;
+        ++sizeClass;
+    }
+    bool cacheable = blockSize >= numBytes;
+    if (!cacheable)
+    {
+        blockSize = numBytes;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    void *block = 0;
+    if (cacheable && mFreeLists[sizeClass])
+    {
+        tFreeBlock *freeBlock = mFreeLists[sizeClass];
+        mFreeLists[sizeClass] = freeBlock->next;
+        mCachedSize -= blockSize;
+        block = freeBlock;
+    }
+    else
+    {
+        if (cacheable && mUseLargePages)
+        {
+            block = allocateFromLargePages(blockSize);
+        }
+        if (block == 0)
+        {
+            block = allocateFromSystem(blockSize);
+        }
+        if (block == 0)
+        {
+            return 0;
+        }
+    }
+
+    ++mBlocksInUse;
+    mBytesInUse += blockSize;
+    mPeakBytesInUse = std::max(mPeakBytesInUse, mBytesInUse);
+
+    *blockSizeOut = blockSize;
+    return block;
+}
+
+void TPoolPageArena::release(void *block, size_t blockSize)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    ASSERT(mBlocksInUse > 0 && mBytesInUse >= blockSize);
+    --mBlocksInUse;
+    mBytesInUse -= blockSize;
+
+    // Only the blocks of a size class are powers of two within the range of the classes.
+    size_t sizeClass = 0;
+    while (sizeClass < kSizeClassCount &&
+           (static_cast<size_t>(1) << (sizeClass + kMinBlockSizeLog2)) != blockSize)
+    {
+        ++sizeClass;
+    }
+
+    // Blocks in large pages can't be freed, so they are always kept.
+    if (sizeClass == kSizeClassCount ||
+        (mCachedSize + blockSize > mMaxCachedSize && !isInLargePages(block)))
+    {
+        freeToSystem(block, blockSize);
+        return;
+    }
+
+    tFreeBlock *freeBlock = reinterpret_cast<tFreeBlock *>(block);
+    freeBlock->next       = mFreeLists[sizeClass];
+    mFreeLists[sizeClass] = freeBlock;
+    mCachedSize += blockSize;
+}
+
+void TPoolPageArena::setMaxCachedSize(size_t maxCachedSizeBytes)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mMaxCachedSize = maxCachedSizeBytes;
+    trimToSize(mMaxCachedSize);
+}
+
+void TPoolPageArena::setUseLargePages(bool useLargePages)
+{
+#if defined(ANGLE_PLATFORM_LINUX)
+    std::lock_guard<std::mutex> lock(mMutex);
+    mUseLargePages = useLargePages;
+#endif
+}
+
+void TPoolPageArena::getStatistics(ShPoolAllocatorStatistics *statisticsOut) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    statisticsOut->systemAllocationCount = mSystemAllocationCount;
+    statisticsOut->blocksInUse           = mBlocksInUse;
+    statisticsOut->bytesInUse            = mBytesInUse;
+    statisticsOut->peakBytesInUse        = mPeakBytesInUse;
+    statisticsOut->cachedBytes           = mCachedSize;
+    statisticsOut->largePageBytes        = mLargePageChunks.size() * kLargePageChunkSize;
+}
+
+void *TPoolPageArena::allocateFromSystem(size_t blockSize)
+{
+    ++mSystemAllocationCount;
+    return ::new char[blockSize];
+}
+
+void *TPoolPageArena::allocateFromLargePages(size_t blockSize)
+{
+#if defined(ANGLE_PLATFORM_LINUX)
+    if (blockSize > mLargePageRemaining)
+    {
+        // Keep the rest of the chunk in the largest blocks that fit.
+        while (mLargePageRemaining >= (static_cast<size_t>(1) << kMinBlockSizeLog2))
+        {
+            size_t sizeClass = kSizeClassCount - 1;
+            while ((static_cast<size_t>(1) << (sizeClass + kMinBlockSizeLog2)) >
+                   mLargePageRemaining)
+            {
+                --sizeClass;
+            }
+            size_t restSize = static_cast<size_t>(1) << (sizeClass + kMinBlockSizeLog2);
+
+            tFreeBlock *freeBlock = reinterpret_cast<tFreeBlock *>(mLargePageCursor);
+            freeBlock->next       = mFreeLists[sizeClass];
+            mFreeLists[sizeClass] = freeBlock;
+            mCachedSize += restSize;
+
+            mLargePageCursor += restSize;
+            mLargePageRemaining -= restSize;
+        }
+
+        // Large pages must be aligned to their size, so map twice the size and unmap the
+        // unaligned ends.
+        size_t mappingSize = 2 * kLargePageChunkSize;
+        void *mapping =
+            mmap(0, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED)
+        {
+            return 0;
+        }
+        ++mSystemAllocationCount;
+
+        uintptr_t mappingStart = reinterpret_cast<uintptr_t>(mapping);
+        uintptr_t chunkStart =
+            (mappingStart + kLargePageChunkSize - 1) & ~(kLargePageChunkSize - 1);
+        uintptr_t chunkEnd   = chunkStart + kLargePageChunkSize;
+        uintptr_t mappingEnd = mappingStart + mappingSize;
+        if (chunkStart > mappingStart)
+        {
+            munmap(mapping, chunkStart - mappingStart);
+        }
+        if (mappingEnd > chunkEnd)
+        {
+            munmap(reinterpret_cast<void *>(chunkEnd), mappingEnd - chunkEnd);
+        }
+
+        unsigned char *chunk = reinterpret_cast<unsigned char *>(chunkStart);
+#if defined(MADV_HUGEPAGE)
+        madvise(chunk, kLargePageChunkSize, MADV_HUGEPAGE);
+#endif
+        mLargePageChunks.insert(
+            std::upper_bound(mLargePageChunks.begin(), mLargePageChunks.end(), chunk), chunk);
+
+        mLargePageCursor    = chunk;
+        mLargePageRemaining = kLargePageChunkSize;
+    }
+
+    void *block = mLargePageCursor;
+    mLargePageCursor += blockSize;
+    mLargePageRemaining -= blockSize;
+    return block;
+#else
+    return 0;
+#endif
+}
+
+void TPoolPageArena::freeToSystem(void *block, size_t blockSize)
+{
+    ASSERT(!isInLargePages(block));
+    delete[] reinterpret_cast<char *>(block);
+}
+
+bool TPoolPageArena::isInLargePages(const void *block) const
+{
+    const unsigned char *address = reinterpret_cast<const unsigned char *>(block);
+    auto chunkIter = std::upper_bound(mLargePageChunks.begin(), mLargePageChunks.end(), address);
+    if (chunkIter == mLargePageChunks.begin())
+    {
+        return false;
+    }
+    --chunkIter;
+    return address < *chunkIter + kLargePageChunkSize;
+}
+
+void TPoolPageArena::trimToSize(size_t limit)
+{
+    // Free the largest blocks first.
+    for (size_t sizeClass = kSizeClassCount; sizeClass-- > 0 && mCachedSize > limit;)
+    {
+        size_t blockSize  = static_cast<size_t>(1) << (sizeClass + kMinBlockSizeLog2);
+        tFreeBlock **link = &mFreeLists[sizeClass];
+        while (*link && mCachedSize > limit)
+        {
+            tFreeBlock *freeBlock = *link;
+            if (isInLargePages(freeBlock))
+            {
+                link = &freeBlock->next;
+                continue;
+            }
+            *link = freeBlock->next;
+            mCachedSize -= blockSize;
+            freeToSystem(freeBlock, blockSize);
+        }
+    }
+}
+
+TPoolPageArena *GetPoolPageArena()
+{
+    // Leaked, so that pools destroyed during process exit can still give their pages back.
+    static TPoolPageArena *arena = new TPoolPageArena();
+    return arena;
 }
 
 //
@@ -54,8 +318,8 @@ TPoolAllocator::TPoolAllocator(int growthIncrement, int allocationAlignment)
     : alignment(allocationAlignment),
 #if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
       pageSize(growthIncrement),
-      freeList(0),
       inUseList(0),
+      mArena(GetPoolPageArena()),
       numCalls(0),
       totalBytes(0),
 #endif
@@ -107,22 +371,12 @@ TPoolAllocator::~TPoolAllocator()
 #if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     while (inUseList)
     {
-        tHeader *next = inUseList->nextPage;
+        tHeader *next    = inUseList->nextPage;
+        size_t blockSize = inUseList->blockSize;
         inUseList->~tHeader();
-        delete[] reinterpret_cast<char *>(inUseList);
+        mArena->release(inUseList, blockSize);
         inUseList = next;
     }
-
-    // We should not check the guard blocks
-    // here, because we did it already when the block was
-    // placed into the free list.
-    //
-    while (freeList)
-    {
-        tHeader *next = freeList->nextPage;
-        delete[] reinterpret_cast<char *>(freeList);
-        freeList = next;
-    }
 #else  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     for (auto &allocs : mStack)
     {
@@ -195,7 +449,7 @@ void TPoolAllocator::push()
 // that have occurred since the last push(), or since the
 // last pop(), or since the object's creation.
 //
-// The deallocated pages are saved for future allocations.
+// The deallocated pages are given back to the arena for future allocations.
 //
 void TPoolAllocator::pop()
 {
@@ -208,17 +462,13 @@ void TPoolAllocator::pop()
 
     while (inUseList != page)
     {
+        tHeader *nextInUse = inUseList->nextPage;
+        size_t blockSize   = inUseList->blockSize;
+
         // invoke destructor to free allocation list
         inUseList->~tHeader();
 
-        tHeader *nextInUse = inUseList->nextPage;
-        if (inUseList->pageCount > 1)
-            delete[] reinterpret_cast<char *>(inUseList);
-        else
-        {
-            inUseList->nextPage = freeList;
-            freeList            = inUseList;
-        }
+        mArena->release(inUseList, blockSize);
         inUseList = nextInUse;
     }
 
@@ -283,19 +533,20 @@ void *TPoolAllocator::allocate(size_t numBytes)
     {
         //
         // Do a multi-page allocation.  Don't mix these with the others.
-        // The OS is efficient and allocating and free-ing multiple pages.
         //
         size_t numBytesToAlloc = allocationSize + headerSkip;
         // Detect integer overflow.
         if (numBytesToAlloc < allocationSize)
             return 0;
 
-        tHeader *memory = reinterpret_cast<tHeader *>(::new char[numBytesToAlloc]);
+        size_t blockSize;
+        tHeader *memory =
+            reinterpret_cast<tHeader *>(mArena->allocate(numBytesToAlloc, &blockSize));
         if (memory == 0)
             return 0;
 
         // Use placement-new to initialize header
-        new (memory) tHeader(inUseList, (numBytesToAlloc + pageSize - 1) / pageSize);
+        new (memory) tHeader(inUseList, blockSize);
         inUseList = memory;
 
         currentPageOffset = pageSize;  // make next allocation come from a new page
@@ -307,21 +558,13 @@ void *TPoolAllocator::allocate(size_t numBytes)
     //
     // Need a simple page to allocate from.
     //
-    tHeader *memory;
-    if (freeList)
-    {
-        memory   = freeList;
-        freeList = freeList->nextPage;
-    }
-    else
-    {
-        memory = reinterpret_cast<tHeader *>(::new char[pageSize]);
-        if (memory == 0)
-            return 0;
-    }
+    size_t blockSize;
+    tHeader *memory = reinterpret_cast<tHeader *>(mArena->allocate(pageSize, &blockSize));
+    if (memory == 0)
+        return 0;
 
     // Use placement-new to initialize header
-    new (memory) tHeader(inUseList, 1);
+    new (memory) tHeader(inUseList, blockSize);
     inUseList = memory;
 
     unsigned char *ret = reinterpret_cast<unsigned char *>(inUseList) + headerSkip;
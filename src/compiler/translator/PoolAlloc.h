@@ -33,8 +33,11 @@
 
 #include <stddef.h>
 #include <string.h>
+#include <mutex>
 #include <vector>
 
+struct ShPoolAllocatorStatistics;
+
 // If we are using guard blocks, we must track each indivual
 // allocation.  If we aren't using guard blocks, these
 // never get instantiated, so won't have any impact.
@@ -104,15 +107,85 @@ class TAllocation
 #endif
 };
 
+//
+// The memory of all pools comes from a process-wide arena of blocks, so that
+// compiles that follow each other reuse the same memory instead of going back
+// to the OS.  Freed blocks are kept in free lists by size class, up to a
+// configurable total size.  Blocks are sized in powers of two, and blocks that
+// are larger than the largest size class are not kept.
+//
+// On Linux, the arena can map its memory in large pages.  The blocks are then
+// carved out of chunks that are never unmapped, so their memory is kept
+// regardless of the cache size.
+//
+// Enough for the pools of a few large compiles.
+const size_t kDefaultPoolPageArenaMaxCachedSize = 8 * 1024 * 1024;
+
+class TPoolPageArena
+{
+  public:
+    TPoolPageArena();
+    ~TPoolPageArena();
+
+    // Returns a block of at least numBytes, or 0 if no memory is available.  The
+    // size of the block is returned in blockSizeOut and must be passed to release().
+    void *allocate(size_t numBytes, size_t *blockSizeOut);
+    void release(void *block, size_t blockSize);
+
+    // Frees the cached blocks that don't fit in the new size.
+    void setMaxCachedSize(size_t maxCachedSizeBytes);
+    void setUseLargePages(bool useLargePages);
+
+    void getStatistics(ShPoolAllocatorStatistics *statisticsOut) const;
+
+  private:
+    static const size_t kMinBlockSizeLog2   = 12;  // 4 KiB
+    static const size_t kMaxBlockSizeLog2   = 20;  // 1 MiB
+    static const size_t kSizeClassCount     = kMaxBlockSizeLog2 - kMinBlockSizeLog2 + 1;
+    static const size_t kLargePageChunkSize = 2 * 1024 * 1024;
+
+    struct tFreeBlock
+    {
+        tFreeBlock *next;
+    };
+
+    void *allocateFromSystem(size_t blockSize);
+    void *allocateFromLargePages(size_t blockSize);
+    void freeToSystem(void *block, size_t blockSize);
+    bool isInLargePages(const void *block) const;
+    void trimToSize(size_t limit);
+
+    mutable std::mutex mMutex;
+    tFreeBlock *mFreeLists[kSizeClassCount];
+    size_t mMaxCachedSize;
+    size_t mCachedSize;
+
+    bool mUseLargePages;
+    std::vector<unsigned char *> mLargePageChunks;  // sorted by address
+    unsigned char *mLargePageCursor;                // unused part of the last chunk
+    size_t mLargePageRemaining;
+
+    // Statistics
+    size_t mSystemAllocationCount;
+    size_t mBlocksInUse;
+    size_t mBytesInUse;
+    size_t mPeakBytesInUse;
+
+    TPoolPageArena &operator=(const TPoolPageArena &);
+    TPoolPageArena(const TPoolPageArena &);
+};
+
+// The arena shared by all pools.
+TPoolPageArena *GetPoolPageArena();
+
 //
 // There are several stacks.  One is to track the pushing and popping
 // of the user, and not yet implemented.  The others are simply a
 // repositories of free pages or used pages.
 //
 // Page stacks are linked together with a simple header at the beginning
-// of each allocation obtained from the underlying OS.  Multi-page allocations
-// are returned to the OS.  Individual page allocations are kept for future
-// re-use.
+// of each block obtained from the arena.  Popped pages, whether single or
+// multi-page, are given back to the arena for future re-use.
 //
 // The "page size" used is not, nor must it match, the underlying OS
 // page size.  But, having it be about that size or equal to a set of
@@ -173,9 +246,9 @@ class TPoolAllocator
 
     struct tHeader
     {
-        tHeader(tHeader *nextPage, size_t pageCount)
+        tHeader(tHeader *nextPage, size_t blockSize)
             : nextPage(nextPage),
-              pageCount(pageCount)
+              blockSize(blockSize)
 #ifdef GUARD_BLOCKS
               ,
               lastAllocation(0)
@@ -192,7 +265,7 @@ class TPoolAllocator
         }
 
         tHeader *nextPage;
-        size_t pageCount;
+        size_t blockSize;  // size of the block obtained from the arena
 #ifdef GUARD_BLOCKS
         TAllocation *lastAllocation;
 #endif
@@ -221,9 +294,9 @@ class TPoolAllocator
                                //      header (basically, size of header, rounded
                                //      up to make it aligned
     size_t currentPageOffset;  // next offset in top of inUseList to allocate from
-    tHeader *freeList;         // list of popped memory
     tHeader *inUseList;        // list of all memory currently being used
     tAllocStack mStack;        // stack of where to allocate from, to partition pool
+    TPoolPageArena *mArena;    // where pages come from and go back to
 
     int numCalls;       // just an interesting statistic
     size_t totalBytes;  // just an interesting statistic
@@ -11,9 +11,12 @@
 
 #include "GLSLANG/ShaderLang.h"
 
+#include <mutex>
+
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeDll.h"
 #include "compiler/translator/length_limits.h"
+#include "compiler/translator/PoolAlloc.h"
 #ifdef ANGLE_ENABLE_HLSL
 #include "compiler/translator/TranslatorHLSL.h"
 #endif  // ANGLE_ENABLE_HLSL
@@ -26,6 +29,8 @@ namespace sh
 namespace
 {
 
+// Initialize and Finalize may be called by contexts on different threads.
+std::mutex gInitializeMutex;
 bool isInitialized = false;
 
 //
@@ -149,6 +154,7 @@ GLenum GetGeometryShaderPrimitiveTypeEnum(sh::TLayoutPrimitiveType primitiveType
 //
 bool Initialize()
 {
+    std::lock_guard<std::mutex> lock(gInitializeMutex);
     if (!isInitialized)
     {
         isInitialized = InitProcess();
@@ -161,6 +167,7 @@ bool Initialize()
 //
 bool Finalize()
 {
+    std::lock_guard<std::mutex> lock(gInitializeMutex);
     if (isInitialized)
     {
         DetachProcess();
@@ -575,4 +582,47 @@ int GetGeometryShaderMaxVertices(const ShHandle handle)
     return compiler->getGeometryShaderMaxVertices();
 }
 
+void SetTranslationCacheMaxSize(size_t maxSizeBytes)
+{
+    GetTranslationCache()->setMaxSize(maxSizeBytes);
+}
+
+size_t GetTranslationCacheSize()
+{
+    return GetTranslationCache()->size();
+}
+
+void ClearTranslationCache()
+{
+    GetTranslationCache()->clear();
+}
+
+bool SaveTranslationCache(const char *path)
+{
+    ASSERT(path);
+    return GetTranslationCache()->save(path);
+}
+
+bool LoadTranslationCache(const char *path)
+{
+    ASSERT(path);
+    return GetTranslationCache()->load(path);
+}
+
+void SetPoolAllocatorCacheMaxSize(size_t maxSizeBytes)
+{
+    GetPoolPageArena()->setMaxCachedSize(maxSizeBytes);
+}
+
+void SetPoolAllocatorUseLargePages(bool useLargePages)
+{
+    GetPoolPageArena()->setUseLargePages(useLargePages);
+}
+
+void GetPoolAllocatorStatistics(ShPoolAllocatorStatistics *statisticsOut)
+{
+    ASSERT(statisticsOut);
+    GetPoolPageArena()->getStatistics(statisticsOut);
+}
+
 }  // namespace sh
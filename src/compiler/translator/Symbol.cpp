@@ -132,6 +132,9 @@ TFunction::TFunction(TSymbolTable *symbolTable,
                      TOperator tOp,
                      TExtension extension)
     : TSymbol(symbolTable, name, symbolType, extension),
+      mParametersVector(new TParamList()),
+      mParameters(nullptr),
+      mParamCount(0u),
       returnType(retType),
       mangledName(nullptr),
       op(tOp),
@@ -144,23 +147,21 @@ TFunction::TFunction(TSymbolTable *symbolTable,
     ASSERT(name != nullptr || symbolType == SymbolType::AngleInternal || tOp != EOpNull);
 }
 
-TFunction::~TFunction()
-{
-    // Just here to discourage the compiler from inlining it.
-}
-
 void TFunction::clearParameters()
 {
-    parameters.clear();
+    ASSERT(mParametersVector);
+    mParametersVector->clear();
+    mParameters = nullptr;
+    mParamCount = 0u;
     mangledName = ImmutableString("");
 }
 
 void TFunction::swapParameters(const TFunction &parametersSource)
 {
     clearParameters();
-    for (auto parameter : parametersSource.parameters)
+    for (size_t paramIndex = 0; paramIndex < parametersSource.getParamCount(); ++paramIndex)
     {
-        addParameter(parameter);
+        addParameter(parametersSource.getParam(paramIndex));
     }
 }
 
@@ -169,9 +170,9 @@ ImmutableString TFunction::buildMangledName() const
     std::string newName(name().data(), name().length());
     newName += kFunctionMangledNameSeparator;
 
-    for (const auto &p : parameters)
+    for (size_t paramIndex = 0; paramIndex < mParamCount; ++paramIndex)
     {
-        newName += p.type->getMangledName();
+        newName += mParameters[paramIndex].type->getMangledName();
     }
     return ImmutableString(newName);
 }
@@ -38,10 +38,8 @@ class TSymbol : angle::NonCopyable
             SymbolType symbolType,
             TExtension extension = TExtension::UNDEFINED);
 
-    virtual ~TSymbol()
-    {
-        // don't delete name, it's from the pool
-    }
+    // Symbols are either pool allocated or static, and are never destroyed. Not having a destructor
+    // lets the built-ins be initialized at compile time.
 
     // Don't call name() or getMangledName() for empty symbols (symbolType == SymbolType::Empty).
     ImmutableString name() const;
@@ -56,6 +54,15 @@ class TSymbol : angle::NonCopyable
     TExtension extension() const { return mExtension; }
 
   protected:
+    // Used for the built-in functions that are initialized at compile time.
+    constexpr TSymbol(const TSymbolUniqueId &id,
+                      const ImmutableString &name,
+                      SymbolType symbolType,
+                      TExtension extension)
+        : mName(name), mUniqueId(id), mSymbolType(symbolType), mExtension(extension)
+    {
+    }
+
     const ImmutableString mName;
 
   private:
@@ -75,7 +82,6 @@ class TVariable : public TSymbol
               SymbolType symbolType,
               TExtension ext = TExtension::UNDEFINED);
 
-    ~TVariable() override {}
     bool isVariable() const override { return true; }
     const TType &getType() const { return *mType; }
 
@@ -144,10 +150,10 @@ class TInterfaceBlock : public TSymbol, public TFieldListCollection
 // Immutable version of TParameter.
 struct TConstParameter
 {
-    TConstParameter() : name(""), type(nullptr) {}
-    explicit TConstParameter(const ImmutableString &n) : name(n), type(nullptr) {}
-    explicit TConstParameter(const TType *t) : name(""), type(t) {}
-    TConstParameter(const ImmutableString &n, const TType *t) : name(n), type(t) {}
+    constexpr TConstParameter() : name(""), type(nullptr) {}
+    explicit constexpr TConstParameter(const ImmutableString &n) : name(n), type(nullptr) {}
+    explicit constexpr TConstParameter(const TType *t) : name(""), type(t) {}
+    constexpr TConstParameter(const ImmutableString &n, const TType *t) : name(n), type(t) {}
 
     // Both constructor arguments must be const.
     TConstParameter(ImmutableString *n, TType *t)       = delete;
@@ -190,13 +196,37 @@ class TFunction : public TSymbol
               TOperator tOp        = EOpNull,
               TExtension extension = TExtension::UNDEFINED);
 
-    virtual ~TFunction();
+    // Built-in functions that are initialized at compile time. The parameters and the mangled name
+    // are static as well.
+    constexpr TFunction(const TSymbolUniqueId &id,
+                        const ImmutableString &name,
+                        TExtension extension,
+                        const TConstParameter *parameters,
+                        size_t paramCount,
+                        const TType *retType,
+                        const ImmutableString &mangledNameIn,
+                        TOperator tOp)
+        : TSymbol(id, name, SymbolType::BuiltIn, extension),
+          mParametersVector(nullptr),
+          mParameters(parameters),
+          mParamCount(paramCount),
+          returnType(retType),
+          mangledName(mangledNameIn),
+          op(tOp),
+          defined(false),
+          mHasPrototypeDeclaration(false),
+          mKnownToNotHaveSideEffects(false)
+    {
+    }
 
     bool isFunction() const override { return true; }
 
     void addParameter(const TConstParameter &p)
     {
-        parameters.push_back(p);
+        ASSERT(mParametersVector);
+        mParametersVector->push_back(p);
+        mParameters = mParametersVector->data();
+        mParamCount = mParametersVector->size();
         mangledName = ImmutableString("");
     }
 
@@ -220,8 +250,8 @@ class TFunction : public TSymbol
     void setHasPrototypeDeclaration() { mHasPrototypeDeclaration = true; }
     bool hasPrototypeDeclaration() const { return mHasPrototypeDeclaration; }
 
-    size_t getParamCount() const { return parameters.size(); }
-    const TConstParameter &getParam(size_t i) const { return parameters[i]; }
+    size_t getParamCount() const { return mParamCount; }
+    const TConstParameter &getParam(size_t i) const { return mParameters[i]; }
 
     bool isKnownToNotHaveSideEffects() const { return mKnownToNotHaveSideEffects; }
 
@@ -234,7 +264,11 @@ class TFunction : public TSymbol
     ImmutableString buildMangledName() const;
 
     typedef TVector<TConstParameter> TParamList;
-    TParamList parameters;
+    // Only allocated for functions that aren't initialized at compile time. mParameters points to
+    // its data or to the static parameters.
+    TParamList *mParametersVector;
+    const TConstParameter *mParameters;
+    size_t mParamCount;
     const TType *const returnType;
     mutable ImmutableString mangledName;
     const TOperator op;  // Only set for built-ins
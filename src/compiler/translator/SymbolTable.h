@@ -14,6 +14,10 @@
 //   effort of creating and loading with the large numbers of built-in
 //   symbols.
 //
+// * Built-in functions are generated at compile time by gen_builtin_symbols.py
+//   and are shared by all symbol tables. Only built-in variables, which
+//   depend on the resources, are inserted when a table is initialized.
+//
 // * Name mangling will be used to give each function a unique name
 //   so that symbol table lookups are never ambiguous.  This allows
 //   a simpler symbol table structure.
@@ -62,12 +66,10 @@ const int GLOBAL_LEVEL       = 5;
 class TSymbolTable : angle::NonCopyable
 {
   public:
-    TSymbolTable() : mUniqueIdCounter(0), mUserDefinedUniqueIdsStart(-1)
-    {
-        // The symbol table cannot be used until push() is called, but
-        // the lack of an initial call to push() can be used to detect
-        // that the symbol table has not been preloaded with built-ins.
-    }
+    // The symbol table cannot be used until push() is called, but
+    // the lack of an initial call to push() can be used to detect
+    // that the symbol table has not been preloaded with built-ins.
+    TSymbolTable();
 
     ~TSymbolTable();
 
@@ -176,77 +178,6 @@ class TSymbolTable : angle::NonCopyable
                           const ImmutableString &name,
                           const std::array<int, 3> &values);
 
-    // Note that for inserted built-in functions the const char *name needs to remain valid for the
-    // lifetime of the SymbolTable. SymbolTable does not allocate a copy of it.
-    void insertBuiltIn(ESymbolLevel level,
-                       TOperator op,
-                       TExtension ext,
-                       const TType *rvalue,
-                       const char *name,
-                       const TType *ptype1,
-                       const TType *ptype2 = 0,
-                       const TType *ptype3 = 0,
-                       const TType *ptype4 = 0,
-                       const TType *ptype5 = 0);
-
-    void insertBuiltIn(ESymbolLevel level,
-                       const TType *rvalue,
-                       const char *name,
-                       const TType *ptype1,
-                       const TType *ptype2 = 0,
-                       const TType *ptype3 = 0,
-                       const TType *ptype4 = 0,
-                       const TType *ptype5 = 0)
-    {
-        insertUnmangledBuiltInName(name, level);
-        insertBuiltIn(level, EOpNull, TExtension::UNDEFINED, rvalue, name, ptype1, ptype2, ptype3,
-                      ptype4, ptype5);
-    }
-
-    void insertBuiltIn(ESymbolLevel level,
-                       TExtension ext,
-                       const TType *rvalue,
-                       const char *name,
-                       const TType *ptype1,
-                       const TType *ptype2 = 0,
-                       const TType *ptype3 = 0,
-                       const TType *ptype4 = 0,
-                       const TType *ptype5 = 0)
-    {
-        insertUnmangledBuiltInName(name, level);
-        insertBuiltIn(level, EOpNull, ext, rvalue, name, ptype1, ptype2, ptype3, ptype4, ptype5);
-    }
-
-    void insertBuiltInOp(ESymbolLevel level,
-                         TOperator op,
-                         const TType *rvalue,
-                         const TType *ptype1,
-                         const TType *ptype2 = 0,
-                         const TType *ptype3 = 0,
-                         const TType *ptype4 = 0,
-                         const TType *ptype5 = 0);
-
-    void insertBuiltInOp(ESymbolLevel level,
-                         TOperator op,
-                         TExtension ext,
-                         const TType *rvalue,
-                         const TType *ptype1,
-                         const TType *ptype2 = 0,
-                         const TType *ptype3 = 0,
-                         const TType *ptype4 = 0,
-                         const TType *ptype5 = 0);
-
-    void insertBuiltInFunctionNoParameters(ESymbolLevel level,
-                                           TOperator op,
-                                           const TType *rvalue,
-                                           const char *name);
-
-    void insertBuiltInFunctionNoParametersExt(ESymbolLevel level,
-                                              TExtension ext,
-                                              TOperator op,
-                                              const TType *rvalue,
-                                              const char *name);
-
     TVariable *insertVariable(ESymbolLevel level,
                               const ImmutableString &name,
                               const TType *type,
@@ -256,17 +187,14 @@ class TSymbolTable : angle::NonCopyable
 
     TFunction *findUserDefinedFunction(const ImmutableString &name) const;
 
-    // Used to insert unmangled functions to check redeclaration of built-ins in ESSL 3.00 and
-    // above.
-    void insertUnmangledBuiltInName(const char *name, ESymbolLevel level);
-
-    bool hasUnmangledBuiltInAtLevel(const char *name, ESymbolLevel level);
+    const TFunction *findBuiltInFunction(const ImmutableString &mangledName,
+                                         int shaderVersion,
+                                         bool includeGLSLBuiltins) const;
+    bool areBuiltInConditionsMet(uint16_t conditions) const;
 
     void initSamplerDefaultPrecision(TBasicType samplerType);
 
-    void initializeBuiltInFunctions(sh::GLenum type,
-                                    ShShaderSpec spec,
-                                    const ShBuiltInResources &resources);
+    void initializeBuiltInFunctions(sh::GLenum type, const ShBuiltInResources &resources);
     void initializeBuiltInVariables(sh::GLenum type,
                                     ShShaderSpec spec,
                                     const ShBuiltInResources &resources);
@@ -276,12 +204,16 @@ class TSymbolTable : angle::NonCopyable
     typedef TMap<TBasicType, TPrecision> PrecisionStackLevel;
     std::vector<PrecisionStackLevel *> precisionStack;
 
+    // Starts after the ids of the built-in functions, which are generated at compile time.
     int mUniqueIdCounter;
 
     // -1 before built-in init has finished, one past the last built-in id afterwards.
-    // TODO(oetuaho): Make this a compile-time constant once the symbol table is initialized at
-    // compile time. http://anglebug.com/1432
+    // TODO(oetuaho): Make this a compile-time constant once the built-in variables are also
+    // initialized at compile time. http://anglebug.com/1432
     int mUserDefinedUniqueIdsStart;
+
+    // BuiltInCondition bits for the shader type and the extensions enabled in the resources.
+    uint16_t mBuiltInConditions;
 };
 
 }  // namespace sh
@@ -0,0 +1,7545 @@
+// GENERATED FILE - DO NOT EDIT.
+// Generated by gen_builtin_symbols.py using data from builtin_function_declarations.txt.
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SymbolTable_autogen.cpp:
+//   Compile-time initialized built-in functions of the symbol table, and the perfect hash tables
+//   used to look them up.
+
+#include "compiler/translator/SymbolTable_autogen.h"
+
+#include "compiler/translator/StaticType.h"
+#include "compiler/translator/Symbol.h"
+#include "compiler/translator/SymbolTable.h"
+
+namespace sh
+{
+
+namespace
+{
+
+struct HashSlot
+{
+    ImmutableString name;
+    uint16_t firstEntry;
+    uint16_t entryCount;
+};
+
+// Seeded FNV-1a, followed by the MurmurHash3 finalizer so that all the bits depend on the seed.
+uint32_t HashName(uint32_t seed, const ImmutableString &name)
+{
+    uint32_t hash = 0x811c9dc5u ^ seed;
+    for (size_t index = 0; index < name.length(); ++index)
+    {
+        hash ^= static_cast<unsigned char>(name.data()[index]);
+        hash *= 0x01000193u;
+    }
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+// The first level hash picks a bucket, and the seed of the bucket makes the second level hash
+// place every name of the bucket in a slot of its own.
+template <size_t bucketCount, size_t slotCount>
+const HashSlot *FindSlot(const uint32_t (&seeds)[bucketCount],
+                         const HashSlot (&slots)[slotCount],
+                         const ImmutableString &name)
+{
+    uint32_t seed        = seeds[HashName(0, name) % bucketCount];
+    const HashSlot &slot = slots[HashName(seed, name) % slotCount];
+    return slot.name == name ? &slot : nullptr;
+}
+
+constexpr const TConstParameter kParameters_f1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vf2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vf3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vf4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_f1_f1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vf3_vf3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vf4_vf4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vi2[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vi3[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vi4[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_vf2_f1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vf4_f1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vi2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vi3_vi3[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vi4_vi4[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vi3_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vi4_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_u1_u1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu2_vu2[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vu3_vu3[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vu4_vu4[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_vu2_u1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu3_u1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu4_u1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_f1_f1_f1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vf2_f1_f1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vf3_f1_f1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vf4_f1_f1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vf2_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vf3_vf3_vf3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vf4_vf4_vf4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_i1_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vi2_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vi3_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vi4_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vi2_vi2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vi3_vi3_vi3[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vi4_vi4_vi4[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_u1_u1_u1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu2_u1_u1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu3_u1_u1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu4_u1_u1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu2_vu2_vu2[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vu3_vu3_vu3[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vu4_vu4_vu4[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_vf2_vf2_f1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vf3_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vf4_vf4_f1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_f1_f1_b1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vf2_vf2_vb2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vf3_vf3_vb3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vf4_vf4_vb4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_f1_vf2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_f1_vf3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_f1_vf4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_f1_f1_vf2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_f1_f1_vf3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_f1_f1_vf4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_f1_out_f1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqOut, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vf2_out_vf2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqOut, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vf3_out_vf3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqOut, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vf4_out_vf4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqOut, 4, 1>())};
+
+constexpr const TConstParameter kParameters_u1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu2[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vu3[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vu4[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_f1_out_i1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vf2_out_vi2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vf3_out_vi3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vf4_out_vi4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 4, 1>())};
+
+constexpr const TConstParameter kParameters_f1_i1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vf3_vi3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vf4_vi4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_mf2x2_mf2x2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 2>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 2>())};
+
+constexpr const TConstParameter kParameters_mf3x3_mf3x3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 3>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 3>())};
+
+constexpr const TConstParameter kParameters_mf4x4_mf4x4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 4>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 4>())};
+
+constexpr const TConstParameter kParameters_mf2x3_mf2x3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 3>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 3>())};
+
+constexpr const TConstParameter kParameters_mf3x2_mf3x2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 2>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 2>())};
+
+constexpr const TConstParameter kParameters_mf2x4_mf2x4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 4>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 4>())};
+
+constexpr const TConstParameter kParameters_mf4x2_mf4x2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 2>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 2>())};
+
+constexpr const TConstParameter kParameters_mf3x4_mf3x4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 4>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 4>())};
+
+constexpr const TConstParameter kParameters_mf4x3_mf4x3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 3>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 3>())};
+
+constexpr const TConstParameter kParameters_vf3_vf2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vf2_vf3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vf4_vf2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vf2_vf4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_vf4_vf3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vf3_vf4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_mf2x2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 2>())};
+
+constexpr const TConstParameter kParameters_mf3x3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 3>())};
+
+constexpr const TConstParameter kParameters_mf4x4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 4>())};
+
+constexpr const TConstParameter kParameters_mf3x2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 2>())};
+
+constexpr const TConstParameter kParameters_mf2x3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 3>())};
+
+constexpr const TConstParameter kParameters_mf4x2[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 2>())};
+
+constexpr const TConstParameter kParameters_mf2x4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 4>())};
+
+constexpr const TConstParameter kParameters_mf4x3[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 3>())};
+
+constexpr const TConstParameter kParameters_mf3x4[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 4>())};
+
+constexpr const TConstParameter kParameters_vb2_vb2[] = {
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vb3_vb3[] = {
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vb4_vb4[] = {
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_vb2[] = {
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vb3[] = {
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vb4[] = {
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_u1_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu2_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu3_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu4_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_i1_i1_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vi2_vi2_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vi3_vi3_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vi4_vi4_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_u1_u1_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu2_vu2_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu3_vu3_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu4_vu4_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_u1_u1_out_u1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu2_vu2_out_vu2[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vu3_vu3_out_vu3[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vu4_vu4_out_vu4[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 4, 1>())};
+
+constexpr const TConstParameter kParameters_u1_u1_out_u1_out_u1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vu2_vu2_out_vu2_out_vu2[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vu3_vu3_out_vu3_out_vu3[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vu4_vu4_out_vu4_out_vu4[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 4, 1>())};
+
+constexpr const TConstParameter kParameters_i1_i1_out_i1_out_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 1, 1>())};
+
+constexpr const TConstParameter kParameters_vi2_vi2_out_vi2_out_vi2[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 2, 1>())};
+
+constexpr const TConstParameter kParameters_vi3_vi3_out_vi3_out_vi3[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 3, 1>())};
+
+constexpr const TConstParameter kParameters_vi4_vi4_out_vi4_out_vi4[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 4, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf3[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf4[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_sC1_vf3[] = {
+    TConstParameter(StaticType::Get<EbtSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_sext1_vf2[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_sext1_vf3[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_sext1_vf4[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_s2r1_vf2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DRect, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s2r1_vf3[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DRect, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s2r1_vf4[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DRect, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf2_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf3_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf4_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_sC1_vf3_vf3_vf3[] = {
+    TConstParameter(StaticType::Get<EbtSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf2_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf4_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sC1_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vf3[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vf3[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vf3[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_isC1_vf3[] = {
+    TConstParameter(StaticType::Get<EbtISamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_usC1_vf3[] = {
+    TConstParameter(StaticType::Get<EbtUSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s2a1_vf3[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_is2a1_vf3[] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_us2a1_vf3[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf3[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf3[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf4[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf4[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vf4[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vf4[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vf4[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf2_f1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf2_f1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_isC1_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtISamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_usC1_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtUSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2a1_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is2a1_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us2a1_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sext2y2y1_vf2[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_sext2y2y1_vf3[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_sext2y2y1_vf4[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_vf3_ycs1[] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtYuvCscStandardEXT, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf4_f1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf4_f1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vf4_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vf4_f1[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vf4_f1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sext1_vf2_f1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sext1_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sext1_vf4_f1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sext2y2y1_vf2_f1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sext2y2y1_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sext2y2y1_vf4_f1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf3[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_sCs1_vf4[] = {
+    TConstParameter(StaticType::Get<EbtSamplerCubeShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_s2as1_vf4[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArrayShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf4[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sCs1_vf4_f1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerCubeShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf4_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s21_i1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is21_i1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us21_i1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s31_i1[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is31_i1[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us31_i1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sC1_i1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_isC1_i1[] = {
+    TConstParameter(StaticType::Get<EbtISamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_usC1_i1[] = {
+    TConstParameter(StaticType::Get<EbtUSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2a1_i1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is2a1_i1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us2a1_i1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_i1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sCs1_i1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerCubeShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2as1_i1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArrayShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2ms1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DMS, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is2ms1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2DMS, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us2ms1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DMS, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sext1_i1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sext2y2y1_i1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vf3_vi3[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vf3_vi3[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vf3_vi3[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf3_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s2a1_vf3_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is2a1_vf3_vi2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us2a1_vf3_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf2_vi2_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf2_vi2_f1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf2_vi2_f1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vf3_vi3_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vf3_vi3_f1[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vf3_vi3_f1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf3_vi2_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2a1_vf3_vi2_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is2a1_vf3_vi2_f1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us2a1_vf3_vi2_f1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf3_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf3_vi2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf3_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf4_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf4_vi2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf4_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vf4_vi3[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vf4_vi3[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vf4_vi3[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf4_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf3_vi2_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf3_vi2_f1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf3_vi2_f1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf4_vi2_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf4_vi2_f1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf4_vi2_f1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vf4_vi3_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vf4_vi3_f1[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vf4_vi3_f1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf4_vi2_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf2_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf2_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf2_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vf3_f1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vf3_f1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vf3_f1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf3_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s2a1_vf3_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is2a1_vf3_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us2a1_vf3_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf3_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf3_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf3_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf4_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf4_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf4_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vf4_f1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vf4_f1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vf4_f1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf4_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vi3_i1[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vi3_i1[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vi3_i1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2a1_vi3_i1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is2a1_vi3_i1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us2a1_vi3_i1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sext1_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sext2y2y1_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vi2_i1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vi2_i1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vi2_i1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vi3_i1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vi3_i1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vi3_i1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s2a1_vi3_i1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is2a1_vi3_i1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us2a1_vi3_i1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf2_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf2_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vf3_vf3_vf3[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vf3_vf3_vf3[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vf3_vf3_vf3[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_isC1_vf3_vf3_vf3[] = {
+    TConstParameter(StaticType::Get<EbtISamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_usC1_vf3_vf3_vf3[] = {
+    TConstParameter(StaticType::Get<EbtUSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf3_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_sCs1_vf4_vf3_vf3[] = {
+    TConstParameter(StaticType::Get<EbtSamplerCubeShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s2a1_vf3_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is2a1_vf3_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us2a1_vf3_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s2as1_vf4_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArrayShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf2_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf2_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf2_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vf3_vf3_vf3_vi3[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vf3_vf3_vf3_vi3[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vf3_vf3_vf3_vi3[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf3_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s2a1_vf3_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is2a1_vf3_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us2a1_vf3_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s2as1_vf4_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArrayShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf3_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf3_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf4_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf4_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vf4_vf3_vf3[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vf4_vf3_vf3[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vf4_vf3_vf3[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf4_vf2_vf2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf3_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf3_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf3_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf4_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf4_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf4_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s31_vf4_vf3_vf3_vi3[] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_is31_vf4_vf3_vf3_vi3[] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_us31_vf4_vf3_vf3_vi3[] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf4_vf2_vf2_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_ac1[] = {
+    TConstParameter(StaticType::Get<EbtAtomicCounter, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_inout_u1_u1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqInOut, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_inout_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqInOut, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_inout_u1_u1_u1[] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqInOut, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_inout_i1_i1_i1[] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqInOut, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_im21_vi2_vf4[] = {
+    TConstParameter(StaticType::Get<EbtImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_iim21_vi2_vi4[] = {
+    TConstParameter(StaticType::Get<EbtIImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_uim21_vi2_vu4[] = {
+    TConstParameter(StaticType::Get<EbtUImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_im31_vi3_vf4[] = {
+    TConstParameter(StaticType::Get<EbtImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_iim31_vi3_vi4[] = {
+    TConstParameter(StaticType::Get<EbtIImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_uim31_vi3_vu4[] = {
+    TConstParameter(StaticType::Get<EbtUImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_im2a1_vi3_vf4[] = {
+    TConstParameter(StaticType::Get<EbtImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_iim2a1_vi3_vi4[] = {
+    TConstParameter(StaticType::Get<EbtIImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_uim2a1_vi3_vu4[] = {
+    TConstParameter(StaticType::Get<EbtUImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_imc1_vi3_vf4[] = {
+    TConstParameter(StaticType::Get<EbtImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_iimc1_vi3_vi4[] = {
+    TConstParameter(StaticType::Get<EbtIImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_uimc1_vi3_vu4[] = {
+    TConstParameter(StaticType::Get<EbtUImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>())};
+
+constexpr const TConstParameter kParameters_im21_vi2[] = {
+    TConstParameter(StaticType::Get<EbtImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_iim21_vi2[] = {
+    TConstParameter(StaticType::Get<EbtIImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_uim21_vi2[] = {
+    TConstParameter(StaticType::Get<EbtUImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_im31_vi3[] = {
+    TConstParameter(StaticType::Get<EbtImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_iim31_vi3[] = {
+    TConstParameter(StaticType::Get<EbtIImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_uim31_vi3[] = {
+    TConstParameter(StaticType::Get<EbtUImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_im2a1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_iim2a1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtIImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_uim2a1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtUImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_imc1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_iimc1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtIImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_uimc1_vi3[] = {
+    TConstParameter(StaticType::Get<EbtUImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_im21[] = {
+    TConstParameter(StaticType::Get<EbtImage2D, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_iim21[] = {
+    TConstParameter(StaticType::Get<EbtIImage2D, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_uim21[] = {
+    TConstParameter(StaticType::Get<EbtUImage2D, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_im31[] = {
+    TConstParameter(StaticType::Get<EbtImage3D, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_iim31[] = {
+    TConstParameter(StaticType::Get<EbtIImage3D, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_uim31[] = {
+    TConstParameter(StaticType::Get<EbtUImage3D, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_im2a1[] = {
+    TConstParameter(StaticType::Get<EbtImage2DArray, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_iim2a1[] = {
+    TConstParameter(StaticType::Get<EbtIImage2DArray, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_uim2a1[] = {
+    TConstParameter(StaticType::Get<EbtUImage2DArray, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_imc1[] = {
+    TConstParameter(StaticType::Get<EbtImageCube, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_iimc1[] = {
+    TConstParameter(StaticType::Get<EbtIImageCube, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_uimc1[] = {
+    TConstParameter(StaticType::Get<EbtUImageCube, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2ms1_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DMS, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is2ms1_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2DMS, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us2ms1_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DMS, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf2_i1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf2_i1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf2_i1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2a1_vf3_i1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is2a1_vf3_i1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us2a1_vf3_i1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sC1_vf3_i1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_isC1_vf3_i1[] = {
+    TConstParameter(StaticType::Get<EbtISamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_usC1_vf3_i1[] = {
+    TConstParameter(StaticType::Get<EbtUSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf2_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2as1_vf3[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArrayShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_s2as1_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArrayShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_sCs1_vf3[] = {
+    TConstParameter(StaticType::Get<EbtSamplerCubeShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>())};
+
+constexpr const TConstParameter kParameters_sCs1_vf3_f1[] = {
+    TConstParameter(StaticType::Get<EbtSamplerCubeShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s21_vf2_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is21_vf2_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us21_vf2_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2a1_vf3_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_is2a1_vf3_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_us2a1_vf3_vi2_i1[] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>())};
+
+constexpr const TConstParameter kParameters_s2s1_vf2_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TConstParameter kParameters_s2as1_vf3_f1_vi2[] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArrayShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>())};
+
+constexpr const TFunction kFunctions[] = {
+    // float radians(float)
+    {TSymbolUniqueId(1), ImmutableString("radians"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("radians(f1;"),
+     EOpRadians},
+    // vec2 radians(vec2)
+    {TSymbolUniqueId(2), ImmutableString("radians"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("radians(vf2;"),
+     EOpRadians},
+    // vec3 radians(vec3)
+    {TSymbolUniqueId(3), ImmutableString("radians"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("radians(vf3;"),
+     EOpRadians},
+    // vec4 radians(vec4)
+    {TSymbolUniqueId(4), ImmutableString("radians"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("radians(vf4;"),
+     EOpRadians},
+    // float degrees(float)
+    {TSymbolUniqueId(5), ImmutableString("degrees"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("degrees(f1;"),
+     EOpDegrees},
+    // vec2 degrees(vec2)
+    {TSymbolUniqueId(6), ImmutableString("degrees"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("degrees(vf2;"),
+     EOpDegrees},
+    // vec3 degrees(vec3)
+    {TSymbolUniqueId(7), ImmutableString("degrees"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("degrees(vf3;"),
+     EOpDegrees},
+    // vec4 degrees(vec4)
+    {TSymbolUniqueId(8), ImmutableString("degrees"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("degrees(vf4;"),
+     EOpDegrees},
+    // float sin(float)
+    {TSymbolUniqueId(9), ImmutableString("sin"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("sin(f1;"),
+     EOpSin},
+    // vec2 sin(vec2)
+    {TSymbolUniqueId(10), ImmutableString("sin"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("sin(vf2;"),
+     EOpSin},
+    // vec3 sin(vec3)
+    {TSymbolUniqueId(11), ImmutableString("sin"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("sin(vf3;"),
+     EOpSin},
+    // vec4 sin(vec4)
+    {TSymbolUniqueId(12), ImmutableString("sin"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("sin(vf4;"),
+     EOpSin},
+    // float cos(float)
+    {TSymbolUniqueId(13), ImmutableString("cos"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("cos(f1;"),
+     EOpCos},
+    // vec2 cos(vec2)
+    {TSymbolUniqueId(14), ImmutableString("cos"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("cos(vf2;"),
+     EOpCos},
+    // vec3 cos(vec3)
+    {TSymbolUniqueId(15), ImmutableString("cos"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("cos(vf3;"),
+     EOpCos},
+    // vec4 cos(vec4)
+    {TSymbolUniqueId(16), ImmutableString("cos"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("cos(vf4;"),
+     EOpCos},
+    // float tan(float)
+    {TSymbolUniqueId(17), ImmutableString("tan"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("tan(f1;"),
+     EOpTan},
+    // vec2 tan(vec2)
+    {TSymbolUniqueId(18), ImmutableString("tan"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("tan(vf2;"),
+     EOpTan},
+    // vec3 tan(vec3)
+    {TSymbolUniqueId(19), ImmutableString("tan"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("tan(vf3;"),
+     EOpTan},
+    // vec4 tan(vec4)
+    {TSymbolUniqueId(20), ImmutableString("tan"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("tan(vf4;"),
+     EOpTan},
+    // float asin(float)
+    {TSymbolUniqueId(21), ImmutableString("asin"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("asin(f1;"),
+     EOpAsin},
+    // vec2 asin(vec2)
+    {TSymbolUniqueId(22), ImmutableString("asin"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("asin(vf2;"),
+     EOpAsin},
+    // vec3 asin(vec3)
+    {TSymbolUniqueId(23), ImmutableString("asin"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("asin(vf3;"),
+     EOpAsin},
+    // vec4 asin(vec4)
+    {TSymbolUniqueId(24), ImmutableString("asin"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("asin(vf4;"),
+     EOpAsin},
+    // float acos(float)
+    {TSymbolUniqueId(25), ImmutableString("acos"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("acos(f1;"),
+     EOpAcos},
+    // vec2 acos(vec2)
+    {TSymbolUniqueId(26), ImmutableString("acos"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("acos(vf2;"),
+     EOpAcos},
+    // vec3 acos(vec3)
+    {TSymbolUniqueId(27), ImmutableString("acos"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("acos(vf3;"),
+     EOpAcos},
+    // vec4 acos(vec4)
+    {TSymbolUniqueId(28), ImmutableString("acos"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("acos(vf4;"),
+     EOpAcos},
+    // float atan(float, float)
+    {TSymbolUniqueId(29), ImmutableString("atan"), TExtension::UNDEFINED, kParameters_f1_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("atan(f1;f1;"),
+     EOpAtan},
+    // vec2 atan(vec2, vec2)
+    {TSymbolUniqueId(30), ImmutableString("atan"), TExtension::UNDEFINED, kParameters_vf2_vf2, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("atan(vf2;vf2;"),
+     EOpAtan},
+    // vec3 atan(vec3, vec3)
+    {TSymbolUniqueId(31), ImmutableString("atan"), TExtension::UNDEFINED, kParameters_vf3_vf3, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("atan(vf3;vf3;"),
+     EOpAtan},
+    // vec4 atan(vec4, vec4)
+    {TSymbolUniqueId(32), ImmutableString("atan"), TExtension::UNDEFINED, kParameters_vf4_vf4, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("atan(vf4;vf4;"),
+     EOpAtan},
+    // float atan(float)
+    {TSymbolUniqueId(33), ImmutableString("atan"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("atan(f1;"),
+     EOpAtan},
+    // vec2 atan(vec2)
+    {TSymbolUniqueId(34), ImmutableString("atan"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("atan(vf2;"),
+     EOpAtan},
+    // vec3 atan(vec3)
+    {TSymbolUniqueId(35), ImmutableString("atan"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("atan(vf3;"),
+     EOpAtan},
+    // vec4 atan(vec4)
+    {TSymbolUniqueId(36), ImmutableString("atan"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("atan(vf4;"),
+     EOpAtan},
+    // float sinh(float)
+    {TSymbolUniqueId(37), ImmutableString("sinh"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("sinh(f1;"),
+     EOpSinh},
+    // vec2 sinh(vec2)
+    {TSymbolUniqueId(38), ImmutableString("sinh"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("sinh(vf2;"),
+     EOpSinh},
+    // vec3 sinh(vec3)
+    {TSymbolUniqueId(39), ImmutableString("sinh"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("sinh(vf3;"),
+     EOpSinh},
+    // vec4 sinh(vec4)
+    {TSymbolUniqueId(40), ImmutableString("sinh"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("sinh(vf4;"),
+     EOpSinh},
+    // float cosh(float)
+    {TSymbolUniqueId(41), ImmutableString("cosh"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("cosh(f1;"),
+     EOpCosh},
+    // vec2 cosh(vec2)
+    {TSymbolUniqueId(42), ImmutableString("cosh"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("cosh(vf2;"),
+     EOpCosh},
+    // vec3 cosh(vec3)
+    {TSymbolUniqueId(43), ImmutableString("cosh"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("cosh(vf3;"),
+     EOpCosh},
+    // vec4 cosh(vec4)
+    {TSymbolUniqueId(44), ImmutableString("cosh"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("cosh(vf4;"),
+     EOpCosh},
+    // float tanh(float)
+    {TSymbolUniqueId(45), ImmutableString("tanh"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("tanh(f1;"),
+     EOpTanh},
+    // vec2 tanh(vec2)
+    {TSymbolUniqueId(46), ImmutableString("tanh"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("tanh(vf2;"),
+     EOpTanh},
+    // vec3 tanh(vec3)
+    {TSymbolUniqueId(47), ImmutableString("tanh"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("tanh(vf3;"),
+     EOpTanh},
+    // vec4 tanh(vec4)
+    {TSymbolUniqueId(48), ImmutableString("tanh"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("tanh(vf4;"),
+     EOpTanh},
+    // float asinh(float)
+    {TSymbolUniqueId(49), ImmutableString("asinh"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("asinh(f1;"),
+     EOpAsinh},
+    // vec2 asinh(vec2)
+    {TSymbolUniqueId(50), ImmutableString("asinh"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("asinh(vf2;"),
+     EOpAsinh},
+    // vec3 asinh(vec3)
+    {TSymbolUniqueId(51), ImmutableString("asinh"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("asinh(vf3;"),
+     EOpAsinh},
+    // vec4 asinh(vec4)
+    {TSymbolUniqueId(52), ImmutableString("asinh"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("asinh(vf4;"),
+     EOpAsinh},
+    // float acosh(float)
+    {TSymbolUniqueId(53), ImmutableString("acosh"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("acosh(f1;"),
+     EOpAcosh},
+    // vec2 acosh(vec2)
+    {TSymbolUniqueId(54), ImmutableString("acosh"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("acosh(vf2;"),
+     EOpAcosh},
+    // vec3 acosh(vec3)
+    {TSymbolUniqueId(55), ImmutableString("acosh"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("acosh(vf3;"),
+     EOpAcosh},
+    // vec4 acosh(vec4)
+    {TSymbolUniqueId(56), ImmutableString("acosh"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("acosh(vf4;"),
+     EOpAcosh},
+    // float atanh(float)
+    {TSymbolUniqueId(57), ImmutableString("atanh"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("atanh(f1;"),
+     EOpAtanh},
+    // vec2 atanh(vec2)
+    {TSymbolUniqueId(58), ImmutableString("atanh"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("atanh(vf2;"),
+     EOpAtanh},
+    // vec3 atanh(vec3)
+    {TSymbolUniqueId(59), ImmutableString("atanh"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("atanh(vf3;"),
+     EOpAtanh},
+    // vec4 atanh(vec4)
+    {TSymbolUniqueId(60), ImmutableString("atanh"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("atanh(vf4;"),
+     EOpAtanh},
+    // float pow(float, float)
+    {TSymbolUniqueId(61), ImmutableString("pow"), TExtension::UNDEFINED, kParameters_f1_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("pow(f1;f1;"),
+     EOpPow},
+    // vec2 pow(vec2, vec2)
+    {TSymbolUniqueId(62), ImmutableString("pow"), TExtension::UNDEFINED, kParameters_vf2_vf2, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("pow(vf2;vf2;"),
+     EOpPow},
+    // vec3 pow(vec3, vec3)
+    {TSymbolUniqueId(63), ImmutableString("pow"), TExtension::UNDEFINED, kParameters_vf3_vf3, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("pow(vf3;vf3;"),
+     EOpPow},
+    // vec4 pow(vec4, vec4)
+    {TSymbolUniqueId(64), ImmutableString("pow"), TExtension::UNDEFINED, kParameters_vf4_vf4, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("pow(vf4;vf4;"),
+     EOpPow},
+    // float exp(float)
+    {TSymbolUniqueId(65), ImmutableString("exp"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("exp(f1;"),
+     EOpExp},
+    // vec2 exp(vec2)
+    {TSymbolUniqueId(66), ImmutableString("exp"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("exp(vf2;"),
+     EOpExp},
+    // vec3 exp(vec3)
+    {TSymbolUniqueId(67), ImmutableString("exp"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("exp(vf3;"),
+     EOpExp},
+    // vec4 exp(vec4)
+    {TSymbolUniqueId(68), ImmutableString("exp"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("exp(vf4;"),
+     EOpExp},
+    // float log(float)
+    {TSymbolUniqueId(69), ImmutableString("log"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("log(f1;"),
+     EOpLog},
+    // vec2 log(vec2)
+    {TSymbolUniqueId(70), ImmutableString("log"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("log(vf2;"),
+     EOpLog},
+    // vec3 log(vec3)
+    {TSymbolUniqueId(71), ImmutableString("log"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("log(vf3;"),
+     EOpLog},
+    // vec4 log(vec4)
+    {TSymbolUniqueId(72), ImmutableString("log"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("log(vf4;"),
+     EOpLog},
+    // float exp2(float)
+    {TSymbolUniqueId(73), ImmutableString("exp2"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("exp2(f1;"),
+     EOpExp2},
+    // vec2 exp2(vec2)
+    {TSymbolUniqueId(74), ImmutableString("exp2"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("exp2(vf2;"),
+     EOpExp2},
+    // vec3 exp2(vec3)
+    {TSymbolUniqueId(75), ImmutableString("exp2"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("exp2(vf3;"),
+     EOpExp2},
+    // vec4 exp2(vec4)
+    {TSymbolUniqueId(76), ImmutableString("exp2"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("exp2(vf4;"),
+     EOpExp2},
+    // float log2(float)
+    {TSymbolUniqueId(77), ImmutableString("log2"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("log2(f1;"),
+     EOpLog2},
+    // vec2 log2(vec2)
+    {TSymbolUniqueId(78), ImmutableString("log2"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("log2(vf2;"),
+     EOpLog2},
+    // vec3 log2(vec3)
+    {TSymbolUniqueId(79), ImmutableString("log2"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("log2(vf3;"),
+     EOpLog2},
+    // vec4 log2(vec4)
+    {TSymbolUniqueId(80), ImmutableString("log2"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("log2(vf4;"),
+     EOpLog2},
+    // float sqrt(float)
+    {TSymbolUniqueId(81), ImmutableString("sqrt"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("sqrt(f1;"),
+     EOpSqrt},
+    // vec2 sqrt(vec2)
+    {TSymbolUniqueId(82), ImmutableString("sqrt"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("sqrt(vf2;"),
+     EOpSqrt},
+    // vec3 sqrt(vec3)
+    {TSymbolUniqueId(83), ImmutableString("sqrt"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("sqrt(vf3;"),
+     EOpSqrt},
+    // vec4 sqrt(vec4)
+    {TSymbolUniqueId(84), ImmutableString("sqrt"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("sqrt(vf4;"),
+     EOpSqrt},
+    // float inversesqrt(float)
+    {TSymbolUniqueId(85), ImmutableString("inversesqrt"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("inversesqrt(f1;"),
+     EOpInverseSqrt},
+    // vec2 inversesqrt(vec2)
+    {TSymbolUniqueId(86), ImmutableString("inversesqrt"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("inversesqrt(vf2;"), EOpInverseSqrt},
+    // vec3 inversesqrt(vec3)
+    {TSymbolUniqueId(87), ImmutableString("inversesqrt"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("inversesqrt(vf3;"), EOpInverseSqrt},
+    // vec4 inversesqrt(vec4)
+    {TSymbolUniqueId(88), ImmutableString("inversesqrt"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("inversesqrt(vf4;"), EOpInverseSqrt},
+    // float abs(float)
+    {TSymbolUniqueId(89), ImmutableString("abs"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("abs(f1;"),
+     EOpAbs},
+    // vec2 abs(vec2)
+    {TSymbolUniqueId(90), ImmutableString("abs"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("abs(vf2;"),
+     EOpAbs},
+    // vec3 abs(vec3)
+    {TSymbolUniqueId(91), ImmutableString("abs"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("abs(vf3;"),
+     EOpAbs},
+    // vec4 abs(vec4)
+    {TSymbolUniqueId(92), ImmutableString("abs"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("abs(vf4;"),
+     EOpAbs},
+    // int abs(int)
+    {TSymbolUniqueId(93), ImmutableString("abs"), TExtension::UNDEFINED, kParameters_i1, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("abs(i1;"), EOpAbs},
+    // ivec2 abs(ivec2)
+    {TSymbolUniqueId(94), ImmutableString("abs"), TExtension::UNDEFINED, kParameters_vi2, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("abs(vi2;"), EOpAbs},
+    // ivec3 abs(ivec3)
+    {TSymbolUniqueId(95), ImmutableString("abs"), TExtension::UNDEFINED, kParameters_vi3, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("abs(vi3;"), EOpAbs},
+    // ivec4 abs(ivec4)
+    {TSymbolUniqueId(96), ImmutableString("abs"), TExtension::UNDEFINED, kParameters_vi4, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("abs(vi4;"), EOpAbs},
+    // float sign(float)
+    {TSymbolUniqueId(97), ImmutableString("sign"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("sign(f1;"),
+     EOpSign},
+    // vec2 sign(vec2)
+    {TSymbolUniqueId(98), ImmutableString("sign"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("sign(vf2;"),
+     EOpSign},
+    // vec3 sign(vec3)
+    {TSymbolUniqueId(99), ImmutableString("sign"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("sign(vf3;"),
+     EOpSign},
+    // vec4 sign(vec4)
+    {TSymbolUniqueId(100), ImmutableString("sign"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("sign(vf4;"),
+     EOpSign},
+    // int sign(int)
+    {TSymbolUniqueId(101), ImmutableString("sign"), TExtension::UNDEFINED, kParameters_i1, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("sign(i1;"),
+     EOpSign},
+    // ivec2 sign(ivec2)
+    {TSymbolUniqueId(102), ImmutableString("sign"), TExtension::UNDEFINED, kParameters_vi2, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("sign(vi2;"),
+     EOpSign},
+    // ivec3 sign(ivec3)
+    {TSymbolUniqueId(103), ImmutableString("sign"), TExtension::UNDEFINED, kParameters_vi3, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("sign(vi3;"),
+     EOpSign},
+    // ivec4 sign(ivec4)
+    {TSymbolUniqueId(104), ImmutableString("sign"), TExtension::UNDEFINED, kParameters_vi4, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("sign(vi4;"),
+     EOpSign},
+    // float floor(float)
+    {TSymbolUniqueId(105), ImmutableString("floor"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("floor(f1;"),
+     EOpFloor},
+    // vec2 floor(vec2)
+    {TSymbolUniqueId(106), ImmutableString("floor"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("floor(vf2;"),
+     EOpFloor},
+    // vec3 floor(vec3)
+    {TSymbolUniqueId(107), ImmutableString("floor"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("floor(vf3;"),
+     EOpFloor},
+    // vec4 floor(vec4)
+    {TSymbolUniqueId(108), ImmutableString("floor"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("floor(vf4;"),
+     EOpFloor},
+    // float trunc(float)
+    {TSymbolUniqueId(109), ImmutableString("trunc"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("trunc(f1;"),
+     EOpTrunc},
+    // vec2 trunc(vec2)
+    {TSymbolUniqueId(110), ImmutableString("trunc"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("trunc(vf2;"),
+     EOpTrunc},
+    // vec3 trunc(vec3)
+    {TSymbolUniqueId(111), ImmutableString("trunc"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("trunc(vf3;"),
+     EOpTrunc},
+    // vec4 trunc(vec4)
+    {TSymbolUniqueId(112), ImmutableString("trunc"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("trunc(vf4;"),
+     EOpTrunc},
+    // float round(float)
+    {TSymbolUniqueId(113), ImmutableString("round"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("round(f1;"),
+     EOpRound},
+    // vec2 round(vec2)
+    {TSymbolUniqueId(114), ImmutableString("round"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("round(vf2;"),
+     EOpRound},
+    // vec3 round(vec3)
+    {TSymbolUniqueId(115), ImmutableString("round"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("round(vf3;"),
+     EOpRound},
+    // vec4 round(vec4)
+    {TSymbolUniqueId(116), ImmutableString("round"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("round(vf4;"),
+     EOpRound},
+    // float roundEven(float)
+    {TSymbolUniqueId(117), ImmutableString("roundEven"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("roundEven(f1;"),
+     EOpRoundEven},
+    // vec2 roundEven(vec2)
+    {TSymbolUniqueId(118), ImmutableString("roundEven"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("roundEven(vf2;"),
+     EOpRoundEven},
+    // vec3 roundEven(vec3)
+    {TSymbolUniqueId(119), ImmutableString("roundEven"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("roundEven(vf3;"),
+     EOpRoundEven},
+    // vec4 roundEven(vec4)
+    {TSymbolUniqueId(120), ImmutableString("roundEven"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("roundEven(vf4;"),
+     EOpRoundEven},
+    // float ceil(float)
+    {TSymbolUniqueId(121), ImmutableString("ceil"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("ceil(f1;"),
+     EOpCeil},
+    // vec2 ceil(vec2)
+    {TSymbolUniqueId(122), ImmutableString("ceil"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("ceil(vf2;"),
+     EOpCeil},
+    // vec3 ceil(vec3)
+    {TSymbolUniqueId(123), ImmutableString("ceil"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("ceil(vf3;"),
+     EOpCeil},
+    // vec4 ceil(vec4)
+    {TSymbolUniqueId(124), ImmutableString("ceil"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("ceil(vf4;"),
+     EOpCeil},
+    // float fract(float)
+    {TSymbolUniqueId(125), ImmutableString("fract"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("fract(f1;"),
+     EOpFract},
+    // vec2 fract(vec2)
+    {TSymbolUniqueId(126), ImmutableString("fract"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("fract(vf2;"),
+     EOpFract},
+    // vec3 fract(vec3)
+    {TSymbolUniqueId(127), ImmutableString("fract"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("fract(vf3;"),
+     EOpFract},
+    // vec4 fract(vec4)
+    {TSymbolUniqueId(128), ImmutableString("fract"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("fract(vf4;"),
+     EOpFract},
+    // float mod(float, float)
+    {TSymbolUniqueId(129), ImmutableString("mod"), TExtension::UNDEFINED, kParameters_f1_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("mod(f1;f1;"),
+     EOpMod},
+    // vec2 mod(vec2, float)
+    {TSymbolUniqueId(130), ImmutableString("mod"), TExtension::UNDEFINED, kParameters_vf2_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("mod(vf2;f1;"),
+     EOpMod},
+    // vec3 mod(vec3, float)
+    {TSymbolUniqueId(131), ImmutableString("mod"), TExtension::UNDEFINED, kParameters_vf3_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("mod(vf3;f1;"),
+     EOpMod},
+    // vec4 mod(vec4, float)
+    {TSymbolUniqueId(132), ImmutableString("mod"), TExtension::UNDEFINED, kParameters_vf4_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("mod(vf4;f1;"),
+     EOpMod},
+    // vec2 mod(vec2, vec2)
+    {TSymbolUniqueId(133), ImmutableString("mod"), TExtension::UNDEFINED, kParameters_vf2_vf2, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("mod(vf2;vf2;"),
+     EOpMod},
+    // vec3 mod(vec3, vec3)
+    {TSymbolUniqueId(134), ImmutableString("mod"), TExtension::UNDEFINED, kParameters_vf3_vf3, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("mod(vf3;vf3;"),
+     EOpMod},
+    // vec4 mod(vec4, vec4)
+    {TSymbolUniqueId(135), ImmutableString("mod"), TExtension::UNDEFINED, kParameters_vf4_vf4, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("mod(vf4;vf4;"),
+     EOpMod},
+    // float min(float, float)
+    {TSymbolUniqueId(136), ImmutableString("min"), TExtension::UNDEFINED, kParameters_f1_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("min(f1;f1;"),
+     EOpMin},
+    // vec2 min(vec2, float)
+    {TSymbolUniqueId(137), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vf2_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("min(vf2;f1;"),
+     EOpMin},
+    // vec3 min(vec3, float)
+    {TSymbolUniqueId(138), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vf3_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("min(vf3;f1;"),
+     EOpMin},
+    // vec4 min(vec4, float)
+    {TSymbolUniqueId(139), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vf4_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("min(vf4;f1;"),
+     EOpMin},
+    // vec2 min(vec2, vec2)
+    {TSymbolUniqueId(140), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vf2_vf2, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("min(vf2;vf2;"),
+     EOpMin},
+    // vec3 min(vec3, vec3)
+    {TSymbolUniqueId(141), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vf3_vf3, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("min(vf3;vf3;"),
+     EOpMin},
+    // vec4 min(vec4, vec4)
+    {TSymbolUniqueId(142), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vf4_vf4, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("min(vf4;vf4;"),
+     EOpMin},
+    // int min(int, int)
+    {TSymbolUniqueId(143), ImmutableString("min"), TExtension::UNDEFINED, kParameters_i1_i1, 2,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("min(i1;i1;"),
+     EOpMin},
+    // ivec2 min(ivec2, ivec2)
+    {TSymbolUniqueId(144), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vi2_vi2, 2,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("min(vi2;vi2;"),
+     EOpMin},
+    // ivec3 min(ivec3, ivec3)
+    {TSymbolUniqueId(145), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vi3_vi3, 2,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("min(vi3;vi3;"),
+     EOpMin},
+    // ivec4 min(ivec4, ivec4)
+    {TSymbolUniqueId(146), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vi4_vi4, 2,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("min(vi4;vi4;"),
+     EOpMin},
+    // ivec2 min(ivec2, int)
+    {TSymbolUniqueId(147), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vi2_i1, 2,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("min(vi2;i1;"),
+     EOpMin},
+    // ivec3 min(ivec3, int)
+    {TSymbolUniqueId(148), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vi3_i1, 2,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("min(vi3;i1;"),
+     EOpMin},
+    // ivec4 min(ivec4, int)
+    {TSymbolUniqueId(149), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vi4_i1, 2,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("min(vi4;i1;"),
+     EOpMin},
+    // uint min(uint, uint)
+    {TSymbolUniqueId(150), ImmutableString("min"), TExtension::UNDEFINED, kParameters_u1_u1, 2,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("min(u1;u1;"),
+     EOpMin},
+    // uvec2 min(uvec2, uvec2)
+    {TSymbolUniqueId(151), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vu2_vu2, 2,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("min(vu2;vu2;"),
+     EOpMin},
+    // uvec3 min(uvec3, uvec3)
+    {TSymbolUniqueId(152), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vu3_vu3, 2,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("min(vu3;vu3;"),
+     EOpMin},
+    // uvec4 min(uvec4, uvec4)
+    {TSymbolUniqueId(153), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vu4_vu4, 2,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("min(vu4;vu4;"),
+     EOpMin},
+    // uvec2 min(uvec2, uint)
+    {TSymbolUniqueId(154), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vu2_u1, 2,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("min(vu2;u1;"),
+     EOpMin},
+    // uvec3 min(uvec3, uint)
+    {TSymbolUniqueId(155), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vu3_u1, 2,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("min(vu3;u1;"),
+     EOpMin},
+    // uvec4 min(uvec4, uint)
+    {TSymbolUniqueId(156), ImmutableString("min"), TExtension::UNDEFINED, kParameters_vu4_u1, 2,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("min(vu4;u1;"),
+     EOpMin},
+    // float max(float, float)
+    {TSymbolUniqueId(157), ImmutableString("max"), TExtension::UNDEFINED, kParameters_f1_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("max(f1;f1;"),
+     EOpMax},
+    // vec2 max(vec2, float)
+    {TSymbolUniqueId(158), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vf2_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("max(vf2;f1;"),
+     EOpMax},
+    // vec3 max(vec3, float)
+    {TSymbolUniqueId(159), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vf3_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("max(vf3;f1;"),
+     EOpMax},
+    // vec4 max(vec4, float)
+    {TSymbolUniqueId(160), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vf4_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("max(vf4;f1;"),
+     EOpMax},
+    // vec2 max(vec2, vec2)
+    {TSymbolUniqueId(161), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vf2_vf2, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("max(vf2;vf2;"),
+     EOpMax},
+    // vec3 max(vec3, vec3)
+    {TSymbolUniqueId(162), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vf3_vf3, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("max(vf3;vf3;"),
+     EOpMax},
+    // vec4 max(vec4, vec4)
+    {TSymbolUniqueId(163), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vf4_vf4, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("max(vf4;vf4;"),
+     EOpMax},
+    // int max(int, int)
+    {TSymbolUniqueId(164), ImmutableString("max"), TExtension::UNDEFINED, kParameters_i1_i1, 2,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("max(i1;i1;"),
+     EOpMax},
+    // ivec2 max(ivec2, ivec2)
+    {TSymbolUniqueId(165), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vi2_vi2, 2,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("max(vi2;vi2;"),
+     EOpMax},
+    // ivec3 max(ivec3, ivec3)
+    {TSymbolUniqueId(166), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vi3_vi3, 2,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("max(vi3;vi3;"),
+     EOpMax},
+    // ivec4 max(ivec4, ivec4)
+    {TSymbolUniqueId(167), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vi4_vi4, 2,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("max(vi4;vi4;"),
+     EOpMax},
+    // ivec2 max(ivec2, int)
+    {TSymbolUniqueId(168), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vi2_i1, 2,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("max(vi2;i1;"),
+     EOpMax},
+    // ivec3 max(ivec3, int)
+    {TSymbolUniqueId(169), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vi3_i1, 2,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("max(vi3;i1;"),
+     EOpMax},
+    // ivec4 max(ivec4, int)
+    {TSymbolUniqueId(170), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vi4_i1, 2,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("max(vi4;i1;"),
+     EOpMax},
+    // uint max(uint, uint)
+    {TSymbolUniqueId(171), ImmutableString("max"), TExtension::UNDEFINED, kParameters_u1_u1, 2,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("max(u1;u1;"),
+     EOpMax},
+    // uvec2 max(uvec2, uvec2)
+    {TSymbolUniqueId(172), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vu2_vu2, 2,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("max(vu2;vu2;"),
+     EOpMax},
+    // uvec3 max(uvec3, uvec3)
+    {TSymbolUniqueId(173), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vu3_vu3, 2,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("max(vu3;vu3;"),
+     EOpMax},
+    // uvec4 max(uvec4, uvec4)
+    {TSymbolUniqueId(174), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vu4_vu4, 2,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("max(vu4;vu4;"),
+     EOpMax},
+    // uvec2 max(uvec2, uint)
+    {TSymbolUniqueId(175), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vu2_u1, 2,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("max(vu2;u1;"),
+     EOpMax},
+    // uvec3 max(uvec3, uint)
+    {TSymbolUniqueId(176), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vu3_u1, 2,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("max(vu3;u1;"),
+     EOpMax},
+    // uvec4 max(uvec4, uint)
+    {TSymbolUniqueId(177), ImmutableString("max"), TExtension::UNDEFINED, kParameters_vu4_u1, 2,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("max(vu4;u1;"),
+     EOpMax},
+    // float clamp(float, float, float)
+    {TSymbolUniqueId(178), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_f1_f1_f1, 3,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("clamp(f1;f1;f1;"),
+     EOpClamp},
+    // vec2 clamp(vec2, float, float)
+    {TSymbolUniqueId(179), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vf2_f1_f1,
+     3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("clamp(vf2;f1;f1;"), EOpClamp},
+    // vec3 clamp(vec3, float, float)
+    {TSymbolUniqueId(180), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vf3_f1_f1,
+     3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("clamp(vf3;f1;f1;"), EOpClamp},
+    // vec4 clamp(vec4, float, float)
+    {TSymbolUniqueId(181), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vf4_f1_f1,
+     3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("clamp(vf4;f1;f1;"), EOpClamp},
+    // vec2 clamp(vec2, vec2, vec2)
+    {TSymbolUniqueId(182), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vf2_vf2_vf2,
+     3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("clamp(vf2;vf2;vf2;"), EOpClamp},
+    // vec3 clamp(vec3, vec3, vec3)
+    {TSymbolUniqueId(183), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vf3_vf3_vf3,
+     3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("clamp(vf3;vf3;vf3;"), EOpClamp},
+    // vec4 clamp(vec4, vec4, vec4)
+    {TSymbolUniqueId(184), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vf4_vf4_vf4,
+     3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("clamp(vf4;vf4;vf4;"), EOpClamp},
+    // int clamp(int, int, int)
+    {TSymbolUniqueId(185), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_i1_i1_i1, 3,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("clamp(i1;i1;i1;"),
+     EOpClamp},
+    // ivec2 clamp(ivec2, int, int)
+    {TSymbolUniqueId(186), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vi2_i1_i1,
+     3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("clamp(vi2;i1;i1;"), EOpClamp},
+    // ivec3 clamp(ivec3, int, int)
+    {TSymbolUniqueId(187), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vi3_i1_i1,
+     3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("clamp(vi3;i1;i1;"), EOpClamp},
+    // ivec4 clamp(ivec4, int, int)
+    {TSymbolUniqueId(188), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vi4_i1_i1,
+     3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("clamp(vi4;i1;i1;"), EOpClamp},
+    // ivec2 clamp(ivec2, ivec2, ivec2)
+    {TSymbolUniqueId(189), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vi2_vi2_vi2,
+     3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("clamp(vi2;vi2;vi2;"), EOpClamp},
+    // ivec3 clamp(ivec3, ivec3, ivec3)
+    {TSymbolUniqueId(190), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vi3_vi3_vi3,
+     3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("clamp(vi3;vi3;vi3;"), EOpClamp},
+    // ivec4 clamp(ivec4, ivec4, ivec4)
+    {TSymbolUniqueId(191), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vi4_vi4_vi4,
+     3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("clamp(vi4;vi4;vi4;"), EOpClamp},
+    // uint clamp(uint, uint, uint)
+    {TSymbolUniqueId(192), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_u1_u1_u1, 3,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("clamp(u1;u1;u1;"),
+     EOpClamp},
+    // uvec2 clamp(uvec2, uint, uint)
+    {TSymbolUniqueId(193), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vu2_u1_u1,
+     3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("clamp(vu2;u1;u1;"), EOpClamp},
+    // uvec3 clamp(uvec3, uint, uint)
+    {TSymbolUniqueId(194), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vu3_u1_u1,
+     3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("clamp(vu3;u1;u1;"), EOpClamp},
+    // uvec4 clamp(uvec4, uint, uint)
+    {TSymbolUniqueId(195), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vu4_u1_u1,
+     3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("clamp(vu4;u1;u1;"), EOpClamp},
+    // uvec2 clamp(uvec2, uvec2, uvec2)
+    {TSymbolUniqueId(196), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vu2_vu2_vu2,
+     3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("clamp(vu2;vu2;vu2;"), EOpClamp},
+    // uvec3 clamp(uvec3, uvec3, uvec3)
+    {TSymbolUniqueId(197), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vu3_vu3_vu3,
+     3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("clamp(vu3;vu3;vu3;"), EOpClamp},
+    // uvec4 clamp(uvec4, uvec4, uvec4)
+    {TSymbolUniqueId(198), ImmutableString("clamp"), TExtension::UNDEFINED, kParameters_vu4_vu4_vu4,
+     3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("clamp(vu4;vu4;vu4;"), EOpClamp},
+    // float mix(float, float, float)
+    {TSymbolUniqueId(199), ImmutableString("mix"), TExtension::UNDEFINED, kParameters_f1_f1_f1, 3,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("mix(f1;f1;f1;"),
+     EOpMix},
+    // vec2 mix(vec2, vec2, float)
+    {TSymbolUniqueId(200), ImmutableString("mix"), TExtension::UNDEFINED, kParameters_vf2_vf2_f1, 3,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("mix(vf2;vf2;f1;"),
+     EOpMix},
+    // vec3 mix(vec3, vec3, float)
+    {TSymbolUniqueId(201), ImmutableString("mix"), TExtension::UNDEFINED, kParameters_vf3_vf3_f1, 3,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("mix(vf3;vf3;f1;"),
+     EOpMix},
+    // vec4 mix(vec4, vec4, float)
+    {TSymbolUniqueId(202), ImmutableString("mix"), TExtension::UNDEFINED, kParameters_vf4_vf4_f1, 3,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("mix(vf4;vf4;f1;"),
+     EOpMix},
+    // vec2 mix(vec2, vec2, vec2)
+    {TSymbolUniqueId(203), ImmutableString("mix"), TExtension::UNDEFINED, kParameters_vf2_vf2_vf2,
+     3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("mix(vf2;vf2;vf2;"), EOpMix},
+    // vec3 mix(vec3, vec3, vec3)
+    {TSymbolUniqueId(204), ImmutableString("mix"), TExtension::UNDEFINED, kParameters_vf3_vf3_vf3,
+     3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("mix(vf3;vf3;vf3;"), EOpMix},
+    // vec4 mix(vec4, vec4, vec4)
+    {TSymbolUniqueId(205), ImmutableString("mix"), TExtension::UNDEFINED, kParameters_vf4_vf4_vf4,
+     3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("mix(vf4;vf4;vf4;"), EOpMix},
+    // float mix(float, float, bool)
+    {TSymbolUniqueId(206), ImmutableString("mix"), TExtension::UNDEFINED, kParameters_f1_f1_b1, 3,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("mix(f1;f1;b1;"),
+     EOpMix},
+    // vec2 mix(vec2, vec2, bvec2)
+    {TSymbolUniqueId(207), ImmutableString("mix"), TExtension::UNDEFINED, kParameters_vf2_vf2_vb2,
+     3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("mix(vf2;vf2;vb2;"), EOpMix},
+    // vec3 mix(vec3, vec3, bvec3)
+    {TSymbolUniqueId(208), ImmutableString("mix"), TExtension::UNDEFINED, kParameters_vf3_vf3_vb3,
+     3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("mix(vf3;vf3;vb3;"), EOpMix},
+    // vec4 mix(vec4, vec4, bvec4)
+    {TSymbolUniqueId(209), ImmutableString("mix"), TExtension::UNDEFINED, kParameters_vf4_vf4_vb4,
+     3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("mix(vf4;vf4;vb4;"), EOpMix},
+    // float step(float, float)
+    {TSymbolUniqueId(210), ImmutableString("step"), TExtension::UNDEFINED, kParameters_f1_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("step(f1;f1;"),
+     EOpStep},
+    // vec2 step(vec2, vec2)
+    {TSymbolUniqueId(211), ImmutableString("step"), TExtension::UNDEFINED, kParameters_vf2_vf2, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("step(vf2;vf2;"),
+     EOpStep},
+    // vec3 step(vec3, vec3)
+    {TSymbolUniqueId(212), ImmutableString("step"), TExtension::UNDEFINED, kParameters_vf3_vf3, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("step(vf3;vf3;"),
+     EOpStep},
+    // vec4 step(vec4, vec4)
+    {TSymbolUniqueId(213), ImmutableString("step"), TExtension::UNDEFINED, kParameters_vf4_vf4, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("step(vf4;vf4;"),
+     EOpStep},
+    // vec2 step(float, vec2)
+    {TSymbolUniqueId(214), ImmutableString("step"), TExtension::UNDEFINED, kParameters_f1_vf2, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("step(f1;vf2;"),
+     EOpStep},
+    // vec3 step(float, vec3)
+    {TSymbolUniqueId(215), ImmutableString("step"), TExtension::UNDEFINED, kParameters_f1_vf3, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("step(f1;vf3;"),
+     EOpStep},
+    // vec4 step(float, vec4)
+    {TSymbolUniqueId(216), ImmutableString("step"), TExtension::UNDEFINED, kParameters_f1_vf4, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("step(f1;vf4;"),
+     EOpStep},
+    // float smoothstep(float, float, float)
+    {TSymbolUniqueId(217), ImmutableString("smoothstep"), TExtension::UNDEFINED,
+     kParameters_f1_f1_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("smoothstep(f1;f1;f1;"), EOpSmoothStep},
+    // vec2 smoothstep(vec2, vec2, vec2)
+    {TSymbolUniqueId(218), ImmutableString("smoothstep"), TExtension::UNDEFINED,
+     kParameters_vf2_vf2_vf2, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("smoothstep(vf2;vf2;vf2;"), EOpSmoothStep},
+    // vec3 smoothstep(vec3, vec3, vec3)
+    {TSymbolUniqueId(219), ImmutableString("smoothstep"), TExtension::UNDEFINED,
+     kParameters_vf3_vf3_vf3, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("smoothstep(vf3;vf3;vf3;"), EOpSmoothStep},
+    // vec4 smoothstep(vec4, vec4, vec4)
+    {TSymbolUniqueId(220), ImmutableString("smoothstep"), TExtension::UNDEFINED,
+     kParameters_vf4_vf4_vf4, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("smoothstep(vf4;vf4;vf4;"), EOpSmoothStep},
+    // vec2 smoothstep(float, float, vec2)
+    {TSymbolUniqueId(221), ImmutableString("smoothstep"), TExtension::UNDEFINED,
+     kParameters_f1_f1_vf2, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("smoothstep(f1;f1;vf2;"), EOpSmoothStep},
+    // vec3 smoothstep(float, float, vec3)
+    {TSymbolUniqueId(222), ImmutableString("smoothstep"), TExtension::UNDEFINED,
+     kParameters_f1_f1_vf3, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("smoothstep(f1;f1;vf3;"), EOpSmoothStep},
+    // vec4 smoothstep(float, float, vec4)
+    {TSymbolUniqueId(223), ImmutableString("smoothstep"), TExtension::UNDEFINED,
+     kParameters_f1_f1_vf4, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("smoothstep(f1;f1;vf4;"), EOpSmoothStep},
+    // float modf(float, out float)
+    {TSymbolUniqueId(224), ImmutableString("modf"), TExtension::UNDEFINED, kParameters_f1_out_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("modf(f1;f1;"),
+     EOpModf},
+    // vec2 modf(vec2, out vec2)
+    {TSymbolUniqueId(225), ImmutableString("modf"), TExtension::UNDEFINED, kParameters_vf2_out_vf2,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("modf(vf2;vf2;"), EOpModf},
+    // vec3 modf(vec3, out vec3)
+    {TSymbolUniqueId(226), ImmutableString("modf"), TExtension::UNDEFINED, kParameters_vf3_out_vf3,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("modf(vf3;vf3;"), EOpModf},
+    // vec4 modf(vec4, out vec4)
+    {TSymbolUniqueId(227), ImmutableString("modf"), TExtension::UNDEFINED, kParameters_vf4_out_vf4,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("modf(vf4;vf4;"), EOpModf},
+    // bool isnan(float)
+    {TSymbolUniqueId(228), ImmutableString("isnan"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("isnan(f1;"),
+     EOpIsNan},
+    // bvec2 isnan(vec2)
+    {TSymbolUniqueId(229), ImmutableString("isnan"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("isnan(vf2;"),
+     EOpIsNan},
+    // bvec3 isnan(vec3)
+    {TSymbolUniqueId(230), ImmutableString("isnan"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("isnan(vf3;"),
+     EOpIsNan},
+    // bvec4 isnan(vec4)
+    {TSymbolUniqueId(231), ImmutableString("isnan"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("isnan(vf4;"),
+     EOpIsNan},
+    // bool isinf(float)
+    {TSymbolUniqueId(232), ImmutableString("isinf"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("isinf(f1;"),
+     EOpIsInf},
+    // bvec2 isinf(vec2)
+    {TSymbolUniqueId(233), ImmutableString("isinf"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("isinf(vf2;"),
+     EOpIsInf},
+    // bvec3 isinf(vec3)
+    {TSymbolUniqueId(234), ImmutableString("isinf"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("isinf(vf3;"),
+     EOpIsInf},
+    // bvec4 isinf(vec4)
+    {TSymbolUniqueId(235), ImmutableString("isinf"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("isinf(vf4;"),
+     EOpIsInf},
+    // int floatBitsToInt(float)
+    {TSymbolUniqueId(236), ImmutableString("floatBitsToInt"), TExtension::UNDEFINED, kParameters_f1,
+     1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("floatBitsToInt(f1;"), EOpFloatBitsToInt},
+    // ivec2 floatBitsToInt(vec2)
+    {TSymbolUniqueId(237), ImmutableString("floatBitsToInt"), TExtension::UNDEFINED,
+     kParameters_vf2, 1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("floatBitsToInt(vf2;"), EOpFloatBitsToInt},
+    // ivec3 floatBitsToInt(vec3)
+    {TSymbolUniqueId(238), ImmutableString("floatBitsToInt"), TExtension::UNDEFINED,
+     kParameters_vf3, 1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("floatBitsToInt(vf3;"), EOpFloatBitsToInt},
+    // ivec4 floatBitsToInt(vec4)
+    {TSymbolUniqueId(239), ImmutableString("floatBitsToInt"), TExtension::UNDEFINED,
+     kParameters_vf4, 1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("floatBitsToInt(vf4;"), EOpFloatBitsToInt},
+    // uint floatBitsToUint(float)
+    {TSymbolUniqueId(240), ImmutableString("floatBitsToUint"), TExtension::UNDEFINED,
+     kParameters_f1, 1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("floatBitsToUint(f1;"), EOpFloatBitsToUint},
+    // uvec2 floatBitsToUint(vec2)
+    {TSymbolUniqueId(241), ImmutableString("floatBitsToUint"), TExtension::UNDEFINED,
+     kParameters_vf2, 1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("floatBitsToUint(vf2;"), EOpFloatBitsToUint},
+    // uvec3 floatBitsToUint(vec3)
+    {TSymbolUniqueId(242), ImmutableString("floatBitsToUint"), TExtension::UNDEFINED,
+     kParameters_vf3, 1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("floatBitsToUint(vf3;"), EOpFloatBitsToUint},
+    // uvec4 floatBitsToUint(vec4)
+    {TSymbolUniqueId(243), ImmutableString("floatBitsToUint"), TExtension::UNDEFINED,
+     kParameters_vf4, 1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("floatBitsToUint(vf4;"), EOpFloatBitsToUint},
+    // float intBitsToFloat(int)
+    {TSymbolUniqueId(244), ImmutableString("intBitsToFloat"), TExtension::UNDEFINED, kParameters_i1,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("intBitsToFloat(i1;"), EOpIntBitsToFloat},
+    // vec2 intBitsToFloat(ivec2)
+    {TSymbolUniqueId(245), ImmutableString("intBitsToFloat"), TExtension::UNDEFINED,
+     kParameters_vi2, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("intBitsToFloat(vi2;"), EOpIntBitsToFloat},
+    // vec3 intBitsToFloat(ivec3)
+    {TSymbolUniqueId(246), ImmutableString("intBitsToFloat"), TExtension::UNDEFINED,
+     kParameters_vi3, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("intBitsToFloat(vi3;"), EOpIntBitsToFloat},
+    // vec4 intBitsToFloat(ivec4)
+    {TSymbolUniqueId(247), ImmutableString("intBitsToFloat"), TExtension::UNDEFINED,
+     kParameters_vi4, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("intBitsToFloat(vi4;"), EOpIntBitsToFloat},
+    // float uintBitsToFloat(uint)
+    {TSymbolUniqueId(248), ImmutableString("uintBitsToFloat"), TExtension::UNDEFINED,
+     kParameters_u1, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("uintBitsToFloat(u1;"), EOpUintBitsToFloat},
+    // vec2 uintBitsToFloat(uvec2)
+    {TSymbolUniqueId(249), ImmutableString("uintBitsToFloat"), TExtension::UNDEFINED,
+     kParameters_vu2, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("uintBitsToFloat(vu2;"), EOpUintBitsToFloat},
+    // vec3 uintBitsToFloat(uvec3)
+    {TSymbolUniqueId(250), ImmutableString("uintBitsToFloat"), TExtension::UNDEFINED,
+     kParameters_vu3, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("uintBitsToFloat(vu3;"), EOpUintBitsToFloat},
+    // vec4 uintBitsToFloat(uvec4)
+    {TSymbolUniqueId(251), ImmutableString("uintBitsToFloat"), TExtension::UNDEFINED,
+     kParameters_vu4, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("uintBitsToFloat(vu4;"), EOpUintBitsToFloat},
+    // float frexp(float, out int)
+    {TSymbolUniqueId(252), ImmutableString("frexp"), TExtension::UNDEFINED, kParameters_f1_out_i1,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("frexp(f1;i1;"),
+     EOpFrexp},
+    // vec2 frexp(vec2, out ivec2)
+    {TSymbolUniqueId(253), ImmutableString("frexp"), TExtension::UNDEFINED, kParameters_vf2_out_vi2,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("frexp(vf2;vi2;"), EOpFrexp},
+    // vec3 frexp(vec3, out ivec3)
+    {TSymbolUniqueId(254), ImmutableString("frexp"), TExtension::UNDEFINED, kParameters_vf3_out_vi3,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("frexp(vf3;vi3;"), EOpFrexp},
+    // vec4 frexp(vec4, out ivec4)
+    {TSymbolUniqueId(255), ImmutableString("frexp"), TExtension::UNDEFINED, kParameters_vf4_out_vi4,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("frexp(vf4;vi4;"), EOpFrexp},
+    // float ldexp(float, int)
+    {TSymbolUniqueId(256), ImmutableString("ldexp"), TExtension::UNDEFINED, kParameters_f1_i1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("ldexp(f1;i1;"),
+     EOpLdexp},
+    // vec2 ldexp(vec2, ivec2)
+    {TSymbolUniqueId(257), ImmutableString("ldexp"), TExtension::UNDEFINED, kParameters_vf2_vi2, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("ldexp(vf2;vi2;"),
+     EOpLdexp},
+    // vec3 ldexp(vec3, ivec3)
+    {TSymbolUniqueId(258), ImmutableString("ldexp"), TExtension::UNDEFINED, kParameters_vf3_vi3, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("ldexp(vf3;vi3;"),
+     EOpLdexp},
+    // vec4 ldexp(vec4, ivec4)
+    {TSymbolUniqueId(259), ImmutableString("ldexp"), TExtension::UNDEFINED, kParameters_vf4_vi4, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("ldexp(vf4;vi4;"),
+     EOpLdexp},
+    // uint packSnorm2x16(vec2)
+    {TSymbolUniqueId(260), ImmutableString("packSnorm2x16"), TExtension::UNDEFINED, kParameters_vf2,
+     1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("packSnorm2x16(vf2;"), EOpPackSnorm2x16},
+    // uint packUnorm2x16(vec2)
+    {TSymbolUniqueId(261), ImmutableString("packUnorm2x16"), TExtension::UNDEFINED, kParameters_vf2,
+     1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("packUnorm2x16(vf2;"), EOpPackUnorm2x16},
+    // uint packHalf2x16(vec2)
+    {TSymbolUniqueId(262), ImmutableString("packHalf2x16"), TExtension::UNDEFINED, kParameters_vf2,
+     1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("packHalf2x16(vf2;"), EOpPackHalf2x16},
+    // vec2 unpackSnorm2x16(uint)
+    {TSymbolUniqueId(263), ImmutableString("unpackSnorm2x16"), TExtension::UNDEFINED,
+     kParameters_u1, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("unpackSnorm2x16(u1;"), EOpUnpackSnorm2x16},
+    // vec2 unpackUnorm2x16(uint)
+    {TSymbolUniqueId(264), ImmutableString("unpackUnorm2x16"), TExtension::UNDEFINED,
+     kParameters_u1, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("unpackUnorm2x16(u1;"), EOpUnpackUnorm2x16},
+    // vec2 unpackHalf2x16(uint)
+    {TSymbolUniqueId(265), ImmutableString("unpackHalf2x16"), TExtension::UNDEFINED, kParameters_u1,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("unpackHalf2x16(u1;"), EOpUnpackHalf2x16},
+    // uint packUnorm4x8(vec4)
+    {TSymbolUniqueId(266), ImmutableString("packUnorm4x8"), TExtension::UNDEFINED, kParameters_vf4,
+     1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("packUnorm4x8(vf4;"), EOpPackUnorm4x8},
+    // uint packSnorm4x8(vec4)
+    {TSymbolUniqueId(267), ImmutableString("packSnorm4x8"), TExtension::UNDEFINED, kParameters_vf4,
+     1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("packSnorm4x8(vf4;"), EOpPackSnorm4x8},
+    // vec4 unpackUnorm4x8(uint)
+    {TSymbolUniqueId(268), ImmutableString("unpackUnorm4x8"), TExtension::UNDEFINED, kParameters_u1,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("unpackUnorm4x8(u1;"), EOpUnpackUnorm4x8},
+    // vec4 unpackSnorm4x8(uint)
+    {TSymbolUniqueId(269), ImmutableString("unpackSnorm4x8"), TExtension::UNDEFINED, kParameters_u1,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("unpackSnorm4x8(u1;"), EOpUnpackSnorm4x8},
+    // float length(float)
+    {TSymbolUniqueId(270), ImmutableString("length"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("length(f1;"),
+     EOpLength},
+    // float length(vec2)
+    {TSymbolUniqueId(271), ImmutableString("length"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("length(vf2;"),
+     EOpLength},
+    // float length(vec3)
+    {TSymbolUniqueId(272), ImmutableString("length"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("length(vf3;"),
+     EOpLength},
+    // float length(vec4)
+    {TSymbolUniqueId(273), ImmutableString("length"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("length(vf4;"),
+     EOpLength},
+    // float distance(float, float)
+    {TSymbolUniqueId(274), ImmutableString("distance"), TExtension::UNDEFINED, kParameters_f1_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("distance(f1;f1;"),
+     EOpDistance},
+    // float distance(vec2, vec2)
+    {TSymbolUniqueId(275), ImmutableString("distance"), TExtension::UNDEFINED, kParameters_vf2_vf2,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("distance(vf2;vf2;"), EOpDistance},
+    // float distance(vec3, vec3)
+    {TSymbolUniqueId(276), ImmutableString("distance"), TExtension::UNDEFINED, kParameters_vf3_vf3,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("distance(vf3;vf3;"), EOpDistance},
+    // float distance(vec4, vec4)
+    {TSymbolUniqueId(277), ImmutableString("distance"), TExtension::UNDEFINED, kParameters_vf4_vf4,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("distance(vf4;vf4;"), EOpDistance},
+    // float dot(float, float)
+    {TSymbolUniqueId(278), ImmutableString("dot"), TExtension::UNDEFINED, kParameters_f1_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("dot(f1;f1;"),
+     EOpDot},
+    // float dot(vec2, vec2)
+    {TSymbolUniqueId(279), ImmutableString("dot"), TExtension::UNDEFINED, kParameters_vf2_vf2, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("dot(vf2;vf2;"),
+     EOpDot},
+    // float dot(vec3, vec3)
+    {TSymbolUniqueId(280), ImmutableString("dot"), TExtension::UNDEFINED, kParameters_vf3_vf3, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("dot(vf3;vf3;"),
+     EOpDot},
+    // float dot(vec4, vec4)
+    {TSymbolUniqueId(281), ImmutableString("dot"), TExtension::UNDEFINED, kParameters_vf4_vf4, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("dot(vf4;vf4;"),
+     EOpDot},
+    // vec3 cross(vec3, vec3)
+    {TSymbolUniqueId(282), ImmutableString("cross"), TExtension::UNDEFINED, kParameters_vf3_vf3, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("cross(vf3;vf3;"),
+     EOpCross},
+    // float normalize(float)
+    {TSymbolUniqueId(283), ImmutableString("normalize"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("normalize(f1;"),
+     EOpNormalize},
+    // vec2 normalize(vec2)
+    {TSymbolUniqueId(284), ImmutableString("normalize"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("normalize(vf2;"),
+     EOpNormalize},
+    // vec3 normalize(vec3)
+    {TSymbolUniqueId(285), ImmutableString("normalize"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("normalize(vf3;"),
+     EOpNormalize},
+    // vec4 normalize(vec4)
+    {TSymbolUniqueId(286), ImmutableString("normalize"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("normalize(vf4;"),
+     EOpNormalize},
+    // float faceforward(float, float, float)
+    {TSymbolUniqueId(287), ImmutableString("faceforward"), TExtension::UNDEFINED,
+     kParameters_f1_f1_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("faceforward(f1;f1;f1;"), EOpFaceforward},
+    // vec2 faceforward(vec2, vec2, vec2)
+    {TSymbolUniqueId(288), ImmutableString("faceforward"), TExtension::UNDEFINED,
+     kParameters_vf2_vf2_vf2, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("faceforward(vf2;vf2;vf2;"), EOpFaceforward},
+    // vec3 faceforward(vec3, vec3, vec3)
+    {TSymbolUniqueId(289), ImmutableString("faceforward"), TExtension::UNDEFINED,
+     kParameters_vf3_vf3_vf3, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("faceforward(vf3;vf3;vf3;"), EOpFaceforward},
+    // vec4 faceforward(vec4, vec4, vec4)
+    {TSymbolUniqueId(290), ImmutableString("faceforward"), TExtension::UNDEFINED,
+     kParameters_vf4_vf4_vf4, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("faceforward(vf4;vf4;vf4;"), EOpFaceforward},
+    // float reflect(float, float)
+    {TSymbolUniqueId(291), ImmutableString("reflect"), TExtension::UNDEFINED, kParameters_f1_f1, 2,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("reflect(f1;f1;"),
+     EOpReflect},
+    // vec2 reflect(vec2, vec2)
+    {TSymbolUniqueId(292), ImmutableString("reflect"), TExtension::UNDEFINED, kParameters_vf2_vf2,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("reflect(vf2;vf2;"), EOpReflect},
+    // vec3 reflect(vec3, vec3)
+    {TSymbolUniqueId(293), ImmutableString("reflect"), TExtension::UNDEFINED, kParameters_vf3_vf3,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("reflect(vf3;vf3;"), EOpReflect},
+    // vec4 reflect(vec4, vec4)
+    {TSymbolUniqueId(294), ImmutableString("reflect"), TExtension::UNDEFINED, kParameters_vf4_vf4,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("reflect(vf4;vf4;"), EOpReflect},
+    // float refract(float, float, float)
+    {TSymbolUniqueId(295), ImmutableString("refract"), TExtension::UNDEFINED, kParameters_f1_f1_f1,
+     3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("refract(f1;f1;f1;"), EOpRefract},
+    // vec2 refract(vec2, vec2, float)
+    {TSymbolUniqueId(296), ImmutableString("refract"), TExtension::UNDEFINED,
+     kParameters_vf2_vf2_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("refract(vf2;vf2;f1;"), EOpRefract},
+    // vec3 refract(vec3, vec3, float)
+    {TSymbolUniqueId(297), ImmutableString("refract"), TExtension::UNDEFINED,
+     kParameters_vf3_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("refract(vf3;vf3;f1;"), EOpRefract},
+    // vec4 refract(vec4, vec4, float)
+    {TSymbolUniqueId(298), ImmutableString("refract"), TExtension::UNDEFINED,
+     kParameters_vf4_vf4_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("refract(vf4;vf4;f1;"), EOpRefract},
+    // mat2 matrixCompMult(mat2, mat2)
+    {TSymbolUniqueId(299), ImmutableString("matrixCompMult"), TExtension::UNDEFINED,
+     kParameters_mf2x2_mf2x2, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 2>(),
+     ImmutableString("matrixCompMult(mf2x2;mf2x2;"), EOpMulMatrixComponentWise},
+    // mat3 matrixCompMult(mat3, mat3)
+    {TSymbolUniqueId(300), ImmutableString("matrixCompMult"), TExtension::UNDEFINED,
+     kParameters_mf3x3_mf3x3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 3>(),
+     ImmutableString("matrixCompMult(mf3x3;mf3x3;"), EOpMulMatrixComponentWise},
+    // mat4 matrixCompMult(mat4, mat4)
+    {TSymbolUniqueId(301), ImmutableString("matrixCompMult"), TExtension::UNDEFINED,
+     kParameters_mf4x4_mf4x4, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 4>(),
+     ImmutableString("matrixCompMult(mf4x4;mf4x4;"), EOpMulMatrixComponentWise},
+    // mat2x3 matrixCompMult(mat2x3, mat2x3)
+    {TSymbolUniqueId(302), ImmutableString("matrixCompMult"), TExtension::UNDEFINED,
+     kParameters_mf2x3_mf2x3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 3>(),
+     ImmutableString("matrixCompMult(mf2x3;mf2x3;"), EOpMulMatrixComponentWise},
+    // mat3x2 matrixCompMult(mat3x2, mat3x2)
+    {TSymbolUniqueId(303), ImmutableString("matrixCompMult"), TExtension::UNDEFINED,
+     kParameters_mf3x2_mf3x2, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 2>(),
+     ImmutableString("matrixCompMult(mf3x2;mf3x2;"), EOpMulMatrixComponentWise},
+    // mat2x4 matrixCompMult(mat2x4, mat2x4)
+    {TSymbolUniqueId(304), ImmutableString("matrixCompMult"), TExtension::UNDEFINED,
+     kParameters_mf2x4_mf2x4, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 4>(),
+     ImmutableString("matrixCompMult(mf2x4;mf2x4;"), EOpMulMatrixComponentWise},
+    // mat4x2 matrixCompMult(mat4x2, mat4x2)
+    {TSymbolUniqueId(305), ImmutableString("matrixCompMult"), TExtension::UNDEFINED,
+     kParameters_mf4x2_mf4x2, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 2>(),
+     ImmutableString("matrixCompMult(mf4x2;mf4x2;"), EOpMulMatrixComponentWise},
+    // mat3x4 matrixCompMult(mat3x4, mat3x4)
+    {TSymbolUniqueId(306), ImmutableString("matrixCompMult"), TExtension::UNDEFINED,
+     kParameters_mf3x4_mf3x4, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 4>(),
+     ImmutableString("matrixCompMult(mf3x4;mf3x4;"), EOpMulMatrixComponentWise},
+    // mat4x3 matrixCompMult(mat4x3, mat4x3)
+    {TSymbolUniqueId(307), ImmutableString("matrixCompMult"), TExtension::UNDEFINED,
+     kParameters_mf4x3_mf4x3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 3>(),
+     ImmutableString("matrixCompMult(mf4x3;mf4x3;"), EOpMulMatrixComponentWise},
+    // mat2 outerProduct(vec2, vec2)
+    {TSymbolUniqueId(308), ImmutableString("outerProduct"), TExtension::UNDEFINED,
+     kParameters_vf2_vf2, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 2>(),
+     ImmutableString("outerProduct(vf2;vf2;"), EOpOuterProduct},
+    // mat3 outerProduct(vec3, vec3)
+    {TSymbolUniqueId(309), ImmutableString("outerProduct"), TExtension::UNDEFINED,
+     kParameters_vf3_vf3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 3>(),
+     ImmutableString("outerProduct(vf3;vf3;"), EOpOuterProduct},
+    // mat4 outerProduct(vec4, vec4)
+    {TSymbolUniqueId(310), ImmutableString("outerProduct"), TExtension::UNDEFINED,
+     kParameters_vf4_vf4, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 4>(),
+     ImmutableString("outerProduct(vf4;vf4;"), EOpOuterProduct},
+    // mat2x3 outerProduct(vec3, vec2)
+    {TSymbolUniqueId(311), ImmutableString("outerProduct"), TExtension::UNDEFINED,
+     kParameters_vf3_vf2, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 3>(),
+     ImmutableString("outerProduct(vf3;vf2;"), EOpOuterProduct},
+    // mat3x2 outerProduct(vec2, vec3)
+    {TSymbolUniqueId(312), ImmutableString("outerProduct"), TExtension::UNDEFINED,
+     kParameters_vf2_vf3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 2>(),
+     ImmutableString("outerProduct(vf2;vf3;"), EOpOuterProduct},
+    // mat2x4 outerProduct(vec4, vec2)
+    {TSymbolUniqueId(313), ImmutableString("outerProduct"), TExtension::UNDEFINED,
+     kParameters_vf4_vf2, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 4>(),
+     ImmutableString("outerProduct(vf4;vf2;"), EOpOuterProduct},
+    // mat4x2 outerProduct(vec2, vec4)
+    {TSymbolUniqueId(314), ImmutableString("outerProduct"), TExtension::UNDEFINED,
+     kParameters_vf2_vf4, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 2>(),
+     ImmutableString("outerProduct(vf2;vf4;"), EOpOuterProduct},
+    // mat3x4 outerProduct(vec4, vec3)
+    {TSymbolUniqueId(315), ImmutableString("outerProduct"), TExtension::UNDEFINED,
+     kParameters_vf4_vf3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 4>(),
+     ImmutableString("outerProduct(vf4;vf3;"), EOpOuterProduct},
+    // mat4x3 outerProduct(vec3, vec4)
+    {TSymbolUniqueId(316), ImmutableString("outerProduct"), TExtension::UNDEFINED,
+     kParameters_vf3_vf4, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 3>(),
+     ImmutableString("outerProduct(vf3;vf4;"), EOpOuterProduct},
+    // mat2 transpose(mat2)
+    {TSymbolUniqueId(317), ImmutableString("transpose"), TExtension::UNDEFINED, kParameters_mf2x2,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 2>(),
+     ImmutableString("transpose(mf2x2;"), EOpTranspose},
+    // mat3 transpose(mat3)
+    {TSymbolUniqueId(318), ImmutableString("transpose"), TExtension::UNDEFINED, kParameters_mf3x3,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 3>(),
+     ImmutableString("transpose(mf3x3;"), EOpTranspose},
+    // mat4 transpose(mat4)
+    {TSymbolUniqueId(319), ImmutableString("transpose"), TExtension::UNDEFINED, kParameters_mf4x4,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 4>(),
+     ImmutableString("transpose(mf4x4;"), EOpTranspose},
+    // mat2x3 transpose(mat3x2)
+    {TSymbolUniqueId(320), ImmutableString("transpose"), TExtension::UNDEFINED, kParameters_mf3x2,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 3>(),
+     ImmutableString("transpose(mf3x2;"), EOpTranspose},
+    // mat3x2 transpose(mat2x3)
+    {TSymbolUniqueId(321), ImmutableString("transpose"), TExtension::UNDEFINED, kParameters_mf2x3,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 2>(),
+     ImmutableString("transpose(mf2x3;"), EOpTranspose},
+    // mat2x4 transpose(mat4x2)
+    {TSymbolUniqueId(322), ImmutableString("transpose"), TExtension::UNDEFINED, kParameters_mf4x2,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 4>(),
+     ImmutableString("transpose(mf4x2;"), EOpTranspose},
+    // mat4x2 transpose(mat2x4)
+    {TSymbolUniqueId(323), ImmutableString("transpose"), TExtension::UNDEFINED, kParameters_mf2x4,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 2>(),
+     ImmutableString("transpose(mf2x4;"), EOpTranspose},
+    // mat3x4 transpose(mat4x3)
+    {TSymbolUniqueId(324), ImmutableString("transpose"), TExtension::UNDEFINED, kParameters_mf4x3,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 4>(),
+     ImmutableString("transpose(mf4x3;"), EOpTranspose},
+    // mat4x3 transpose(mat3x4)
+    {TSymbolUniqueId(325), ImmutableString("transpose"), TExtension::UNDEFINED, kParameters_mf3x4,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 3>(),
+     ImmutableString("transpose(mf3x4;"), EOpTranspose},
+    // float determinant(mat2)
+    {TSymbolUniqueId(326), ImmutableString("determinant"), TExtension::UNDEFINED, kParameters_mf2x2,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("determinant(mf2x2;"), EOpDeterminant},
+    // float determinant(mat3)
+    {TSymbolUniqueId(327), ImmutableString("determinant"), TExtension::UNDEFINED, kParameters_mf3x3,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("determinant(mf3x3;"), EOpDeterminant},
+    // float determinant(mat4)
+    {TSymbolUniqueId(328), ImmutableString("determinant"), TExtension::UNDEFINED, kParameters_mf4x4,
+     1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("determinant(mf4x4;"), EOpDeterminant},
+    // mat2 inverse(mat2)
+    {TSymbolUniqueId(329), ImmutableString("inverse"), TExtension::UNDEFINED, kParameters_mf2x2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 2>(), ImmutableString("inverse(mf2x2;"),
+     EOpInverse},
+    // mat3 inverse(mat3)
+    {TSymbolUniqueId(330), ImmutableString("inverse"), TExtension::UNDEFINED, kParameters_mf3x3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 3>(), ImmutableString("inverse(mf3x3;"),
+     EOpInverse},
+    // mat4 inverse(mat4)
+    {TSymbolUniqueId(331), ImmutableString("inverse"), TExtension::UNDEFINED, kParameters_mf4x4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 4>(), ImmutableString("inverse(mf4x4;"),
+     EOpInverse},
+    // bvec2 lessThan(vec2, vec2)
+    {TSymbolUniqueId(332), ImmutableString("lessThan"), TExtension::UNDEFINED, kParameters_vf2_vf2,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("lessThan(vf2;vf2;"), EOpLessThanComponentWise},
+    // bvec3 lessThan(vec3, vec3)
+    {TSymbolUniqueId(333), ImmutableString("lessThan"), TExtension::UNDEFINED, kParameters_vf3_vf3,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("lessThan(vf3;vf3;"), EOpLessThanComponentWise},
+    // bvec4 lessThan(vec4, vec4)
+    {TSymbolUniqueId(334), ImmutableString("lessThan"), TExtension::UNDEFINED, kParameters_vf4_vf4,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("lessThan(vf4;vf4;"), EOpLessThanComponentWise},
+    // bvec2 lessThan(ivec2, ivec2)
+    {TSymbolUniqueId(335), ImmutableString("lessThan"), TExtension::UNDEFINED, kParameters_vi2_vi2,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("lessThan(vi2;vi2;"), EOpLessThanComponentWise},
+    // bvec3 lessThan(ivec3, ivec3)
+    {TSymbolUniqueId(336), ImmutableString("lessThan"), TExtension::UNDEFINED, kParameters_vi3_vi3,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("lessThan(vi3;vi3;"), EOpLessThanComponentWise},
+    // bvec4 lessThan(ivec4, ivec4)
+    {TSymbolUniqueId(337), ImmutableString("lessThan"), TExtension::UNDEFINED, kParameters_vi4_vi4,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("lessThan(vi4;vi4;"), EOpLessThanComponentWise},
+    // bvec2 lessThan(uvec2, uvec2)
+    {TSymbolUniqueId(338), ImmutableString("lessThan"), TExtension::UNDEFINED, kParameters_vu2_vu2,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("lessThan(vu2;vu2;"), EOpLessThanComponentWise},
+    // bvec3 lessThan(uvec3, uvec3)
+    {TSymbolUniqueId(339), ImmutableString("lessThan"), TExtension::UNDEFINED, kParameters_vu3_vu3,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("lessThan(vu3;vu3;"), EOpLessThanComponentWise},
+    // bvec4 lessThan(uvec4, uvec4)
+    {TSymbolUniqueId(340), ImmutableString("lessThan"), TExtension::UNDEFINED, kParameters_vu4_vu4,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("lessThan(vu4;vu4;"), EOpLessThanComponentWise},
+    // bvec2 lessThanEqual(vec2, vec2)
+    {TSymbolUniqueId(341), ImmutableString("lessThanEqual"), TExtension::UNDEFINED,
+     kParameters_vf2_vf2, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("lessThanEqual(vf2;vf2;"), EOpLessThanEqualComponentWise},
+    // bvec3 lessThanEqual(vec3, vec3)
+    {TSymbolUniqueId(342), ImmutableString("lessThanEqual"), TExtension::UNDEFINED,
+     kParameters_vf3_vf3, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("lessThanEqual(vf3;vf3;"), EOpLessThanEqualComponentWise},
+    // bvec4 lessThanEqual(vec4, vec4)
+    {TSymbolUniqueId(343), ImmutableString("lessThanEqual"), TExtension::UNDEFINED,
+     kParameters_vf4_vf4, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("lessThanEqual(vf4;vf4;"), EOpLessThanEqualComponentWise},
+    // bvec2 lessThanEqual(ivec2, ivec2)
+    {TSymbolUniqueId(344), ImmutableString("lessThanEqual"), TExtension::UNDEFINED,
+     kParameters_vi2_vi2, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("lessThanEqual(vi2;vi2;"), EOpLessThanEqualComponentWise},
+    // bvec3 lessThanEqual(ivec3, ivec3)
+    {TSymbolUniqueId(345), ImmutableString("lessThanEqual"), TExtension::UNDEFINED,
+     kParameters_vi3_vi3, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("lessThanEqual(vi3;vi3;"), EOpLessThanEqualComponentWise},
+    // bvec4 lessThanEqual(ivec4, ivec4)
+    {TSymbolUniqueId(346), ImmutableString("lessThanEqual"), TExtension::UNDEFINED,
+     kParameters_vi4_vi4, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("lessThanEqual(vi4;vi4;"), EOpLessThanEqualComponentWise},
+    // bvec2 lessThanEqual(uvec2, uvec2)
+    {TSymbolUniqueId(347), ImmutableString("lessThanEqual"), TExtension::UNDEFINED,
+     kParameters_vu2_vu2, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("lessThanEqual(vu2;vu2;"), EOpLessThanEqualComponentWise},
+    // bvec3 lessThanEqual(uvec3, uvec3)
+    {TSymbolUniqueId(348), ImmutableString("lessThanEqual"), TExtension::UNDEFINED,
+     kParameters_vu3_vu3, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("lessThanEqual(vu3;vu3;"), EOpLessThanEqualComponentWise},
+    // bvec4 lessThanEqual(uvec4, uvec4)
+    {TSymbolUniqueId(349), ImmutableString("lessThanEqual"), TExtension::UNDEFINED,
+     kParameters_vu4_vu4, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("lessThanEqual(vu4;vu4;"), EOpLessThanEqualComponentWise},
+    // bvec2 greaterThan(vec2, vec2)
+    {TSymbolUniqueId(350), ImmutableString("greaterThan"), TExtension::UNDEFINED,
+     kParameters_vf2_vf2, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("greaterThan(vf2;vf2;"), EOpGreaterThanComponentWise},
+    // bvec3 greaterThan(vec3, vec3)
+    {TSymbolUniqueId(351), ImmutableString("greaterThan"), TExtension::UNDEFINED,
+     kParameters_vf3_vf3, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("greaterThan(vf3;vf3;"), EOpGreaterThanComponentWise},
+    // bvec4 greaterThan(vec4, vec4)
+    {TSymbolUniqueId(352), ImmutableString("greaterThan"), TExtension::UNDEFINED,
+     kParameters_vf4_vf4, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("greaterThan(vf4;vf4;"), EOpGreaterThanComponentWise},
+    // bvec2 greaterThan(ivec2, ivec2)
+    {TSymbolUniqueId(353), ImmutableString("greaterThan"), TExtension::UNDEFINED,
+     kParameters_vi2_vi2, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("greaterThan(vi2;vi2;"), EOpGreaterThanComponentWise},
+    // bvec3 greaterThan(ivec3, ivec3)
+    {TSymbolUniqueId(354), ImmutableString("greaterThan"), TExtension::UNDEFINED,
+     kParameters_vi3_vi3, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("greaterThan(vi3;vi3;"), EOpGreaterThanComponentWise},
+    // bvec4 greaterThan(ivec4, ivec4)
+    {TSymbolUniqueId(355), ImmutableString("greaterThan"), TExtension::UNDEFINED,
+     kParameters_vi4_vi4, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("greaterThan(vi4;vi4;"), EOpGreaterThanComponentWise},
+    // bvec2 greaterThan(uvec2, uvec2)
+    {TSymbolUniqueId(356), ImmutableString("greaterThan"), TExtension::UNDEFINED,
+     kParameters_vu2_vu2, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("greaterThan(vu2;vu2;"), EOpGreaterThanComponentWise},
+    // bvec3 greaterThan(uvec3, uvec3)
+    {TSymbolUniqueId(357), ImmutableString("greaterThan"), TExtension::UNDEFINED,
+     kParameters_vu3_vu3, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("greaterThan(vu3;vu3;"), EOpGreaterThanComponentWise},
+    // bvec4 greaterThan(uvec4, uvec4)
+    {TSymbolUniqueId(358), ImmutableString("greaterThan"), TExtension::UNDEFINED,
+     kParameters_vu4_vu4, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("greaterThan(vu4;vu4;"), EOpGreaterThanComponentWise},
+    // bvec2 greaterThanEqual(vec2, vec2)
+    {TSymbolUniqueId(359), ImmutableString("greaterThanEqual"), TExtension::UNDEFINED,
+     kParameters_vf2_vf2, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("greaterThanEqual(vf2;vf2;"), EOpGreaterThanEqualComponentWise},
+    // bvec3 greaterThanEqual(vec3, vec3)
+    {TSymbolUniqueId(360), ImmutableString("greaterThanEqual"), TExtension::UNDEFINED,
+     kParameters_vf3_vf3, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("greaterThanEqual(vf3;vf3;"), EOpGreaterThanEqualComponentWise},
+    // bvec4 greaterThanEqual(vec4, vec4)
+    {TSymbolUniqueId(361), ImmutableString("greaterThanEqual"), TExtension::UNDEFINED,
+     kParameters_vf4_vf4, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("greaterThanEqual(vf4;vf4;"), EOpGreaterThanEqualComponentWise},
+    // bvec2 greaterThanEqual(ivec2, ivec2)
+    {TSymbolUniqueId(362), ImmutableString("greaterThanEqual"), TExtension::UNDEFINED,
+     kParameters_vi2_vi2, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("greaterThanEqual(vi2;vi2;"), EOpGreaterThanEqualComponentWise},
+    // bvec3 greaterThanEqual(ivec3, ivec3)
+    {TSymbolUniqueId(363), ImmutableString("greaterThanEqual"), TExtension::UNDEFINED,
+     kParameters_vi3_vi3, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("greaterThanEqual(vi3;vi3;"), EOpGreaterThanEqualComponentWise},
+    // bvec4 greaterThanEqual(ivec4, ivec4)
+    {TSymbolUniqueId(364), ImmutableString("greaterThanEqual"), TExtension::UNDEFINED,
+     kParameters_vi4_vi4, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("greaterThanEqual(vi4;vi4;"), EOpGreaterThanEqualComponentWise},
+    // bvec2 greaterThanEqual(uvec2, uvec2)
+    {TSymbolUniqueId(365), ImmutableString("greaterThanEqual"), TExtension::UNDEFINED,
+     kParameters_vu2_vu2, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("greaterThanEqual(vu2;vu2;"), EOpGreaterThanEqualComponentWise},
+    // bvec3 greaterThanEqual(uvec3, uvec3)
+    {TSymbolUniqueId(366), ImmutableString("greaterThanEqual"), TExtension::UNDEFINED,
+     kParameters_vu3_vu3, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("greaterThanEqual(vu3;vu3;"), EOpGreaterThanEqualComponentWise},
+    // bvec4 greaterThanEqual(uvec4, uvec4)
+    {TSymbolUniqueId(367), ImmutableString("greaterThanEqual"), TExtension::UNDEFINED,
+     kParameters_vu4_vu4, 2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("greaterThanEqual(vu4;vu4;"), EOpGreaterThanEqualComponentWise},
+    // bvec2 equal(vec2, vec2)
+    {TSymbolUniqueId(368), ImmutableString("equal"), TExtension::UNDEFINED, kParameters_vf2_vf2, 2,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("equal(vf2;vf2;"),
+     EOpEqualComponentWise},
+    // bvec3 equal(vec3, vec3)
+    {TSymbolUniqueId(369), ImmutableString("equal"), TExtension::UNDEFINED, kParameters_vf3_vf3, 2,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("equal(vf3;vf3;"),
+     EOpEqualComponentWise},
+    // bvec4 equal(vec4, vec4)
+    {TSymbolUniqueId(370), ImmutableString("equal"), TExtension::UNDEFINED, kParameters_vf4_vf4, 2,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("equal(vf4;vf4;"),
+     EOpEqualComponentWise},
+    // bvec2 equal(ivec2, ivec2)
+    {TSymbolUniqueId(371), ImmutableString("equal"), TExtension::UNDEFINED, kParameters_vi2_vi2, 2,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("equal(vi2;vi2;"),
+     EOpEqualComponentWise},
+    // bvec3 equal(ivec3, ivec3)
+    {TSymbolUniqueId(372), ImmutableString("equal"), TExtension::UNDEFINED, kParameters_vi3_vi3, 2,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("equal(vi3;vi3;"),
+     EOpEqualComponentWise},
+    // bvec4 equal(ivec4, ivec4)
+    {TSymbolUniqueId(373), ImmutableString("equal"), TExtension::UNDEFINED, kParameters_vi4_vi4, 2,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("equal(vi4;vi4;"),
+     EOpEqualComponentWise},
+    // bvec2 equal(uvec2, uvec2)
+    {TSymbolUniqueId(374), ImmutableString("equal"), TExtension::UNDEFINED, kParameters_vu2_vu2, 2,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("equal(vu2;vu2;"),
+     EOpEqualComponentWise},
+    // bvec3 equal(uvec3, uvec3)
+    {TSymbolUniqueId(375), ImmutableString("equal"), TExtension::UNDEFINED, kParameters_vu3_vu3, 2,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("equal(vu3;vu3;"),
+     EOpEqualComponentWise},
+    // bvec4 equal(uvec4, uvec4)
+    {TSymbolUniqueId(376), ImmutableString("equal"), TExtension::UNDEFINED, kParameters_vu4_vu4, 2,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("equal(vu4;vu4;"),
+     EOpEqualComponentWise},
+    // bvec2 equal(bvec2, bvec2)
+    {TSymbolUniqueId(377), ImmutableString("equal"), TExtension::UNDEFINED, kParameters_vb2_vb2, 2,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("equal(vb2;vb2;"),
+     EOpEqualComponentWise},
+    // bvec3 equal(bvec3, bvec3)
+    {TSymbolUniqueId(378), ImmutableString("equal"), TExtension::UNDEFINED, kParameters_vb3_vb3, 2,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("equal(vb3;vb3;"),
+     EOpEqualComponentWise},
+    // bvec4 equal(bvec4, bvec4)
+    {TSymbolUniqueId(379), ImmutableString("equal"), TExtension::UNDEFINED, kParameters_vb4_vb4, 2,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("equal(vb4;vb4;"),
+     EOpEqualComponentWise},
+    // bvec2 notEqual(vec2, vec2)
+    {TSymbolUniqueId(380), ImmutableString("notEqual"), TExtension::UNDEFINED, kParameters_vf2_vf2,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("notEqual(vf2;vf2;"), EOpNotEqualComponentWise},
+    // bvec3 notEqual(vec3, vec3)
+    {TSymbolUniqueId(381), ImmutableString("notEqual"), TExtension::UNDEFINED, kParameters_vf3_vf3,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("notEqual(vf3;vf3;"), EOpNotEqualComponentWise},
+    // bvec4 notEqual(vec4, vec4)
+    {TSymbolUniqueId(382), ImmutableString("notEqual"), TExtension::UNDEFINED, kParameters_vf4_vf4,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("notEqual(vf4;vf4;"), EOpNotEqualComponentWise},
+    // bvec2 notEqual(ivec2, ivec2)
+    {TSymbolUniqueId(383), ImmutableString("notEqual"), TExtension::UNDEFINED, kParameters_vi2_vi2,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("notEqual(vi2;vi2;"), EOpNotEqualComponentWise},
+    // bvec3 notEqual(ivec3, ivec3)
+    {TSymbolUniqueId(384), ImmutableString("notEqual"), TExtension::UNDEFINED, kParameters_vi3_vi3,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("notEqual(vi3;vi3;"), EOpNotEqualComponentWise},
+    // bvec4 notEqual(ivec4, ivec4)
+    {TSymbolUniqueId(385), ImmutableString("notEqual"), TExtension::UNDEFINED, kParameters_vi4_vi4,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("notEqual(vi4;vi4;"), EOpNotEqualComponentWise},
+    // bvec2 notEqual(uvec2, uvec2)
+    {TSymbolUniqueId(386), ImmutableString("notEqual"), TExtension::UNDEFINED, kParameters_vu2_vu2,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("notEqual(vu2;vu2;"), EOpNotEqualComponentWise},
+    // bvec3 notEqual(uvec3, uvec3)
+    {TSymbolUniqueId(387), ImmutableString("notEqual"), TExtension::UNDEFINED, kParameters_vu3_vu3,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("notEqual(vu3;vu3;"), EOpNotEqualComponentWise},
+    // bvec4 notEqual(uvec4, uvec4)
+    {TSymbolUniqueId(388), ImmutableString("notEqual"), TExtension::UNDEFINED, kParameters_vu4_vu4,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("notEqual(vu4;vu4;"), EOpNotEqualComponentWise},
+    // bvec2 notEqual(bvec2, bvec2)
+    {TSymbolUniqueId(389), ImmutableString("notEqual"), TExtension::UNDEFINED, kParameters_vb2_vb2,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("notEqual(vb2;vb2;"), EOpNotEqualComponentWise},
+    // bvec3 notEqual(bvec3, bvec3)
+    {TSymbolUniqueId(390), ImmutableString("notEqual"), TExtension::UNDEFINED, kParameters_vb3_vb3,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("notEqual(vb3;vb3;"), EOpNotEqualComponentWise},
+    // bvec4 notEqual(bvec4, bvec4)
+    {TSymbolUniqueId(391), ImmutableString("notEqual"), TExtension::UNDEFINED, kParameters_vb4_vb4,
+     2, StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("notEqual(vb4;vb4;"), EOpNotEqualComponentWise},
+    // bool any(bvec2)
+    {TSymbolUniqueId(392), ImmutableString("any"), TExtension::UNDEFINED, kParameters_vb2, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("any(vb2;"),
+     EOpAny},
+    // bool any(bvec3)
+    {TSymbolUniqueId(393), ImmutableString("any"), TExtension::UNDEFINED, kParameters_vb3, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("any(vb3;"),
+     EOpAny},
+    // bool any(bvec4)
+    {TSymbolUniqueId(394), ImmutableString("any"), TExtension::UNDEFINED, kParameters_vb4, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("any(vb4;"),
+     EOpAny},
+    // bool all(bvec2)
+    {TSymbolUniqueId(395), ImmutableString("all"), TExtension::UNDEFINED, kParameters_vb2, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("all(vb2;"),
+     EOpAll},
+    // bool all(bvec3)
+    {TSymbolUniqueId(396), ImmutableString("all"), TExtension::UNDEFINED, kParameters_vb3, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("all(vb3;"),
+     EOpAll},
+    // bool all(bvec4)
+    {TSymbolUniqueId(397), ImmutableString("all"), TExtension::UNDEFINED, kParameters_vb4, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("all(vb4;"),
+     EOpAll},
+    // bvec2 not(bvec2)
+    {TSymbolUniqueId(398), ImmutableString("not"), TExtension::UNDEFINED, kParameters_vb2, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("not(vb2;"),
+     EOpLogicalNotComponentWise},
+    // bvec3 not(bvec3)
+    {TSymbolUniqueId(399), ImmutableString("not"), TExtension::UNDEFINED, kParameters_vb3, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("not(vb3;"),
+     EOpLogicalNotComponentWise},
+    // bvec4 not(bvec4)
+    {TSymbolUniqueId(400), ImmutableString("not"), TExtension::UNDEFINED, kParameters_vb4, 1,
+     StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("not(vb4;"),
+     EOpLogicalNotComponentWise},
+    // int bitfieldExtract(int, int, int)
+    {TSymbolUniqueId(401), ImmutableString("bitfieldExtract"), TExtension::UNDEFINED,
+     kParameters_i1_i1_i1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("bitfieldExtract(i1;i1;i1;"), EOpBitfieldExtract},
+    // ivec2 bitfieldExtract(ivec2, int, int)
+    {TSymbolUniqueId(402), ImmutableString("bitfieldExtract"), TExtension::UNDEFINED,
+     kParameters_vi2_i1_i1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("bitfieldExtract(vi2;i1;i1;"), EOpBitfieldExtract},
+    // ivec3 bitfieldExtract(ivec3, int, int)
+    {TSymbolUniqueId(403), ImmutableString("bitfieldExtract"), TExtension::UNDEFINED,
+     kParameters_vi3_i1_i1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("bitfieldExtract(vi3;i1;i1;"), EOpBitfieldExtract},
+    // ivec4 bitfieldExtract(ivec4, int, int)
+    {TSymbolUniqueId(404), ImmutableString("bitfieldExtract"), TExtension::UNDEFINED,
+     kParameters_vi4_i1_i1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("bitfieldExtract(vi4;i1;i1;"), EOpBitfieldExtract},
+    // uint bitfieldExtract(uint, int, int)
+    {TSymbolUniqueId(405), ImmutableString("bitfieldExtract"), TExtension::UNDEFINED,
+     kParameters_u1_i1_i1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("bitfieldExtract(u1;i1;i1;"), EOpBitfieldExtract},
+    // uvec2 bitfieldExtract(uvec2, int, int)
+    {TSymbolUniqueId(406), ImmutableString("bitfieldExtract"), TExtension::UNDEFINED,
+     kParameters_vu2_i1_i1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("bitfieldExtract(vu2;i1;i1;"), EOpBitfieldExtract},
+    // uvec3 bitfieldExtract(uvec3, int, int)
+    {TSymbolUniqueId(407), ImmutableString("bitfieldExtract"), TExtension::UNDEFINED,
+     kParameters_vu3_i1_i1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("bitfieldExtract(vu3;i1;i1;"), EOpBitfieldExtract},
+    // uvec4 bitfieldExtract(uvec4, int, int)
+    {TSymbolUniqueId(408), ImmutableString("bitfieldExtract"), TExtension::UNDEFINED,
+     kParameters_vu4_i1_i1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("bitfieldExtract(vu4;i1;i1;"), EOpBitfieldExtract},
+    // int bitfieldInsert(int, int, int, int)
+    {TSymbolUniqueId(409), ImmutableString("bitfieldInsert"), TExtension::UNDEFINED,
+     kParameters_i1_i1_i1_i1, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("bitfieldInsert(i1;i1;i1;i1;"), EOpBitfieldInsert},
+    // ivec2 bitfieldInsert(ivec2, ivec2, int, int)
+    {TSymbolUniqueId(410), ImmutableString("bitfieldInsert"), TExtension::UNDEFINED,
+     kParameters_vi2_vi2_i1_i1, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("bitfieldInsert(vi2;vi2;i1;i1;"), EOpBitfieldInsert},
+    // ivec3 bitfieldInsert(ivec3, ivec3, int, int)
+    {TSymbolUniqueId(411), ImmutableString("bitfieldInsert"), TExtension::UNDEFINED,
+     kParameters_vi3_vi3_i1_i1, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("bitfieldInsert(vi3;vi3;i1;i1;"), EOpBitfieldInsert},
+    // ivec4 bitfieldInsert(ivec4, ivec4, int, int)
+    {TSymbolUniqueId(412), ImmutableString("bitfieldInsert"), TExtension::UNDEFINED,
+     kParameters_vi4_vi4_i1_i1, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("bitfieldInsert(vi4;vi4;i1;i1;"), EOpBitfieldInsert},
+    // uint bitfieldInsert(uint, uint, int, int)
+    {TSymbolUniqueId(413), ImmutableString("bitfieldInsert"), TExtension::UNDEFINED,
+     kParameters_u1_u1_i1_i1, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("bitfieldInsert(u1;u1;i1;i1;"), EOpBitfieldInsert},
+    // uvec2 bitfieldInsert(uvec2, uvec2, int, int)
+    {TSymbolUniqueId(414), ImmutableString("bitfieldInsert"), TExtension::UNDEFINED,
+     kParameters_vu2_vu2_i1_i1, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("bitfieldInsert(vu2;vu2;i1;i1;"), EOpBitfieldInsert},
+    // uvec3 bitfieldInsert(uvec3, uvec3, int, int)
+    {TSymbolUniqueId(415), ImmutableString("bitfieldInsert"), TExtension::UNDEFINED,
+     kParameters_vu3_vu3_i1_i1, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("bitfieldInsert(vu3;vu3;i1;i1;"), EOpBitfieldInsert},
+    // uvec4 bitfieldInsert(uvec4, uvec4, int, int)
+    {TSymbolUniqueId(416), ImmutableString("bitfieldInsert"), TExtension::UNDEFINED,
+     kParameters_vu4_vu4_i1_i1, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("bitfieldInsert(vu4;vu4;i1;i1;"), EOpBitfieldInsert},
+    // int bitfieldReverse(int)
+    {TSymbolUniqueId(417), ImmutableString("bitfieldReverse"), TExtension::UNDEFINED,
+     kParameters_i1, 1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("bitfieldReverse(i1;"), EOpBitfieldReverse},
+    // ivec2 bitfieldReverse(ivec2)
+    {TSymbolUniqueId(418), ImmutableString("bitfieldReverse"), TExtension::UNDEFINED,
+     kParameters_vi2, 1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("bitfieldReverse(vi2;"), EOpBitfieldReverse},
+    // ivec3 bitfieldReverse(ivec3)
+    {TSymbolUniqueId(419), ImmutableString("bitfieldReverse"), TExtension::UNDEFINED,
+     kParameters_vi3, 1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("bitfieldReverse(vi3;"), EOpBitfieldReverse},
+    // ivec4 bitfieldReverse(ivec4)
+    {TSymbolUniqueId(420), ImmutableString("bitfieldReverse"), TExtension::UNDEFINED,
+     kParameters_vi4, 1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("bitfieldReverse(vi4;"), EOpBitfieldReverse},
+    // uint bitfieldReverse(uint)
+    {TSymbolUniqueId(421), ImmutableString("bitfieldReverse"), TExtension::UNDEFINED,
+     kParameters_u1, 1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("bitfieldReverse(u1;"), EOpBitfieldReverse},
+    // uvec2 bitfieldReverse(uvec2)
+    {TSymbolUniqueId(422), ImmutableString("bitfieldReverse"), TExtension::UNDEFINED,
+     kParameters_vu2, 1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("bitfieldReverse(vu2;"), EOpBitfieldReverse},
+    // uvec3 bitfieldReverse(uvec3)
+    {TSymbolUniqueId(423), ImmutableString("bitfieldReverse"), TExtension::UNDEFINED,
+     kParameters_vu3, 1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("bitfieldReverse(vu3;"), EOpBitfieldReverse},
+    // uvec4 bitfieldReverse(uvec4)
+    {TSymbolUniqueId(424), ImmutableString("bitfieldReverse"), TExtension::UNDEFINED,
+     kParameters_vu4, 1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("bitfieldReverse(vu4;"), EOpBitfieldReverse},
+    // int bitCount(int)
+    {TSymbolUniqueId(425), ImmutableString("bitCount"), TExtension::UNDEFINED, kParameters_i1, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("bitCount(i1;"),
+     EOpBitCount},
+    // ivec2 bitCount(ivec2)
+    {TSymbolUniqueId(426), ImmutableString("bitCount"), TExtension::UNDEFINED, kParameters_vi2, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("bitCount(vi2;"),
+     EOpBitCount},
+    // ivec3 bitCount(ivec3)
+    {TSymbolUniqueId(427), ImmutableString("bitCount"), TExtension::UNDEFINED, kParameters_vi3, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("bitCount(vi3;"),
+     EOpBitCount},
+    // ivec4 bitCount(ivec4)
+    {TSymbolUniqueId(428), ImmutableString("bitCount"), TExtension::UNDEFINED, kParameters_vi4, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("bitCount(vi4;"),
+     EOpBitCount},
+    // int bitCount(uint)
+    {TSymbolUniqueId(429), ImmutableString("bitCount"), TExtension::UNDEFINED, kParameters_u1, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("bitCount(u1;"),
+     EOpBitCount},
+    // ivec2 bitCount(uvec2)
+    {TSymbolUniqueId(430), ImmutableString("bitCount"), TExtension::UNDEFINED, kParameters_vu2, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("bitCount(vu2;"),
+     EOpBitCount},
+    // ivec3 bitCount(uvec3)
+    {TSymbolUniqueId(431), ImmutableString("bitCount"), TExtension::UNDEFINED, kParameters_vu3, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("bitCount(vu3;"),
+     EOpBitCount},
+    // ivec4 bitCount(uvec4)
+    {TSymbolUniqueId(432), ImmutableString("bitCount"), TExtension::UNDEFINED, kParameters_vu4, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("bitCount(vu4;"),
+     EOpBitCount},
+    // int findLSB(int)
+    {TSymbolUniqueId(433), ImmutableString("findLSB"), TExtension::UNDEFINED, kParameters_i1, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("findLSB(i1;"),
+     EOpFindLSB},
+    // ivec2 findLSB(ivec2)
+    {TSymbolUniqueId(434), ImmutableString("findLSB"), TExtension::UNDEFINED, kParameters_vi2, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("findLSB(vi2;"),
+     EOpFindLSB},
+    // ivec3 findLSB(ivec3)
+    {TSymbolUniqueId(435), ImmutableString("findLSB"), TExtension::UNDEFINED, kParameters_vi3, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("findLSB(vi3;"),
+     EOpFindLSB},
+    // ivec4 findLSB(ivec4)
+    {TSymbolUniqueId(436), ImmutableString("findLSB"), TExtension::UNDEFINED, kParameters_vi4, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("findLSB(vi4;"),
+     EOpFindLSB},
+    // int findLSB(uint)
+    {TSymbolUniqueId(437), ImmutableString("findLSB"), TExtension::UNDEFINED, kParameters_u1, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("findLSB(u1;"),
+     EOpFindLSB},
+    // ivec2 findLSB(uvec2)
+    {TSymbolUniqueId(438), ImmutableString("findLSB"), TExtension::UNDEFINED, kParameters_vu2, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("findLSB(vu2;"),
+     EOpFindLSB},
+    // ivec3 findLSB(uvec3)
+    {TSymbolUniqueId(439), ImmutableString("findLSB"), TExtension::UNDEFINED, kParameters_vu3, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("findLSB(vu3;"),
+     EOpFindLSB},
+    // ivec4 findLSB(uvec4)
+    {TSymbolUniqueId(440), ImmutableString("findLSB"), TExtension::UNDEFINED, kParameters_vu4, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("findLSB(vu4;"),
+     EOpFindLSB},
+    // int findMSB(int)
+    {TSymbolUniqueId(441), ImmutableString("findMSB"), TExtension::UNDEFINED, kParameters_i1, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("findMSB(i1;"),
+     EOpFindMSB},
+    // ivec2 findMSB(ivec2)
+    {TSymbolUniqueId(442), ImmutableString("findMSB"), TExtension::UNDEFINED, kParameters_vi2, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("findMSB(vi2;"),
+     EOpFindMSB},
+    // ivec3 findMSB(ivec3)
+    {TSymbolUniqueId(443), ImmutableString("findMSB"), TExtension::UNDEFINED, kParameters_vi3, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("findMSB(vi3;"),
+     EOpFindMSB},
+    // ivec4 findMSB(ivec4)
+    {TSymbolUniqueId(444), ImmutableString("findMSB"), TExtension::UNDEFINED, kParameters_vi4, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("findMSB(vi4;"),
+     EOpFindMSB},
+    // int findMSB(uint)
+    {TSymbolUniqueId(445), ImmutableString("findMSB"), TExtension::UNDEFINED, kParameters_u1, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("findMSB(u1;"),
+     EOpFindMSB},
+    // ivec2 findMSB(uvec2)
+    {TSymbolUniqueId(446), ImmutableString("findMSB"), TExtension::UNDEFINED, kParameters_vu2, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("findMSB(vu2;"),
+     EOpFindMSB},
+    // ivec3 findMSB(uvec3)
+    {TSymbolUniqueId(447), ImmutableString("findMSB"), TExtension::UNDEFINED, kParameters_vu3, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("findMSB(vu3;"),
+     EOpFindMSB},
+    // ivec4 findMSB(uvec4)
+    {TSymbolUniqueId(448), ImmutableString("findMSB"), TExtension::UNDEFINED, kParameters_vu4, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("findMSB(vu4;"),
+     EOpFindMSB},
+    // uint uaddCarry(uint, uint, out uint)
+    {TSymbolUniqueId(449), ImmutableString("uaddCarry"), TExtension::UNDEFINED,
+     kParameters_u1_u1_out_u1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("uaddCarry(u1;u1;u1;"), EOpUaddCarry},
+    // uvec2 uaddCarry(uvec2, uvec2, out uvec2)
+    {TSymbolUniqueId(450), ImmutableString("uaddCarry"), TExtension::UNDEFINED,
+     kParameters_vu2_vu2_out_vu2, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("uaddCarry(vu2;vu2;vu2;"), EOpUaddCarry},
+    // uvec3 uaddCarry(uvec3, uvec3, out uvec3)
+    {TSymbolUniqueId(451), ImmutableString("uaddCarry"), TExtension::UNDEFINED,
+     kParameters_vu3_vu3_out_vu3, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("uaddCarry(vu3;vu3;vu3;"), EOpUaddCarry},
+    // uvec4 uaddCarry(uvec4, uvec4, out uvec4)
+    {TSymbolUniqueId(452), ImmutableString("uaddCarry"), TExtension::UNDEFINED,
+     kParameters_vu4_vu4_out_vu4, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("uaddCarry(vu4;vu4;vu4;"), EOpUaddCarry},
+    // uint usubBorrow(uint, uint, out uint)
+    {TSymbolUniqueId(453), ImmutableString("usubBorrow"), TExtension::UNDEFINED,
+     kParameters_u1_u1_out_u1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("usubBorrow(u1;u1;u1;"), EOpUsubBorrow},
+    // uvec2 usubBorrow(uvec2, uvec2, out uvec2)
+    {TSymbolUniqueId(454), ImmutableString("usubBorrow"), TExtension::UNDEFINED,
+     kParameters_vu2_vu2_out_vu2, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("usubBorrow(vu2;vu2;vu2;"), EOpUsubBorrow},
+    // uvec3 usubBorrow(uvec3, uvec3, out uvec3)
+    {TSymbolUniqueId(455), ImmutableString("usubBorrow"), TExtension::UNDEFINED,
+     kParameters_vu3_vu3_out_vu3, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("usubBorrow(vu3;vu3;vu3;"), EOpUsubBorrow},
+    // uvec4 usubBorrow(uvec4, uvec4, out uvec4)
+    {TSymbolUniqueId(456), ImmutableString("usubBorrow"), TExtension::UNDEFINED,
+     kParameters_vu4_vu4_out_vu4, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("usubBorrow(vu4;vu4;vu4;"), EOpUsubBorrow},
+    // void umulExtended(uint, uint, out uint, out uint)
+    {TSymbolUniqueId(457), ImmutableString("umulExtended"), TExtension::UNDEFINED,
+     kParameters_u1_u1_out_u1_out_u1, 4, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("umulExtended(u1;u1;u1;u1;"), EOpUmulExtended},
+    // void umulExtended(uvec2, uvec2, out uvec2, out uvec2)
+    {TSymbolUniqueId(458), ImmutableString("umulExtended"), TExtension::UNDEFINED,
+     kParameters_vu2_vu2_out_vu2_out_vu2, 4,
+     StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("umulExtended(vu2;vu2;vu2;vu2;"), EOpUmulExtended},
+    // void umulExtended(uvec3, uvec3, out uvec3, out uvec3)
+    {TSymbolUniqueId(459), ImmutableString("umulExtended"), TExtension::UNDEFINED,
+     kParameters_vu3_vu3_out_vu3_out_vu3, 4,
+     StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("umulExtended(vu3;vu3;vu3;vu3;"), EOpUmulExtended},
+    // void umulExtended(uvec4, uvec4, out uvec4, out uvec4)
+    {TSymbolUniqueId(460), ImmutableString("umulExtended"), TExtension::UNDEFINED,
+     kParameters_vu4_vu4_out_vu4_out_vu4, 4,
+     StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("umulExtended(vu4;vu4;vu4;vu4;"), EOpUmulExtended},
+    // void imulExtended(int, int, out int, out int)
+    {TSymbolUniqueId(461), ImmutableString("imulExtended"), TExtension::UNDEFINED,
+     kParameters_i1_i1_out_i1_out_i1, 4, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imulExtended(i1;i1;i1;i1;"), EOpImulExtended},
+    // void imulExtended(ivec2, ivec2, out ivec2, out ivec2)
+    {TSymbolUniqueId(462), ImmutableString("imulExtended"), TExtension::UNDEFINED,
+     kParameters_vi2_vi2_out_vi2_out_vi2, 4,
+     StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imulExtended(vi2;vi2;vi2;vi2;"), EOpImulExtended},
+    // void imulExtended(ivec3, ivec3, out ivec3, out ivec3)
+    {TSymbolUniqueId(463), ImmutableString("imulExtended"), TExtension::UNDEFINED,
+     kParameters_vi3_vi3_out_vi3_out_vi3, 4,
+     StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imulExtended(vi3;vi3;vi3;vi3;"), EOpImulExtended},
+    // void imulExtended(ivec4, ivec4, out ivec4, out ivec4)
+    {TSymbolUniqueId(464), ImmutableString("imulExtended"), TExtension::UNDEFINED,
+     kParameters_vi4_vi4_out_vi4_out_vi4, 4,
+     StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imulExtended(vi4;vi4;vi4;vi4;"), EOpImulExtended},
+    // vec4 texture2D(sampler2D, vec2)
+    {TSymbolUniqueId(465), ImmutableString("texture2D"), TExtension::UNDEFINED, kParameters_s21_vf2,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2D(s21;vf2;"), EOpNull},
+    // vec4 texture2DProj(sampler2D, vec3)
+    {TSymbolUniqueId(466), ImmutableString("texture2DProj"), TExtension::UNDEFINED,
+     kParameters_s21_vf3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DProj(s21;vf3;"), EOpNull},
+    // vec4 texture2DProj(sampler2D, vec4)
+    {TSymbolUniqueId(467), ImmutableString("texture2DProj"), TExtension::UNDEFINED,
+     kParameters_s21_vf4, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DProj(s21;vf4;"), EOpNull},
+    // vec4 textureCube(samplerCube, vec3)
+    {TSymbolUniqueId(468), ImmutableString("textureCube"), TExtension::UNDEFINED,
+     kParameters_sC1_vf3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureCube(sC1;vf3;"), EOpNull},
+    // vec4 texture2D(samplerExternalOES, vec2)
+    {TSymbolUniqueId(469), ImmutableString("texture2D"), TExtension::UNDEFINED,
+     kParameters_sext1_vf2, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2D(sext1;vf2;"), EOpNull},
+    // vec4 texture2DProj(samplerExternalOES, vec3)
+    {TSymbolUniqueId(470), ImmutableString("texture2DProj"), TExtension::UNDEFINED,
+     kParameters_sext1_vf3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DProj(sext1;vf3;"), EOpNull},
+    // vec4 texture2DProj(samplerExternalOES, vec4)
+    {TSymbolUniqueId(471), ImmutableString("texture2DProj"), TExtension::UNDEFINED,
+     kParameters_sext1_vf4, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DProj(sext1;vf4;"), EOpNull},
+    // vec4 texture2DRect(sampler2DRect, vec2)
+    {TSymbolUniqueId(472), ImmutableString("texture2DRect"), TExtension::UNDEFINED,
+     kParameters_s2r1_vf2, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DRect(s2r1;vf2;"), EOpNull},
+    // vec4 texture2DRectProj(sampler2DRect, vec3)
+    {TSymbolUniqueId(473), ImmutableString("texture2DRectProj"), TExtension::UNDEFINED,
+     kParameters_s2r1_vf3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DRectProj(s2r1;vf3;"), EOpNull},
+    // vec4 texture2DRectProj(sampler2DRect, vec4)
+    {TSymbolUniqueId(474), ImmutableString("texture2DRectProj"), TExtension::UNDEFINED,
+     kParameters_s2r1_vf4, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DRectProj(s2r1;vf4;"), EOpNull},
+    // vec4 texture2DGradEXT(sampler2D, vec2, vec2, vec2)
+    {TSymbolUniqueId(475), ImmutableString("texture2DGradEXT"), TExtension::EXT_shader_texture_lod,
+     kParameters_s21_vf2_vf2_vf2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DGradEXT(s21;vf2;vf2;vf2;"), EOpNull},
+    // vec4 texture2DProjGradEXT(sampler2D, vec3, vec2, vec2)
+    {TSymbolUniqueId(476), ImmutableString("texture2DProjGradEXT"),
+     TExtension::EXT_shader_texture_lod, kParameters_s21_vf3_vf2_vf2, 4,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DProjGradEXT(s21;vf3;vf2;vf2;"), EOpNull},
+    // vec4 texture2DProjGradEXT(sampler2D, vec4, vec2, vec2)
+    {TSymbolUniqueId(477), ImmutableString("texture2DProjGradEXT"),
+     TExtension::EXT_shader_texture_lod, kParameters_s21_vf4_vf2_vf2, 4,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DProjGradEXT(s21;vf4;vf2;vf2;"), EOpNull},
+    // vec4 textureCubeGradEXT(samplerCube, vec3, vec3, vec3)
+    {TSymbolUniqueId(478), ImmutableString("textureCubeGradEXT"),
+     TExtension::EXT_shader_texture_lod, kParameters_sC1_vf3_vf3_vf3, 4,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureCubeGradEXT(sC1;vf3;vf3;vf3;"), EOpNull},
+    // vec4 texture2D(sampler2D, vec2, float)
+    {TSymbolUniqueId(479), ImmutableString("texture2D"), TExtension::UNDEFINED,
+     kParameters_s21_vf2_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2D(s21;vf2;f1;"), EOpNull},
+    // vec4 texture2DProj(sampler2D, vec3, float)
+    {TSymbolUniqueId(480), ImmutableString("texture2DProj"), TExtension::UNDEFINED,
+     kParameters_s21_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DProj(s21;vf3;f1;"), EOpNull},
+    // vec4 texture2DProj(sampler2D, vec4, float)
+    {TSymbolUniqueId(481), ImmutableString("texture2DProj"), TExtension::UNDEFINED,
+     kParameters_s21_vf4_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DProj(s21;vf4;f1;"), EOpNull},
+    // vec4 textureCube(samplerCube, vec3, float)
+    {TSymbolUniqueId(482), ImmutableString("textureCube"), TExtension::UNDEFINED,
+     kParameters_sC1_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureCube(sC1;vf3;f1;"), EOpNull},
+    // float dFdx(float)
+    {TSymbolUniqueId(483), ImmutableString("dFdx"), TExtension::OES_standard_derivatives,
+     kParameters_f1, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("dFdx(f1;"), EOpDFdx},
+    // vec2 dFdx(vec2)
+    {TSymbolUniqueId(484), ImmutableString("dFdx"), TExtension::OES_standard_derivatives,
+     kParameters_vf2, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("dFdx(vf2;"), EOpDFdx},
+    // vec3 dFdx(vec3)
+    {TSymbolUniqueId(485), ImmutableString("dFdx"), TExtension::OES_standard_derivatives,
+     kParameters_vf3, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("dFdx(vf3;"), EOpDFdx},
+    // vec4 dFdx(vec4)
+    {TSymbolUniqueId(486), ImmutableString("dFdx"), TExtension::OES_standard_derivatives,
+     kParameters_vf4, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("dFdx(vf4;"), EOpDFdx},
+    // float dFdy(float)
+    {TSymbolUniqueId(487), ImmutableString("dFdy"), TExtension::OES_standard_derivatives,
+     kParameters_f1, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("dFdy(f1;"), EOpDFdy},
+    // vec2 dFdy(vec2)
+    {TSymbolUniqueId(488), ImmutableString("dFdy"), TExtension::OES_standard_derivatives,
+     kParameters_vf2, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("dFdy(vf2;"), EOpDFdy},
+    // vec3 dFdy(vec3)
+    {TSymbolUniqueId(489), ImmutableString("dFdy"), TExtension::OES_standard_derivatives,
+     kParameters_vf3, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("dFdy(vf3;"), EOpDFdy},
+    // vec4 dFdy(vec4)
+    {TSymbolUniqueId(490), ImmutableString("dFdy"), TExtension::OES_standard_derivatives,
+     kParameters_vf4, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("dFdy(vf4;"), EOpDFdy},
+    // float fwidth(float)
+    {TSymbolUniqueId(491), ImmutableString("fwidth"), TExtension::OES_standard_derivatives,
+     kParameters_f1, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("fwidth(f1;"), EOpFwidth},
+    // vec2 fwidth(vec2)
+    {TSymbolUniqueId(492), ImmutableString("fwidth"), TExtension::OES_standard_derivatives,
+     kParameters_vf2, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("fwidth(vf2;"), EOpFwidth},
+    // vec3 fwidth(vec3)
+    {TSymbolUniqueId(493), ImmutableString("fwidth"), TExtension::OES_standard_derivatives,
+     kParameters_vf3, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("fwidth(vf3;"), EOpFwidth},
+    // vec4 fwidth(vec4)
+    {TSymbolUniqueId(494), ImmutableString("fwidth"), TExtension::OES_standard_derivatives,
+     kParameters_vf4, 1, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("fwidth(vf4;"), EOpFwidth},
+    // vec4 texture2DLodEXT(sampler2D, vec2, float)
+    {TSymbolUniqueId(495), ImmutableString("texture2DLodEXT"), TExtension::EXT_shader_texture_lod,
+     kParameters_s21_vf2_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DLodEXT(s21;vf2;f1;"), EOpNull},
+    // vec4 texture2DProjLodEXT(sampler2D, vec3, float)
+    {TSymbolUniqueId(496), ImmutableString("texture2DProjLodEXT"),
+     TExtension::EXT_shader_texture_lod, kParameters_s21_vf3_f1, 3,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DProjLodEXT(s21;vf3;f1;"), EOpNull},
+    // vec4 texture2DProjLodEXT(sampler2D, vec4, float)
+    {TSymbolUniqueId(497), ImmutableString("texture2DProjLodEXT"),
+     TExtension::EXT_shader_texture_lod, kParameters_s21_vf4_f1, 3,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DProjLodEXT(s21;vf4;f1;"), EOpNull},
+    // vec4 textureCubeLodEXT(samplerCube, vec3, float)
+    {TSymbolUniqueId(498), ImmutableString("textureCubeLodEXT"), TExtension::EXT_shader_texture_lod,
+     kParameters_sC1_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureCubeLodEXT(sC1;vf3;f1;"), EOpNull},
+    // vec4 texture2DLod(sampler2D, vec2, float)
+    {TSymbolUniqueId(499), ImmutableString("texture2DLod"), TExtension::UNDEFINED,
+     kParameters_s21_vf2_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DLod(s21;vf2;f1;"), EOpNull},
+    // vec4 texture2DProjLod(sampler2D, vec3, float)
+    {TSymbolUniqueId(500), ImmutableString("texture2DProjLod"), TExtension::UNDEFINED,
+     kParameters_s21_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DProjLod(s21;vf3;f1;"), EOpNull},
+    // vec4 texture2DProjLod(sampler2D, vec4, float)
+    {TSymbolUniqueId(501), ImmutableString("texture2DProjLod"), TExtension::UNDEFINED,
+     kParameters_s21_vf4_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture2DProjLod(s21;vf4;f1;"), EOpNull},
+    // vec4 textureCubeLod(samplerCube, vec3, float)
+    {TSymbolUniqueId(502), ImmutableString("textureCubeLod"), TExtension::UNDEFINED,
+     kParameters_sC1_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureCubeLod(sC1;vf3;f1;"), EOpNull},
+    // vec4 texture(sampler2D, vec2)
+    {TSymbolUniqueId(503), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_s21_vf2,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(s21;vf2;"), EOpNull},
+    // ivec4 texture(isampler2D, vec2)
+    {TSymbolUniqueId(504), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_is21_vf2,
+     2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(is21;vf2;"), EOpNull},
+    // uvec4 texture(usampler2D, vec2)
+    {TSymbolUniqueId(505), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_us21_vf2,
+     2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(us21;vf2;"), EOpNull},
+    // vec4 texture(sampler3D, vec3)
+    {TSymbolUniqueId(506), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_s31_vf3,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(s31;vf3;"), EOpNull},
+    // ivec4 texture(isampler3D, vec3)
+    {TSymbolUniqueId(507), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_is31_vf3,
+     2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(is31;vf3;"), EOpNull},
+    // uvec4 texture(usampler3D, vec3)
+    {TSymbolUniqueId(508), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_us31_vf3,
+     2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(us31;vf3;"), EOpNull},
+    // vec4 texture(samplerCube, vec3)
+    {TSymbolUniqueId(509), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_sC1_vf3,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(sC1;vf3;"), EOpNull},
+    // ivec4 texture(isamplerCube, vec3)
+    {TSymbolUniqueId(510), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_isC1_vf3,
+     2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(isC1;vf3;"), EOpNull},
+    // uvec4 texture(usamplerCube, vec3)
+    {TSymbolUniqueId(511), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_usC1_vf3,
+     2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(usC1;vf3;"), EOpNull},
+    // vec4 texture(sampler2DArray, vec3)
+    {TSymbolUniqueId(512), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_s2a1_vf3,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(s2a1;vf3;"), EOpNull},
+    // ivec4 texture(isampler2DArray, vec3)
+    {TSymbolUniqueId(513), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_is2a1_vf3,
+     2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(is2a1;vf3;"), EOpNull},
+    // uvec4 texture(usampler2DArray, vec3)
+    {TSymbolUniqueId(514), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_us2a1_vf3,
+     2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(us2a1;vf3;"), EOpNull},
+    // vec4 textureProj(sampler2D, vec3)
+    {TSymbolUniqueId(515), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_s21_vf3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(s21;vf3;"), EOpNull},
+    // ivec4 textureProj(isampler2D, vec3)
+    {TSymbolUniqueId(516), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_is21_vf3, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(is21;vf3;"), EOpNull},
+    // uvec4 textureProj(usampler2D, vec3)
+    {TSymbolUniqueId(517), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_us21_vf3, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(us21;vf3;"), EOpNull},
+    // vec4 textureProj(sampler2D, vec4)
+    {TSymbolUniqueId(518), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_s21_vf4, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(s21;vf4;"), EOpNull},
+    // ivec4 textureProj(isampler2D, vec4)
+    {TSymbolUniqueId(519), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_is21_vf4, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(is21;vf4;"), EOpNull},
+    // uvec4 textureProj(usampler2D, vec4)
+    {TSymbolUniqueId(520), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_us21_vf4, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(us21;vf4;"), EOpNull},
+    // vec4 textureProj(sampler3D, vec4)
+    {TSymbolUniqueId(521), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_s31_vf4, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(s31;vf4;"), EOpNull},
+    // ivec4 textureProj(isampler3D, vec4)
+    {TSymbolUniqueId(522), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_is31_vf4, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(is31;vf4;"), EOpNull},
+    // uvec4 textureProj(usampler3D, vec4)
+    {TSymbolUniqueId(523), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_us31_vf4, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(us31;vf4;"), EOpNull},
+    // vec4 textureLod(sampler2D, vec2, float)
+    {TSymbolUniqueId(524), ImmutableString("textureLod"), TExtension::UNDEFINED,
+     kParameters_s21_vf2_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLod(s21;vf2;f1;"), EOpNull},
+    // ivec4 textureLod(isampler2D, vec2, float)
+    {TSymbolUniqueId(525), ImmutableString("textureLod"), TExtension::UNDEFINED,
+     kParameters_is21_vf2_f1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLod(is21;vf2;f1;"), EOpNull},
+    // uvec4 textureLod(usampler2D, vec2, float)
+    {TSymbolUniqueId(526), ImmutableString("textureLod"), TExtension::UNDEFINED,
+     kParameters_us21_vf2_f1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLod(us21;vf2;f1;"), EOpNull},
+    // vec4 textureLod(sampler3D, vec3, float)
+    {TSymbolUniqueId(527), ImmutableString("textureLod"), TExtension::UNDEFINED,
+     kParameters_s31_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLod(s31;vf3;f1;"), EOpNull},
+    // ivec4 textureLod(isampler3D, vec3, float)
+    {TSymbolUniqueId(528), ImmutableString("textureLod"), TExtension::UNDEFINED,
+     kParameters_is31_vf3_f1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLod(is31;vf3;f1;"), EOpNull},
+    // uvec4 textureLod(usampler3D, vec3, float)
+    {TSymbolUniqueId(529), ImmutableString("textureLod"), TExtension::UNDEFINED,
+     kParameters_us31_vf3_f1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLod(us31;vf3;f1;"), EOpNull},
+    // vec4 textureLod(samplerCube, vec3, float)
+    {TSymbolUniqueId(530), ImmutableString("textureLod"), TExtension::UNDEFINED,
+     kParameters_sC1_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLod(sC1;vf3;f1;"), EOpNull},
+    // ivec4 textureLod(isamplerCube, vec3, float)
+    {TSymbolUniqueId(531), ImmutableString("textureLod"), TExtension::UNDEFINED,
+     kParameters_isC1_vf3_f1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLod(isC1;vf3;f1;"), EOpNull},
+    // uvec4 textureLod(usamplerCube, vec3, float)
+    {TSymbolUniqueId(532), ImmutableString("textureLod"), TExtension::UNDEFINED,
+     kParameters_usC1_vf3_f1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLod(usC1;vf3;f1;"), EOpNull},
+    // vec4 textureLod(sampler2DArray, vec3, float)
+    {TSymbolUniqueId(533), ImmutableString("textureLod"), TExtension::UNDEFINED,
+     kParameters_s2a1_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLod(s2a1;vf3;f1;"), EOpNull},
+    // ivec4 textureLod(isampler2DArray, vec3, float)
+    {TSymbolUniqueId(534), ImmutableString("textureLod"), TExtension::UNDEFINED,
+     kParameters_is2a1_vf3_f1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLod(is2a1;vf3;f1;"), EOpNull},
+    // uvec4 textureLod(usampler2DArray, vec3, float)
+    {TSymbolUniqueId(535), ImmutableString("textureLod"), TExtension::UNDEFINED,
+     kParameters_us2a1_vf3_f1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLod(us2a1;vf3;f1;"), EOpNull},
+    // vec4 texture(samplerExternalOES, vec2)
+    {TSymbolUniqueId(536), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_sext1_vf2,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(sext1;vf2;"), EOpNull},
+    // vec4 textureProj(samplerExternalOES, vec3)
+    {TSymbolUniqueId(537), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_sext1_vf3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(sext1;vf3;"), EOpNull},
+    // vec4 textureProj(samplerExternalOES, vec4)
+    {TSymbolUniqueId(538), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_sext1_vf4, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(sext1;vf4;"), EOpNull},
+    // vec4 texture(__samplerExternal2DY2YEXT, vec2)
+    {TSymbolUniqueId(539), ImmutableString("texture"), TExtension::EXT_YUV_target,
+     kParameters_sext2y2y1_vf2, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(sext2y2y1;vf2;"), EOpNull},
+    // vec4 textureProj(__samplerExternal2DY2YEXT, vec3)
+    {TSymbolUniqueId(540), ImmutableString("textureProj"), TExtension::EXT_YUV_target,
+     kParameters_sext2y2y1_vf3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(sext2y2y1;vf3;"), EOpNull},
+    // vec4 textureProj(__samplerExternal2DY2YEXT, vec4)
+    {TSymbolUniqueId(541), ImmutableString("textureProj"), TExtension::EXT_YUV_target,
+     kParameters_sext2y2y1_vf4, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(sext2y2y1;vf4;"), EOpNull},
+    // vec3 rgb_2_yuv(vec3, yuvCscStandardEXT)
+    {TSymbolUniqueId(542), ImmutableString("rgb_2_yuv"), TExtension::EXT_YUV_target,
+     kParameters_vf3_ycs1, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("rgb_2_yuv(vf3;ycs1;"), EOpNull},
+    // vec3 yuv_2_rgb(vec3, yuvCscStandardEXT)
+    {TSymbolUniqueId(543), ImmutableString("yuv_2_rgb"), TExtension::EXT_YUV_target,
+     kParameters_vf3_ycs1, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("yuv_2_rgb(vf3;ycs1;"), EOpNull},
+    // vec4 texture(sampler2D, vec2, float)
+    {TSymbolUniqueId(544), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_s21_vf2_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(s21;vf2;f1;"), EOpNull},
+    // ivec4 texture(isampler2D, vec2, float)
+    {TSymbolUniqueId(545), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_is21_vf2_f1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(is21;vf2;f1;"), EOpNull},
+    // uvec4 texture(usampler2D, vec2, float)
+    {TSymbolUniqueId(546), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_us21_vf2_f1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(us21;vf2;f1;"), EOpNull},
+    // vec4 texture(sampler3D, vec3, float)
+    {TSymbolUniqueId(547), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_s31_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(s31;vf3;f1;"), EOpNull},
+    // ivec4 texture(isampler3D, vec3, float)
+    {TSymbolUniqueId(548), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_is31_vf3_f1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(is31;vf3;f1;"), EOpNull},
+    // uvec4 texture(usampler3D, vec3, float)
+    {TSymbolUniqueId(549), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_us31_vf3_f1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(us31;vf3;f1;"), EOpNull},
+    // vec4 texture(samplerCube, vec3, float)
+    {TSymbolUniqueId(550), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_sC1_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(sC1;vf3;f1;"), EOpNull},
+    // ivec4 texture(isamplerCube, vec3, float)
+    {TSymbolUniqueId(551), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_isC1_vf3_f1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(isC1;vf3;f1;"), EOpNull},
+    // uvec4 texture(usamplerCube, vec3, float)
+    {TSymbolUniqueId(552), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_usC1_vf3_f1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(usC1;vf3;f1;"), EOpNull},
+    // vec4 texture(sampler2DArray, vec3, float)
+    {TSymbolUniqueId(553), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_s2a1_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(s2a1;vf3;f1;"), EOpNull},
+    // ivec4 texture(isampler2DArray, vec3, float)
+    {TSymbolUniqueId(554), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_is2a1_vf3_f1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(is2a1;vf3;f1;"), EOpNull},
+    // uvec4 texture(usampler2DArray, vec3, float)
+    {TSymbolUniqueId(555), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_us2a1_vf3_f1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(us2a1;vf3;f1;"), EOpNull},
+    // vec4 textureProj(sampler2D, vec3, float)
+    {TSymbolUniqueId(556), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_s21_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(s21;vf3;f1;"), EOpNull},
+    // ivec4 textureProj(isampler2D, vec3, float)
+    {TSymbolUniqueId(557), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_is21_vf3_f1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(is21;vf3;f1;"), EOpNull},
+    // uvec4 textureProj(usampler2D, vec3, float)
+    {TSymbolUniqueId(558), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_us21_vf3_f1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(us21;vf3;f1;"), EOpNull},
+    // vec4 textureProj(sampler2D, vec4, float)
+    {TSymbolUniqueId(559), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_s21_vf4_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(s21;vf4;f1;"), EOpNull},
+    // ivec4 textureProj(isampler2D, vec4, float)
+    {TSymbolUniqueId(560), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_is21_vf4_f1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(is21;vf4;f1;"), EOpNull},
+    // uvec4 textureProj(usampler2D, vec4, float)
+    {TSymbolUniqueId(561), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_us21_vf4_f1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(us21;vf4;f1;"), EOpNull},
+    // vec4 textureProj(sampler3D, vec4, float)
+    {TSymbolUniqueId(562), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_s31_vf4_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(s31;vf4;f1;"), EOpNull},
+    // ivec4 textureProj(isampler3D, vec4, float)
+    {TSymbolUniqueId(563), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_is31_vf4_f1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(is31;vf4;f1;"), EOpNull},
+    // uvec4 textureProj(usampler3D, vec4, float)
+    {TSymbolUniqueId(564), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_us31_vf4_f1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(us31;vf4;f1;"), EOpNull},
+    // vec4 texture(samplerExternalOES, vec2, float)
+    {TSymbolUniqueId(565), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_sext1_vf2_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(sext1;vf2;f1;"), EOpNull},
+    // vec4 textureProj(samplerExternalOES, vec3, float)
+    {TSymbolUniqueId(566), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_sext1_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(sext1;vf3;f1;"), EOpNull},
+    // vec4 textureProj(samplerExternalOES, vec4, float)
+    {TSymbolUniqueId(567), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_sext1_vf4_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(sext1;vf4;f1;"), EOpNull},
+    // vec4 texture(__samplerExternal2DY2YEXT, vec2, float)
+    {TSymbolUniqueId(568), ImmutableString("texture"), TExtension::EXT_YUV_target,
+     kParameters_sext2y2y1_vf2_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texture(sext2y2y1;vf2;f1;"), EOpNull},
+    // vec4 textureProj(__samplerExternal2DY2YEXT, vec3, float)
+    {TSymbolUniqueId(569), ImmutableString("textureProj"), TExtension::EXT_YUV_target,
+     kParameters_sext2y2y1_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(sext2y2y1;vf3;f1;"), EOpNull},
+    // vec4 textureProj(__samplerExternal2DY2YEXT, vec4, float)
+    {TSymbolUniqueId(570), ImmutableString("textureProj"), TExtension::EXT_YUV_target,
+     kParameters_sext2y2y1_vf4_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProj(sext2y2y1;vf4;f1;"), EOpNull},
+    // float texture(sampler2DShadow, vec3)
+    {TSymbolUniqueId(571), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_s2s1_vf3,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("texture(s2s1;vf3;"), EOpNull},
+    // float texture(samplerCubeShadow, vec4)
+    {TSymbolUniqueId(572), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_sCs1_vf4,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("texture(sCs1;vf4;"), EOpNull},
+    // float texture(sampler2DArrayShadow, vec4)
+    {TSymbolUniqueId(573), ImmutableString("texture"), TExtension::UNDEFINED, kParameters_s2as1_vf4,
+     2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("texture(s2as1;vf4;"), EOpNull},
+    // float textureProj(sampler2DShadow, vec4)
+    {TSymbolUniqueId(574), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf4, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureProj(s2s1;vf4;"), EOpNull},
+    // float textureLod(sampler2DShadow, vec3, float)
+    {TSymbolUniqueId(575), ImmutableString("textureLod"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureLod(s2s1;vf3;f1;"), EOpNull},
+    // float texture(sampler2DShadow, vec3, float)
+    {TSymbolUniqueId(576), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("texture(s2s1;vf3;f1;"), EOpNull},
+    // float texture(samplerCubeShadow, vec4, float)
+    {TSymbolUniqueId(577), ImmutableString("texture"), TExtension::UNDEFINED,
+     kParameters_sCs1_vf4_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("texture(sCs1;vf4;f1;"), EOpNull},
+    // float textureProj(sampler2DShadow, vec4, float)
+    {TSymbolUniqueId(578), ImmutableString("textureProj"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf4_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureProj(s2s1;vf4;f1;"), EOpNull},
+    // ivec2 textureSize(sampler2D, int)
+    {TSymbolUniqueId(579), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_s21_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("textureSize(s21;i1;"), EOpNull},
+    // ivec2 textureSize(isampler2D, int)
+    {TSymbolUniqueId(580), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_is21_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("textureSize(is21;i1;"), EOpNull},
+    // ivec2 textureSize(usampler2D, int)
+    {TSymbolUniqueId(581), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_us21_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("textureSize(us21;i1;"), EOpNull},
+    // ivec3 textureSize(sampler3D, int)
+    {TSymbolUniqueId(582), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_s31_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("textureSize(s31;i1;"), EOpNull},
+    // ivec3 textureSize(isampler3D, int)
+    {TSymbolUniqueId(583), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_is31_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("textureSize(is31;i1;"), EOpNull},
+    // ivec3 textureSize(usampler3D, int)
+    {TSymbolUniqueId(584), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_us31_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("textureSize(us31;i1;"), EOpNull},
+    // ivec2 textureSize(samplerCube, int)
+    {TSymbolUniqueId(585), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_sC1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("textureSize(sC1;i1;"), EOpNull},
+    // ivec2 textureSize(isamplerCube, int)
+    {TSymbolUniqueId(586), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_isC1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("textureSize(isC1;i1;"), EOpNull},
+    // ivec2 textureSize(usamplerCube, int)
+    {TSymbolUniqueId(587), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_usC1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("textureSize(usC1;i1;"), EOpNull},
+    // ivec3 textureSize(sampler2DArray, int)
+    {TSymbolUniqueId(588), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_s2a1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("textureSize(s2a1;i1;"), EOpNull},
+    // ivec3 textureSize(isampler2DArray, int)
+    {TSymbolUniqueId(589), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_is2a1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("textureSize(is2a1;i1;"), EOpNull},
+    // ivec3 textureSize(usampler2DArray, int)
+    {TSymbolUniqueId(590), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_us2a1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("textureSize(us2a1;i1;"), EOpNull},
+    // ivec2 textureSize(sampler2DShadow, int)
+    {TSymbolUniqueId(591), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_s2s1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("textureSize(s2s1;i1;"), EOpNull},
+    // ivec2 textureSize(samplerCubeShadow, int)
+    {TSymbolUniqueId(592), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_sCs1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("textureSize(sCs1;i1;"), EOpNull},
+    // ivec3 textureSize(sampler2DArrayShadow, int)
+    {TSymbolUniqueId(593), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_s2as1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("textureSize(s2as1;i1;"), EOpNull},
+    // ivec2 textureSize(sampler2DMS)
+    {TSymbolUniqueId(594), ImmutableString("textureSize"), TExtension::UNDEFINED, kParameters_s2ms1,
+     1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("textureSize(s2ms1;"), EOpNull},
+    // ivec2 textureSize(isampler2DMS)
+    {TSymbolUniqueId(595), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_is2ms1, 1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("textureSize(is2ms1;"), EOpNull},
+    // ivec2 textureSize(usampler2DMS)
+    {TSymbolUniqueId(596), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_us2ms1, 1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("textureSize(us2ms1;"), EOpNull},
+    // ivec2 textureSize(samplerExternalOES, int)
+    {TSymbolUniqueId(597), ImmutableString("textureSize"), TExtension::UNDEFINED,
+     kParameters_sext1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("textureSize(sext1;i1;"), EOpNull},
+    // ivec2 textureSize(__samplerExternal2DY2YEXT, int)
+    {TSymbolUniqueId(598), ImmutableString("textureSize"), TExtension::EXT_YUV_target,
+     kParameters_sext2y2y1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("textureSize(sext2y2y1;i1;"), EOpNull},
+    // float dFdx(float)
+    {TSymbolUniqueId(599), ImmutableString("dFdx"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("dFdx(f1;"),
+     EOpDFdx},
+    // vec2 dFdx(vec2)
+    {TSymbolUniqueId(600), ImmutableString("dFdx"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("dFdx(vf2;"),
+     EOpDFdx},
+    // vec3 dFdx(vec3)
+    {TSymbolUniqueId(601), ImmutableString("dFdx"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("dFdx(vf3;"),
+     EOpDFdx},
+    // vec4 dFdx(vec4)
+    {TSymbolUniqueId(602), ImmutableString("dFdx"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("dFdx(vf4;"),
+     EOpDFdx},
+    // float dFdy(float)
+    {TSymbolUniqueId(603), ImmutableString("dFdy"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("dFdy(f1;"),
+     EOpDFdy},
+    // vec2 dFdy(vec2)
+    {TSymbolUniqueId(604), ImmutableString("dFdy"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("dFdy(vf2;"),
+     EOpDFdy},
+    // vec3 dFdy(vec3)
+    {TSymbolUniqueId(605), ImmutableString("dFdy"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("dFdy(vf3;"),
+     EOpDFdy},
+    // vec4 dFdy(vec4)
+    {TSymbolUniqueId(606), ImmutableString("dFdy"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("dFdy(vf4;"),
+     EOpDFdy},
+    // float fwidth(float)
+    {TSymbolUniqueId(607), ImmutableString("fwidth"), TExtension::UNDEFINED, kParameters_f1, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("fwidth(f1;"),
+     EOpFwidth},
+    // vec2 fwidth(vec2)
+    {TSymbolUniqueId(608), ImmutableString("fwidth"), TExtension::UNDEFINED, kParameters_vf2, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("fwidth(vf2;"),
+     EOpFwidth},
+    // vec3 fwidth(vec3)
+    {TSymbolUniqueId(609), ImmutableString("fwidth"), TExtension::UNDEFINED, kParameters_vf3, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("fwidth(vf3;"),
+     EOpFwidth},
+    // vec4 fwidth(vec4)
+    {TSymbolUniqueId(610), ImmutableString("fwidth"), TExtension::UNDEFINED, kParameters_vf4, 1,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(), ImmutableString("fwidth(vf4;"),
+     EOpFwidth},
+    // vec4 textureOffset(sampler2D, vec2, ivec2)
+    {TSymbolUniqueId(611), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vf2_vi2, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(s21;vf2;vi2;"), EOpNull},
+    // ivec4 textureOffset(isampler2D, vec2, ivec2)
+    {TSymbolUniqueId(612), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vf2_vi2, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(is21;vf2;vi2;"), EOpNull},
+    // uvec4 textureOffset(usampler2D, vec2, ivec2)
+    {TSymbolUniqueId(613), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vf2_vi2, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(us21;vf2;vi2;"), EOpNull},
+    // vec4 textureOffset(sampler3D, vec3, ivec3)
+    {TSymbolUniqueId(614), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_s31_vf3_vi3, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(s31;vf3;vi3;"), EOpNull},
+    // ivec4 textureOffset(isampler3D, vec3, ivec3)
+    {TSymbolUniqueId(615), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_is31_vf3_vi3, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(is31;vf3;vi3;"), EOpNull},
+    // uvec4 textureOffset(usampler3D, vec3, ivec3)
+    {TSymbolUniqueId(616), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_us31_vf3_vi3, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(us31;vf3;vi3;"), EOpNull},
+    // float textureOffset(sampler2DShadow, vec3, ivec2)
+    {TSymbolUniqueId(617), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf3_vi2, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureOffset(s2s1;vf3;vi2;"), EOpNull},
+    // vec4 textureOffset(sampler2DArray, vec3, ivec2)
+    {TSymbolUniqueId(618), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_s2a1_vf3_vi2, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(s2a1;vf3;vi2;"), EOpNull},
+    // ivec4 textureOffset(isampler2DArray, vec3, ivec2)
+    {TSymbolUniqueId(619), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_is2a1_vf3_vi2, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(is2a1;vf3;vi2;"), EOpNull},
+    // uvec4 textureOffset(usampler2DArray, vec3, ivec2)
+    {TSymbolUniqueId(620), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_us2a1_vf3_vi2, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(us2a1;vf3;vi2;"), EOpNull},
+    // vec4 textureOffset(sampler2D, vec2, ivec2, float)
+    {TSymbolUniqueId(621), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vf2_vi2_f1, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(s21;vf2;vi2;f1;"), EOpNull},
+    // ivec4 textureOffset(isampler2D, vec2, ivec2, float)
+    {TSymbolUniqueId(622), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vf2_vi2_f1, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(is21;vf2;vi2;f1;"), EOpNull},
+    // uvec4 textureOffset(usampler2D, vec2, ivec2, float)
+    {TSymbolUniqueId(623), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vf2_vi2_f1, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(us21;vf2;vi2;f1;"), EOpNull},
+    // vec4 textureOffset(sampler3D, vec3, ivec3, float)
+    {TSymbolUniqueId(624), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_s31_vf3_vi3_f1, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(s31;vf3;vi3;f1;"), EOpNull},
+    // ivec4 textureOffset(isampler3D, vec3, ivec3, float)
+    {TSymbolUniqueId(625), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_is31_vf3_vi3_f1, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(is31;vf3;vi3;f1;"), EOpNull},
+    // uvec4 textureOffset(usampler3D, vec3, ivec3, float)
+    {TSymbolUniqueId(626), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_us31_vf3_vi3_f1, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(us31;vf3;vi3;f1;"), EOpNull},
+    // float textureOffset(sampler2DShadow, vec3, ivec2, float)
+    {TSymbolUniqueId(627), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf3_vi2_f1, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureOffset(s2s1;vf3;vi2;f1;"), EOpNull},
+    // vec4 textureOffset(sampler2DArray, vec3, ivec2, float)
+    {TSymbolUniqueId(628), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_s2a1_vf3_vi2_f1, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(s2a1;vf3;vi2;f1;"), EOpNull},
+    // ivec4 textureOffset(isampler2DArray, vec3, ivec2, float)
+    {TSymbolUniqueId(629), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_is2a1_vf3_vi2_f1, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(is2a1;vf3;vi2;f1;"), EOpNull},
+    // uvec4 textureOffset(usampler2DArray, vec3, ivec2, float)
+    {TSymbolUniqueId(630), ImmutableString("textureOffset"), TExtension::UNDEFINED,
+     kParameters_us2a1_vf3_vi2_f1, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureOffset(us2a1;vf3;vi2;f1;"), EOpNull},
+    // vec4 textureProjOffset(sampler2D, vec3, ivec2)
+    {TSymbolUniqueId(631), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vf3_vi2, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(s21;vf3;vi2;"), EOpNull},
+    // ivec4 textureProjOffset(isampler2D, vec3, ivec2)
+    {TSymbolUniqueId(632), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vf3_vi2, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(is21;vf3;vi2;"), EOpNull},
+    // uvec4 textureProjOffset(usampler2D, vec3, ivec2)
+    {TSymbolUniqueId(633), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vf3_vi2, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(us21;vf3;vi2;"), EOpNull},
+    // vec4 textureProjOffset(sampler2D, vec4, ivec2)
+    {TSymbolUniqueId(634), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vf4_vi2, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(s21;vf4;vi2;"), EOpNull},
+    // ivec4 textureProjOffset(isampler2D, vec4, ivec2)
+    {TSymbolUniqueId(635), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vf4_vi2, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(is21;vf4;vi2;"), EOpNull},
+    // uvec4 textureProjOffset(usampler2D, vec4, ivec2)
+    {TSymbolUniqueId(636), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vf4_vi2, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(us21;vf4;vi2;"), EOpNull},
+    // vec4 textureProjOffset(sampler3D, vec4, ivec3)
+    {TSymbolUniqueId(637), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_s31_vf4_vi3, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(s31;vf4;vi3;"), EOpNull},
+    // ivec4 textureProjOffset(isampler3D, vec4, ivec3)
+    {TSymbolUniqueId(638), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_is31_vf4_vi3, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(is31;vf4;vi3;"), EOpNull},
+    // uvec4 textureProjOffset(usampler3D, vec4, ivec3)
+    {TSymbolUniqueId(639), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_us31_vf4_vi3, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(us31;vf4;vi3;"), EOpNull},
+    // float textureProjOffset(sampler2DShadow, vec4, ivec2)
+    {TSymbolUniqueId(640), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf4_vi2, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureProjOffset(s2s1;vf4;vi2;"), EOpNull},
+    // vec4 textureProjOffset(sampler2D, vec3, ivec2, float)
+    {TSymbolUniqueId(641), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vf3_vi2_f1, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(s21;vf3;vi2;f1;"), EOpNull},
+    // ivec4 textureProjOffset(isampler2D, vec3, ivec2, float)
+    {TSymbolUniqueId(642), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vf3_vi2_f1, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(is21;vf3;vi2;f1;"), EOpNull},
+    // uvec4 textureProjOffset(usampler2D, vec3, ivec2, float)
+    {TSymbolUniqueId(643), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vf3_vi2_f1, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(us21;vf3;vi2;f1;"), EOpNull},
+    // vec4 textureProjOffset(sampler2D, vec4, ivec2, float)
+    {TSymbolUniqueId(644), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vf4_vi2_f1, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(s21;vf4;vi2;f1;"), EOpNull},
+    // ivec4 textureProjOffset(isampler2D, vec4, ivec2, float)
+    {TSymbolUniqueId(645), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vf4_vi2_f1, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(is21;vf4;vi2;f1;"), EOpNull},
+    // uvec4 textureProjOffset(usampler2D, vec4, ivec2, float)
+    {TSymbolUniqueId(646), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vf4_vi2_f1, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(us21;vf4;vi2;f1;"), EOpNull},
+    // vec4 textureProjOffset(sampler3D, vec4, ivec3, float)
+    {TSymbolUniqueId(647), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_s31_vf4_vi3_f1, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(s31;vf4;vi3;f1;"), EOpNull},
+    // ivec4 textureProjOffset(isampler3D, vec4, ivec3, float)
+    {TSymbolUniqueId(648), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_is31_vf4_vi3_f1, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(is31;vf4;vi3;f1;"), EOpNull},
+    // uvec4 textureProjOffset(usampler3D, vec4, ivec3, float)
+    {TSymbolUniqueId(649), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_us31_vf4_vi3_f1, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjOffset(us31;vf4;vi3;f1;"), EOpNull},
+    // float textureProjOffset(sampler2DShadow, vec4, ivec2, float)
+    {TSymbolUniqueId(650), ImmutableString("textureProjOffset"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf4_vi2_f1, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureProjOffset(s2s1;vf4;vi2;f1;"), EOpNull},
+    // vec4 textureLodOffset(sampler2D, vec2, float, ivec2)
+    {TSymbolUniqueId(651), ImmutableString("textureLodOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vf2_f1_vi2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLodOffset(s21;vf2;f1;vi2;"), EOpNull},
+    // ivec4 textureLodOffset(isampler2D, vec2, float, ivec2)
+    {TSymbolUniqueId(652), ImmutableString("textureLodOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vf2_f1_vi2, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLodOffset(is21;vf2;f1;vi2;"), EOpNull},
+    // uvec4 textureLodOffset(usampler2D, vec2, float, ivec2)
+    {TSymbolUniqueId(653), ImmutableString("textureLodOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vf2_f1_vi2, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLodOffset(us21;vf2;f1;vi2;"), EOpNull},
+    // vec4 textureLodOffset(sampler3D, vec3, float, ivec3)
+    {TSymbolUniqueId(654), ImmutableString("textureLodOffset"), TExtension::UNDEFINED,
+     kParameters_s31_vf3_f1_vi3, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLodOffset(s31;vf3;f1;vi3;"), EOpNull},
+    // ivec4 textureLodOffset(isampler3D, vec3, float, ivec3)
+    {TSymbolUniqueId(655), ImmutableString("textureLodOffset"), TExtension::UNDEFINED,
+     kParameters_is31_vf3_f1_vi3, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLodOffset(is31;vf3;f1;vi3;"), EOpNull},
+    // uvec4 textureLodOffset(usampler3D, vec3, float, ivec3)
+    {TSymbolUniqueId(656), ImmutableString("textureLodOffset"), TExtension::UNDEFINED,
+     kParameters_us31_vf3_f1_vi3, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLodOffset(us31;vf3;f1;vi3;"), EOpNull},
+    // float textureLodOffset(sampler2DShadow, vec3, float, ivec2)
+    {TSymbolUniqueId(657), ImmutableString("textureLodOffset"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf3_f1_vi2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureLodOffset(s2s1;vf3;f1;vi2;"), EOpNull},
+    // vec4 textureLodOffset(sampler2DArray, vec3, float, ivec2)
+    {TSymbolUniqueId(658), ImmutableString("textureLodOffset"), TExtension::UNDEFINED,
+     kParameters_s2a1_vf3_f1_vi2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLodOffset(s2a1;vf3;f1;vi2;"), EOpNull},
+    // ivec4 textureLodOffset(isampler2DArray, vec3, float, ivec2)
+    {TSymbolUniqueId(659), ImmutableString("textureLodOffset"), TExtension::UNDEFINED,
+     kParameters_is2a1_vf3_f1_vi2, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLodOffset(is2a1;vf3;f1;vi2;"), EOpNull},
+    // uvec4 textureLodOffset(usampler2DArray, vec3, float, ivec2)
+    {TSymbolUniqueId(660), ImmutableString("textureLodOffset"), TExtension::UNDEFINED,
+     kParameters_us2a1_vf3_f1_vi2, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureLodOffset(us2a1;vf3;f1;vi2;"), EOpNull},
+    // vec4 textureProjLod(sampler2D, vec3, float)
+    {TSymbolUniqueId(661), ImmutableString("textureProjLod"), TExtension::UNDEFINED,
+     kParameters_s21_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLod(s21;vf3;f1;"), EOpNull},
+    // ivec4 textureProjLod(isampler2D, vec3, float)
+    {TSymbolUniqueId(662), ImmutableString("textureProjLod"), TExtension::UNDEFINED,
+     kParameters_is21_vf3_f1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLod(is21;vf3;f1;"), EOpNull},
+    // uvec4 textureProjLod(usampler2D, vec3, float)
+    {TSymbolUniqueId(663), ImmutableString("textureProjLod"), TExtension::UNDEFINED,
+     kParameters_us21_vf3_f1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLod(us21;vf3;f1;"), EOpNull},
+    // vec4 textureProjLod(sampler2D, vec4, float)
+    {TSymbolUniqueId(664), ImmutableString("textureProjLod"), TExtension::UNDEFINED,
+     kParameters_s21_vf4_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLod(s21;vf4;f1;"), EOpNull},
+    // ivec4 textureProjLod(isampler2D, vec4, float)
+    {TSymbolUniqueId(665), ImmutableString("textureProjLod"), TExtension::UNDEFINED,
+     kParameters_is21_vf4_f1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLod(is21;vf4;f1;"), EOpNull},
+    // uvec4 textureProjLod(usampler2D, vec4, float)
+    {TSymbolUniqueId(666), ImmutableString("textureProjLod"), TExtension::UNDEFINED,
+     kParameters_us21_vf4_f1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLod(us21;vf4;f1;"), EOpNull},
+    // vec4 textureProjLod(sampler3D, vec4, float)
+    {TSymbolUniqueId(667), ImmutableString("textureProjLod"), TExtension::UNDEFINED,
+     kParameters_s31_vf4_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLod(s31;vf4;f1;"), EOpNull},
+    // ivec4 textureProjLod(isampler3D, vec4, float)
+    {TSymbolUniqueId(668), ImmutableString("textureProjLod"), TExtension::UNDEFINED,
+     kParameters_is31_vf4_f1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLod(is31;vf4;f1;"), EOpNull},
+    // uvec4 textureProjLod(usampler3D, vec4, float)
+    {TSymbolUniqueId(669), ImmutableString("textureProjLod"), TExtension::UNDEFINED,
+     kParameters_us31_vf4_f1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLod(us31;vf4;f1;"), EOpNull},
+    // float textureProjLod(sampler2DShadow, vec4, float)
+    {TSymbolUniqueId(670), ImmutableString("textureProjLod"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf4_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureProjLod(s2s1;vf4;f1;"), EOpNull},
+    // vec4 textureProjLodOffset(sampler2D, vec3, float, ivec2)
+    {TSymbolUniqueId(671), ImmutableString("textureProjLodOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vf3_f1_vi2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLodOffset(s21;vf3;f1;vi2;"), EOpNull},
+    // ivec4 textureProjLodOffset(isampler2D, vec3, float, ivec2)
+    {TSymbolUniqueId(672), ImmutableString("textureProjLodOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vf3_f1_vi2, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLodOffset(is21;vf3;f1;vi2;"), EOpNull},
+    // uvec4 textureProjLodOffset(usampler2D, vec3, float, ivec2)
+    {TSymbolUniqueId(673), ImmutableString("textureProjLodOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vf3_f1_vi2, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLodOffset(us21;vf3;f1;vi2;"), EOpNull},
+    // vec4 textureProjLodOffset(sampler2D, vec4, float, ivec2)
+    {TSymbolUniqueId(674), ImmutableString("textureProjLodOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vf4_f1_vi2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLodOffset(s21;vf4;f1;vi2;"), EOpNull},
+    // ivec4 textureProjLodOffset(isampler2D, vec4, float, ivec2)
+    {TSymbolUniqueId(675), ImmutableString("textureProjLodOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vf4_f1_vi2, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLodOffset(is21;vf4;f1;vi2;"), EOpNull},
+    // uvec4 textureProjLodOffset(usampler2D, vec4, float, ivec2)
+    {TSymbolUniqueId(676), ImmutableString("textureProjLodOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vf4_f1_vi2, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLodOffset(us21;vf4;f1;vi2;"), EOpNull},
+    // vec4 textureProjLodOffset(sampler3D, vec4, float, ivec3)
+    {TSymbolUniqueId(677), ImmutableString("textureProjLodOffset"), TExtension::UNDEFINED,
+     kParameters_s31_vf4_f1_vi3, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLodOffset(s31;vf4;f1;vi3;"), EOpNull},
+    // ivec4 textureProjLodOffset(isampler3D, vec4, float, ivec3)
+    {TSymbolUniqueId(678), ImmutableString("textureProjLodOffset"), TExtension::UNDEFINED,
+     kParameters_is31_vf4_f1_vi3, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLodOffset(is31;vf4;f1;vi3;"), EOpNull},
+    // uvec4 textureProjLodOffset(usampler3D, vec4, float, ivec3)
+    {TSymbolUniqueId(679), ImmutableString("textureProjLodOffset"), TExtension::UNDEFINED,
+     kParameters_us31_vf4_f1_vi3, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjLodOffset(us31;vf4;f1;vi3;"), EOpNull},
+    // float textureProjLodOffset(sampler2DShadow, vec4, float, ivec2)
+    {TSymbolUniqueId(680), ImmutableString("textureProjLodOffset"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf4_f1_vi2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureProjLodOffset(s2s1;vf4;f1;vi2;"), EOpNull},
+    // vec4 texelFetch(sampler2D, ivec2, int)
+    {TSymbolUniqueId(681), ImmutableString("texelFetch"), TExtension::UNDEFINED,
+     kParameters_s21_vi2_i1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetch(s21;vi2;i1;"), EOpNull},
+    // ivec4 texelFetch(isampler2D, ivec2, int)
+    {TSymbolUniqueId(682), ImmutableString("texelFetch"), TExtension::UNDEFINED,
+     kParameters_is21_vi2_i1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetch(is21;vi2;i1;"), EOpNull},
+    // uvec4 texelFetch(usampler2D, ivec2, int)
+    {TSymbolUniqueId(683), ImmutableString("texelFetch"), TExtension::UNDEFINED,
+     kParameters_us21_vi2_i1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetch(us21;vi2;i1;"), EOpNull},
+    // vec4 texelFetch(sampler3D, ivec3, int)
+    {TSymbolUniqueId(684), ImmutableString("texelFetch"), TExtension::UNDEFINED,
+     kParameters_s31_vi3_i1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetch(s31;vi3;i1;"), EOpNull},
+    // ivec4 texelFetch(isampler3D, ivec3, int)
+    {TSymbolUniqueId(685), ImmutableString("texelFetch"), TExtension::UNDEFINED,
+     kParameters_is31_vi3_i1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetch(is31;vi3;i1;"), EOpNull},
+    // uvec4 texelFetch(usampler3D, ivec3, int)
+    {TSymbolUniqueId(686), ImmutableString("texelFetch"), TExtension::UNDEFINED,
+     kParameters_us31_vi3_i1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetch(us31;vi3;i1;"), EOpNull},
+    // vec4 texelFetch(sampler2DArray, ivec3, int)
+    {TSymbolUniqueId(687), ImmutableString("texelFetch"), TExtension::UNDEFINED,
+     kParameters_s2a1_vi3_i1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetch(s2a1;vi3;i1;"), EOpNull},
+    // ivec4 texelFetch(isampler2DArray, ivec3, int)
+    {TSymbolUniqueId(688), ImmutableString("texelFetch"), TExtension::UNDEFINED,
+     kParameters_is2a1_vi3_i1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetch(is2a1;vi3;i1;"), EOpNull},
+    // uvec4 texelFetch(usampler2DArray, ivec3, int)
+    {TSymbolUniqueId(689), ImmutableString("texelFetch"), TExtension::UNDEFINED,
+     kParameters_us2a1_vi3_i1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetch(us2a1;vi3;i1;"), EOpNull},
+    // vec4 texelFetch(samplerExternalOES, ivec2, int)
+    {TSymbolUniqueId(690), ImmutableString("texelFetch"), TExtension::UNDEFINED,
+     kParameters_sext1_vi2_i1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetch(sext1;vi2;i1;"), EOpNull},
+    // vec4 texelFetch(__samplerExternal2DY2YEXT, ivec2, int)
+    {TSymbolUniqueId(691), ImmutableString("texelFetch"), TExtension::EXT_YUV_target,
+     kParameters_sext2y2y1_vi2_i1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetch(sext2y2y1;vi2;i1;"), EOpNull},
+    // vec4 texelFetchOffset(sampler2D, ivec2, int, ivec2)
+    {TSymbolUniqueId(692), ImmutableString("texelFetchOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vi2_i1_vi2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetchOffset(s21;vi2;i1;vi2;"), EOpNull},
+    // ivec4 texelFetchOffset(isampler2D, ivec2, int, ivec2)
+    {TSymbolUniqueId(693), ImmutableString("texelFetchOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vi2_i1_vi2, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetchOffset(is21;vi2;i1;vi2;"), EOpNull},
+    // uvec4 texelFetchOffset(usampler2D, ivec2, int, ivec2)
+    {TSymbolUniqueId(694), ImmutableString("texelFetchOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vi2_i1_vi2, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetchOffset(us21;vi2;i1;vi2;"), EOpNull},
+    // vec4 texelFetchOffset(sampler3D, ivec3, int, ivec3)
+    {TSymbolUniqueId(695), ImmutableString("texelFetchOffset"), TExtension::UNDEFINED,
+     kParameters_s31_vi3_i1_vi3, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetchOffset(s31;vi3;i1;vi3;"), EOpNull},
+    // ivec4 texelFetchOffset(isampler3D, ivec3, int, ivec3)
+    {TSymbolUniqueId(696), ImmutableString("texelFetchOffset"), TExtension::UNDEFINED,
+     kParameters_is31_vi3_i1_vi3, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetchOffset(is31;vi3;i1;vi3;"), EOpNull},
+    // uvec4 texelFetchOffset(usampler3D, ivec3, int, ivec3)
+    {TSymbolUniqueId(697), ImmutableString("texelFetchOffset"), TExtension::UNDEFINED,
+     kParameters_us31_vi3_i1_vi3, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetchOffset(us31;vi3;i1;vi3;"), EOpNull},
+    // vec4 texelFetchOffset(sampler2DArray, ivec3, int, ivec2)
+    {TSymbolUniqueId(698), ImmutableString("texelFetchOffset"), TExtension::UNDEFINED,
+     kParameters_s2a1_vi3_i1_vi2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetchOffset(s2a1;vi3;i1;vi2;"), EOpNull},
+    // ivec4 texelFetchOffset(isampler2DArray, ivec3, int, ivec2)
+    {TSymbolUniqueId(699), ImmutableString("texelFetchOffset"), TExtension::UNDEFINED,
+     kParameters_is2a1_vi3_i1_vi2, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetchOffset(is2a1;vi3;i1;vi2;"), EOpNull},
+    // uvec4 texelFetchOffset(usampler2DArray, ivec3, int, ivec2)
+    {TSymbolUniqueId(700), ImmutableString("texelFetchOffset"), TExtension::UNDEFINED,
+     kParameters_us2a1_vi3_i1_vi2, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetchOffset(us2a1;vi3;i1;vi2;"), EOpNull},
+    // vec4 textureGrad(sampler2D, vec2, vec2, vec2)
+    {TSymbolUniqueId(701), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_s21_vf2_vf2_vf2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGrad(s21;vf2;vf2;vf2;"), EOpNull},
+    // ivec4 textureGrad(isampler2D, vec2, vec2, vec2)
+    {TSymbolUniqueId(702), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_is21_vf2_vf2_vf2, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGrad(is21;vf2;vf2;vf2;"), EOpNull},
+    // uvec4 textureGrad(usampler2D, vec2, vec2, vec2)
+    {TSymbolUniqueId(703), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_us21_vf2_vf2_vf2, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGrad(us21;vf2;vf2;vf2;"), EOpNull},
+    // vec4 textureGrad(sampler3D, vec3, vec3, vec3)
+    {TSymbolUniqueId(704), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_s31_vf3_vf3_vf3, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGrad(s31;vf3;vf3;vf3;"), EOpNull},
+    // ivec4 textureGrad(isampler3D, vec3, vec3, vec3)
+    {TSymbolUniqueId(705), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_is31_vf3_vf3_vf3, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGrad(is31;vf3;vf3;vf3;"), EOpNull},
+    // uvec4 textureGrad(usampler3D, vec3, vec3, vec3)
+    {TSymbolUniqueId(706), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_us31_vf3_vf3_vf3, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGrad(us31;vf3;vf3;vf3;"), EOpNull},
+    // vec4 textureGrad(samplerCube, vec3, vec3, vec3)
+    {TSymbolUniqueId(707), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_sC1_vf3_vf3_vf3, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGrad(sC1;vf3;vf3;vf3;"), EOpNull},
+    // ivec4 textureGrad(isamplerCube, vec3, vec3, vec3)
+    {TSymbolUniqueId(708), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_isC1_vf3_vf3_vf3, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGrad(isC1;vf3;vf3;vf3;"), EOpNull},
+    // uvec4 textureGrad(usamplerCube, vec3, vec3, vec3)
+    {TSymbolUniqueId(709), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_usC1_vf3_vf3_vf3, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGrad(usC1;vf3;vf3;vf3;"), EOpNull},
+    // float textureGrad(sampler2DShadow, vec3, vec2, vec2)
+    {TSymbolUniqueId(710), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf3_vf2_vf2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureGrad(s2s1;vf3;vf2;vf2;"), EOpNull},
+    // float textureGrad(samplerCubeShadow, vec4, vec3, vec3)
+    {TSymbolUniqueId(711), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_sCs1_vf4_vf3_vf3, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureGrad(sCs1;vf4;vf3;vf3;"), EOpNull},
+    // vec4 textureGrad(sampler2DArray, vec3, vec2, vec2)
+    {TSymbolUniqueId(712), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_s2a1_vf3_vf2_vf2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGrad(s2a1;vf3;vf2;vf2;"), EOpNull},
+    // ivec4 textureGrad(isampler2DArray, vec3, vec2, vec2)
+    {TSymbolUniqueId(713), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_is2a1_vf3_vf2_vf2, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGrad(is2a1;vf3;vf2;vf2;"), EOpNull},
+    // uvec4 textureGrad(usampler2DArray, vec3, vec2, vec2)
+    {TSymbolUniqueId(714), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_us2a1_vf3_vf2_vf2, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGrad(us2a1;vf3;vf2;vf2;"), EOpNull},
+    // float textureGrad(sampler2DArrayShadow, vec4, vec2, vec2)
+    {TSymbolUniqueId(715), ImmutableString("textureGrad"), TExtension::UNDEFINED,
+     kParameters_s2as1_vf4_vf2_vf2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureGrad(s2as1;vf4;vf2;vf2;"), EOpNull},
+    // vec4 textureGradOffset(sampler2D, vec2, vec2, vec2, ivec2)
+    {TSymbolUniqueId(716), ImmutableString("textureGradOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vf2_vf2_vf2_vi2, 5, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGradOffset(s21;vf2;vf2;vf2;vi2;"), EOpNull},
+    // ivec4 textureGradOffset(isampler2D, vec2, vec2, vec2, ivec2)
+    {TSymbolUniqueId(717), ImmutableString("textureGradOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vf2_vf2_vf2_vi2, 5, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGradOffset(is21;vf2;vf2;vf2;vi2;"), EOpNull},
+    // uvec4 textureGradOffset(usampler2D, vec2, vec2, vec2, ivec2)
+    {TSymbolUniqueId(718), ImmutableString("textureGradOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vf2_vf2_vf2_vi2, 5, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGradOffset(us21;vf2;vf2;vf2;vi2;"), EOpNull},
+    // vec4 textureGradOffset(sampler3D, vec3, vec3, vec3, ivec3)
+    {TSymbolUniqueId(719), ImmutableString("textureGradOffset"), TExtension::UNDEFINED,
+     kParameters_s31_vf3_vf3_vf3_vi3, 5, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGradOffset(s31;vf3;vf3;vf3;vi3;"), EOpNull},
+    // ivec4 textureGradOffset(isampler3D, vec3, vec3, vec3, ivec3)
+    {TSymbolUniqueId(720), ImmutableString("textureGradOffset"), TExtension::UNDEFINED,
+     kParameters_is31_vf3_vf3_vf3_vi3, 5, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGradOffset(is31;vf3;vf3;vf3;vi3;"), EOpNull},
+    // uvec4 textureGradOffset(usampler3D, vec3, vec3, vec3, ivec3)
+    {TSymbolUniqueId(721), ImmutableString("textureGradOffset"), TExtension::UNDEFINED,
+     kParameters_us31_vf3_vf3_vf3_vi3, 5, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGradOffset(us31;vf3;vf3;vf3;vi3;"), EOpNull},
+    // float textureGradOffset(sampler2DShadow, vec3, vec2, vec2, ivec2)
+    {TSymbolUniqueId(722), ImmutableString("textureGradOffset"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf3_vf2_vf2_vi2, 5,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureGradOffset(s2s1;vf3;vf2;vf2;vi2;"), EOpNull},
+    // vec4 textureGradOffset(sampler2DArray, vec3, vec2, vec2, ivec2)
+    {TSymbolUniqueId(723), ImmutableString("textureGradOffset"), TExtension::UNDEFINED,
+     kParameters_s2a1_vf3_vf2_vf2_vi2, 5,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGradOffset(s2a1;vf3;vf2;vf2;vi2;"), EOpNull},
+    // ivec4 textureGradOffset(isampler2DArray, vec3, vec2, vec2, ivec2)
+    {TSymbolUniqueId(724), ImmutableString("textureGradOffset"), TExtension::UNDEFINED,
+     kParameters_is2a1_vf3_vf2_vf2_vi2, 5, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGradOffset(is2a1;vf3;vf2;vf2;vi2;"), EOpNull},
+    // uvec4 textureGradOffset(usampler2DArray, vec3, vec2, vec2, ivec2)
+    {TSymbolUniqueId(725), ImmutableString("textureGradOffset"), TExtension::UNDEFINED,
+     kParameters_us2a1_vf3_vf2_vf2_vi2, 5,
+     StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGradOffset(us2a1;vf3;vf2;vf2;vi2;"), EOpNull},
+    // float textureGradOffset(sampler2DArrayShadow, vec4, vec2, vec2, ivec2)
+    {TSymbolUniqueId(726), ImmutableString("textureGradOffset"), TExtension::UNDEFINED,
+     kParameters_s2as1_vf4_vf2_vf2_vi2, 5,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureGradOffset(s2as1;vf4;vf2;vf2;vi2;"), EOpNull},
+    // vec4 textureProjGrad(sampler2D, vec3, vec2, vec2)
+    {TSymbolUniqueId(727), ImmutableString("textureProjGrad"), TExtension::UNDEFINED,
+     kParameters_s21_vf3_vf2_vf2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGrad(s21;vf3;vf2;vf2;"), EOpNull},
+    // ivec4 textureProjGrad(isampler2D, vec3, vec2, vec2)
+    {TSymbolUniqueId(728), ImmutableString("textureProjGrad"), TExtension::UNDEFINED,
+     kParameters_is21_vf3_vf2_vf2, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGrad(is21;vf3;vf2;vf2;"), EOpNull},
+    // uvec4 textureProjGrad(usampler2D, vec3, vec2, vec2)
+    {TSymbolUniqueId(729), ImmutableString("textureProjGrad"), TExtension::UNDEFINED,
+     kParameters_us21_vf3_vf2_vf2, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGrad(us21;vf3;vf2;vf2;"), EOpNull},
+    // vec4 textureProjGrad(sampler2D, vec4, vec2, vec2)
+    {TSymbolUniqueId(730), ImmutableString("textureProjGrad"), TExtension::UNDEFINED,
+     kParameters_s21_vf4_vf2_vf2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGrad(s21;vf4;vf2;vf2;"), EOpNull},
+    // ivec4 textureProjGrad(isampler2D, vec4, vec2, vec2)
+    {TSymbolUniqueId(731), ImmutableString("textureProjGrad"), TExtension::UNDEFINED,
+     kParameters_is21_vf4_vf2_vf2, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGrad(is21;vf4;vf2;vf2;"), EOpNull},
+    // uvec4 textureProjGrad(usampler2D, vec4, vec2, vec2)
+    {TSymbolUniqueId(732), ImmutableString("textureProjGrad"), TExtension::UNDEFINED,
+     kParameters_us21_vf4_vf2_vf2, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGrad(us21;vf4;vf2;vf2;"), EOpNull},
+    // vec4 textureProjGrad(sampler3D, vec4, vec3, vec3)
+    {TSymbolUniqueId(733), ImmutableString("textureProjGrad"), TExtension::UNDEFINED,
+     kParameters_s31_vf4_vf3_vf3, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGrad(s31;vf4;vf3;vf3;"), EOpNull},
+    // ivec4 textureProjGrad(isampler3D, vec4, vec3, vec3)
+    {TSymbolUniqueId(734), ImmutableString("textureProjGrad"), TExtension::UNDEFINED,
+     kParameters_is31_vf4_vf3_vf3, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGrad(is31;vf4;vf3;vf3;"), EOpNull},
+    // uvec4 textureProjGrad(usampler3D, vec4, vec3, vec3)
+    {TSymbolUniqueId(735), ImmutableString("textureProjGrad"), TExtension::UNDEFINED,
+     kParameters_us31_vf4_vf3_vf3, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGrad(us31;vf4;vf3;vf3;"), EOpNull},
+    // float textureProjGrad(sampler2DShadow, vec4, vec2, vec2)
+    {TSymbolUniqueId(736), ImmutableString("textureProjGrad"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf4_vf2_vf2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureProjGrad(s2s1;vf4;vf2;vf2;"), EOpNull},
+    // vec4 textureProjGradOffset(sampler2D, vec3, vec2, vec2, ivec2)
+    {TSymbolUniqueId(737), ImmutableString("textureProjGradOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vf3_vf2_vf2_vi2, 5, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGradOffset(s21;vf3;vf2;vf2;vi2;"), EOpNull},
+    // ivec4 textureProjGradOffset(isampler2D, vec3, vec2, vec2, ivec2)
+    {TSymbolUniqueId(738), ImmutableString("textureProjGradOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vf3_vf2_vf2_vi2, 5, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGradOffset(is21;vf3;vf2;vf2;vi2;"), EOpNull},
+    // uvec4 textureProjGradOffset(usampler2D, vec3, vec2, vec2, ivec2)
+    {TSymbolUniqueId(739), ImmutableString("textureProjGradOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vf3_vf2_vf2_vi2, 5, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGradOffset(us21;vf3;vf2;vf2;vi2;"), EOpNull},
+    // vec4 textureProjGradOffset(sampler2D, vec4, vec2, vec2, ivec2)
+    {TSymbolUniqueId(740), ImmutableString("textureProjGradOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vf4_vf2_vf2_vi2, 5, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGradOffset(s21;vf4;vf2;vf2;vi2;"), EOpNull},
+    // ivec4 textureProjGradOffset(isampler2D, vec4, vec2, vec2, ivec2)
+    {TSymbolUniqueId(741), ImmutableString("textureProjGradOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vf4_vf2_vf2_vi2, 5, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGradOffset(is21;vf4;vf2;vf2;vi2;"), EOpNull},
+    // uvec4 textureProjGradOffset(usampler2D, vec4, vec2, vec2, ivec2)
+    {TSymbolUniqueId(742), ImmutableString("textureProjGradOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vf4_vf2_vf2_vi2, 5, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGradOffset(us21;vf4;vf2;vf2;vi2;"), EOpNull},
+    // vec4 textureProjGradOffset(sampler3D, vec4, vec3, vec3, ivec3)
+    {TSymbolUniqueId(743), ImmutableString("textureProjGradOffset"), TExtension::UNDEFINED,
+     kParameters_s31_vf4_vf3_vf3_vi3, 5, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGradOffset(s31;vf4;vf3;vf3;vi3;"), EOpNull},
+    // ivec4 textureProjGradOffset(isampler3D, vec4, vec3, vec3, ivec3)
+    {TSymbolUniqueId(744), ImmutableString("textureProjGradOffset"), TExtension::UNDEFINED,
+     kParameters_is31_vf4_vf3_vf3_vi3, 5, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGradOffset(is31;vf4;vf3;vf3;vi3;"), EOpNull},
+    // uvec4 textureProjGradOffset(usampler3D, vec4, vec3, vec3, ivec3)
+    {TSymbolUniqueId(745), ImmutableString("textureProjGradOffset"), TExtension::UNDEFINED,
+     kParameters_us31_vf4_vf3_vf3_vi3, 5, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureProjGradOffset(us31;vf4;vf3;vf3;vi3;"), EOpNull},
+    // float textureProjGradOffset(sampler2DShadow, vec4, vec2, vec2, ivec2)
+    {TSymbolUniqueId(746), ImmutableString("textureProjGradOffset"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf4_vf2_vf2_vi2, 5,
+     StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("textureProjGradOffset(s2s1;vf4;vf2;vf2;vi2;"), EOpNull},
+    // uint atomicCounter(atomic_uint)
+    {TSymbolUniqueId(747), ImmutableString("atomicCounter"), TExtension::UNDEFINED, kParameters_ac1,
+     1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicCounter(ac1;"), EOpNull},
+    // uint atomicCounterIncrement(atomic_uint)
+    {TSymbolUniqueId(748), ImmutableString("atomicCounterIncrement"), TExtension::UNDEFINED,
+     kParameters_ac1, 1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicCounterIncrement(ac1;"), EOpNull},
+    // uint atomicCounterDecrement(atomic_uint)
+    {TSymbolUniqueId(749), ImmutableString("atomicCounterDecrement"), TExtension::UNDEFINED,
+     kParameters_ac1, 1, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicCounterDecrement(ac1;"), EOpNull},
+    // uint atomicAdd(inout uint, uint)
+    {TSymbolUniqueId(750), ImmutableString("atomicAdd"), TExtension::UNDEFINED,
+     kParameters_inout_u1_u1, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicAdd(u1;u1;"), EOpNull},
+    // int atomicAdd(inout int, int)
+    {TSymbolUniqueId(751), ImmutableString("atomicAdd"), TExtension::UNDEFINED,
+     kParameters_inout_i1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicAdd(i1;i1;"), EOpNull},
+    // uint atomicMin(inout uint, uint)
+    {TSymbolUniqueId(752), ImmutableString("atomicMin"), TExtension::UNDEFINED,
+     kParameters_inout_u1_u1, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicMin(u1;u1;"), EOpNull},
+    // int atomicMin(inout int, int)
+    {TSymbolUniqueId(753), ImmutableString("atomicMin"), TExtension::UNDEFINED,
+     kParameters_inout_i1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicMin(i1;i1;"), EOpNull},
+    // uint atomicMax(inout uint, uint)
+    {TSymbolUniqueId(754), ImmutableString("atomicMax"), TExtension::UNDEFINED,
+     kParameters_inout_u1_u1, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicMax(u1;u1;"), EOpNull},
+    // int atomicMax(inout int, int)
+    {TSymbolUniqueId(755), ImmutableString("atomicMax"), TExtension::UNDEFINED,
+     kParameters_inout_i1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicMax(i1;i1;"), EOpNull},
+    // uint atomicAnd(inout uint, uint)
+    {TSymbolUniqueId(756), ImmutableString("atomicAnd"), TExtension::UNDEFINED,
+     kParameters_inout_u1_u1, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicAnd(u1;u1;"), EOpNull},
+    // int atomicAnd(inout int, int)
+    {TSymbolUniqueId(757), ImmutableString("atomicAnd"), TExtension::UNDEFINED,
+     kParameters_inout_i1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicAnd(i1;i1;"), EOpNull},
+    // uint atomicOr(inout uint, uint)
+    {TSymbolUniqueId(758), ImmutableString("atomicOr"), TExtension::UNDEFINED,
+     kParameters_inout_u1_u1, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicOr(u1;u1;"), EOpNull},
+    // int atomicOr(inout int, int)
+    {TSymbolUniqueId(759), ImmutableString("atomicOr"), TExtension::UNDEFINED,
+     kParameters_inout_i1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicOr(i1;i1;"), EOpNull},
+    // uint atomicXor(inout uint, uint)
+    {TSymbolUniqueId(760), ImmutableString("atomicXor"), TExtension::UNDEFINED,
+     kParameters_inout_u1_u1, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicXor(u1;u1;"), EOpNull},
+    // int atomicXor(inout int, int)
+    {TSymbolUniqueId(761), ImmutableString("atomicXor"), TExtension::UNDEFINED,
+     kParameters_inout_i1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicXor(i1;i1;"), EOpNull},
+    // uint atomicExchange(inout uint, uint)
+    {TSymbolUniqueId(762), ImmutableString("atomicExchange"), TExtension::UNDEFINED,
+     kParameters_inout_u1_u1, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicExchange(u1;u1;"), EOpNull},
+    // int atomicExchange(inout int, int)
+    {TSymbolUniqueId(763), ImmutableString("atomicExchange"), TExtension::UNDEFINED,
+     kParameters_inout_i1_i1, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicExchange(i1;i1;"), EOpNull},
+    // uint atomicCompSwap(inout uint, uint, uint)
+    {TSymbolUniqueId(764), ImmutableString("atomicCompSwap"), TExtension::UNDEFINED,
+     kParameters_inout_u1_u1_u1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicCompSwap(u1;u1;u1;"), EOpNull},
+    // int atomicCompSwap(inout int, int, int)
+    {TSymbolUniqueId(765), ImmutableString("atomicCompSwap"), TExtension::UNDEFINED,
+     kParameters_inout_i1_i1_i1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("atomicCompSwap(i1;i1;i1;"), EOpNull},
+    // void imageStore(image2D, ivec2, vec4)
+    {TSymbolUniqueId(766), ImmutableString("imageStore"), TExtension::UNDEFINED,
+     kParameters_im21_vi2_vf4, 3, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imageStore(im21;vi2;vf4;"), EOpNull},
+    // void imageStore(iimage2D, ivec2, ivec4)
+    {TSymbolUniqueId(767), ImmutableString("imageStore"), TExtension::UNDEFINED,
+     kParameters_iim21_vi2_vi4, 3, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imageStore(iim21;vi2;vi4;"), EOpNull},
+    // void imageStore(uimage2D, ivec2, uvec4)
+    {TSymbolUniqueId(768), ImmutableString("imageStore"), TExtension::UNDEFINED,
+     kParameters_uim21_vi2_vu4, 3, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imageStore(uim21;vi2;vu4;"), EOpNull},
+    // void imageStore(image3D, ivec3, vec4)
+    {TSymbolUniqueId(769), ImmutableString("imageStore"), TExtension::UNDEFINED,
+     kParameters_im31_vi3_vf4, 3, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imageStore(im31;vi3;vf4;"), EOpNull},
+    // void imageStore(iimage3D, ivec3, ivec4)
+    {TSymbolUniqueId(770), ImmutableString("imageStore"), TExtension::UNDEFINED,
+     kParameters_iim31_vi3_vi4, 3, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imageStore(iim31;vi3;vi4;"), EOpNull},
+    // void imageStore(uimage3D, ivec3, uvec4)
+    {TSymbolUniqueId(771), ImmutableString("imageStore"), TExtension::UNDEFINED,
+     kParameters_uim31_vi3_vu4, 3, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imageStore(uim31;vi3;vu4;"), EOpNull},
+    // void imageStore(image2DArray, ivec3, vec4)
+    {TSymbolUniqueId(772), ImmutableString("imageStore"), TExtension::UNDEFINED,
+     kParameters_im2a1_vi3_vf4, 3, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imageStore(im2a1;vi3;vf4;"), EOpNull},
+    // void imageStore(iimage2DArray, ivec3, ivec4)
+    {TSymbolUniqueId(773), ImmutableString("imageStore"), TExtension::UNDEFINED,
+     kParameters_iim2a1_vi3_vi4, 3, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imageStore(iim2a1;vi3;vi4;"), EOpNull},
+    // void imageStore(uimage2DArray, ivec3, uvec4)
+    {TSymbolUniqueId(774), ImmutableString("imageStore"), TExtension::UNDEFINED,
+     kParameters_uim2a1_vi3_vu4, 3, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imageStore(uim2a1;vi3;vu4;"), EOpNull},
+    // void imageStore(imageCube, ivec3, vec4)
+    {TSymbolUniqueId(775), ImmutableString("imageStore"), TExtension::UNDEFINED,
+     kParameters_imc1_vi3_vf4, 3, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imageStore(imc1;vi3;vf4;"), EOpNull},
+    // void imageStore(iimageCube, ivec3, ivec4)
+    {TSymbolUniqueId(776), ImmutableString("imageStore"), TExtension::UNDEFINED,
+     kParameters_iimc1_vi3_vi4, 3, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imageStore(iimc1;vi3;vi4;"), EOpNull},
+    // void imageStore(uimageCube, ivec3, uvec4)
+    {TSymbolUniqueId(777), ImmutableString("imageStore"), TExtension::UNDEFINED,
+     kParameters_uimc1_vi3_vu4, 3, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("imageStore(uimc1;vi3;vu4;"), EOpNull},
+    // vec4 imageLoad(image2D, ivec2)
+    {TSymbolUniqueId(778), ImmutableString("imageLoad"), TExtension::UNDEFINED,
+     kParameters_im21_vi2, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("imageLoad(im21;vi2;"), EOpNull},
+    // ivec4 imageLoad(iimage2D, ivec2)
+    {TSymbolUniqueId(779), ImmutableString("imageLoad"), TExtension::UNDEFINED,
+     kParameters_iim21_vi2, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("imageLoad(iim21;vi2;"), EOpNull},
+    // uvec4 imageLoad(uimage2D, ivec2)
+    {TSymbolUniqueId(780), ImmutableString("imageLoad"), TExtension::UNDEFINED,
+     kParameters_uim21_vi2, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("imageLoad(uim21;vi2;"), EOpNull},
+    // vec4 imageLoad(image3D, ivec3)
+    {TSymbolUniqueId(781), ImmutableString("imageLoad"), TExtension::UNDEFINED,
+     kParameters_im31_vi3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("imageLoad(im31;vi3;"), EOpNull},
+    // ivec4 imageLoad(iimage3D, ivec3)
+    {TSymbolUniqueId(782), ImmutableString("imageLoad"), TExtension::UNDEFINED,
+     kParameters_iim31_vi3, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("imageLoad(iim31;vi3;"), EOpNull},
+    // uvec4 imageLoad(uimage3D, ivec3)
+    {TSymbolUniqueId(783), ImmutableString("imageLoad"), TExtension::UNDEFINED,
+     kParameters_uim31_vi3, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("imageLoad(uim31;vi3;"), EOpNull},
+    // vec4 imageLoad(image2DArray, ivec3)
+    {TSymbolUniqueId(784), ImmutableString("imageLoad"), TExtension::UNDEFINED,
+     kParameters_im2a1_vi3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("imageLoad(im2a1;vi3;"), EOpNull},
+    // ivec4 imageLoad(iimage2DArray, ivec3)
+    {TSymbolUniqueId(785), ImmutableString("imageLoad"), TExtension::UNDEFINED,
+     kParameters_iim2a1_vi3, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("imageLoad(iim2a1;vi3;"), EOpNull},
+    // uvec4 imageLoad(uimage2DArray, ivec3)
+    {TSymbolUniqueId(786), ImmutableString("imageLoad"), TExtension::UNDEFINED,
+     kParameters_uim2a1_vi3, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("imageLoad(uim2a1;vi3;"), EOpNull},
+    // vec4 imageLoad(imageCube, ivec3)
+    {TSymbolUniqueId(787), ImmutableString("imageLoad"), TExtension::UNDEFINED,
+     kParameters_imc1_vi3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("imageLoad(imc1;vi3;"), EOpNull},
+    // ivec4 imageLoad(iimageCube, ivec3)
+    {TSymbolUniqueId(788), ImmutableString("imageLoad"), TExtension::UNDEFINED,
+     kParameters_iimc1_vi3, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("imageLoad(iimc1;vi3;"), EOpNull},
+    // uvec4 imageLoad(uimageCube, ivec3)
+    {TSymbolUniqueId(789), ImmutableString("imageLoad"), TExtension::UNDEFINED,
+     kParameters_uimc1_vi3, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("imageLoad(uimc1;vi3;"), EOpNull},
+    // ivec2 imageSize(image2D)
+    {TSymbolUniqueId(790), ImmutableString("imageSize"), TExtension::UNDEFINED, kParameters_im21, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("imageSize(im21;"),
+     EOpNull},
+    // ivec2 imageSize(iimage2D)
+    {TSymbolUniqueId(791), ImmutableString("imageSize"), TExtension::UNDEFINED, kParameters_iim21,
+     1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("imageSize(iim21;"), EOpNull},
+    // ivec2 imageSize(uimage2D)
+    {TSymbolUniqueId(792), ImmutableString("imageSize"), TExtension::UNDEFINED, kParameters_uim21,
+     1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("imageSize(uim21;"), EOpNull},
+    // ivec3 imageSize(image3D)
+    {TSymbolUniqueId(793), ImmutableString("imageSize"), TExtension::UNDEFINED, kParameters_im31, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(), ImmutableString("imageSize(im31;"),
+     EOpNull},
+    // ivec3 imageSize(iimage3D)
+    {TSymbolUniqueId(794), ImmutableString("imageSize"), TExtension::UNDEFINED, kParameters_iim31,
+     1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("imageSize(iim31;"), EOpNull},
+    // ivec3 imageSize(uimage3D)
+    {TSymbolUniqueId(795), ImmutableString("imageSize"), TExtension::UNDEFINED, kParameters_uim31,
+     1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("imageSize(uim31;"), EOpNull},
+    // ivec3 imageSize(image2DArray)
+    {TSymbolUniqueId(796), ImmutableString("imageSize"), TExtension::UNDEFINED, kParameters_im2a1,
+     1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("imageSize(im2a1;"), EOpNull},
+    // ivec3 imageSize(iimage2DArray)
+    {TSymbolUniqueId(797), ImmutableString("imageSize"), TExtension::UNDEFINED, kParameters_iim2a1,
+     1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("imageSize(iim2a1;"), EOpNull},
+    // ivec3 imageSize(uimage2DArray)
+    {TSymbolUniqueId(798), ImmutableString("imageSize"), TExtension::UNDEFINED, kParameters_uim2a1,
+     1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+     ImmutableString("imageSize(uim2a1;"), EOpNull},
+    // ivec2 imageSize(imageCube)
+    {TSymbolUniqueId(799), ImmutableString("imageSize"), TExtension::UNDEFINED, kParameters_imc1, 1,
+     StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(), ImmutableString("imageSize(imc1;"),
+     EOpNull},
+    // ivec2 imageSize(iimageCube)
+    {TSymbolUniqueId(800), ImmutableString("imageSize"), TExtension::UNDEFINED, kParameters_iimc1,
+     1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("imageSize(iimc1;"), EOpNull},
+    // ivec2 imageSize(uimageCube)
+    {TSymbolUniqueId(801), ImmutableString("imageSize"), TExtension::UNDEFINED, kParameters_uimc1,
+     1, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+     ImmutableString("imageSize(uimc1;"), EOpNull},
+    // void memoryBarrier()
+    {TSymbolUniqueId(802), ImmutableString("memoryBarrier"), TExtension::UNDEFINED, nullptr, 0,
+     StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("memoryBarrier("),
+     EOpMemoryBarrier},
+    // void memoryBarrierAtomicCounter()
+    {TSymbolUniqueId(803), ImmutableString("memoryBarrierAtomicCounter"), TExtension::UNDEFINED,
+     nullptr, 0, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("memoryBarrierAtomicCounter("), EOpMemoryBarrierAtomicCounter},
+    // void memoryBarrierBuffer()
+    {TSymbolUniqueId(804), ImmutableString("memoryBarrierBuffer"), TExtension::UNDEFINED, nullptr,
+     0, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("memoryBarrierBuffer("), EOpMemoryBarrierBuffer},
+    // void memoryBarrierImage()
+    {TSymbolUniqueId(805), ImmutableString("memoryBarrierImage"), TExtension::UNDEFINED, nullptr, 0,
+     StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("memoryBarrierImage("), EOpMemoryBarrierImage},
+    // vec4 texelFetch(sampler2DMS, ivec2, int)
+    {TSymbolUniqueId(806), ImmutableString("texelFetch"), TExtension::UNDEFINED,
+     kParameters_s2ms1_vi2_i1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetch(s2ms1;vi2;i1;"), EOpNull},
+    // ivec4 texelFetch(isampler2DMS, ivec2, int)
+    {TSymbolUniqueId(807), ImmutableString("texelFetch"), TExtension::UNDEFINED,
+     kParameters_is2ms1_vi2_i1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetch(is2ms1;vi2;i1;"), EOpNull},
+    // uvec4 texelFetch(usampler2DMS, ivec2, int)
+    {TSymbolUniqueId(808), ImmutableString("texelFetch"), TExtension::UNDEFINED,
+     kParameters_us2ms1_vi2_i1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("texelFetch(us2ms1;vi2;i1;"), EOpNull},
+    // vec4 textureGather(sampler2D, vec2)
+    {TSymbolUniqueId(809), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_s21_vf2, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(s21;vf2;"), EOpNull},
+    // ivec4 textureGather(isampler2D, vec2)
+    {TSymbolUniqueId(810), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_is21_vf2, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(is21;vf2;"), EOpNull},
+    // uvec4 textureGather(usampler2D, vec2)
+    {TSymbolUniqueId(811), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_us21_vf2, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(us21;vf2;"), EOpNull},
+    // vec4 textureGather(sampler2D, vec2, int)
+    {TSymbolUniqueId(812), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_s21_vf2_i1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(s21;vf2;i1;"), EOpNull},
+    // ivec4 textureGather(isampler2D, vec2, int)
+    {TSymbolUniqueId(813), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_is21_vf2_i1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(is21;vf2;i1;"), EOpNull},
+    // uvec4 textureGather(usampler2D, vec2, int)
+    {TSymbolUniqueId(814), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_us21_vf2_i1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(us21;vf2;i1;"), EOpNull},
+    // vec4 textureGather(sampler2DArray, vec3)
+    {TSymbolUniqueId(815), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_s2a1_vf3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(s2a1;vf3;"), EOpNull},
+    // ivec4 textureGather(isampler2DArray, vec3)
+    {TSymbolUniqueId(816), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_is2a1_vf3, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(is2a1;vf3;"), EOpNull},
+    // uvec4 textureGather(usampler2DArray, vec3)
+    {TSymbolUniqueId(817), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_us2a1_vf3, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(us2a1;vf3;"), EOpNull},
+    // vec4 textureGather(sampler2DArray, vec3, int)
+    {TSymbolUniqueId(818), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_s2a1_vf3_i1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(s2a1;vf3;i1;"), EOpNull},
+    // ivec4 textureGather(isampler2DArray, vec3, int)
+    {TSymbolUniqueId(819), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_is2a1_vf3_i1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(is2a1;vf3;i1;"), EOpNull},
+    // uvec4 textureGather(usampler2DArray, vec3, int)
+    {TSymbolUniqueId(820), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_us2a1_vf3_i1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(us2a1;vf3;i1;"), EOpNull},
+    // vec4 textureGather(samplerCube, vec3)
+    {TSymbolUniqueId(821), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_sC1_vf3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(sC1;vf3;"), EOpNull},
+    // ivec4 textureGather(isamplerCube, vec3)
+    {TSymbolUniqueId(822), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_isC1_vf3, 2, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(isC1;vf3;"), EOpNull},
+    // uvec4 textureGather(usamplerCube, vec3)
+    {TSymbolUniqueId(823), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_usC1_vf3, 2, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(usC1;vf3;"), EOpNull},
+    // vec4 textureGather(samplerCube, vec3, int)
+    {TSymbolUniqueId(824), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_sC1_vf3_i1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(sC1;vf3;i1;"), EOpNull},
+    // ivec4 textureGather(isamplerCube, vec3, int)
+    {TSymbolUniqueId(825), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_isC1_vf3_i1, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(isC1;vf3;i1;"), EOpNull},
+    // uvec4 textureGather(usamplerCube, vec3, int)
+    {TSymbolUniqueId(826), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_usC1_vf3_i1, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(usC1;vf3;i1;"), EOpNull},
+    // vec4 textureGather(sampler2DShadow, vec2)
+    {TSymbolUniqueId(827), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf2, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(s2s1;vf2;"), EOpNull},
+    // vec4 textureGather(sampler2DShadow, vec2, float)
+    {TSymbolUniqueId(828), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf2_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(s2s1;vf2;f1;"), EOpNull},
+    // vec4 textureGather(sampler2DArrayShadow, vec3)
+    {TSymbolUniqueId(829), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_s2as1_vf3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(s2as1;vf3;"), EOpNull},
+    // vec4 textureGather(sampler2DArrayShadow, vec3, float)
+    {TSymbolUniqueId(830), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_s2as1_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(s2as1;vf3;f1;"), EOpNull},
+    // vec4 textureGather(samplerCubeShadow, vec3)
+    {TSymbolUniqueId(831), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_sCs1_vf3, 2, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(sCs1;vf3;"), EOpNull},
+    // vec4 textureGather(samplerCubeShadow, vec3, float)
+    {TSymbolUniqueId(832), ImmutableString("textureGather"), TExtension::UNDEFINED,
+     kParameters_sCs1_vf3_f1, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGather(sCs1;vf3;f1;"), EOpNull},
+    // vec4 textureGatherOffset(sampler2D, vec2, ivec2)
+    {TSymbolUniqueId(833), ImmutableString("textureGatherOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vf2_vi2, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGatherOffset(s21;vf2;vi2;"), EOpNull},
+    // ivec4 textureGatherOffset(isampler2D, vec2, ivec2)
+    {TSymbolUniqueId(834), ImmutableString("textureGatherOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vf2_vi2, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGatherOffset(is21;vf2;vi2;"), EOpNull},
+    // uvec4 textureGatherOffset(usampler2D, vec2, ivec2)
+    {TSymbolUniqueId(835), ImmutableString("textureGatherOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vf2_vi2, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGatherOffset(us21;vf2;vi2;"), EOpNull},
+    // vec4 textureGatherOffset(sampler2D, vec2, ivec2, int)
+    {TSymbolUniqueId(836), ImmutableString("textureGatherOffset"), TExtension::UNDEFINED,
+     kParameters_s21_vf2_vi2_i1, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGatherOffset(s21;vf2;vi2;i1;"), EOpNull},
+    // ivec4 textureGatherOffset(isampler2D, vec2, ivec2, int)
+    {TSymbolUniqueId(837), ImmutableString("textureGatherOffset"), TExtension::UNDEFINED,
+     kParameters_is21_vf2_vi2_i1, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGatherOffset(is21;vf2;vi2;i1;"), EOpNull},
+    // uvec4 textureGatherOffset(usampler2D, vec2, ivec2, int)
+    {TSymbolUniqueId(838), ImmutableString("textureGatherOffset"), TExtension::UNDEFINED,
+     kParameters_us21_vf2_vi2_i1, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGatherOffset(us21;vf2;vi2;i1;"), EOpNull},
+    // vec4 textureGatherOffset(sampler2DArray, vec3, ivec2)
+    {TSymbolUniqueId(839), ImmutableString("textureGatherOffset"), TExtension::UNDEFINED,
+     kParameters_s2a1_vf3_vi2, 3, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGatherOffset(s2a1;vf3;vi2;"), EOpNull},
+    // ivec4 textureGatherOffset(isampler2DArray, vec3, ivec2)
+    {TSymbolUniqueId(840), ImmutableString("textureGatherOffset"), TExtension::UNDEFINED,
+     kParameters_is2a1_vf3_vi2, 3, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGatherOffset(is2a1;vf3;vi2;"), EOpNull},
+    // uvec4 textureGatherOffset(usampler2DArray, vec3, ivec2)
+    {TSymbolUniqueId(841), ImmutableString("textureGatherOffset"), TExtension::UNDEFINED,
+     kParameters_us2a1_vf3_vi2, 3, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGatherOffset(us2a1;vf3;vi2;"), EOpNull},
+    // vec4 textureGatherOffset(sampler2DArray, vec3, ivec2, int)
+    {TSymbolUniqueId(842), ImmutableString("textureGatherOffset"), TExtension::UNDEFINED,
+     kParameters_s2a1_vf3_vi2_i1, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGatherOffset(s2a1;vf3;vi2;i1;"), EOpNull},
+    // ivec4 textureGatherOffset(isampler2DArray, vec3, ivec2, int)
+    {TSymbolUniqueId(843), ImmutableString("textureGatherOffset"), TExtension::UNDEFINED,
+     kParameters_is2a1_vf3_vi2_i1, 4, StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGatherOffset(is2a1;vf3;vi2;i1;"), EOpNull},
+    // uvec4 textureGatherOffset(usampler2DArray, vec3, ivec2, int)
+    {TSymbolUniqueId(844), ImmutableString("textureGatherOffset"), TExtension::UNDEFINED,
+     kParameters_us2a1_vf3_vi2_i1, 4, StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGatherOffset(us2a1;vf3;vi2;i1;"), EOpNull},
+    // vec4 textureGatherOffset(sampler2DShadow, vec2, float, ivec2)
+    {TSymbolUniqueId(845), ImmutableString("textureGatherOffset"), TExtension::UNDEFINED,
+     kParameters_s2s1_vf2_f1_vi2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGatherOffset(s2s1;vf2;f1;vi2;"), EOpNull},
+    // vec4 textureGatherOffset(sampler2DArrayShadow, vec3, float, ivec2)
+    {TSymbolUniqueId(846), ImmutableString("textureGatherOffset"), TExtension::UNDEFINED,
+     kParameters_s2as1_vf3_f1_vi2, 4, StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+     ImmutableString("textureGatherOffset(s2as1;vf3;f1;vi2;"), EOpNull},
+    // void barrier()
+    {TSymbolUniqueId(847), ImmutableString("barrier"), TExtension::UNDEFINED, nullptr, 0,
+     StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("barrier("),
+     EOpBarrier},
+    // void memoryBarrierShared()
+    {TSymbolUniqueId(848), ImmutableString("memoryBarrierShared"), TExtension::UNDEFINED, nullptr,
+     0, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("memoryBarrierShared("), EOpMemoryBarrierShared},
+    // void groupMemoryBarrier()
+    {TSymbolUniqueId(849), ImmutableString("groupMemoryBarrier"), TExtension::UNDEFINED, nullptr, 0,
+     StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("groupMemoryBarrier("), EOpGroupMemoryBarrier},
+    // void EmitVertex()
+    {TSymbolUniqueId(850), ImmutableString("EmitVertex"), TExtension::EXT_geometry_shader, nullptr,
+     0, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(), ImmutableString("EmitVertex("),
+     EOpEmitVertex},
+    // void EndPrimitive()
+    {TSymbolUniqueId(851), ImmutableString("EndPrimitive"), TExtension::EXT_geometry_shader,
+     nullptr, 0, StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+     ImmutableString("EndPrimitive("), EOpEndPrimitive},
+};
+
+constexpr BuiltInFunctionEntry kFunctionEntries[] = {
+    {&kFunctions[803], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[9], COMMON_BUILTINS, 0},
+    {&kFunctions[54], ESSL3_BUILTINS, 0},
+    {&kFunctions[62], COMMON_BUILTINS, 0},
+    {&kFunctions[730], ESSL3_BUILTINS, 0},
+    {&kFunctions[754], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[227], ESSL3_BUILTINS, 0},
+    {&kFunctions[718], ESSL3_BUILTINS, 0},
+    {&kFunctions[447], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[471], ESSL1_BUILTINS, BuiltInCondition::kARB_texture_rectangle},
+    {&kFunctions[177], COMMON_BUILTINS, 0},
+    {&kFunctions[758], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[459], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[601], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[485], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {&kFunctions[378], COMMON_BUILTINS, 0},
+    {&kFunctions[355], ESSL3_BUILTINS, 0},
+    {&kFunctions[829], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[553], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[78], COMMON_BUILTINS, 0},
+    {&kFunctions[793], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[820], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[567], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kEXT_YUV_target},
+    {&kFunctions[176], ESSL3_BUILTINS, 0},
+    {&kFunctions[344], COMMON_BUILTINS, 0},
+    {&kFunctions[729], ESSL3_BUILTINS, 0},
+    {&kFunctions[692], ESSL3_BUILTINS, 0},
+    {&kFunctions[215], COMMON_BUILTINS, 0},
+    {&kFunctions[611], ESSL3_BUILTINS, 0},
+    {&kFunctions[792], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[423], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[266], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[61], COMMON_BUILTINS, 0},
+    {&kFunctions[633], ESSL3_BUILTINS, 0},
+    {&kFunctions[557], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[450], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[794], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[514], ESSL3_BUILTINS, 0},
+    {&kFunctions[275], COMMON_BUILTINS, 0},
+    {&kFunctions[391], COMMON_BUILTINS, 0},
+    {&kFunctions[173], ESSL3_BUILTINS, 0},
+    {&kFunctions[632], ESSL3_BUILTINS, 0},
+    {&kFunctions[281], COMMON_BUILTINS, 0},
+    {&kFunctions[421], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[436], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[626], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[671], ESSL3_BUILTINS, 0},
+    {&kFunctions[407], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[602], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[486], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {&kFunctions[681], ESSL3_BUILTINS, 0},
+    {&kFunctions[315], ESSL3_BUILTINS, 0},
+    {&kFunctions[420], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[426], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[774], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[248], ESSL3_BUILTINS, 0},
+    {&kFunctions[75], COMMON_BUILTINS, 0},
+    {&kFunctions[134], COMMON_BUILTINS, 0},
+    {&kFunctions[469], ESSL1_BUILTINS, BuiltInCondition::kOES_EGL_image_external},
+    {&kFunctions[368], COMMON_BUILTINS, 0},
+    {&kFunctions[306], ESSL3_BUILTINS, 0},
+    {&kFunctions[753], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[700], ESSL3_BUILTINS, 0},
+    {&kFunctions[189], ESSL3_BUILTINS, 0},
+    {&kFunctions[405], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[23], COMMON_BUILTINS, 0},
+    {&kFunctions[717], ESSL3_BUILTINS, 0},
+    {&kFunctions[584], ESSL3_BUILTINS, 0},
+    {&kFunctions[531], ESSL3_BUILTINS, 0},
+    {&kFunctions[187], ESSL3_BUILTINS, 0},
+    {&kFunctions[804], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[589], ESSL3_BUILTINS, 0},
+    {&kFunctions[622], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[303], ESSL3_BUILTINS, 0},
+    {&kFunctions[265], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[583], ESSL3_BUILTINS, 0},
+    {&kFunctions[357], ESSL3_BUILTINS, 0},
+    {&kFunctions[389], COMMON_BUILTINS, 0},
+    {&kFunctions[657], ESSL3_BUILTINS, 0},
+    {&kFunctions[438], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[343], COMMON_BUILTINS, 0},
+    {&kFunctions[393], COMMON_BUILTINS, 0},
+    {&kFunctions[50], ESSL3_BUILTINS, 0},
+    {&kFunctions[84], COMMON_BUILTINS, 0},
+    {&kFunctions[336], COMMON_BUILTINS, 0},
+    {&kFunctions[359], COMMON_BUILTINS, 0},
+    {&kFunctions[58], ESSL3_BUILTINS, 0},
+    {&kFunctions[226], ESSL3_BUILTINS, 0},
+    {&kFunctions[799], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[221], COMMON_BUILTINS, 0},
+    {&kFunctions[540], ESSL3_BUILTINS, BuiltInCondition::kEXT_YUV_target},
+    {&kFunctions[413], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[279], COMMON_BUILTINS, 0},
+    {&kFunctions[756], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[524], ESSL3_BUILTINS, 0},
+    {&kFunctions[769], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[22], COMMON_BUILTINS, 0},
+    {&kFunctions[156], COMMON_BUILTINS, 0},
+    {&kFunctions[574], ESSL3_BUILTINS, 0},
+    {&kFunctions[121], COMMON_BUILTINS, 0},
+    {&kFunctions[195], ESSL3_BUILTINS, 0},
+    {&kFunctions[388], COMMON_BUILTINS, 0},
+    {&kFunctions[167], ESSL3_BUILTINS, 0},
+    {&kFunctions[619], ESSL3_BUILTINS, 0},
+    {&kFunctions[150], ESSL3_BUILTINS, 0},
+    {&kFunctions[311], ESSL3_BUILTINS, 0},
+    {&kFunctions[354], COMMON_BUILTINS, 0},
+    {&kFunctions[559], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[579], ESSL3_BUILTINS, 0},
+    {&kFunctions[499], ESSL1_BUILTINS, BuiltInCondition::kVertexShader},
+    {&kFunctions[689], ESSL3_BUILTINS, BuiltInCondition::kOES_EGL_image_external_essl3},
+    {&kFunctions[16], COMMON_BUILTINS, 0},
+    {&kFunctions[129], COMMON_BUILTINS, 0},
+    {&kFunctions[255], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[308], ESSL3_BUILTINS, 0},
+    {&kFunctions[89], COMMON_BUILTINS, 0},
+    {&kFunctions[585], ESSL3_BUILTINS, 0},
+    {&kFunctions[70], COMMON_BUILTINS, 0},
+    {&kFunctions[513], ESSL3_BUILTINS, 0},
+    {&kFunctions[725], ESSL3_BUILTINS, 0},
+    {&kFunctions[282], COMMON_BUILTINS, 0},
+    {&kFunctions[762], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[635], ESSL3_BUILTINS, 0},
+    {&kFunctions[448], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[408], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[814], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[575], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[677], ESSL3_BUILTINS, 0},
+    {&kFunctions[186], ESSL3_BUILTINS, 0},
+    {&kFunctions[347], ESSL3_BUILTINS, 0},
+    {&kFunctions[267], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[663], ESSL3_BUILTINS, 0},
+    {&kFunctions[329], ESSL3_BUILTINS, 0},
+    {&kFunctions[201], COMMON_BUILTINS, 0},
+    {&kFunctions[526], ESSL3_BUILTINS, 0},
+    {&kFunctions[394], COMMON_BUILTINS, 0},
+    {&kFunctions[705], ESSL3_BUILTINS, 0},
+    {&kFunctions[169], ESSL3_BUILTINS, 0},
+    {&kFunctions[456], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[747], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[624], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[179], COMMON_BUILTINS, 0},
+    {&kFunctions[199], COMMON_BUILTINS, 0},
+    {&kFunctions[361], COMMON_BUILTINS, 0},
+    {&kFunctions[175], ESSL3_BUILTINS, 0},
+    {&kFunctions[151], ESSL3_BUILTINS, 0},
+    {&kFunctions[738], ESSL3_BUILTINS, 0},
+    {&kFunctions[840], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[87], COMMON_BUILTINS, 0},
+    {&kFunctions[235], ESSL3_BUILTINS, 0},
+    {&kFunctions[766], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[648], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[148], ESSL3_BUILTINS, 0},
+    {&kFunctions[617], ESSL3_BUILTINS, 0},
+    {&kFunctions[512], ESSL3_BUILTINS, 0},
+    {&kFunctions[26], COMMON_BUILTINS, 0},
+    {&kFunctions[164], ESSL3_BUILTINS, 0},
+    {&kFunctions[51], ESSL3_BUILTINS, 0},
+    {&kFunctions[325], ESSL3_BUILTINS, 0},
+    {&kFunctions[502], ESSL3_BUILTINS, 0},
+    {&kFunctions[464], ESSL1_BUILTINS, 0},
+    {&kFunctions[565], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_EGL_image_external_essl3},
+    {&kFunctions[511], ESSL3_BUILTINS, 0},
+    {&kFunctions[808], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[364], ESSL3_BUILTINS, 0},
+    {&kFunctions[796], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[133], COMMON_BUILTINS, 0},
+    {&kFunctions[403], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[224], ESSL3_BUILTINS, 0},
+    {&kFunctions[680], ESSL3_BUILTINS, 0},
+    {&kFunctions[82], COMMON_BUILTINS, 0},
+    {&kFunctions[563], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[297], COMMON_BUILTINS, 0},
+    {&kFunctions[117], ESSL3_BUILTINS, 0},
+    {&kFunctions[365], ESSL3_BUILTINS, 0},
+    {&kFunctions[613], ESSL3_BUILTINS, 0},
+    {&kFunctions[127], COMMON_BUILTINS, 0},
+    {&kFunctions[309], ESSL3_BUILTINS, 0},
+    {&kFunctions[122], COMMON_BUILTINS, 0},
+    {&kFunctions[461], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[676], ESSL3_BUILTINS, 0},
+    {&kFunctions[19], COMMON_BUILTINS, 0},
+    {&kFunctions[516], ESSL3_BUILTINS, 0},
+    {&kFunctions[816], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[826], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[520], ESSL3_BUILTINS, 0},
+    {&kFunctions[384], COMMON_BUILTINS, 0},
+    {&kFunctions[241], ESSL3_BUILTINS, 0},
+    {&kFunctions[398], COMMON_BUILTINS, 0},
+    {&kFunctions[106], COMMON_BUILTINS, 0},
+    {&kFunctions[101], ESSL3_BUILTINS, 0},
+    {&kFunctions[11], COMMON_BUILTINS, 0},
+    {&kFunctions[533], ESSL3_BUILTINS, 0},
+    {&kFunctions[724], ESSL3_BUILTINS, 0},
+    {&kFunctions[528], ESSL3_BUILTINS, 0},
+    {&kFunctions[544], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[506], ESSL3_BUILTINS, 0},
+    {&kFunctions[688], ESSL3_BUILTINS, 0},
+    {&kFunctions[314], ESSL3_BUILTINS, 0},
+    {&kFunctions[370], COMMON_BUILTINS, 0},
+    {&kFunctions[674], ESSL3_BUILTINS, 0},
+    {&kFunctions[572], ESSL3_BUILTINS, 0},
+    {&kFunctions[203], COMMON_BUILTINS, 0},
+    {&kFunctions[332], COMMON_BUILTINS, 0},
+    {&kFunctions[683], ESSL3_BUILTINS, 0},
+    {&kFunctions[722], ESSL3_BUILTINS, 0},
+    {&kFunctions[110], ESSL3_BUILTINS, 0},
+    {&kFunctions[5], COMMON_BUILTINS, 0},
+    {&kFunctions[98], COMMON_BUILTINS, 0},
+    {&kFunctions[800], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[371], COMMON_BUILTINS, 0},
+    {&kFunctions[603], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[487], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {&kFunctions[836], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[240], ESSL3_BUILTINS, 0},
+    {&kFunctions[238], ESSL3_BUILTINS, 0},
+    {&kFunctions[69], COMMON_BUILTINS, 0},
+    {&kFunctions[752], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[131], COMMON_BUILTINS, 0},
+    {&kFunctions[231], ESSL3_BUILTINS, 0},
+    {&kFunctions[463], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[652], ESSL3_BUILTINS, 0},
+    {&kFunctions[93], ESSL3_BUILTINS, 0},
+    {&kFunctions[554], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[733], ESSL3_BUILTINS, 0},
+    {&kFunctions[763], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[460], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[773], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[94], ESSL3_BUILTINS, 0},
+    {&kFunctions[321], ESSL3_BUILTINS, 0},
+    {&kFunctions[428], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[171], ESSL3_BUILTINS, 0},
+    {&kFunctions[280], COMMON_BUILTINS, 0},
+    {&kFunctions[638], ESSL3_BUILTINS, 0},
+    {&kFunctions[734], ESSL3_BUILTINS, 0},
+    {&kFunctions[30], COMMON_BUILTINS, 0},
+    {&kFunctions[256], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[598], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[482], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {&kFunctions[662], ESSL3_BUILTINS, 0},
+    {&kFunctions[500], ESSL1_BUILTINS, BuiltInCondition::kVertexShader},
+    {&kFunctions[693], ESSL3_BUILTINS, 0},
+    {&kFunctions[362], COMMON_BUILTINS, 0},
+    {&kFunctions[760], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[525], ESSL3_BUILTINS, 0},
+    {&kFunctions[138], COMMON_BUILTINS, 0},
+    {&kFunctions[346], ESSL3_BUILTINS, 0},
+    {&kFunctions[143], ESSL3_BUILTINS, 0},
+    {&kFunctions[183], COMMON_BUILTINS, 0},
+    {&kFunctions[714], ESSL3_BUILTINS, 0},
+    {&kFunctions[161], COMMON_BUILTINS, 0},
+    {&kFunctions[305], ESSL3_BUILTINS, 0},
+    {&kFunctions[142], ESSL3_BUILTINS, 0},
+    {&kFunctions[200], COMMON_BUILTINS, 0},
+    {&kFunctions[481], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[239], ESSL3_BUILTINS, 0},
+    {&kFunctions[95], ESSL3_BUILTINS, 0},
+    {&kFunctions[645], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[204], COMMON_BUILTINS, 0},
+    {&kFunctions[152], ESSL3_BUILTINS, 0},
+    {&kFunctions[162], COMMON_BUILTINS, 0},
+    {&kFunctions[387], ESSL3_BUILTINS, 0},
+    {&kFunctions[761], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[208], ESSL3_BUILTINS, 0},
+    {&kFunctions[631], ESSL3_BUILTINS, 0},
+    {&kFunctions[2], COMMON_BUILTINS, 0},
+    {&kFunctions[260], ESSL3_BUILTINS, 0},
+    {&kFunctions[552], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[223], ESSL3_BUILTINS, 0},
+    {&kFunctions[319], ESSL3_BUILTINS, 0},
+    {&kFunctions[607], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[491], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {&kFunctions[335], COMMON_BUILTINS, 0},
+    {&kFunctions[543], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[141], COMMON_BUILTINS, 0},
+    {&kFunctions[510], ESSL3_BUILTINS, 0},
+    {&kFunctions[649], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[350], COMMON_BUILTINS, 0},
+    {&kFunctions[381], COMMON_BUILTINS, 0},
+    {&kFunctions[791], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[846], ESSL3_1_BUILTINS, BuiltInCondition::kComputeShader},
+    {&kFunctions[49], ESSL3_BUILTINS, 0},
+    {&kFunctions[765], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[402], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[630], ESSL3_BUILTINS, 0},
+    {&kFunctions[781], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[771], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[751], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[473], ESSL1_BUILTINS, BuiltInCondition::kARB_texture_rectangle},
+    {&kFunctions[379], COMMON_BUILTINS, 0},
+    {&kFunctions[44], ESSL3_BUILTINS, 0},
+    {&kFunctions[819], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[558], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[242], ESSL3_BUILTINS, 0},
+    {&kFunctions[449], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[123], COMMON_BUILTINS, 0},
+    {&kFunctions[99], COMMON_BUILTINS, 0},
+    {&kFunctions[324], ESSL3_BUILTINS, 0},
+    {&kFunctions[254], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[348], ESSL3_BUILTINS, 0},
+    {&kFunctions[695], ESSL3_BUILTINS, 0},
+    {&kFunctions[222], COMMON_BUILTINS, 0},
+    {&kFunctions[445], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[569], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kEXT_YUV_target},
+    {&kFunctions[673], ESSL3_BUILTINS, 0},
+    {&kFunctions[472], ESSL1_BUILTINS, BuiltInCondition::kARB_texture_rectangle},
+    {&kFunctions[108], ESSL3_BUILTINS, 0},
+    {&kFunctions[414], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[128], COMMON_BUILTINS, 0},
+    {&kFunctions[17], COMMON_BUILTINS, 0},
+    {&kFunctions[410], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[323], ESSL3_BUILTINS, 0},
+    {&kFunctions[330], ESSL3_BUILTINS, 0},
+    {&kFunctions[577], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[590], ESSL3_BUILTINS, 0},
+    {&kFunctions[211], COMMON_BUILTINS, 0},
+    {&kFunctions[92], ESSL3_BUILTINS, 0},
+    {&kFunctions[828], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[835], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[130], COMMON_BUILTINS, 0},
+    {&kFunctions[629], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[367], COMMON_BUILTINS, 0},
+    {&kFunctions[338], ESSL3_BUILTINS, 0},
+    {&kFunctions[57], ESSL3_BUILTINS, 0},
+    {&kFunctions[843], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[561], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[539], ESSL3_BUILTINS, BuiltInCondition::kEXT_YUV_target},
+    {&kFunctions[824], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[212], COMMON_BUILTINS, 0},
+    {&kFunctions[670], ESSL3_BUILTINS, 0},
+    {&kFunctions[515], ESSL3_BUILTINS, 0},
+    {&kFunctions[249], ESSL3_BUILTINS, 0},
+    {&kFunctions[726], ESSL3_BUILTINS, 0},
+    {&kFunctions[10], COMMON_BUILTINS, 0},
+    {&kFunctions[277], COMMON_BUILTINS, 0},
+    {&kFunctions[327], ESSL3_BUILTINS, 0},
+    {&kFunctions[809], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[38], ESSL3_BUILTINS, 0},
+    {&kFunctions[582], ESSL3_BUILTINS, 0},
+    {&kFunctions[620], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[73], COMMON_BUILTINS, 0},
+    {&kFunctions[376], COMMON_BUILTINS, 0},
+    {&kFunctions[345], COMMON_BUILTINS, 0},
+    {&kFunctions[41], ESSL3_BUILTINS, 0},
+    {&kFunctions[271], COMMON_BUILTINS, 0},
+    {&kFunctions[374], ESSL3_BUILTINS, 0},
+    {&kFunctions[547], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[91], COMMON_BUILTINS, 0},
+    {&kFunctions[21], COMMON_BUILTINS, 0},
+    {&kFunctions[372], COMMON_BUILTINS, 0},
+    {&kFunctions[789], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[470], ESSL1_BUILTINS, BuiltInCondition::kOES_EGL_image_external},
+    {&kFunctions[509], ESSL3_BUILTINS, 0},
+    {&kFunctions[55], ESSL3_BUILTINS, 0},
+    {&kFunctions[304], ESSL3_BUILTINS, 0},
+    {&kFunctions[815], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[90], COMMON_BUILTINS, 0},
+    {&kFunctions[18], COMMON_BUILTINS, 0},
+    {&kFunctions[703], ESSL3_BUILTINS, 0},
+    {&kFunctions[114], ESSL3_BUILTINS, 0},
+    {&kFunctions[707], ESSL3_BUILTINS, 0},
+    {&kFunctions[1], COMMON_BUILTINS, 0},
+    {&kFunctions[550], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[409], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[740], ESSL3_BUILTINS, 0},
+    {&kFunctions[697], ESSL3_BUILTINS, 0},
+    {&kFunctions[741], ESSL3_BUILTINS, 0},
+    {&kFunctions[578], ESSL3_BUILTINS, 0},
+    {&kFunctions[202], COMMON_BUILTINS, 0},
+    {&kFunctions[163], ESSL3_BUILTINS, 0},
+    {&kFunctions[339], ESSL3_BUILTINS, 0},
+    {&kFunctions[149], ESSL3_BUILTINS, 0},
+    {&kFunctions[446], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[246], ESSL3_BUILTINS, 0},
+    {&kFunctions[366], ESSL3_BUILTINS, 0},
+    {&kFunctions[427], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[612], ESSL3_BUILTINS, 0},
+    {&kFunctions[214], COMMON_BUILTINS, 0},
+    {&kFunctions[112], ESSL3_BUILTINS, 0},
+    {&kFunctions[452], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[174], ESSL3_BUILTINS, 0},
+    {&kFunctions[748], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[52], ESSL3_BUILTINS, 0},
+    {&kFunctions[13], COMMON_BUILTINS, 0},
+    {&kFunctions[333], COMMON_BUILTINS, 0},
+    {&kFunctions[259], ESSL3_BUILTINS, 0},
+    {&kFunctions[158], COMMON_BUILTINS, 0},
+    {&kFunctions[76], COMMON_BUILTINS, 0},
+    {&kFunctions[146], ESSL3_BUILTINS, 0},
+    {&kFunctions[136], COMMON_BUILTINS, 0},
+    {&kFunctions[696], ESSL3_BUILTINS, 0},
+    {&kFunctions[433], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[147], ESSL3_BUILTINS, 0},
+    {&kFunctions[805], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[258], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[236], ESSL3_BUILTINS, 0},
+    {&kFunctions[441], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[588], ESSL3_BUILTINS, 0},
+    {&kFunctions[0], COMMON_BUILTINS, 0},
+    {&kFunctions[576], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[467], ESSL1_BUILTINS, 0},
+    {&kFunctions[610], ESSL3_BUILTINS, 0},
+    {&kFunctions[340], COMMON_BUILTINS, 0},
+    {&kFunctions[382], COMMON_BUILTINS, 0},
+    {&kFunctions[768], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[68], COMMON_BUILTINS, 0},
+    {&kFunctions[81], COMMON_BUILTINS, 0},
+    {&kFunctions[536], ESSL3_BUILTINS, BuiltInCondition::kOES_EGL_image_external_essl3},
+    {&kFunctions[784], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[639], ESSL3_BUILTINS, 0},
+    {&kFunctions[404], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[431], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[358], COMMON_BUILTINS, 0},
+    {&kFunctions[682], ESSL3_BUILTINS, 0},
+    {&kFunctions[100], ESSL3_BUILTINS, 0},
+    {&kFunctions[328], ESSL3_BUILTINS, 0},
+    {&kFunctions[844], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[233], ESSL3_BUILTINS, 0},
+    {&kFunctions[188], ESSL3_BUILTINS, 0},
+    {&kFunctions[591], ESSL3_BUILTINS, 0},
+    {&kFunctions[71], COMMON_BUILTINS, 0},
+    {&kFunctions[817], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[349], COMMON_BUILTINS, 0},
+    {&kFunctions[419], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[191], ESSL3_BUILTINS, 0},
+    {&kFunctions[545], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[650], ESSL3_BUILTINS, 0},
+    {&kFunctions[140], COMMON_BUILTINS, 0},
+    {&kFunctions[656], ESSL3_BUILTINS, 0},
+    {&kFunctions[599], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[483], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {&kFunctions[712], ESSL3_BUILTINS, 0},
+    {&kFunctions[822], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[474], ESSL1_BUILTINS, BuiltInCondition::kEXT_shader_texture_lod},
+    {&kFunctions[566], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_EGL_image_external_essl3},
+    {&kFunctions[571], ESSL3_BUILTINS, 0},
+    {&kFunctions[759], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[400], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[479], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[678], ESSL3_BUILTINS, 0},
+    {&kFunctions[666], ESSL3_BUILTINS, 0},
+    {&kFunctions[640], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[782], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[396], COMMON_BUILTINS, 0},
+    {&kFunctions[802], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[587], ESSL3_BUILTINS, 0},
+    {&kFunctions[685], ESSL3_BUILTINS, 0},
+    {&kFunctions[684], ESSL3_BUILTINS, 0},
+    {&kFunctions[527], ESSL3_BUILTINS, 0},
+    {&kFunctions[775], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[823], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[779], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[462], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[166], ESSL3_BUILTINS, 0},
+    {&kFunctions[735], ESSL3_BUILTINS, 0},
+    {&kFunctions[458], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[116], ESSL3_BUILTINS, 0},
+    {&kFunctions[686], ESSL3_BUILTINS, 0},
+    {&kFunctions[285], COMMON_BUILTINS, 0},
+    {&kFunctions[383], COMMON_BUILTINS, 0},
+    {&kFunctions[495], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kEXT_shader_texture_lod},
+    {&kFunctions[331], COMMON_BUILTINS, 0},
+    {&kFunctions[310], ESSL3_BUILTINS, 0},
+    {&kFunctions[801], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[435], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[497], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kEXT_shader_texture_lod},
+    {&kFunctions[356], ESSL3_BUILTINS, 0},
+    {&kFunctions[7], COMMON_BUILTINS, 0},
+    {&kFunctions[658], ESSL3_BUILTINS, 0},
+    {&kFunctions[24], COMMON_BUILTINS, 0},
+    {&kFunctions[422], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[757], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[53], ESSL3_BUILTINS, 0},
+    {&kFunctions[424], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[523], ESSL3_BUILTINS, 0},
+    {&kFunctions[298], COMMON_BUILTINS, 0},
+    {&kFunctions[776], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[320], ESSL3_BUILTINS, 0},
+    {&kFunctions[555], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[20], COMMON_BUILTINS, 0},
+    {&kFunctions[708], ESSL3_BUILTINS, 0},
+    {&kFunctions[168], ESSL3_BUILTINS, 0},
+    {&kFunctions[399], COMMON_BUILTINS, 0},
+    {&kFunctions[272], COMMON_BUILTINS, 0},
+    {&kFunctions[219], COMMON_BUILTINS, 0},
+    {&kFunctions[295], COMMON_BUILTINS, 0},
+    {&kFunctions[210], COMMON_BUILTINS, 0},
+    {&kFunctions[806], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[702], ESSL3_BUILTINS, 0},
+    {&kFunctions[746], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[102], ESSL3_BUILTINS, 0},
+    {&kFunctions[217], COMMON_BUILTINS, 0},
+    {&kFunctions[27], COMMON_BUILTINS, 0},
+    {&kFunctions[457], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[573], ESSL3_BUILTINS, 0},
+    {&kFunctions[322], ESSL3_BUILTINS, 0},
+    {&kFunctions[842], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[720], ESSL3_BUILTINS, 0},
+    {&kFunctions[616], ESSL3_BUILTINS, 0},
+    {&kFunctions[434], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[218], COMMON_BUILTINS, 0},
+    {&kFunctions[284], COMMON_BUILTINS, 0},
+    {&kFunctions[709], ESSL3_BUILTINS, 0},
+    {&kFunctions[786], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[206], ESSL3_BUILTINS, 0},
+    {&kFunctions[770], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[432], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[270], COMMON_BUILTINS, 0},
+    {&kFunctions[848], ESSL3_1_BUILTINS, BuiltInCondition::kComputeShader},
+    {&kFunctions[307], ESSL3_BUILTINS, 0},
+    {&kFunctions[841], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[549], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[833], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[465], ESSL1_BUILTINS, 0},
+    {&kFunctions[564], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_EGL_image_external_essl3},
+    {&kFunctions[97], COMMON_BUILTINS, 0},
+    {&kFunctions[225], ESSL3_BUILTINS, 0},
+    {&kFunctions[562], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[595], ESSL3_BUILTINS, 0},
+    {&kFunctions[153], ESSL3_BUILTINS, 0},
+    {&kFunctions[797], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[313], ESSL3_BUILTINS, 0},
+    {&kFunctions[56], ESSL3_BUILTINS, 0},
+    {&kFunctions[628], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[597], ESSL3_BUILTINS, BuiltInCondition::kEXT_YUV_target},
+    {&kFunctions[503], ESSL3_BUILTINS, 0},
+    {&kFunctions[810], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[243], ESSL3_BUILTINS, 0},
+    {&kFunctions[351], COMMON_BUILTINS, 0},
+    {&kFunctions[197], ESSL3_BUILTINS, 0},
+    {&kFunctions[170], ESSL3_BUILTINS, 0},
+    {&kFunctions[736], ESSL3_BUILTINS, 0},
+    {&kFunctions[262], ESSL3_BUILTINS, 0},
+    {&kFunctions[777], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[418], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[253], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[326], ESSL3_BUILTINS, 0},
+    {&kFunctions[317], ESSL3_BUILTINS, 0},
+    {&kFunctions[811], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[34], COMMON_BUILTINS, 0},
+    {&kFunctions[538], ESSL3_BUILTINS, BuiltInCondition::kEXT_YUV_target},
+    {&kFunctions[268], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[115], ESSL3_BUILTINS, 0},
+    {&kFunctions[437], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[300], COMMON_BUILTINS, 0},
+    {&kFunctions[232], ESSL3_BUILTINS, 0},
+    {&kFunctions[623], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[194], ESSL3_BUILTINS, 0},
+    {&kFunctions[287], COMMON_BUILTINS, 0},
+    {&kFunctions[425], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[655], ESSL3_BUILTINS, 0},
+    {&kFunctions[478], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[440], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[701], ESSL3_BUILTINS, 0},
+    {&kFunctions[67], COMMON_BUILTINS, 0},
+    {&kFunctions[59], ESSL3_BUILTINS, 0},
+    {&kFunctions[377], COMMON_BUILTINS, 0},
+    {&kFunctions[661], ESSL3_BUILTINS, 0},
+    {&kFunctions[104], COMMON_BUILTINS, 0},
+    {&kFunctions[352], COMMON_BUILTINS, 0},
+    {&kFunctions[312], ESSL3_BUILTINS, 0},
+    {&kFunctions[581], ESSL3_BUILTINS, 0},
+    {&kFunctions[830], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[157], COMMON_BUILTINS, 0},
+    {&kFunctions[411], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[609], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[493], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {&kFunctions[636], ESSL3_BUILTINS, 0},
+    {&kFunctions[216], COMMON_BUILTINS, 0},
+    {&kFunctions[288], COMMON_BUILTINS, 0},
+    {&kFunctions[64], COMMON_BUILTINS, 0},
+    {&kFunctions[600], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[484], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {&kFunctions[548], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[205], ESSL3_BUILTINS, 0},
+    {&kFunctions[397], COMMON_BUILTINS, 0},
+    {&kFunctions[466], ESSL1_BUILTINS, 0},
+    {&kFunctions[172], ESSL3_BUILTINS, 0},
+    {&kFunctions[302], ESSL3_BUILTINS, 0},
+    {&kFunctions[654], ESSL3_BUILTINS, 0},
+    {&kFunctions[505], ESSL3_BUILTINS, 0},
+    {&kFunctions[455], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[111], ESSL3_BUILTINS, 0},
+    {&kFunctions[530], ESSL3_BUILTINS, 0},
+    {&kFunctions[560], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[334], COMMON_BUILTINS, 0},
+    {&kFunctions[614], ESSL3_BUILTINS, 0},
+    {&kFunctions[83], COMMON_BUILTINS, 0},
+    {&kFunctions[33], COMMON_BUILTINS, 0},
+    {&kFunctions[618], ESSL3_BUILTINS, 0},
+    {&kFunctions[196], ESSL3_BUILTINS, 0},
+    {&kFunctions[780], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[521], ESSL3_BUILTINS, 0},
+    {&kFunctions[392], COMMON_BUILTINS, 0},
+    {&kFunctions[48], ESSL3_BUILTINS, 0},
+    {&kFunctions[790], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[439], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[198], COMMON_BUILTINS, 0},
+    {&kFunctions[135], COMMON_BUILTINS, 0},
+    {&kFunctions[25], COMMON_BUILTINS, 0},
+    {&kFunctions[32], COMMON_BUILTINS, 0},
+    {&kFunctions[193], ESSL3_BUILTINS, 0},
+    {&kFunctions[593], ESSL3_BUILTINS, 0},
+    {&kFunctions[395], COMMON_BUILTINS, 0},
+    {&kFunctions[480], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[699], ESSL3_BUILTINS, 0},
+    {&kFunctions[821], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[745], ESSL3_BUILTINS, 0},
+    {&kFunctions[159], COMMON_BUILTINS, 0},
+    {&kFunctions[518], ESSL3_BUILTINS, 0},
+    {&kFunctions[798], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[739], ESSL3_BUILTINS, 0},
+    {&kFunctions[606], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[490], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {&kFunctions[375], ESSL3_BUILTINS, 0},
+    {&kFunctions[125], COMMON_BUILTINS, 0},
+    {&kFunctions[40], ESSL3_BUILTINS, 0},
+    {&kFunctions[542], ESSL3_BUILTINS, BuiltInCondition::kEXT_YUV_target},
+    {&kFunctions[289], COMMON_BUILTINS, 0},
+    {&kFunctions[107], COMMON_BUILTINS, 0},
+    {&kFunctions[105], COMMON_BUILTINS, 0},
+    {&kFunctions[443], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[839], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[269], COMMON_BUILTINS, 0},
+    {&kFunctions[43], ESSL3_BUILTINS, 0},
+    {&kFunctions[244], ESSL3_BUILTINS, 0},
+    {&kFunctions[286], COMMON_BUILTINS, 0},
+    {&kFunctions[675], ESSL3_BUILTINS, 0},
+    {&kFunctions[429], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[672], ESSL3_BUILTINS, 0},
+    {&kFunctions[743], ESSL3_BUILTINS, 0},
+    {&kFunctions[37], ESSL3_BUILTINS, 0},
+    {&kFunctions[36], ESSL3_BUILTINS, 0},
+    {&kFunctions[442], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[261], ESSL3_BUILTINS, 0},
+    {&kFunctions[845], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[691], ESSL3_BUILTINS, 0},
+    {&kFunctions[342], COMMON_BUILTINS, 0},
+    {&kFunctions[72], COMMON_BUILTINS, 0},
+    {&kFunctions[220], COMMON_BUILTINS, 0},
+    {&kFunctions[139], COMMON_BUILTINS, 0},
+    {&kFunctions[385], ESSL3_BUILTINS, 0},
+    {&kFunctions[764], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[113], ESSL3_BUILTINS, 0},
+    {&kFunctions[813], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[750], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[247], ESSL3_BUILTINS, 0},
+    {&kFunctions[679], ESSL3_BUILTINS, 0},
+    {&kFunctions[637], ESSL3_BUILTINS, 0},
+    {&kFunctions[785], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[687], ESSL3_BUILTINS, 0},
+    {&kFunctions[668], ESSL3_BUILTINS, 0},
+    {&kFunctions[192], ESSL3_BUILTINS, 0},
+    {&kFunctions[556], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[341], COMMON_BUILTINS, 0},
+    {&kFunctions[3], COMMON_BUILTINS, 0},
+    {&kFunctions[713], ESSL3_BUILTINS, 0},
+    {&kFunctions[508], ESSL3_BUILTINS, 0},
+    {&kFunctions[293], COMMON_BUILTINS, 0},
+    {&kFunctions[477], ESSL1_BUILTINS, BuiltInCondition::kEXT_shader_texture_lod},
+    {&kFunctions[517], ESSL3_BUILTINS, 0},
+    {&kFunctions[390], COMMON_BUILTINS, 0},
+    {&kFunctions[849], ESSL3_1_BUILTINS, BuiltInCondition::kGeometryShader},
+    {&kFunctions[79], COMMON_BUILTINS, 0},
+    {&kFunctions[788], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[35], COMMON_BUILTINS, 0},
+    {&kFunctions[160], COMMON_BUILTINS, 0},
+    {&kFunctions[832], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[570], ESSL3_BUILTINS, 0},
+    {&kFunctions[294], COMMON_BUILTINS, 0},
+    {&kFunctions[430], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[706], ESSL3_BUILTINS, 0},
+    {&kFunctions[353], COMMON_BUILTINS, 0},
+    {&kFunctions[337], ESSL3_BUILTINS, 0},
+    {&kFunctions[615], ESSL3_BUILTINS, 0},
+    {&kFunctions[667], ESSL3_BUILTINS, 0},
+    {&kFunctions[229], ESSL3_BUILTINS, 0},
+    {&kFunctions[145], ESSL3_BUILTINS, 0},
+    {&kFunctions[468], ESSL1_BUILTINS, BuiltInCondition::kOES_EGL_image_external},
+    {&kFunctions[264], ESSL3_BUILTINS, 0},
+    {&kFunctions[386], ESSL3_BUILTINS, 0},
+    {&kFunctions[475], ESSL1_BUILTINS, BuiltInCondition::kEXT_shader_texture_lod},
+    {&kFunctions[737], ESSL3_BUILTINS, 0},
+    {&kFunctions[251], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[86], COMMON_BUILTINS, 0},
+    {&kFunctions[847], ESSL3_1_BUILTINS, BuiltInCondition::kComputeShader},
+    {&kFunctions[711], ESSL3_BUILTINS, 0},
+    {&kFunctions[39], ESSL3_BUILTINS, 0},
+    {&kFunctions[65], COMMON_BUILTINS, 0},
+    {&kFunctions[120], COMMON_BUILTINS, 0},
+    {&kFunctions[690], ESSL3_BUILTINS, BuiltInCondition::kEXT_YUV_target},
+    {&kFunctions[291], COMMON_BUILTINS, 0},
+    {&kFunctions[77], COMMON_BUILTINS, 0},
+    {&kFunctions[274], COMMON_BUILTINS, 0},
+    {&kFunctions[363], COMMON_BUILTINS, 0},
+    {&kFunctions[4], COMMON_BUILTINS, 0},
+    {&kFunctions[507], ESSL3_BUILTINS, 0},
+    {&kFunctions[276], COMMON_BUILTINS, 0},
+    {&kFunctions[451], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[230], ESSL3_BUILTINS, 0},
+    {&kFunctions[29], COMMON_BUILTINS, 0},
+    {&kFunctions[783], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[795], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[634], ESSL3_BUILTINS, 0},
+    {&kFunctions[360], COMMON_BUILTINS, 0},
+    {&kFunctions[694], ESSL3_BUILTINS, 0},
+    {&kFunctions[103], ESSL3_BUILTINS, 0},
+    {&kFunctions[369], COMMON_BUILTINS, 0},
+    {&kFunctions[728], ESSL3_BUILTINS, 0},
+    {&kFunctions[778], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[744], ESSL3_BUILTINS, 0},
+    {&kFunctions[373], ESSL3_BUILTINS, 0},
+    {&kFunctions[534], ESSL3_BUILTINS, 0},
+    {&kFunctions[401], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[119], ESSL3_BUILTINS, 0},
+    {&kFunctions[504], ESSL3_BUILTINS, 0},
+    {&kFunctions[178], COMMON_BUILTINS, 0},
+    {&kFunctions[605], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[489], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {&kFunctions[132], COMMON_BUILTINS, 0},
+    {&kFunctions[318], ESSL3_BUILTINS, 0},
+    {&kFunctions[772], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[621], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[669], ESSL3_BUILTINS, 0},
+    {&kFunctions[415], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[787], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[532], ESSL3_BUILTINS, 0},
+    {&kFunctions[118], ESSL3_BUILTINS, 0},
+    {&kFunctions[15], COMMON_BUILTINS, 0},
+    {&kFunctions[715], ESSL3_BUILTINS, 0},
+    {&kFunctions[137], COMMON_BUILTINS, 0},
+    {&kFunctions[88], COMMON_BUILTINS, 0},
+    {&kFunctions[66], COMMON_BUILTINS, 0},
+    {&kFunctions[546], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[604], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[488], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {&kFunctions[8], COMMON_BUILTINS, 0},
+    {&kFunctions[245], ESSL3_BUILTINS, 0},
+    {&kFunctions[184], ESSL3_BUILTINS, 0},
+    {&kFunctions[31], COMMON_BUILTINS, 0},
+    {&kFunctions[278], COMMON_BUILTINS, 0},
+    {&kFunctions[45], ESSL3_BUILTINS, 0},
+    {&kFunctions[292], COMMON_BUILTINS, 0},
+    {&kFunctions[406], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[727], ESSL3_BUILTINS, 0},
+    {&kFunctions[250], ESSL3_BUILTINS, 0},
+    {&kFunctions[825], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[596], ESSL3_BUILTINS, BuiltInCondition::kOES_EGL_image_external_essl3},
+    {&kFunctions[812], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[665], ESSL3_BUILTINS, 0},
+    {&kFunctions[12], COMMON_BUILTINS, 0},
+    {&kFunctions[228], ESSL3_BUILTINS, 0},
+    {&kFunctions[190], ESSL3_BUILTINS, 0},
+    {&kFunctions[209], COMMON_BUILTINS, 0},
+    {&kFunctions[807], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[704], ESSL3_BUILTINS, 0},
+    {&kFunctions[416], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[80], COMMON_BUILTINS, 0},
+    {&kFunctions[301], ESSL3_BUILTINS, 0},
+    {&kFunctions[659], ESSL3_BUILTINS, 0},
+    {&kFunctions[165], ESSL3_BUILTINS, 0},
+    {&kFunctions[837], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[296], COMMON_BUILTINS, 0},
+    {&kFunctions[252], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[716], ESSL3_BUILTINS, 0},
+    {&kFunctions[453], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[831], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[299], COMMON_BUILTINS, 0},
+    {&kFunctions[522], ESSL3_BUILTINS, 0},
+    {&kFunctions[647], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[60], COMMON_BUILTINS, 0},
+    {&kFunctions[182], COMMON_BUILTINS, 0},
+    {&kFunctions[641], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[316], ESSL3_BUILTINS, 0},
+    {&kFunctions[181], COMMON_BUILTINS, 0},
+    {&kFunctions[257], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[85], COMMON_BUILTINS, 0},
+    {&kFunctions[594], ESSL3_BUILTINS, 0},
+    {&kFunctions[568], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kEXT_YUV_target},
+    {&kFunctions[144], ESSL3_BUILTINS, 0},
+    {&kFunctions[154], ESSL3_BUILTINS, 0},
+    {&kFunctions[519], ESSL3_BUILTINS, 0},
+    {&kFunctions[625], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[180], COMMON_BUILTINS, 0},
+    {&kFunctions[454], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[417], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[498], ESSL1_BUILTINS, BuiltInCondition::kVertexShader},
+    {&kFunctions[627], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[96], COMMON_BUILTINS, 0},
+    {&kFunctions[834], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[664], ESSL3_BUILTINS, 0},
+    {&kFunctions[755], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[14], COMMON_BUILTINS, 0},
+    {&kFunctions[237], ESSL3_BUILTINS, 0},
+    {&kFunctions[535], ESSL3_BUILTINS, BuiltInCondition::kOES_EGL_image_external_essl3},
+    {&kFunctions[494], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kEXT_shader_texture_lod},
+    {&kFunctions[501], ESSL1_BUILTINS, BuiltInCondition::kVertexShader},
+    {&kFunctions[47], ESSL3_BUILTINS, 0},
+    {&kFunctions[185], ESSL3_BUILTINS, 0},
+    {&kFunctions[155], ESSL3_BUILTINS, 0},
+    {&kFunctions[644], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[74], COMMON_BUILTINS, 0},
+    {&kFunctions[767], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[42], ESSL3_BUILTINS, 0},
+    {&kFunctions[749], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[283], COMMON_BUILTINS, 0},
+    {&kFunctions[653], ESSL3_BUILTINS, 0},
+    {&kFunctions[6], COMMON_BUILTINS, 0},
+    {&kFunctions[28], COMMON_BUILTINS, 0},
+    {&kFunctions[838], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[126], COMMON_BUILTINS, 0},
+    {&kFunctions[207], ESSL3_BUILTINS, 0},
+    {&kFunctions[608], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[492], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {&kFunctions[124], COMMON_BUILTINS, 0},
+    {&kFunctions[63], COMMON_BUILTINS, 0},
+    {&kFunctions[732], ESSL3_BUILTINS, 0},
+    {&kFunctions[213], COMMON_BUILTINS, 0},
+    {&kFunctions[698], ESSL3_BUILTINS, 0},
+    {&kFunctions[731], ESSL3_BUILTINS, 0},
+    {&kFunctions[551], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[660], ESSL3_BUILTINS, 0},
+    {&kFunctions[537], ESSL3_BUILTINS, BuiltInCondition::kOES_EGL_image_external_essl3},
+    {&kFunctions[643], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[290], COMMON_BUILTINS, 0},
+    {&kFunctions[646], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[818], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[642], ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {&kFunctions[529], ESSL3_BUILTINS, 0},
+    {&kFunctions[273], COMMON_BUILTINS, 0},
+    {&kFunctions[580], ESSL3_BUILTINS, 0},
+    {&kFunctions[719], ESSL3_BUILTINS, 0},
+    {&kFunctions[412], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[586], ESSL3_BUILTINS, 0},
+    {&kFunctions[380], COMMON_BUILTINS, 0},
+    {&kFunctions[46], ESSL3_BUILTINS, 0},
+    {&kFunctions[742], ESSL3_BUILTINS, 0},
+    {&kFunctions[651], ESSL3_BUILTINS, 0},
+    {&kFunctions[850], ESSL3_1_BUILTINS, BuiltInCondition::kGeometryShader},
+    {&kFunctions[710], ESSL3_BUILTINS, 0},
+    {&kFunctions[541], ESSL3_BUILTINS, BuiltInCondition::kEXT_YUV_target},
+    {&kFunctions[476], ESSL1_BUILTINS, BuiltInCondition::kEXT_shader_texture_lod},
+    {&kFunctions[234], ESSL3_BUILTINS, 0},
+    {&kFunctions[109], ESSL3_BUILTINS, 0},
+    {&kFunctions[592], ESSL3_BUILTINS, 0},
+    {&kFunctions[444], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[263], ESSL3_BUILTINS, 0},
+    {&kFunctions[827], ESSL3_1_BUILTINS, 0},
+    {&kFunctions[496], ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kEXT_shader_texture_lod},
+    {&kFunctions[721], ESSL3_BUILTINS, 0},
+    {&kFunctions[723], ESSL3_BUILTINS, 0},
+};
+
+constexpr uint32_t kFunctionSeeds[] = {
+    3, 2, 66, 17, 5, 36, 1, 80, 5, 13, 0, 338, 20, 2, 267, 54, 39, 10, 172, 229, 1, 497, 298, 6,
+    111, 299, 634, 76, 1, 34, 40, 128, 80, 53, 17, 41, 15, 16, 27, 253, 8, 1, 5, 2, 7, 151, 65, 238,
+    4, 61, 2, 13, 2, 1, 305, 3, 0, 18, 1, 6, 6, 5, 7, 12, 19, 2, 106, 10, 5, 10, 8, 1, 1, 437, 33,
+    11, 432, 38, 5, 103, 27, 17, 2, 1, 92, 106, 66, 240, 1, 86, 61, 199, 348, 2, 889, 35, 21, 222,
+    754, 176, 227, 16, 13, 1, 17, 10, 33, 226, 1, 3, 33, 791, 451, 4, 7, 24, 74, 1, 2, 762, 5, 133,
+    87, 13, 71, 333, 27, 102, 2039, 25, 150, 8, 3, 2, 10, 4, 741, 1, 3471, 3, 24, 36, 2, 72, 1090,
+    174, 1739, 1335, 119, 982, 1, 0, 1, 186, 356, 294, 76, 5, 19, 154, 132, 36, 6, 1970, 79, 55,
+    110, 27, 109, 3, 32, 131, 37, 18, 9, 2, 2, 34, 1, 792, 220, 4, 3, 571, 5, 163, 17679, 335, 628,
+    44, 226, 349, 113, 324, 261, 287, 227, 2553, 159, 41, 6, 19, 1213, 9, 254, 400, 35, 107, 578,
+};
+
+constexpr HashSlot kFunctionSlots[] = {
+    {ImmutableString("memoryBarrierBuffer("), 0, 1},
+    {ImmutableString("sin(vf2;"), 1, 1},
+    {ImmutableString("acosh(vf3;"), 2, 1},
+    {ImmutableString("pow(vf3;vf3;"), 3, 1},
+    {ImmutableString("textureProjGrad(is21;vf4;vf2;vf2;"), 4, 1},
+    {ImmutableString("atomicMax(i1;i1;"), 5, 1},
+    {ImmutableString("isnan(f1;"), 6, 1},
+    {ImmutableString("textureGradOffset(s31;vf3;vf3;vf3;vi3;"), 7, 1},
+    {ImmutableString("findMSB(vu4;"), 8, 1},
+    {ImmutableString("texture2DRect(s2r1;vf2;"), 9, 1},
+    {ImmutableString("clamp(f1;f1;f1;"), 10, 1},
+    {ImmutableString("atomicOr(i1;i1;"), 11, 1},
+    {ImmutableString("umulExtended(vu4;vu4;vu4;vu4;"), 12, 1},
+    {ImmutableString("dFdx(vf4;"), 13, 2},
+    {ImmutableString("equal(vb4;vb4;"), 15, 1},
+    {ImmutableString("greaterThan(vu2;vu2;"), 16, 1},
+    {ImmutableString("textureGather(s2as1;vf3;f1;"), 17, 1},
+    {ImmutableString("texture(is2a1;vf3;f1;"), 18, 1},
+    {ImmutableString("log2(vf3;"), 19, 1},
+    {ImmutableString("imageSize(iim31;"), 20, 1},
+    {ImmutableString("textureGather(sC1;vf3;"), 21, 1},
+    {ImmutableString("texture(sext2y2y1;vf2;f1;"), 22, 1},
+    {ImmutableString("max(vu4;u1;"), 23, 1},
+    {ImmutableString("lessThanEqual(vi3;vi3;"), 24, 1},
+    {ImmutableString("textureProjGrad(s21;vf4;vf2;vf2;"), 25, 1},
+    {ImmutableString("texelFetchOffset(is21;vi2;i1;vi2;"), 26, 1},
+    {ImmutableString("step(f1;vf4;"), 27, 1},
+    {ImmutableString("textureOffset(is21;vf2;vi2;"), 28, 1},
+    {ImmutableString("imageSize(im31;"), 29, 1},
+    {ImmutableString("bitfieldReverse(vu4;"), 30, 1},
+    {ImmutableString("packSnorm4x8(vf4;"), 31, 1},
+    {ImmutableString("pow(vf2;vf2;"), 32, 1},
+    {ImmutableString("textureProjOffset(s21;vf4;vi2;"), 33, 1},
+    {ImmutableString("textureProj(us21;vf3;f1;"), 34, 1},
+    {ImmutableString("uaddCarry(vu3;vu3;vu3;"), 35, 1},
+    {ImmutableString("imageSize(uim31;"), 36, 1},
+    {ImmutableString("textureProj(s21;vf3;"), 37, 1},
+    {ImmutableString("distance(vf3;vf3;"), 38, 1},
+    {ImmutableString("any(vb2;"), 39, 1},
+    {ImmutableString("max(vu4;vu4;"), 40, 1},
+    {ImmutableString("textureProjOffset(us21;vf3;vi2;"), 41, 1},
+    {ImmutableString("cross(vf3;vf3;"), 42, 1},
+    {ImmutableString("bitfieldReverse(vu2;"), 43, 1},
+    {ImmutableString("findLSB(u1;"), 44, 1},
+    {ImmutableString("textureOffset(s2s1;vf3;vi2;f1;"), 45, 1},
+    {ImmutableString("textureProjLodOffset(is21;vf3;f1;vi2;"), 46, 1},
+    {ImmutableString("bitfieldExtract(vu4;i1;i1;"), 47, 1},
+    {ImmutableString("dFdy(f1;"), 48, 2},
+    {ImmutableString("texelFetch(is21;vi2;i1;"), 50, 1},
+    {ImmutableString("outerProduct(vf3;vf4;"), 51, 1},
+    {ImmutableString("bitfieldReverse(u1;"), 52, 1},
+    {ImmutableString("bitCount(vi3;"), 53, 1},
+    {ImmutableString("imageStore(imc1;vi3;vf4;"), 54, 1},
+    {ImmutableString("uintBitsToFloat(vu2;"), 55, 1},
+    {ImmutableString("exp2(vf4;"), 56, 1},
+    {ImmutableString("mod(vf4;vf4;"), 57, 1},
+    {ImmutableString("texture2DProj(sext1;vf3;"), 58, 1},
+    {ImmutableString("equal(vf3;vf3;"), 59, 1},
+    {ImmutableString("matrixCompMult(mf4x3;mf4x3;"), 60, 1},
+    {ImmutableString("atomicMax(u1;u1;"), 61, 1},
+    {ImmutableString("textureGrad(s21;vf2;vf2;vf2;"), 62, 1},
+    {ImmutableString("clamp(vi3;vi3;vi3;"), 63, 1},
+    {ImmutableString("bitfieldExtract(vu2;i1;i1;"), 64, 1},
+    {ImmutableString("asin(vf4;"), 65, 1},
+    {ImmutableString("textureGradOffset(us21;vf2;vf2;vf2;vi2;"), 66, 1},
+    {ImmutableString("textureSize(sC1;i1;"), 67, 1},
+    {ImmutableString("textureLod(usC1;vf3;f1;"), 68, 1},
+    {ImmutableString("clamp(vi4;i1;i1;"), 69, 1},
+    {ImmutableString("memoryBarrierImage("), 70, 1},
+    {ImmutableString("textureSize(us2a1;i1;"), 71, 1},
+    {ImmutableString("textureOffset(us21;vf2;vi2;f1;"), 72, 1},
+    {ImmutableString("matrixCompMult(mf2x4;mf2x4;"), 73, 1},
+    {ImmutableString("packUnorm4x8(vf4;"), 74, 1},
+    {ImmutableString("textureSize(us31;i1;"), 75, 1},
+    {ImmutableString("greaterThan(vu4;vu4;"), 76, 1},
+    {ImmutableString("notEqual(vb3;vb3;"), 77, 1},
+    {ImmutableString("textureLodOffset(s2a1;vf3;f1;vi2;"), 78, 1},
+    {ImmutableString("findLSB(vu3;"), 79, 1},
+    {ImmutableString("lessThanEqual(vi2;vi2;"), 80, 1},
+    {ImmutableString("any(vb4;"), 81, 1},
+    {ImmutableString("asinh(vf3;"), 82, 1},
+    {ImmutableString("inversesqrt(f1;"), 83, 1},
+    {ImmutableString("lessThan(vi4;vi4;"), 84, 1},
+    {ImmutableString("greaterThanEqual(vf3;vf3;"), 85, 1},
+    {ImmutableString("atanh(vf3;"), 86, 1},
+    {ImmutableString("modf(vf4;vf4;"), 87, 1},
+    {ImmutableString("imageSize(iimc1;"), 88, 1},
+    {ImmutableString("smoothstep(f1;f1;vf3;"), 89, 1},
+    {ImmutableString("textureProj(sext2y2y1;vf4;"), 90, 1},
+    {ImmutableString("bitfieldInsert(vu2;vu2;i1;i1;"), 91, 1},
+    {ImmutableString("dot(vf3;vf3;"), 92, 1},
+    {ImmutableString("atomicAnd(i1;i1;"), 93, 1},
+    {ImmutableString("textureLod(is21;vf2;f1;"), 94, 1},
+    {ImmutableString("imageStore(iim31;vi3;vi4;"), 95, 1},
+    {ImmutableString("asin(vf3;"), 96, 1},
+    {ImmutableString("max(f1;f1;"), 97, 1},
+    {ImmutableString("textureLod(s2s1;vf3;f1;"), 98, 1},
+    {ImmutableString("ceil(vf2;"), 99, 1},
+    {ImmutableString("clamp(vu2;vu2;vu2;"), 100, 1},
+    {ImmutableString("notEqual(vb2;vb2;"), 101, 1},
+    {ImmutableString("max(vi2;i1;"), 102, 1},
+    {ImmutableString("textureOffset(us2a1;vf3;vi2;"), 103, 1},
+    {ImmutableString("min(vu2;vu2;"), 104, 1},
+    {ImmutableString("outerProduct(vf2;vf3;"), 105, 1},
+    {ImmutableString("greaterThan(vi4;vi4;"), 106, 1},
+    {ImmutableString("textureProj(is21;vf4;f1;"), 107, 1},
+    {ImmutableString("textureSize(is21;i1;"), 108, 1},
+    {ImmutableString("texture2DProjLod(s21;vf3;f1;"), 109, 1},
+    {ImmutableString("texelFetch(sext1;vi2;i1;"), 110, 1},
+    {ImmutableString("tan(f1;"), 111, 1},
+    {ImmutableString("mod(vf2;f1;"), 112, 1},
+    {ImmutableString("ldexp(f1;i1;"), 113, 1},
+    {ImmutableString("outerProduct(vf3;vf3;"), 114, 1},
+    {ImmutableString("abs(vf2;"), 115, 1},
+    {ImmutableString("textureSize(isC1;i1;"), 116, 1},
+    {ImmutableString("log(vf3;"), 117, 1},
+    {ImmutableString("texture(us2a1;vf3;"), 118, 1},
+    {ImmutableString("textureGradOffset(s2as1;vf4;vf2;vf2;vi2;"), 119, 1},
+    {ImmutableString("normalize(f1;"), 120, 1},
+    {ImmutableString("atomicExchange(i1;i1;"), 121, 1},
+    {ImmutableString("textureProjOffset(us21;vf4;vi2;"), 122, 1},
+    {ImmutableString("uaddCarry(u1;u1;u1;"), 123, 1},
+    {ImmutableString("bitfieldInsert(i1;i1;i1;i1;"), 124, 1},
+    {ImmutableString("textureGather(s2a1;vf3;"), 125, 1},
+    {ImmutableString("texture(s2s1;vf3;f1;"), 126, 1},
+    {ImmutableString("textureProjLodOffset(is31;vf4;f1;vi3;"), 127, 1},
+    {ImmutableString("clamp(vi3;i1;i1;"), 128, 1},
+    {ImmutableString("lessThanEqual(vu3;vu3;"), 129, 1},
+    {ImmutableString("unpackUnorm4x8(u1;"), 130, 1},
+    {ImmutableString("textureProjLod(s21;vf4;f1;"), 131, 1},
+    {ImmutableString("inverse(mf3x3;"), 132, 1},
+    {ImmutableString("mix(vf4;vf4;f1;"), 133, 1},
+    {ImmutableString("textureLod(s31;vf3;f1;"), 134, 1},
+    {ImmutableString("all(vb2;"), 135, 1},
+    {ImmutableString("textureGrad(us31;vf3;vf3;vf3;"), 136, 1},
+    {ImmutableString("max(vi4;i1;"), 137, 1},
+    {ImmutableString("umulExtended(u1;u1;u1;u1;"), 138, 1},
+    {ImmutableString("atomicCounterIncrement(ac1;"), 139, 1},
+    {ImmutableString("textureOffset(is31;vf3;vi3;f1;"), 140, 1},
+    {ImmutableString("clamp(vf3;f1;f1;"), 141, 1},
+    {ImmutableString("mix(vf2;vf2;f1;"), 142, 1},
+    {ImmutableString("greaterThanEqual(vi2;vi2;"), 143, 1},
+    {ImmutableString("max(vu3;u1;"), 144, 1},
+    {ImmutableString("min(vu3;vu3;"), 145, 1},
+    {ImmutableString("textureProjGradOffset(us21;vf3;vf2;vf2;vi2;"), 146, 1},
+    {ImmutableString("textureGatherOffset(us2a1;vf3;vi2;"), 147, 1},
+    {ImmutableString("inversesqrt(vf4;"), 148, 1},
+    {ImmutableString("floatBitsToInt(f1;"), 149, 1},
+    {ImmutableString("imageStore(iim21;vi2;vi4;"), 150, 1},
+    {ImmutableString("textureProjOffset(us31;vf4;vi3;f1;"), 151, 1},
+    {ImmutableString("min(vi4;i1;"), 152, 1},
+    {ImmutableString("textureOffset(s2a1;vf3;vi2;"), 153, 1},
+    {ImmutableString("texture(is2a1;vf3;"), 154, 1},
+    {ImmutableString("acos(vf3;"), 155, 1},
+    {ImmutableString("max(vi2;vi2;"), 156, 1},
+    {ImmutableString("asinh(vf4;"), 157, 1},
+    {ImmutableString("determinant(mf2x2;"), 158, 1},
+    {ImmutableString("texture(s21;vf2;"), 159, 1},
+    {ImmutableString("texture2D(s21;vf2;"), 160, 1},
+    {ImmutableString("textureProj(sext1;vf3;f1;"), 161, 1},
+    {ImmutableString("texture(s2a1;vf3;"), 162, 1},
+    {ImmutableString("textureGather(s21;vf2;"), 163, 1},
+    {ImmutableString("greaterThanEqual(vu2;vu2;"), 164, 1},
+    {ImmutableString("imageSize(iim2a1;"), 165, 1},
+    {ImmutableString("mod(vf3;vf3;"), 166, 1},
+    {ImmutableString("bitfieldExtract(vi4;i1;i1;"), 167, 1},
+    {ImmutableString("modf(vf2;vf2;"), 168, 1},
+    {ImmutableString("texelFetch(s21;vi2;i1;"), 169, 1},
+    {ImmutableString("sqrt(vf3;"), 170, 1},
+    {ImmutableString("textureProj(us31;vf4;f1;"), 171, 1},
+    {ImmutableString("refract(vf4;vf4;f1;"), 172, 1},
+    {ImmutableString("roundEven(vf2;"), 173, 1},
+    {ImmutableString("greaterThanEqual(vu3;vu3;"), 174, 1},
+    {ImmutableString("textureOffset(s31;vf3;vi3;"), 175, 1},
+    {ImmutableString("fract(vf4;"), 176, 1},
+    {ImmutableString("outerProduct(vf4;vf4;"), 177, 1},
+    {ImmutableString("ceil(vf3;"), 178, 1},
+    {ImmutableString("imulExtended(vi2;vi2;vi2;vi2;"), 179, 1},
+    {ImmutableString("textureProjLodOffset(s31;vf4;f1;vi3;"), 180, 1},
+    {ImmutableString("tan(vf4;"), 181, 1},
+    {ImmutableString("textureProj(us21;vf3;"), 182, 1},
+    {ImmutableString("textureGather(us2a1;vf3;"), 183, 1},
+    {ImmutableString("textureGather(s2s1;vf2;"), 184, 1},
+    {ImmutableString("textureProj(s31;vf4;"), 185, 1},
+    {ImmutableString("notEqual(vi4;vi4;"), 186, 1},
+    {ImmutableString("floatBitsToUint(vf3;"), 187, 1},
+    {ImmutableString("not(vb3;"), 188, 1},
+    {ImmutableString("floor(vf3;"), 189, 1},
+    {ImmutableString("sign(vi2;"), 190, 1},
+    {ImmutableString("sin(vf4;"), 191, 1},
+    {ImmutableString("textureLod(is2a1;vf3;f1;"), 192, 1},
+    {ImmutableString("textureGradOffset(us2a1;vf3;vf2;vf2;vi2;"), 193, 1},
+    {ImmutableString("textureLod(us31;vf3;f1;"), 194, 1},
+    {ImmutableString("texture(is21;vf2;f1;"), 195, 1},
+    {ImmutableString("texture(is31;vf3;"), 196, 1},
+    {ImmutableString("texelFetch(us2a1;vi3;i1;"), 197, 1},
+    {ImmutableString("outerProduct(vf4;vf3;"), 198, 1},
+    {ImmutableString("equal(vi2;vi2;"), 199, 1},
+    {ImmutableString("textureProjLodOffset(is21;vf4;f1;vi2;"), 200, 1},
+    {ImmutableString("texture(s2as1;vf4;"), 201, 1},
+    {ImmutableString("mix(vf3;vf3;vf3;"), 202, 1},
+    {ImmutableString("lessThan(vf3;vf3;"), 203, 1},
+    {ImmutableString("texelFetch(s31;vi3;i1;"), 204, 1},
+    {ImmutableString("textureGradOffset(s2a1;vf3;vf2;vf2;vi2;"), 205, 1},
+    {ImmutableString("trunc(vf3;"), 206, 1},
+    {ImmutableString("degrees(vf2;"), 207, 1},
+    {ImmutableString("sign(vf3;"), 208, 1},
+    {ImmutableString("imageSize(uimc1;"), 209, 1},
+    {ImmutableString("equal(vi3;vi3;"), 210, 1},
+    {ImmutableString("dFdy(vf2;"), 211, 2},
+    {ImmutableString("textureGatherOffset(is21;vf2;vi2;i1;"), 213, 1},
+    {ImmutableString("floatBitsToUint(vf2;"), 214, 1},
+    {ImmutableString("floatBitsToInt(vf4;"), 215, 1},
+    {ImmutableString("log(vf2;"), 216, 1},
+    {ImmutableString("atomicMin(i1;i1;"), 217, 1},
+    {ImmutableString("mod(vf4;f1;"), 218, 1},
+    {ImmutableString("isinf(f1;"), 219, 1},
+    {ImmutableString("imulExtended(vi4;vi4;vi4;vi4;"), 220, 1},
+    {ImmutableString("textureLodOffset(us21;vf2;f1;vi2;"), 221, 1},
+    {ImmutableString("abs(vi2;"), 222, 1},
+    {ImmutableString("texture(us2a1;vf3;f1;"), 223, 1},
+    {ImmutableString("textureProjGrad(is31;vf4;vf3;vf3;"), 224, 1},
+    {ImmutableString("atomicCompSwap(u1;u1;u1;"), 225, 1},
+    {ImmutableString("imulExtended(i1;i1;i1;i1;"), 226, 1},
+    {ImmutableString("imageStore(uim2a1;vi3;vu4;"), 227, 1},
+    {ImmutableString("abs(vi3;"), 228, 1},
+    {ImmutableString("transpose(mf4x2;"), 229, 1},
+    {ImmutableString("bitCount(u1;"), 230, 1},
+    {ImmutableString("max(vu2;vu2;"), 231, 1},
+    {ImmutableString("dot(vf4;vf4;"), 232, 1},
+    {ImmutableString("textureProjOffset(us31;vf4;vi3;"), 233, 1},
+    {ImmutableString("textureProjGrad(us31;vf4;vf3;vf3;"), 234, 1},
+    {ImmutableString("atan(vf3;vf3;"), 235, 1},
+    {ImmutableString("ldexp(vf2;vi2;"), 236, 1},
+    {ImmutableString("dFdx(f1;"), 237, 2},
+    {ImmutableString("textureProjLod(us21;vf3;f1;"), 239, 1},
+    {ImmutableString("texture2DProjLod(s21;vf4;f1;"), 240, 1},
+    {ImmutableString("texelFetchOffset(us21;vi2;i1;vi2;"), 241, 1},
+    {ImmutableString("greaterThanEqual(vi3;vi3;"), 242, 1},
+    {ImmutableString("atomicXor(i1;i1;"), 243, 1},
+    {ImmutableString("textureLod(us21;vf2;f1;"), 244, 1},
+    {ImmutableString("min(vf4;f1;"), 245, 1},
+    {ImmutableString("lessThanEqual(vu2;vu2;"), 246, 1},
+    {ImmutableString("min(vi2;vi2;"), 247, 1},
+    {ImmutableString("clamp(vf4;vf4;vf4;"), 248, 1},
+    {ImmutableString("textureGrad(s2as1;vf4;vf2;vf2;"), 249, 1},
+    {ImmutableString("max(vf3;vf3;"), 250, 1},
+    {ImmutableString("matrixCompMult(mf3x4;mf3x4;"), 251, 1},
+    {ImmutableString("min(i1;i1;"), 252, 1},
+    {ImmutableString("mix(vf3;vf3;f1;"), 253, 1},
+    {ImmutableString("textureCube(sC1;vf3;f1;"), 254, 1},
+    {ImmutableString("floatBitsToUint(f1;"), 255, 1},
+    {ImmutableString("abs(vi4;"), 256, 1},
+    {ImmutableString("textureProjOffset(us21;vf4;vi2;f1;"), 257, 1},
+    {ImmutableString("mix(vf4;vf4;vf4;"), 258, 1},
+    {ImmutableString("min(vu4;vu4;"), 259, 1},
+    {ImmutableString("max(vf4;vf4;"), 260, 1},
+    {ImmutableString("notEqual(vu4;vu4;"), 261, 1},
+    {ImmutableString("atomicExchange(u1;u1;"), 262, 1},
+    {ImmutableString("mix(vf4;vf4;vb4;"), 263, 1},
+    {ImmutableString("textureProjOffset(is21;vf3;vi2;"), 264, 1},
+    {ImmutableString("radians(vf3;"), 265, 1},
+    {ImmutableString("packUnorm2x16(vf2;"), 266, 1},
+    {ImmutableString("texture(s2a1;vf3;f1;"), 267, 1},
+    {ImmutableString("modf(f1;f1;"), 268, 1},
+    {ImmutableString("transpose(mf3x2;"), 269, 1},
+    {ImmutableString("fwidth(vf2;"), 270, 2},
+    {ImmutableString("lessThan(vi3;vi3;"), 272, 1},
+    {ImmutableString("texture(s21;vf2;f1;"), 273, 1},
+    {ImmutableString("min(vf4;vf4;"), 274, 1},
+    {ImmutableString("texture(usC1;vf3;"), 275, 1},
+    {ImmutableString("textureProjOffset(s2s1;vf4;vi2;f1;"), 276, 1},
+    {ImmutableString("greaterThan(vf3;vf3;"), 277, 1},
+    {ImmutableString("notEqual(vf4;vf4;"), 278, 1},
+    {ImmutableString("imageSize(uim21;"), 279, 1},
+    {ImmutableString("barrier("), 280, 1},
+    {ImmutableString("asinh(vf2;"), 281, 1},
+    {ImmutableString("imageStore(im21;vi2;vf4;"), 282, 1},
+    {ImmutableString("bitfieldExtract(vi3;i1;i1;"), 283, 1},
+    {ImmutableString("textureProjOffset(s21;vf3;vi2;"), 284, 1},
+    {ImmutableString("imageLoad(iim31;vi3;"), 285, 1},
+    {ImmutableString("imageStore(im2a1;vi3;vf4;"), 286, 1},
+    {ImmutableString("atomicMin(u1;u1;"), 287, 1},
+    {ImmutableString("texture2DRectProj(s2r1;vf4;"), 288, 1},
+    {ImmutableString("notEqual(vf2;vf2;"), 289, 1},
+    {ImmutableString("tanh(f1;"), 290, 1},
+    {ImmutableString("textureGather(us2a1;vf3;i1;"), 291, 1},
+    {ImmutableString("textureProj(s21;vf4;f1;"), 292, 1},
+    {ImmutableString("floatBitsToUint(vf4;"), 293, 1},
+    {ImmutableString("uaddCarry(vu2;vu2;vu2;"), 294, 1},
+    {ImmutableString("ceil(vf4;"), 295, 1},
+    {ImmutableString("sign(vf4;"), 296, 1},
+    {ImmutableString("transpose(mf3x4;"), 297, 1},
+    {ImmutableString("frexp(vf4;vi4;"), 298, 1},
+    {ImmutableString("lessThanEqual(vu4;vu4;"), 299, 1},
+    {ImmutableString("texelFetchOffset(is31;vi3;i1;vi3;"), 300, 1},
+    {ImmutableString("smoothstep(f1;f1;vf4;"), 301, 1},
+    {ImmutableString("findMSB(vu2;"), 302, 1},
+    {ImmutableString("textureProj(sext2y2y1;vf4;f1;"), 303, 1},
+    {ImmutableString("textureProjLodOffset(s21;vf4;f1;vi2;"), 304, 1},
+    {ImmutableString("texture2DRectProj(s2r1;vf3;"), 305, 1},
+    {ImmutableString("trunc(f1;"), 306, 1},
+    {ImmutableString("bitfieldInsert(vu3;vu3;i1;i1;"), 307, 1},
+    {ImmutableString("mod(f1;f1;"), 308, 1},
+    {ImmutableString("tan(vf2;"), 309, 1},
+    {ImmutableString("bitfieldInsert(vi3;vi3;i1;i1;"), 310, 1},
+    {ImmutableString("transpose(mf4x3;"), 311, 1},
+    {ImmutableString("inverse(mf4x4;"), 312, 1},
+    {ImmutableString("textureProj(s2s1;vf4;f1;"), 313, 1},
+    {ImmutableString("textureSize(s2s1;i1;"), 314, 1},
+    {ImmutableString("step(vf3;vf3;"), 315, 1},
+    {ImmutableString("abs(i1;"), 316, 1},
+    {ImmutableString("textureGather(s2as1;vf3;"), 317, 1},
+    {ImmutableString("textureGatherOffset(s21;vf2;vi2;i1;"), 318, 1},
+    {ImmutableString("mod(vf3;f1;"), 319, 1},
+    {ImmutableString("textureOffset(us2a1;vf3;vi2;f1;"), 320, 1},
+    {ImmutableString("equal(vf2;vf2;"), 321, 1},
+    {ImmutableString("lessThan(vu3;vu3;"), 322, 1},
+    {ImmutableString("atanh(vf2;"), 323, 1},
+    {ImmutableString("textureGatherOffset(us2a1;vf3;vi2;i1;"), 324, 1},
+    {ImmutableString("textureProj(s31;vf4;f1;"), 325, 1},
+    {ImmutableString("textureProj(sext2y2y1;vf3;"), 326, 1},
+    {ImmutableString("textureGather(isC1;vf3;i1;"), 327, 1},
+    {ImmutableString("step(vf4;vf4;"), 328, 1},
+    {ImmutableString("textureProjLodOffset(s21;vf3;f1;vi2;"), 329, 1},
+    {ImmutableString("textureProj(is21;vf3;"), 330, 1},
+    {ImmutableString("uintBitsToFloat(vu3;"), 331, 1},
+    {ImmutableString("textureProjGrad(s21;vf3;vf2;vf2;"), 332, 1},
+    {ImmutableString("sin(vf3;"), 333, 1},
+    {ImmutableString("dot(f1;f1;"), 334, 1},
+    {ImmutableString("determinant(mf4x4;"), 335, 1},
+    {ImmutableString("textureGather(is21;vf2;"), 336, 1},
+    {ImmutableString("sinh(vf3;"), 337, 1},
+    {ImmutableString("textureSize(is31;i1;"), 338, 1},
+    {ImmutableString("textureOffset(s21;vf2;vi2;f1;"), 339, 1},
+    {ImmutableString("exp2(vf2;"), 340, 1},
+    {ImmutableString("equal(vb2;vb2;"), 341, 1},
+    {ImmutableString("lessThanEqual(vi4;vi4;"), 342, 1},
+    {ImmutableString("cosh(vf2;"), 343, 1},
+    {ImmutableString("length(vf3;"), 344, 1},
+    {ImmutableString("equal(vu3;vu3;"), 345, 1},
+    {ImmutableString("texture(is31;vf3;f1;"), 346, 1},
+    {ImmutableString("abs(vf4;"), 347, 1},
+    {ImmutableString("asin(vf2;"), 348, 1},
+    {ImmutableString("equal(vi4;vi4;"), 349, 1},
+    {ImmutableString("imageSize(im21;"), 350, 1},
+    {ImmutableString("texture2DProj(sext1;vf4;"), 351, 1},
+    {ImmutableString("texture(isC1;vf3;"), 352, 1},
+    {ImmutableString("acosh(vf4;"), 353, 1},
+    {ImmutableString("matrixCompMult(mf4x2;mf4x2;"), 354, 1},
+    {ImmutableString("textureGather(is2a1;vf3;"), 355, 1},
+    {ImmutableString("abs(vf3;"), 356, 1},
+    {ImmutableString("tan(vf3;"), 357, 1},
+    {ImmutableString("textureGrad(s31;vf3;vf3;vf3;"), 358, 1},
+    {ImmutableString("round(vf3;"), 359, 1},
+    {ImmutableString("textureGrad(isC1;vf3;vf3;vf3;"), 360, 1},
+    {ImmutableString("radians(vf2;"), 361, 1},
+    {ImmutableString("texture(isC1;vf3;f1;"), 362, 1},
+    {ImmutableString("bitfieldInsert(vi2;vi2;i1;i1;"), 363, 1},
+    {ImmutableString("textureProjGradOffset(is21;vf4;vf2;vf2;vi2;"), 364, 1},
+    {ImmutableString("texelFetchOffset(s2a1;vi3;i1;vi2;"), 365, 1},
+    {ImmutableString("textureProjGradOffset(us21;vf4;vf2;vf2;vi2;"), 366, 1},
+    {ImmutableString("textureSize(s21;i1;"), 367, 1},
+    {ImmutableString("mix(vf2;vf2;vf2;"), 368, 1},
+    {ImmutableString("max(i1;i1;"), 369, 1},
+    {ImmutableString("lessThan(vu4;vu4;"), 370, 1},
+    {ImmutableString("min(u1;u1;"), 371, 1},
+    {ImmutableString("findMSB(vu3;"), 372, 1},
+    {ImmutableString("intBitsToFloat(vi4;"), 373, 1},
+    {ImmutableString("greaterThanEqual(vu4;vu4;"), 374, 1},
+    {ImmutableString("bitCount(vi4;"), 375, 1},
+    {ImmutableString("textureOffset(us21;vf2;vi2;"), 376, 1},
+    {ImmutableString("step(f1;vf3;"), 377, 1},
+    {ImmutableString("round(f1;"), 378, 1},
+    {ImmutableString("usubBorrow(u1;u1;u1;"), 379, 1},
+    {ImmutableString("max(vu2;u1;"), 380, 1},
+    {ImmutableString("atomicCounterDecrement(ac1;"), 381, 1},
+    {ImmutableString("acosh(f1;"), 382, 1},
+    {ImmutableString("cos(vf2;"), 383, 1},
+    {ImmutableString("lessThan(vf4;vf4;"), 384, 1},
+    {ImmutableString("packSnorm2x16(vf2;"), 385, 1},
+    {ImmutableString("max(vf3;f1;"), 386, 1},
+    {ImmutableString("log2(f1;"), 387, 1},
+    {ImmutableString("min(vi2;i1;"), 388, 1},
+    {ImmutableString("min(vf2;f1;"), 389, 1},
+    {ImmutableString("texelFetchOffset(us31;vi3;i1;vi3;"), 390, 1},
+    {ImmutableString("findLSB(vi2;"), 391, 1},
+    {ImmutableString("min(vi3;i1;"), 392, 1},
+    {ImmutableString("texelFetch(s2ms1;vi2;i1;"), 393, 1},
+    {ImmutableString("ldexp(vf4;vi4;"), 394, 1},
+    {ImmutableString("floatBitsToInt(vf2;"), 395, 1},
+    {ImmutableString("findMSB(vi2;"), 396, 1},
+    {ImmutableString("textureSize(is2a1;i1;"), 397, 1},
+    {ImmutableString("radians(f1;"), 398, 1},
+    {ImmutableString("texture(sCs1;vf4;f1;"), 399, 1},
+    {ImmutableString("textureCube(sC1;vf3;"), 400, 1},
+    {ImmutableString("textureOffset(s21;vf2;vi2;"), 401, 1},
+    {ImmutableString("lessThanEqual(vf2;vf2;"), 402, 1},
+    {ImmutableString("notEqual(vi2;vi2;"), 403, 1},
+    {ImmutableString("imageStore(im31;vi3;vf4;"), 404, 1},
+    {ImmutableString("log(f1;"), 405, 1},
+    {ImmutableString("sqrt(vf2;"), 406, 1},
+    {ImmutableString("textureProj(sext1;vf3;"), 407, 1},
+    {ImmutableString("imageLoad(iim2a1;vi3;"), 408, 1},
+    {ImmutableString("textureProjOffset(s2s1;vf4;vi2;"), 409, 1},
+    {ImmutableString("bitfieldExtract(u1;i1;i1;"), 410, 1},
+    {ImmutableString("bitCount(vu4;"), 411, 1},
+    {ImmutableString("greaterThanEqual(vf2;vf2;"), 412, 1},
+    {ImmutableString("texelFetch(us21;vi2;i1;"), 413, 1},
+    {ImmutableString("sign(i1;"), 414, 1},
+    {ImmutableString("inverse(mf2x2;"), 415, 1},
+    {ImmutableString("textureGatherOffset(s2s1;vf2;f1;vi2;"), 416, 1},
+    {ImmutableString("isinf(vf3;"), 417, 1},
+    {ImmutableString("clamp(vi2;vi2;vi2;"), 418, 1},
+    {ImmutableString("textureSize(sCs1;i1;"), 419, 1},
+    {ImmutableString("log(vf4;"), 420, 1},
+    {ImmutableString("textureGather(s2a1;vf3;i1;"), 421, 1},
+    {ImmutableString("greaterThan(vf2;vf2;"), 422, 1},
+    {ImmutableString("bitfieldReverse(vi4;"), 423, 1},
+    {ImmutableString("clamp(u1;u1;u1;"), 424, 1},
+    {ImmutableString("texture(us21;vf2;f1;"), 425, 1},
+    {ImmutableString("textureLodOffset(s21;vf2;f1;vi2;"), 426, 1},
+    {ImmutableString("min(vf3;vf3;"), 427, 1},
+    {ImmutableString("textureLodOffset(s2s1;vf3;f1;vi2;"), 428, 1},
+    {ImmutableString("dFdx(vf2;"), 429, 2},
+    {ImmutableString("textureGrad(is2a1;vf3;vf2;vf2;"), 431, 1},
+    {ImmutableString("textureGather(usC1;vf3;"), 432, 1},
+    {ImmutableString("texture2DGradEXT(s21;vf2;vf2;vf2;"), 433, 1},
+    {ImmutableString("textureProj(sext1;vf4;f1;"), 434, 1},
+    {ImmutableString("texture(sCs1;vf4;"), 435, 1},
+    {ImmutableString("atomicXor(u1;u1;"), 436, 1},
+    {ImmutableString("bitfieldExtract(i1;i1;i1;"), 437, 1},
+    {ImmutableString("texture2DProj(s21;vf3;f1;"), 438, 1},
+    {ImmutableString("textureProjLodOffset(us31;vf4;f1;vi3;"), 439, 1},
+    {ImmutableString("textureProjLod(s31;vf4;f1;"), 440, 1},
+    {ImmutableString("textureProjOffset(s21;vf3;vi2;f1;"), 441, 1},
+    {ImmutableString("imageLoad(uim31;vi3;"), 442, 1},
+    {ImmutableString("all(vb4;"), 443, 1},
+    {ImmutableString("memoryBarrierAtomicCounter("), 444, 1},
+    {ImmutableString("textureSize(s2a1;i1;"), 445, 1},
+    {ImmutableString("texelFetch(us31;vi3;i1;"), 446, 1},
+    {ImmutableString("texelFetch(is31;vi3;i1;"), 447, 1},
+    {ImmutableString("textureLod(is31;vf3;f1;"), 448, 1},
+    {ImmutableString("imageStore(iimc1;vi3;vi4;"), 449, 1},
+    {ImmutableString("textureGather(sC1;vf3;i1;"), 450, 1},
+    {ImmutableString("imageLoad(uim21;vi2;"), 451, 1},
+    {ImmutableString("imulExtended(vi3;vi3;vi3;vi3;"), 452, 1},
+    {ImmutableString("max(vi4;vi4;"), 453, 1},
+    {ImmutableString("textureProjGrad(s2s1;vf4;vf2;vf2;"), 454, 1},
+    {ImmutableString("umulExtended(vu3;vu3;vu3;vu3;"), 455, 1},
+    {ImmutableString("roundEven(f1;"), 456, 1},
+    {ImmutableString("texelFetch(s2a1;vi3;i1;"), 457, 1},
+    {ImmutableString("normalize(vf4;"), 458, 1},
+    {ImmutableString("notEqual(vi3;vi3;"), 459, 1},
+    {ImmutableString("texture2DProjLodEXT(s21;vf3;f1;"), 460, 1},
+    {ImmutableString("lessThan(vf2;vf2;"), 461, 1},
+    {ImmutableString("outerProduct(vf3;vf2;"), 462, 1},
+    {ImmutableString("memoryBarrier("), 463, 1},
+    {ImmutableString("findLSB(vi4;"), 464, 1},
+    {ImmutableString("textureCubeLodEXT(sC1;vf3;f1;"), 465, 1},
+    {ImmutableString("greaterThan(vu3;vu3;"), 466, 1},
+    {ImmutableString("degrees(vf4;"), 467, 1},
+    {ImmutableString("textureLodOffset(is2a1;vf3;f1;vi2;"), 468, 1},
+    {ImmutableString("acos(f1;"), 469, 1},
+    {ImmutableString("bitfieldReverse(vu3;"), 470, 1},
+    {ImmutableString("atomicOr(u1;u1;"), 471, 1},
+    {ImmutableString("acosh(vf2;"), 472, 1},
+    {ImmutableString("bitCount(i1;"), 473, 1},
+    {ImmutableString("textureLod(s21;vf2;f1;"), 474, 1},
+    {ImmutableString("matrixCompMult(mf2x2;mf2x2;"), 475, 1},
+    {ImmutableString("imageStore(uimc1;vi3;vu4;"), 476, 1},
+    {ImmutableString("transpose(mf2x3;"), 477, 1},
+    {ImmutableString("textureProj(s21;vf3;f1;"), 478, 1},
+    {ImmutableString("asin(f1;"), 479, 1},
+    {ImmutableString("textureGrad(usC1;vf3;vf3;vf3;"), 480, 1},
+    {ImmutableString("max(vi3;i1;"), 481, 1},
+    {ImmutableString("not(vb4;"), 482, 1},
+    {ImmutableString("length(vf4;"), 483, 1},
+    {ImmutableString("smoothstep(vf4;vf4;vf4;"), 484, 1},
+    {ImmutableString("refract(vf2;vf2;f1;"), 485, 1},
+    {ImmutableString("step(vf2;vf2;"), 486, 1},
+    {ImmutableString("texelFetch(is2ms1;vi2;i1;"), 487, 1},
+    {ImmutableString("textureGrad(us21;vf2;vf2;vf2;"), 488, 1},
+    {ImmutableString("atomicCounter(ac1;"), 489, 1},
+    {ImmutableString("sign(vi3;"), 490, 1},
+    {ImmutableString("smoothstep(vf2;vf2;vf2;"), 491, 1},
+    {ImmutableString("acos(vf4;"), 492, 1},
+    {ImmutableString("umulExtended(vu2;vu2;vu2;vu2;"), 493, 1},
+    {ImmutableString("textureProj(s2s1;vf4;"), 494, 1},
+    {ImmutableString("transpose(mf2x4;"), 495, 1},
+    {ImmutableString("textureGatherOffset(is2a1;vf3;vi2;i1;"), 496, 1},
+    {ImmutableString("textureGradOffset(us31;vf3;vf3;vf3;vi3;"), 497, 1},
+    {ImmutableString("textureOffset(s2s1;vf3;vi2;"), 498, 1},
+    {ImmutableString("findLSB(vi3;"), 499, 1},
+    {ImmutableString("smoothstep(vf3;vf3;vf3;"), 500, 1},
+    {ImmutableString("normalize(vf3;"), 501, 1},
+    {ImmutableString("textureGrad(s2s1;vf3;vf2;vf2;"), 502, 1},
+    {ImmutableString("imageLoad(imc1;vi3;"), 503, 1},
+    {ImmutableString("mix(vf2;vf2;vb2;"), 504, 1},
+    {ImmutableString("imageStore(uim31;vi3;vu4;"), 505, 1},
+    {ImmutableString("findLSB(i1;"), 506, 1},
+    {ImmutableString("length(vf2;"), 507, 1},
+    {ImmutableString("groupMemoryBarrier("), 508, 1},
+    {ImmutableString("outerProduct(vf2;vf2;"), 509, 1},
+    {ImmutableString("textureGatherOffset(s2a1;vf3;vi2;i1;"), 510, 1},
+    {ImmutableString("texture(sC1;vf3;f1;"), 511, 1},
+    {ImmutableString("textureGatherOffset(is21;vf2;vi2;"), 512, 1},
+    {ImmutableString("texture2DProj(s21;vf3;"), 513, 1},
+    {ImmutableString("texture(sext1;vf2;f1;"), 514, 1},
+    {ImmutableString("sign(vf2;"), 515, 1},
+    {ImmutableString("modf(vf3;vf3;"), 516, 1},
+    {ImmutableString("textureProj(is31;vf4;f1;"), 517, 1},
+    {ImmutableString("textureSize(us2ms1;"), 518, 1},
+    {ImmutableString("min(vu2;u1;"), 519, 1},
+    {ImmutableString("imageSize(uim2a1;"), 520, 1},
+    {ImmutableString("outerProduct(vf2;vf4;"), 521, 1},
+    {ImmutableString("atanh(f1;"), 522, 1},
+    {ImmutableString("textureOffset(is2a1;vf3;vi2;f1;"), 523, 1},
+    {ImmutableString("textureSize(sext2y2y1;i1;"), 524, 1},
+    {ImmutableString("texture(is21;vf2;"), 525, 1},
+    {ImmutableString("textureGather(us21;vf2;"), 526, 1},
+    {ImmutableString("intBitsToFloat(i1;"), 527, 1},
+    {ImmutableString("greaterThan(vf4;vf4;"), 528, 1},
+    {ImmutableString("clamp(vu4;vu4;vu4;"), 529, 1},
+    {ImmutableString("max(u1;u1;"), 530, 1},
+    {ImmutableString("textureProjGradOffset(s21;vf3;vf2;vf2;vi2;"), 531, 1},
+    {ImmutableString("unpackSnorm2x16(u1;"), 532, 1},
+    {ImmutableString("imageLoad(im21;vi2;"), 533, 1},
+    {ImmutableString("bitfieldReverse(vi3;"), 534, 1},
+    {ImmutableString("frexp(vf3;vi3;"), 535, 1},
+    {ImmutableString("determinant(mf3x3;"), 536, 1},
+    {ImmutableString("transpose(mf3x3;"), 537, 1},
+    {ImmutableString("textureGather(s21;vf2;i1;"), 538, 1},
+    {ImmutableString("atan(vf3;"), 539, 1},
+    {ImmutableString("texture(sext2y2y1;vf2;"), 540, 1},
+    {ImmutableString("unpackSnorm4x8(u1;"), 541, 1},
+    {ImmutableString("round(vf4;"), 542, 1},
+    {ImmutableString("findLSB(vu2;"), 543, 1},
+    {ImmutableString("matrixCompMult(mf4x4;mf4x4;"), 544, 1},
+    {ImmutableString("isinf(vf2;"), 545, 1},
+    {ImmutableString("textureOffset(s31;vf3;vi3;f1;"), 546, 1},
+    {ImmutableString("clamp(vu4;u1;u1;"), 547, 1},
+    {ImmutableString("faceforward(vf2;vf2;vf2;"), 548, 1},
+    {ImmutableString("bitCount(vi2;"), 549, 1},
+    {ImmutableString("textureLodOffset(us31;vf3;f1;vi3;"), 550, 1},
+    {ImmutableString("texture2D(s21;vf2;f1;"), 551, 1},
+    {ImmutableString("findMSB(i1;"), 552, 1},
+    {ImmutableString("textureGrad(is21;vf2;vf2;vf2;"), 553, 1},
+    {ImmutableString("exp(vf4;"), 554, 1},
+    {ImmutableString("atanh(vf4;"), 555, 1},
+    {ImmutableString("equal(vb3;vb3;"), 556, 1},
+    {ImmutableString("textureProjLod(is21;vf3;f1;"), 557, 1},
+    {ImmutableString("floor(f1;"), 558, 1},
+    {ImmutableString("greaterThan(vi2;vi2;"), 559, 1},
+    {ImmutableString("outerProduct(vf4;vf2;"), 560, 1},
+    {ImmutableString("textureSize(s31;i1;"), 561, 1},
+    {ImmutableString("textureGather(sCs1;vf3;"), 562, 1},
+    {ImmutableString("max(vf2;f1;"), 563, 1},
+    {ImmutableString("bitfieldInsert(vi4;vi4;i1;i1;"), 564, 1},
+    {ImmutableString("fwidth(vf4;"), 565, 2},
+    {ImmutableString("textureProjOffset(s31;vf4;vi3;"), 567, 1},
+    {ImmutableString("smoothstep(f1;f1;f1;"), 568, 1},
+    {ImmutableString("faceforward(vf3;vf3;vf3;"), 569, 1},
+    {ImmutableString("exp(f1;"), 570, 1},
+    {ImmutableString("dFdx(vf3;"), 571, 2},
+    {ImmutableString("texture(us31;vf3;f1;"), 573, 1},
+    {ImmutableString("mix(f1;f1;b1;"), 574, 1},
+    {ImmutableString("not(vb2;"), 575, 1},
+    {ImmutableString("texture2DProj(s21;vf4;"), 576, 1},
+    {ImmutableString("max(vu3;vu3;"), 577, 1},
+    {ImmutableString("matrixCompMult(mf3x2;mf3x2;"), 578, 1},
+    {ImmutableString("textureLodOffset(is31;vf3;f1;vi3;"), 579, 1},
+    {ImmutableString("texture(s31;vf3;"), 580, 1},
+    {ImmutableString("usubBorrow(vu4;vu4;vu4;"), 581, 1},
+    {ImmutableString("trunc(vf4;"), 582, 1},
+    {ImmutableString("textureLod(isC1;vf3;f1;"), 583, 1},
+    {ImmutableString("textureProj(us21;vf4;f1;"), 584, 1},
+    {ImmutableString("lessThan(vi2;vi2;"), 585, 1},
+    {ImmutableString("textureOffset(is31;vf3;vi3;"), 586, 1},
+    {ImmutableString("sqrt(vf4;"), 587, 1},
+    {ImmutableString("atan(vf2;"), 588, 1},
+    {ImmutableString("textureOffset(is2a1;vf3;vi2;"), 589, 1},
+    {ImmutableString("clamp(vu3;vu3;vu3;"), 590, 1},
+    {ImmutableString("imageLoad(im31;vi3;"), 591, 1},
+    {ImmutableString("textureProj(is31;vf4;"), 592, 1},
+    {ImmutableString("any(vb3;"), 593, 1},
+    {ImmutableString("asinh(f1;"), 594, 1},
+    {ImmutableString("imageSize(iim21;"), 595, 1},
+    {ImmutableString("findLSB(vu4;"), 596, 1},
+    {ImmutableString("mix(f1;f1;f1;"), 597, 1},
+    {ImmutableString("min(f1;f1;"), 598, 1},
+    {ImmutableString("acos(vf2;"), 599, 1},
+    {ImmutableString("atan(f1;"), 600, 1},
+    {ImmutableString("clamp(vu3;u1;u1;"), 601, 1},
+    {ImmutableString("textureSize(s2ms1;"), 602, 1},
+    {ImmutableString("all(vb3;"), 603, 1},
+    {ImmutableString("texture2DProj(s21;vf4;f1;"), 604, 1},
+    {ImmutableString("texelFetchOffset(us2a1;vi3;i1;vi2;"), 605, 1},
+    {ImmutableString("textureGather(isC1;vf3;"), 606, 1},
+    {ImmutableString("textureProjGradOffset(s2s1;vf4;vf2;vf2;vi2;"), 607, 1},
+    {ImmutableString("max(vf4;f1;"), 608, 1},
+    {ImmutableString("textureProj(is21;vf4;"), 609, 1},
+    {ImmutableString("imageSize(imc1;"), 610, 1},
+    {ImmutableString("textureProjGradOffset(s21;vf4;vf2;vf2;vi2;"), 611, 1},
+    {ImmutableString("fwidth(f1;"), 612, 2},
+    {ImmutableString("equal(vu4;vu4;"), 614, 1},
+    {ImmutableString("fract(vf2;"), 615, 1},
+    {ImmutableString("cosh(f1;"), 616, 1},
+    {ImmutableString("yuv_2_rgb(vf3;ycs1;"), 617, 1},
+    {ImmutableString("faceforward(vf4;vf4;vf4;"), 618, 1},
+    {ImmutableString("floor(vf4;"), 619, 1},
+    {ImmutableString("floor(vf2;"), 620, 1},
+    {ImmutableString("findMSB(vi4;"), 621, 1},
+    {ImmutableString("textureGatherOffset(is2a1;vf3;vi2;"), 622, 1},
+    {ImmutableString("length(f1;"), 623, 1},
+    {ImmutableString("cosh(vf4;"), 624, 1},
+    {ImmutableString("intBitsToFloat(vi2;"), 625, 1},
+    {ImmutableString("faceforward(f1;f1;f1;"), 626, 1},
+    {ImmutableString("textureProjLodOffset(us21;vf4;f1;vi2;"), 627, 1},
+    {ImmutableString("bitCount(vu2;"), 628, 1},
+    {ImmutableString("textureProjLodOffset(us21;vf3;f1;vi2;"), 629, 1},
+    {ImmutableString("textureProjGradOffset(is31;vf4;vf3;vf3;vi3;"), 630, 1},
+    {ImmutableString("sinh(vf2;"), 631, 1},
+    {ImmutableString("sinh(f1;"), 632, 1},
+    {ImmutableString("findMSB(vi3;"), 633, 1},
+    {ImmutableString("packHalf2x16(vf2;"), 634, 1},
+    {ImmutableString("textureGatherOffset(s2as1;vf3;f1;vi2;"), 635, 1},
+    {ImmutableString("texelFetchOffset(s21;vi2;i1;vi2;"), 636, 1},
+    {ImmutableString("lessThanEqual(vf4;vf4;"), 637, 1},
+    {ImmutableString("exp2(f1;"), 638, 1},
+    {ImmutableString("smoothstep(f1;f1;vf2;"), 639, 1},
+    {ImmutableString("min(vf2;vf2;"), 640, 1},
+    {ImmutableString("notEqual(vu2;vu2;"), 641, 1},
+    {ImmutableString("atomicCompSwap(i1;i1;i1;"), 642, 1},
+    {ImmutableString("round(vf2;"), 643, 1},
+    {ImmutableString("textureGather(us21;vf2;i1;"), 644, 1},
+    {ImmutableString("atomicAdd(i1;i1;"), 645, 1},
+    {ImmutableString("uintBitsToFloat(u1;"), 646, 1},
+    {ImmutableString("textureProjLodOffset(s2s1;vf4;f1;vi2;"), 647, 1},
+    {ImmutableString("textureProjOffset(is31;vf4;vi3;"), 648, 1},
+    {ImmutableString("imageLoad(uim2a1;vi3;"), 649, 1},
+    {ImmutableString("texelFetch(is2a1;vi3;i1;"), 650, 1},
+    {ImmutableString("textureProjLod(us31;vf4;f1;"), 651, 1},
+    {ImmutableString("clamp(vu2;u1;u1;"), 652, 1},
+    {ImmutableString("textureProj(is21;vf3;f1;"), 653, 1},
+    {ImmutableString("lessThanEqual(vf3;vf3;"), 654, 1},
+    {ImmutableString("radians(vf4;"), 655, 1},
+    {ImmutableString("textureGrad(us2a1;vf3;vf2;vf2;"), 656, 1},
+    {ImmutableString("texture(sC1;vf3;"), 657, 1},
+    {ImmutableString("reflect(vf4;vf4;"), 658, 1},
+    {ImmutableString("textureCubeGradEXT(sC1;vf3;vf3;vf3;"), 659, 1},
+    {ImmutableString("textureProj(s21;vf4;"), 660, 1},
+    {ImmutableString("notEqual(vb4;vb4;"), 661, 1},
+    {ImmutableString("EmitVertex("), 662, 1},
+    {ImmutableString("log2(vf4;"), 663, 1},
+    {ImmutableString("imageLoad(uimc1;vi3;"), 664, 1},
+    {ImmutableString("atan(vf4;"), 665, 1},
+    {ImmutableString("max(vf2;vf2;"), 666, 1},
+    {ImmutableString("textureGatherOffset(s21;vf2;vi2;"), 667, 1},
+    {ImmutableString("texture(s2s1;vf3;"), 668, 1},
+    {ImmutableString("refract(f1;f1;f1;"), 669, 1},
+    {ImmutableString("bitCount(vu3;"), 670, 1},
+    {ImmutableString("textureGrad(sC1;vf3;vf3;vf3;"), 671, 1},
+    {ImmutableString("greaterThan(vi3;vi3;"), 672, 1},
+    {ImmutableString("lessThan(vu2;vu2;"), 673, 1},
+    {ImmutableString("textureOffset(us31;vf3;vi3;"), 674, 1},
+    {ImmutableString("textureProjLod(is31;vf4;f1;"), 675, 1},
+    {ImmutableString("isnan(vf3;"), 676, 1},
+    {ImmutableString("min(vi4;vi4;"), 677, 1},
+    {ImmutableString("texture2D(sext1;vf2;"), 678, 1},
+    {ImmutableString("unpackHalf2x16(u1;"), 679, 1},
+    {ImmutableString("notEqual(vu3;vu3;"), 680, 1},
+    {ImmutableString("texture2DProjGradEXT(s21;vf3;vf2;vf2;"), 681, 1},
+    {ImmutableString("textureProjGradOffset(is21;vf3;vf2;vf2;vi2;"), 682, 1},
+    {ImmutableString("frexp(f1;i1;"), 683, 1},
+    {ImmutableString("inversesqrt(vf3;"), 684, 1},
+    {ImmutableString("memoryBarrierShared("), 685, 1},
+    {ImmutableString("textureGrad(s2a1;vf3;vf2;vf2;"), 686, 1},
+    {ImmutableString("sinh(vf4;"), 687, 1},
+    {ImmutableString("exp(vf2;"), 688, 1},
+    {ImmutableString("ceil(f1;"), 689, 1},
+    {ImmutableString("texelFetch(sext2y2y1;vi2;i1;"), 690, 1},
+    {ImmutableString("reflect(vf2;vf2;"), 691, 1},
+    {ImmutableString("log2(vf2;"), 692, 1},
+    {ImmutableString("distance(vf2;vf2;"), 693, 1},
+    {ImmutableString("greaterThanEqual(vi4;vi4;"), 694, 1},
+    {ImmutableString("degrees(f1;"), 695, 1},
+    {ImmutableString("texture(us31;vf3;"), 696, 1},
+    {ImmutableString("distance(vf4;vf4;"), 697, 1},
+    {ImmutableString("uaddCarry(vu4;vu4;vu4;"), 698, 1},
+    {ImmutableString("isnan(vf4;"), 699, 1},
+    {ImmutableString("atan(vf2;vf2;"), 700, 1},
+    {ImmutableString("imageLoad(im2a1;vi3;"), 701, 1},
+    {ImmutableString("imageSize(im2a1;"), 702, 1},
+    {ImmutableString("textureProjOffset(is21;vf4;vi2;"), 703, 1},
+    {ImmutableString("greaterThanEqual(vf4;vf4;"), 704, 1},
+    {ImmutableString("texelFetchOffset(s31;vi3;i1;vi3;"), 705, 1},
+    {ImmutableString("sign(vi4;"), 706, 1},
+    {ImmutableString("equal(vf4;vf4;"), 707, 1},
+    {ImmutableString("textureProjGrad(us21;vf3;vf2;vf2;"), 708, 1},
+    {ImmutableString("imageLoad(iim21;vi2;"), 709, 1},
+    {ImmutableString("textureProjGradOffset(us31;vf4;vf3;vf3;vi3;"), 710, 1},
+    {ImmutableString("equal(vu2;vu2;"), 711, 1},
+    {ImmutableString("textureLod(us2a1;vf3;f1;"), 712, 1},
+    {ImmutableString("bitfieldExtract(vi2;i1;i1;"), 713, 1},
+    {ImmutableString("roundEven(vf4;"), 714, 1},
+    {ImmutableString("texture(us21;vf2;"), 715, 1},
+    {ImmutableString("clamp(vf2;f1;f1;"), 716, 1},
+    {ImmutableString("dFdy(vf4;"), 717, 2},
+    {ImmutableString("mod(vf2;vf2;"), 719, 1},
+    {ImmutableString("transpose(mf4x4;"), 720, 1},
+    {ImmutableString("imageStore(iim2a1;vi3;vi4;"), 721, 1},
+    {ImmutableString("textureOffset(is21;vf2;vi2;f1;"), 722, 1},
+    {ImmutableString("textureProjLod(s2s1;vf4;f1;"), 723, 1},
+    {ImmutableString("bitfieldInsert(vu4;vu4;i1;i1;"), 724, 1},
+    {ImmutableString("imageLoad(iimc1;vi3;"), 725, 1},
+    {ImmutableString("textureLod(s2a1;vf3;f1;"), 726, 1},
+    {ImmutableString("roundEven(vf3;"), 727, 1},
+    {ImmutableString("cos(vf4;"), 728, 1},
+    {ImmutableString("textureGradOffset(s21;vf2;vf2;vf2;vi2;"), 729, 1},
+    {ImmutableString("min(vf3;f1;"), 730, 1},
+    {ImmutableString("abs(f1;"), 731, 1},
+    {ImmutableString("exp(vf3;"), 732, 1},
+    {ImmutableString("texture(s31;vf3;f1;"), 733, 1},
+    {ImmutableString("dFdy(vf3;"), 734, 2},
+    {ImmutableString("sin(f1;"), 736, 1},
+    {ImmutableString("intBitsToFloat(vi3;"), 737, 1},
+    {ImmutableString("clamp(i1;i1;i1;"), 738, 1},
+    {ImmutableString("atan(vf4;vf4;"), 739, 1},
+    {ImmutableString("dot(vf2;vf2;"), 740, 1},
+    {ImmutableString("tanh(vf2;"), 741, 1},
+    {ImmutableString("reflect(vf3;vf3;"), 742, 1},
+    {ImmutableString("bitfieldExtract(vu3;i1;i1;"), 743, 1},
+    {ImmutableString("textureProjGrad(is21;vf3;vf2;vf2;"), 744, 1},
+    {ImmutableString("uintBitsToFloat(vu4;"), 745, 1},
+    {ImmutableString("textureGather(usC1;vf3;i1;"), 746, 1},
+    {ImmutableString("textureSize(sext1;i1;"), 747, 1},
+    {ImmutableString("textureGather(is21;vf2;i1;"), 748, 1},
+    {ImmutableString("textureProjLod(us21;vf4;f1;"), 749, 1},
+    {ImmutableString("cos(f1;"), 750, 1},
+    {ImmutableString("isnan(vf2;"), 751, 1},
+    {ImmutableString("clamp(vi4;vi4;vi4;"), 752, 1},
+    {ImmutableString("step(f1;f1;"), 753, 1},
+    {ImmutableString("texelFetch(us2ms1;vi2;i1;"), 754, 1},
+    {ImmutableString("textureGrad(is31;vf3;vf3;vf3;"), 755, 1},
+    {ImmutableString("bitfieldReverse(i1;"), 756, 1},
+    {ImmutableString("sqrt(f1;"), 757, 1},
+    {ImmutableString("matrixCompMult(mf2x3;mf2x3;"), 758, 1},
+    {ImmutableString("textureLodOffset(us2a1;vf3;f1;vi2;"), 759, 1},
+    {ImmutableString("max(vi3;vi3;"), 760, 1},
+    {ImmutableString("textureGatherOffset(us21;vf2;vi2;i1;"), 761, 1},
+    {ImmutableString("refract(vf3;vf3;f1;"), 762, 1},
+    {ImmutableString("frexp(vf2;vi2;"), 763, 1},
+    {ImmutableString("textureGradOffset(is21;vf2;vf2;vf2;vi2;"), 764, 1},
+    {ImmutableString("usubBorrow(vu2;vu2;vu2;"), 765, 1},
+    {ImmutableString("textureGather(sCs1;vf3;f1;"), 766, 1},
+    {ImmutableString("matrixCompMult(mf3x3;mf3x3;"), 767, 1},
+    {ImmutableString("textureProj(us31;vf4;"), 768, 1},
+    {ImmutableString("textureProjOffset(is31;vf4;vi3;f1;"), 769, 1},
+    {ImmutableString("pow(f1;f1;"), 770, 1},
+    {ImmutableString("clamp(vf3;vf3;vf3;"), 771, 1},
+    {ImmutableString("textureProjOffset(is21;vf3;vi2;f1;"), 772, 1},
+    {ImmutableString("transpose(mf2x2;"), 773, 1},
+    {ImmutableString("clamp(vf2;vf2;vf2;"), 774, 1},
+    {ImmutableString("ldexp(vf3;vi3;"), 775, 1},
+    {ImmutableString("inversesqrt(vf2;"), 776, 1},
+    {ImmutableString("textureSize(is2ms1;"), 777, 1},
+    {ImmutableString("textureProj(sext2y2y1;vf3;f1;"), 778, 1},
+    {ImmutableString("min(vi3;vi3;"), 779, 1},
+    {ImmutableString("min(vu3;u1;"), 780, 1},
+    {ImmutableString("textureProj(us21;vf4;"), 781, 1},
+    {ImmutableString("textureOffset(us31;vf3;vi3;f1;"), 782, 1},
+    {ImmutableString("clamp(vf4;f1;f1;"), 783, 1},
+    {ImmutableString("usubBorrow(vu3;vu3;vu3;"), 784, 1},
+    {ImmutableString("bitfieldReverse(vi2;"), 785, 1},
+    {ImmutableString("texture2DLod(s21;vf2;f1;"), 786, 1},
+    {ImmutableString("textureOffset(s2a1;vf3;vi2;f1;"), 787, 1},
+    {ImmutableString("sign(f1;"), 788, 1},
+    {ImmutableString("textureGatherOffset(us21;vf2;vi2;"), 789, 1},
+    {ImmutableString("textureProjLod(is21;vf4;f1;"), 790, 1},
+    {ImmutableString("atomicAnd(u1;u1;"), 791, 1},
+    {ImmutableString("cos(vf3;"), 792, 1},
+    {ImmutableString("floatBitsToInt(vf3;"), 793, 1},
+    {ImmutableString("texture(sext1;vf2;"), 794, 1},
+    {ImmutableString("texture2DLodEXT(s21;vf2;f1;"), 795, 1},
+    {ImmutableString("textureCubeLod(sC1;vf3;f1;"), 796, 1},
+    {ImmutableString("tanh(vf4;"), 797, 1},
+    {ImmutableString("clamp(vi2;i1;i1;"), 798, 1},
+    {ImmutableString("min(vu4;u1;"), 799, 1},
+    {ImmutableString("textureProjOffset(is21;vf4;vi2;f1;"), 800, 1},
+    {ImmutableString("exp2(vf3;"), 801, 1},
+    {ImmutableString("imageStore(uim21;vi2;vu4;"), 802, 1},
+    {ImmutableString("cosh(vf3;"), 803, 1},
+    {ImmutableString("atomicAdd(u1;u1;"), 804, 1},
+    {ImmutableString("normalize(vf2;"), 805, 1},
+    {ImmutableString("textureLodOffset(s31;vf3;f1;vi3;"), 806, 1},
+    {ImmutableString("degrees(vf3;"), 807, 1},
+    {ImmutableString("atan(f1;f1;"), 808, 1},
+    {ImmutableString("textureGatherOffset(s2a1;vf3;vi2;"), 809, 1},
+    {ImmutableString("fract(vf3;"), 810, 1},
+    {ImmutableString("mix(vf3;vf3;vb3;"), 811, 1},
+    {ImmutableString("fwidth(vf3;"), 812, 2},
+    {ImmutableString("fract(f1;"), 814, 1},
+    {ImmutableString("pow(vf4;vf4;"), 815, 1},
+    {ImmutableString("textureProjGrad(s31;vf4;vf3;vf3;"), 816, 1},
+    {ImmutableString("step(f1;vf2;"), 817, 1},
+    {ImmutableString("texelFetchOffset(is2a1;vi3;i1;vi2;"), 818, 1},
+    {ImmutableString("textureProjGrad(us21;vf4;vf2;vf2;"), 819, 1},
+    {ImmutableString("texture(usC1;vf3;f1;"), 820, 1},
+    {ImmutableString("textureProjLod(s21;vf3;f1;"), 821, 1},
+    {ImmutableString("textureProj(sext1;vf4;"), 822, 1},
+    {ImmutableString("textureProjOffset(s21;vf4;vi2;f1;"), 823, 1},
+    {ImmutableString("reflect(f1;f1;"), 824, 1},
+    {ImmutableString("textureProjOffset(s31;vf4;vi3;f1;"), 825, 1},
+    {ImmutableString("textureGather(is2a1;vf3;i1;"), 826, 1},
+    {ImmutableString("textureProjOffset(us21;vf3;vi2;f1;"), 827, 1},
+    {ImmutableString("textureLod(sC1;vf3;f1;"), 828, 1},
+    {ImmutableString("distance(f1;f1;"), 829, 1},
+    {ImmutableString("textureSize(us21;i1;"), 830, 1},
+    {ImmutableString("textureGradOffset(is31;vf3;vf3;vf3;vi3;"), 831, 1},
+    {ImmutableString("bitfieldInsert(u1;u1;i1;i1;"), 832, 1},
+    {ImmutableString("textureSize(usC1;i1;"), 833, 1},
+    {ImmutableString("notEqual(vf3;vf3;"), 834, 1},
+    {ImmutableString("tanh(vf3;"), 835, 1},
+    {ImmutableString("textureProjGradOffset(s31;vf4;vf3;vf3;vi3;"), 836, 1},
+    {ImmutableString("textureLodOffset(is21;vf2;f1;vi2;"), 837, 1},
+    {ImmutableString("EndPrimitive("), 838, 1},
+    {ImmutableString("textureGrad(sCs1;vf4;vf3;vf3;"), 839, 1},
+    {ImmutableString("rgb_2_yuv(vf3;ycs1;"), 840, 1},
+    {ImmutableString("texture2DProjGradEXT(s21;vf4;vf2;vf2;"), 841, 1},
+    {ImmutableString("isinf(vf4;"), 842, 1},
+    {ImmutableString("trunc(vf2;"), 843, 1},
+    {ImmutableString("textureSize(s2as1;i1;"), 844, 1},
+    {ImmutableString("findMSB(u1;"), 845, 1},
+    {ImmutableString("unpackUnorm2x16(u1;"), 846, 1},
+    {ImmutableString("textureGather(s2s1;vf2;f1;"), 847, 1},
+    {ImmutableString("texture2DProjLodEXT(s21;vf4;f1;"), 848, 1},
+    {ImmutableString("textureGradOffset(s2s1;vf3;vf2;vf2;vi2;"), 849, 1},
+    {ImmutableString("textureGradOffset(is2a1;vf3;vf2;vf2;vi2;"), 850, 1},
+};
+
+constexpr UnmangledBuiltInEntry kUnmangledEntries[] = {
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kEXT_shader_texture_lod},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL1_BUILTINS, 0},
+    {ESSL1_BUILTINS, BuiltInCondition::kOES_EGL_image_external},
+    {ESSL1_BUILTINS, BuiltInCondition::kFragmentShader},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, BuiltInCondition::kComputeShader},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {ESSL3_1_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, BuiltInCondition::kComputeShader},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, BuiltInCondition::kGeometryShader},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL1_BUILTINS, BuiltInCondition::kEXT_shader_texture_lod},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL1_BUILTINS, 0},
+    {ESSL1_BUILTINS, BuiltInCondition::kFragmentShader},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, BuiltInCondition::kOES_EGL_image_external_essl3},
+    {ESSL3_BUILTINS, BuiltInCondition::kEXT_YUV_target},
+    {COMMON_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kEXT_shader_texture_lod},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, BuiltInCondition::kEXT_YUV_target},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, BuiltInCondition::kGeometryShader},
+    {ESSL3_BUILTINS, 0},
+    {ESSL1_BUILTINS, BuiltInCondition::kVertexShader},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL1_BUILTINS, BuiltInCondition::kEXT_shader_texture_lod},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL1_BUILTINS, BuiltInCondition::kARB_texture_rectangle},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, BuiltInCondition::kEXT_YUV_target},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_standard_derivatives},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL1_BUILTINS, BuiltInCondition::kVertexShader},
+    {ESSL3_1_BUILTINS, BuiltInCondition::kComputeShader},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, BuiltInCondition::kOES_EGL_image_external_essl3},
+    {ESSL3_BUILTINS, BuiltInCondition::kEXT_YUV_target},
+    {ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {ESSL3_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_EGL_image_external_essl3},
+    {ESSL3_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kEXT_YUV_target},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, BuiltInCondition::kOES_EGL_image_external_essl3},
+    {ESSL3_BUILTINS, BuiltInCondition::kEXT_YUV_target},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL1_BUILTINS, BuiltInCondition::kEXT_shader_texture_lod},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL1_BUILTINS, BuiltInCondition::kVertexShader},
+    {ESSL1_BUILTINS, 0},
+    {ESSL1_BUILTINS, BuiltInCondition::kOES_EGL_image_external},
+    {ESSL1_BUILTINS, BuiltInCondition::kFragmentShader},
+    {COMMON_BUILTINS, 0},
+    {ESSL1_BUILTINS, BuiltInCondition::kARB_texture_rectangle},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_BUILTINS, BuiltInCondition::kOES_EGL_image_external_essl3},
+    {ESSL3_BUILTINS, BuiltInCondition::kEXT_YUV_target},
+    {ESSL3_BUILTINS, BuiltInCondition::kFragmentShader},
+    {ESSL3_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kOES_EGL_image_external_essl3},
+    {ESSL3_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kEXT_YUV_target},
+    {ESSL3_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {ESSL3_BUILTINS, 0},
+    {ESSL3_1_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {COMMON_BUILTINS, 0},
+    {ESSL1_BUILTINS, BuiltInCondition::kFragmentShader | BuiltInCondition::kEXT_shader_texture_lod},
+};
+
+constexpr uint32_t kUnmangledSeeds[] = {
+    9, 44, 28, 116, 79, 20, 29, 2, 505, 1, 85, 0, 6, 22, 345, 22, 8, 14, 29, 23, 17, 326, 13, 22,
+    152, 1, 180, 92, 366, 292, 51, 22, 376, 9, 202, 6,
+};
+
+constexpr HashSlot kUnmangledSlots[] = {
+    {ImmutableString("log"), 0, 1},
+    {ImmutableString("dFdx"), 1, 2},
+    {ImmutableString("memoryBarrierAtomicCounter"), 3, 1},
+    {ImmutableString("unpackSnorm2x16"), 4, 1},
+    {ImmutableString("atomicAdd"), 5, 1},
+    {ImmutableString("texture2DLodEXT"), 6, 1},
+    {ImmutableString("roundEven"), 7, 1},
+    {ImmutableString("ceil"), 8, 1},
+    {ImmutableString("round"), 9, 1},
+    {ImmutableString("bitfieldExtract"), 10, 1},
+    {ImmutableString("atomicOr"), 11, 1},
+    {ImmutableString("textureProjOffset"), 12, 2},
+    {ImmutableString("greaterThan"), 14, 2},
+    {ImmutableString("packUnorm4x8"), 16, 1},
+    {ImmutableString("texture2DProj"), 17, 3},
+    {ImmutableString("bitfieldInsert"), 20, 1},
+    {ImmutableString("clamp"), 21, 2},
+    {ImmutableString("pow"), 23, 1},
+    {ImmutableString("max"), 24, 2},
+    {ImmutableString("groupMemoryBarrier"), 26, 1},
+    {ImmutableString("textureOffset"), 27, 2},
+    {ImmutableString("ldexp"), 29, 1},
+    {ImmutableString("inversesqrt"), 30, 1},
+    {ImmutableString("barrier"), 31, 1},
+    {ImmutableString("sign"), 32, 2},
+    {ImmutableString("sin"), 34, 1},
+    {ImmutableString("normalize"), 35, 1},
+    {ImmutableString("textureProjLod"), 36, 1},
+    {ImmutableString("uaddCarry"), 37, 1},
+    {ImmutableString("EmitVertex"), 38, 1},
+    {ImmutableString("textureProjGradOffset"), 39, 1},
+    {ImmutableString("imageLoad"), 40, 1},
+    {ImmutableString("textureGradOffset"), 41, 1},
+    {ImmutableString("atomicCompSwap"), 42, 1},
+    {ImmutableString("radians"), 43, 1},
+    {ImmutableString("atomicMin"), 44, 1},
+    {ImmutableString("faceforward"), 45, 1},
+    {ImmutableString("cos"), 46, 1},
+    {ImmutableString("min"), 47, 2},
+    {ImmutableString("outerProduct"), 49, 1},
+    {ImmutableString("cross"), 50, 1},
+    {ImmutableString("greaterThanEqual"), 51, 2},
+    {ImmutableString("atanh"), 53, 1},
+    {ImmutableString("bitCount"), 54, 1},
+    {ImmutableString("acos"), 55, 1},
+    {ImmutableString("packSnorm2x16"), 56, 1},
+    {ImmutableString("usubBorrow"), 57, 1},
+    {ImmutableString("log2"), 58, 1},
+    {ImmutableString("asinh"), 59, 1},
+    {ImmutableString("notEqual"), 60, 2},
+    {ImmutableString("distance"), 62, 1},
+    {ImmutableString("isinf"), 63, 1},
+    {ImmutableString("trunc"), 64, 1},
+    {ImmutableString("textureGather"), 65, 1},
+    {ImmutableString("texture2DGradEXT"), 66, 1},
+    {ImmutableString("all"), 67, 1},
+    {ImmutableString("mix"), 68, 2},
+    {ImmutableString("acosh"), 70, 1},
+    {ImmutableString("atomicAnd"), 71, 1},
+    {ImmutableString("textureCube"), 72, 2},
+    {ImmutableString("cosh"), 74, 1},
+    {ImmutableString("textureProjLodOffset"), 75, 1},
+    {ImmutableString("textureSize"), 76, 3},
+    {ImmutableString("floor"), 79, 1},
+    {ImmutableString("tan"), 80, 1},
+    {ImmutableString("matrixCompMult"), 81, 2},
+    {ImmutableString("texture2DProjLodEXT"), 83, 1},
+    {ImmutableString("lessThanEqual"), 84, 2},
+    {ImmutableString("yuv_2_rgb"), 86, 1},
+    {ImmutableString("unpackHalf2x16"), 87, 1},
+    {ImmutableString("refract"), 88, 1},
+    {ImmutableString("packSnorm4x8"), 89, 1},
+    {ImmutableString("not"), 90, 1},
+    {ImmutableString("EndPrimitive"), 91, 1},
+    {ImmutableString("textureLod"), 92, 1},
+    {ImmutableString("texture2DProjLod"), 93, 1},
+    {ImmutableString("floatBitsToUint"), 94, 1},
+    {ImmutableString("atomicExchange"), 95, 1},
+    {ImmutableString("sqrt"), 96, 1},
+    {ImmutableString("findMSB"), 97, 1},
+    {ImmutableString("atomicCounterDecrement"), 98, 1},
+    {ImmutableString("asin"), 99, 1},
+    {ImmutableString("findLSB"), 100, 1},
+    {ImmutableString("unpackUnorm2x16"), 101, 1},
+    {ImmutableString("uintBitsToFloat"), 102, 1},
+    {ImmutableString("textureProjGrad"), 103, 1},
+    {ImmutableString("texture2DProjGradEXT"), 104, 1},
+    {ImmutableString("determinant"), 105, 1},
+    {ImmutableString("memoryBarrierBuffer"), 106, 1},
+    {ImmutableString("imageStore"), 107, 1},
+    {ImmutableString("step"), 108, 1},
+    {ImmutableString("texture2DRectProj"), 109, 1},
+    {ImmutableString("exp2"), 110, 1},
+    {ImmutableString("modf"), 111, 1},
+    {ImmutableString("equal"), 112, 2},
+    {ImmutableString("dFdy"), 114, 2},
+    {ImmutableString("transpose"), 116, 1},
+    {ImmutableString("isnan"), 117, 1},
+    {ImmutableString("rgb_2_yuv"), 118, 1},
+    {ImmutableString("sinh"), 119, 1},
+    {ImmutableString("fwidth"), 120, 2},
+    {ImmutableString("textureGrad"), 122, 1},
+    {ImmutableString("texelFetchOffset"), 123, 1},
+    {ImmutableString("textureCubeLod"), 124, 1},
+    {ImmutableString("memoryBarrierShared"), 125, 1},
+    {ImmutableString("fract"), 126, 1},
+    {ImmutableString("unpackSnorm4x8"), 127, 1},
+    {ImmutableString("textureProj"), 128, 6},
+    {ImmutableString("texelFetch"), 134, 4},
+    {ImmutableString("packUnorm2x16"), 138, 1},
+    {ImmutableString("abs"), 139, 2},
+    {ImmutableString("dot"), 141, 1},
+    {ImmutableString("bitfieldReverse"), 142, 1},
+    {ImmutableString("floatBitsToInt"), 143, 1},
+    {ImmutableString("textureCubeGradEXT"), 144, 1},
+    {ImmutableString("exp"), 145, 1},
+    {ImmutableString("atomicCounter"), 146, 1},
+    {ImmutableString("inverse"), 147, 1},
+    {ImmutableString("memoryBarrierImage"), 148, 1},
+    {ImmutableString("any"), 149, 1},
+    {ImmutableString("packHalf2x16"), 150, 1},
+    {ImmutableString("texture2DLod"), 151, 1},
+    {ImmutableString("texture2D"), 152, 3},
+    {ImmutableString("length"), 155, 1},
+    {ImmutableString("texture2DRect"), 156, 1},
+    {ImmutableString("degrees"), 157, 1},
+    {ImmutableString("imageSize"), 158, 1},
+    {ImmutableString("smoothstep"), 159, 1},
+    {ImmutableString("frexp"), 160, 1},
+    {ImmutableString("atomicXor"), 161, 1},
+    {ImmutableString("umulExtended"), 162, 1},
+    {ImmutableString("memoryBarrier"), 163, 1},
+    {ImmutableString("textureLodOffset"), 164, 1},
+    {ImmutableString("atomicCounterIncrement"), 165, 1},
+    {ImmutableString("intBitsToFloat"), 166, 1},
+    {ImmutableString("textureGatherOffset"), 167, 1},
+    {ImmutableString("unpackUnorm4x8"), 168, 1},
+    {ImmutableString("texture"), 169, 6},
+    {ImmutableString("lessThan"), 175, 2},
+    {ImmutableString("reflect"), 177, 1},
+    {ImmutableString("atomicMax"), 178, 1},
+    {ImmutableString("tanh"), 179, 1},
+    {ImmutableString("imulExtended"), 180, 1},
+    {ImmutableString("atan"), 181, 1},
+    {ImmutableString("mod"), 182, 1},
+    {ImmutableString("textureCubeLodEXT"), 183, 1},
+};
+
+}  // anonymous namespace
+
+size_t FindBuiltInFunctions(const ImmutableString &mangledName,
+                            const BuiltInFunctionEntry **entriesOut)
+{
+    const HashSlot *slot = FindSlot(kFunctionSeeds, kFunctionSlots, mangledName);
+    if (slot == nullptr)
+    {
+        return 0;
+    }
+    *entriesOut = &kFunctionEntries[slot->firstEntry];
+    return slot->entryCount;
+}
+
+size_t FindUnmangledBuiltIns(const ImmutableString &name, const UnmangledBuiltInEntry **entriesOut)
+{
+    const HashSlot *slot = FindSlot(kUnmangledSeeds, kUnmangledSlots, name);
+    if (slot == nullptr)
+    {
+        return 0;
+    }
+    *entriesOut = &kUnmangledEntries[slot->firstEntry];
+    return slot->entryCount;
+}
+
+}  // namespace sh
@@ -0,0 +1,67 @@
+// GENERATED FILE - DO NOT EDIT.
+// Generated by gen_builtin_symbols.py using data from builtin_function_declarations.txt.
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SymbolTable_autogen.h:
+//   Compile-time initialized built-in functions of the symbol table.
+
+#ifndef COMPILER_TRANSLATOR_SYMBOLTABLE_AUTOGEN_H_
+#define COMPILER_TRANSLATOR_SYMBOLTABLE_AUTOGEN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "compiler/translator/ImmutableString.h"
+
+namespace sh
+{
+
+class TFunction;
+
+// Some built-in functions only exist for some shader types or when an extension is enabled in
+// ShBuiltInResources. A function exists only if all of the conditions in its mask are met.
+namespace BuiltInCondition
+{
+constexpr uint16_t kFragmentShader = 1u << 0;
+constexpr uint16_t kVertexShader = 1u << 1;
+constexpr uint16_t kComputeShader = 1u << 2;
+constexpr uint16_t kGeometryShader = 1u << 3;
+constexpr uint16_t kOES_EGL_image_external = 1u << 4;
+constexpr uint16_t kOES_EGL_image_external_essl3 = 1u << 5;
+constexpr uint16_t kEXT_YUV_target = 1u << 6;
+constexpr uint16_t kARB_texture_rectangle = 1u << 7;
+constexpr uint16_t kEXT_shader_texture_lod = 1u << 8;
+constexpr uint16_t kOES_standard_derivatives = 1u << 9;
+}  // namespace BuiltInCondition
+
+struct BuiltInFunctionEntry
+{
+    const TFunction *function;
+    int level;
+    uint16_t conditions;
+};
+
+struct UnmangledBuiltInEntry
+{
+    int level;
+    uint16_t conditions;
+};
+
+// The built-in functions have the unique ids from 1 to kLastStaticBuiltInId.
+constexpr int kLastStaticBuiltInId = 851;
+
+// Returns the number of built-in functions with the mangled name. Their entries are sorted from the
+// highest symbol level to the lowest.
+size_t FindBuiltInFunctions(const ImmutableString &mangledName,
+                            const BuiltInFunctionEntry **entriesOut);
+
+// Returns the number of symbol level and condition combinations that declare built-in functions
+// with the name.
+size_t FindUnmangledBuiltIns(const ImmutableString &name, const UnmangledBuiltInEntry **entriesOut);
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_SYMBOLTABLE_AUTOGEN_H_
@@ -22,7 +22,9 @@ class TSymbolUniqueId
     POOL_ALLOCATOR_NEW_DELETE();
     explicit TSymbolUniqueId(TSymbolTable *symbolTable);
     explicit TSymbolUniqueId(const TSymbol &symbol);
-    TSymbolUniqueId(const TSymbolUniqueId &);
+    // Used for the built-ins that are initialized at compile time.
+    explicit constexpr TSymbolUniqueId(int id) : mId(id) {}
+    constexpr TSymbolUniqueId(const TSymbolUniqueId &) = default;
     TSymbolUniqueId &operator=(const TSymbolUniqueId &);
     bool operator==(const TSymbolUniqueId &) const;
 
@@ -0,0 +1,651 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TranslationCache.cpp: Process-wide cache of translation results.
+//
+
+#include "compiler/translator/TranslationCache.h"
+
+#include <anglebase/sha1.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "common/debug.h"
+
+namespace sh
+{
+
+namespace
+{
+
+// Identifies cache files. The version changes whenever the serialized form changes.
+constexpr uint32_t kCacheFileMagic   = 0x43544E41;  // "ANTC"
+constexpr uint32_t kCacheFileVersion = 1;
+
+class BlobWriter : angle::NonCopyable
+{
+  public:
+    explicit BlobWriter(std::vector<uint8_t> *blob) : mBlob(blob) {}
+
+    void writeBytes(const void *data, size_t size)
+    {
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        mBlob->insert(mBlob->end(), bytes, bytes + size);
+    }
+
+    template <typename IntT>
+    void writeInt(IntT value)
+    {
+        static_assert(sizeof(IntT) <= sizeof(int64_t), "Unsupported integer size");
+        int64_t value64 = static_cast<int64_t>(value);
+        writeBytes(&value64, sizeof(value64));
+    }
+
+    void writeString(const std::string &value)
+    {
+        writeInt(value.size());
+        writeBytes(value.data(), value.size());
+    }
+
+  private:
+    std::vector<uint8_t> *mBlob;
+};
+
+class BlobReader : angle::NonCopyable
+{
+  public:
+    BlobReader(const uint8_t *data, size_t size)
+        : mData(data), mSize(size), mOffset(0), mError(false)
+    {
+    }
+
+    bool error() const { return mError; }
+    bool endOfBlob() const { return mOffset == mSize; }
+
+    void readBytes(void *data, size_t size)
+    {
+        if (mError || size > mSize - mOffset)
+        {
+            mError = true;
+            return;
+        }
+        memcpy(data, mData + mOffset, size);
+        mOffset += size;
+    }
+
+    template <typename IntT>
+    IntT readInt()
+    {
+        int64_t value64 = 0;
+        readBytes(&value64, sizeof(value64));
+        return static_cast<IntT>(value64);
+    }
+
+    template <typename IntT>
+    void readInt(IntT *valueOut)
+    {
+        *valueOut = readInt<IntT>();
+    }
+
+    void readBool(bool *valueOut) { *valueOut = (readInt<int>() != 0); }
+
+    template <typename EnumT>
+    void readEnum(EnumT *valueOut)
+    {
+        *valueOut = static_cast<EnumT>(readInt<int>());
+    }
+
+    // Also used to bound the number of elements of vectors, since every element takes at least a
+    // byte.
+    bool hasRemaining(size_t size) const { return !mError && size <= mSize - mOffset; }
+
+    void readString(std::string *valueOut)
+    {
+        size_t size = readInt<size_t>();
+        if (!hasRemaining(size))
+        {
+            mError = true;
+            return;
+        }
+        valueOut->assign(reinterpret_cast<const char *>(mData + mOffset), size);
+        mOffset += size;
+    }
+
+    // Reads the element count of a vector.
+    size_t readCount()
+    {
+        size_t count = readInt<size_t>();
+        if (!hasRemaining(count))
+        {
+            mError = true;
+            return 0;
+        }
+        return count;
+    }
+
+  private:
+    const uint8_t *mData;
+    size_t mSize;
+    size_t mOffset;
+    bool mError;
+};
+
+void WriteShaderVariable(BlobWriter *writer, const ShaderVariable &var)
+{
+    writer->writeInt(var.type);
+    writer->writeInt(var.precision);
+    writer->writeString(var.name);
+    writer->writeString(var.mappedName);
+    writer->writeInt(var.arraySizes.size());
+    for (unsigned int arraySize : var.arraySizes)
+    {
+        writer->writeInt(arraySize);
+    }
+    writer->writeInt(var.flattenedOffsetInParentArrays);
+    writer->writeInt(var.staticUse);
+    writer->writeInt(var.fields.size());
+    for (const ShaderVariable &field : var.fields)
+    {
+        WriteShaderVariable(writer, field);
+    }
+    writer->writeString(var.structName);
+}
+
+void ReadShaderVariable(BlobReader *reader, ShaderVariable *var)
+{
+    reader->readInt(&var->type);
+    reader->readInt(&var->precision);
+    reader->readString(&var->name);
+    reader->readString(&var->mappedName);
+    var->arraySizes.resize(reader->readCount());
+    for (unsigned int &arraySize : var->arraySizes)
+    {
+        reader->readInt(&arraySize);
+    }
+    reader->readInt(&var->flattenedOffsetInParentArrays);
+    reader->readBool(&var->staticUse);
+    var->fields.resize(reader->readCount());
+    for (ShaderVariable &field : var->fields)
+    {
+        ReadShaderVariable(reader, &field);
+    }
+    reader->readString(&var->structName);
+}
+
+void WriteVariable(BlobWriter *writer, const Attribute &var)
+{
+    WriteShaderVariable(writer, var);
+    writer->writeInt(var.location);
+}
+
+void ReadVariable(BlobReader *reader, Attribute *var)
+{
+    ReadShaderVariable(reader, var);
+    reader->readInt(&var->location);
+}
+
+void WriteVariable(BlobWriter *writer, const OutputVariable &var)
+{
+    WriteShaderVariable(writer, var);
+    writer->writeInt(var.location);
+}
+
+void ReadVariable(BlobReader *reader, OutputVariable *var)
+{
+    ReadShaderVariable(reader, var);
+    reader->readInt(&var->location);
+}
+
+void WriteVariable(BlobWriter *writer, const Uniform &var)
+{
+    WriteShaderVariable(writer, var);
+    writer->writeInt(var.location);
+    writer->writeInt(var.binding);
+    writer->writeInt(var.offset);
+    writer->writeInt(var.readonly);
+    writer->writeInt(var.writeonly);
+}
+
+void ReadVariable(BlobReader *reader, Uniform *var)
+{
+    ReadShaderVariable(reader, var);
+    reader->readInt(&var->location);
+    reader->readInt(&var->binding);
+    reader->readInt(&var->offset);
+    reader->readBool(&var->readonly);
+    reader->readBool(&var->writeonly);
+}
+
+void WriteVariable(BlobWriter *writer, const Varying &var)
+{
+    WriteShaderVariable(writer, var);
+    writer->writeInt(var.location);
+    writer->writeInt(var.interpolation);
+    writer->writeInt(var.isInvariant);
+}
+
+void ReadVariable(BlobReader *reader, Varying *var)
+{
+    ReadShaderVariable(reader, var);
+    reader->readInt(&var->location);
+    reader->readEnum(&var->interpolation);
+    reader->readBool(&var->isInvariant);
+}
+
+void WriteVariable(BlobWriter *writer, const InterfaceBlock &block)
+{
+    writer->writeString(block.name);
+    writer->writeString(block.mappedName);
+    writer->writeString(block.instanceName);
+    writer->writeInt(block.arraySize);
+    writer->writeInt(block.layout);
+    writer->writeInt(block.isRowMajorLayout);
+    writer->writeInt(block.binding);
+    writer->writeInt(block.staticUse);
+    writer->writeInt(static_cast<int>(block.blockType));
+    writer->writeInt(block.fields.size());
+    for (const InterfaceBlockField &field : block.fields)
+    {
+        WriteShaderVariable(writer, field);
+        writer->writeInt(field.isRowMajorLayout);
+    }
+}
+
+void ReadVariable(BlobReader *reader, InterfaceBlock *block)
+{
+    reader->readString(&block->name);
+    reader->readString(&block->mappedName);
+    reader->readString(&block->instanceName);
+    reader->readInt(&block->arraySize);
+    reader->readEnum(&block->layout);
+    reader->readBool(&block->isRowMajorLayout);
+    reader->readInt(&block->binding);
+    reader->readBool(&block->staticUse);
+    reader->readEnum(&block->blockType);
+    block->fields.resize(reader->readCount());
+    for (InterfaceBlockField &field : block->fields)
+    {
+        ReadShaderVariable(reader, &field);
+        reader->readBool(&field.isRowMajorLayout);
+    }
+}
+
+template <typename VarT>
+void WriteVariableList(BlobWriter *writer, const std::vector<VarT> &variables)
+{
+    writer->writeInt(variables.size());
+    for (const VarT &var : variables)
+    {
+        WriteVariable(writer, var);
+    }
+}
+
+template <typename VarT>
+void ReadVariableList(BlobReader *reader, std::vector<VarT> *variables)
+{
+    variables->resize(reader->readCount());
+    for (VarT &var : *variables)
+    {
+        ReadVariable(reader, &var);
+    }
+}
+
+void SerializeResults(const TranslationResults &results, std::vector<uint8_t> *blob)
+{
+    BlobWriter writer(blob);
+
+    writer.writeString(results.infoLog);
+    writer.writeString(results.objectCode);
+    writer.writeInt(results.shaderVersion);
+
+    writer.writeInt(results.variablesCollected);
+    WriteVariableList(&writer, results.attributes);
+    WriteVariableList(&writer, results.outputVariables);
+    WriteVariableList(&writer, results.uniforms);
+    WriteVariableList(&writer, results.inputVaryings);
+    WriteVariableList(&writer, results.outputVaryings);
+    WriteVariableList(&writer, results.uniformBlocks);
+    WriteVariableList(&writer, results.shaderStorageBlocks);
+    WriteVariableList(&writer, results.inBlocks);
+
+    writer.writeInt(results.nameMap.size());
+    for (const auto &namePair : results.nameMap)
+    {
+        writer.writeString(namePair.first);
+        writer.writeString(namePair.second);
+    }
+
+    writer.writeInt(results.computeShaderLocalSizeDeclared);
+    for (int localSize : results.computeShaderLocalSize.localSizeQualifiers)
+    {
+        writer.writeInt(localSize);
+    }
+    writer.writeInt(results.numViews);
+
+    writer.writeInt(results.geometryShaderMaxVertices);
+    writer.writeInt(results.geometryShaderInvocations);
+    writer.writeInt(results.geometryShaderInputPrimitiveType);
+    writer.writeInt(results.geometryShaderOutputPrimitiveType);
+}
+
+bool DeserializeResults(const std::vector<uint8_t> &blob, TranslationResults *results)
+{
+    BlobReader reader(blob.data(), blob.size());
+
+    reader.readString(&results->infoLog);
+    reader.readString(&results->objectCode);
+    reader.readInt(&results->shaderVersion);
+
+    reader.readBool(&results->variablesCollected);
+    ReadVariableList(&reader, &results->attributes);
+    ReadVariableList(&reader, &results->outputVariables);
+    ReadVariableList(&reader, &results->uniforms);
+    ReadVariableList(&reader, &results->inputVaryings);
+    ReadVariableList(&reader, &results->outputVaryings);
+    ReadVariableList(&reader, &results->uniformBlocks);
+    ReadVariableList(&reader, &results->shaderStorageBlocks);
+    ReadVariableList(&reader, &results->inBlocks);
+
+    size_t nameCount = reader.readCount();
+    for (size_t nameIndex = 0; nameIndex < nameCount && !reader.error(); ++nameIndex)
+    {
+        std::string name;
+        reader.readString(&name);
+        reader.readString(&results->nameMap[name]);
+    }
+
+    reader.readBool(&results->computeShaderLocalSizeDeclared);
+    for (int &localSize : results->computeShaderLocalSize.localSizeQualifiers)
+    {
+        reader.readInt(&localSize);
+    }
+    reader.readInt(&results->numViews);
+
+    reader.readInt(&results->geometryShaderMaxVertices);
+    reader.readInt(&results->geometryShaderInvocations);
+    reader.readEnum(&results->geometryShaderInputPrimitiveType);
+    reader.readEnum(&results->geometryShaderOutputPrimitiveType);
+
+    return !reader.error() && reader.endOfBlob();
+}
+
+}  // anonymous namespace
+
+TranslationResults::TranslationResults()
+    : shaderVersion(100),
+      variablesCollected(false),
+      computeShaderLocalSizeDeclared(false),
+      computeShaderLocalSize(-1),
+      numViews(-1),
+      geometryShaderMaxVertices(-1),
+      geometryShaderInvocations(0),
+      geometryShaderInputPrimitiveType(EptUndefined),
+      geometryShaderOutputPrimitiveType(EptUndefined)
+{
+}
+
+TranslationResults::~TranslationResults()
+{
+}
+
+size_t TranslationCache::TranslationHashHasher::operator()(
+    const TranslationHash &translationHash) const
+{
+    // The hash is already uniformly distributed, so its first bytes are enough.
+    size_t hash = 0;
+    memcpy(&hash, translationHash.data(), sizeof(hash));
+    return hash;
+}
+
+TranslationCache::TranslationCache()
+    : mEntries(EntryMap::NO_AUTO_EVICT), mMaxSize(kDefaultTranslationCacheMaxSize), mCurrentSize(0)
+{
+}
+
+TranslationCache::~TranslationCache()
+{
+}
+
+void TranslationCache::setMaxSize(size_t maxSizeBytes)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mMaxSize = maxSizeBytes;
+    shrinkToSizeLocked(mMaxSize);
+}
+
+bool TranslationCache::isEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mMaxSize > 0;
+}
+
+bool TranslationCache::get(const TranslationHash &translationHash,
+                           TranslationResults *resultsOut)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto entry = mEntries.Get(translationHash);
+    if (entry == mEntries.end())
+    {
+        return false;
+    }
+
+    if (!DeserializeResults(entry->second.blob, resultsOut))
+    {
+        // Entries are validated when they are loaded, so this is not expected to happen.
+        UNREACHABLE();
+        mCurrentSize -= entry->second.blob.size();
+        mEntries.Erase(entry);
+        return false;
+    }
+    return true;
+}
+
+void TranslationCache::put(const TranslationHash &translationHash,
+                           const TranslationResults &results,
+                           bool persistent)
+{
+    Entry entry;
+    SerializeResults(results, &entry.blob);
+    entry.persistent = persistent;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    putLocked(translationHash, std::move(entry));
+}
+
+void TranslationCache::putLocked(const TranslationHash &translationHash, Entry &&entry)
+{
+    if (entry.blob.size() > mMaxSize)
+    {
+        return;
+    }
+
+    auto existing = mEntries.Peek(translationHash);
+    if (existing != mEntries.end())
+    {
+        mCurrentSize -= existing->second.blob.size();
+        mEntries.Erase(existing);
+    }
+
+    mCurrentSize += entry.blob.size();
+    mEntries.Put(translationHash, std::move(entry));
+    shrinkToSizeLocked(mMaxSize);
+}
+
+void TranslationCache::shrinkToSizeLocked(size_t limit)
+{
+    while (mCurrentSize > limit)
+    {
+        ASSERT(!mEntries.empty());
+        auto oldest = mEntries.rbegin();
+        mCurrentSize -= oldest->second.blob.size();
+        mEntries.Erase(oldest);
+    }
+}
+
+void TranslationCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mEntries.Clear();
+    mCurrentSize = 0;
+}
+
+size_t TranslationCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mCurrentSize;
+}
+
+size_t TranslationCache::entryCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mEntries.size();
+}
+
+// The file holds a header, the entries from least to most recently used, and a SHA-1 of the
+// entries that is checked before any of them is added to the cache.
+bool TranslationCache::save(const char *path) const
+{
+    std::vector<uint8_t> contents;
+    BlobWriter writer(&contents);
+    writer.writeInt(kCacheFileMagic);
+    writer.writeInt(kCacheFileVersion);
+    writer.writeInt(ANGLE_SH_VERSION);
+    size_t headerSize = contents.size();
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (auto entry = mEntries.rbegin(); entry != mEntries.rend(); ++entry)
+        {
+            if (!entry->second.persistent)
+            {
+                continue;
+            }
+            writer.writeBytes(entry->first.data(), entry->first.size());
+            writer.writeInt(entry->second.blob.size());
+            writer.writeBytes(entry->second.blob.data(), entry->second.blob.size());
+        }
+    }
+
+    TranslationHash checksum;
+    angle::base::SHA1HashBytes(contents.data() + headerSize, contents.size() - headerSize,
+                               checksum.data());
+    writer.writeBytes(checksum.data(), checksum.size());
+
+    // Write to a temporary file first and rename it over the destination, so that a process
+    // loading the cache never sees a partially written file.
+    std::string tempPath = std::string(path) + ".tmp";
+    {
+        std::ofstream file(tempPath.c_str(), std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            return false;
+        }
+        file.write(reinterpret_cast<const char *>(contents.data()), contents.size());
+        if (!file)
+        {
+            file.close();
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+
+    if (std::rename(tempPath.c_str(), path) != 0)
+    {
+        // Windows doesn't replace existing files on rename.
+        std::remove(path);
+        if (std::rename(tempPath.c_str(), path) != 0)
+        {
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TranslationCache::load(const char *path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return false;
+    }
+    std::streamoff fileSize = file.tellg();
+    if (fileSize < 0)
+    {
+        return false;
+    }
+    std::vector<uint8_t> contents(static_cast<size_t>(fileSize));
+    file.seekg(0, std::ios::beg);
+    if (!file.read(reinterpret_cast<char *>(contents.data()), contents.size()))
+    {
+        return false;
+    }
+
+    BlobReader header(contents.data(), contents.size());
+    if (header.readInt<uint32_t>() != kCacheFileMagic ||
+        header.readInt<uint32_t>() != kCacheFileVersion ||
+        header.readInt<int>() != ANGLE_SH_VERSION || header.error())
+    {
+        return false;
+    }
+    const size_t headerSize = 3 * sizeof(int64_t);
+    if (contents.size() < headerSize + kTranslationHashLength)
+    {
+        return false;
+    }
+
+    const uint8_t *entries  = contents.data() + headerSize;
+    size_t entriesSize      = contents.size() - headerSize - kTranslationHashLength;
+    TranslationHash checksum;
+    angle::base::SHA1HashBytes(entries, entriesSize, checksum.data());
+    if (memcmp(checksum.data(), entries + entriesSize, kTranslationHashLength) != 0)
+    {
+        return false;
+    }
+
+    // Parse all entries before adding any of them, so that a bad file leaves the cache as it was.
+    std::vector<std::pair<TranslationHash, Entry>> loadedEntries;
+    BlobReader reader(entries, entriesSize);
+    while (!reader.endOfBlob())
+    {
+        TranslationHash translationHash;
+        reader.readBytes(translationHash.data(), translationHash.size());
+
+        Entry entry;
+        entry.persistent = true;
+        size_t blobSize  = reader.readInt<size_t>();
+        if (!reader.hasRemaining(blobSize))
+        {
+            return false;
+        }
+        entry.blob.resize(blobSize);
+        reader.readBytes(entry.blob.data(), blobSize);
+
+        TranslationResults results;
+        if (reader.error() || !DeserializeResults(entry.blob, &results))
+        {
+            return false;
+        }
+        loadedEntries.emplace_back(translationHash, std::move(entry));
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (auto &loadedEntry : loadedEntries)
+    {
+        putLocked(loadedEntry.first, std::move(loadedEntry.second));
+    }
+    return true;
+}
+
+TranslationCache *GetTranslationCache()
+{
+    static TranslationCache *translationCache = new TranslationCache();
+    return translationCache;
+}
+
+}  // namespace sh
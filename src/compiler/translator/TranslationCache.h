@@ -0,0 +1,126 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TranslationCache.h: Process-wide cache of translation results, keyed by a hash of everything
+// that the result of a compilation depends on. Entries are kept serialized, which bounds the size
+// of the cache exactly and lets it be written to and read from a file.
+//
+
+#ifndef COMPILER_TRANSLATOR_TRANSLATIONCACHE_H_
+#define COMPILER_TRANSLATOR_TRANSLATIONCACHE_H_
+
+#include <anglebase/containers/mru_cache.h>
+
+#include <array>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "GLSLANG/ShaderLang.h"
+#include "common/angleutils.h"
+#include "compiler/translator/BaseTypes.h"
+
+namespace sh
+{
+
+// 160-bit SHA-1 hash of the compilation inputs.
+constexpr size_t kTranslationHashLength = 20;
+using TranslationHash                   = std::array<uint8_t, kTranslationHashLength>;
+
+// Large enough to hold the shaders of a few applications.
+constexpr size_t kDefaultTranslationCacheMaxSize = 4 * 1024 * 1024;
+
+// The results of a successful compilation that TCompiler exposes through the sh:: API.
+struct TranslationResults
+{
+    TranslationResults();
+    ~TranslationResults();
+
+    std::string infoLog;
+    std::string objectCode;
+    int shaderVersion;
+
+    bool variablesCollected;
+    std::vector<Attribute> attributes;
+    std::vector<OutputVariable> outputVariables;
+    std::vector<Uniform> uniforms;
+    std::vector<Varying> inputVaryings;
+    std::vector<Varying> outputVaryings;
+    std::vector<InterfaceBlock> uniformBlocks;
+    std::vector<InterfaceBlock> shaderStorageBlocks;
+    std::vector<InterfaceBlock> inBlocks;
+    std::map<std::string, std::string> nameMap;
+
+    bool computeShaderLocalSizeDeclared;
+    WorkGroupSize computeShaderLocalSize;
+    int numViews;
+
+    int geometryShaderMaxVertices;
+    int geometryShaderInvocations;
+    TLayoutPrimitiveType geometryShaderInputPrimitiveType;
+    TLayoutPrimitiveType geometryShaderOutputPrimitiveType;
+};
+
+class TranslationCache : angle::NonCopyable
+{
+  public:
+    TranslationCache();
+    ~TranslationCache();
+
+    // Evicts the least recently used entries to fit in the new size. A size of 0 disables the
+    // cache.
+    void setMaxSize(size_t maxSizeBytes);
+    bool isEnabled() const;
+
+    // Returns false if there is no entry for the hash.
+    bool get(const TranslationHash &translationHash, TranslationResults *resultsOut);
+
+    // Entries that are not persistent are kept in memory only, because their hash depends on
+    // state that is only valid in this process.
+    void put(const TranslationHash &translationHash,
+             const TranslationResults &results,
+             bool persistent);
+
+    void clear();
+
+    // Returns the total size in bytes of the serialized entries.
+    size_t size() const;
+    size_t entryCount() const;
+
+    // Writes the persistent entries to a file, or adds the entries stored in a file to the cache.
+    // Files written by a different version of the translator are rejected.
+    bool save(const char *path) const;
+    bool load(const char *path);
+
+  private:
+    struct Entry
+    {
+        std::vector<uint8_t> blob;
+        bool persistent;
+    };
+
+    struct TranslationHashHasher
+    {
+        size_t operator()(const TranslationHash &translationHash) const;
+    };
+
+    using EntryMap = angle::base::HashingMRUCache<TranslationHash, Entry, TranslationHashHasher>;
+
+    void putLocked(const TranslationHash &translationHash, Entry &&entry);
+    void shrinkToSizeLocked(size_t limit);
+
+    mutable std::mutex mMutex;
+    EntryMap mEntries;
+    size_t mMaxSize;
+    size_t mCurrentSize;
+};
+
+// Returns the cache that is shared by all compilers in the process.
+TranslationCache *GetTranslationCache();
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TRANSLATIONCACHE_H_
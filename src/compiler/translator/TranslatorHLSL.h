@@ -32,6 +32,9 @@ class TranslatorHLSL : public TCompiler
     // collectVariables needs to be run always so registers can be assigned.
     bool shouldCollectVariables(ShCompileOptions compileOptions) override { return true; }
 
+    // The register maps are not held by the translation cache.
+    bool shouldUseTranslationCache(ShCompileOptions compileOptions) override { return false; }
+
     std::map<std::string, unsigned int> mUniformBlockRegisterMap;
     std::map<std::string, unsigned int> mUniformRegisterMap;
 };
@@ -11,8 +11,8 @@
 
 #include <set>
 
+#include "compiler/translator/ASTPassManager.h"
 #include "compiler/translator/InfoSink.h"
-#include "compiler/translator/IntermTraverse.h"
 #include "compiler/translator/ParseContext.h"
 
 namespace sh
@@ -26,16 +26,21 @@ void error(const TIntermSymbol &symbol, const char *reason, TDiagnostics *diagno
     diagnostics->error(symbol.getLine(), reason, symbol.getName().data());
 }
 
-class ValidateOutputsTraverser : public TIntermTraverser
+class ValidateOutputsTraverser : public TFusablePass
 {
   public:
-    ValidateOutputsTraverser(const TExtensionBehavior &extBehavior, int maxDrawBuffers);
+    ValidateOutputsTraverser(const TExtensionBehavior &extBehavior,
+                             int maxDrawBuffers,
+                             TDiagnostics *diagnostics);
 
     void validate(TDiagnostics *diagnostics) const;
 
     void visitSymbol(TIntermSymbol *) override;
 
+    bool finish() override;
+
   private:
+    TDiagnostics *mDiagnostics;
     int mMaxDrawBuffers;
     bool mAllowUnspecifiedOutputLocationResolution;
     bool mUsesFragDepth;
@@ -48,8 +53,10 @@ class ValidateOutputsTraverser : public TIntermTraverser
 };
 
 ValidateOutputsTraverser::ValidateOutputsTraverser(const TExtensionBehavior &extBehavior,
-                                                   int maxDrawBuffers)
-    : TIntermTraverser(true, false, false),
+                                                   int maxDrawBuffers,
+                                                   TDiagnostics *diagnostics)
+    : TFusablePass(true, false, false),
+      mDiagnostics(diagnostics),
       mMaxDrawBuffers(maxDrawBuffers),
       mAllowUnspecifiedOutputLocationResolution(
           IsExtensionEnabled(extBehavior, TExtension::EXT_blend_func_extended)),
@@ -159,18 +166,20 @@ void ValidateOutputsTraverser::validate(TDiagnostics *diagnostics) const
     }
 }
 
+bool ValidateOutputsTraverser::finish()
+{
+    int numErrorsBefore = mDiagnostics->numErrors();
+    validate(mDiagnostics);
+    return (mDiagnostics->numErrors() == numErrorsBefore);
+}
+
 }  // anonymous namespace
 
-bool ValidateOutputs(TIntermBlock *root,
-                     const TExtensionBehavior &extBehavior,
-                     int maxDrawBuffers,
-                     TDiagnostics *diagnostics)
+TFusablePass *CreateValidateOutputsPass(const TExtensionBehavior &extBehavior,
+                                        int maxDrawBuffers,
+                                        TDiagnostics *diagnostics)
 {
-    ValidateOutputsTraverser validateOutputs(extBehavior, maxDrawBuffers);
-    root->traverse(&validateOutputs);
-    int numErrorsBefore = diagnostics->numErrors();
-    validateOutputs.validate(diagnostics);
-    return (diagnostics->numErrors() == numErrorsBefore);
+    return new ValidateOutputsTraverser(extBehavior, maxDrawBuffers, diagnostics);
 }
 
 }  // namespace sh
@@ -16,14 +16,13 @@
 namespace sh
 {
 
-class TIntermBlock;
 class TDiagnostics;
+class TFusablePass;
 
-// Returns true if the shader has no conflicting or otherwise erroneous fragment outputs.
-bool ValidateOutputs(TIntermBlock *root,
-                     const TExtensionBehavior &extBehavior,
-                     int maxDrawBuffers,
-                     TDiagnostics *diagnostics);
+// Creates a pass that fails if the shader has conflicting or otherwise erroneous fragment outputs.
+TFusablePass *CreateValidateOutputsPass(const TExtensionBehavior &extBehavior,
+                                        int maxDrawBuffers,
+                                        TDiagnostics *diagnostics);
 
 }  // namespace sh
 
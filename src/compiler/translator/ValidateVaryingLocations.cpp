@@ -9,8 +9,8 @@
 
 #include "ValidateVaryingLocations.h"
 
+#include "compiler/translator/ASTPassManager.h"
 #include "compiler/translator/Diagnostics.h"
-#include "compiler/translator/IntermTraverse.h"
 #include "compiler/translator/SymbolTable.h"
 #include "compiler/translator/util.h"
 
@@ -97,23 +97,27 @@ void ValidateShaderInterface(TDiagnostics *diagnostics,
     }
 }
 
-class ValidateVaryingLocationsTraverser : public TIntermTraverser
+class ValidateVaryingLocationsTraverser : public TFusablePass
 {
   public:
-    ValidateVaryingLocationsTraverser(GLenum shaderType);
+    ValidateVaryingLocationsTraverser(TDiagnostics *diagnostics, GLenum shaderType);
     void validate(TDiagnostics *diagnostics);
 
+    bool finish() override;
+
   private:
     bool visitDeclaration(Visit visit, TIntermDeclaration *node) override;
     bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override;
 
+    TDiagnostics *mDiagnostics;
     VaryingVector mInputVaryingsWithLocation;
     VaryingVector mOutputVaryingsWithLocation;
     GLenum mShaderType;
 };
 
-ValidateVaryingLocationsTraverser::ValidateVaryingLocationsTraverser(GLenum shaderType)
-    : TIntermTraverser(true, false, false), mShaderType(shaderType)
+ValidateVaryingLocationsTraverser::ValidateVaryingLocationsTraverser(TDiagnostics *diagnostics,
+                                                                     GLenum shaderType)
+    : TFusablePass(true, false, false), mDiagnostics(diagnostics), mShaderType(shaderType)
 {
 }
 
@@ -166,15 +170,18 @@ void ValidateVaryingLocationsTraverser::validate(TDiagnostics *diagnostics)
     ValidateShaderInterface(diagnostics, mOutputVaryingsWithLocation, false);
 }
 
+bool ValidateVaryingLocationsTraverser::finish()
+{
+    int numErrorsBefore = mDiagnostics->numErrors();
+    validate(mDiagnostics);
+    return (mDiagnostics->numErrors() == numErrorsBefore);
+}
+
 }  // anonymous namespace
 
-bool ValidateVaryingLocations(TIntermBlock *root, TDiagnostics *diagnostics, GLenum shaderType)
+TFusablePass *CreateValidateVaryingLocationsPass(TDiagnostics *diagnostics, GLenum shaderType)
 {
-    ValidateVaryingLocationsTraverser varyingValidator(shaderType);
-    root->traverse(&varyingValidator);
-    int numErrorsBefore = diagnostics->numErrors();
-    varyingValidator.validate(diagnostics);
-    return (diagnostics->numErrors() == numErrorsBefore);
+    return new ValidateVaryingLocationsTraverser(diagnostics, shaderType);
 }
 
 }  // namespace sh
\ No newline at end of file
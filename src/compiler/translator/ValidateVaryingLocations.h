@@ -15,10 +15,11 @@
 namespace sh
 {
 
-class TIntermBlock;
 class TDiagnostics;
+class TFusablePass;
 
-bool ValidateVaryingLocations(TIntermBlock *root, TDiagnostics *diagnostics, GLenum shaderType);
+// Creates a pass that fails if there are location conflicts between the shader varyings.
+TFusablePass *CreateValidateVaryingLocationsPass(TDiagnostics *diagnostics, GLenum shaderType);
 
 }  // namespace sh
 
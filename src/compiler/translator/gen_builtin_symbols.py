@@ -0,0 +1,652 @@
+#!/usr/bin/python
+# Copyright 2018 The ANGLE Project Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+#
+# gen_builtin_symbols.py:
+#  Generator for the compile-time initialized built-in function tables of the symbol table. The
+#  functions are looked up with a perfect hash of their mangled names, so that looking them up
+#  doesn't need any tables to be built at runtime.
+
+import re
+import sys
+
+template_symbol_table_autogen_h = """// GENERATED FILE - DO NOT EDIT.
+// Generated by {script_name} using data from {data_source_name}.
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SymbolTable_autogen.h:
+//   Compile-time initialized built-in functions of the symbol table.
+
+#ifndef COMPILER_TRANSLATOR_SYMBOLTABLE_AUTOGEN_H_
+#define COMPILER_TRANSLATOR_SYMBOLTABLE_AUTOGEN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "compiler/translator/ImmutableString.h"
+
+namespace sh
+{{
+
+class TFunction;
+
+// Some built-in functions only exist for some shader types or when an extension is enabled in
+// ShBuiltInResources. A function exists only if all of the conditions in its mask are met.
+namespace BuiltInCondition
+{{
+{conditions}
+}}  // namespace BuiltInCondition
+
+struct BuiltInFunctionEntry
+{{
+    const TFunction *function;
+    int level;
+    uint16_t conditions;
+}};
+
+struct UnmangledBuiltInEntry
+{{
+    int level;
+    uint16_t conditions;
+}};
+
+// The built-in functions have the unique ids from 1 to kLastStaticBuiltInId.
+constexpr int kLastStaticBuiltInId = {last_builtin_id};
+
+// Returns the number of built-in functions with the mangled name. Their entries are sorted from the
+// highest symbol level to the lowest.
+size_t FindBuiltInFunctions(const ImmutableString &mangledName,
+                            const BuiltInFunctionEntry **entriesOut);
+
+// Returns the number of symbol level and condition combinations that declare built-in functions
+// with the name.
+size_t FindUnmangledBuiltIns(const ImmutableString &name, const UnmangledBuiltInEntry **entriesOut);
+
+}}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_SYMBOLTABLE_AUTOGEN_H_
+"""
+
+template_symbol_table_autogen_cpp = """// GENERATED FILE - DO NOT EDIT.
+// Generated by {script_name} using data from {data_source_name}.
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SymbolTable_autogen.cpp:
+//   Compile-time initialized built-in functions of the symbol table, and the perfect hash tables
+//   used to look them up.
+
+#include "compiler/translator/SymbolTable_autogen.h"
+
+#include "compiler/translator/StaticType.h"
+#include "compiler/translator/Symbol.h"
+#include "compiler/translator/SymbolTable.h"
+
+namespace sh
+{{
+
+namespace
+{{
+
+struct HashSlot
+{{
+    ImmutableString name;
+    uint16_t firstEntry;
+    uint16_t entryCount;
+}};
+
+// Seeded FNV-1a, followed by the MurmurHash3 finalizer so that all the bits depend on the seed.
+uint32_t HashName(uint32_t seed, const ImmutableString &name)
+{{
+    uint32_t hash = 0x811c9dc5u ^ seed;
+    for (size_t index = 0; index < name.length(); ++index)
+    {{
+        hash ^= static_cast<unsigned char>(name.data()[index]);
+        hash *= 0x01000193u;
+    }}
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash;
+}}
+
+// The first level hash picks a bucket, and the seed of the bucket makes the second level hash
+// place every name of the bucket in a slot of its own.
+template <size_t bucketCount, size_t slotCount>
+const HashSlot *FindSlot(const uint32_t (&seeds)[bucketCount],
+                         const HashSlot (&slots)[slotCount],
+                         const ImmutableString &name)
+{{
+    uint32_t seed        = seeds[HashName(0, name) % bucketCount];
+    const HashSlot &slot = slots[HashName(seed, name) % slotCount];
+    return slot.name == name ? &slot : nullptr;
+}}
+
+{parameters}
+
+constexpr const TFunction kFunctions[] = {{
+{functions}}};
+
+constexpr BuiltInFunctionEntry kFunctionEntries[] = {{
+{function_entries}}};
+
+constexpr uint32_t kFunctionSeeds[] = {{
+{function_seeds}}};
+
+constexpr HashSlot kFunctionSlots[] = {{
+{function_slots}}};
+
+constexpr UnmangledBuiltInEntry kUnmangledEntries[] = {{
+{unmangled_entries}}};
+
+constexpr uint32_t kUnmangledSeeds[] = {{
+{unmangled_seeds}}};
+
+constexpr HashSlot kUnmangledSlots[] = {{
+{unmangled_slots}}};
+
+}}  // anonymous namespace
+
+size_t FindBuiltInFunctions(const ImmutableString &mangledName,
+                            const BuiltInFunctionEntry **entriesOut)
+{{
+    const HashSlot *slot = FindSlot(kFunctionSeeds, kFunctionSlots, mangledName);
+    if (slot == nullptr)
+    {{
+        return 0;
+    }}
+    *entriesOut = &kFunctionEntries[slot->firstEntry];
+    return slot->entryCount;
+}}
+
+size_t FindUnmangledBuiltIns(const ImmutableString &name, const UnmangledBuiltInEntry **entriesOut)
+{{
+    const HashSlot *slot = FindSlot(kUnmangledSeeds, kUnmangledSlots, name);
+    if (slot == nullptr)
+    {{
+        return 0;
+    }}
+    *entriesOut = &kUnmangledEntries[slot->firstEntry];
+    return slot->entryCount;
+}}
+
+}}  // namespace sh
+"""
+
+# The order of the levels matches the ESymbolLevel values.
+levels = ['COMMON_BUILTINS', 'ESSL1_BUILTINS', 'ESSL3_BUILTINS', 'ESSL3_1_BUILTINS', 'GLSL_BUILTINS']
+
+# REQUIRES conditions and the names of their BuiltInCondition bits.
+conditions = [
+    ('FRAGMENT_SHADER', 'kFragmentShader'),
+    ('VERTEX_SHADER', 'kVertexShader'),
+    ('COMPUTE_SHADER', 'kComputeShader'),
+    ('GEOMETRY_SHADER', 'kGeometryShader'),
+    ('OES_EGL_image_external', 'kOES_EGL_image_external'),
+    ('OES_EGL_image_external_essl3', 'kOES_EGL_image_external_essl3'),
+    ('EXT_YUV_target', 'kEXT_YUV_target'),
+    ('ARB_texture_rectangle', 'kARB_texture_rectangle'),
+    ('EXT_shader_texture_lod', 'kEXT_shader_texture_lod'),
+    ('OES_standard_derivatives', 'kOES_standard_derivatives'),
+]
+
+# Basic types with their TBasicType and mangled name. Vectors and matrices of float, int, uint and
+# bool are handled separately.
+basic_types = {
+    'void': ('EbtVoid', 'void'),
+    'genType': ('EbtGenType', None),
+    'genIType': ('EbtGenIType', None),
+    'genUType': ('EbtGenUType', None),
+    'genBType': ('EbtGenBType', None),
+    'vec': ('EbtVec', None),
+    'ivec': ('EbtIVec', None),
+    'uvec': ('EbtUVec', None),
+    'bvec': ('EbtBVec', None),
+    'gvec4': ('EbtGVec4', None),
+    'atomic_uint': ('EbtAtomicCounter', 'ac'),
+    'yuvCscStandardEXT': ('EbtYuvCscStandardEXT', 'ycs'),
+    'sampler2D': ('EbtSampler2D', 's2'),
+    'sampler3D': ('EbtSampler3D', 's3'),
+    'samplerCube': ('EbtSamplerCube', 'sC'),
+    'sampler2DArray': ('EbtSampler2DArray', 's2a'),
+    'samplerExternalOES': ('EbtSamplerExternalOES', 'sext'),
+    '__samplerExternal2DY2YEXT': ('EbtSamplerExternal2DY2YEXT', 'sext2y2y'),
+    'sampler2DRect': ('EbtSampler2DRect', 's2r'),
+    'sampler2DMS': ('EbtSampler2DMS', 's2ms'),
+    'isampler2D': ('EbtISampler2D', 'is2'),
+    'isampler3D': ('EbtISampler3D', 'is3'),
+    'isamplerCube': ('EbtISamplerCube', 'isC'),
+    'isampler2DArray': ('EbtISampler2DArray', 'is2a'),
+    'isampler2DMS': ('EbtISampler2DMS', 'is2ms'),
+    'usampler2D': ('EbtUSampler2D', 'us2'),
+    'usampler3D': ('EbtUSampler3D', 'us3'),
+    'usamplerCube': ('EbtUSamplerCube', 'usC'),
+    'usampler2DArray': ('EbtUSampler2DArray', 'us2a'),
+    'usampler2DMS': ('EbtUSampler2DMS', 'us2ms'),
+    'sampler2DShadow': ('EbtSampler2DShadow', 's2s'),
+    'samplerCubeShadow': ('EbtSamplerCubeShadow', 'sCs'),
+    'sampler2DArrayShadow': ('EbtSampler2DArrayShadow', 's2as'),
+    'image2D': ('EbtImage2D', 'im2'),
+    'iimage2D': ('EbtIImage2D', 'iim2'),
+    'uimage2D': ('EbtUImage2D', 'uim2'),
+    'image3D': ('EbtImage3D', 'im3'),
+    'iimage3D': ('EbtIImage3D', 'iim3'),
+    'uimage3D': ('EbtUImage3D', 'uim3'),
+    'image2DArray': ('EbtImage2DArray', 'im2a'),
+    'iimage2DArray': ('EbtIImage2DArray', 'iim2a'),
+    'uimage2DArray': ('EbtUImage2DArray', 'uim2a'),
+    'imageCube': ('EbtImageCube', 'imc'),
+    'iimageCube': ('EbtIImageCube', 'iimc'),
+    'uimageCube': ('EbtUImageCube', 'uimc'),
+}
+
+# Scalar types with their TBasicType, mangled name and vector type prefix.
+scalar_types = {
+    'float': ('EbtFloat', 'f', 'vec'),
+    'int': ('EbtInt', 'i', 'ivec'),
+    'uint': ('EbtUInt', 'u', 'uvec'),
+    'bool': ('EbtBool', 'b', 'bvec'),
+}
+
+generic_scalars = {'genType': 'float', 'genIType': 'int', 'genUType': 'uint', 'genBType': 'bool'}
+generic_vectors = {'vec': 'float', 'ivec': 'int', 'uvec': 'uint', 'bvec': 'bool'}
+generic_samplers = ['2D', '3D', 'Cube', '2DArray', '2DMS']
+generic_images = ['2D', '3D', '2DArray', 'Cube']
+
+
+class Type:
+
+    def __init__(self, name, qualifier='EvqGlobal'):
+        self.name = name
+        self.qualifier = qualifier
+
+    def with_name(self, name):
+        return Type(name, self.qualifier)
+
+    def is_generic_scalar(self):
+        return self.name in generic_scalars
+
+    def is_generic_vector(self):
+        return self.name in generic_vectors
+
+    def is_generic_sampler(self):
+        return self.name.startswith('gsampler')
+
+    def is_generic_image(self):
+        return self.name.startswith('gimage')
+
+    # Returns the TBasicType, the primary and secondary sizes and the mangled name.
+    def describe(self):
+        match = re.match(r'^(vec|ivec|uvec|bvec)([234])$', self.name)
+        if match:
+            scalar = generic_vectors[match.group(1)]
+            size = int(match.group(2))
+            return (scalar_types[scalar][0], size, 1,
+                    'v' + scalar_types[scalar][1] + str(size) + ';')
+        match = re.match(r'^mat([234])(?:x([234]))?$', self.name)
+        if match:
+            cols = int(match.group(1))
+            rows = int(match.group(2) or cols)
+            return ('EbtFloat', cols, rows, 'mf%dx%d;' % (cols, rows))
+        if self.name in scalar_types:
+            return (scalar_types[self.name][0], 1, 1, scalar_types[self.name][1] + '1;')
+        if self.name in basic_types:
+            basic_type, mangled_name = basic_types[self.name]
+            if mangled_name is None:
+                raise Exception('Type ' + self.name + ' is not expanded')
+            return (basic_type, 1, 1, mangled_name + '1;')
+        raise Exception('Unknown type ' + self.name)
+
+    def mangled_name(self):
+        return self.describe()[3]
+
+    def static_type(self):
+        basic_type, primary_size, secondary_size, _ = self.describe()
+        return 'StaticType::Get<{basic_type}, EbpUndefined, {qualifier}, {primary}, {secondary}>()'.format(
+            basic_type=basic_type,
+            qualifier=self.qualifier,
+            primary=primary_size,
+            secondary=secondary_size)
+
+
+def specific_type(type, size):
+    if not type.is_generic_scalar():
+        return type
+    scalar = generic_scalars[type.name]
+    if size == 1:
+        return type.with_name(scalar)
+    return type.with_name(scalar_types[scalar][2] + str(size))
+
+
+def vector_type(type, size):
+    if not type.is_generic_vector():
+        return type
+    # Like the vector types in the symbol table, these don't keep the qualifier.
+    return Type(type.name + str(size))
+
+
+class Function:
+
+    def __init__(self, name, return_type, parameters, op, level, conditions, extension):
+        self.name = name
+        self.return_type = return_type
+        self.parameters = parameters
+        self.op = op
+        self.level = level
+        self.conditions = conditions
+        self.extension = extension
+
+    def with_types(self, return_type, parameters):
+        return Function(self.name, return_type, parameters, self.op, self.level,
+                        self.conditions, self.extension)
+
+    def mangled_name(self):
+        return self.name + '(' + ''.join(p.mangled_name() for p in self.parameters)
+
+    def signature(self):
+        def type_string(type):
+            qualifier = {'EvqGlobal': '', 'EvqOut': 'out ', 'EvqInOut': 'inout '}[type.qualifier]
+            return qualifier + type.name
+
+        return '{return_type} {name}({parameters})'.format(
+            return_type=type_string(self.return_type),
+            name=self.name,
+            parameters=', '.join(type_string(p) for p in self.parameters))
+
+    # Expands generic types the same way on every nesting level, until only concrete types are
+    # left.
+    def expand(self):
+        parameters = self.parameters
+        if parameters and parameters[0].is_generic_sampler():
+            sampler = parameters[0].name[len('gsampler'):]
+            assert sampler in generic_samplers, parameters[0].name
+            expanded = []
+            for prefix, vec4 in [('', 'vec4'), ('i', 'ivec4'), ('u', 'uvec4')]:
+                return_type = self.return_type
+                if return_type.name == 'gvec4':
+                    return_type = return_type.with_name(vec4)
+                expanded += self.with_types(
+                    return_type,
+                    [parameters[0].with_name(prefix + 'sampler' + sampler)] + parameters[1:]).expand()
+            return expanded
+
+        if parameters and parameters[0].is_generic_image():
+            image = parameters[0].name[len('gimage'):]
+            assert image in generic_images, parameters[0].name
+            expanded = []
+            for prefix, vec4 in [('', 'vec4'), ('i', 'ivec4'), ('u', 'uvec4')]:
+                return_type = self.return_type
+                expanded_parameters = [parameters[0].with_name(prefix + 'image' + image)]
+                expanded_parameters += parameters[1:]
+                if return_type.name == 'gvec4':
+                    # imageLoad
+                    return_type = return_type.with_name(vec4)
+                elif return_type.name == 'void':
+                    # imageStore
+                    expanded_parameters[2] = expanded_parameters[2].with_name(vec4)
+                expanded += self.with_types(return_type, expanded_parameters).expand()
+            return expanded
+
+        types = [self.return_type] + parameters
+        if any(t.is_generic_scalar() for t in types):
+            return [
+                self.with_types(
+                    specific_type(self.return_type, size),
+                    [specific_type(p, size) for p in parameters]) for size in range(1, 5)
+            ]
+
+        if any(t.is_generic_vector() for t in types):
+            return [
+                self.with_types(
+                    vector_type(self.return_type, size), [vector_type(p, size) for p in parameters])
+                for size in range(2, 5)
+            ]
+
+        return [self]
+
+
+def parse_type(string):
+    chunks = string.split()
+    if len(chunks) == 2:
+        qualifier = {'out': 'EvqOut', 'inout': 'EvqInOut'}[chunks[0]]
+        return Type(chunks[1], qualifier)
+    assert len(chunks) == 1, string
+    return Type(chunks[0])
+
+
+def parse_declarations(path):
+    condition_names = [name for name, _ in conditions]
+    functions = []
+    level = None
+    required = []
+    extension = 'UNDEFINED'
+    with open(path) as declarations:
+        for line_number, line in enumerate(declarations, 1):
+            line = line.strip()
+            if not line or line.startswith('//'):
+                continue
+            words = line.split()
+            if words[0] == 'LEVEL':
+                assert len(words) == 2 and words[1] in levels, line
+                level = words[1]
+                continue
+            if words[0] == 'REQUIRES':
+                for word in words[1:]:
+                    if word not in condition_names:
+                        raise Exception('Unknown condition %s on line %d' % (word, line_number))
+                required = words[1:]
+                continue
+            if words[0] == 'EXTENSION':
+                assert len(words) <= 2, line
+                extension = words[1] if len(words) == 2 else 'UNDEFINED'
+                continue
+
+            match = re.match(r'^(\w+) (\w+)\(([\w, ]*)\)(?: : (EOp\w+))?;$', line)
+            if not match:
+                raise Exception('Invalid declaration on line %d: %s' % (line_number, line))
+            if level is None:
+                raise Exception('No LEVEL before line %d' % line_number)
+            parameters = [parse_type(p) for p in match.group(3).split(',') if p.strip()]
+            functions.append(
+                Function(
+                    name=match.group(2),
+                    return_type=parse_type(match.group(1)),
+                    parameters=parameters,
+                    op=match.group(4) or 'EOpNull',
+                    level=level,
+                    conditions=list(required),
+                    extension=extension))
+    return functions
+
+
+def hash_name(seed, name):
+    hash = (0x811c9dc5 ^ seed) & 0xffffffff
+    for char in bytearray(name.encode('ascii')):
+        hash ^= char
+        hash = (hash * 0x01000193) & 0xffffffff
+    hash ^= hash >> 16
+    hash = (hash * 0x85ebca6b) & 0xffffffff
+    hash ^= hash >> 13
+    hash = (hash * 0xc2b2ae35) & 0xffffffff
+    hash ^= hash >> 16
+    return hash
+
+
+# Builds a minimal perfect hash with the hash and displace method. Returns the seed of each bucket
+# and the key placed in each slot.
+def build_perfect_hash(keys):
+    slot_count = len(keys)
+    bucket_count = max(1, slot_count // 4)
+    buckets = [[] for _ in range(bucket_count)]
+    for key in keys:
+        buckets[hash_name(0, key) % bucket_count].append(key)
+
+    seeds = [0] * bucket_count
+    slots = [None] * slot_count
+    for bucket_index in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        bucket = buckets[bucket_index]
+        if not bucket:
+            continue
+        seed = 1
+        while True:
+            placed = [hash_name(seed, key) % slot_count for key in bucket]
+            if len(set(placed)) == len(placed) and all(slots[s] is None for s in placed):
+                break
+            seed += 1
+        seeds[bucket_index] = seed
+        for key, slot in zip(bucket, placed):
+            slots[slot] = key
+    return seeds, slots
+
+
+def wrap(first_line_prefix, items, suffix, indent, max_length=100):
+    lines = []
+    line = first_line_prefix
+    for index, item in enumerate(items):
+        text = item + (', ' if index + 1 < len(items) else suffix)
+        if len(line) + len(text.rstrip()) > max_length and line.strip():
+            lines.append(line.rstrip())
+            line = ' ' * indent
+        line += text
+    lines.append(line.rstrip())
+    return '\n'.join(lines) + '\n'
+
+
+def format_list(values, indent=4, max_length=100):
+    return wrap(' ' * indent, [str(v) for v in values], ',', indent, max_length)
+
+
+def condition_mask(required):
+    bit_names = dict(conditions)
+    if not required:
+        return '0'
+    return ' | '.join('BuiltInCondition::' + bit_names[c] for c in required)
+
+
+def parameters_name(function):
+    # The mangled names don't include the qualifiers, but the parameter types do.
+    def parameter_name(parameter):
+        qualifier = {'EvqGlobal': '', 'EvqOut': 'out_', 'EvqInOut': 'inout_'}[parameter.qualifier]
+        return qualifier + parameter.mangled_name()[:-1]
+
+    return 'kParameters_' + '_'.join(parameter_name(p) for p in function.parameters)
+
+
+def main():
+    input_script = 'builtin_function_declarations.txt'
+    functions = []
+    declared = set()
+    for declaration in parse_declarations(input_script):
+        for function in declaration.expand():
+            # Some generic declarations overlap once expanded, for example min(genType, float) and
+            # min(genType, genType) for floats. The first one wins, like it did when the functions
+            # were inserted into the symbol table at runtime.
+            key = (function.mangled_name(), function.level, tuple(function.conditions))
+            if key not in declared:
+                declared.add(key)
+                functions.append(function)
+
+    # Parameter lists are shared by the functions with the same parameter types.
+    parameter_lists = []
+    parameter_list_names = set()
+    for function in functions:
+        if not function.parameters:
+            continue
+        name = parameters_name(function)
+        if name in parameter_list_names:
+            continue
+        parameter_list_names.add(name)
+        parameter_lists.append(
+            wrap('constexpr const TConstParameter ' + name + '[] = {',
+                 ['TConstParameter(' + p.static_type() + ')' for p in function.parameters], '};', 4))
+
+    function_initializers = []
+    for index, function in enumerate(functions):
+        arguments = [
+            'TSymbolUniqueId(%d)' % (index + 1),
+            'ImmutableString("%s")' % function.name,
+            'TExtension::' + function.extension,
+            parameters_name(function) if function.parameters else 'nullptr',
+            str(len(function.parameters)),
+            function.return_type.static_type(),
+            'ImmutableString("%s")' % function.mangled_name(),
+            function.op,
+        ]
+        function_initializers.append('    // ' + function.signature() + '\n' +
+                                     wrap('    {', arguments, '},', 5))
+
+    # Entries with the same mangled name are next to each other, from the highest level down. The
+    # ones on the same level, which are available under different conditions, stay in declaration
+    # order.
+    function_indices = {}
+    for index, function in enumerate(functions):
+        function_indices.setdefault(function.mangled_name(), []).append(index)
+
+    seeds, slots = build_perfect_hash(sorted(function_indices.keys()))
+    function_entries = []
+    function_slots = []
+    for mangled_name in slots:
+        indices = sorted(
+            function_indices[mangled_name], key=lambda i: -levels.index(functions[i].level))
+        function_slots.append('    {ImmutableString("%s"), %d, %d},\n' %
+                              (mangled_name, len(function_entries), len(indices)))
+        for index in indices:
+            function_entries.append('    {&kFunctions[%d], %s, %s},\n' %
+                                    (index, functions[index].level,
+                                     condition_mask(functions[index].conditions)))
+    assert len(function_entries) < 65536
+
+    unmangled = {}
+    for function in functions:
+        key = (function.level, condition_mask(function.conditions))
+        combinations = unmangled.setdefault(function.name, [])
+        if key not in combinations:
+            combinations.append(key)
+
+    unmangled_seeds, unmangled_slot_names = build_perfect_hash(sorted(unmangled.keys()))
+    unmangled_entries = []
+    unmangled_slots = []
+    for name in unmangled_slot_names:
+        combinations = sorted(unmangled[name], key=lambda c: -levels.index(c[0]))
+        unmangled_slots.append('    {ImmutableString("%s"), %d, %d},\n' %
+                               (name, len(unmangled_entries), len(combinations)))
+        for level, mask in combinations:
+            unmangled_entries.append('    {%s, %s},\n' % (level, mask))
+
+    condition_bits = ''.join('constexpr uint16_t %s = 1u << %d;\n' % (bit_name, index)
+                             for index, (_, bit_name) in enumerate(conditions))
+
+    header = template_symbol_table_autogen_h.format(
+        script_name=sys.argv[0],
+        data_source_name=input_script,
+        conditions=condition_bits.rstrip('\n'),
+        last_builtin_id=len(functions))
+
+    source = template_symbol_table_autogen_cpp.format(
+        script_name=sys.argv[0],
+        data_source_name=input_script,
+        parameters='\n'.join(parameter_lists).rstrip('\n'),
+        functions=''.join(function_initializers),
+        function_entries=''.join(function_entries),
+        function_seeds=format_list(seeds),
+        function_slots=''.join(function_slots),
+        unmangled_entries=''.join(unmangled_entries),
+        unmangled_seeds=format_list(unmangled_seeds),
+        unmangled_slots=''.join(unmangled_slots))
+
+    with open('SymbolTable_autogen.h', 'wt') as out_file:
+        out_file.write(header)
+    with open('SymbolTable_autogen.cpp', 'wt') as out_file:
+        out_file.write(source)
+
+
+if __name__ == '__main__':
+    main()
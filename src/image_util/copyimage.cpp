@@ -8,15 +8,81 @@
 
 #include "image_util/copyimage.h"
 
+#include "common/mathutil.h"
+
+namespace
+{
+
+inline uint32_t SwapRedBlue(uint32_t argb)
+{
+    return (argb & 0xFF00FF00) |        // Keep alpha and green
+           (argb & 0x00FF0000) >> 16 |  // Move red to blue
+           (argb & 0x000000FF) << 16;   // Move blue to red
+}
+
+// Swaps the red and blue channels of a row of 8-bit four channel pixels, optionally forcing alpha
+// to opaque. The swap is its own inverse, so it serves both BGRA->RGBA and RGBA->BGRA.
+void SwapRedBlueRow(const uint8_t *source, uint8_t *dest, size_t pixelCount, uint32_t alphaMask)
+{
+    size_t x = 0;
+
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        const __m128i brMask    = _mm_set1_epi32(0x00ff00ff);
+        const __m128i alphaBits = _mm_set1_epi32(static_cast<int>(alphaMask));
+
+        for (; x + 3 < pixelCount; x += 4)
+        {
+            __m128i sourceData = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source) + x / 4);
+            // Mask out g and a, which don't change
+            __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
+            // Mask out b and r
+            __m128i brComponents = _mm_and_si128(sourceData, brMask);
+            // Swap b and r
+            __m128i brSwapped = _mm_shufflehi_epi16(
+                _mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)),
+                _MM_SHUFFLE(2, 3, 0, 1));
+            __m128i result = _mm_or_si128(_mm_or_si128(gaComponents, brSwapped), alphaBits);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest) + x / 4, result);
+        }
+    }
+#endif
+
+    for (; x < pixelCount; x++)
+    {
+        uint32_t pixel;
+        memcpy(&pixel, source + x * 4, sizeof(pixel));
+        pixel = SwapRedBlue(pixel) | alphaMask;
+        memcpy(dest + x * 4, &pixel, sizeof(pixel));
+    }
+}
+
+}  // anonymous namespace
+
 namespace angle
 {
 
-void CopyBGRA8ToRGBA8(const uint8_t *source, uint8_t *dest)
+void CopyBGRA8ToRGBA8(const uint8_t *source, uint8_t *dest, size_t pixelCount)
+{
+    SwapRedBlueRow(source, dest, pixelCount, 0);
+}
+
+void CopyRGBA8ToBGRA8(const uint8_t *source, uint8_t *dest, size_t pixelCount)
+{
+    SwapRedBlueRow(source, dest, pixelCount, 0);
+}
+
+void CopyBGRX8ToRGBA8(const uint8_t *source, uint8_t *dest, size_t pixelCount)
+{
+    SwapRedBlueRow(source, dest, pixelCount, 0xFF000000);
+}
+
+void CopyRGBA16FToRGBA32F(const uint8_t *source, uint8_t *dest, size_t pixelCount)
 {
-    uint32_t argb                       = *reinterpret_cast<const uint32_t *>(source);
-    *reinterpret_cast<uint32_t *>(dest) = (argb & 0xFF00FF00) |        // Keep alpha and green
-                                          (argb & 0x00FF0000) >> 16 |  // Move red to blue
-                                          (argb & 0x000000FF) << 16;   // Move blue to red
+    const uint16_t *source16 = reinterpret_cast<const uint16_t *>(source);
+    float *dest32            = reinterpret_cast<float *>(dest);
+    gl::convertFloat16ToFloat32(source16, dest32, pixelCount * 4);
 }
 
 }  // namespace angle
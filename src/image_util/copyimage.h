@@ -13,6 +13,7 @@
 
 #include "image_util/imageformats.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace angle
@@ -27,7 +28,12 @@ void WriteColor(const uint8_t *source, uint8_t *dest);
 template <typename sourceType, typename destType, typename colorDataType>
 void CopyPixel(const uint8_t *source, uint8_t *dest);
 
-void CopyBGRA8ToRGBA8(const uint8_t *source, uint8_t *dest);
+// Row conversion functions used by the fast copy paths of PackPixels. Each converts pixelCount
+// consecutive pixels from source to dest.
+void CopyBGRA8ToRGBA8(const uint8_t *source, uint8_t *dest, size_t pixelCount);
+void CopyRGBA8ToBGRA8(const uint8_t *source, uint8_t *dest, size_t pixelCount);
+void CopyBGRX8ToRGBA8(const uint8_t *source, uint8_t *dest, size_t pixelCount);
+void CopyRGBA16FToRGBA32F(const uint8_t *source, uint8_t *dest, size_t pixelCount);
 
 }  // namespace angle
 
@@ -0,0 +1,205 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemip.cpp: Defines the vectorized box filters used by GenerateMip for the common 8-bit
+// and 16-bit float formats.
+
+#include "image_util/generatemip.h"
+
+#include "common/mathutil.h"
+#include "common/platform.h"
+
+#if defined(ANGLE_USE_SSE)
+#include <emmintrin.h>
+#endif
+
+namespace angle
+{
+
+namespace priv
+{
+
+namespace
+{
+
+#if defined(ANGLE_USE_SSE)
+
+// Averages unsigned bytes rounding down, like gl::average, where _mm_avg_epu8 rounds up.
+inline __m128i AverageUnorm8(__m128i a, __m128i b)
+{
+    const __m128i one = _mm_set1_epi8(1);
+    return _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+}
+
+// Packs the low 16 bits of the lanes of a and b, which _mm_packs_epi32 would saturate.
+inline __m128i PackLow16(__m128i a, __m128i b)
+{
+    a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+    b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+    return _mm_packs_epi32(a, b);
+}
+
+// Averages eight half floats like gl::averageHalfFloat.
+inline __m128i AverageHalfFloat(__m128i a, __m128i b)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 half  = _mm_set1_ps(0.5f);
+
+    __m128 low  = _mm_mul_ps(_mm_add_ps(gl::float16ToFloat32SSE2(_mm_unpacklo_epi16(a, zero)),
+                                       gl::float16ToFloat32SSE2(_mm_unpacklo_epi16(b, zero))),
+                            half);
+    __m128 high = _mm_mul_ps(_mm_add_ps(gl::float16ToFloat32SSE2(_mm_unpackhi_epi16(a, zero)),
+                                        gl::float16ToFloat32SSE2(_mm_unpackhi_epi16(b, zero))),
+                             half);
+    return PackLow16(gl::float32ToFloat16SSE2(low), gl::float32ToFloat16SSE2(high));
+}
+
+struct Unorm8Average
+{
+    static __m128i average(__m128i a, __m128i b) { return AverageUnorm8(a, b); }
+};
+
+struct HalfFloatAverage
+{
+    static __m128i average(__m128i a, __m128i b) { return AverageHalfFloat(a, b); }
+};
+
+// Splits the pixels of a and b, which are consecutive in a row, into the even and odd ones.
+template <size_t PixelBytes>
+inline void DeinterleavePixels(__m128i a, __m128i b, __m128i *even, __m128i *odd);
+
+template <>
+inline void DeinterleavePixels<1>(__m128i a, __m128i b, __m128i *even, __m128i *odd)
+{
+    const __m128i lowByteMask = _mm_set1_epi16(0x00FF);
+    *even = _mm_packus_epi16(_mm_and_si128(a, lowByteMask), _mm_and_si128(b, lowByteMask));
+    *odd  = _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+}
+
+template <>
+inline void DeinterleavePixels<2>(__m128i a, __m128i b, __m128i *even, __m128i *odd)
+{
+    *even = PackLow16(a, b);
+    *odd  = PackLow16(_mm_srli_epi32(a, 16), _mm_srli_epi32(b, 16));
+}
+
+template <>
+inline void DeinterleavePixels<4>(__m128i a, __m128i b, __m128i *even, __m128i *odd)
+{
+    __m128 aFloats = _mm_castsi128_ps(a);
+    __m128 bFloats = _mm_castsi128_ps(b);
+    *even = _mm_castps_si128(_mm_shuffle_ps(aFloats, bFloats, _MM_SHUFFLE(2, 0, 2, 0)));
+    *odd  = _mm_castps_si128(_mm_shuffle_ps(aFloats, bFloats, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+template <>
+inline void DeinterleavePixels<8>(__m128i a, __m128i b, __m128i *even, __m128i *odd)
+{
+    *even = _mm_unpacklo_epi64(a, b);
+    *odd  = _mm_unpackhi_epi64(a, b);
+}
+
+inline __m128i LoadRow(const uint8_t *row, size_t offset)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + offset));
+}
+
+// Averages the 2x2 (or 2x2x2) boxes in the same order as GenerateMip_XY and GenerateMip_XYZ: the
+// slices first, then the rows, and then the columns. Each step rounds to the format, so the
+// results are the same as with T::average.
+template <typename Average, size_t PixelBytes>
+size_t BoxFilterRowsSSE2(const uint8_t *const sourceRows[4],
+                         bool filterSlices,
+                         size_t destWidth,
+                         uint8_t *destRow)
+{
+    constexpr size_t kDestPixelsPerVector = 16 / PixelBytes;
+    const size_t destPixels               = destWidth - destWidth % kDestPixelsPerVector;
+
+    for (size_t x = 0; x < destPixels; x += kDestPixelsPerVector)
+    {
+        const size_t sourceOffset = x * 2 * PixelBytes;
+
+        __m128i columns[2];
+        for (size_t half = 0; half < 2; half++)
+        {
+            const size_t offset = sourceOffset + half * 16;
+
+            __m128i top    = LoadRow(sourceRows[0], offset);
+            __m128i bottom = LoadRow(sourceRows[1], offset);
+            if (filterSlices)
+            {
+                top    = Average::average(top, LoadRow(sourceRows[2], offset));
+                bottom = Average::average(bottom, LoadRow(sourceRows[3], offset));
+            }
+            columns[half] = Average::average(top, bottom);
+        }
+
+        __m128i even, odd;
+        DeinterleavePixels<PixelBytes>(columns[0], columns[1], &even, &odd);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destRow + x * PixelBytes),
+                         Average::average(even, odd));
+    }
+
+    return destPixels;
+}
+
+template <typename Average>
+size_t BoxFilterRowsSSE2(size_t pixelBytes,
+                         const uint8_t *const sourceRows[4],
+                         bool filterSlices,
+                         size_t destWidth,
+                         uint8_t *destRow)
+{
+    switch (pixelBytes)
+    {
+        case 1:
+            return BoxFilterRowsSSE2<Average, 1>(sourceRows, filterSlices, destWidth, destRow);
+        case 2:
+            return BoxFilterRowsSSE2<Average, 2>(sourceRows, filterSlices, destWidth, destRow);
+        case 4:
+            return BoxFilterRowsSSE2<Average, 4>(sourceRows, filterSlices, destWidth, destRow);
+        case 8:
+            return BoxFilterRowsSSE2<Average, 8>(sourceRows, filterSlices, destWidth, destRow);
+        default:
+            return 0;
+    }
+}
+
+#endif  // defined(ANGLE_USE_SSE)
+
+}  // anonymous namespace
+
+size_t BoxFilterRows(MipBoxFilter filter,
+                     size_t pixelBytes,
+                     const uint8_t *const sourceRows[4],
+                     bool filterSlices,
+                     size_t destWidth,
+                     uint8_t *destRow)
+{
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        switch (filter)
+        {
+            case MipBoxFilter::Unorm8:
+                return BoxFilterRowsSSE2<Unorm8Average>(pixelBytes, sourceRows, filterSlices,
+                                                        destWidth, destRow);
+            case MipBoxFilter::HalfFloat:
+                return BoxFilterRowsSSE2<HalfFloatAverage>(pixelBytes, sourceRows, filterSlices,
+                                                           destWidth, destRow);
+            default:
+                break;
+        }
+    }
+#endif  // defined(ANGLE_USE_SSE)
+
+    return 0;
+}
+
+}  // namespace priv
+
+}  // namespace angle
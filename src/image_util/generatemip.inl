@@ -10,6 +10,7 @@
 #include "common/mathutil.h"
 
 #include "image_util/imageformats.h"
+#include "image_util/parallelrows.h"
 
 namespace angle
 {
@@ -17,6 +18,70 @@ namespace angle
 namespace priv
 {
 
+// Formats whose averages are box filtered several pixels at a time. The 8-bit formats average each
+// byte rounding down, and the 16-bit float formats average each channel with
+// gl::averageHalfFloat, whatever the order of their channels.
+enum class MipBoxFilter
+{
+    Scalar,
+    Unorm8,
+    HalfFloat,
+};
+
+template <typename T>
+struct MipBoxFilterTraits
+{
+    static constexpr MipBoxFilter kFilter = MipBoxFilter::Scalar;
+};
+
+#define ANGLE_MIP_BOX_FILTER(T, FILTER)                               \
+    template <>                                                       \
+    struct MipBoxFilterTraits<T>                                      \
+    {                                                                 \
+        static constexpr MipBoxFilter kFilter = MipBoxFilter::FILTER; \
+    }
+
+ANGLE_MIP_BOX_FILTER(A8, Unorm8);
+ANGLE_MIP_BOX_FILTER(L8, Unorm8);
+ANGLE_MIP_BOX_FILTER(R8, Unorm8);
+ANGLE_MIP_BOX_FILTER(L8A8, Unorm8);
+ANGLE_MIP_BOX_FILTER(R8G8, Unorm8);
+ANGLE_MIP_BOX_FILTER(R8G8B8A8, Unorm8);
+ANGLE_MIP_BOX_FILTER(B8G8R8A8, Unorm8);
+ANGLE_MIP_BOX_FILTER(A16F, HalfFloat);
+ANGLE_MIP_BOX_FILTER(L16F, HalfFloat);
+ANGLE_MIP_BOX_FILTER(R16F, HalfFloat);
+ANGLE_MIP_BOX_FILTER(L16A16F, HalfFloat);
+ANGLE_MIP_BOX_FILTER(R16G16F, HalfFloat);
+ANGLE_MIP_BOX_FILTER(R16G16B16A16F, HalfFloat);
+
+#undef ANGLE_MIP_BOX_FILTER
+
+// Box filters the start of a row of a mip level from two rows of the source level, or from two
+// rows in each of two slices when filterSlices is set, with the same results as T::average.
+// Returns the number of pixels it filtered, which may be fewer than destWidth, or none when the
+// CPU doesn't support the vectorized filters.
+size_t BoxFilterRows(MipBoxFilter filter,
+                     size_t pixelBytes,
+                     const uint8_t *const sourceRows[4],
+                     bool filterSlices,
+                     size_t destWidth,
+                     uint8_t *destRow);
+
+template <typename T>
+inline size_t BoxFilterRows(const uint8_t *const sourceRows[4],
+                            bool filterSlices,
+                            size_t destWidth,
+                            uint8_t *destRow)
+{
+    constexpr MipBoxFilter kFilter = MipBoxFilterTraits<T>::kFilter;
+    if (kFilter == MipBoxFilter::Scalar)
+    {
+        return 0;
+    }
+    return BoxFilterRows(kFilter, sizeof(T), sourceRows, filterSlices, destWidth, destRow);
+}
+
 template <typename T>
 static inline T *GetPixel(uint8_t *data, size_t x, size_t y, size_t z, size_t rowPitch, size_t depthPitch)
 {
@@ -101,7 +166,13 @@ static void GenerateMip_XY(size_t sourceWidth, size_t sourceHeight, size_t sourc
 
     for (size_t y = 0; y < destHeight; y++)
     {
-        for (size_t x = 0; x < destWidth; x++)
+        const uint8_t *sourceRows[4] = {
+            sourceData + y * 2 * sourceRowPitch, sourceData + (y * 2 + 1) * sourceRowPitch, nullptr,
+            nullptr};
+        size_t filteredWidth =
+            BoxFilterRows<T>(sourceRows, false, destWidth, destData + y * destRowPitch);
+
+        for (size_t x = filteredWidth; x < destWidth; x++)
         {
             const T *src0 = GetPixel<T>(sourceData, x * 2, y * 2, 0, sourceRowPitch, sourceDepthPitch);
             const T *src1 = GetPixel<T>(sourceData, x * 2, y * 2 + 1, 0, sourceRowPitch, sourceDepthPitch);
@@ -190,7 +261,15 @@ static void GenerateMip_XYZ(size_t sourceWidth, size_t sourceHeight, size_t sour
     {
         for (size_t y = 0; y < destHeight; y++)
         {
-            for (size_t x = 0; x < destWidth; x++)
+            const uint8_t *sourceSlice0  = sourceData + z * 2 * sourceDepthPitch;
+            const uint8_t *sourceSlice1  = sourceSlice0 + sourceDepthPitch;
+            const uint8_t *sourceRows[4] = {
+                sourceSlice0 + y * 2 * sourceRowPitch, sourceSlice0 + (y * 2 + 1) * sourceRowPitch,
+                sourceSlice1 + y * 2 * sourceRowPitch, sourceSlice1 + (y * 2 + 1) * sourceRowPitch};
+            size_t filteredWidth = BoxFilterRows<T>(
+                sourceRows, true, destWidth, destData + z * destDepthPitch + y * destRowPitch);
+
+            for (size_t x = filteredWidth; x < destWidth; x++)
             {
                 const T *src0 = GetPixel<T>(sourceData, x * 2, y * 2, z * 2, sourceRowPitch, sourceDepthPitch);
                 const T *src1 = GetPixel<T>(sourceData, x * 2, y * 2, z * 2 + 1, sourceRowPitch, sourceDepthPitch);
@@ -219,6 +298,10 @@ static void GenerateMip_XYZ(size_t sourceWidth, size_t sourceHeight, size_t sour
 }
 
 
+// Levels with fewer pixels than this per thread are generated on fewer threads, since handing rows
+// to a worker thread takes longer than generating that many pixels.
+constexpr size_t kMinMipPixelsPerThread = 64 * 1024;
+
 typedef void (*MipGenerationFunction)(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
                                       const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
                                       size_t destWidth, size_t destHeight, size_t destDepth,
@@ -261,8 +344,38 @@ inline void GenerateMip(size_t sourceWidth, size_t sourceHeight, size_t sourceDe
     priv::MipGenerationFunction generationFunction = priv::GetMipGenerationFunction<T>(sourceWidth, sourceHeight, sourceDepth);
     ASSERT(generationFunction != nullptr);
 
-    generationFunction(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch, sourceDepthPitch,
-                       mipWidth, mipHeight, mipDepth, destData, destRowPitch, destDepthPitch);
+    // Large levels are split into ranges of slices, or of rows for 2D levels, that are generated
+    // on several threads at once. Each range is generated like a smaller level. Levels too small
+    // to give two threads their minimum share are generated directly.
+    bool splitLevel = mipWidth * mipHeight * mipDepth >= 2 * priv::kMinMipPixelsPerThread;
+    if (splitLevel && mipDepth > 1)
+    {
+        ProcessRowsInParallel(
+            mipDepth, mipWidth * mipHeight, priv::kMinMipPixelsPerThread,
+            [&](size_t zBegin, size_t zEnd) {
+                generationFunction(sourceWidth, sourceHeight, (zEnd - zBegin) * 2,
+                                   sourceData + zBegin * 2 * sourceDepthPitch, sourceRowPitch,
+                                   sourceDepthPitch, mipWidth, mipHeight, zEnd - zBegin,
+                                   destData + zBegin * destDepthPitch, destRowPitch,
+                                   destDepthPitch);
+            });
+    }
+    else if (splitLevel && mipHeight > 1)
+    {
+        ProcessRowsInParallel(
+            mipHeight, mipWidth, priv::kMinMipPixelsPerThread, [&](size_t yBegin, size_t yEnd) {
+                generationFunction(sourceWidth, (yEnd - yBegin) * 2, sourceDepth,
+                                   sourceData + yBegin * 2 * sourceRowPitch, sourceRowPitch,
+                                   sourceDepthPitch, mipWidth, yEnd - yBegin, mipDepth,
+                                   destData + yBegin * destRowPitch, destRowPitch, destDepthPitch);
+            });
+    }
+    else
+    {
+        generationFunction(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                           sourceDepthPitch, mipWidth, mipHeight, mipDepth, destData, destRowPitch,
+                           destDepthPitch);
+    }
 }
 
 }  // namespace angle
@@ -1256,11 +1256,18 @@ void LoadRGB32FToRGBA16F(size_t width,
                 priv::OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+
+            // Convert the row into the start of the destination row, and then spread it out from
+            // the end, so that no pixel is overwritten before it is moved.
+            gl::convertFloat32ToFloat16(source, dest, width * 3);
+            for (size_t x = width; x-- > 0;)
             {
-                dest[x * 4 + 0] = gl::float32ToFloat16(source[x * 3 + 0]);
-                dest[x * 4 + 1] = gl::float32ToFloat16(source[x * 3 + 1]);
-                dest[x * 4 + 2] = gl::float32ToFloat16(source[x * 3 + 2]);
+                uint16_t red    = dest[x * 3 + 0];
+                uint16_t green  = dest[x * 3 + 1];
+                uint16_t blue   = dest[x * 3 + 2];
+                dest[x * 4 + 0] = red;
+                dest[x * 4 + 1] = green;
+                dest[x * 4 + 2] = blue;
                 dest[x * 4 + 3] = gl::Float16One;
             }
         }
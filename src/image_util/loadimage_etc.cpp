@@ -8,9 +8,12 @@
 
 #include "image_util/loadimage.h"
 
+#include <algorithm>
+
 #include "common/mathutil.h"
 
 #include "image_util/imageformats.h"
+#include "image_util/parallelrows.h"
 
 namespace angle
 {
@@ -49,6 +52,30 @@ static IntensityModifier intensityModifierNonOpaque[] =
 };
 // clang-format on
 
+// Intensity modifiers for single channel blocks, used by EAC and by the alpha of ETC2. The rows
+// are 16-bit so that a row fits in a single SSE register.
+// clang-format off
+static const int16_t kSingleChannelModifierTable[16][8] =
+{
+    { -3, -6,  -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5,  -8, -13, 1, 4, 7, 12 },
+    { -2, -4,  -6, -13, 1, 3, 5, 12 },
+    { -3, -6,  -8, -12, 2, 5, 7, 11 },
+    { -3, -7,  -9, -11, 2, 6, 8, 10 },
+    { -4, -7,  -8, -11, 3, 6, 7, 10 },
+    { -3, -5,  -8, -11, 2, 4, 7, 10 },
+    { -2, -6,  -8, -10, 1, 5, 7,  9 },
+    { -2, -5,  -8, -10, 1, 4, 7,  9 },
+    { -2, -4,  -8, -10, 1, 3, 7,  9 },
+    { -2, -5,  -7, -10, 1, 4, 6,  9 },
+    { -3, -4,  -7, -10, 2, 3, 6,  9 },
+    { -1, -2,  -3, -10, 0, 1, 2,  9 },
+    { -4, -6,  -8,  -9, 3, 5, 7,  8 },
+    { -3, -5,  -7,  -9, 2, 4, 6,  8 }
+};
+// clang-format on
+
 static const int kNumPixelsInBlock = 16;
 
 struct ETC2Block
@@ -63,20 +90,16 @@ struct ETC2Block
                                    size_t destRowPitch,
                                    bool isSigned) const
     {
+        uint8_t values[8];
+        getSingleETC2ChannelValues(isSigned, values);
+
+        uint64_t indexBits = getSingleChannelIndexBits();
         for (size_t j = 0; j < 4 && (y + j) < h; j++)
         {
             uint8_t *row = dest + (j * destRowPitch);
             for (size_t i = 0; i < 4 && (x + i) < w; i++)
             {
-                uint8_t *pixel = row + (i * destPixelStride);
-                if (isSigned)
-                {
-                    *pixel = clampSByte(getSingleETC2Channel(i, j, isSigned));
-                }
-                else
-                {
-                    *pixel = clampByte(getSingleETC2Channel(i, j, isSigned));
-                }
+                row[i * destPixelStride] = values[getSingleChannelIndex(indexBits, i, j)];
             }
         }
     }
@@ -91,21 +114,17 @@ struct ETC2Block
                                   size_t destRowPitch,
                                   bool isSigned) const
     {
+        uint16_t values[8];
+        getSingleEACChannelValues(isSigned, values);
+
+        uint64_t indexBits = getSingleChannelIndexBits();
         for (size_t j = 0; j < 4 && (y + j) < h; j++)
         {
             uint16_t *row = reinterpret_cast<uint16_t *>(reinterpret_cast<uint8_t *>(dest) +
                                                          (j * destRowPitch));
             for (size_t i = 0; i < 4 && (x + i) < w; i++)
             {
-                uint16_t *pixel = row + (i * destPixelStride);
-                if (isSigned)
-                {
-                    *pixel = renormalizeSignedEAC(getSingleEACChannel(i, j, isSigned));
-                }
-                else
-                {
-                    *pixel = renormalizeUnsignedEAC(getSingleEACChannel(i, j, isSigned));
-                }
+                row[i * destPixelStride] = values[getSingleChannelIndex(indexBits, i, j)];
             }
         }
     }
@@ -199,6 +218,49 @@ struct ETC2Block
         }
     }
 
+    // Transcodes the alpha block of ETC2 RGBA8 to BC4, which is also the alpha block of BC3
+    void transcodeAlphaAsBC4(uint8_t *dest, size_t x, size_t y, size_t w, size_t h) const
+    {
+        uint8_t values[8];
+        getSingleETC2ChannelValues(false, values);
+
+        int bc4Values[8];
+        for (size_t index = 0; index < 8; index++)
+        {
+            bc4Values[index] = values[index];
+        }
+        packBC4(dest, bc4Values, x, y, w, h);
+    }
+
+    // Transcodes single channel EAC block to BC4. BC4 has 8-bit endpoints, so this loses the
+    // precision beyond 8 bits of the 11-bit EAC values.
+    void transcodeAsBC4(uint8_t *dest,
+                        size_t x,
+                        size_t y,
+                        size_t w,
+                        size_t h,
+                        bool isSigned) const
+    {
+        uint16_t values[8];
+        getSingleEACChannelValues(isSigned, values);
+
+        int bc4Values[8];
+        for (size_t index = 0; index < 8; index++)
+        {
+            if (isSigned)
+            {
+                int value        = static_cast<int16_t>(values[index]);
+                int magnitude    = (std::abs(value) * 127 + 16383) / 32767;
+                bc4Values[index] = value < 0 ? -magnitude : magnitude;
+            }
+            else
+            {
+                bc4Values[index] = (values[index] * 255 + 32767) / 65535;
+            }
+        }
+        packBC4(dest, bc4Values, x, y, w, h);
+    }
+
   private:
     union {
         // Individual, differential, H and T modes
@@ -430,6 +492,41 @@ struct ETC2Block
                                             alphaValues, nonOpaquePunchThroughAlpha);
     }
 
+    // Adds each of the intensity modifiers of a subblock to its base color.
+    static void computeSubblockColors(int r,
+                                      int g,
+                                      int b,
+                                      const IntensityModifier &modifiers,
+                                      R8G8B8A8 colors[4])
+    {
+#if defined(ANGLE_USE_SSE)
+        if (gl::supportsSSE2())
+        {
+            // Packing with unsigned saturation clamps the channels to [0, 255].
+            __m128i baseColor = _mm_setr_epi16(static_cast<short>(r), static_cast<short>(g),
+                                               static_cast<short>(b), 255, static_cast<short>(r),
+                                               static_cast<short>(g), static_cast<short>(b), 255);
+            short m0 = static_cast<short>(modifiers[0]);
+            short m1 = static_cast<short>(modifiers[1]);
+            short m2 = static_cast<short>(modifiers[2]);
+            short m3 = static_cast<short>(modifiers[3]);
+            __m128i colors01 =
+                _mm_add_epi16(baseColor, _mm_setr_epi16(m0, m0, m0, 0, m1, m1, m1, 0));
+            __m128i colors23 =
+                _mm_add_epi16(baseColor, _mm_setr_epi16(m2, m2, m2, 0, m3, m3, m3, 0));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(colors),
+                             _mm_packus_epi16(colors01, colors23));
+            return;
+        }
+#endif
+
+        for (size_t modifierIdx = 0; modifierIdx < 4; modifierIdx++)
+        {
+            const int modifier  = modifiers[modifierIdx];
+            colors[modifierIdx] = createRGBA(r + modifier, g + modifier, b + modifier);
+        }
+    }
+
     void decodeIndividualOrDifferentialBlock(uint8_t *dest,
                                              size_t x,
                                              size_t y,
@@ -450,14 +547,8 @@ struct ETC2Block
 
         R8G8B8A8 subblockColors0[4];
         R8G8B8A8 subblockColors1[4];
-        for (size_t modifierIdx = 0; modifierIdx < 4; modifierIdx++)
-        {
-            const int i1                 = intensityModifier[u.idht.mode.idm.cw1][modifierIdx];
-            subblockColors0[modifierIdx] = createRGBA(r1 + i1, g1 + i1, b1 + i1);
-
-            const int i2                 = intensityModifier[u.idht.mode.idm.cw2][modifierIdx];
-            subblockColors1[modifierIdx] = createRGBA(r2 + i2, g2 + i2, b2 + i2);
-        }
+        computeSubblockColors(r1, g1, b1, intensityModifier[u.idht.mode.idm.cw1], subblockColors0);
+        computeSubblockColors(r2, g2, b2, intensityModifier[u.idht.mode.idm.cw2], subblockColors1);
 
         if (u.idht.mode.idm.flipbit)
         {
@@ -1300,72 +1391,152 @@ struct ETC2Block
     }
 
     // Single channel utility functions
-    int getSingleEACChannel(size_t x, size_t y, bool isSigned) const
+
+    // The eight values that the pixels of a single channel block select from only depend on the
+    // block, so they are computed once per block rather than once per pixel.
+    void getSingleEACChannelValues(bool isSigned, uint16_t values[8]) const
     {
         int codeword   = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
         int multiplier = (u.scblk.multiplier == 0) ? 1 : u.scblk.multiplier * 8;
-        return codeword * 8 + 4 + getSingleChannelModifier(x, y) * multiplier;
+        const int16_t *modifiers = kSingleChannelModifierTable[u.scblk.table_index];
+
+#if defined(ANGLE_USE_SSE)
+        if (gl::supportsSSE2())
+        {
+            // The values are at most 11 bits wide before they are scaled to 16 bits.
+            __m128i modifiersWide = _mm_loadu_si128(reinterpret_cast<const __m128i *>(modifiers));
+            __m128i valuesWide    = _mm_add_epi16(
+                _mm_set1_epi16(static_cast<short>(codeword * 8 + 4)),
+                _mm_mullo_epi16(modifiersWide, _mm_set1_epi16(static_cast<short>(multiplier))));
+            valuesWide = isSigned ? _mm_max_epi16(valuesWide, _mm_set1_epi16(-1023))
+                                  : _mm_max_epi16(valuesWide, _mm_setzero_si128());
+            valuesWide = _mm_min_epi16(valuesWide, _mm_set1_epi16(isSigned ? 1023 : 2047));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(values), _mm_slli_epi16(valuesWide, 5));
+            return;
+        }
+#endif
+
+        for (size_t index = 0; index < 8; index++)
+        {
+            int value = codeword * 8 + 4 + modifiers[index] * multiplier;
+            values[index] =
+                isSigned ? renormalizeSignedEAC(value) : renormalizeUnsignedEAC(value);
+        }
     }
 
-    int getSingleETC2Channel(size_t x, size_t y, bool isSigned) const
+    void getSingleETC2ChannelValues(bool isSigned, uint8_t values[8]) const
     {
-        int codeword = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
-        return codeword + getSingleChannelModifier(x, y) * u.scblk.multiplier;
+        int codeword             = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
+        int multiplier           = u.scblk.multiplier;
+        const int16_t *modifiers = kSingleChannelModifierTable[u.scblk.table_index];
+
+#if defined(ANGLE_USE_SSE)
+        if (gl::supportsSSE2())
+        {
+            // Packing with saturation clamps the values to the range of the output.
+            __m128i modifiersWide = _mm_loadu_si128(reinterpret_cast<const __m128i *>(modifiers));
+            __m128i valuesWide =
+                _mm_add_epi16(_mm_set1_epi16(static_cast<short>(codeword)),
+                              _mm_mullo_epi16(modifiersWide,
+                                              _mm_set1_epi16(static_cast<short>(multiplier))));
+            valuesWide = isSigned ? _mm_packs_epi16(valuesWide, valuesWide)
+                                  : _mm_packus_epi16(valuesWide, valuesWide);
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(values), valuesWide);
+            return;
+        }
+#endif
+
+        for (size_t index = 0; index < 8; index++)
+        {
+            int value     = codeword + modifiers[index] * multiplier;
+            values[index] = isSigned ? static_cast<uint8_t>(clampSByte(value)) : clampByte(value);
+        }
     }
 
-    int getSingleChannelIndex(size_t x, size_t y) const
+    // Encodes the values of the pixels of a single channel block as a BC4 block. The smallest and
+    // largest of the values that the pixels in the image select are the endpoints, and each value
+    // is mapped to the closest of the values that BC4 interpolates between them.
+    void packBC4(uint8_t *dest,
+                 const int values[8],
+                 size_t x,
+                 size_t y,
+                 size_t w,
+                 size_t h) const
     {
-        ASSERT(x < 4 && y < 4);
+        uint64_t indexBits = getSingleChannelIndexBits();
 
-        // clang-format off
-        switch (x * 4 + y)
-        {
-            case 0: return u.scblk.ma;
-            case 1: return u.scblk.mb;
-            case 2: return u.scblk.mc1 << 1 | u.scblk.mc2;
-            case 3: return u.scblk.md;
-            case 4: return u.scblk.me;
-            case 5: return u.scblk.mf1 << 2 | u.scblk.mf2;
-            case 6: return u.scblk.mg;
-            case 7: return u.scblk.mh;
-            case 8: return u.scblk.mi;
-            case 9: return u.scblk.mj;
-            case 10: return u.scblk.mk1 << 1 | u.scblk.mk2;
-            case 11: return u.scblk.ml;
-            case 12: return u.scblk.mm;
-            case 13: return u.scblk.mn1 << 2 | u.scblk.mn2;
-            case 14: return u.scblk.mo;
-            case 15: return u.scblk.mp;
-            default: UNREACHABLE(); return 0;
+        int minValue = values[getSingleChannelIndex(indexBits, 0, 0)];
+        int maxValue = minValue;
+        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        {
+            for (size_t i = 0; i < 4 && (x + i) < w; i++)
+            {
+                int value = values[getSingleChannelIndex(indexBits, i, j)];
+                minValue  = std::min(minValue, value);
+                maxValue  = std::max(maxValue, value);
+            }
+        }
+
+        // With the largest endpoint first, BC4 interpolates six values between the endpoints.
+        int bc4Values[8];
+        bc4Values[0] = maxValue;
+        bc4Values[1] = minValue;
+        for (int step = 1; step < 7; step++)
+        {
+            bc4Values[step + 1] = minValue + ((7 - step) * (maxValue - minValue) + 3) / 7;
+        }
+
+        uint64_t bc4Codes[8];
+        for (size_t index = 0; index < 8; index++)
+        {
+            int closestDistance = std::abs(values[index] - bc4Values[0]);
+            bc4Codes[index]     = 0;
+            for (uint64_t code = 1; code < 8; code++)
+            {
+                int distance = std::abs(values[index] - bc4Values[code]);
+                if (distance < closestDistance)
+                {
+                    closestDistance = distance;
+                    bc4Codes[index] = code;
+                }
+            }
+        }
+
+        // BC4 stores the codes of the pixels in rows, while the block stores its indices in
+        // columns
+        uint64_t bc4Bits = 0;
+        for (size_t j = 0; j < 4; j++)
+        {
+            for (size_t i = 0; i < 4; i++)
+            {
+                bc4Bits |= bc4Codes[getSingleChannelIndex(indexBits, i, j)] << ((j * 4 + i) * 3);
+            }
+        }
+
+        dest[0] = static_cast<uint8_t>(maxValue);
+        dest[1] = static_cast<uint8_t>(minValue);
+        for (size_t byteIndex = 0; byteIndex < 6; byteIndex++)
+        {
+            dest[2 + byteIndex] = static_cast<uint8_t>(bc4Bits >> (byteIndex * 8));
         }
-        // clang-format on
     }
 
-    int getSingleChannelModifier(size_t x, size_t y) const
+    // The 3-bit indices of the pixels, stored most significant bit first from byte 2 onwards.
+    uint64_t getSingleChannelIndexBits() const
     {
-        // clang-format off
-        static const int modifierTable[16][8] =
-        {
-            { -3, -6,  -9, -15, 2, 5, 8, 14 },
-            { -3, -7, -10, -13, 2, 6, 9, 12 },
-            { -2, -5,  -8, -13, 1, 4, 7, 12 },
-            { -2, -4,  -6, -13, 1, 3, 5, 12 },
-            { -3, -6,  -8, -12, 2, 5, 7, 11 },
-            { -3, -7,  -9, -11, 2, 6, 8, 10 },
-            { -4, -7,  -8, -11, 3, 6, 7, 10 },
-            { -3, -5,  -8, -11, 2, 4, 7, 10 },
-            { -2, -6,  -8, -10, 1, 5, 7,  9 },
-            { -2, -5,  -8, -10, 1, 4, 7,  9 },
-            { -2, -4,  -8, -10, 1, 3, 7,  9 },
-            { -2, -5,  -7, -10, 1, 4, 6,  9 },
-            { -3, -4,  -7, -10, 2, 3, 6,  9 },
-            { -1, -2,  -3, -10, 0, 1, 2,  9 },
-            { -4, -6,  -8,  -9, 3, 5, 7,  8 },
-            { -3, -5,  -7,  -9, 2, 4, 6,  8 }
-        };
-        // clang-format on
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&u);
+        uint64_t indexBits   = 0;
+        for (size_t byteIndex = 2; byteIndex < 8; byteIndex++)
+        {
+            indexBits = (indexBits << 8) | bytes[byteIndex];
+        }
+        return indexBits;
+    }
 
-        return modifierTable[u.scblk.table_index][getSingleChannelIndex(x, y)];
+    static size_t getSingleChannelIndex(uint64_t indexBits, size_t x, size_t y)
+    {
+        ASSERT(x < 4 && y < 4);
+        return static_cast<size_t>(indexBits >> (45 - (x * 4 + y) * 3)) & 7;
     }
 };
 
@@ -1379,6 +1550,40 @@ static const uint8_t DefaultETCAlphaValues[4][4] =
 };
 
 // clang-format on
+
+// Images with fewer blocks than this per thread are decoded on fewer threads, since handing rows
+// to a worker thread takes longer than decoding that many blocks.
+constexpr size_t kMinBlocksPerDecodeThread = 4096;
+
+// Calls decodeBlockRows(z, yBegin, yEnd) for ranges of rows of blocks that cover the image, with
+// yBegin and yEnd in pixels. Large images are decoded on several threads at once, so
+// decodeBlockRows must only write to the rows it is given.
+template <typename DecodeBlockRowsFunc>
+void DecodeBlockRows(size_t width,
+                     size_t height,
+                     size_t depth,
+                     const DecodeBlockRowsFunc &decodeBlockRows)
+{
+    const size_t blockRowsPerSlice = (height + 3) / 4;
+    const size_t blockRowCount     = blockRowsPerSlice * depth;
+    const size_t blocksPerRow      = (width + 3) / 4;
+
+    ProcessRowsInParallel(
+        blockRowCount, blocksPerRow, kMinBlocksPerDecodeThread,
+        [&](size_t firstBlockRow, size_t lastBlockRow) {
+            for (size_t blockRow = firstBlockRow; blockRow < lastBlockRow;)
+            {
+                size_t z              = blockRow / blockRowsPerSlice;
+                size_t sliceBlockRow  = blockRow % blockRowsPerSlice;
+                size_t sliceBlockRows = std::min(lastBlockRow - blockRow,
+                                                 blockRowsPerSlice - sliceBlockRow);
+                decodeBlockRows(z, sliceBlockRow * 4,
+                                std::min(height, (sliceBlockRow + sliceBlockRows) * 4));
+                blockRow += sliceBlockRows;
+            }
+        });
+}
+
 void LoadR11EACToR8(size_t width,
                     size_t height,
                     size_t depth,
@@ -1390,9 +1595,8 @@ void LoadR11EACToR8(size_t width,
                     size_t outputDepthPitch,
                     bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+    DecodeBlockRows(width, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
         {
             const ETC2Block *sourceRow =
                 priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
@@ -1408,7 +1612,7 @@ void LoadR11EACToR8(size_t width,
                                                        outputRowPitch, isSigned);
             }
         }
-    }
+    });
 }
 
 void LoadRG11EACToRG8(size_t width,
@@ -1422,9 +1626,8 @@ void LoadRG11EACToRG8(size_t width,
                       size_t outputDepthPitch,
                       bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+    DecodeBlockRows(width, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
         {
             const ETC2Block *sourceRow =
                 priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
@@ -1444,7 +1647,7 @@ void LoadRG11EACToRG8(size_t width,
                                                             outputRowPitch, isSigned);
             }
         }
-    }
+    });
 }
 
 void LoadR11EACToR16(size_t width,
@@ -1458,9 +1661,8 @@ void LoadR11EACToR16(size_t width,
                      size_t outputDepthPitch,
                      bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+    DecodeBlockRows(width, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
         {
             const ETC2Block *sourceRow =
                 priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
@@ -1476,7 +1678,7 @@ void LoadR11EACToR16(size_t width,
                                                       outputRowPitch, isSigned);
             }
         }
-    }
+    });
 }
 
 void LoadRG11EACToRG16(size_t width,
@@ -1490,9 +1692,8 @@ void LoadRG11EACToRG16(size_t width,
                        size_t outputDepthPitch,
                        bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+    DecodeBlockRows(width, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
         {
             const ETC2Block *sourceRow =
                 priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
@@ -1512,7 +1713,7 @@ void LoadRG11EACToRG16(size_t width,
                                                            outputRowPitch, isSigned);
             }
         }
-    }
+    });
 }
 
 void LoadETC2RGB8ToRGBA8(size_t width,
@@ -1526,9 +1727,8 @@ void LoadETC2RGB8ToRGBA8(size_t width,
                          size_t outputDepthPitch,
                          bool punchthroughAlpha)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+    DecodeBlockRows(width, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
         {
             const ETC2Block *sourceRow =
                 priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
@@ -1544,7 +1744,7 @@ void LoadETC2RGB8ToRGBA8(size_t width,
                                          DefaultETCAlphaValues, punchthroughAlpha);
             }
         }
-    }
+    });
 }
 
 void LoadETC2RGB8ToBC1(size_t width,
@@ -1558,9 +1758,8 @@ void LoadETC2RGB8ToBC1(size_t width,
                        size_t outputDepthPitch,
                        bool punchthroughAlpha)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+    DecodeBlockRows(width, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
         {
             const ETC2Block *sourceRow =
                 priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
@@ -1576,7 +1775,7 @@ void LoadETC2RGB8ToBC1(size_t width,
                                             punchthroughAlpha);
             }
         }
-    }
+    });
 }
 
 void LoadETC2RGBA8ToRGBA8(size_t width,
@@ -1590,11 +1789,9 @@ void LoadETC2RGBA8ToRGBA8(size_t width,
                           size_t outputDepthPitch,
                           bool srgb)
 {
-    uint8_t decodedAlphaValues[4][4];
-
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+    DecodeBlockRows(width, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        uint8_t decodedAlphaValues[4][4];
+        for (size_t y = yBegin; y < yEnd; y += 4)
         {
             const ETC2Block *sourceRow =
                 priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
@@ -1614,7 +1811,104 @@ void LoadETC2RGBA8ToRGBA8(size_t width,
                                             decodedAlphaValues, false);
             }
         }
-    }
+    });
+}
+
+void LoadR11EACToBC4(size_t width,
+                     size_t height,
+                     size_t depth,
+                     const uint8_t *input,
+                     size_t inputRowPitch,
+                     size_t inputDepthPitch,
+                     uint8_t *output,
+                     size_t outputRowPitch,
+                     size_t outputDepthPitch,
+                     bool isSigned)
+{
+    DecodeBlockRows(width, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                const ETC2Block *sourceBlock = sourceRow + (x / 4);
+                uint8_t *destPixels          = destRow + (x * 2);
+
+                sourceBlock->transcodeAsBC4(destPixels, x, y, width, height, isSigned);
+            }
+        }
+    });
+}
+
+void LoadRG11EACToBC5(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch,
+                      bool isSigned)
+{
+    DecodeBlockRows(width, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                uint8_t *destPixelsRed          = destRow + (x * 4);
+                const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
+                sourceBlockRed->transcodeAsBC4(destPixelsRed, x, y, width, height, isSigned);
+
+                uint8_t *destPixelsGreen          = destPixelsRed + 8;
+                const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
+                sourceBlockGreen->transcodeAsBC4(destPixelsGreen, x, y, width, height, isSigned);
+            }
+        }
+    });
+}
+
+void LoadETC2RGBA8ToBC3(size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch,
+                        bool srgb)
+{
+    DecodeBlockRows(width, height, depth, [&](size_t z, size_t yBegin, size_t yEnd) {
+        for (size_t y = yBegin; y < yEnd; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                uint8_t *destPixels               = destRow + (x * 4);
+                const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
+                sourceBlockAlpha->transcodeAlphaAsBC4(destPixels, x, y, width, height);
+
+                // The color block of BC3 is a BC1 block that is always opaque
+                const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
+                sourceBlockRGB->transcodeAsBC1(destPixels + 8, x, y, width, height,
+                                               DefaultETCAlphaValues, false);
+            }
+        }
+    });
 }
 
 }  // anonymous namespace
@@ -1759,6 +2053,62 @@ void LoadEACRG11SToRG16(size_t width,
                       outputRowPitch, outputDepthPitch, true);
 }
 
+void LoadEACR11ToBC4(size_t width,
+                     size_t height,
+                     size_t depth,
+                     const uint8_t *input,
+                     size_t inputRowPitch,
+                     size_t inputDepthPitch,
+                     uint8_t *output,
+                     size_t outputRowPitch,
+                     size_t outputDepthPitch)
+{
+    LoadR11EACToBC4(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                    outputRowPitch, outputDepthPitch, false);
+}
+
+void LoadEACR11SToBC4(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch)
+{
+    LoadR11EACToBC4(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                    outputRowPitch, outputDepthPitch, true);
+}
+
+void LoadEACRG11ToBC5(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch)
+{
+    LoadRG11EACToBC5(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch, false);
+}
+
+void LoadEACRG11SToBC5(size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch)
+{
+    LoadRG11EACToBC5(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch, true);
+}
+
 void LoadETC2RGB8ToRGBA8(size_t width,
                          size_t height,
                          size_t depth,
@@ -1899,4 +2249,32 @@ void LoadETC2SRGBA8ToSRGBA8(size_t width,
                          outputRowPitch, outputDepthPitch, true);
 }
 
+void LoadETC2RGBA8ToBC3(size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch)
+{
+    LoadETC2RGBA8ToBC3(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                       outputRowPitch, outputDepthPitch, false);
+}
+
+void LoadETC2SRGBA8ToBC3(size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch)
+{
+    LoadETC2RGBA8ToBC3(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                       outputRowPitch, outputDepthPitch, true);
+}
+
 }  // namespace angle
@@ -0,0 +1,54 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// parallelrows.cpp: Defines a helper that splits the rows of an image across several threads.
+
+#include "image_util/parallelrows.h"
+
+#include <algorithm>
+
+namespace angle
+{
+
+namespace
+{
+// Worker threads never have a pool, so tasks don't wait on other tasks of the same pool.
+thread_local RowWorkerPool *gCurrentRowWorkerPool = nullptr;
+}  // anonymous namespace
+
+ScopedRowWorkerPool::ScopedRowWorkerPool(RowWorkerPool *pool)
+    : mPreviousPool(gCurrentRowWorkerPool)
+{
+    gCurrentRowWorkerPool = pool;
+}
+
+ScopedRowWorkerPool::~ScopedRowWorkerPool()
+{
+    gCurrentRowWorkerPool = mPreviousPool;
+}
+
+void ProcessRowsInParallel(size_t rowCount,
+                           size_t workPerRow,
+                           size_t minWorkPerThread,
+                           const std::function<void(size_t rowBegin, size_t rowEnd)> &processRows)
+{
+    RowWorkerPool *pool = gCurrentRowWorkerPool;
+    size_t threadCount  = pool ? pool->getMaxThreads() + 1 : 1;
+    threadCount         = std::min(threadCount, rowCount * workPerRow / minWorkPerThread);
+    threadCount         = std::min(threadCount, rowCount);
+
+    if (threadCount <= 1)
+    {
+        processRows(0, rowCount);
+        return;
+    }
+
+    pool->runTasks(threadCount, [&](size_t index) {
+        processRows(rowCount * index / threadCount, rowCount * (index + 1) / threadCount);
+    });
+}
+
+}  // namespace angle
@@ -0,0 +1,59 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// parallelrows.h: Defines a helper that splits the rows of an image across several threads.
+
+#ifndef IMAGEUTIL_PARALLELROWS_H_
+#define IMAGEUTIL_PARALLELROWS_H_
+
+#include <stddef.h>
+
+#include <functional>
+
+#include "common/angleutils.h"
+
+namespace angle
+{
+
+// Runs the row ranges of ProcessRowsInParallel on worker threads. image_util does not depend on
+// libANGLE, so libANGLE implements this on top of its angle::WorkerThreadPool.
+class RowWorkerPool : angle::NonCopyable
+{
+  public:
+    virtual ~RowWorkerPool() {}
+
+    // The number of tasks that can run at the same time as the calling thread.
+    virtual size_t getMaxThreads() const = 0;
+
+    // Calls task(index) for every index in [0, taskCount) and returns once they are all done.
+    // Index 0 runs on the calling thread, the others run on worker threads.
+    virtual void runTasks(size_t taskCount, const std::function<void(size_t index)> &task) = 0;
+};
+
+// Makes ProcessRowsInParallel use pool on the current thread for as long as it is in scope.
+class ScopedRowWorkerPool : angle::NonCopyable
+{
+  public:
+    explicit ScopedRowWorkerPool(RowWorkerPool *pool);
+    ~ScopedRowWorkerPool();
+
+  private:
+    RowWorkerPool *mPreviousPool;
+};
+
+// Calls processRows(rowBegin, rowEnd) for contiguous ranges of rows that cover [0, rowCount). The
+// ranges are processed on several threads at once when each thread gets at least
+// minWorkPerThread units of work, with workPerRow units in each row, so processRows must only
+// write to the rows it is given. The other threads come from the current ScopedRowWorkerPool;
+// without one, every row is processed on the calling thread.
+void ProcessRowsInParallel(size_t rowCount,
+                           size_t workPerRow,
+                           size_t minWorkPerThread,
+                           const std::function<void(size_t rowBegin, size_t rowEnd)> &processRows);
+
+}  // namespace angle
+
+#endif  // IMAGEUTIL_PARALLELROWS_H_
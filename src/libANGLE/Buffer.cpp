@@ -10,13 +10,23 @@
 
 #include "libANGLE/Buffer.h"
 
+#include <array>
+#include <atomic>
+
 #include "libANGLE/Context.h"
+#include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/BufferImpl.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 
 namespace gl
 {
 
+namespace
+{
+// Buffers are shared between contexts, which can run on different threads.
+std::atomic<unsigned int> bufferSizeSerial(0);
+}  // anonymous namespace
+
 BufferState::BufferState()
     : mLabel(),
       mUsage(BufferUsage::StaticDraw),
@@ -83,6 +93,10 @@ Error Buffer::bufferData(const Context *context,
     ANGLE_TRY(mImpl->setData(context, target, dataForImpl, size, usage));
 
     mIndexRangeCache.clear();
+    if (mState.mSize != size)
+    {
+        bufferSizeSerial++;
+    }
     mState.mUsage = usage;
     mState.mSize  = size;
 
@@ -132,6 +146,8 @@ Error Buffer::map(const Context *context, GLenum access)
     mState.mAccessFlags = GL_MAP_WRITE_BIT;
     mIndexRangeCache.clear();
 
+    mMapChangedChannel.signal(true);
+
     return NoError();
 }
 
@@ -162,6 +178,8 @@ Error Buffer::mapRange(const Context *context,
         mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset), static_cast<unsigned int>(length));
     }
 
+    mMapChangedChannel.signal(true);
+
     return NoError();
 }
 
@@ -179,9 +197,17 @@ Error Buffer::unmap(const Context *context, GLboolean *result)
     mState.mAccess      = GL_WRITE_ONLY_OES;
     mState.mAccessFlags = 0;
 
+    mMapChangedChannel.signal(false);
+
     return NoError();
 }
 
+// static
+unsigned int Buffer::GetSizeSerial()
+{
+    return bufferSizeSerial;
+}
+
 void Buffer::onTransformFeedback()
 {
     mIndexRangeCache.clear();
@@ -204,9 +230,79 @@ Error Buffer::getIndexRange(const gl::Context *context,
         return NoError();
     }
 
-    ANGLE_TRY(
-        mImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled, outRange));
+    // Draws spanning several whole blocks are answered from the block summaries. Only the blocks
+    // that are not summarized yet and the partial blocks at either end need to be scanned.
+    constexpr size_t kMinSummarizedBlocks = 4;
+
+    const size_t typeBytes  = GetTypeInfo(type).bytes;
+    const size_t endOffset  = offset + count * typeBytes;
+    const size_t firstBlock = rx::roundUp(offset, IndexRangeCache::kBlockSize) /
+                              IndexRangeCache::kBlockSize;
+    const size_t endBlock = endOffset / IndexRangeCache::kBlockSize;
+
+    if (endBlock < firstBlock + kMinSummarizedBlocks)
+    {
+        ANGLE_TRY(
+            mImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled, outRange));
+        mIndexRangeCache.addRange(type, offset, count, primitiveRestartEnabled, *outRange);
+        return NoError();
+    }
+
+    std::vector<size_t> missingBlocks;
+    mIndexRangeCache.getMissingBlocks(type, primitiveRestartEnabled,
+                                      static_cast<size_t>(mState.mSize), firstBlock, endBlock,
+                                      &missingBlocks);
+
+    // Each run of adjacent missing blocks is read from the backend in a single call.
+    std::vector<IndexRange> blockRanges;
+    for (size_t runStart = 0; runStart < missingBlocks.size();)
+    {
+        size_t runEnd = runStart + 1;
+        while (runEnd < missingBlocks.size() &&
+               missingBlocks[runEnd] == missingBlocks[runEnd - 1] + 1)
+        {
+            ++runEnd;
+        }
+
+        const size_t firstMissingBlock = missingBlocks[runStart];
+        const size_t runBlockCount     = runEnd - runStart;
+        blockRanges.resize(runBlockCount);
+        ANGLE_TRY(mImpl->getBlockIndexRanges(
+            context, type, firstMissingBlock * IndexRangeCache::kBlockSize,
+            IndexRangeCache::kBlockSize, runBlockCount, primitiveRestartEnabled,
+            blockRanges.data()));
+
+        for (size_t runBlock = 0; runBlock < runBlockCount; ++runBlock)
+        {
+            mIndexRangeCache.setBlockRange(type, primitiveRestartEnabled,
+                                           firstMissingBlock + runBlock, blockRanges[runBlock]);
+        }
+
+        runStart = runEnd;
+    }
+
+    IndexRange range =
+        mIndexRangeCache.getBlocksRange(type, primitiveRestartEnabled, firstBlock, endBlock);
+
+    const size_t headEnd   = firstBlock * IndexRangeCache::kBlockSize;
+    const size_t tailStart = endBlock * IndexRangeCache::kBlockSize;
+    std::array<std::pair<size_t, size_t>, 2> partialRanges = {
+        {{offset, headEnd}, {tailStart, endOffset}}};
+    for (const auto &partialRange : partialRanges)
+    {
+        if (partialRange.first == partialRange.second)
+        {
+            continue;
+        }
+
+        IndexRange partial;
+        ANGLE_TRY(mImpl->getIndexRange(context, type, partialRange.first,
+                                       (partialRange.second - partialRange.first) / typeBytes,
+                                       primitiveRestartEnabled, &partial));
+        range = MergeIndexRanges(range, partial);
+    }
 
+    *outRange = range;
     mIndexRangeCache.addRange(type, offset, count, primitiveRestartEnabled, *outRange);
 
     return NoError();
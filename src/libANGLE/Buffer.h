@@ -17,6 +17,7 @@
 #include "libANGLE/IndexRangeCache.h"
 #include "libANGLE/PackedGLEnums.h"
 #include "libANGLE/RefCountObject.h"
+#include "libANGLE/signal_utils.h"
 
 namespace rx
 {
@@ -29,6 +30,11 @@ namespace gl
 class Buffer;
 class Context;
 
+// Signaled when the buffer is mapped or unmapped. The message is the new mapped state.
+using OnBufferMapChangedBinding  = angle::ChannelBinding<size_t, bool>;
+using OnBufferMapChangedChannel  = angle::BroadcastChannel<size_t, bool>;
+using OnBufferMapChangedReceiver = angle::SignalReceiver<size_t, bool>;
+
 class BufferState final : angle::NonCopyable
 {
   public:
@@ -93,6 +99,10 @@ class Buffer final : public RefCountObject, public LabeledObject
     void onTransformFeedback();
     void onPixelUnpack();
 
+    // Changes whenever the size of any buffer changes. Cached checks of buffer sizes compare it to
+    // notice buffers that were redefined through another context.
+    static unsigned int GetSizeSerial();
+
     Error getIndexRange(const gl::Context *context,
                         GLenum type,
                         size_t offset,
@@ -111,11 +121,15 @@ class Buffer final : public RefCountObject, public LabeledObject
 
     rx::BufferImpl *getImplementation() const { return mImpl; }
 
+    OnBufferMapChangedChannel *getMapChangedChannel() { return &mMapChangedChannel; }
+
   private:
     BufferState mState;
     rx::BufferImpl *mImpl;
 
     mutable IndexRangeCache mIndexRangeCache;
+
+    OnBufferMapChangedChannel mMapChangedChannel;
 };
 
 }  // namespace gl
@@ -373,6 +373,9 @@ struct Extensions
 
     // GL_EXT_geometry_shader
     bool geometryShader;
+
+    // GL_KHR_parallel_shader_compile
+    bool parallelShaderCompile;
 };
 
 struct ExtensionInfo
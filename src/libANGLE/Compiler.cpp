@@ -20,9 +20,15 @@ namespace
 {
 
 // Global count of active shader compiler handles. Needed to know when to call sh::Initialize and
-// sh::Finalize.
+// sh::Finalize. Contexts on different threads create and destroy handles, so the count is guarded
+// by a mutex.
+std::mutex activeCompilerHandlesMutex;
 size_t activeCompilerHandles = 0;
 
+// Handles given back beyond this many free handles of a type are destroyed, so that a burst of
+// compiles doesn't keep one translator per compile alive for the lifetime of the compiler.
+constexpr size_t kMaxFreeCompilerHandles = 4;
+
 ShShaderSpec SelectShaderSpec(GLint majorVersion, GLint minorVersion, bool isWebGL)
 {
     if (majorVersion >= 3)
@@ -47,11 +53,7 @@ Compiler::Compiler(rx::GLImplFactory *implFactory, const ContextState &state)
                              state.getClientMinorVersion(),
                              state.getExtensions().webglCompatibility)),
       mOutputType(mImplementation->getTranslatorOutputType()),
-      mResources(),
-      mFragmentCompiler(nullptr),
-      mVertexCompiler(nullptr),
-      mComputeCompiler(nullptr),
-      mGeometryCompiler(nullptr)
+      mResources()
 {
     ASSERT(state.getClientMajorVersion() == 2 || state.getClientMajorVersion() == 3);
 
@@ -149,91 +151,116 @@ Compiler::Compiler(rx::GLImplFactory *implFactory, const ContextState &state)
 
 Compiler::~Compiler()
 {
-    if (mFragmentCompiler)
-    {
-        sh::Destruct(mFragmentCompiler);
-        mFragmentCompiler = nullptr;
-
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
-    }
-
-    if (mVertexCompiler)
-    {
-        sh::Destruct(mVertexCompiler);
-        mVertexCompiler = nullptr;
-
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
-    }
-
-    if (mComputeCompiler)
-    {
-        sh::Destruct(mComputeCompiler);
-        mComputeCompiler = nullptr;
-
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
-    }
-
-    if (mGeometryCompiler)
+    // Translations hold a reference to the compiler, so no handle is checked out anymore.
     {
-        sh::Destruct(mGeometryCompiler);
-        mGeometryCompiler = nullptr;
-
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
-    }
+        std::lock_guard<std::mutex> lock(activeCompilerHandlesMutex);
+        for (std::vector<ShHandle> *compilers :
+             {&mFragmentCompilers, &mVertexCompilers, &mComputeCompilers, &mGeometryCompilers})
+        {
+            for (ShHandle compiler : *compilers)
+            {
+                sh::Destruct(compiler);
+
+                ASSERT(activeCompilerHandles > 0);
+                activeCompilerHandles--;
+            }
+            compilers->clear();
+        }
 
-    if (activeCompilerHandles == 0)
-    {
-        sh::Finalize();
+        if (activeCompilerHandles == 0)
+        {
+            sh::Finalize();
+        }
     }
 
     ANGLE_SWALLOW_ERR(mImplementation->release());
 }
 
-ShHandle Compiler::getCompilerHandle(GLenum type)
+std::vector<ShHandle> &Compiler::getFreeCompilerHandles(GLenum type)
 {
-    ShHandle *compiler = nullptr;
     switch (type)
     {
         case GL_VERTEX_SHADER:
-            compiler = &mVertexCompiler;
-            break;
-
+            return mVertexCompilers;
         case GL_FRAGMENT_SHADER:
-            compiler = &mFragmentCompiler;
-            break;
+            return mFragmentCompilers;
         case GL_COMPUTE_SHADER:
-            compiler = &mComputeCompiler;
-            break;
+            return mComputeCompilers;
         case GL_GEOMETRY_SHADER_EXT:
-            compiler = &mGeometryCompiler;
-            break;
+            return mGeometryCompilers;
         default:
             UNREACHABLE();
-            return nullptr;
+            return mVertexCompilers;
+    }
+}
+
+ShHandle Compiler::getCompilerHandle(GLenum type)
+{
+    {
+        std::lock_guard<std::mutex> lock(mCompilerHandlesMutex);
+        std::vector<ShHandle> &compilers = getFreeCompilerHandles(type);
+        if (!compilers.empty())
+        {
+            ShHandle compiler = compilers.back();
+            compilers.pop_back();
+            return compiler;
+        }
     }
 
-    if (!(*compiler))
     {
+        std::lock_guard<std::mutex> lock(activeCompilerHandlesMutex);
         if (activeCompilerHandles == 0)
         {
             sh::Initialize();
         }
-
-        *compiler = sh::ConstructCompiler(type, mSpec, mOutputType, &mResources);
-        ASSERT(*compiler);
         activeCompilerHandles++;
     }
 
-    return *compiler;
+    // Constructing a handle builds its symbol table, so it is done outside of the locks.
+    ShHandle compiler = sh::ConstructCompiler(type, mSpec, mOutputType, &mResources);
+    ASSERT(compiler);
+    return compiler;
+}
+
+void Compiler::putCompilerHandle(GLenum type, ShHandle handle)
+{
+    ASSERT(handle);
+    {
+        std::lock_guard<std::mutex> lock(mCompilerHandlesMutex);
+        std::vector<ShHandle> &compilers = getFreeCompilerHandles(type);
+        if (compilers.size() < kMaxFreeCompilerHandles)
+        {
+            compilers.push_back(handle);
+            return;
+        }
+    }
+
+    sh::Destruct(handle);
+
+    // The free handles of this compiler keep the count above zero.
+    std::lock_guard<std::mutex> lock(activeCompilerHandlesMutex);
+    ASSERT(activeCompilerHandles > 1);
+    activeCompilerHandles--;
 }
 
 const std::string &Compiler::getBuiltinResourcesString(GLenum type)
 {
-    return sh::GetBuiltInResourcesString(getCompilerHandle(type));
+    {
+        std::lock_guard<std::mutex> lock(mCompilerHandlesMutex);
+        auto iter = mBuiltinResourcesStrings.find(type);
+        if (iter != mBuiltinResourcesStrings.end())
+        {
+            return iter->second;
+        }
+    }
+
+    ShHandle compiler           = getCompilerHandle(type);
+    std::string resourcesString = sh::GetBuiltInResourcesString(compiler);
+    putCompilerHandle(type, compiler);
+
+    // Entries are never erased, so the reference stays valid until the compiler is destroyed.
+    std::lock_guard<std::mutex> lock(mCompilerHandlesMutex);
+    return mBuiltinResourcesStrings.emplace(type, std::move(resourcesString)).first->second;
 }
 
 }  // namespace gl
@@ -10,6 +10,10 @@
 #ifndef LIBANGLE_COMPILER_H_
 #define LIBANGLE_COMPILER_H_
 
+#include <map>
+#include <mutex>
+#include <vector>
+
 #include "GLSLANG/ShaderLang.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/RefCountObject.h"
@@ -29,21 +33,36 @@ class Compiler final : public RefCountObjectNoID
   public:
     Compiler(rx::GLImplFactory *implFactory, const ContextState &data);
 
+    // A compiler handle can only translate one shader at a time, so each translation checks out a
+    // handle of its own and gives it back once it is done reading the results. Handles are created
+    // on demand, which lets shaders translate concurrently on several threads, and only a few free
+    // handles of each type are kept. Both functions may be called from any thread.
     ShHandle getCompilerHandle(GLenum type);
+    void putCompilerHandle(GLenum type, ShHandle handle);
+
     ShShaderOutput getShaderOutputType() const { return mOutputType; }
     const std::string &getBuiltinResourcesString(GLenum type);
 
   private:
     ~Compiler() override;
+
+    std::vector<ShHandle> &getFreeCompilerHandles(GLenum type);
+
     std::unique_ptr<rx::CompilerImpl> mImplementation;
     ShShaderSpec mSpec;
     ShShaderOutput mOutputType;
     ShBuiltInResources mResources;
 
-    ShHandle mFragmentCompiler;
-    ShHandle mVertexCompiler;
-    ShHandle mComputeCompiler;
-    ShHandle mGeometryCompiler;
+    // Handles that are not checked out, per shader type. Guarded by mCompilerHandlesMutex.
+    std::mutex mCompilerHandlesMutex;
+    std::vector<ShHandle> mFragmentCompilers;
+    std::vector<ShHandle> mVertexCompilers;
+    std::vector<ShHandle> mComputeCompilers;
+    std::vector<ShHandle> mGeometryCompilers;
+
+    // Handles can be destroyed when they are given back, so the resources strings they own are
+    // copied here. Guarded by mCompilerHandlesMutex.
+    std::map<GLenum, std::string> mBuiltinResourcesStrings;
 };
 
 }  // namespace gl
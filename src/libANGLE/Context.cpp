@@ -262,6 +262,7 @@ Context::Context(rx::EGLImplFactory *implFactory,
                  const Context *shareContext,
                  TextureManager *shareTextures,
                  MemoryProgramCache *memoryProgramCache,
+                 angle::WorkerThreadPool *workerThreadPool,
                  const egl::AttributeMap &attribs,
                  const egl::DisplayExtensions &displayExtensions)
 
@@ -289,6 +290,8 @@ Context::Context(rx::EGLImplFactory *implFactory,
       mSurfacelessFramebuffer(nullptr),
       mWebGLContext(GetWebGLContext(attribs)),
       mMemoryProgramCache(memoryProgramCache),
+      mWorkerThreadPool(workerThreadPool),
+      mMaxShaderCompilerThreads(std::numeric_limits<GLuint>::max()),
       mScratchBuffer(1000u),
       mZeroFilledBuffer(1000u)
 {
@@ -424,6 +427,9 @@ Context::Context(rx::EGLImplFactory *implFactory,
 
 egl::Error Context::onDestroy(const egl::Display *display)
 {
+    // Background links hold on to the context they were started on.
+    mState.mShaderPrograms->resolveAllLinks();
+
     for (auto fence : mFenceNVMap)
     {
         SafeDelete(fence.second);
@@ -1411,6 +1417,11 @@ void Context::getIntegervImpl(GLenum pname, GLint *params)
             *params = mExtensions.maxViews;
             break;
 
+        // GL_KHR_parallel_shader_compile
+        case GL_MAX_SHADER_COMPILER_THREADS_KHR:
+            *params = clampCast<GLint>(mMaxShaderCompilerThreads);
+            break;
+
         // GL_EXT_disjoint_timer_query
         case GL_GPU_DISJOINT_EXT:
             *params = mImplementation->getGPUDisjoint();
@@ -2191,11 +2202,6 @@ void Context::markContextLost()
     mContextLost = true;
 }
 
-bool Context::isContextLost()
-{
-    return mContextLost;
-}
-
 GLenum Context::getGraphicsResetStatus()
 {
     // Even if the application doesn't want to know about resets, we want to know
@@ -2694,6 +2700,9 @@ void Context::initCaps(const egl::DisplayExtensions &displayExtensions, bool rob
     // Enable the cache control query unconditionally.
     mExtensions.programCacheControl = true;
 
+    // Shader compiles are dispatched to the display's worker pool by the GL layer.
+    mExtensions.parallelShaderCompile = true;
+
     // Apply implementation limits
     LimitCap(&mCaps.maxVertexAttributes, MAX_VERTEX_ATTRIBS);
 
@@ -3199,6 +3208,13 @@ void Context::framebufferTextureMultiviewSideBySideANGLE(GLenum target,
     mGLState.setObjectDirty(target);
 }
 
+void Context::maxShaderCompilerThreads(GLuint count)
+{
+    // The worker pool is shared by every context on the display, so the count only decides
+    // whether compiles are dispatched to it at all.
+    mMaxShaderCompilerThreads = count;
+}
+
 void Context::drawBuffers(GLsizei n, const GLenum *bufs)
 {
     Framebuffer *framebuffer = mGLState.getDrawFramebuffer();
@@ -4257,6 +4273,11 @@ Error Context::getZeroFilledBuffer(size_t requstedSizeBytes,
     return NoError();
 }
 
+angle::WorkerThreadPool *Context::getShaderCompileThreadPool() const
+{
+    return (mMaxShaderCompilerThreads > 0) ? mWorkerThreadPool : nullptr;
+}
+
 Error Context::prepareForDispatch()
 {
     syncRendererState(mComputeDirtyBits, mComputeDirtyObjects);
@@ -4334,6 +4355,9 @@ void Context::compileShader(GLuint shader)
     {
         return;
     }
+
+    // Links running in the background read the shader's compile results.
+    mState.mShaderPrograms->resolveLinksUsingShader(shaderObject);
     shaderObject->compile(this);
 }
 
@@ -4508,7 +4532,10 @@ void Context::getIntegerv(GLenum pname, GLint *params)
 
 void Context::getProgramiv(GLuint program, GLenum pname, GLint *params)
 {
-    Program *programObject = getProgram(program);
+    // Polling the completion status must not wait for a link running in the background.
+    Program *programObject = (pname == GL_COMPLETION_STATUS_KHR)
+                                 ? getProgramNoResolveLink(program)
+                                 : getProgram(program);
     ASSERT(programObject);
     QueryProgramiv(this, programObject, pname, params);
 }
@@ -4926,6 +4953,7 @@ void Context::programBinary(GLuint program, GLenum binaryFormat, const void *bin
     ASSERT(programObject != nullptr);
 
     handleError(programObject->loadBinary(this, binaryFormat, binary, length));
+    mGLState.onProgramExecutableChange(programObject);
 }
 
 void Context::uniform1ui(GLint location, GLuint v0)
@@ -5276,6 +5304,9 @@ void Context::uniformBlockBinding(GLuint program,
 {
     Program *programObject = getProgram(program);
     programObject->bindUniformBlock(uniformBlockIndex, uniformBlockBinding);
+
+    // Draw validation checks the size of the buffer bound to each uniform block.
+    mGLState.invalidateDrawStatesValidation();
 }
 
 GLsync Context::fenceSync(GLenum condition, GLbitfield flags)
@@ -25,6 +25,7 @@
 #include "libANGLE/RefCountObject.h"
 #include "libANGLE/ResourceMap.h"
 #include "libANGLE/VertexAttribute.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/Workarounds.h"
 #include "libANGLE/angletypes.h"
 
@@ -69,6 +70,7 @@ class Context final : public ValidationContext
             const Context *shareContext,
             TextureManager *shareTextures,
             MemoryProgramCache *memoryProgramCache,
+            angle::WorkerThreadPool *workerThreadPool,
             const egl::AttributeMap &attribs,
             const egl::DisplayExtensions &displayExtensions);
 
@@ -554,6 +556,8 @@ class Context final : public ValidationContext
                                                     GLsizei numViews,
                                                     const GLint *viewportOffsets);
 
+    void maxShaderCompilerThreads(GLuint count);
+
     void drawBuffers(GLsizei n, const GLenum *bufs);
     void readBuffer(GLenum mode);
 
@@ -1125,7 +1129,7 @@ class Context final : public ValidationContext
 
     GLenum getError();
     void markContextLost();
-    bool isContextLost();
+    bool isContextLost() const { return mContextLost; }
     GLenum getGraphicsResetStatus();
     bool isResetNotificationEnabled();
 
@@ -1152,6 +1156,11 @@ class Context final : public ValidationContext
 
     MemoryProgramCache *getMemoryProgramCache() const { return mMemoryProgramCache; }
 
+    angle::WorkerThreadPool *getWorkerThreadPool() const { return mWorkerThreadPool; }
+
+    // Returns null if shaders should be translated on the GL thread.
+    angle::WorkerThreadPool *getShaderCompileThreadPool() const;
+
     template <EntryPoint EP, typename... ParamsT>
     void gatherParams(ParamsT &&... params);
 
@@ -1249,6 +1258,8 @@ class Context final : public ValidationContext
     Framebuffer *mSurfacelessFramebuffer;
     bool mWebGLContext;
     MemoryProgramCache *mMemoryProgramCache;
+    angle::WorkerThreadPool *mWorkerThreadPool;
+    GLuint mMaxShaderCompilerThreads;
 
     State::DirtyBits mTexImageDirtyBits;
     State::DirtyObjects mTexImageDirtyObjects;
@@ -569,6 +569,13 @@ bool ValidationContext::getQueryParameterInfo(GLenum pname, GLenum *type, unsign
         return true;
     }
 
+    if (getExtensions().parallelShaderCompile && pname == GL_MAX_SHADER_COMPILER_THREADS_KHR)
+    {
+        *type      = GL_INT;
+        *numParams = 1;
+        return true;
+    }
+
     if (getClientVersion() < Version(3, 0))
     {
         return false;
@@ -830,6 +837,11 @@ Program *ValidationContext::getProgram(GLuint handle) const
     return mState.mShaderPrograms->getProgram(handle);
 }
 
+Program *ValidationContext::getProgramNoResolveLink(GLuint handle) const
+{
+    return mState.mShaderPrograms->getProgramNoResolveLink(handle);
+}
+
 Shader *ValidationContext::getShader(GLuint handle) const
 {
     return mState.mShaderPrograms->getShader(handle);
@@ -121,6 +121,7 @@ class ValidationContext : angle::NonCopyable
     bool getIndexedQueryParameterInfo(GLenum target, GLenum *type, unsigned int *numParams);
 
     Program *getProgram(GLuint handle) const;
+    Program *getProgramNoResolveLink(GLuint handle) const;
     Shader *getShader(GLuint handle) const;
 
     bool isTextureGenerated(GLuint texture) const;
@@ -142,6 +143,9 @@ class ValidationContext : angle::NonCopyable
 
     bool isValidBufferBinding(BufferBinding binding) const { return mValidBufferBindings[binding]; }
 
+    // Lets ValidateDrawBase skip the draw state checks until that state changes.
+    void setDrawStatesValidated() { mState.mState->setDrawStatesValidated(); }
+
   protected:
     ContextState mState;
     bool mSkipValidation;
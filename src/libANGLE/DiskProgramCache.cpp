@@ -0,0 +1,372 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskProgramCache: Stores serialized programs in a directory so they survive the process.
+//   Backs the MemoryProgramCache. Each program is stored in its own blob file named after its
+//   hash, and an index file keeps the entries in least recently used order.
+
+#include "libANGLE/DiskProgramCache.h"
+
+#include <anglebase/sha1.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#include "common/debug.h"
+#include "common/system_utils.h"
+#include "libANGLE/BinaryStream.h"
+
+namespace gl
+{
+
+namespace
+{
+constexpr int kBlobMagic     = 0x50474E41;  // "ANGP"
+constexpr int kIndexMagic    = 0x58494E41;  // "ANIX"
+constexpr int kFormatVersion = 1;
+
+// Entries used since the index was last written are lost if the process doesn't shut down
+// cleanly, so the index is also written after this many puts.
+constexpr unsigned int kPutsPerIndexFlush = 32;
+
+constexpr char kIndexFileName[] = "index";
+
+std::string HashToString(const ProgramHash &programHash)
+{
+    constexpr char kHexDigits[] = "0123456789abcdef";
+
+    std::string hashString;
+    for (uint8_t byte : programHash)
+    {
+        hashString += kHexDigits[byte >> 4];
+        hashString += kHexDigits[byte & 0xF];
+    }
+    return hashString;
+}
+
+bool ReadFile(const std::string &path, angle::MemoryBuffer *contentsOut)
+{
+    std::ifstream file(path.c_str(), std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return false;
+    }
+
+    std::streamoff length = file.tellg();
+    if (length <= 0 || !contentsOut->resize(static_cast<size_t>(length)))
+    {
+        return false;
+    }
+
+    file.seekg(0, std::ios::beg);
+    file.read(reinterpret_cast<char *>(contentsOut->data()), length);
+    return !file.fail();
+}
+
+// Temporary files are named after the process and a per-process counter, so that processes and
+// threads sharing the cache directory never write to the same one.
+std::string GetUniqueTempPath(const std::string &path)
+{
+    static std::atomic<unsigned int> tempFileCounter(0);
+
+    std::ostringstream tempPath;
+    tempPath << path << "." << angle::GetCurrentProcessID() << "." << tempFileCounter++ << ".tmp";
+    return tempPath.str();
+}
+
+// Writes to a temporary file first and renames it over the destination, so that readers never see
+// a partially written file.
+bool WriteFileAtomic(const std::string &path, const void *data, size_t length)
+{
+    std::string tempPath = GetUniqueTempPath(path);
+
+    {
+        std::ofstream file(tempPath.c_str(), std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char *>(data), length);
+        file.close();
+        if (file.fail())
+        {
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        // Renaming doesn't replace an existing file on Windows.
+        std::remove(path.c_str());
+        if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+        {
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void ComputeBinaryHash(const uint8_t *binary, size_t length, ProgramHash *hashOut)
+{
+    angle::base::SHA1HashBytes(binary, length, hashOut->data());
+}
+}  // anonymous namespace
+
+DiskProgramCache::DiskProgramCache(const std::string &directory, size_t maxCacheSizeBytes)
+    : mDirectory(directory),
+      mMaxSize(maxCacheSizeBytes),
+      mCurrentSize(0),
+      mIndexDirty(false),
+      mPutsSinceFlush(0)
+{
+}
+
+DiskProgramCache::~DiskProgramCache()
+{
+    if (mIndexDirty)
+    {
+        flush();
+    }
+}
+
+bool DiskProgramCache::initialize()
+{
+    if (!angle::MakeDirectory(mDirectory.c_str()))
+    {
+        WARN() << "Failed to create the program cache directory " << mDirectory;
+        return false;
+    }
+
+    if (!readIndex())
+    {
+        // A missing or damaged index starts the cache over. Blobs it referred to are overwritten
+        // as programs are stored again.
+        mEntries.clear();
+        mEntryMap.clear();
+        mCurrentSize = 0;
+        mIndexDirty  = true;
+    }
+
+    // The size limit may have been lowered since the index was written.
+    shrinkToSize(mMaxSize);
+    return true;
+}
+
+bool DiskProgramCache::get(const ProgramHash &programHash, angle::MemoryBuffer *binaryOut)
+{
+    auto entryIter = mEntryMap.find(programHash);
+    if (entryIter == mEntryMap.end())
+    {
+        return false;
+    }
+
+    angle::MemoryBuffer blob;
+    bool valid = ReadFile(getBlobPath(programHash), &blob);
+
+    size_t length = 0;
+    size_t offset = 0;
+    if (valid)
+    {
+        BinaryInputStream stream(blob.data(), blob.size());
+
+        ProgramHash storedHash;
+        ProgramHash storedBinaryHash;
+        valid = (stream.readInt<int>() == kBlobMagic);
+        valid = valid && (stream.readInt<int>() == kFormatVersion);
+        stream.readBytes(storedHash.data(), storedHash.size());
+        length = stream.readInt<size_t>();
+        stream.readBytes(storedBinaryHash.data(), storedBinaryHash.size());
+        offset = stream.offset();
+
+        // Catches truncated or corrupted files, and files that were written for another program.
+        ProgramHash binaryHash;
+        valid = valid && !stream.error() && storedHash == programHash &&
+                blob.size() - offset == length;
+        if (valid)
+        {
+            ComputeBinaryHash(blob.data() + offset, length, &binaryHash);
+            valid = (binaryHash == storedBinaryHash);
+        }
+    }
+
+    if (!valid || !binaryOut->resize(length))
+    {
+        WARN() << "Evicting invalid program binary from the disk cache.";
+        remove(programHash);
+        return false;
+    }
+
+    memcpy(binaryOut->data(), blob.data() + offset, length);
+
+    mEntries.splice(mEntries.begin(), mEntries, entryIter->second);
+    mIndexDirty = true;
+    return true;
+}
+
+void DiskProgramCache::put(const ProgramHash &programHash, const uint8_t *binary, size_t length)
+{
+    if (length > mMaxSize)
+    {
+        return;
+    }
+
+    ProgramHash binaryHash;
+    ComputeBinaryHash(binary, length, &binaryHash);
+
+    BinaryOutputStream stream;
+    stream.writeInt(kBlobMagic);
+    stream.writeInt(kFormatVersion);
+    stream.writeBytes(programHash.data(), programHash.size());
+    stream.writeInt(length);
+    stream.writeBytes(binaryHash.data(), binaryHash.size());
+    stream.writeBytes(binary, length);
+
+    auto existing = mEntryMap.find(programHash);
+    if (existing != mEntryMap.end())
+    {
+        eraseEntry(existing->second);
+    }
+
+    // Make room before writing, so the directory never holds much more than the limit.
+    shrinkToSize(mMaxSize - length);
+
+    if (!WriteFileAtomic(getBlobPath(programHash), stream.data(), stream.length()))
+    {
+        WARN() << "Failed to write program binary to the disk cache.";
+        return;
+    }
+
+    mEntries.push_front({programHash, length});
+    mEntryMap[programHash] = mEntries.begin();
+    mCurrentSize += length;
+    mIndexDirty = true;
+
+    if (++mPutsSinceFlush >= kPutsPerIndexFlush)
+    {
+        flush();
+    }
+}
+
+void DiskProgramCache::remove(const ProgramHash &programHash)
+{
+    auto entryIter = mEntryMap.find(programHash);
+    if (entryIter != mEntryMap.end())
+    {
+        eraseEntry(entryIter->second);
+        std::remove(getBlobPath(programHash).c_str());
+    }
+}
+
+void DiskProgramCache::flush()
+{
+    BinaryOutputStream stream;
+    stream.writeInt(kIndexMagic);
+    stream.writeInt(kFormatVersion);
+    stream.writeInt(mEntries.size());
+    for (const Entry &entry : mEntries)
+    {
+        stream.writeBytes(entry.programHash.data(), entry.programHash.size());
+        stream.writeInt(entry.size);
+    }
+
+    if (!WriteFileAtomic(getIndexPath(), stream.data(), stream.length()))
+    {
+        WARN() << "Failed to write the program cache index.";
+        return;
+    }
+
+    mIndexDirty     = false;
+    mPutsSinceFlush = 0;
+}
+
+size_t DiskProgramCache::entryCount() const
+{
+    return mEntries.size();
+}
+
+size_t DiskProgramCache::size() const
+{
+    return mCurrentSize;
+}
+
+size_t DiskProgramCache::maxSize() const
+{
+    return mMaxSize;
+}
+
+std::string DiskProgramCache::getBlobPath(const ProgramHash &programHash) const
+{
+    return mDirectory + "/" + HashToString(programHash) + ".bin";
+}
+
+std::string DiskProgramCache::getIndexPath() const
+{
+    return mDirectory + "/" + kIndexFileName;
+}
+
+bool DiskProgramCache::readIndex()
+{
+    angle::MemoryBuffer index;
+    if (!ReadFile(getIndexPath(), &index))
+    {
+        return false;
+    }
+
+    BinaryInputStream stream(index.data(), index.size());
+    if (stream.readInt<int>() != kIndexMagic || stream.readInt<int>() != kFormatVersion)
+    {
+        return false;
+    }
+
+    size_t entryCount = stream.readInt<size_t>();
+    for (size_t entryIndex = 0; entryIndex < entryCount && !stream.error(); ++entryIndex)
+    {
+        Entry entry;
+        stream.readBytes(entry.programHash.data(), entry.programHash.size());
+        entry.size = stream.readInt<size_t>();
+
+        if (stream.error() || mEntryMap.count(entry.programHash) > 0)
+        {
+            return false;
+        }
+
+        // Entries are written most recently used first.
+        mEntries.push_back(entry);
+        mEntryMap[entry.programHash] = std::prev(mEntries.end());
+        mCurrentSize += entry.size;
+    }
+
+    return !stream.error() && stream.endOfStream();
+}
+
+void DiskProgramCache::eraseEntry(EntryList::iterator entry)
+{
+    ASSERT(mCurrentSize >= entry->size);
+    mCurrentSize -= entry->size;
+    mEntryMap.erase(entry->programHash);
+    mEntries.erase(entry);
+    mIndexDirty = true;
+}
+
+void DiskProgramCache::shrinkToSize(size_t limit)
+{
+    while (mCurrentSize > limit)
+    {
+        ASSERT(!mEntries.empty());
+        ProgramHash programHash = mEntries.back().programHash;
+        eraseEntry(std::prev(mEntries.end()));
+        std::remove(getBlobPath(programHash).c_str());
+    }
+}
+
+}  // namespace gl
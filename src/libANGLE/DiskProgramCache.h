@@ -0,0 +1,82 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskProgramCache: Stores serialized programs in a directory so they survive the process.
+//   Backs the MemoryProgramCache. Each program is stored in its own blob file named after its
+//   hash, and an index file keeps the entries in least recently used order.
+
+#ifndef LIBANGLE_DISK_PROGRAM_CACHE_H_
+#define LIBANGLE_DISK_PROGRAM_CACHE_H_
+
+#include <list>
+#include <string>
+#include <unordered_map>
+
+#include "common/MemoryBuffer.h"
+#include "libANGLE/MemoryProgramCache.h"
+
+namespace gl
+{
+
+class DiskProgramCache final : angle::NonCopyable
+{
+  public:
+    DiskProgramCache(const std::string &directory, size_t maxCacheSizeBytes);
+
+    // Writes the index if it changed since it was last written.
+    ~DiskProgramCache();
+
+    // Creates the directory if needed and reads the index. Returns false if the directory can't
+    // be used, in which case the cache stays empty.
+    bool initialize();
+
+    // Reads and validates the blob stored for the hash. Invalid blobs are evicted.
+    bool get(const ProgramHash &programHash, angle::MemoryBuffer *binaryOut);
+
+    // Stores the binary, evicting least recently used entries to stay under the size limit.
+    void put(const ProgramHash &programHash, const uint8_t *binary, size_t length);
+
+    void remove(const ProgramHash &programHash);
+
+    // Writes the index now.
+    void flush();
+
+    size_t entryCount() const;
+
+    // Returns the total size in bytes of the binaries in the cache.
+    size_t size() const;
+
+    size_t maxSize() const;
+
+  private:
+    struct Entry
+    {
+        ProgramHash programHash;
+        size_t size;
+    };
+    using EntryList = std::list<Entry>;
+
+    std::string getBlobPath(const ProgramHash &programHash) const;
+    std::string getIndexPath() const;
+
+    bool readIndex();
+    void eraseEntry(EntryList::iterator entry);
+    void shrinkToSize(size_t limit);
+
+    std::string mDirectory;
+    size_t mMaxSize;
+    size_t mCurrentSize;
+
+    // Most recently used entries are at the front.
+    EntryList mEntries;
+    std::unordered_map<ProgramHash, EntryList::iterator> mEntryMap;
+
+    bool mIndexDirty;
+    unsigned int mPutsSinceFlush;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_DISK_PROGRAM_CACHE_H_
@@ -0,0 +1,201 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskProgramCache_unittest.cpp: Unit tests of the DiskProgramCache class.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "common/system_utils.h"
+#include "libANGLE/DiskProgramCache.h"
+
+namespace
+{
+
+gl::ProgramHash MakeHash(uint8_t value)
+{
+    gl::ProgramHash programHash;
+    programHash.fill(value);
+    return programHash;
+}
+
+std::vector<uint8_t> MakeBinary(uint8_t value, size_t length)
+{
+    return std::vector<uint8_t>(length, value);
+}
+
+class DiskProgramCacheTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        mDirectory = std::string(angle::GetExecutableDirectory()) + "/DiskProgramCacheTest";
+
+        // Start without an index, so blobs left over from earlier runs are ignored.
+        std::remove((mDirectory + "/index").c_str());
+    }
+
+    void put(gl::DiskProgramCache *cache, uint8_t value, size_t length)
+    {
+        std::vector<uint8_t> binary = MakeBinary(value, length);
+        cache->put(MakeHash(value), binary.data(), binary.size());
+    }
+
+    bool getAndCompare(gl::DiskProgramCache *cache, uint8_t value, size_t length)
+    {
+        angle::MemoryBuffer binary;
+        if (!cache->get(MakeHash(value), &binary))
+        {
+            return false;
+        }
+        std::vector<uint8_t> expected = MakeBinary(value, length);
+        return binary.size() == length &&
+               std::equal(expected.begin(), expected.end(), binary.data());
+    }
+
+    // Blobs are named after the hash in hex, and the test hashes repeat a single byte.
+    std::string getBlobPath(const std::string &hexByte) const
+    {
+        std::string path = mDirectory + "/";
+        for (size_t byte = 0; byte < gl::kProgramHashLength; ++byte)
+        {
+            path += hexByte;
+        }
+        return path + ".bin";
+    }
+
+    std::string mDirectory;
+};
+
+// Test that stored binaries can be read back.
+TEST_F(DiskProgramCacheTest, PutAndGet)
+{
+    gl::DiskProgramCache cache(mDirectory, 1024);
+    ASSERT_TRUE(cache.initialize());
+    EXPECT_EQ(0u, cache.entryCount());
+
+    put(&cache, 1, 100);
+    put(&cache, 2, 200);
+    EXPECT_EQ(2u, cache.entryCount());
+    EXPECT_EQ(300u, cache.size());
+
+    EXPECT_TRUE(getAndCompare(&cache, 1, 100));
+    EXPECT_TRUE(getAndCompare(&cache, 2, 200));
+    EXPECT_FALSE(getAndCompare(&cache, 3, 100));
+
+    // Replacing an entry doesn't count its old size.
+    put(&cache, 1, 50);
+    EXPECT_EQ(2u, cache.entryCount());
+    EXPECT_EQ(250u, cache.size());
+    EXPECT_TRUE(getAndCompare(&cache, 1, 50));
+
+    cache.remove(MakeHash(2));
+    EXPECT_FALSE(getAndCompare(&cache, 2, 200));
+    EXPECT_EQ(50u, cache.size());
+}
+
+// Test that the least recently used entries are evicted to stay under the limit.
+TEST_F(DiskProgramCacheTest, EvictsLeastRecentlyUsed)
+{
+    gl::DiskProgramCache cache(mDirectory, 300);
+    ASSERT_TRUE(cache.initialize());
+
+    put(&cache, 1, 100);
+    put(&cache, 2, 100);
+    put(&cache, 3, 100);
+
+    // Using the first entry makes the second one the least recently used.
+    EXPECT_TRUE(getAndCompare(&cache, 1, 100));
+
+    put(&cache, 4, 100);
+    EXPECT_EQ(3u, cache.entryCount());
+    EXPECT_LE(cache.size(), cache.maxSize());
+    EXPECT_TRUE(getAndCompare(&cache, 1, 100));
+    EXPECT_FALSE(getAndCompare(&cache, 2, 100));
+    EXPECT_TRUE(getAndCompare(&cache, 3, 100));
+    EXPECT_TRUE(getAndCompare(&cache, 4, 100));
+
+    // Binaries larger than the whole cache aren't stored.
+    put(&cache, 5, 301);
+    EXPECT_FALSE(getAndCompare(&cache, 5, 301));
+    EXPECT_EQ(3u, cache.entryCount());
+}
+
+// Test that the contents and their order are kept across instances.
+TEST_F(DiskProgramCacheTest, IndexPersists)
+{
+    {
+        gl::DiskProgramCache cache(mDirectory, 300);
+        ASSERT_TRUE(cache.initialize());
+        put(&cache, 1, 100);
+        put(&cache, 2, 100);
+        put(&cache, 3, 100);
+        EXPECT_TRUE(getAndCompare(&cache, 1, 100));
+    }
+
+    gl::DiskProgramCache cache(mDirectory, 300);
+    ASSERT_TRUE(cache.initialize());
+    EXPECT_EQ(3u, cache.entryCount());
+    EXPECT_EQ(300u, cache.size());
+
+    put(&cache, 4, 100);
+    EXPECT_TRUE(getAndCompare(&cache, 1, 100));
+    EXPECT_FALSE(getAndCompare(&cache, 2, 100));
+    EXPECT_TRUE(getAndCompare(&cache, 3, 100));
+    EXPECT_TRUE(getAndCompare(&cache, 4, 100));
+}
+
+// Test that a lower limit evicts entries when the cache is opened.
+TEST_F(DiskProgramCacheTest, ShrinksOnInitialize)
+{
+    {
+        gl::DiskProgramCache cache(mDirectory, 300);
+        ASSERT_TRUE(cache.initialize());
+        put(&cache, 1, 100);
+        put(&cache, 2, 100);
+        put(&cache, 3, 100);
+    }
+
+    gl::DiskProgramCache cache(mDirectory, 150);
+    ASSERT_TRUE(cache.initialize());
+    EXPECT_EQ(1u, cache.entryCount());
+    EXPECT_TRUE(getAndCompare(&cache, 3, 100));
+}
+
+// Test that corrupted or truncated blobs are detected and evicted.
+TEST_F(DiskProgramCacheTest, CorruptedBlob)
+{
+    gl::DiskProgramCache cache(mDirectory, 1024);
+    ASSERT_TRUE(cache.initialize());
+    put(&cache, 0xab, 100);
+    put(&cache, 0xcd, 100);
+
+    {
+        // Change the last byte of the payload.
+        std::fstream file(getBlobPath("ab").c_str(),
+                          std::ios::binary | std::ios::in | std::ios::out);
+        ASSERT_TRUE(file.is_open());
+        file.seekp(-1, std::ios::end);
+        file.put(0);
+    }
+
+    EXPECT_FALSE(getAndCompare(&cache, 0xab, 100));
+    EXPECT_EQ(1u, cache.entryCount());
+    EXPECT_EQ(100u, cache.size());
+
+    {
+        std::ofstream file(getBlobPath("cd").c_str(), std::ios::binary | std::ios::trunc);
+        file.put(1);
+    }
+
+    EXPECT_FALSE(getAndCompare(&cache, 0xcd, 100));
+    EXPECT_EQ(0u, cache.entryCount());
+}
+
+}  // anonymous namespace
@@ -77,6 +77,16 @@ namespace egl
 namespace
 {
 
+// Number of worker threads used when EGL_PLATFORM_ANGLE_WORKER_THREAD_COUNT_ANGLE isn't given.
+constexpr EGLAttrib kDefaultWorkerThreadCount = 4;
+
+// Limit of the on-disk program cache when EGL_PROGRAM_CACHE_DISK_SIZE_ANGLE isn't given.
+constexpr EGLAttrib kDefaultProgramCacheDiskSize = 64 * 1024 * 1024;
+
+// Programs are only looked up on disk through the memory cache, so it gets enabled along with the
+// disk cache if the application hasn't sized it.
+constexpr size_t kProgramCacheMemorySizeWithDisk = 8 * 1024 * 1024;
+
 typedef std::map<EGLNativeWindowType, Surface*> WindowSurfaceMap;
 // Get a map of all EGL window surfaces to validate that no window has more than one EGL surface
 // associated with it.
@@ -434,6 +444,11 @@ void Display::setAttributes(rx::DisplayImpl *impl, const AttributeMap &attribMap
     mImplementation = impl;
 
     mAttributeMap = attribMap;
+
+    // The application's string only has to live until eglGetPlatformDisplay returns.
+    const char *programCacheDirectory =
+        reinterpret_cast<const char *>(attribMap.get(EGL_PROGRAM_CACHE_DIRECTORY_ANGLE, 0));
+    mProgramCacheDirectory = programCacheDirectory ? programCacheDirectory : "";
 }
 
 Error Display::initialize()
@@ -463,11 +478,25 @@ Error Display::initialize()
         return NoError();
     }
 
+    // The disk cache is enabled first, so that the implementation can restore its own caches.
+    if (!mProgramCacheDirectory.empty())
+    {
+        EGLAttrib diskCacheSize =
+            mAttributeMap.get(EGL_PROGRAM_CACHE_DISK_SIZE_ANGLE, kDefaultProgramCacheDiskSize);
+        if (mMemoryProgramCache.enableDiskCache(mProgramCacheDirectory,
+                                                static_cast<size_t>(diskCacheSize)) &&
+            mMemoryProgramCache.maxSize() == 0)
+        {
+            mMemoryProgramCache.resize(kProgramCacheMemorySizeWithDisk);
+        }
+    }
+
     Error error = mImplementation->initialize(this);
     if (error.isError())
     {
         // Log extended error message here
         ERR() << "ANGLE Display::initialize error " << error.getID() << ": " << error.getMessage();
+        mMemoryProgramCache.disableDiskCache();
         return error;
     }
 
@@ -477,6 +506,7 @@ Error Display::initialize()
     if (mConfigSet.size() == 0)
     {
         mImplementation->terminate();
+        mMemoryProgramCache.disableDiskCache();
         return EglNotInitialized();
     }
 
@@ -514,9 +544,22 @@ Error Display::initialize()
         ASSERT(mDevice != nullptr);
     }
 
+    EGLAttrib workerThreadCount =
+        mAttributeMap.get(EGL_PLATFORM_ANGLE_WORKER_THREAD_COUNT_ANGLE, EGL_DONT_CARE);
+    if (workerThreadCount == EGL_DONT_CARE)
+    {
+        workerThreadCount = kDefaultWorkerThreadCount;
+    }
+    if (workerThreadCount > 0)
+    {
+        mWorkerThreadPool.reset(
+            new angle::WorkerThreadPool(static_cast<size_t>(workerThreadCount)));
+    }
+
     mProxyContext.reset(nullptr);
-    gl::Context *proxyContext = new gl::Context(mImplementation, nullptr, nullptr, nullptr, nullptr,
-                                                egl::AttributeMap(), mDisplayExtensions);
+    gl::Context *proxyContext =
+        new gl::Context(mImplementation, nullptr, nullptr, nullptr, nullptr, nullptr,
+                        egl::AttributeMap(), mDisplayExtensions);
     mProxyContext.reset(proxyContext);
 
     mInitialized = true;
@@ -528,8 +571,6 @@ Error Display::terminate()
 {
     ANGLE_TRY(makeCurrent(nullptr, nullptr, nullptr));
 
-    mMemoryProgramCache.clear();
-
     mProxyContext.reset(nullptr);
 
     while (!mContextSet.empty())
@@ -540,6 +581,10 @@ Error Display::terminate()
     // The global texture manager should be deleted with the last context that uses it.
     ASSERT(mGlobalTextureShareGroupUsers == 0 && mTextureManager == nullptr);
 
+    // Contexts wait for their outstanding shader compiles when they're destroyed, so the worker
+    // pool can go away now.
+    mWorkerThreadPool.reset();
+
     while (!mImageSet.empty())
     {
         destroyImage(*mImageSet.begin());
@@ -564,8 +609,12 @@ Error Display::terminate()
         SafeDelete(mDevice);
     }
 
+    // The implementation can write its caches out when it terminates.
     mImplementation->terminate();
 
+    mMemoryProgramCache.clear();
+    mMemoryProgramCache.disableDiskCache();
+
     mDeviceLost = false;
 
     mInitialized = false;
@@ -780,7 +829,7 @@ Error Display::createContext(const Config *configuration,
 
     gl::Context *context =
         new gl::Context(mImplementation, configuration, shareContext, shareTextures, cachePointer,
-                        attribs, mDisplayExtensions);
+                        mWorkerThreadPool.get(), attribs, mDisplayExtensions);
 
     ASSERT(context != nullptr);
     mContextSet.insert(context);
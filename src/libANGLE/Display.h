@@ -11,6 +11,7 @@
 #ifndef LIBANGLE_DISPLAY_H_
 #define LIBANGLE_DISPLAY_H_
 
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -21,6 +22,7 @@
 #include "libANGLE/LoggingAnnotator.h"
 #include "libANGLE/MemoryProgramCache.h"
 #include "libANGLE/Version.h"
+#include "libANGLE/WorkerThread.h"
 
 namespace gl
 {
@@ -163,6 +165,12 @@ class Display final : angle::NonCopyable
 
     gl::Context *getProxyContext() const { return mProxyContext.get(); }
 
+    angle::WorkerThreadPool *getWorkerThreadPool() const { return mWorkerThreadPool.get(); }
+
+    // Backends can keep their own caches next to the program binaries, like the Vulkan pipeline
+    // cache. The disk cache is already enabled when the implementation is initialized.
+    gl::MemoryProgramCache *getMemoryProgramCache() { return &mMemoryProgramCache; }
+
   private:
     Display(EGLenum platform, EGLNativeDisplayType displayId, Device *eglDevice);
 
@@ -206,6 +214,8 @@ class Display final : angle::NonCopyable
 
     gl::TextureManager *mTextureManager;
     gl::MemoryProgramCache mMemoryProgramCache;
+    std::string mProgramCacheDirectory;
+    std::unique_ptr<angle::WorkerThreadPool> mWorkerThreadPool;
     size_t mGlobalTextureShareGroupUsers;
 
     // This gl::Context is a simple proxy to the Display for the GL back-end entry points
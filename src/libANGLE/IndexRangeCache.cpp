@@ -15,6 +15,20 @@
 namespace gl
 {
 
+IndexRange MergeIndexRanges(const IndexRange &a, const IndexRange &b)
+{
+    if (a.vertexIndexCount == 0)
+    {
+        return b;
+    }
+    if (b.vertexIndexCount == 0)
+    {
+        return a;
+    }
+    return IndexRange(std::min(a.start, b.start), std::max(a.end, b.end),
+                      a.vertexIndexCount + b.vertexIndexCount);
+}
+
 IndexRangeCache::IndexRangeCache()
 {
 }
@@ -57,8 +71,61 @@ bool IndexRangeCache::findRange(GLenum type,
     }
 }
 
+void IndexRangeCache::getMissingBlocks(GLenum type,
+                                       bool primitiveRestartEnabled,
+                                       size_t bufferSize,
+                                       size_t firstBlock,
+                                       size_t endBlock,
+                                       std::vector<size_t> *missingBlocksOut)
+{
+    BlockSummary &summary = mBlockSummaries[GetBlockSummaryIndex(type, primitiveRestartEnabled)];
+    if (summary.empty())
+    {
+        summary.initialize(bufferSize / kBlockSize);
+    }
+    summary.getMissingBlocks(firstBlock, endBlock, missingBlocksOut);
+}
+
+void IndexRangeCache::setBlockRange(GLenum type,
+                                    bool primitiveRestartEnabled,
+                                    size_t block,
+                                    const IndexRange &range)
+{
+    BlockSummary &summary = mBlockSummaries[GetBlockSummaryIndex(type, primitiveRestartEnabled)];
+    ASSERT(!summary.empty());
+    summary.setBlock(block, range, true);
+}
+
+IndexRange IndexRangeCache::getBlocksRange(GLenum type,
+                                           bool primitiveRestartEnabled,
+                                           size_t firstBlock,
+                                           size_t endBlock) const
+{
+    const BlockSummary &summary =
+        mBlockSummaries[GetBlockSummaryIndex(type, primitiveRestartEnabled)];
+    ASSERT(!summary.empty());
+    return summary.getRange(firstBlock, endBlock);
+}
+
 void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 {
+    if (size > 0)
+    {
+        size_t firstBlock = offset / kBlockSize;
+        size_t endBlock   = (offset + size + kBlockSize - 1) / kBlockSize;
+        for (BlockSummary &summary : mBlockSummaries)
+        {
+            if (summary.empty())
+            {
+                continue;
+            }
+            for (size_t block = firstBlock; block < endBlock; ++block)
+            {
+                summary.setBlock(block, IndexRange(), false);
+            }
+        }
+    }
+
     size_t invalidateStart = offset;
     size_t invalidateEnd   = offset + size;
 
@@ -82,6 +149,152 @@ void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 void IndexRangeCache::clear()
 {
     mIndexRangeCache.clear();
+    for (BlockSummary &summary : mBlockSummaries)
+    {
+        summary.clear();
+    }
+}
+
+// static
+size_t IndexRangeCache::GetBlockSummaryIndex(GLenum type, bool primitiveRestartEnabled)
+{
+    size_t typeIndex = 0;
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            typeIndex = 0;
+            break;
+        case GL_UNSIGNED_SHORT:
+            typeIndex = 1;
+            break;
+        case GL_UNSIGNED_INT:
+            typeIndex = 2;
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+    return typeIndex * 2 + (primitiveRestartEnabled ? 1 : 0);
+}
+
+IndexRangeCache::BlockSummary::BlockSummary() : mBlockCount(0), mLeafCount(0)
+{
+}
+
+IndexRangeCache::BlockSummary::~BlockSummary()
+{
+}
+
+void IndexRangeCache::BlockSummary::initialize(size_t blockCount)
+{
+    mBlockCount = blockCount;
+    mLeafCount  = 1;
+    while (mLeafCount < blockCount)
+    {
+        mLeafCount *= 2;
+    }
+
+    // Padding leaves past the end of the buffer are never queried. Mark them summarized so the
+    // nodes above them can become valid.
+    mNodes.resize(mLeafCount * 2);
+    for (size_t leaf = 0; leaf < mLeafCount; ++leaf)
+    {
+        mNodes[mLeafCount + leaf].range = IndexRange();
+        mNodes[mLeafCount + leaf].valid = (leaf >= blockCount);
+    }
+    for (size_t node = mLeafCount - 1; node > 0; --node)
+    {
+        mNodes[node].range = IndexRange();
+        mNodes[node].valid = mNodes[node * 2].valid && mNodes[node * 2 + 1].valid;
+    }
+}
+
+void IndexRangeCache::BlockSummary::clear()
+{
+    mBlockCount = 0;
+    mLeafCount  = 0;
+    mNodes.clear();
+}
+
+void IndexRangeCache::BlockSummary::getMissingBlocks(size_t firstBlock,
+                                                     size_t endBlock,
+                                                     std::vector<size_t> *missingBlocksOut) const
+{
+    ASSERT(endBlock <= mBlockCount);
+    if (firstBlock < endBlock)
+    {
+        collectMissingBlocks(1, 0, mLeafCount, firstBlock, endBlock, missingBlocksOut);
+    }
+}
+
+void IndexRangeCache::BlockSummary::collectMissingBlocks(
+    size_t node,
+    size_t nodeFirst,
+    size_t nodeEnd,
+    size_t firstBlock,
+    size_t endBlock,
+    std::vector<size_t> *missingBlocksOut) const
+{
+    if (mNodes[node].valid || nodeEnd <= firstBlock || nodeFirst >= endBlock)
+    {
+        return;
+    }
+
+    if (node >= mLeafCount)
+    {
+        missingBlocksOut->push_back(node - mLeafCount);
+        return;
+    }
+
+    size_t nodeMiddle = (nodeFirst + nodeEnd) / 2;
+    collectMissingBlocks(node * 2, nodeFirst, nodeMiddle, firstBlock, endBlock, missingBlocksOut);
+    collectMissingBlocks(node * 2 + 1, nodeMiddle, nodeEnd, firstBlock, endBlock,
+                         missingBlocksOut);
+}
+
+void IndexRangeCache::BlockSummary::setBlock(size_t block, const IndexRange &range, bool valid)
+{
+    if (block >= mBlockCount)
+    {
+        return;
+    }
+
+    size_t node        = mLeafCount + block;
+    mNodes[node].range = range;
+    mNodes[node].valid = valid;
+
+    for (node /= 2; node > 0; node /= 2)
+    {
+        const Node &left   = mNodes[node * 2];
+        const Node &right  = mNodes[node * 2 + 1];
+        mNodes[node].range = MergeIndexRanges(left.range, right.range);
+        mNodes[node].valid = left.valid && right.valid;
+    }
+}
+
+IndexRange IndexRangeCache::BlockSummary::getRange(size_t firstBlock, size_t endBlock) const
+{
+    ASSERT(firstBlock <= endBlock && endBlock <= mBlockCount);
+
+    IndexRange range;
+    size_t left  = mLeafCount + firstBlock;
+    size_t right = mLeafCount + endBlock;
+    while (left < right)
+    {
+        if (left & 1)
+        {
+            ASSERT(mNodes[left].valid);
+            range = MergeIndexRanges(range, mNodes[left++].range);
+        }
+        if (right & 1)
+        {
+            ASSERT(mNodes[right - 1].valid);
+            range = MergeIndexRanges(range, mNodes[--right].range);
+        }
+        left /= 2;
+        right /= 2;
+    }
+    return range;
 }
 
 IndexRangeCache::IndexRangeKey::IndexRangeKey()
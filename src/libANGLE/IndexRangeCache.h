@@ -15,11 +15,16 @@
 
 #include "angle_gl.h"
 
+#include <array>
 #include <map>
+#include <vector>
 
 namespace gl
 {
 
+// Combines the ranges of two disjoint sets of indices. Empty ranges are ignored.
+IndexRange MergeIndexRanges(const IndexRange &a, const IndexRange &b);
+
 class IndexRangeCache
 {
   public:
@@ -37,10 +42,72 @@ class IndexRangeCache
                    bool primitiveRestartEnabled,
                    IndexRange *outRange) const;
 
+    // Large queries are assembled from per-block summaries of the buffer contents, so that a
+    // query which misses the range cache only needs to scan the blocks that changed since they
+    // were last summarized, plus the partial blocks at either end of the range.
+    static constexpr size_t kBlockSize = 4096;
+
+    // Appends to missingBlocksOut the blocks in [firstBlock, endBlock) that have no summary.
+    // bufferSize is used to size the summaries the first time they are needed.
+    void getMissingBlocks(GLenum type,
+                          bool primitiveRestartEnabled,
+                          size_t bufferSize,
+                          size_t firstBlock,
+                          size_t endBlock,
+                          std::vector<size_t> *missingBlocksOut);
+    void setBlockRange(GLenum type,
+                       bool primitiveRestartEnabled,
+                       size_t block,
+                       const IndexRange &range);
+    IndexRange getBlocksRange(GLenum type,
+                              bool primitiveRestartEnabled,
+                              size_t firstBlock,
+                              size_t endBlock) const;
+
     void invalidateRange(size_t offset, size_t size);
     void clear();
 
   private:
+    // A segment tree over the blocks of the buffer. Each node holds the merged range of its
+    // blocks and whether all of them are summarized, so queries and updates touch O(log n) nodes.
+    class BlockSummary final
+    {
+      public:
+        BlockSummary();
+        ~BlockSummary();
+
+        bool empty() const { return mNodes.empty(); }
+        void initialize(size_t blockCount);
+        void clear();
+
+        void getMissingBlocks(size_t firstBlock,
+                              size_t endBlock,
+                              std::vector<size_t> *missingBlocksOut) const;
+        void setBlock(size_t block, const IndexRange &range, bool valid);
+        IndexRange getRange(size_t firstBlock, size_t endBlock) const;
+
+      private:
+        struct Node
+        {
+            IndexRange range;
+            bool valid;
+        };
+
+        void collectMissingBlocks(size_t node,
+                                  size_t nodeFirst,
+                                  size_t nodeEnd,
+                                  size_t firstBlock,
+                                  size_t endBlock,
+                                  std::vector<size_t> *missingBlocksOut) const;
+
+        size_t mBlockCount;
+        size_t mLeafCount;
+        std::vector<Node> mNodes;
+    };
+
+    // Summaries are indexed by index type and primitive restart state.
+    static size_t GetBlockSummaryIndex(GLenum type, bool primitiveRestartEnabled);
+
     struct IndexRangeKey
     {
         IndexRangeKey();
@@ -56,6 +123,8 @@ class IndexRangeCache
 
     typedef std::map<IndexRangeKey, IndexRange> IndexRangeMap;
     IndexRangeMap mIndexRangeCache;
+
+    std::array<BlockSummary, 6> mBlockSummaries;
 };
 
 }
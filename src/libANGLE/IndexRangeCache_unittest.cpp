@@ -0,0 +1,114 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCache_unittest.cpp: Unit tests of the IndexRangeCache class.
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/IndexRangeCache.h"
+
+namespace
+{
+
+constexpr size_t kBlockSize = gl::IndexRangeCache::kBlockSize;
+
+// Summarize every block of a buffer holding blockCount blocks, where block N holds indices in
+// [N, N + 10].
+void FillBlocks(gl::IndexRangeCache *cache, size_t blockCount)
+{
+    std::vector<size_t> missingBlocks;
+    cache->getMissingBlocks(GL_UNSIGNED_SHORT, false, blockCount * kBlockSize, 0, blockCount,
+                            &missingBlocks);
+    for (size_t block : missingBlocks)
+    {
+        cache->setBlockRange(GL_UNSIGNED_SHORT, false, block,
+                             gl::IndexRange(block, block + 10, kBlockSize / 2));
+    }
+}
+
+// Test that all blocks start out missing, and that summarized blocks are merged correctly.
+TEST(IndexRangeCacheTest, BlockSummaries)
+{
+    gl::IndexRangeCache cache;
+
+    std::vector<size_t> missingBlocks;
+    cache.getMissingBlocks(GL_UNSIGNED_SHORT, false, 13 * kBlockSize, 2, 7, &missingBlocks);
+    EXPECT_EQ((std::vector<size_t>{2, 3, 4, 5, 6}), missingBlocks);
+
+    FillBlocks(&cache, 13);
+
+    missingBlocks.clear();
+    cache.getMissingBlocks(GL_UNSIGNED_SHORT, false, 13 * kBlockSize, 0, 13, &missingBlocks);
+    EXPECT_TRUE(missingBlocks.empty());
+
+    gl::IndexRange range = cache.getBlocksRange(GL_UNSIGNED_SHORT, false, 3, 9);
+    EXPECT_EQ(3u, range.start);
+    EXPECT_EQ(18u, range.end);
+    EXPECT_EQ(6 * kBlockSize / 2, range.vertexIndexCount);
+
+    range = cache.getBlocksRange(GL_UNSIGNED_SHORT, false, 12, 13);
+    EXPECT_EQ(12u, range.start);
+    EXPECT_EQ(22u, range.end);
+
+    // Summaries are kept separately per index type and primitive restart state.
+    missingBlocks.clear();
+    cache.getMissingBlocks(GL_UNSIGNED_SHORT, true, 13 * kBlockSize, 0, 2, &missingBlocks);
+    EXPECT_EQ((std::vector<size_t>{0, 1}), missingBlocks);
+}
+
+// Test that invalidating part of the buffer only drops the summaries of the blocks it touches.
+TEST(IndexRangeCacheTest, InvalidateBlocks)
+{
+    gl::IndexRangeCache cache;
+    FillBlocks(&cache, 16);
+
+    cache.invalidateRange(5 * kBlockSize + 100, kBlockSize);
+
+    std::vector<size_t> missingBlocks;
+    cache.getMissingBlocks(GL_UNSIGNED_SHORT, false, 16 * kBlockSize, 0, 16, &missingBlocks);
+    EXPECT_EQ((std::vector<size_t>{5, 6}), missingBlocks);
+
+    // Ranges that don't include the invalidated blocks are still available.
+    gl::IndexRange range = cache.getBlocksRange(GL_UNSIGNED_SHORT, false, 7, 16);
+    EXPECT_EQ(7u, range.start);
+    EXPECT_EQ(25u, range.end);
+
+    cache.setBlockRange(GL_UNSIGNED_SHORT, false, 5, gl::IndexRange(1000, 2000, 3));
+    cache.setBlockRange(GL_UNSIGNED_SHORT, false, 6, gl::IndexRange());
+
+    range = cache.getBlocksRange(GL_UNSIGNED_SHORT, false, 4, 8);
+    EXPECT_EQ(4u, range.start);
+    EXPECT_EQ(2000u, range.end);
+    EXPECT_EQ(2 * kBlockSize / 2 + 3, range.vertexIndexCount);
+
+    // Clearing drops all summaries.
+    cache.clear();
+    missingBlocks.clear();
+    cache.getMissingBlocks(GL_UNSIGNED_SHORT, false, 16 * kBlockSize, 0, 16, &missingBlocks);
+    EXPECT_EQ(16u, missingBlocks.size());
+}
+
+// Test merging ranges where one or both are empty.
+TEST(IndexRangeCacheTest, MergeIndexRanges)
+{
+    gl::IndexRange empty;
+    gl::IndexRange a(3, 8, 4);
+    gl::IndexRange b(1, 5, 2);
+
+    gl::IndexRange merged = gl::MergeIndexRanges(empty, a);
+    EXPECT_EQ(3u, merged.start);
+    EXPECT_EQ(8u, merged.end);
+    EXPECT_EQ(4u, merged.vertexIndexCount);
+
+    merged = gl::MergeIndexRanges(a, b);
+    EXPECT_EQ(1u, merged.start);
+    EXPECT_EQ(8u, merged.end);
+    EXPECT_EQ(6u, merged.vertexIndexCount);
+
+    merged = gl::MergeIndexRanges(empty, empty);
+    EXPECT_EQ(0u, merged.vertexIndexCount);
+}
+
+}  // anonymous namespace
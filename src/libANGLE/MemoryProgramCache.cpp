@@ -5,7 +5,7 @@
 //
 // MemoryProgramCache: Stores compiled and linked programs in memory so they don't
 //   always have to be re-compiled. Can be used in conjunction with the platform
-//   layer to warm up the cache from disk.
+//   layer or a DiskProgramCache to warm up the cache from disk.
 
 #include "libANGLE/MemoryProgramCache.h"
 
@@ -16,6 +16,7 @@
 #include "common/version.h"
 #include "libANGLE/BinaryStream.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/DiskProgramCache.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/ProgramImpl.h"
@@ -662,7 +663,7 @@ LinkResult MemoryProgramCache::getProgram(const Context *context,
 bool MemoryProgramCache::get(const ProgramHash &programHash, const angle::MemoryBuffer **programOut)
 {
     const CacheEntry *entry = nullptr;
-    if (!mProgramBinaryCache.get(programHash, &entry))
+    if (!mProgramBinaryCache.get(programHash, &entry) && !getFromDiskCache(programHash, &entry))
     {
         ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheMiss,
                                     kCacheResultMax);
@@ -698,10 +699,36 @@ bool MemoryProgramCache::getAt(size_t index,
     return true;
 }
 
+bool MemoryProgramCache::getFromDiskCache(const ProgramHash &programHash,
+                                          const CacheEntry **entryOut)
+{
+    if (!mDiskCache)
+    {
+        return false;
+    }
+
+    CacheEntry newEntry;
+    if (!mDiskCache->get(programHash, &newEntry.first))
+    {
+        return false;
+    }
+    newEntry.second = CacheSource::PutBinary;
+
+    size_t length = newEntry.first.size();
+    *entryOut     = mProgramBinaryCache.put(programHash, std::move(newEntry), length);
+    return *entryOut != nullptr;
+}
+
 void MemoryProgramCache::remove(const ProgramHash &programHash)
 {
     bool result = mProgramBinaryCache.eraseByKey(programHash);
     ASSERT(result);
+
+    // The binary may have come from disk, where it would fail to load again.
+    if (mDiskCache)
+    {
+        mDiskCache->remove(programHash);
+    }
 }
 
 void MemoryProgramCache::putProgram(const ProgramHash &programHash,
@@ -725,6 +752,11 @@ void MemoryProgramCache::putProgram(const ProgramHash &programHash,
     {
         auto *platform = ANGLEPlatformCurrent();
         platform->cacheProgram(platform, programHash, result->first.size(), result->first.data());
+
+        if (mDiskCache)
+        {
+            mDiskCache->put(programHash, result->first.data(), result->first.size());
+        }
     }
 }
 
@@ -753,6 +785,43 @@ void MemoryProgramCache::putBinary(const ProgramHash &programHash,
     }
 }
 
+void MemoryProgramCache::putBackendData(const ProgramHash &dataHash,
+                                        const uint8_t *data,
+                                        size_t length)
+{
+    CacheEntry newEntry;
+    if (!newEntry.first.resize(length))
+    {
+        return;
+    }
+    memcpy(newEntry.first.data(), data, length);
+    newEntry.second = CacheSource::PutBinary;
+
+    // The memory cache is often disabled, in which case only the disk cache keeps the data.
+    mProgramBinaryCache.put(dataHash, std::move(newEntry), length);
+
+    if (mDiskCache)
+    {
+        mDiskCache->put(dataHash, data, length);
+    }
+}
+
+bool MemoryProgramCache::getBackendData(const ProgramHash &dataHash, angle::MemoryBuffer *dataOut)
+{
+    const CacheEntry *entry = nullptr;
+    if (mProgramBinaryCache.get(dataHash, &entry))
+    {
+        if (!dataOut->resize(entry->first.size()))
+        {
+            return false;
+        }
+        memcpy(dataOut->data(), entry->first.data(), entry->first.size());
+        return true;
+    }
+
+    return mDiskCache && mDiskCache->get(dataHash, dataOut);
+}
+
 void MemoryProgramCache::clear()
 {
     mProgramBinaryCache.clear();
@@ -784,4 +853,21 @@ size_t MemoryProgramCache::maxSize() const
     return mProgramBinaryCache.maxSize();
 }
 
+bool MemoryProgramCache::enableDiskCache(const std::string &directory, size_t maxCacheSizeBytes)
+{
+    mDiskCache.reset(new DiskProgramCache(directory, maxCacheSizeBytes));
+    if (!mDiskCache->initialize())
+    {
+        mDiskCache.reset();
+        return false;
+    }
+    return true;
+}
+
+void MemoryProgramCache::disableDiskCache()
+{
+    // Destroying the disk cache writes out its index.
+    mDiskCache.reset();
+}
+
 }  // namespace gl
@@ -5,12 +5,14 @@
 //
 // MemoryProgramCache: Stores compiled and linked programs in memory so they don't
 //   always have to be re-compiled. Can be used in conjunction with the platform
-//   layer to warm up the cache from disk.
+//   layer or a DiskProgramCache to warm up the cache from disk.
 
 #ifndef LIBANGLE_MEMORY_PROGRAM_CACHE_H_
 #define LIBANGLE_MEMORY_PROGRAM_CACHE_H_
 
 #include <array>
+#include <memory>
+#include <string>
 
 #include "common/MemoryBuffer.h"
 #include "libANGLE/Error.h"
@@ -45,6 +47,7 @@ struct hash<gl::ProgramHash>
 namespace gl
 {
 class Context;
+class DiskProgramCache;
 class InfoLog;
 class Program;
 class ProgramState;
@@ -88,6 +91,13 @@ class MemoryProgramCache final : angle::NonCopyable
     // Store a binary directly.
     void putBinary(const ProgramHash &programHash, const uint8_t *binary, size_t length);
 
+    // Stores data that a backend keeps with its programs, like the Vulkan pipeline cache. Unlike
+    // putBinary, the data is written through to the disk cache, even if it doesn't fit in memory.
+    void putBackendData(const ProgramHash &dataHash, const uint8_t *data, size_t length);
+
+    // Copies data stored with putBackendData, which is looked up in memory and then on disk.
+    bool getBackendData(const ProgramHash &dataHash, angle::MemoryBuffer *dataOut);
+
     // Check the cache, and deserialize and load the program if found. Evict existing hash if load
     // fails.
     LinkResult getProgram(const Context *context,
@@ -113,6 +123,14 @@ class MemoryProgramCache final : angle::NonCopyable
     // Returns the maximum cache size in bytes.
     size_t maxSize() const;
 
+    // Backs the cache with a directory so programs survive the process. Programs stored with
+    // putProgram are written through, and misses are looked up on disk. Returns false if the
+    // directory can't be used.
+    bool enableDiskCache(const std::string &directory, size_t maxCacheSizeBytes);
+
+    // Writes out the disk cache's index and stops using it. Does not remove anything from disk.
+    void disableDiskCache();
+
   private:
     enum class CacheSource
     {
@@ -121,8 +139,12 @@ class MemoryProgramCache final : angle::NonCopyable
     };
 
     using CacheEntry = std::pair<angle::MemoryBuffer, CacheSource>;
+
+    bool getFromDiskCache(const ProgramHash &programHash, const CacheEntry **entryOut);
+
     angle::SizedMRUCache<ProgramHash, CacheEntry> mProgramBinaryCache;
     unsigned int mIssuedWarnings;
+    std::unique_ptr<DiskProgramCache> mDiskCache;
 };
 
 }  // namespace gl
@@ -23,6 +23,7 @@
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/VaryingPacking.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/features.h"
 #include "libANGLE/histogram_macros.h"
 #include "libANGLE/queryconversions.h"
@@ -654,6 +655,39 @@ GLuint ProgramState::getAttributeLocation(const std::string &name) const
     return static_cast<GLuint>(-1);
 }
 
+// The part of a link that is carried over from Program::link to Program::resolveLink.
+struct Program::LinkingState
+{
+    const Context *context;
+    ProgramHash programHash;
+    double startTime;
+
+    std::unique_ptr<ProgramLinkedResources> resources;
+    ProgramMergedVaryings mergedVaryings;
+
+    std::unique_ptr<LinkTask> linkTask;
+    angle::WaitableEvent linkEvent;
+    bool linkTaskPosted;
+};
+
+class Program::LinkTask final : public angle::Closure
+{
+  public:
+    LinkTask(Program *program, LinkingState *linkingState)
+        : mProgram(program), mLinkingState(linkingState), mSuccess(false)
+    {
+    }
+
+    void operator()() override { mSuccess = mProgram->linkShaderInterfaces(mLinkingState); }
+
+    bool getSuccess() const { return mSuccess; }
+
+  private:
+    Program *mProgram;
+    LinkingState *mLinkingState;
+    bool mSuccess;
+};
+
 Program::Program(rx::GLImplFactory *factory, ShaderProgramManager *manager, GLuint handle)
     : mProgram(factory->createProgram(mState)),
       mValidated(false),
@@ -675,6 +709,13 @@ Program::~Program()
 
 void Program::onDestroy(const Context *context)
 {
+    // A link in flight still reads from the attached shaders. Its results are discarded.
+    if (mLinkingState && mLinkingState->linkTaskPosted)
+    {
+        mLinkingState->linkEvent.wait();
+    }
+    mLinkingState.reset();
+
     if (mState.mAttachedVertexShader != nullptr)
     {
         mState.mAttachedVertexShader->release(context);
@@ -891,7 +932,8 @@ void Program::pathFragmentInputGen(const Context *context,
 // The code gets compiled into binaries.
 Error Program::link(const gl::Context *context)
 {
-    const auto &data = context->getContextState();
+    // Programs are only linked through a handle lookup, which resolves any earlier link.
+    ASSERT(!mLinkingState);
 
     auto *platform   = ANGLEPlatformCurrent();
     double startTime = platform->currentTime(platform);
@@ -918,112 +960,194 @@ Error Program::link(const gl::Context *context)
     unlink();
     mInfoLog.reset();
 
-    if (!linkValidateShaders(context, mInfoLog))
+    mLinkingState.reset(new LinkingState());
+    mLinkingState->context        = context;
+    mLinkingState->programHash    = programHash;
+    mLinkingState->startTime      = startTime;
+    mLinkingState->linkTaskPosted = false;
+    mLinkingState->linkTask.reset(new LinkTask(this, mLinkingState.get()));
+
+    // A program that is in use installs its new executable right away, so it can't link in the
+    // background.
+    angle::WorkerThreadPool *workerPool = context->getShaderCompileThreadPool();
+    if (workerPool && mRefCount == 0)
     {
+        mLinkingState->linkEvent      = workerPool->postWorkerTask(mLinkingState->linkTask.get());
+        mLinkingState->linkTaskPosted = true;
         return NoError();
     }
 
+    return resolveLinkImpl();
+}
+
+bool Program::isLinking() const
+{
+    return mLinkingState && mLinkingState->linkTaskPosted && !mLinkingState->linkEvent.isReady();
+}
+
+void Program::resolveLink()
+{
+    if (!mLinkingState)
+    {
+        return;
+    }
+
+    // There is no GL call left to report a back-end error on, so it fails the link instead.
+    Error error = resolveLinkImpl();
+    if (error.isError())
+    {
+        mInfoLog << error.getMessage();
+        mLinked = false;
+    }
+}
+
+// May run on a worker thread. Waits for the translations of the attached shaders, matches up their
+// variables and packs the varyings. Only writes to mState, mInfoLog and the linking state, none of
+// which the GL thread reads until the link is resolved.
+bool Program::linkShaderInterfaces(LinkingState *linkingState)
+{
+    const Context *context = linkingState->context;
+    const auto &data       = context->getContextState();
+
+    if (!linkValidateShaders(context, mInfoLog))
+    {
+        return false;
+    }
+
     if (mState.mAttachedComputeShader)
     {
         if (!linkUniforms(context, mInfoLog, mUniformLocationBindings))
         {
-            return NoError();
+            return false;
         }
 
         if (!linkInterfaceBlocks(context, mInfoLog))
         {
-            return NoError();
+            return false;
         }
 
-        ProgramLinkedResources resources = {
+        linkingState->resources.reset(new ProgramLinkedResources{
             {0, PackMode::ANGLE_RELAXED},
             {&mState.mUniformBlocks, &mState.mUniforms},
             {&mState.mShaderStorageBlocks, &mState.mBufferVariables},
-            {&mState.mAtomicCounterBuffers}};
+            {&mState.mAtomicCounterBuffers}});
 
-        InitUniformBlockLinker(context, mState, &resources.uniformBlockLinker);
-        InitShaderStorageBlockLinker(context, mState, &resources.shaderStorageBlockLinker);
+        InitUniformBlockLinker(context, mState, &linkingState->resources->uniformBlockLinker);
+        InitShaderStorageBlockLinker(context, mState,
+                                     &linkingState->resources->shaderStorageBlockLinker);
+        return true;
+    }
 
-        ANGLE_TRY_RESULT(mProgram->link(context, resources, mInfoLog), mLinked);
-        if (!mLinked)
-        {
-            return NoError();
-        }
+    if (!linkAttributes(context, mInfoLog))
+    {
+        return false;
     }
-    else
+
+    if (!linkVaryings(context, mInfoLog))
     {
-        if (!linkAttributes(context, mInfoLog))
-        {
-            return NoError();
-        }
+        return false;
+    }
 
-        if (!linkVaryings(context, mInfoLog))
-        {
-            return NoError();
-        }
+    if (!linkUniforms(context, mInfoLog, mUniformLocationBindings))
+    {
+        return false;
+    }
 
-        if (!linkUniforms(context, mInfoLog, mUniformLocationBindings))
-        {
-            return NoError();
-        }
+    if (!linkInterfaceBlocks(context, mInfoLog))
+    {
+        return false;
+    }
 
-        if (!linkInterfaceBlocks(context, mInfoLog))
-        {
-            return NoError();
-        }
+    if (!linkValidateGlobalNames(context, mInfoLog))
+    {
+        return false;
+    }
 
-        if (!linkValidateGlobalNames(context, mInfoLog))
-        {
-            return NoError();
-        }
+    linkingState->mergedVaryings = getMergedVaryings(context);
 
-        const auto &mergedVaryings = getMergedVaryings(context);
+    ASSERT(mState.mAttachedVertexShader);
+    mState.mNumViews = mState.mAttachedVertexShader->getNumViews(context);
 
-        ASSERT(mState.mAttachedVertexShader);
-        mState.mNumViews = mState.mAttachedVertexShader->getNumViews(context);
+    linkOutputVariables(context);
 
-        linkOutputVariables(context);
+    // Map the varyings to the register file
+    // In WebGL, we use a slightly different handling for packing variables.
+    gl::PackMode packMode = PackMode::ANGLE_RELAXED;
+    if (data.getLimitations().noFlexibleVaryingPacking)
+    {
+        // D3D9 pack mode is strictly more strict than WebGL, so takes priority.
+        packMode = PackMode::ANGLE_NON_CONFORMANT_D3D9;
+    }
+    else if (data.getExtensions().webglCompatibility)
+    {
+        packMode = PackMode::WEBGL_STRICT;
+    }
 
-        // Map the varyings to the register file
-        // In WebGL, we use a slightly different handling for packing variables.
-        gl::PackMode packMode = PackMode::ANGLE_RELAXED;
-        if (data.getLimitations().noFlexibleVaryingPacking)
-        {
-            // D3D9 pack mode is strictly more strict than WebGL, so takes priority.
-            packMode = PackMode::ANGLE_NON_CONFORMANT_D3D9;
-        }
-        else if (data.getExtensions().webglCompatibility)
-        {
-            packMode = PackMode::WEBGL_STRICT;
-        }
+    linkingState->resources.reset(new ProgramLinkedResources{
+        {data.getCaps().maxVaryingVectors, packMode},
+        {&mState.mUniformBlocks, &mState.mUniforms},
+        {&mState.mShaderStorageBlocks, &mState.mBufferVariables},
+        {&mState.mAtomicCounterBuffers}});
 
-        ProgramLinkedResources resources = {
-            {data.getCaps().maxVaryingVectors, packMode},
-            {&mState.mUniformBlocks, &mState.mUniforms},
-            {&mState.mShaderStorageBlocks, &mState.mBufferVariables},
-            {&mState.mAtomicCounterBuffers}};
+    ProgramLinkedResources &resources = *linkingState->resources;
+    InitUniformBlockLinker(context, mState, &resources.uniformBlockLinker);
+    InitShaderStorageBlockLinker(context, mState, &resources.shaderStorageBlockLinker);
+
+    if (!linkValidateTransformFeedback(context, mInfoLog, linkingState->mergedVaryings,
+                                       context->getCaps()))
+    {
+        return false;
+    }
 
-        InitUniformBlockLinker(context, mState, &resources.uniformBlockLinker);
-        InitShaderStorageBlockLinker(context, mState, &resources.shaderStorageBlockLinker);
+    return resources.varyingPacking.collectAndPackUserVaryings(
+        mInfoLog, linkingState->mergedVaryings, mState.getTransformFeedbackVaryingNames());
+}
 
-        if (!linkValidateTransformFeedback(context, mInfoLog, mergedVaryings, context->getCaps()))
-        {
-            return NoError();
-        }
+// Runs on the GL thread. Waits for the linking done by linkShaderInterfaces, then links the
+// back-end and fills in the rest of the program state.
+Error Program::resolveLinkImpl()
+{
+    ASSERT(mLinkingState);
+    std::unique_ptr<LinkingState> linkingState = std::move(mLinkingState);
 
-        if (!resources.varyingPacking.collectAndPackUserVaryings(
-                mInfoLog, mergedVaryings, mState.getTransformFeedbackVaryingNames()))
-        {
-            return NoError();
-        }
+    if (linkingState->linkTaskPosted)
+    {
+        linkingState->linkEvent.wait();
+    }
+    else
+    {
+        (*linkingState->linkTask)();
+    }
+
+    if (!linkingState->linkTask->getSuccess())
+    {
+        return NoError();
+    }
+
+    const Context *context = linkingState->context;
 
-        ANGLE_TRY_RESULT(mProgram->link(context, resources, mInfoLog), mLinked);
-        if (!mLinked)
+    // The link task only waited for the translations of the shaders. The back-end part of their
+    // compiles has to be resolved on the GL thread, before the back-end links them.
+    for (Shader *shader : {mState.mAttachedVertexShader, mState.mAttachedFragmentShader,
+                           mState.mAttachedComputeShader, mState.mAttachedGeometryShader})
+    {
+        if (shader && !shader->isCompiled(context))
         {
+            mInfoLog << "Attached " << GetShaderTypeString(shader->getType())
+                     << " shader is not compiled.";
             return NoError();
         }
+    }
 
-        gatherTransformFeedbackVaryings(mergedVaryings);
+    ANGLE_TRY_RESULT(mProgram->link(context, *linkingState->resources, mInfoLog), mLinked);
+    if (!mLinked)
+    {
+        return NoError();
+    }
+
+    if (!mState.mAttachedComputeShader)
+    {
+        gatherTransformFeedbackVaryings(linkingState->mergedVaryings);
     }
 
     initInterfaceBlockBindings();
@@ -1039,14 +1163,16 @@ Error Program::link(const gl::Context *context)
     mProgram->markUnusedUniformLocations(&mState.mUniformLocations, &mState.mSamplerBindings);
 
     // Save to the program cache.
+    auto *cache = context->getMemoryProgramCache();
     if (cache && (mState.mLinkedTransformFeedbackVaryings.empty() ||
                   !context->getWorkarounds().disableProgramCachingForTransformFeedback))
     {
-        cache->putProgram(programHash, context, this);
+        cache->putProgram(linkingState->programHash, context, this);
     }
 
-    double delta = platform->currentTime(platform) - startTime;
-    int us       = static_cast<int>(delta * 1000000.0);
+    auto *platform = ANGLEPlatformCurrent();
+    double delta   = platform->currentTime(platform) - linkingState->startTime;
+    int us         = static_cast<int>(delta * 1000000.0);
     ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.ProgramCache.ProgramCacheMissTimeUS", us);
 
     return NoError();
@@ -2081,7 +2207,7 @@ bool Program::linkValidateShaders(const Context *context, InfoLog &infoLog)
 
     if (computeShader)
     {
-        if (!computeShader->isCompiled(context))
+        if (!computeShader->waitForTranslation())
         {
             infoLog << "Attached compute shader is not compiled.";
             return false;
@@ -2100,14 +2226,14 @@ bool Program::linkValidateShaders(const Context *context, InfoLog &infoLog)
     }
     else
     {
-        if (!fragmentShader || !fragmentShader->isCompiled(context))
+        if (!fragmentShader || !fragmentShader->waitForTranslation())
         {
             infoLog << "No compiled fragment shader when at least one graphics shader is attached.";
             return false;
         }
         ASSERT(fragmentShader->getType() == GL_FRAGMENT_SHADER);
 
-        if (!vertexShader || !vertexShader->isCompiled(context))
+        if (!vertexShader || !vertexShader->waitForTranslation())
         {
             infoLog << "No compiled vertex shader when at least one graphics shader is attached.";
             return false;
@@ -15,6 +15,7 @@
 
 #include <array>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
@@ -492,6 +493,11 @@ class Program final : angle::NonCopyable, public LabeledObject
     Error link(const gl::Context *context);
     bool isLinked() const;
 
+    // Link posts most of its work to the worker pool. Looking up the program by handle resolves
+    // the link, so the accessors below only ever see finished links. isLinking doesn't block.
+    bool isLinking() const;
+    void resolveLink();
+
     bool hasLinkedVertexShader() const { return mState.mLinkedShaderStages[SHADER_VERTEX]; }
     bool hasLinkedFragmentShader() const { return mState.mLinkedShaderStages[SHADER_FRAGMENT]; }
     bool hasLinkedComputeShader() const { return mState.mLinkedShaderStages[SHADER_COMPUTE]; }
@@ -687,8 +693,14 @@ class Program final : angle::NonCopyable, public LabeledObject
   private:
     ~Program() override;
 
+    struct LinkingState;
+    class LinkTask;
+
     void unlink();
 
+    bool linkShaderInterfaces(LinkingState *linkingState);
+    Error resolveLinkImpl();
+
     bool linkValidateShaders(const Context *context, InfoLog &infoLog);
     bool linkAttributes(const Context *context, InfoLog &infoLog);
     static bool ValidateGraphicsInterfaceBlocks(
@@ -789,6 +801,8 @@ class Program final : angle::NonCopyable, public LabeledObject
 
     InfoLog mInfoLog;
 
+    std::unique_ptr<LinkingState> mLinkingState;
+
     // Cache for sampler validation
     Optional<bool> mCachedValidateSamplersResult;
     std::vector<GLenum> mTextureUnitTypesCache;
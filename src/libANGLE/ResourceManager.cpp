@@ -193,10 +193,47 @@ void ShaderProgramManager::deleteProgram(const gl::Context *context, GLuint prog
 }
 
 Program *ShaderProgramManager::getProgram(GLuint handle) const
+{
+    Program *program = mPrograms.query(handle);
+    if (program)
+    {
+        program->resolveLink();
+    }
+    return program;
+}
+
+Program *ShaderProgramManager::getProgramNoResolveLink(GLuint handle) const
 {
     return mPrograms.query(handle);
 }
 
+void ShaderProgramManager::resolveLinksUsingShader(const Shader *shader) const
+{
+    for (const auto &program : mPrograms)
+    {
+        Program *programObject = program.second;
+        if (programObject &&
+            (programObject->getAttachedVertexShader() == shader ||
+             programObject->getAttachedFragmentShader() == shader ||
+             programObject->getAttachedComputeShader() == shader ||
+             programObject->getAttachedGeometryShader() == shader))
+        {
+            programObject->resolveLink();
+        }
+    }
+}
+
+void ShaderProgramManager::resolveAllLinks() const
+{
+    for (const auto &program : mPrograms)
+    {
+        if (program.second)
+        {
+            program.second->resolveLink();
+        }
+    }
+}
+
 template <typename ObjectType>
 void ShaderProgramManager::deleteObject(const Context *context,
                                         ResourceMap<ObjectType> *objectMap,
@@ -138,6 +138,15 @@ class ShaderProgramManager : public ResourceManagerBase<HandleAllocator>
     void deleteProgram(const Context *context, GLuint program);
     Program *getProgram(GLuint handle) const;
 
+    // Skips resolving a link running in the background, for queries that must not block on it.
+    Program *getProgramNoResolveLink(GLuint handle) const;
+
+    // Finishes the background links that read from the shader, before it's recompiled.
+    void resolveLinksUsingShader(const Shader *shader) const;
+
+    // Finishes every background link, before a context they were started on goes away.
+    void resolveAllLinks() const;
+
   protected:
     ~ShaderProgramManager() override;
 
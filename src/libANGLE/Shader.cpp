@@ -10,6 +10,8 @@
 
 #include "libANGLE/Shader.h"
 
+#include <condition_variable>
+#include <mutex>
 #include <sstream>
 
 #include "common/utilities.h"
@@ -52,6 +54,61 @@ const std::vector<VarT> &GetShaderVariables(const std::vector<VarT> *variableLis
 
 }  // anonymous namespace
 
+// The translation is run by whichever thread gets to it first: the worker pool, the GL thread
+// resolving the compile, or a link that needs the shader's variables. The others wait for it.
+class Shader::CompileTask final : public angle::Closure
+{
+  public:
+    CompileTask(Shader *shader) : mShader(shader), mProgress(Progress::Pending), mSuccess(false)
+    {
+    }
+
+    void operator()() override { runOrWait(); }
+
+    // Returns whether the translation succeeded. May be called from any thread.
+    bool runOrWait()
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            if (mProgress != Progress::Pending)
+            {
+                mDoneCondition.wait(lock, [this] { return mProgress == Progress::Done; });
+                return mSuccess;
+            }
+            mProgress = Progress::Running;
+        }
+
+        bool success = mShader->translate();
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        mSuccess  = success;
+        mProgress = Progress::Done;
+        mDoneCondition.notify_all();
+        return success;
+    }
+
+    bool isDone()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mProgress == Progress::Done;
+    }
+
+  private:
+    enum class Progress
+    {
+        Pending,
+        Running,
+        Done,
+    };
+
+    Shader *mShader;
+
+    std::mutex mMutex;
+    std::condition_variable mDoneCondition;
+    Progress mProgress;
+    bool mSuccess;
+};
+
 // true if varying x has a higher priority in packing than y
 bool CompareShaderVar(const sh::ShaderVariable &x, const sh::ShaderVariable &y)
 {
@@ -126,6 +183,8 @@ Shader::Shader(ShaderProgramManager *manager,
       mType(type),
       mRefCount(0),
       mDeleteStatus(false),
+      mCompilerHandle(nullptr),
+      mCompileTaskPosted(false),
       mResourceManager(manager)
 {
     ASSERT(mImplementation);
@@ -133,6 +192,10 @@ Shader::Shader(ShaderProgramManager *manager,
 
 void Shader::onDestroy(const gl::Context *context)
 {
+    waitForCompileTask();
+    mCompileTask.reset();
+    releaseCompilerHandle();
+
     mBoundCompiler.set(context, nullptr);
     mImplementation.reset(nullptr);
     delete this;
@@ -291,6 +354,12 @@ void Shader::getTranslatedSourceWithDebugInfo(const Context *context,
 
 void Shader::compile(const Context *context)
 {
+    // A translation still in flight writes to the shader state, so it must finish before the
+    // state is reset. Its results are discarded.
+    waitForCompileTask();
+    mCompileTask.reset();
+    releaseCompilerHandle();
+
     mState.mTranslatedSource.clear();
     mInfoLog.clear();
     mState.mShaderVersion = 100;
@@ -336,37 +405,70 @@ void Shader::compile(const Context *context)
     {
         mLastCompileOptions |= SH_VALIDATE_LOOP_INDEXING;
     }
+
+    // Without a worker pool, the translation waits until its results are needed.
+    mCompileTask.reset(new CompileTask(this));
+
+    angle::WorkerThreadPool *workerPool = context->getShaderCompileThreadPool();
+    if (workerPool)
+    {
+        mCompileEvent      = workerPool->postWorkerTask(mCompileTask.get());
+        mCompileTaskPosted = true;
+    }
 }
 
-void Shader::resolveCompile(const Context *context)
+void Shader::waitForCompileTask()
 {
-    if (!mState.compilePending())
+    if (mCompileTaskPosted)
     {
-        return;
+        mCompileEvent.wait();
+        mCompileTaskPosted = false;
     }
+}
 
-    ASSERT(mBoundCompiler.get());
-    ShHandle compilerHandle = mBoundCompiler->getCompilerHandle(mState.mShaderType);
+void Shader::releaseCompilerHandle()
+{
+    if (mCompilerHandle)
+    {
+        ASSERT(mBoundCompiler.get());
+        mBoundCompiler->putCompilerHandle(mState.mShaderType, mCompilerHandle);
+        mCompilerHandle = nullptr;
+    }
+}
 
-    std::vector<const char *> srcStrings;
+bool Shader::isCompleted()
+{
+    // Compiles that weren't posted to the worker pool are resolved on the next blocking query.
+    return !mState.compilePending() || !mCompileTaskPosted || mCompileTask->isDone();
+}
 
-    if (!mLastCompiledSourcePath.empty())
+bool Shader::waitForTranslation()
+{
+    // mCompileTask is only replaced by compile() and onDestroy(), which don't run while a link
+    // reads from the shader.
+    return mCompileTask && mCompileTask->runOrWait();
+}
+
+void Shader::resolveCompile(const Context *context)
+{
+    if (!mState.compilePending())
     {
-        srcStrings.push_back(mLastCompiledSourcePath.c_str());
+        return;
     }
 
-    srcStrings.push_back(mLastCompiledSource.c_str());
+    // The task is kept until the next compile, since the worker pool can still hold on to it if
+    // another thread ran the translation first.
+    ASSERT(mCompileTask);
+    bool translated = mCompileTask->runOrWait();
 
-    if (!sh::Compile(compilerHandle, &srcStrings[0], srcStrings.size(), mLastCompileOptions))
+    if (!translated)
     {
-        mInfoLog = sh::GetInfoLog(compilerHandle);
+        releaseCompilerHandle();
         WARN() << std::endl << mInfoLog;
         mState.mCompileStatus = CompileStatus::NOT_COMPILED;
         return;
     }
 
-    mState.mTranslatedSource = sh::GetObjectCode(compilerHandle);
-
 #if !defined(NDEBUG)
     // Prefix translated shader with commented out un-translated shader.
     // Useful in diagnostics tools which capture the shader source.
@@ -388,6 +490,38 @@ void Shader::resolveCompile(const Context *context)
     mState.mTranslatedSource = shaderStream.str();
 #endif  // !defined(NDEBUG)
 
+    bool success =
+        mImplementation->postTranslateCompile(mBoundCompiler.get(), mCompilerHandle, &mInfoLog);
+    releaseCompilerHandle();
+    mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+}
+
+// May run on a worker thread. Only touches the translated outputs of mState, which are not read
+// until the translation is done, and the compiler handle, which no other shader uses while it is
+// checked out.
+bool Shader::translate()
+{
+    ASSERT(!mCompilerHandle);
+    mCompilerHandle         = mBoundCompiler->getCompilerHandle(mState.mShaderType);
+    ShHandle compilerHandle = mCompilerHandle;
+
+    std::vector<const char *> srcStrings;
+
+    if (!mLastCompiledSourcePath.empty())
+    {
+        srcStrings.push_back(mLastCompiledSourcePath.c_str());
+    }
+
+    srcStrings.push_back(mLastCompiledSource.c_str());
+
+    if (!sh::Compile(compilerHandle, &srcStrings[0], srcStrings.size(), mLastCompileOptions))
+    {
+        mInfoLog = sh::GetInfoLog(compilerHandle);
+        return false;
+    }
+
+    mState.mTranslatedSource = sh::GetObjectCode(compilerHandle);
+
     // Gather the shader information
     mState.mShaderVersion = sh::GetShaderVersion(compilerHandle);
 
@@ -439,9 +573,7 @@ void Shader::resolveCompile(const Context *context)
     }
 
     ASSERT(!mState.mTranslatedSource.empty());
-
-    bool success = mImplementation->postTranslateCompile(mBoundCompiler.get(), &mInfoLog);
-    mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+    return true;
 }
 
 void Shader::addRef()
@@ -482,49 +614,49 @@ bool Shader::isCompiled(const Context *context)
 
 int Shader::getShaderVersion(const Context *context)
 {
-    resolveCompile(context);
+    waitForTranslation();
     return mState.mShaderVersion;
 }
 
 const std::vector<sh::Varying> &Shader::getInputVaryings(const Context *context)
 {
-    resolveCompile(context);
+    waitForTranslation();
     return mState.getInputVaryings();
 }
 
 const std::vector<sh::Varying> &Shader::getOutputVaryings(const Context *context)
 {
-    resolveCompile(context);
+    waitForTranslation();
     return mState.getOutputVaryings();
 }
 
 const std::vector<sh::Uniform> &Shader::getUniforms(const Context *context)
 {
-    resolveCompile(context);
+    waitForTranslation();
     return mState.getUniforms();
 }
 
 const std::vector<sh::InterfaceBlock> &Shader::getUniformBlocks(const Context *context)
 {
-    resolveCompile(context);
+    waitForTranslation();
     return mState.getUniformBlocks();
 }
 
 const std::vector<sh::InterfaceBlock> &Shader::getShaderStorageBlocks(const Context *context)
 {
-    resolveCompile(context);
+    waitForTranslation();
     return mState.getShaderStorageBlocks();
 }
 
 const std::vector<sh::Attribute> &Shader::getActiveAttributes(const Context *context)
 {
-    resolveCompile(context);
+    waitForTranslation();
     return mState.getActiveAttributes();
 }
 
 const std::vector<sh::OutputVariable> &Shader::getActiveOutputVariables(const Context *context)
 {
-    resolveCompile(context);
+    waitForTranslation();
     return mState.getActiveOutputVariables();
 }
 
@@ -570,13 +702,13 @@ std::string Shader::getTransformFeedbackVaryingMappedName(const std::string &tfV
 
 const sh::WorkGroupSize &Shader::getWorkGroupSize(const Context *context)
 {
-    resolveCompile(context);
+    waitForTranslation();
     return mState.mLocalSize;
 }
 
 int Shader::getNumViews(const Context *context)
 {
-    resolveCompile(context);
+    waitForTranslation();
     return mState.mNumViews;
 }
 
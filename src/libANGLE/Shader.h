@@ -23,6 +23,7 @@
 #include "common/Optional.h"
 #include "common/angleutils.h"
 #include "libANGLE/Debug.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/angletypes.h"
 
 namespace rx
@@ -151,6 +152,18 @@ class Shader final : angle::NonCopyable, public LabeledObject
     void compile(const Context *context);
     bool isCompiled(const Context *context);
 
+    // Returns false while a translation started by compile() is still running on the worker
+    // pool. Unlike the other queries, this never blocks on the compile.
+    bool isCompleted();
+
+    // Finishes a pending compile. Calls into the back-end, so it must run on the GL thread.
+    void resolveCompile(const Context *context);
+
+    // Waits for the translation started by compile(), and returns whether it succeeded. Doesn't
+    // call into the back-end, so a link running on a worker thread can use it. The queries of the
+    // shader's variables below only wait for the translation too.
+    bool waitForTranslation();
+
     void addRef();
     void release(const Context *context);
     unsigned int getRefCount() const;
@@ -186,7 +199,11 @@ class Shader final : angle::NonCopyable, public LabeledObject
                               GLsizei *length,
                               char *buffer);
 
-    void resolveCompile(const Context *context);
+    class CompileTask;
+
+    void waitForCompileTask();
+    void releaseCompilerHandle();
+    bool translate();
 
     ShaderState mState;
     std::string mLastCompiledSource;
@@ -203,6 +220,15 @@ class Shader final : angle::NonCopyable, public LabeledObject
     // We keep a reference to the translator in order to defer compiles while preserving settings.
     BindingPointer<Compiler> mBoundCompiler;
 
+    // Translation of the last compiled source. Runs on the context's worker pool if parallel
+    // compilation is enabled, or is deferred until its results are needed otherwise. The compiler
+    // handle is checked out of mBoundCompiler when the translation starts and given back once the
+    // compile is resolved, since the backend reads results from it after the translation.
+    ShHandle mCompilerHandle;
+    std::unique_ptr<CompileTask> mCompileTask;
+    angle::WaitableEvent mCompileEvent;
+    bool mCompileTaskPosted;
+
     ShaderProgramManager *mResourceManager;
 };
 
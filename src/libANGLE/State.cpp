@@ -68,7 +68,9 @@ State::State()
       mSampleAlphaToOne(false),
       mFramebufferSRGB(true),
       mRobustResourceInit(false),
-      mProgramBinaryCacheEnabled(false)
+      mProgramBinaryCacheEnabled(false),
+      mDrawStatesValidated(false),
+      mDrawStatesBufferSizeSerial(0)
 {
 }
 
@@ -309,19 +311,19 @@ void State::setColorClearValue(float red, float green, float blue, float alpha)
     mColorClearValue.green = green;
     mColorClearValue.blue = blue;
     mColorClearValue.alpha = alpha;
-    mDirtyBits.set(DIRTY_BIT_CLEAR_COLOR);
+    setDirtyBit(DIRTY_BIT_CLEAR_COLOR);
 }
 
 void State::setDepthClearValue(float depth)
 {
     mDepthClearValue = depth;
-    mDirtyBits.set(DIRTY_BIT_CLEAR_DEPTH);
+    setDirtyBit(DIRTY_BIT_CLEAR_DEPTH);
 }
 
 void State::setStencilClearValue(int stencil)
 {
     mStencilClearValue = stencil;
-    mDirtyBits.set(DIRTY_BIT_CLEAR_STENCIL);
+    setDirtyBit(DIRTY_BIT_CLEAR_STENCIL);
 }
 
 void State::setColorMask(bool red, bool green, bool blue, bool alpha)
@@ -330,13 +332,13 @@ void State::setColorMask(bool red, bool green, bool blue, bool alpha)
     mBlend.colorMaskGreen = green;
     mBlend.colorMaskBlue = blue;
     mBlend.colorMaskAlpha = alpha;
-    mDirtyBits.set(DIRTY_BIT_COLOR_MASK);
+    setDirtyBit(DIRTY_BIT_COLOR_MASK);
 }
 
 void State::setDepthMask(bool mask)
 {
     mDepthStencil.depthMask = mask;
-    mDirtyBits.set(DIRTY_BIT_DEPTH_MASK);
+    setDirtyBit(DIRTY_BIT_DEPTH_MASK);
 }
 
 bool State::isRasterizerDiscardEnabled() const
@@ -347,7 +349,7 @@ bool State::isRasterizerDiscardEnabled() const
 void State::setRasterizerDiscard(bool enabled)
 {
     mRasterizer.rasterizerDiscard = enabled;
-    mDirtyBits.set(DIRTY_BIT_RASTERIZER_DISCARD_ENABLED);
+    setDirtyBit(DIRTY_BIT_RASTERIZER_DISCARD_ENABLED);
 }
 
 bool State::isCullFaceEnabled() const
@@ -358,19 +360,19 @@ bool State::isCullFaceEnabled() const
 void State::setCullFace(bool enabled)
 {
     mRasterizer.cullFace = enabled;
-    mDirtyBits.set(DIRTY_BIT_CULL_FACE_ENABLED);
+    setDirtyBit(DIRTY_BIT_CULL_FACE_ENABLED);
 }
 
 void State::setCullMode(CullFaceMode mode)
 {
     mRasterizer.cullMode = mode;
-    mDirtyBits.set(DIRTY_BIT_CULL_FACE);
+    setDirtyBit(DIRTY_BIT_CULL_FACE);
 }
 
 void State::setFrontFace(GLenum front)
 {
     mRasterizer.frontFace = front;
-    mDirtyBits.set(DIRTY_BIT_FRONT_FACE);
+    setDirtyBit(DIRTY_BIT_FRONT_FACE);
 }
 
 bool State::isDepthTestEnabled() const
@@ -381,20 +383,20 @@ bool State::isDepthTestEnabled() const
 void State::setDepthTest(bool enabled)
 {
     mDepthStencil.depthTest = enabled;
-    mDirtyBits.set(DIRTY_BIT_DEPTH_TEST_ENABLED);
+    setDirtyBit(DIRTY_BIT_DEPTH_TEST_ENABLED);
 }
 
 void State::setDepthFunc(GLenum depthFunc)
 {
      mDepthStencil.depthFunc = depthFunc;
-     mDirtyBits.set(DIRTY_BIT_DEPTH_FUNC);
+     setDirtyBit(DIRTY_BIT_DEPTH_FUNC);
 }
 
 void State::setDepthRange(float zNear, float zFar)
 {
     mNearZ = zNear;
     mFarZ = zFar;
-    mDirtyBits.set(DIRTY_BIT_DEPTH_RANGE);
+    setDirtyBit(DIRTY_BIT_DEPTH_RANGE);
 }
 
 float State::getNearPlane() const
@@ -415,7 +417,7 @@ bool State::isBlendEnabled() const
 void State::setBlend(bool enabled)
 {
     mBlend.blend = enabled;
-    mDirtyBits.set(DIRTY_BIT_BLEND_ENABLED);
+    setDirtyBit(DIRTY_BIT_BLEND_ENABLED);
 }
 
 void State::setBlendFactors(GLenum sourceRGB, GLenum destRGB, GLenum sourceAlpha, GLenum destAlpha)
@@ -424,7 +426,7 @@ void State::setBlendFactors(GLenum sourceRGB, GLenum destRGB, GLenum sourceAlpha
     mBlend.destBlendRGB = destRGB;
     mBlend.sourceBlendAlpha = sourceAlpha;
     mBlend.destBlendAlpha = destAlpha;
-    mDirtyBits.set(DIRTY_BIT_BLEND_FUNCS);
+    setDirtyBit(DIRTY_BIT_BLEND_FUNCS);
 }
 
 void State::setBlendColor(float red, float green, float blue, float alpha)
@@ -433,14 +435,14 @@ void State::setBlendColor(float red, float green, float blue, float alpha)
     mBlendColor.green = green;
     mBlendColor.blue = blue;
     mBlendColor.alpha = alpha;
-    mDirtyBits.set(DIRTY_BIT_BLEND_COLOR);
+    setDirtyBit(DIRTY_BIT_BLEND_COLOR);
 }
 
 void State::setBlendEquation(GLenum rgbEquation, GLenum alphaEquation)
 {
     mBlend.blendEquationRGB = rgbEquation;
     mBlend.blendEquationAlpha = alphaEquation;
-    mDirtyBits.set(DIRTY_BIT_BLEND_EQUATIONS);
+    setDirtyBit(DIRTY_BIT_BLEND_EQUATIONS);
 }
 
 const ColorF &State::getBlendColor() const
@@ -456,7 +458,7 @@ bool State::isStencilTestEnabled() const
 void State::setStencilTest(bool enabled)
 {
     mDepthStencil.stencilTest = enabled;
-    mDirtyBits.set(DIRTY_BIT_STENCIL_TEST_ENABLED);
+    setDirtyBit(DIRTY_BIT_STENCIL_TEST_ENABLED);
 }
 
 void State::setStencilParams(GLenum stencilFunc, GLint stencilRef, GLuint stencilMask)
@@ -464,7 +466,7 @@ void State::setStencilParams(GLenum stencilFunc, GLint stencilRef, GLuint stenci
     mDepthStencil.stencilFunc = stencilFunc;
     mStencilRef = (stencilRef > 0) ? stencilRef : 0;
     mDepthStencil.stencilMask = stencilMask;
-    mDirtyBits.set(DIRTY_BIT_STENCIL_FUNCS_FRONT);
+    setDirtyBit(DIRTY_BIT_STENCIL_FUNCS_FRONT);
 }
 
 void State::setStencilBackParams(GLenum stencilBackFunc, GLint stencilBackRef, GLuint stencilBackMask)
@@ -472,19 +474,19 @@ void State::setStencilBackParams(GLenum stencilBackFunc, GLint stencilBackRef, G
     mDepthStencil.stencilBackFunc = stencilBackFunc;
     mStencilBackRef = (stencilBackRef > 0) ? stencilBackRef : 0;
     mDepthStencil.stencilBackMask = stencilBackMask;
-    mDirtyBits.set(DIRTY_BIT_STENCIL_FUNCS_BACK);
+    setDirtyBit(DIRTY_BIT_STENCIL_FUNCS_BACK);
 }
 
 void State::setStencilWritemask(GLuint stencilWritemask)
 {
     mDepthStencil.stencilWritemask = stencilWritemask;
-    mDirtyBits.set(DIRTY_BIT_STENCIL_WRITEMASK_FRONT);
+    setDirtyBit(DIRTY_BIT_STENCIL_WRITEMASK_FRONT);
 }
 
 void State::setStencilBackWritemask(GLuint stencilBackWritemask)
 {
     mDepthStencil.stencilBackWritemask = stencilBackWritemask;
-    mDirtyBits.set(DIRTY_BIT_STENCIL_WRITEMASK_BACK);
+    setDirtyBit(DIRTY_BIT_STENCIL_WRITEMASK_BACK);
 }
 
 void State::setStencilOperations(GLenum stencilFail, GLenum stencilPassDepthFail, GLenum stencilPassDepthPass)
@@ -492,7 +494,7 @@ void State::setStencilOperations(GLenum stencilFail, GLenum stencilPassDepthFail
     mDepthStencil.stencilFail = stencilFail;
     mDepthStencil.stencilPassDepthFail = stencilPassDepthFail;
     mDepthStencil.stencilPassDepthPass = stencilPassDepthPass;
-    mDirtyBits.set(DIRTY_BIT_STENCIL_OPS_FRONT);
+    setDirtyBit(DIRTY_BIT_STENCIL_OPS_FRONT);
 }
 
 void State::setStencilBackOperations(GLenum stencilBackFail, GLenum stencilBackPassDepthFail, GLenum stencilBackPassDepthPass)
@@ -500,7 +502,7 @@ void State::setStencilBackOperations(GLenum stencilBackFail, GLenum stencilBackP
     mDepthStencil.stencilBackFail = stencilBackFail;
     mDepthStencil.stencilBackPassDepthFail = stencilBackPassDepthFail;
     mDepthStencil.stencilBackPassDepthPass = stencilBackPassDepthPass;
-    mDirtyBits.set(DIRTY_BIT_STENCIL_OPS_BACK);
+    setDirtyBit(DIRTY_BIT_STENCIL_OPS_BACK);
 }
 
 GLint State::getStencilRef() const
@@ -521,7 +523,7 @@ bool State::isPolygonOffsetFillEnabled() const
 void State::setPolygonOffsetFill(bool enabled)
 {
     mRasterizer.polygonOffsetFill = enabled;
-    mDirtyBits.set(DIRTY_BIT_POLYGON_OFFSET_FILL_ENABLED);
+    setDirtyBit(DIRTY_BIT_POLYGON_OFFSET_FILL_ENABLED);
 }
 
 void State::setPolygonOffsetParams(GLfloat factor, GLfloat units)
@@ -529,7 +531,7 @@ void State::setPolygonOffsetParams(GLfloat factor, GLfloat units)
     // An application can pass NaN values here, so handle this gracefully
     mRasterizer.polygonOffsetFactor = factor != factor ? 0.0f : factor;
     mRasterizer.polygonOffsetUnits = units != units ? 0.0f : units;
-    mDirtyBits.set(DIRTY_BIT_POLYGON_OFFSET);
+    setDirtyBit(DIRTY_BIT_POLYGON_OFFSET);
 }
 
 bool State::isSampleAlphaToCoverageEnabled() const
@@ -540,7 +542,7 @@ bool State::isSampleAlphaToCoverageEnabled() const
 void State::setSampleAlphaToCoverage(bool enabled)
 {
     mBlend.sampleAlphaToCoverage = enabled;
-    mDirtyBits.set(DIRTY_BIT_SAMPLE_ALPHA_TO_COVERAGE_ENABLED);
+    setDirtyBit(DIRTY_BIT_SAMPLE_ALPHA_TO_COVERAGE_ENABLED);
 }
 
 bool State::isSampleCoverageEnabled() const
@@ -551,14 +553,14 @@ bool State::isSampleCoverageEnabled() const
 void State::setSampleCoverage(bool enabled)
 {
     mSampleCoverage = enabled;
-    mDirtyBits.set(DIRTY_BIT_SAMPLE_COVERAGE_ENABLED);
+    setDirtyBit(DIRTY_BIT_SAMPLE_COVERAGE_ENABLED);
 }
 
 void State::setSampleCoverageParams(GLclampf value, bool invert)
 {
     mSampleCoverageValue = value;
     mSampleCoverageInvert = invert;
-    mDirtyBits.set(DIRTY_BIT_SAMPLE_COVERAGE);
+    setDirtyBit(DIRTY_BIT_SAMPLE_COVERAGE);
 }
 
 GLclampf State::getSampleCoverageValue() const
@@ -579,7 +581,7 @@ bool State::isSampleMaskEnabled() const
 void State::setSampleMaskEnabled(bool enabled)
 {
     mSampleMask = enabled;
-    mDirtyBits.set(DIRTY_BIT_SAMPLE_MASK_ENABLED);
+    setDirtyBit(DIRTY_BIT_SAMPLE_MASK_ENABLED);
 }
 
 void State::setSampleMaskParams(GLuint maskNumber, GLbitfield mask)
@@ -587,7 +589,7 @@ void State::setSampleMaskParams(GLuint maskNumber, GLbitfield mask)
     ASSERT(maskNumber < mMaxSampleMaskWords);
     mSampleMaskValues[maskNumber] = mask;
     // TODO(jmadill): Use a child dirty bit if we ever use more than two words.
-    mDirtyBits.set(DIRTY_BIT_SAMPLE_MASK);
+    setDirtyBit(DIRTY_BIT_SAMPLE_MASK);
 }
 
 GLbitfield State::getSampleMaskWord(GLuint maskNumber) const
@@ -604,7 +606,7 @@ GLuint State::getMaxSampleMaskWords() const
 void State::setSampleAlphaToOne(bool enabled)
 {
     mSampleAlphaToOne = enabled;
-    mDirtyBits.set(DIRTY_BIT_SAMPLE_ALPHA_TO_ONE);
+    setDirtyBit(DIRTY_BIT_SAMPLE_ALPHA_TO_ONE);
 }
 
 bool State::isSampleAlphaToOneEnabled() const
@@ -615,7 +617,7 @@ bool State::isSampleAlphaToOneEnabled() const
 void State::setMultisampling(bool enabled)
 {
     mMultiSampling = enabled;
-    mDirtyBits.set(DIRTY_BIT_MULTISAMPLING);
+    setDirtyBit(DIRTY_BIT_MULTISAMPLING);
 }
 
 bool State::isMultisamplingEnabled() const
@@ -631,7 +633,7 @@ bool State::isScissorTestEnabled() const
 void State::setScissorTest(bool enabled)
 {
     mScissorTest = enabled;
-    mDirtyBits.set(DIRTY_BIT_SCISSOR_TEST_ENABLED);
+    setDirtyBit(DIRTY_BIT_SCISSOR_TEST_ENABLED);
 }
 
 void State::setScissorParams(GLint x, GLint y, GLsizei width, GLsizei height)
@@ -640,7 +642,7 @@ void State::setScissorParams(GLint x, GLint y, GLsizei width, GLsizei height)
     mScissor.y = y;
     mScissor.width = width;
     mScissor.height = height;
-    mDirtyBits.set(DIRTY_BIT_SCISSOR);
+    setDirtyBit(DIRTY_BIT_SCISSOR);
 }
 
 const Rectangle &State::getScissor() const
@@ -656,7 +658,7 @@ bool State::isDitherEnabled() const
 void State::setDither(bool enabled)
 {
     mBlend.dither = enabled;
-    mDirtyBits.set(DIRTY_BIT_DITHER_ENABLED);
+    setDirtyBit(DIRTY_BIT_DITHER_ENABLED);
 }
 
 bool State::isPrimitiveRestartEnabled() const
@@ -667,7 +669,7 @@ bool State::isPrimitiveRestartEnabled() const
 void State::setPrimitiveRestart(bool enabled)
 {
     mPrimitiveRestart = enabled;
-    mDirtyBits.set(DIRTY_BIT_PRIMITIVE_RESTART_ENABLED);
+    setDirtyBit(DIRTY_BIT_PRIMITIVE_RESTART_ENABLED);
 }
 
 void State::setEnableFeature(GLenum feature, bool enabled)
@@ -746,7 +748,7 @@ bool State::getEnableFeature(GLenum feature) const
 void State::setLineWidth(GLfloat width)
 {
     mLineWidth = width;
-    mDirtyBits.set(DIRTY_BIT_LINE_WIDTH);
+    setDirtyBit(DIRTY_BIT_LINE_WIDTH);
 }
 
 float State::getLineWidth() const
@@ -757,13 +759,13 @@ float State::getLineWidth() const
 void State::setGenerateMipmapHint(GLenum hint)
 {
     mGenerateMipmapHint = hint;
-    mDirtyBits.set(DIRTY_BIT_GENERATE_MIPMAP_HINT);
+    setDirtyBit(DIRTY_BIT_GENERATE_MIPMAP_HINT);
 }
 
 void State::setFragmentShaderDerivativeHint(GLenum hint)
 {
     mFragmentShaderDerivativeHint = hint;
-    mDirtyBits.set(DIRTY_BIT_SHADER_DERIVATIVE_HINT);
+    setDirtyBit(DIRTY_BIT_SHADER_DERIVATIVE_HINT);
     // TODO: Propagate the hint to shader translator so we can write
     // ddx, ddx_coarse, or ddx_fine depending on the hint.
     // Ignore for now. It is valid for implementations to ignore hint.
@@ -785,7 +787,7 @@ void State::setViewportParams(GLint x, GLint y, GLsizei width, GLsizei height)
     mViewport.y = y;
     mViewport.width = width;
     mViewport.height = height;
-    mDirtyBits.set(DIRTY_BIT_VIEWPORT);
+    setDirtyBit(DIRTY_BIT_VIEWPORT);
 }
 
 const Rectangle &State::getViewport() const
@@ -806,8 +808,8 @@ unsigned int State::getActiveSampler() const
 void State::setSamplerTexture(const Context *context, GLenum type, Texture *texture)
 {
     mSamplerTextures[type][mActiveSampler].set(context, texture);
-    mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
-    mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+    setDirtyBit(DIRTY_BIT_TEXTURE_BINDINGS);
+    setDirtyObject(DIRTY_OBJECT_PROGRAM_TEXTURES);
 }
 
 Texture *State::getTargetTexture(GLenum target) const
@@ -854,7 +856,7 @@ void State::detachTexture(const Context *context, const TextureMap &zeroTextures
                 ASSERT(it != zeroTextures.end());
                 // Zero textures are the "default" textures instead of NULL
                 binding.set(context, it->second.get());
-                mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+                setDirtyBit(DIRTY_BIT_TEXTURE_BINDINGS);
             }
         }
     }
@@ -880,12 +882,12 @@ void State::detachTexture(const Context *context, const TextureMap &zeroTextures
 
     if (mReadFramebuffer && mReadFramebuffer->detachTexture(context, texture))
     {
-        mDirtyObjects.set(DIRTY_OBJECT_READ_FRAMEBUFFER);
+        setDirtyObject(DIRTY_OBJECT_READ_FRAMEBUFFER);
     }
 
     if (mDrawFramebuffer && mDrawFramebuffer->detachTexture(context, texture))
     {
-        mDirtyObjects.set(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
+        setDirtyObject(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
     }
 }
 
@@ -905,8 +907,8 @@ void State::initializeZeroTextures(const Context *context, const TextureMap &zer
 void State::setSamplerBinding(const Context *context, GLuint textureUnit, Sampler *sampler)
 {
     mSamplers[textureUnit].set(context, sampler);
-    mDirtyBits.set(DIRTY_BIT_SAMPLER_BINDINGS);
-    mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+    setDirtyBit(DIRTY_BIT_SAMPLER_BINDINGS);
+    setDirtyObject(DIRTY_OBJECT_PROGRAM_TEXTURES);
 }
 
 GLuint State::getSamplerId(GLuint textureUnit) const
@@ -931,7 +933,7 @@ void State::detachSampler(const Context *context, GLuint sampler)
         if (samplerBinding.id() == sampler)
         {
             samplerBinding.set(context, nullptr);
-            mDirtyBits.set(DIRTY_BIT_SAMPLER_BINDINGS);
+            setDirtyBit(DIRTY_BIT_SAMPLER_BINDINGS);
         }
     }
 }
@@ -939,7 +941,7 @@ void State::detachSampler(const Context *context, GLuint sampler)
 void State::setRenderbufferBinding(const Context *context, Renderbuffer *renderbuffer)
 {
     mRenderbuffer.set(context, renderbuffer);
-    mDirtyBits.set(DIRTY_BIT_RENDERBUFFER_BINDING);
+    setDirtyBit(DIRTY_BIT_RENDERBUFFER_BINDING);
 }
 
 GLuint State::getRenderbufferId() const
@@ -973,14 +975,14 @@ void State::detachRenderbuffer(const Context *context, GLuint renderbuffer)
 
     if (readFramebuffer && readFramebuffer->detachRenderbuffer(context, renderbuffer))
     {
-        mDirtyObjects.set(DIRTY_OBJECT_READ_FRAMEBUFFER);
+        setDirtyObject(DIRTY_OBJECT_READ_FRAMEBUFFER);
     }
 
     if (drawFramebuffer && drawFramebuffer != readFramebuffer)
     {
         if (drawFramebuffer->detachRenderbuffer(context, renderbuffer))
         {
-            mDirtyObjects.set(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
+            setDirtyObject(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
         }
     }
 
@@ -992,11 +994,11 @@ void State::setReadFramebufferBinding(Framebuffer *framebuffer)
         return;
 
     mReadFramebuffer = framebuffer;
-    mDirtyBits.set(DIRTY_BIT_READ_FRAMEBUFFER_BINDING);
+    setDirtyBit(DIRTY_BIT_READ_FRAMEBUFFER_BINDING);
 
     if (mReadFramebuffer && mReadFramebuffer->hasAnyDirtyBit())
     {
-        mDirtyObjects.set(DIRTY_OBJECT_READ_FRAMEBUFFER);
+        setDirtyObject(DIRTY_OBJECT_READ_FRAMEBUFFER);
     }
 }
 
@@ -1006,11 +1008,11 @@ void State::setDrawFramebufferBinding(Framebuffer *framebuffer)
         return;
 
     mDrawFramebuffer = framebuffer;
-    mDirtyBits.set(DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING);
+    setDirtyBit(DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING);
 
     if (mDrawFramebuffer && mDrawFramebuffer->hasAnyDirtyBit())
     {
-        mDirtyObjects.set(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
+        setDirtyObject(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
     }
 }
 
@@ -1066,11 +1068,11 @@ bool State::removeDrawFramebufferBinding(GLuint framebuffer)
 void State::setVertexArrayBinding(VertexArray *vertexArray)
 {
     mVertexArray = vertexArray;
-    mDirtyBits.set(DIRTY_BIT_VERTEX_ARRAY_BINDING);
+    setDirtyBit(DIRTY_BIT_VERTEX_ARRAY_BINDING);
 
     if (mVertexArray && mVertexArray->hasAnyDirtyBit())
     {
-        mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
+        setDirtyObject(DIRTY_OBJECT_VERTEX_ARRAY);
     }
 }
 
@@ -1091,8 +1093,8 @@ bool State::removeVertexArrayBinding(GLuint vertexArray)
     if (mVertexArray->id() == vertexArray)
     {
         mVertexArray = nullptr;
-        mDirtyBits.set(DIRTY_BIT_VERTEX_ARRAY_BINDING);
-        mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
+        setDirtyBit(DIRTY_BIT_VERTEX_ARRAY_BINDING);
+        setDirtyObject(DIRTY_OBJECT_VERTEX_ARRAY);
         return true;
     }
 
@@ -1106,13 +1108,13 @@ void State::bindVertexBuffer(const Context *context,
                              GLsizei stride)
 {
     getVertexArray()->bindVertexBuffer(context, bindingIndex, boundBuffer, offset, stride);
-    mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
+    setDirtyObject(DIRTY_OBJECT_VERTEX_ARRAY);
 }
 
 void State::setVertexAttribBinding(const Context *context, GLuint attribIndex, GLuint bindingIndex)
 {
     getVertexArray()->setVertexAttribBinding(context, attribIndex, bindingIndex);
-    mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
+    setDirtyObject(DIRTY_OBJECT_VERTEX_ARRAY);
 }
 
 void State::setVertexAttribFormat(GLuint attribIndex,
@@ -1124,13 +1126,13 @@ void State::setVertexAttribFormat(GLuint attribIndex,
 {
     getVertexArray()->setVertexAttribFormat(attribIndex, size, type, normalized, pureInteger,
                                             relativeOffset);
-    mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
+    setDirtyObject(DIRTY_OBJECT_VERTEX_ARRAY);
 }
 
 void State::setVertexBindingDivisor(GLuint bindingIndex, GLuint divisor)
 {
     getVertexArray()->setVertexBindingDivisor(bindingIndex, divisor);
-    mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
+    setDirtyObject(DIRTY_OBJECT_VERTEX_ARRAY);
 }
 
 void State::setProgram(const Context *context, Program *newProgram)
@@ -1147,10 +1149,10 @@ void State::setProgram(const Context *context, Program *newProgram)
         if (mProgram)
         {
             newProgram->addRef();
-            mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+            setDirtyObject(DIRTY_OBJECT_PROGRAM_TEXTURES);
         }
-        mDirtyBits.set(DIRTY_BIT_PROGRAM_EXECUTABLE);
-        mDirtyBits.set(DIRTY_BIT_PROGRAM_BINDING);
+        setDirtyBit(DIRTY_BIT_PROGRAM_EXECUTABLE);
+        setDirtyBit(DIRTY_BIT_PROGRAM_BINDING);
     }
 }
 
@@ -1163,7 +1165,7 @@ void State::setTransformFeedbackBinding(const Context *context,
                                         TransformFeedback *transformFeedback)
 {
     mTransformFeedback.set(context, transformFeedback);
-    mDirtyBits.set(DIRTY_BIT_TRANSFORM_FEEDBACK_BINDING);
+    setDirtyBit(DIRTY_BIT_TRANSFORM_FEEDBACK_BINDING);
 }
 
 TransformFeedback *State::getCurrentTransformFeedback() const
@@ -1252,19 +1254,19 @@ void State::setBufferBinding(const Context *context, BufferBinding target, Buffe
     {
         case BufferBinding::PixelPack:
             mBoundBuffers[target].set(context, buffer);
-            mDirtyBits.set(DIRTY_BIT_PACK_BUFFER_BINDING);
+            setDirtyBit(DIRTY_BIT_PACK_BUFFER_BINDING);
             break;
         case BufferBinding::PixelUnpack:
             mBoundBuffers[target].set(context, buffer);
-            mDirtyBits.set(DIRTY_BIT_UNPACK_BUFFER_BINDING);
+            setDirtyBit(DIRTY_BIT_UNPACK_BUFFER_BINDING);
             break;
         case BufferBinding::DrawIndirect:
             mBoundBuffers[target].set(context, buffer);
-            mDirtyBits.set(DIRTY_BIT_DRAW_INDIRECT_BUFFER_BINDING);
+            setDirtyBit(DIRTY_BIT_DRAW_INDIRECT_BUFFER_BINDING);
             break;
         case BufferBinding::DispatchIndirect:
             mBoundBuffers[target].set(context, buffer);
-            mDirtyBits.set(DIRTY_BIT_DISPATCH_INDIRECT_BUFFER_BINDING);
+            setDirtyBit(DIRTY_BIT_DISPATCH_INDIRECT_BUFFER_BINDING);
             break;
         case BufferBinding::TransformFeedback:
             if (mTransformFeedback.get() != nullptr)
@@ -1274,11 +1276,11 @@ void State::setBufferBinding(const Context *context, BufferBinding target, Buffe
             break;
         case BufferBinding::ElementArray:
             getVertexArray()->setElementArrayBuffer(context, buffer);
-            mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
+            setDirtyObject(DIRTY_OBJECT_VERTEX_ARRAY);
             break;
         case BufferBinding::ShaderStorage:
             mBoundBuffers[target].set(context, buffer);
-            mDirtyBits.set(DIRTY_BIT_SHADER_STORAGE_BUFFER_BINDING);
+            setDirtyBit(DIRTY_BIT_SHADER_STORAGE_BUFFER_BINDING);
             break;
         default:
             mBoundBuffers[target].set(context, buffer);
@@ -1301,7 +1303,7 @@ void State::setIndexedBufferBinding(const Context *context,
             break;
         case BufferBinding::Uniform:
             mUniformBuffers[index].set(context, buffer, offset, size);
-            mDirtyBits.set(DIRTY_BIT_UNIFORM_BUFFER_BINDINGS);
+            setDirtyBit(DIRTY_BIT_UNIFORM_BUFFER_BINDINGS);
             break;
         case BufferBinding::AtomicCounter:
             mAtomicCounterBuffers[index].set(context, buffer, offset, size);
@@ -1368,14 +1370,14 @@ void State::detachBuffer(const Context *context, GLuint bufferName)
 void State::setEnableVertexAttribArray(unsigned int attribNum, bool enabled)
 {
     getVertexArray()->enableAttribute(attribNum, enabled);
-    mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
+    setDirtyObject(DIRTY_OBJECT_VERTEX_ARRAY);
 }
 
 void State::setVertexAttribf(GLuint index, const GLfloat values[4])
 {
     ASSERT(static_cast<size_t>(index) < mVertexAttribCurrentValues.size());
     mVertexAttribCurrentValues[index].setFloatValues(values);
-    mDirtyBits.set(DIRTY_BIT_CURRENT_VALUES);
+    setDirtyBit(DIRTY_BIT_CURRENT_VALUES);
     mDirtyCurrentValues.set(index);
     mCurrentValuesTypeMask.setIndex(GL_FLOAT, index);
 }
@@ -1384,7 +1386,7 @@ void State::setVertexAttribu(GLuint index, const GLuint values[4])
 {
     ASSERT(static_cast<size_t>(index) < mVertexAttribCurrentValues.size());
     mVertexAttribCurrentValues[index].setUnsignedIntValues(values);
-    mDirtyBits.set(DIRTY_BIT_CURRENT_VALUES);
+    setDirtyBit(DIRTY_BIT_CURRENT_VALUES);
     mDirtyCurrentValues.set(index);
     mCurrentValuesTypeMask.setIndex(GL_UNSIGNED_INT, index);
 }
@@ -1393,7 +1395,7 @@ void State::setVertexAttribi(GLuint index, const GLint values[4])
 {
     ASSERT(static_cast<size_t>(index) < mVertexAttribCurrentValues.size());
     mVertexAttribCurrentValues[index].setIntValues(values);
-    mDirtyBits.set(DIRTY_BIT_CURRENT_VALUES);
+    setDirtyBit(DIRTY_BIT_CURRENT_VALUES);
     mDirtyCurrentValues.set(index);
     mCurrentValuesTypeMask.setIndex(GL_INT, index);
 }
@@ -1410,13 +1412,13 @@ void State::setVertexAttribPointer(const Context *context,
 {
     getVertexArray()->setVertexAttribPointer(context, attribNum, boundBuffer, size, type,
                                              normalized, pureInteger, stride, pointer);
-    mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
+    setDirtyObject(DIRTY_OBJECT_VERTEX_ARRAY);
 }
 
 void State::setVertexAttribDivisor(const Context *context, GLuint index, GLuint divisor)
 {
     getVertexArray()->setVertexAttribDivisor(context, index, divisor);
-    mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
+    setDirtyObject(DIRTY_OBJECT_VERTEX_ARRAY);
 }
 
 const VertexAttribCurrentValueData &State::getVertexAttribCurrentValue(size_t attribNum) const
@@ -1438,7 +1440,7 @@ const void *State::getVertexAttribPointer(unsigned int attribNum) const
 void State::setPackAlignment(GLint alignment)
 {
     mPack.alignment = alignment;
-    mDirtyBits.set(DIRTY_BIT_PACK_STATE);
+    setDirtyBit(DIRTY_BIT_PACK_STATE);
 }
 
 GLint State::getPackAlignment() const
@@ -1449,7 +1451,7 @@ GLint State::getPackAlignment() const
 void State::setPackReverseRowOrder(bool reverseRowOrder)
 {
     mPack.reverseRowOrder = reverseRowOrder;
-    mDirtyBits.set(DIRTY_BIT_PACK_STATE);
+    setDirtyBit(DIRTY_BIT_PACK_STATE);
 }
 
 bool State::getPackReverseRowOrder() const
@@ -1460,7 +1462,7 @@ bool State::getPackReverseRowOrder() const
 void State::setPackRowLength(GLint rowLength)
 {
     mPack.rowLength = rowLength;
-    mDirtyBits.set(DIRTY_BIT_PACK_STATE);
+    setDirtyBit(DIRTY_BIT_PACK_STATE);
 }
 
 GLint State::getPackRowLength() const
@@ -1471,7 +1473,7 @@ GLint State::getPackRowLength() const
 void State::setPackSkipRows(GLint skipRows)
 {
     mPack.skipRows = skipRows;
-    mDirtyBits.set(DIRTY_BIT_PACK_STATE);
+    setDirtyBit(DIRTY_BIT_PACK_STATE);
 }
 
 GLint State::getPackSkipRows() const
@@ -1482,7 +1484,7 @@ GLint State::getPackSkipRows() const
 void State::setPackSkipPixels(GLint skipPixels)
 {
     mPack.skipPixels = skipPixels;
-    mDirtyBits.set(DIRTY_BIT_PACK_STATE);
+    setDirtyBit(DIRTY_BIT_PACK_STATE);
 }
 
 GLint State::getPackSkipPixels() const
@@ -1503,7 +1505,7 @@ PixelPackState &State::getPackState()
 void State::setUnpackAlignment(GLint alignment)
 {
     mUnpack.alignment = alignment;
-    mDirtyBits.set(DIRTY_BIT_UNPACK_STATE);
+    setDirtyBit(DIRTY_BIT_UNPACK_STATE);
 }
 
 GLint State::getUnpackAlignment() const
@@ -1514,7 +1516,7 @@ GLint State::getUnpackAlignment() const
 void State::setUnpackRowLength(GLint rowLength)
 {
     mUnpack.rowLength = rowLength;
-    mDirtyBits.set(DIRTY_BIT_UNPACK_STATE);
+    setDirtyBit(DIRTY_BIT_UNPACK_STATE);
 }
 
 GLint State::getUnpackRowLength() const
@@ -1525,7 +1527,7 @@ GLint State::getUnpackRowLength() const
 void State::setUnpackImageHeight(GLint imageHeight)
 {
     mUnpack.imageHeight = imageHeight;
-    mDirtyBits.set(DIRTY_BIT_UNPACK_STATE);
+    setDirtyBit(DIRTY_BIT_UNPACK_STATE);
 }
 
 GLint State::getUnpackImageHeight() const
@@ -1536,7 +1538,7 @@ GLint State::getUnpackImageHeight() const
 void State::setUnpackSkipImages(GLint skipImages)
 {
     mUnpack.skipImages = skipImages;
-    mDirtyBits.set(DIRTY_BIT_UNPACK_STATE);
+    setDirtyBit(DIRTY_BIT_UNPACK_STATE);
 }
 
 GLint State::getUnpackSkipImages() const
@@ -1547,7 +1549,7 @@ GLint State::getUnpackSkipImages() const
 void State::setUnpackSkipRows(GLint skipRows)
 {
     mUnpack.skipRows = skipRows;
-    mDirtyBits.set(DIRTY_BIT_UNPACK_STATE);
+    setDirtyBit(DIRTY_BIT_UNPACK_STATE);
 }
 
 GLint State::getUnpackSkipRows() const
@@ -1558,7 +1560,7 @@ GLint State::getUnpackSkipRows() const
 void State::setUnpackSkipPixels(GLint skipPixels)
 {
     mUnpack.skipPixels = skipPixels;
-    mDirtyBits.set(DIRTY_BIT_UNPACK_STATE);
+    setDirtyBit(DIRTY_BIT_UNPACK_STATE);
 }
 
 GLint State::getUnpackSkipPixels() const
@@ -1589,7 +1591,7 @@ Debug &State::getDebug()
 void State::setCoverageModulation(GLenum components)
 {
     mCoverageModulation = components;
-    mDirtyBits.set(DIRTY_BIT_COVERAGE_MODULATION);
+    setDirtyBit(DIRTY_BIT_COVERAGE_MODULATION);
 }
 
 GLenum State::getCoverageModulation() const
@@ -1602,12 +1604,12 @@ void State::loadPathRenderingMatrix(GLenum matrixMode, const GLfloat *matrix)
     if (matrixMode == GL_PATH_MODELVIEW_CHROMIUM)
     {
         memcpy(mPathMatrixMV, matrix, 16 * sizeof(GLfloat));
-        mDirtyBits.set(DIRTY_BIT_PATH_RENDERING_MATRIX_MV);
+        setDirtyBit(DIRTY_BIT_PATH_RENDERING_MATRIX_MV);
     }
     else if (matrixMode == GL_PATH_PROJECTION_CHROMIUM)
     {
         memcpy(mPathMatrixProj, matrix, 16 * sizeof(GLfloat));
-        mDirtyBits.set(DIRTY_BIT_PATH_RENDERING_MATRIX_PROJ);
+        setDirtyBit(DIRTY_BIT_PATH_RENDERING_MATRIX_PROJ);
     }
     else
     {
@@ -1635,7 +1637,7 @@ void State::setPathStencilFunc(GLenum func, GLint ref, GLuint mask)
     mPathStencilFunc = func;
     mPathStencilRef  = ref;
     mPathStencilMask = mask;
-    mDirtyBits.set(DIRTY_BIT_PATH_RENDERING_STENCIL_STATE);
+    setDirtyBit(DIRTY_BIT_PATH_RENDERING_STENCIL_STATE);
 }
 
 GLenum State::getPathStencilFunc() const
@@ -1656,7 +1658,7 @@ GLuint State::getPathStencilMask() const
 void State::setFramebufferSRGB(bool sRGB)
 {
     mFramebufferSRGB = sRGB;
-    mDirtyBits.set(DIRTY_BIT_FRAMEBUFFER_SRGB);
+    setDirtyBit(DIRTY_BIT_FRAMEBUFFER_SRGB);
 }
 
 bool State::getFramebufferSRGB() const
@@ -2211,20 +2213,7 @@ bool State::hasMappedBuffer(BufferBinding target) const
 {
     if (target == BufferBinding::Array)
     {
-        const VertexArray *vao     = getVertexArray();
-        const auto &vertexAttribs = vao->getVertexAttributes();
-        const auto &vertexBindings = vao->getVertexBindings();
-        for (size_t attribIndex : vao->getEnabledAttributesMask())
-        {
-            const VertexAttribute &vertexAttrib = vertexAttribs[attribIndex];
-            auto *boundBuffer = vertexBindings[vertexAttrib.bindingIndex].getBuffer().get();
-            if (vertexAttrib.enabled && boundBuffer && boundBuffer->isMapped())
-            {
-                return true;
-            }
-        }
-
-        return false;
+        return getVertexArray()->hasMappedEnabledArrayBuffer();
     }
     else
     {
@@ -2281,7 +2270,7 @@ void State::syncProgramTextures(const Context *context)
     }
 
     ASSERT(mDirtyObjects[DIRTY_OBJECT_PROGRAM_TEXTURES]);
-    mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+    setDirtyBit(DIRTY_BIT_TEXTURE_BINDINGS);
 
     ActiveTextureMask newActiveTextures;
 
@@ -2376,28 +2365,56 @@ void State::syncDirtyObject(const Context *context, GLenum target)
     syncDirtyObjects(context, localSet);
 }
 
+void State::setDirtyBit(DirtyBitType dirtyBit)
+{
+    // The state read by the draw state checks in ValidateDrawBase. DirtyBits isn't constexpr.
+    constexpr uint64_t kDrawValidationDirtyBits =
+        (1ull << DIRTY_BIT_STENCIL_FUNCS_FRONT) | (1ull << DIRTY_BIT_STENCIL_FUNCS_BACK) |
+        (1ull << DIRTY_BIT_STENCIL_WRITEMASK_FRONT) | (1ull << DIRTY_BIT_STENCIL_WRITEMASK_BACK) |
+        (1ull << DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING) | (1ull << DIRTY_BIT_VERTEX_ARRAY_BINDING) |
+        (1ull << DIRTY_BIT_UNIFORM_BUFFER_BINDINGS) | (1ull << DIRTY_BIT_PROGRAM_BINDING) |
+        (1ull << DIRTY_BIT_PROGRAM_EXECUTABLE) | (1ull << DIRTY_BIT_TEXTURE_BINDINGS) |
+        (1ull << DIRTY_BIT_CURRENT_VALUES);
+
+    mDirtyBits.set(dirtyBit);
+    if (((kDrawValidationDirtyBits >> dirtyBit) & 1) != 0)
+    {
+        mDrawStatesValidated = false;
+    }
+}
+
+void State::setDirtyObject(DirtyObjectType dirtyObject)
+{
+    // Every dirty object except the read framebuffer is read by the draw state checks.
+    mDirtyObjects.set(dirtyObject);
+    if (dirtyObject != DIRTY_OBJECT_READ_FRAMEBUFFER)
+    {
+        mDrawStatesValidated = false;
+    }
+}
+
 void State::setObjectDirty(GLenum target)
 {
     switch (target)
     {
         case GL_READ_FRAMEBUFFER:
-            mDirtyObjects.set(DIRTY_OBJECT_READ_FRAMEBUFFER);
+            setDirtyObject(DIRTY_OBJECT_READ_FRAMEBUFFER);
             break;
         case GL_DRAW_FRAMEBUFFER:
-            mDirtyObjects.set(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
+            setDirtyObject(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
             break;
         case GL_FRAMEBUFFER:
-            mDirtyObjects.set(DIRTY_OBJECT_READ_FRAMEBUFFER);
-            mDirtyObjects.set(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
+            setDirtyObject(DIRTY_OBJECT_READ_FRAMEBUFFER);
+            setDirtyObject(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
             break;
         case GL_VERTEX_ARRAY:
-            mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
+            setDirtyObject(DIRTY_OBJECT_VERTEX_ARRAY);
             break;
         case GL_TEXTURE:
         case GL_SAMPLER:
         case GL_PROGRAM:
-            mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
-            mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+            setDirtyObject(DIRTY_OBJECT_PROGRAM_TEXTURES);
+            setDirtyBit(DIRTY_BIT_TEXTURE_BINDINGS);
             break;
     }
 }
@@ -2408,10 +2425,16 @@ void State::onProgramExecutableChange(Program *program)
     // "If LinkProgram or ProgramBinary successfully re-links a program object
     //  that was already in use as a result of a previous call to UseProgram, then the
     //  generated executable code will be installed as part of the current rendering state."
+    // A failed link leaves the program bound but unusable for drawing.
+    if (mProgram == program)
+    {
+        mDrawStatesValidated = false;
+    }
+
     if (program->isLinked() && mProgram == program)
     {
-        mDirtyBits.set(DIRTY_BIT_PROGRAM_EXECUTABLE);
-        mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+        setDirtyBit(DIRTY_BIT_PROGRAM_EXECUTABLE);
+        setDirtyObject(DIRTY_OBJECT_PROGRAM_TEXTURES);
     }
 }
 
@@ -2442,7 +2465,7 @@ void State::signal(size_t textureIndex, InitState initState)
 {
     // Conservatively assume all textures are dirty.
     // TODO(jmadill): More fine-grained update.
-    mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+    setDirtyObject(DIRTY_OBJECT_PROGRAM_TEXTURES);
 
     if (initState == InitState::MayNeedInit)
     {
@@ -435,16 +435,40 @@ class State : public OnAttachmentDirtyReceiver, angle::NonCopyable
     const DirtyBits &getDirtyBits() const { return mDirtyBits; }
     void clearDirtyBits() { mDirtyBits.reset(); }
     void clearDirtyBits(const DirtyBits &bitset) { mDirtyBits &= ~bitset; }
-    void setAllDirtyBits() { mDirtyBits.set(); }
+    void setAllDirtyBits()
+    {
+        mDirtyBits.set();
+        mDrawStatesValidated = false;
+    }
 
     using DirtyObjects = angle::BitSet<DIRTY_OBJECT_MAX>;
     void clearDirtyObjects() { mDirtyObjects.reset(); }
-    void setAllDirtyObjects() { mDirtyObjects.set(); }
+    void setAllDirtyObjects()
+    {
+        mDirtyObjects.set();
+        mDrawStatesValidated = false;
+    }
     void syncDirtyObjects(const Context *context);
     void syncDirtyObjects(const Context *context, const DirtyObjects &bitset);
     void syncDirtyObject(const Context *context, GLenum target);
     void setObjectDirty(GLenum target);
 
+    // ValidateDrawBase skips the checks that don't depend on the draw call while the state they
+    // depend on is unchanged. Setting one of the dirty bits those checks read invalidates the
+    // result. Buffers can be resized through any context sharing them, so the result is also
+    // invalidated when the size of any buffer changes. Other changes to objects that aren't
+    // tracked with dirty bits have to invalidate it explicitly.
+    bool areDrawStatesValidated() const
+    {
+        return mDrawStatesValidated && mDrawStatesBufferSizeSerial == Buffer::GetSizeSerial();
+    }
+    void setDrawStatesValidated()
+    {
+        mDrawStatesValidated        = true;
+        mDrawStatesBufferSizeSerial = Buffer::GetSizeSerial();
+    }
+    void invalidateDrawStatesValidation() { mDrawStatesValidated = false; }
+
     // This actually clears the current value dirty bits.
     // TODO(jmadill): Pass mutable dirty bits into Impl.
     AttributesMask getAndResetDirtyCurrentValues() const;
@@ -599,9 +623,14 @@ class State : public OnAttachmentDirtyReceiver, angle::NonCopyable
     // GL_ANGLE_program_cache_control
     bool mProgramBinaryCacheEnabled;
 
+    void setDirtyBit(DirtyBitType dirtyBit);
+    void setDirtyObject(DirtyObjectType dirtyObject);
+
     DirtyBits mDirtyBits;
     DirtyObjects mDirtyObjects;
     mutable AttributesMask mDirtyCurrentValues;
+    bool mDrawStatesValidated;
+    unsigned int mDrawStatesBufferSizeSerial;
 };
 
 }  // namespace gl
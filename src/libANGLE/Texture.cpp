@@ -10,11 +10,13 @@
 
 #include "common/mathutil.h"
 #include "common/utilities.h"
+#include "image_util/parallelrows.h"
 #include "libANGLE/Config.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/ContextState.h"
 #include "libANGLE/Image.h"
 #include "libANGLE/Surface.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 #include "libANGLE/renderer/TextureImpl.h"
@@ -62,6 +64,58 @@ InitState DetermineInitState(const Context *context, const uint8_t *pixels)
                : InitState::Initialized;
 }
 
+// Calls a task for one range of rows of an image on a worker thread.
+class RowTask : public angle::Closure
+{
+  public:
+    RowTask(const std::function<void(size_t)> *task, size_t index) : mTask(task), mIndex(index) {}
+
+    void operator()() override { (*mTask)(mIndex); }
+
+  private:
+    const std::function<void(size_t)> *mTask;
+    size_t mIndex;
+};
+
+// Lets image_util split the pixels it loads or generates across the display's worker threads
+// while this is in scope.
+class ScopedImageWorkerPool final : public angle::RowWorkerPool
+{
+  public:
+    explicit ScopedImageWorkerPool(const Context *context)
+        : mPool(context ? context->getWorkerThreadPool() : nullptr), mScope(mPool ? this : nullptr)
+    {
+    }
+
+    size_t getMaxThreads() const override { return mPool->getMaxThreads(); }
+
+    void runTasks(size_t taskCount, const std::function<void(size_t index)> &task) override
+    {
+        std::vector<RowTask> rowTasks;
+        rowTasks.reserve(taskCount - 1);
+        std::vector<angle::WaitableEvent> waitEvents;
+        waitEvents.reserve(taskCount - 1);
+
+        // The GL thread is blocked until every range is done.
+        for (size_t index = 1; index < taskCount; ++index)
+        {
+            rowTasks.emplace_back(&task, index);
+            waitEvents.push_back(
+                mPool->postWorkerTask(&rowTasks.back(), angle::TaskPriority::High));
+        }
+        task(0);
+
+        for (angle::WaitableEvent &waitEvent : waitEvents)
+        {
+            waitEvent.wait();
+        }
+    }
+
+  private:
+    angle::WorkerThreadPool *mPool;
+    angle::ScopedRowWorkerPool mScope;
+};
+
 }  // namespace
 
 bool IsMipmapFiltered(const SamplerState &samplerState)
@@ -918,6 +972,7 @@ Error Texture::setImage(const Context *context,
     ANGLE_TRY(releaseTexImageInternal(context));
     ANGLE_TRY(orphanImages(context));
 
+    ScopedImageWorkerPool workerPool(context);
     ANGLE_TRY(mTexture->setImage(context, target, level, internalFormat, size, format, type,
                                  unpackState, pixels));
 
@@ -942,6 +997,7 @@ Error Texture::setSubImage(const Context *context,
 
     ANGLE_TRY(ensureSubImageInitialized(context, target, level, area));
 
+    ScopedImageWorkerPool workerPool(context);
     return mTexture->setSubImage(context, target, level, area, format, type, unpackState, pixels);
 }
 
@@ -961,6 +1017,7 @@ Error Texture::setCompressedImage(const Context *context,
     ANGLE_TRY(releaseTexImageInternal(context));
     ANGLE_TRY(orphanImages(context));
 
+    ScopedImageWorkerPool workerPool(context);
     ANGLE_TRY(mTexture->setCompressedImage(context, target, level, internalFormat, size,
                                            unpackState, imageSize, pixels));
 
@@ -985,6 +1042,7 @@ Error Texture::setCompressedSubImage(const Context *context,
 
     ANGLE_TRY(ensureSubImageInitialized(context, target, level, area));
 
+    ScopedImageWorkerPool workerPool(context);
     return mTexture->setCompressedSubImage(context, target, level, area, format, unpackState,
                                            imageSize, pixels);
 }
@@ -1209,6 +1267,7 @@ Error Texture::generateMipmap(const Context *context)
                 context, GetImageIndexFromDescIndex(mState.getBaseImageTarget(), baseLevel)));
         }
 
+        ScopedImageWorkerPool workerPool(context);
         ANGLE_TRY(mTexture->generateMipmap(context));
 
         mState.setImageDescChain(baseLevel, maxLevel, baseImageInfo.size, baseImageInfo.format,
@@ -23,6 +23,7 @@ VertexArrayState::VertexArrayState(size_t maxAttribs, size_t maxAttribBindings)
     for (size_t i = 0; i < maxAttribs; i++)
     {
         mVertexAttributes.emplace_back(static_cast<GLuint>(i));
+        mVertexBindings[i].setBoundAttribute(i);
     }
 }
 
@@ -38,13 +39,19 @@ VertexArray::VertexArray(rx::GLImplFactory *factory,
       mState(maxAttribs, maxAttribBindings),
       mVertexArray(factory->createVertexArray(mState))
 {
+    mBufferMapBindings.reserve(maxAttribBindings);
+    for (size_t bindingIndex = 0; bindingIndex < maxAttribBindings; ++bindingIndex)
+    {
+        mBufferMapBindings.emplace_back(this, bindingIndex);
+    }
 }
 
 void VertexArray::onDestroy(const Context *context)
 {
-    for (auto &binding : mState.mVertexBindings)
+    for (size_t bindingIndex = 0; bindingIndex < getMaxBindings(); ++bindingIndex)
     {
-        binding.setBuffer(context, nullptr);
+        mBufferMapBindings[bindingIndex].reset();
+        mState.mVertexBindings[bindingIndex].setBuffer(context, nullptr);
     }
     mState.mElementArrayBuffer.set(context, nullptr);
     mVertexArray->destroy(context);
@@ -74,11 +81,14 @@ const std::string &VertexArray::getLabel() const
 
 void VertexArray::detachBuffer(const Context *context, GLuint bufferName)
 {
-    for (auto &binding : mState.mVertexBindings)
+    for (size_t bindingIndex = 0; bindingIndex < getMaxBindings(); ++bindingIndex)
     {
+        VertexBinding &binding = mState.mVertexBindings[bindingIndex];
         if (binding.getBuffer().id() == bufferName)
         {
             binding.setBuffer(context, nullptr);
+            mBufferMapBindings[bindingIndex].reset();
+            setMappedArrayBuffersForBinding(bindingIndex, false);
         }
     }
 
@@ -121,6 +131,10 @@ void VertexArray::bindVertexBufferImpl(const Context *context,
     binding->setBuffer(context, boundBuffer);
     binding->setOffset(offset);
     binding->setStride(stride);
+
+    mBufferMapBindings[bindingIndex].bind(boundBuffer ? boundBuffer->getMapChangedChannel()
+                                                      : nullptr);
+    setMappedArrayBuffersForBinding(bindingIndex, boundBuffer && boundBuffer->isMapped());
 }
 
 void VertexArray::bindVertexBuffer(const Context *context,
@@ -144,7 +158,11 @@ void VertexArray::setVertexAttribBinding(const Context *context,
     {
         // In ES 3.0 contexts, the binding cannot change, hence the code below is unreachable.
         ASSERT(context->getClientVersion() >= ES_3_1);
-        mState.mVertexAttributes[attribIndex].bindingIndex = bindingIndex;
+        VertexAttribute &attrib = mState.mVertexAttributes[attribIndex];
+        mState.mVertexBindings[attrib.bindingIndex].resetBoundAttribute(attribIndex);
+        mState.mVertexBindings[bindingIndex].setBoundAttribute(attribIndex);
+        attrib.bindingIndex = bindingIndex;
+        updateCachedMappedArrayBuffer(attribIndex);
 
         mDirtyBits.set(DIRTY_BIT_ATTRIB_0_BINDING + attribIndex);
     }
@@ -176,7 +194,6 @@ void VertexArray::setVertexAttribFormatImpl(size_t attribIndex,
     attrib->pureInteger    = pureInteger;
     attrib->relativeOffset = relativeOffset;
     mState.mVertexAttributesTypeMask.setIndex(GetVertexAttributeBaseType(*attrib), attribIndex);
-    mState.mEnabledAttributesMask.set(attribIndex);
 }
 
 void VertexArray::setVertexAttribFormat(size_t attribIndex,
@@ -248,6 +265,36 @@ void VertexArray::setElementArrayBuffer(const Context *context, Buffer *buffer)
     mDirtyBits.set(DIRTY_BIT_ELEMENT_ARRAY_BUFFER);
 }
 
+bool VertexArray::hasMappedEnabledArrayBuffer() const
+{
+    return (mState.mCachedMappedArrayBuffers & getEnabledAttributesMask()).any();
+}
+
+void VertexArray::signal(size_t bindingIndex, bool mapped)
+{
+    setMappedArrayBuffersForBinding(bindingIndex, mapped);
+}
+
+void VertexArray::setMappedArrayBuffersForBinding(size_t bindingIndex, bool mapped)
+{
+    const AttributesMask &boundAttributes =
+        mState.mVertexBindings[bindingIndex].getBoundAttributesMask();
+    if (mapped)
+    {
+        mState.mCachedMappedArrayBuffers |= boundAttributes;
+    }
+    else
+    {
+        mState.mCachedMappedArrayBuffers &= ~boundAttributes;
+    }
+}
+
+void VertexArray::updateCachedMappedArrayBuffer(size_t attribIndex)
+{
+    Buffer *buffer = mState.getBindingFromAttribIndex(attribIndex).getBuffer().get();
+    mState.mCachedMappedArrayBuffers.set(attribIndex, buffer && buffer->isMapped());
+}
+
 void VertexArray::syncState(const Context *context)
 {
     if (mDirtyBits.any())
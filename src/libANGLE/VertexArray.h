@@ -70,9 +70,13 @@ class VertexArrayState final : angle::NonCopyable
     std::vector<VertexBinding> mVertexBindings;
     AttributesMask mEnabledAttributesMask;
     ComponentTypeMask mVertexAttributesTypeMask;
+
+    // Attributes whose bound buffer is currently mapped, kept up to date by the buffers' map
+    // channels so draw validation doesn't have to look at every attribute.
+    AttributesMask mCachedMappedArrayBuffers;
 };
 
-class VertexArray final : public LabeledObject
+class VertexArray final : public LabeledObject, public OnBufferMapChangedReceiver
 {
   public:
     VertexArray(rx::GLImplFactory *factory, GLuint id, size_t maxAttribs, size_t maxAttribBindings);
@@ -196,14 +200,26 @@ class VertexArray final : public LabeledObject
     ComponentTypeMask getAttributesTypeMask() const { return mState.mVertexAttributesTypeMask; }
     AttributesMask getAttributesMask() const { return mState.mEnabledAttributesMask; }
 
+    // Returns true if an enabled attribute reads from a mapped buffer.
+    bool hasMappedEnabledArrayBuffer() const;
+
+    // OnBufferMapChangedReceiver implementation
+    void signal(size_t bindingIndex, bool mapped) override;
+
   private:
     ~VertexArray() override;
 
+    void setMappedArrayBuffersForBinding(size_t bindingIndex, bool mapped);
+    void updateCachedMappedArrayBuffer(size_t attribIndex);
+
     GLuint mId;
 
     VertexArrayState mState;
     DirtyBits mDirtyBits;
 
+    // One per vertex binding, bound to the map channel of the binding's buffer.
+    std::vector<OnBufferMapChangedBinding> mBufferMapBindings;
+
     rx::VertexArrayImpl *mVertexArray;
 };
 
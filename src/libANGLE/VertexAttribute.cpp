@@ -30,9 +30,10 @@ VertexBinding &VertexBinding::operator=(VertexBinding &&binding)
 {
     if (this != &binding)
     {
-        mStride  = binding.mStride;
-        mDivisor = binding.mDivisor;
-        mOffset  = binding.mOffset;
+        mStride              = binding.mStride;
+        mDivisor             = binding.mDivisor;
+        mOffset              = binding.mOffset;
+        mBoundAttributesMask = binding.mBoundAttributesMask;
         std::swap(binding.mBuffer, mBuffer);
     }
     return *this;
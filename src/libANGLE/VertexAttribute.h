@@ -10,6 +10,7 @@
 #define LIBANGLE_VERTEXATTRIBUTE_H_
 
 #include "libANGLE/Buffer.h"
+#include "libANGLE/angletypes.h"
 
 namespace gl
 {
@@ -39,12 +40,18 @@ class VertexBinding final : angle::NonCopyable
     const BindingPointer<Buffer> &getBuffer() const { return mBuffer; }
     void setBuffer(const gl::Context *context, Buffer *bufferIn) { mBuffer.set(context, bufferIn); }
 
+    // The attributes that read from this binding.
+    const AttributesMask &getBoundAttributesMask() const { return mBoundAttributesMask; }
+    void setBoundAttribute(size_t attribIndex) { mBoundAttributesMask.set(attribIndex); }
+    void resetBoundAttribute(size_t attribIndex) { mBoundAttributesMask.reset(attribIndex); }
+
   private:
     GLuint mStride;
     GLuint mDivisor;
     GLintptr mOffset;
 
     BindingPointer<Buffer> mBuffer;
+    AttributesMask mBoundAttributesMask;
 };
 
 //
@@ -10,6 +10,8 @@
 
 #include "libANGLE/WorkerThread.h"
 
+#include <algorithm>
+
 namespace angle
 {
 
@@ -25,7 +27,8 @@ SingleThreadedWorkerPool::~SingleThreadedWorkerPool()
 {
 }
 
-SingleThreadedWaitableEvent SingleThreadedWorkerPool::postWorkerTaskImpl(Closure *task)
+SingleThreadedWaitableEvent SingleThreadedWorkerPool::postWorkerTaskImpl(Closure *task,
+                                                                        TaskPriority priority)
 {
     (*task)();
     return SingleThreadedWaitableEvent(EventResetPolicy::Automatic, EventInitialState::Signaled);
@@ -67,32 +70,110 @@ void SingleThreadedWaitableEvent::waitImpl()
 {
 }
 
+bool SingleThreadedWaitableEvent::isReadyImpl()
+{
+    // Tasks run to completion inside postWorkerTask.
+    return true;
+}
+
 void SingleThreadedWaitableEvent::signalImpl()
 {
     mSignaled = true;
 }
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+// AsyncPoolState implementation.
+bool AsyncPoolState::CompareTasks::operator()(const std::shared_ptr<AsyncTask> &a,
+                                              const std::shared_ptr<AsyncTask> &b) const
+{
+    // std::priority_queue pops the largest element first.
+    if (a->priority != b->priority)
+    {
+        return a->priority < b->priority;
+    }
+    return a->sequence > b->sequence;
+}
+
 // AsyncWorkerPool implementation.
-AsyncWorkerPool::AsyncWorkerPool(size_t maxThreads) : WorkerThreadPoolBase(maxThreads)
+AsyncWorkerPool::AsyncWorkerPool(size_t maxThreads)
+    : WorkerThreadPoolBase(std::max<size_t>(maxThreads, 1)), mState(new AsyncPoolState())
 {
 }
 
 AsyncWorkerPool::~AsyncWorkerPool()
 {
+    {
+        std::lock_guard<std::mutex> lock(mState->mutex);
+        mState->stopping = true;
+    }
+    mState->taskPosted.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
 }
 
-AsyncWaitableEvent AsyncWorkerPool::postWorkerTaskImpl(Closure *task)
+AsyncWaitableEvent AsyncWorkerPool::postWorkerTaskImpl(Closure *task, TaskPriority priority)
 {
-    auto future = std::async(std::launch::async, [task] { (*task)(); });
+    std::shared_ptr<AsyncTask> asyncTask(new AsyncTask());
+    asyncTask->closure   = task;
+    asyncTask->priority  = priority;
+    asyncTask->done      = false;
+    asyncTask->poolState = mState;
+
+    {
+        std::lock_guard<std::mutex> lock(mState->mutex);
+        asyncTask->sequence = mState->nextSequence++;
+        mState->pendingTasks.push(asyncTask);
+
+        // Only start a new thread if the existing ones are all busy.
+        if (mState->idleThreads < mState->pendingTasks.size() &&
+            mThreads.size() < getMaxThreads())
+        {
+            mThreads.emplace_back(ThreadMain, mState);
+        }
+    }
+    mState->taskPosted.notify_one();
 
     AsyncWaitableEvent waitable(EventResetPolicy::Automatic, EventInitialState::NonSignaled);
 
-    waitable.setFuture(std::move(future));
+    waitable.setTask(asyncTask);
 
     return waitable;
 }
 
+// static
+void AsyncWorkerPool::ThreadMain(std::shared_ptr<AsyncPoolState> state)
+{
+    std::unique_lock<std::mutex> lock(state->mutex);
+
+    while (true)
+    {
+        state->idleThreads++;
+        state->taskPosted.wait(lock,
+                               [&state] { return state->stopping || !state->pendingTasks.empty(); });
+        state->idleThreads--;
+
+        // Tasks still queued when the pool is destroyed are run before the thread exits.
+        if (state->pendingTasks.empty())
+        {
+            ASSERT(state->stopping);
+            return;
+        }
+
+        std::shared_ptr<AsyncTask> task = state->pendingTasks.top();
+        state->pendingTasks.pop();
+
+        lock.unlock();
+        (*task->closure)();
+        lock.lock();
+
+        task->done = true;
+        state->taskDone.notify_all();
+    }
+}
+
 // AsyncWaitableEvent implementation.
 AsyncWaitableEvent::AsyncWaitableEvent()
     : AsyncWaitableEvent(EventResetPolicy::Automatic, EventInitialState::NonSignaled)
@@ -109,38 +190,62 @@ AsyncWaitableEvent::~AsyncWaitableEvent()
 }
 
 AsyncWaitableEvent::AsyncWaitableEvent(AsyncWaitableEvent &&other)
-    : WaitableEventBase(std::move(other)), mFuture(std::move(other.mFuture))
+    : WaitableEventBase(std::move(other)), mTask(std::move(other.mTask))
 {
 }
 
 AsyncWaitableEvent &AsyncWaitableEvent::operator=(AsyncWaitableEvent &&other)
 {
-    std::swap(mFuture, other.mFuture);
+    std::swap(mTask, other.mTask);
     return copyBase(std::move(other));
 }
 
-void AsyncWaitableEvent::setFuture(std::future<void> &&future)
+void AsyncWaitableEvent::setTask(const std::shared_ptr<AsyncTask> &task)
+{
+    mTask = task;
+}
+
+std::mutex *AsyncWaitableEvent::getPoolMutex() const
+{
+    return &mTask->poolState->mutex;
+}
+
+std::condition_variable *AsyncWaitableEvent::getTaskDoneCondition() const
 {
-    mFuture = std::move(future);
+    return &mTask->poolState->taskDone;
 }
 
 void AsyncWaitableEvent::resetImpl()
 {
     mSignaled = false;
-    mFuture   = std::future<void>();
+    mTask.reset();
 }
 
 void AsyncWaitableEvent::waitImpl()
 {
-    if (mSignaled || !mFuture.valid())
+    if (mSignaled || !mTask)
     {
         return;
     }
 
-    mFuture.wait();
+    {
+        std::unique_lock<std::mutex> lock(*getPoolMutex());
+        getTaskDoneCondition()->wait(lock, [this] { return mTask->done; });
+    }
     signal();
 }
 
+bool AsyncWaitableEvent::isReadyImpl()
+{
+    if (mSignaled || !mTask)
+    {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(*getPoolMutex());
+    return mTask->done;
+}
+
 void AsyncWaitableEvent::signalImpl()
 {
     mSignaled = true;
@@ -18,7 +18,11 @@
 #include "libANGLE/features.h"
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
-#include <future>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
 namespace angle
@@ -38,6 +42,15 @@ enum class EventInitialState
     Signaled
 };
 
+// Tasks with a higher priority are started first. Tasks of the same priority start in the order
+// they were posted.
+enum class TaskPriority
+{
+    Low,
+    Normal,
+    High
+};
+
 // A callback function with no return value and no arguments.
 class Closure
 {
@@ -63,6 +76,9 @@ class WaitableEventBase : angle::NonCopyable
     // Waits indefinitely for the event to be signaled.
     void wait();
 
+    // Returns true if waiting on the event would not block.
+    bool isReady();
+
     // Puts the event in the signaled state, causing any thread blocked on Wait to be woken up.
     // The event state is reset to non-signaled after a waiting thread has been released.
     void signal();
@@ -102,6 +118,12 @@ void WaitableEventBase<Impl>::wait()
     static_cast<Impl *>(this)->waitImpl();
 }
 
+template <typename Impl>
+bool WaitableEventBase<Impl>::isReady()
+{
+    return static_cast<Impl *>(this)->isReadyImpl();
+}
+
 template <typename Impl>
 void WaitableEventBase<Impl>::signal()
 {
@@ -143,10 +165,11 @@ class SingleThreadedWaitableEvent : public WaitableEventBase<SingleThreadedWaita
 
     void resetImpl();
     void waitImpl();
+    bool isReadyImpl();
     void signalImpl();
 
     // Wait, synchronously, on multiple events.
-    // returns the index of a WaitableEvent which has been signaled.
+    // returns the index of the first WaitableEvent which has been signaled.
     template <size_t Count>
     static size_t WaitMany(std::array<SingleThreadedWaitableEvent, Count> *waitables);
 };
@@ -160,6 +183,8 @@ size_t SingleThreadedWaitableEvent::WaitMany(
 }
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+struct AsyncTask;
+
 class AsyncWaitableEvent : public WaitableEventBase<AsyncWaitableEvent>
 {
   public:
@@ -172,25 +197,111 @@ class AsyncWaitableEvent : public WaitableEventBase<AsyncWaitableEvent>
 
     void resetImpl();
     void waitImpl();
+    bool isReadyImpl();
     void signalImpl();
 
-    // Wait, synchronously, on multiple events.
-    // returns the index of a WaitableEvent which has been signaled.
+    // Wait, synchronously, on multiple events. All the events must come from the same pool.
+    // returns the index of the first WaitableEvent which has been signaled.
     template <size_t Count>
     static size_t WaitMany(std::array<AsyncWaitableEvent, Count> *waitables);
 
   private:
     friend class AsyncWorkerPool;
-    void setFuture(std::future<void> &&future);
+    void setTask(const std::shared_ptr<AsyncTask> &task);
+
+    // Returns the index of the first event whose task is done, or Count if there is none.
+    // Called with the pool's mutex held.
+    template <size_t Count>
+    static size_t FindDone(std::array<AsyncWaitableEvent, Count> *waitables);
+
+    std::mutex *getPoolMutex() const;
+    std::condition_variable *getTaskDoneCondition() const;
+
+    std::shared_ptr<AsyncTask> mTask;
+};
+
+// State shared between a pool's worker threads and the events that it hands out. Outlives the
+// pool, so that events can still be queried after the pool is gone.
+struct AsyncPoolState
+{
+    AsyncPoolState() : stopping(false), idleThreads(0), nextSequence(0) {}
 
-    std::future<void> mFuture;
+    std::mutex mutex;
+    std::condition_variable taskPosted;
+    std::condition_variable taskDone;
+
+    // Ordered by priority, then by the order the tasks were posted in.
+    struct CompareTasks
+    {
+        bool operator()(const std::shared_ptr<AsyncTask> &a,
+                        const std::shared_ptr<AsyncTask> &b) const;
+    };
+    std::priority_queue<std::shared_ptr<AsyncTask>,
+                        std::vector<std::shared_ptr<AsyncTask>>,
+                        CompareTasks>
+        pendingTasks;
+
+    bool stopping;
+    size_t idleThreads;
+    uint64_t nextSequence;
+};
+
+struct AsyncTask
+{
+    Closure *closure;
+    TaskPriority priority;
+    uint64_t sequence;
+    bool done;
+    std::shared_ptr<AsyncPoolState> poolState;
 };
 
+template <size_t Count>
+// static
+size_t AsyncWaitableEvent::FindDone(std::array<AsyncWaitableEvent, Count> *waitables)
+{
+    for (size_t index = 0; index < Count; ++index)
+    {
+        const AsyncWaitableEvent &waitable = (*waitables)[index];
+        if (waitable.mSignaled || !waitable.mTask || waitable.mTask->done)
+        {
+            return index;
+        }
+    }
+    return Count;
+}
+
 template <size_t Count>
 // static
 size_t AsyncWaitableEvent::WaitMany(std::array<AsyncWaitableEvent, Count> *waitables)
 {
-    return WaitableEventBase<AsyncWaitableEvent>::WaitManyBase(waitables);
+    ASSERT(Count > 0);
+
+    std::mutex *poolMutex             = nullptr;
+    std::condition_variable *taskDone = nullptr;
+    for (const AsyncWaitableEvent &waitable : *waitables)
+    {
+        if (waitable.mTask)
+        {
+            ASSERT(!poolMutex || poolMutex == waitable.getPoolMutex());
+            poolMutex = waitable.getPoolMutex();
+            taskDone  = waitable.getTaskDoneCondition();
+        }
+    }
+
+    // Events that were never posted to a pool are always signaled.
+    size_t index = 0;
+    if (poolMutex)
+    {
+        std::unique_lock<std::mutex> lock(*poolMutex);
+        taskDone->wait(lock, [waitables, &index] {
+            index = FindDone(waitables);
+            return index < Count;
+        });
+    }
+
+    // Consumes the signal, the same way waiting on the event alone would.
+    (*waitables)[index].wait();
+    return index;
 }
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
@@ -217,7 +328,8 @@ struct WorkerThreadPoolTraits<AsyncWorkerPool>
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
 // Request WorkerThreads from the WorkerThreadPool. Each pool can keep worker threads around so
-// we avoid the costly spin up and spin down time.
+// we avoid the costly spin up and spin down time. Tasks must not wait on other tasks from the same
+// pool, since every thread could end up waiting on a task that is still queued.
 template <typename Impl>
 class WorkerThreadPoolBase : angle::NonCopyable
 {
@@ -229,11 +341,17 @@ class WorkerThreadPoolBase : angle::NonCopyable
 
     // Returns an event to wait on for the task to finish.
     // If the pool fails to create the task, returns null.
-    WaitableEventType postWorkerTask(Closure *task);
+    WaitableEventType postWorkerTask(Closure *task,
+                                     TaskPriority priority = TaskPriority::Normal);
+
+    size_t getMaxThreads() const { return mMaxThreads; }
+
+  private:
+    size_t mMaxThreads;
 };
 
 template <typename Impl>
-WorkerThreadPoolBase<Impl>::WorkerThreadPoolBase(size_t maxThreads)
+WorkerThreadPoolBase<Impl>::WorkerThreadPoolBase(size_t maxThreads) : mMaxThreads(maxThreads)
 {
 }
 
@@ -244,9 +362,10 @@ WorkerThreadPoolBase<Impl>::~WorkerThreadPoolBase()
 
 template <typename Impl>
 typename WorkerThreadPoolBase<Impl>::WaitableEventType WorkerThreadPoolBase<Impl>::postWorkerTask(
-    Closure *task)
+    Closure *task,
+    TaskPriority priority)
 {
-    return static_cast<Impl *>(this)->postWorkerTaskImpl(task);
+    return static_cast<Impl *>(this)->postWorkerTaskImpl(task, priority);
 }
 
 class SingleThreadedWorkerPool : public WorkerThreadPoolBase<SingleThreadedWorkerPool>
@@ -255,17 +374,25 @@ class SingleThreadedWorkerPool : public WorkerThreadPoolBase<SingleThreadedWorke
     SingleThreadedWorkerPool(size_t maxThreads);
     ~SingleThreadedWorkerPool();
 
-    SingleThreadedWaitableEvent postWorkerTaskImpl(Closure *task);
+    SingleThreadedWaitableEvent postWorkerTaskImpl(Closure *task, TaskPriority priority);
 };
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+// Starts threads as tasks are posted, up to maxThreads. Threads stay around until the pool is
+// destroyed, which finishes every task that was posted first.
 class AsyncWorkerPool : public WorkerThreadPoolBase<AsyncWorkerPool>
 {
   public:
     AsyncWorkerPool(size_t maxThreads);
     ~AsyncWorkerPool();
 
-    AsyncWaitableEvent postWorkerTaskImpl(Closure *task);
+    AsyncWaitableEvent postWorkerTaskImpl(Closure *task, TaskPriority priority);
+
+  private:
+    static void ThreadMain(std::shared_ptr<AsyncPoolState> state);
+
+    std::shared_ptr<AsyncPoolState> mState;
+    std::vector<std::thread> mThreads;
 };
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
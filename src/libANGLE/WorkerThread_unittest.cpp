@@ -7,6 +7,9 @@
 //   Simple tests for the worker thread class.
 
 #include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "libANGLE/WorkerThread.h"
@@ -48,7 +51,10 @@ TYPED_TEST(WorkerPoolTest, SimpleTask)
         this->workerPool.postWorkerTask(&tasks[2]), this->workerPool.postWorkerTask(&tasks[3]),
     }};
 
-    TypeParam::WaitableEventType::WaitMany(&waitables);
+    for (auto &waitable : waitables)
+    {
+        waitable.wait();
+    }
 
     for (const auto &task : tasks)
     {
@@ -56,4 +62,283 @@ TYPED_TEST(WorkerPoolTest, SimpleTask)
     }
 }
 
+// Tests that WaitMany returns the index of a task that has finished.
+TYPED_TEST(WorkerPoolTest, WaitMany)
+{
+    class TestTask : public Closure
+    {
+      public:
+        void operator()() override { fired = true; }
+
+        std::atomic<bool> fired{false};
+    };
+
+    std::array<TestTask, 4> tasks;
+    std::array<typename TypeParam::WaitableEventType, 4> waitables = {{
+        this->workerPool.postWorkerTask(&tasks[0]), this->workerPool.postWorkerTask(&tasks[1]),
+        this->workerPool.postWorkerTask(&tasks[2]), this->workerPool.postWorkerTask(&tasks[3]),
+    }};
+
+    size_t index = TypeParam::WaitableEventType::WaitMany(&waitables);
+    ASSERT_LT(index, tasks.size());
+    EXPECT_TRUE(tasks[index].fired);
+
+    for (auto &waitable : waitables)
+    {
+        waitable.wait();
+    }
+}
+
+class CountingTask : public Closure
+{
+  public:
+    CountingTask(std::atomic<size_t> *counter) : mCounter(counter) {}
+    void operator()() override { (*mCounter)++; }
+
+  private:
+    std::atomic<size_t> *mCounter;
+};
+
+// Tests that many threads can post to the same pool at once.
+TYPED_TEST(WorkerPoolTest, ContendedPosting)
+{
+    constexpr size_t kPostingThreadCount = 4;
+    constexpr size_t kTasksPerThread     = 256;
+
+    std::atomic<size_t> counter(0);
+
+    std::vector<std::thread> postingThreads;
+    for (size_t threadIndex = 0; threadIndex < kPostingThreadCount; ++threadIndex)
+    {
+        postingThreads.emplace_back([this, &counter] {
+            std::vector<CountingTask> tasks(kTasksPerThread, CountingTask(&counter));
+            std::vector<typename TypeParam::WaitableEventType> waitables;
+            for (CountingTask &task : tasks)
+            {
+                waitables.push_back(this->workerPool.postWorkerTask(&task));
+            }
+            for (auto &waitable : waitables)
+            {
+                waitable.wait();
+            }
+        });
+    }
+
+    for (std::thread &thread : postingThreads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(kPostingThreadCount * kTasksPerThread, counter.load());
+}
+
+// Tests that a large number of small tasks all run.
+TYPED_TEST(WorkerPoolTest, Throughput)
+{
+    constexpr size_t kTaskCount = 10000;
+
+    std::atomic<size_t> counter(0);
+    std::vector<CountingTask> tasks(kTaskCount, CountingTask(&counter));
+    std::vector<typename TypeParam::WaitableEventType> waitables;
+    waitables.reserve(kTaskCount);
+
+    for (CountingTask &task : tasks)
+    {
+        waitables.push_back(this->workerPool.postWorkerTask(&task));
+    }
+    for (auto &waitable : waitables)
+    {
+        waitable.wait();
+    }
+
+    EXPECT_EQ(kTaskCount, counter.load());
+}
+
+// Tests that a finished task's event reports that it is ready without waiting on it.
+TYPED_TEST(WorkerPoolTest, IsReady)
+{
+    class TestTask : public Closure
+    {
+      public:
+        void operator()() override { fired = true; }
+
+        bool fired = false;
+    };
+
+    TestTask task;
+    typename TypeParam::WaitableEventType waitable = this->workerPool.postWorkerTask(&task);
+
+    while (!waitable.isReady())
+    {
+    }
+
+    EXPECT_TRUE(task.fired);
+
+    waitable.wait();
+    EXPECT_TRUE(waitable.isReady());
+}
+
+#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+// Blocks the worker thread running it until release() is called.
+class BlockingTask : public Closure
+{
+  public:
+    void operator()() override
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mStarted = true;
+        mStartedCondition.notify_all();
+        mReleasedCondition.wait(lock, [this] { return mReleased; });
+    }
+
+    void waitUntilStarted()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mStartedCondition.wait(lock, [this] { return mStarted; });
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mReleased = true;
+        mReleasedCondition.notify_all();
+    }
+
+  private:
+    std::mutex mMutex;
+    std::condition_variable mStartedCondition;
+    std::condition_variable mReleasedCondition;
+    bool mStarted  = false;
+    bool mReleased = false;
+};
+
+// Tests that WaitMany returns as soon as one task is done, even if the others are still running.
+TEST(AsyncWorkerPoolTest, WaitManyReturnsFirstSignaled)
+{
+    priv::AsyncWorkerPool workerPool(2);
+
+    std::atomic<size_t> counter(0);
+    BlockingTask blockingTask;
+    CountingTask countingTask(&counter);
+
+    std::array<priv::AsyncWaitableEvent, 2> waitables = {
+        {workerPool.postWorkerTask(&blockingTask), workerPool.postWorkerTask(&countingTask)}};
+
+    EXPECT_EQ(1u, priv::AsyncWaitableEvent::WaitMany(&waitables));
+    EXPECT_EQ(1u, counter.load());
+    EXPECT_FALSE(waitables[0].isReady());
+
+    blockingTask.release();
+    waitables[0].wait();
+}
+
+// Tests that no more than maxThreads tasks run at the same time.
+TEST(AsyncWorkerPoolTest, BoundedThreadCount)
+{
+    constexpr size_t kMaxThreads = 2;
+    constexpr size_t kTaskCount  = 32;
+
+    class ConcurrencyTask : public Closure
+    {
+      public:
+        ConcurrencyTask(std::atomic<size_t> *running, std::atomic<size_t> *maxRunning)
+            : mRunning(running), mMaxRunning(maxRunning)
+        {
+        }
+
+        void operator()() override
+        {
+            size_t running    = ++(*mRunning);
+            size_t maxRunning = mMaxRunning->load();
+            while (running > maxRunning && !mMaxRunning->compare_exchange_weak(maxRunning, running))
+            {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            (*mRunning)--;
+        }
+
+      private:
+        std::atomic<size_t> *mRunning;
+        std::atomic<size_t> *mMaxRunning;
+    };
+
+    priv::AsyncWorkerPool workerPool(kMaxThreads);
+
+    std::atomic<size_t> running(0);
+    std::atomic<size_t> maxRunning(0);
+    std::vector<ConcurrencyTask> tasks(kTaskCount, ConcurrencyTask(&running, &maxRunning));
+    std::vector<priv::AsyncWaitableEvent> waitables;
+    for (ConcurrencyTask &task : tasks)
+    {
+        waitables.push_back(workerPool.postWorkerTask(&task));
+    }
+    for (auto &waitable : waitables)
+    {
+        waitable.wait();
+    }
+
+    EXPECT_GE(kMaxThreads, maxRunning.load());
+    EXPECT_LT(0u, maxRunning.load());
+}
+
+// Tests that queued tasks start in priority order, and in posting order within a priority.
+TEST(AsyncWorkerPoolTest, Priorities)
+{
+    class OrderTask : public Closure
+    {
+      public:
+        OrderTask(std::vector<int> *order, int id) : mOrder(order), mId(id) {}
+        void operator()() override { mOrder->push_back(mId); }
+
+      private:
+        std::vector<int> *mOrder;
+        int mId;
+    };
+
+    priv::AsyncWorkerPool workerPool(1);
+
+    // Keep the only thread busy so that the other tasks queue up behind it.
+    BlockingTask blockingTask;
+    priv::AsyncWaitableEvent blockingWaitable = workerPool.postWorkerTask(&blockingTask);
+    blockingTask.waitUntilStarted();
+
+    std::vector<int> order;
+    std::array<OrderTask, 5> tasks = {{OrderTask(&order, 0), OrderTask(&order, 1),
+                                       OrderTask(&order, 2), OrderTask(&order, 3),
+                                       OrderTask(&order, 4)}};
+    std::array<priv::AsyncWaitableEvent, 5> waitables = {
+        {workerPool.postWorkerTask(&tasks[0], TaskPriority::Low),
+         workerPool.postWorkerTask(&tasks[1], TaskPriority::Normal),
+         workerPool.postWorkerTask(&tasks[2], TaskPriority::High),
+         workerPool.postWorkerTask(&tasks[3], TaskPriority::Normal),
+         workerPool.postWorkerTask(&tasks[4], TaskPriority::High)}};
+
+    blockingTask.release();
+    blockingWaitable.wait();
+    for (auto &waitable : waitables)
+    {
+        waitable.wait();
+    }
+
+    EXPECT_EQ((std::vector<int>{2, 4, 1, 3, 0}), order);
+}
+
+// Tests that destroying the pool runs the tasks that are still queued.
+TEST(AsyncWorkerPoolTest, DestroyFinishesQueuedTasks)
+{
+    std::atomic<size_t> counter(0);
+    std::vector<CountingTask> tasks(64, CountingTask(&counter));
+
+    {
+        priv::AsyncWorkerPool workerPool(2);
+        for (CountingTask &task : tasks)
+        {
+            workerPool.postWorkerTask(&task);
+        }
+    }
+
+    EXPECT_EQ(tasks.size(), counter.load());
+}
+#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+
 }  // anonymous namespace
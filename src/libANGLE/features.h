@@ -52,14 +52,10 @@
 #define ANGLE_PROGRAM_LINK_VALIDATE_UNIFORM_PRECISION ANGLE_ENABLED
 #endif
 
-// Controls if our threading code uses std::async or falls back to single-threaded operations.
-// TODO(jmadill): Enable on Linux once STL chrono headers are updated.
+// Controls if our threading code uses a pool of std::threads or falls back to single-threaded
+// operations.
 #if !defined(ANGLE_STD_ASYNC_WORKERS)
-#if defined(ANGLE_PLATFORM_WINDOWS)
 #define ANGLE_STD_ASYNC_WORKERS ANGLE_ENABLED
-#else
-#define ANGLE_STD_ASYNC_WORKERS ANGLE_DISABLED
-#endif  // defined(ANGLE_PLATFORM_WINDOWS)
 #endif  // !defined(ANGLE_STD_ASYNC_WORKERS)
 
 #endif // LIBANGLE_FEATURES_H_
@@ -1004,6 +1004,9 @@ void QueryProgramiv(const Context *context, const Program *program, GLenum pname
         case GL_ACTIVE_ATOMIC_COUNTER_BUFFERS:
             *params = program->getActiveAtomicCounterBufferCount();
             break;
+        case GL_COMPLETION_STATUS_KHR:
+            *params = program->isLinking() ? GL_FALSE : GL_TRUE;
+            break;
         default:
             UNREACHABLE();
             break;
@@ -1088,6 +1091,9 @@ void QueryShaderiv(const Context *context, Shader *shader, GLenum pname, GLint *
         case GL_TRANSLATED_SHADER_SOURCE_LENGTH_ANGLE:
             *params = shader->getTranslatedSourceWithDebugInfoLength(context);
             return;
+        case GL_COMPLETION_STATUS_KHR:
+            *params = shader->isCompleted() ? GL_TRUE : GL_FALSE;
+            return;
         default:
             UNREACHABLE();
             break;
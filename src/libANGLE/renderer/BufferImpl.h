@@ -61,6 +61,16 @@ class BufferImpl : angle::NonCopyable
                                     bool primitiveRestartEnabled,
                                     gl::IndexRange *outRange) = 0;
 
+    // Computes the index ranges of blockCount consecutive blocks of blockSize bytes starting at
+    // offset, reading the buffer contents only once.
+    virtual gl::Error getBlockIndexRanges(const gl::Context *context,
+                                          GLenum type,
+                                          size_t offset,
+                                          size_t blockSize,
+                                          size_t blockCount,
+                                          bool primitiveRestartEnabled,
+                                          gl::IndexRange *outRanges) = 0;
+
   protected:
     const gl::BufferState &mState;
 };
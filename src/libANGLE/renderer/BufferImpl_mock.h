@@ -37,6 +37,14 @@ class MockBufferImpl : public BufferImpl
 
     MOCK_METHOD6(getIndexRange,
                  gl::Error(const gl::Context *, GLenum, size_t, size_t, bool, gl::IndexRange *));
+    MOCK_METHOD7(getBlockIndexRanges,
+                 gl::Error(const gl::Context *,
+                           GLenum,
+                           size_t,
+                           size_t,
+                           size_t,
+                           bool,
+                           gl::IndexRange *));
 
     MOCK_METHOD0(destructor, void());
 
@@ -1,7 +1,7 @@
 // GENERATED FILE - DO NOT EDIT.
 // Generated by gen_angle_format_table.py using data from angle_format_data.json
 //
-// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 //
@@ -17,9 +17,30 @@
 namespace angle
 {
 
-static constexpr rx::FastCopyFunctionMap::Entry BGRAEntry = {GL_RGBA, GL_UNSIGNED_BYTE,
-                                                             CopyBGRA8ToRGBA8};
-static constexpr rx::FastCopyFunctionMap BGRACopyFunctions = {&BGRAEntry, 1};
+static constexpr rx::FastCopyFunctionMap::Entry B8G8R8A8_UNORM_CopyEntries[] = {
+    {GL_RGBA, GL_UNSIGNED_BYTE, CopyBGRA8ToRGBA8},
+};
+static constexpr rx::FastCopyFunctionMap B8G8R8A8_UNORM_CopyFunctions = {
+    B8G8R8A8_UNORM_CopyEntries, ArraySize(B8G8R8A8_UNORM_CopyEntries)};
+
+static constexpr rx::FastCopyFunctionMap::Entry B8G8R8X8_UNORM_CopyEntries[] = {
+    {GL_RGBA, GL_UNSIGNED_BYTE, CopyBGRX8ToRGBA8},
+};
+static constexpr rx::FastCopyFunctionMap B8G8R8X8_UNORM_CopyFunctions = {
+    B8G8R8X8_UNORM_CopyEntries, ArraySize(B8G8R8X8_UNORM_CopyEntries)};
+
+static constexpr rx::FastCopyFunctionMap::Entry R16G16B16A16_FLOAT_CopyEntries[] = {
+    {GL_RGBA, GL_FLOAT, CopyRGBA16FToRGBA32F},
+};
+static constexpr rx::FastCopyFunctionMap R16G16B16A16_FLOAT_CopyFunctions = {
+    R16G16B16A16_FLOAT_CopyEntries, ArraySize(R16G16B16A16_FLOAT_CopyEntries)};
+
+static constexpr rx::FastCopyFunctionMap::Entry R8G8B8A8_UNORM_CopyEntries[] = {
+    {GL_BGRA_EXT, GL_UNSIGNED_BYTE, CopyRGBA8ToBGRA8},
+};
+static constexpr rx::FastCopyFunctionMap R8G8B8A8_UNORM_CopyFunctions = {
+    R8G8B8A8_UNORM_CopyEntries, ArraySize(R8G8B8A8_UNORM_CopyEntries)};
+
 static constexpr rx::FastCopyFunctionMap NoCopyFunctions;
 
 constexpr Format g_formatInfoTable[] = {
@@ -61,9 +82,9 @@ constexpr Format g_formatInfoTable[] = {
     { Format::ID::B5G6R5_UNORM, GL_BGR565_ANGLEX, GL_RGB565, GenerateMip<B5G6R5>, NoCopyFunctions, ReadColor<B5G6R5, GLfloat>, WriteColor<B5G6R5, GLfloat>, GL_UNSIGNED_NORMALIZED, 5, 6, 5, 0, 0, 0 },
     { Format::ID::B8G8R8A8_TYPELESS, GL_BGRA8_EXT, GL_BGRA8_EXT, GenerateMip<B8G8R8A8>, NoCopyFunctions, ReadColor<B8G8R8A8, GLfloat>, WriteColor<B8G8R8A8, GLfloat>, GL_UNSIGNED_NORMALIZED, 8, 8, 8, 8, 0, 0 },
     { Format::ID::B8G8R8A8_TYPELESS_SRGB, GL_BGRA8_SRGB_ANGLEX, GL_BGRA8_SRGB_ANGLEX, GenerateMip<B8G8R8A8>, NoCopyFunctions, ReadColor<B8G8R8A8, GLfloat>, WriteColor<B8G8R8A8, GLfloat>, GL_UNSIGNED_NORMALIZED, 8, 8, 8, 8, 0, 0 },
-    { Format::ID::B8G8R8A8_UNORM, GL_BGRA8_EXT, GL_BGRA8_EXT, GenerateMip<B8G8R8A8>, BGRACopyFunctions, ReadColor<B8G8R8A8, GLfloat>, WriteColor<B8G8R8A8, GLfloat>, GL_UNSIGNED_NORMALIZED, 8, 8, 8, 8, 0, 0 },
+    { Format::ID::B8G8R8A8_UNORM, GL_BGRA8_EXT, GL_BGRA8_EXT, GenerateMip<B8G8R8A8>, B8G8R8A8_UNORM_CopyFunctions, ReadColor<B8G8R8A8, GLfloat>, WriteColor<B8G8R8A8, GLfloat>, GL_UNSIGNED_NORMALIZED, 8, 8, 8, 8, 0, 0 },
     { Format::ID::B8G8R8A8_UNORM_SRGB, GL_BGRA8_SRGB_ANGLEX, GL_BGRA8_SRGB_ANGLEX, GenerateMip<B8G8R8A8>, NoCopyFunctions, ReadColor<B8G8R8A8, GLfloat>, WriteColor<B8G8R8A8, GLfloat>, GL_UNSIGNED_NORMALIZED, 8, 8, 8, 8, 0, 0 },
-    { Format::ID::B8G8R8X8_UNORM, GL_BGRA8_EXT, GL_BGRA8_EXT, GenerateMip<B8G8R8X8>, NoCopyFunctions, ReadColor<B8G8R8X8, GLfloat>, WriteColor<B8G8R8X8, GLfloat>, GL_UNSIGNED_NORMALIZED, 8, 8, 8, 0, 0, 0 },
+    { Format::ID::B8G8R8X8_UNORM, GL_BGRA8_EXT, GL_BGRA8_EXT, GenerateMip<B8G8R8X8>, B8G8R8X8_UNORM_CopyFunctions, ReadColor<B8G8R8X8, GLfloat>, WriteColor<B8G8R8X8, GLfloat>, GL_UNSIGNED_NORMALIZED, 8, 8, 8, 0, 0, 0 },
     { Format::ID::BC1_RGBA_UNORM_BLOCK, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0 },
     { Format::ID::BC1_RGBA_UNORM_SRGB_BLOCK, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0 },
     { Format::ID::BC1_RGB_UNORM_BLOCK, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0 },
@@ -72,6 +93,10 @@ constexpr Format g_formatInfoTable[] = {
     { Format::ID::BC2_RGBA_UNORM_SRGB_BLOCK, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0 },
     { Format::ID::BC3_RGBA_UNORM_BLOCK, GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0 },
     { Format::ID::BC3_RGBA_UNORM_SRGB_BLOCK, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0 },
+    { Format::ID::BC4_RED_SNORM_BLOCK, GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE, GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE, nullptr, NoCopyFunctions, nullptr, nullptr, GL_SIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0 },
+    { Format::ID::BC4_RED_UNORM_BLOCK, GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE, GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0 },
+    { Format::ID::BC5_RG_SNORM_BLOCK, GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE, GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE, nullptr, NoCopyFunctions, nullptr, nullptr, GL_SIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0 },
+    { Format::ID::BC5_RG_UNORM_BLOCK, GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE, GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0 },
     { Format::ID::D16_UNORM, GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT16, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 16, 0 },
     { Format::ID::D24_UNORM, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT24, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 24, 0 },
     { Format::ID::D24_UNORM_S8_UINT, GL_DEPTH24_STENCIL8, GL_DEPTH24_STENCIL8, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 24, 8 },
@@ -99,7 +124,7 @@ constexpr Format g_formatInfoTable[] = {
     { Format::ID::R10G10B10A2_UINT, GL_RGB10_A2UI, GL_RGB10_A2UI, GenerateMip<R10G10B10A2>, NoCopyFunctions, ReadColor<R10G10B10A2, GLuint>, WriteColor<R10G10B10A2, GLuint>, GL_UNSIGNED_INT, 10, 10, 10, 2, 0, 0 },
     { Format::ID::R10G10B10A2_UNORM, GL_RGB10_A2, GL_RGB10_A2, GenerateMip<R10G10B10A2>, NoCopyFunctions, ReadColor<R10G10B10A2, GLfloat>, WriteColor<R10G10B10A2, GLfloat>, GL_UNSIGNED_NORMALIZED, 10, 10, 10, 2, 0, 0 },
     { Format::ID::R11G11B10_FLOAT, GL_R11F_G11F_B10F, GL_R11F_G11F_B10F, GenerateMip<R11G11B10F>, NoCopyFunctions, ReadColor<R11G11B10F, GLfloat>, WriteColor<R11G11B10F, GLfloat>, GL_FLOAT, 11, 11, 10, 0, 0, 0 },
-    { Format::ID::R16G16B16A16_FLOAT, GL_RGBA16F, GL_RGBA16F, GenerateMip<R16G16B16A16F>, NoCopyFunctions, ReadColor<R16G16B16A16F, GLfloat>, WriteColor<R16G16B16A16F, GLfloat>, GL_FLOAT, 16, 16, 16, 16, 0, 0 },
+    { Format::ID::R16G16B16A16_FLOAT, GL_RGBA16F, GL_RGBA16F, GenerateMip<R16G16B16A16F>, R16G16B16A16_FLOAT_CopyFunctions, ReadColor<R16G16B16A16F, GLfloat>, WriteColor<R16G16B16A16F, GLfloat>, GL_FLOAT, 16, 16, 16, 16, 0, 0 },
     { Format::ID::R16G16B16A16_SINT, GL_RGBA16I, GL_RGBA16I, GenerateMip<R16G16B16A16S>, NoCopyFunctions, ReadColor<R16G16B16A16S, GLint>, WriteColor<R16G16B16A16S, GLint>, GL_INT, 16, 16, 16, 16, 0, 0 },
     { Format::ID::R16G16B16A16_SNORM, GL_RGBA16_SNORM_EXT, GL_RGBA16_SNORM_EXT, GenerateMip<R16G16B16A16S>, NoCopyFunctions, ReadColor<R16G16B16A16S, GLfloat>, WriteColor<R16G16B16A16S, GLfloat>, GL_SIGNED_NORMALIZED, 16, 16, 16, 16, 0, 0 },
     { Format::ID::R16G16B16A16_UINT, GL_RGBA16UI, GL_RGBA16UI, GenerateMip<R16G16B16A16>, NoCopyFunctions, ReadColor<R16G16B16A16, GLuint>, WriteColor<R16G16B16A16, GLuint>, GL_UNSIGNED_INT, 16, 16, 16, 16, 0, 0 },
@@ -139,7 +164,7 @@ constexpr Format g_formatInfoTable[] = {
     { Format::ID::R8G8B8A8_TYPELESS, GL_RGBA8, GL_RGBA8, GenerateMip<R8G8B8A8>, NoCopyFunctions, ReadColor<R8G8B8A8, GLfloat>, WriteColor<R8G8B8A8, GLfloat>, GL_UNSIGNED_NORMALIZED, 8, 8, 8, 8, 0, 0 },
     { Format::ID::R8G8B8A8_TYPELESS_SRGB, GL_SRGB8_ALPHA8, GL_SRGB8_ALPHA8, GenerateMip<R8G8B8A8>, NoCopyFunctions, ReadColor<R8G8B8A8, GLfloat>, WriteColor<R8G8B8A8, GLfloat>, GL_UNSIGNED_NORMALIZED, 8, 8, 8, 8, 0, 0 },
     { Format::ID::R8G8B8A8_UINT, GL_RGBA8UI, GL_RGBA8UI, GenerateMip<R8G8B8A8>, NoCopyFunctions, ReadColor<R8G8B8A8, GLuint>, WriteColor<R8G8B8A8, GLuint>, GL_UNSIGNED_INT, 8, 8, 8, 8, 0, 0 },
-    { Format::ID::R8G8B8A8_UNORM, GL_RGBA8, GL_RGBA8, GenerateMip<R8G8B8A8>, NoCopyFunctions, ReadColor<R8G8B8A8, GLfloat>, WriteColor<R8G8B8A8, GLfloat>, GL_UNSIGNED_NORMALIZED, 8, 8, 8, 8, 0, 0 },
+    { Format::ID::R8G8B8A8_UNORM, GL_RGBA8, GL_RGBA8, GenerateMip<R8G8B8A8>, R8G8B8A8_UNORM_CopyFunctions, ReadColor<R8G8B8A8, GLfloat>, WriteColor<R8G8B8A8, GLfloat>, GL_UNSIGNED_NORMALIZED, 8, 8, 8, 8, 0, 0 },
     { Format::ID::R8G8B8A8_UNORM_SRGB, GL_SRGB8_ALPHA8, GL_SRGB8_ALPHA8, GenerateMip<R8G8B8A8SRGB>, NoCopyFunctions, ReadColor<R8G8B8A8SRGB, GLfloat>, WriteColor<R8G8B8A8SRGB, GLfloat>, GL_UNSIGNED_NORMALIZED, 8, 8, 8, 8, 0, 0 },
     { Format::ID::R8G8B8_SINT, GL_RGB8I, GL_RGB8I, GenerateMip<R8G8B8S>, NoCopyFunctions, ReadColor<R8G8B8S, GLint>, WriteColor<R8G8B8S, GLint>, GL_INT, 8, 8, 8, 0, 0, 0 },
     { Format::ID::R8G8B8_SNORM, GL_RGB8_SNORM, GL_RGB8_SNORM, GenerateMip<R8G8B8S>, NoCopyFunctions, ReadColor<R8G8B8S, GLfloat>, WriteColor<R8G8B8S, GLfloat>, GL_SIGNED_NORMALIZED, 8, 8, 8, 0, 0, 0 },
@@ -165,273 +190,281 @@ Format::ID Format::InternalFormatToID(GLenum internalFormat)
     switch (internalFormat)
     {
         case GL_RGBA16_EXT:
-            return Format::ID::R16G16B16A16_UNORM;
+return Format::ID::R16G16B16A16_UNORM;
         case GL_ETC1_RGB8_LOSSY_DECODE_ANGLE:
-            return Format::ID::ETC1_LOSSY_DECODE_R8G8B8_UNORM_BLOCK;
+return Format::ID::ETC1_LOSSY_DECODE_R8G8B8_UNORM_BLOCK;
         case GL_RG8I:
-            return Format::ID::R8G8_SINT;
+return Format::ID::R8G8_SINT;
         case GL_R16F:
-            return Format::ID::R16_FLOAT;
+return Format::ID::R16_FLOAT;
         case GL_RGBA8I:
-            return Format::ID::R8G8B8A8_SINT;
+return Format::ID::R8G8B8A8_SINT;
         case GL_RG8UI:
-            return Format::ID::R8G8_UINT;
+return Format::ID::R8G8_UINT;
         case GL_RGBA8_SNORM:
-            return Format::ID::R8G8B8A8_SNORM;
+return Format::ID::R8G8B8A8_SNORM;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR:
-            return Format::ID::ASTC_12x10_SRGB_BLOCK;
+return Format::ID::ASTC_12x10_SRGB_BLOCK;
         case GL_RG8_SNORM:
-            return Format::ID::R8G8_SNORM;
+return Format::ID::R8G8_SNORM;
         case GL_BGR565_ANGLEX:
-            return Format::ID::B5G6R5_UNORM;
+return Format::ID::B5G6R5_UNORM;
         case GL_DEPTH_COMPONENT24:
-            return Format::ID::D24_UNORM;
+return Format::ID::D24_UNORM;
         case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
-            return Format::ID::ETC2_R8G8B8A1_UNORM_BLOCK;
+return Format::ID::ETC2_R8G8B8A1_UNORM_BLOCK;
         case GL_COMPRESSED_RGBA_ASTC_10x10_KHR:
-            return Format::ID::ASTC_10x10_UNORM_BLOCK;
+return Format::ID::ASTC_10x10_UNORM_BLOCK;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR:
-            return Format::ID::ASTC_8x6_SRGB_BLOCK;
+return Format::ID::ASTC_8x6_SRGB_BLOCK;
         case GL_RGB32UI:
-            return Format::ID::R32G32B32_UINT;
+return Format::ID::R32G32B32_UINT;
         case GL_COMPRESSED_RGBA_ASTC_6x5_KHR:
-            return Format::ID::ASTC_6x5_UNORM_BLOCK;
+return Format::ID::ASTC_6x5_UNORM_BLOCK;
         case GL_ALPHA32F_EXT:
-            return Format::ID::A32_FLOAT;
+return Format::ID::A32_FLOAT;
         case GL_R16UI:
-            return Format::ID::R16_UINT;
+return Format::ID::R16_UINT;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR:
-            return Format::ID::ASTC_5x4_SRGB_BLOCK;
+return Format::ID::ASTC_5x4_SRGB_BLOCK;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR:
-            return Format::ID::ASTC_5x5_SRGB_BLOCK;
+return Format::ID::ASTC_5x5_SRGB_BLOCK;
         case GL_COMPRESSED_R11_EAC:
-            return Format::ID::EAC_R11_UNORM_BLOCK;
+return Format::ID::EAC_R11_UNORM_BLOCK;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR:
-            return Format::ID::ASTC_10x10_SRGB_BLOCK;
+return Format::ID::ASTC_10x10_SRGB_BLOCK;
         case GL_RGBA32UI:
-            return Format::ID::R32G32B32A32_UINT;
+return Format::ID::R32G32B32A32_UINT;
         case GL_R8_SNORM:
-            return Format::ID::R8_SNORM;
+return Format::ID::R8_SNORM;
         case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT:
-            return Format::ID::BC1_RGBA_UNORM_SRGB_BLOCK;
+return Format::ID::BC1_RGBA_UNORM_SRGB_BLOCK;
         case GL_LUMINANCE32F_EXT:
-            return Format::ID::L32_FLOAT;
+return Format::ID::L32_FLOAT;
         case GL_RG16_EXT:
-            return Format::ID::R16G16_UNORM;
+return Format::ID::R16G16_UNORM;
         case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2:
-            return Format::ID::ETC2_R8G8B8A1_SRGB_BLOCK;
+return Format::ID::ETC2_R8G8B8A1_SRGB_BLOCK;
         case GL_SRGB8:
-            return Format::ID::R8G8B8_UNORM_SRGB;
+return Format::ID::R8G8B8_UNORM_SRGB;
         case GL_LUMINANCE8_ALPHA8_EXT:
-            return Format::ID::L8A8_UNORM;
+return Format::ID::L8A8_UNORM;
         case GL_BGRX8_ANGLEX:
-            return Format::ID::B8G8R8X8_UNORM;
+return Format::ID::B8G8R8X8_UNORM;
         case GL_RGB16_SNORM_EXT:
-            return Format::ID::R16G16B16_SNORM;
+return Format::ID::R16G16B16_SNORM;
         case GL_BGRA8_TYPELESS_SRGB_ANGLEX:
-            return Format::ID::B8G8R8A8_TYPELESS_SRGB;
+return Format::ID::B8G8R8A8_TYPELESS_SRGB;
         case GL_RGBA8UI:
-            return Format::ID::R8G8B8A8_UINT;
+return Format::ID::R8G8B8A8_UINT;
         case GL_BGRA4_ANGLEX:
-            return Format::ID::B4G4R4A4_UNORM;
+return Format::ID::B4G4R4A4_UNORM;
         case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
-            return Format::ID::ETC2_R8G8B8A8_SRGB_BLOCK;
+return Format::ID::ETC2_R8G8B8A8_SRGB_BLOCK;
         case GL_LUMINANCE8_EXT:
-            return Format::ID::L8_UNORM;
+return Format::ID::L8_UNORM;
         case GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE:
-            return Format::ID::BC3_RGBA_UNORM_BLOCK;
+return Format::ID::BC3_RGBA_UNORM_BLOCK;
         case GL_R16I:
-            return Format::ID::R16_SINT;
+return Format::ID::R16_SINT;
         case GL_BGRA8_TYPELESS_ANGLEX:
-            return Format::ID::B8G8R8A8_TYPELESS;
+return Format::ID::B8G8R8A8_TYPELESS;
         case GL_RGB5_A1:
-            return Format::ID::R5G5B5A1_UNORM;
+return Format::ID::R5G5B5A1_UNORM;
         case GL_RGB16UI:
-            return Format::ID::R16G16B16_UINT;
-        case GL_COMPRESSED_RGBA_ASTC_4x4_KHR:
-            return Format::ID::ASTC_4x4_UNORM_BLOCK;
+return Format::ID::R16G16B16_UINT;
+        case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+return Format::ID::BC4_RED_SNORM_BLOCK;
         case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT:
-            return Format::ID::BC2_RGBA_UNORM_SRGB_BLOCK;
+return Format::ID::BC2_RGBA_UNORM_SRGB_BLOCK;
         case GL_R16_SNORM_EXT:
-            return Format::ID::R16_SNORM;
+return Format::ID::R16_SNORM;
         case GL_COMPRESSED_RGB8_ETC2:
-            return Format::ID::ETC2_R8G8B8_UNORM_BLOCK;
+return Format::ID::ETC2_R8G8B8_UNORM_BLOCK;
         case GL_COMPRESSED_SRGB_S3TC_DXT1_EXT:
-            return Format::ID::BC1_RGB_UNORM_SRGB_BLOCK;
+return Format::ID::BC1_RGB_UNORM_SRGB_BLOCK;
         case GL_RGBA32F:
-            return Format::ID::R32G32B32A32_FLOAT;
+return Format::ID::R32G32B32A32_FLOAT;
         case GL_RGBA32I:
-            return Format::ID::R32G32B32A32_SINT;
+return Format::ID::R32G32B32A32_SINT;
         case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT:
-            return Format::ID::BC3_RGBA_UNORM_SRGB_BLOCK;
+return Format::ID::BC3_RGBA_UNORM_SRGB_BLOCK;
         case GL_COMPRESSED_RGBA_ASTC_8x5_KHR:
-            return Format::ID::ASTC_8x5_UNORM_BLOCK;
+return Format::ID::ASTC_8x5_UNORM_BLOCK;
         case GL_RG8:
-            return Format::ID::R8G8_UNORM;
+return Format::ID::R8G8_UNORM;
         case GL_COMPRESSED_RGBA_ASTC_8x8_KHR:
-            return Format::ID::ASTC_8x8_UNORM_BLOCK;
+return Format::ID::ASTC_8x8_UNORM_BLOCK;
         case GL_RGB10_A2:
-            return Format::ID::R10G10B10A2_UNORM;
+return Format::ID::R10G10B10A2_UNORM;
         case GL_COMPRESSED_SIGNED_RG11_EAC:
-            return Format::ID::EAC_R11G11_SNORM_BLOCK;
+return Format::ID::EAC_R11G11_SNORM_BLOCK;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR:
-            return Format::ID::ASTC_6x6_SRGB_BLOCK;
+return Format::ID::ASTC_6x6_SRGB_BLOCK;
         case GL_DEPTH_COMPONENT16:
-            return Format::ID::D16_UNORM;
+return Format::ID::D16_UNORM;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR:
-            return Format::ID::ASTC_10x5_SRGB_BLOCK;
+return Format::ID::ASTC_10x5_SRGB_BLOCK;
         case GL_RGB32I:
-            return Format::ID::R32G32B32_SINT;
+return Format::ID::R32G32B32_SINT;
         case GL_R8:
-            return Format::ID::R8_UNORM;
+return Format::ID::R8_UNORM;
         case GL_RGB32F:
-            return Format::ID::R32G32B32_FLOAT;
+return Format::ID::R32G32B32_FLOAT;
+        case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
+return Format::ID::BC5_RG_SNORM_BLOCK;
         case GL_RGBA8_TYPELESS_SRGB_ANGLEX:
-            return Format::ID::R8G8B8A8_TYPELESS_SRGB;
+return Format::ID::R8G8B8A8_TYPELESS_SRGB;
         case GL_R16_EXT:
-            return Format::ID::R16_UNORM;
+return Format::ID::R16_UNORM;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR:
-            return Format::ID::ASTC_8x8_SRGB_BLOCK;
+return Format::ID::ASTC_8x8_SRGB_BLOCK;
         case GL_COMPRESSED_RGBA_ASTC_10x5_KHR:
-            return Format::ID::ASTC_10x5_UNORM_BLOCK;
+return Format::ID::ASTC_10x5_UNORM_BLOCK;
         case GL_R11F_G11F_B10F:
-            return Format::ID::R11G11B10_FLOAT;
+return Format::ID::R11G11B10_FLOAT;
         case GL_RGB8:
-            return Format::ID::R8G8B8_UNORM;
+return Format::ID::R8G8B8_UNORM;
         case GL_COMPRESSED_RGBA_ASTC_5x5_KHR:
-            return Format::ID::ASTC_5x5_UNORM_BLOCK;
+return Format::ID::ASTC_5x5_UNORM_BLOCK;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR:
-            return Format::ID::ASTC_8x5_SRGB_BLOCK;
+return Format::ID::ASTC_8x5_SRGB_BLOCK;
         case GL_RGBA16I:
-            return Format::ID::R16G16B16A16_SINT;
+return Format::ID::R16G16B16A16_SINT;
         case GL_R8I:
-            return Format::ID::R8_SINT;
+return Format::ID::R8_SINT;
         case GL_RGB8_SNORM:
-            return Format::ID::R8G8B8_SNORM;
+return Format::ID::R8G8B8_SNORM;
         case GL_RG32F:
-            return Format::ID::R32G32_FLOAT;
+return Format::ID::R32G32_FLOAT;
         case GL_DEPTH_COMPONENT32F:
-            return Format::ID::D32_FLOAT;
+return Format::ID::D32_FLOAT;
         case GL_RG32I:
-            return Format::ID::R32G32_SINT;
+return Format::ID::R32G32_SINT;
         case GL_ALPHA8_EXT:
-            return Format::ID::A8_UNORM;
+return Format::ID::A8_UNORM;
         case GL_RGB16_EXT:
-            return Format::ID::R16G16B16_UNORM;
+return Format::ID::R16G16B16_UNORM;
         case GL_BGRA8_EXT:
-            return Format::ID::B8G8R8A8_UNORM;
+return Format::ID::B8G8R8A8_UNORM;
         case GL_RG32UI:
-            return Format::ID::R32G32_UINT;
+return Format::ID::R32G32_UINT;
         case GL_RGBA16UI:
-            return Format::ID::R16G16B16A16_UINT;
+return Format::ID::R16G16B16A16_UINT;
         case GL_COMPRESSED_RGBA8_ETC2_EAC:
-            return Format::ID::ETC2_R8G8B8A8_UNORM_BLOCK;
+return Format::ID::ETC2_R8G8B8A8_UNORM_BLOCK;
         case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
-            return Format::ID::BC1_RGBA_UNORM_BLOCK;
+return Format::ID::BC1_RGBA_UNORM_BLOCK;
         case GL_COMPRESSED_RGBA_ASTC_10x6_KHR:
-            return Format::ID::ASTC_10x6_UNORM_BLOCK;
+return Format::ID::ASTC_10x6_UNORM_BLOCK;
+        case GL_COMPRESSED_RGBA_ASTC_4x4_KHR:
+return Format::ID::ASTC_4x4_UNORM_BLOCK;
         case GL_COMPRESSED_SRGB8_ETC2:
-            return Format::ID::ETC2_R8G8B8_SRGB_BLOCK;
+return Format::ID::ETC2_R8G8B8_SRGB_BLOCK;
         case GL_BGRA8_SRGB_ANGLEX:
-            return Format::ID::B8G8R8A8_UNORM_SRGB;
+return Format::ID::B8G8R8A8_UNORM_SRGB;
         case GL_DEPTH32F_STENCIL8:
-            return Format::ID::D32_FLOAT_S8X24_UINT;
+return Format::ID::D32_FLOAT_S8X24_UINT;
         case GL_COMPRESSED_RGBA_ASTC_6x6_KHR:
-            return Format::ID::ASTC_6x6_UNORM_BLOCK;
+return Format::ID::ASTC_6x6_UNORM_BLOCK;
         case GL_R32UI:
-            return Format::ID::R32_UINT;
+return Format::ID::R32_UINT;
         case GL_BGR5_A1_ANGLEX:
-            return Format::ID::B5G5R5A1_UNORM;
+return Format::ID::B5G5R5A1_UNORM;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR:
-            return Format::ID::ASTC_12x12_SRGB_BLOCK;
+return Format::ID::ASTC_12x12_SRGB_BLOCK;
         case GL_COMPRESSED_RG11_EAC:
-            return Format::ID::EAC_R11G11_UNORM_BLOCK;
+return Format::ID::EAC_R11G11_UNORM_BLOCK;
         case GL_SRGB8_ALPHA8:
-            return Format::ID::R8G8B8A8_UNORM_SRGB;
+return Format::ID::R8G8B8A8_UNORM_SRGB;
         case GL_LUMINANCE_ALPHA16F_EXT:
-            return Format::ID::L16A16_FLOAT;
+return Format::ID::L16A16_FLOAT;
         case GL_RGBA:
-            return Format::ID::R8G8B8A8_UNORM;
+return Format::ID::R8G8B8A8_UNORM;
         case GL_ETC1_RGB8_OES:
-            return Format::ID::ETC1_R8G8B8_UNORM_BLOCK;
+return Format::ID::ETC1_R8G8B8_UNORM_BLOCK;
         case GL_DEPTH24_STENCIL8:
-            return Format::ID::D24_UNORM_S8_UINT;
+return Format::ID::D24_UNORM_S8_UINT;
+        case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+return Format::ID::BC5_RG_UNORM_BLOCK;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR:
-            return Format::ID::ASTC_4x4_SRGB_BLOCK;
+return Format::ID::ASTC_4x4_SRGB_BLOCK;
         case GL_RGB16I:
-            return Format::ID::R16G16B16_SINT;
+return Format::ID::R16G16B16_SINT;
         case GL_R8UI:
-            return Format::ID::R8_UINT;
+return Format::ID::R8_UINT;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR:
-            return Format::ID::ASTC_10x6_SRGB_BLOCK;
+return Format::ID::ASTC_10x6_SRGB_BLOCK;
         case GL_RGBA16F:
-            return Format::ID::R16G16B16A16_FLOAT;
+return Format::ID::R16G16B16A16_FLOAT;
         case GL_COMPRESSED_SIGNED_R11_EAC:
-            return Format::ID::EAC_R11_SNORM_BLOCK;
+return Format::ID::EAC_R11_SNORM_BLOCK;
         case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
-            return Format::ID::BC1_RGB_UNORM_BLOCK;
+return Format::ID::BC1_RGB_UNORM_BLOCK;
         case GL_RGB8I:
-            return Format::ID::R8G8B8_SINT;
+return Format::ID::R8G8B8_SINT;
         case GL_COMPRESSED_RGBA_ASTC_8x6_KHR:
-            return Format::ID::ASTC_8x6_UNORM_BLOCK;
+return Format::ID::ASTC_8x6_UNORM_BLOCK;
         case GL_STENCIL_INDEX8:
-            return Format::ID::S8_UINT;
+return Format::ID::S8_UINT;
         case GL_LUMINANCE_ALPHA32F_EXT:
-            return Format::ID::L32A32_FLOAT;
+return Format::ID::L32A32_FLOAT;
         case GL_ALPHA16F_EXT:
-            return Format::ID::A16_FLOAT;
+return Format::ID::A16_FLOAT;
         case GL_RGB8UI:
-            return Format::ID::R8G8B8_UINT;
+return Format::ID::R8G8B8_UINT;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR:
-            return Format::ID::ASTC_10x8_SRGB_BLOCK;
+return Format::ID::ASTC_10x8_SRGB_BLOCK;
         case GL_RGBA8_TYPELESS_ANGLEX:
-            return Format::ID::R8G8B8A8_TYPELESS;
+return Format::ID::R8G8B8A8_TYPELESS;
         case GL_COMPRESSED_RGBA_ASTC_12x10_KHR:
-            return Format::ID::ASTC_12x10_UNORM_BLOCK;
+return Format::ID::ASTC_12x10_UNORM_BLOCK;
         case GL_RGB9_E5:
-            return Format::ID::R9G9B9E5_SHAREDEXP;
+return Format::ID::R9G9B9E5_SHAREDEXP;
+        case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+return Format::ID::BC4_RED_UNORM_BLOCK;
         case GL_RGBA16_SNORM_EXT:
-            return Format::ID::R16G16B16A16_SNORM;
+return Format::ID::R16G16B16A16_SNORM;
         case GL_R32I:
-            return Format::ID::R32_SINT;
+return Format::ID::R32_SINT;
         case GL_DEPTH_COMPONENT32_OES:
-            return Format::ID::D32_UNORM;
+return Format::ID::D32_UNORM;
         case GL_R32F:
-            return Format::ID::R32_FLOAT;
+return Format::ID::R32_FLOAT;
         case GL_NONE:
-            return Format::ID::NONE;
+return Format::ID::NONE;
         case GL_RG16F:
-            return Format::ID::R16G16_FLOAT;
+return Format::ID::R16G16_FLOAT;
         case GL_RGB:
-            return Format::ID::R8G8B8_UNORM;
+return Format::ID::R8G8B8_UNORM;
         case GL_RGB565:
-            return Format::ID::R5G6B5_UNORM;
+return Format::ID::R5G6B5_UNORM;
         case GL_LUMINANCE16F_EXT:
-            return Format::ID::L16_FLOAT;
+return Format::ID::L16_FLOAT;
         case GL_RG16UI:
-            return Format::ID::R16G16_UINT;
+return Format::ID::R16G16_UINT;
         case GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE:
-            return Format::ID::BC2_RGBA_UNORM_BLOCK;
+return Format::ID::BC2_RGBA_UNORM_BLOCK;
         case GL_RG16I:
-            return Format::ID::R16G16_SINT;
+return Format::ID::R16G16_SINT;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR:
-            return Format::ID::ASTC_6x5_SRGB_BLOCK;
+return Format::ID::ASTC_6x5_SRGB_BLOCK;
         case GL_RG16_SNORM_EXT:
-            return Format::ID::R16G16_SNORM;
+return Format::ID::R16G16_SNORM;
         case GL_COMPRESSED_RGBA_ASTC_12x12_KHR:
-            return Format::ID::ASTC_12x12_UNORM_BLOCK;
+return Format::ID::ASTC_12x12_UNORM_BLOCK;
         case GL_COMPRESSED_RGBA_ASTC_5x4_KHR:
-            return Format::ID::ASTC_5x4_UNORM_BLOCK;
+return Format::ID::ASTC_5x4_UNORM_BLOCK;
         case GL_COMPRESSED_RGBA_ASTC_10x8_KHR:
-            return Format::ID::ASTC_10x8_UNORM_BLOCK;
+return Format::ID::ASTC_10x8_UNORM_BLOCK;
         case GL_RGBA4:
-            return Format::ID::R4G4B4A4_UNORM;
+return Format::ID::R4G4B4A4_UNORM;
         case GL_RGBA8:
-            return Format::ID::R8G8B8A8_UNORM;
+return Format::ID::R8G8B8A8_UNORM;
         case GL_RGB16F:
-            return Format::ID::R16G16B16_FLOAT;
+return Format::ID::R16G16B16_FLOAT;
         case GL_RGB10_A2UI:
-            return Format::ID::R10G10B10A2_UINT;
+return Format::ID::R10G10B10A2_UINT;
         default:
             return Format::ID::NONE;
     }
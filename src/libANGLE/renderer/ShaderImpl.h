@@ -24,8 +24,11 @@ class ShaderImpl : angle::NonCopyable
     // Returns additional sh::Compile options.
     virtual ShCompileOptions prepareSourceAndReturnOptions(std::stringstream *sourceStream,
                                                            std::string *sourcePath) = 0;
-    // Returns success for compiling on the driver. Returns success.
-    virtual bool postTranslateCompile(gl::Compiler *compiler, std::string *infoLog) = 0;
+    // Returns success for compiling on the driver. Returns success. The compiler handle holds the
+    // results of the translation.
+    virtual bool postTranslateCompile(gl::Compiler *compiler,
+                                      ShHandle compilerHandle,
+                                      std::string *infoLog) = 0;
 
     virtual std::string getDebugInfo() const = 0;
 
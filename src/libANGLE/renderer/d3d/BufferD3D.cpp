@@ -187,4 +187,20 @@ gl::Error BufferD3D::getIndexRange(const gl::Context *context,
     return gl::NoError();
 }
 
+gl::Error BufferD3D::getBlockIndexRanges(const gl::Context *context,
+                                         GLenum type,
+                                         size_t offset,
+                                         size_t blockSize,
+                                         size_t blockCount,
+                                         bool primitiveRestartEnabled,
+                                         gl::IndexRange *outRanges)
+{
+    const uint8_t *data = nullptr;
+    ANGLE_TRY(getData(context, &data));
+
+    gl::ComputeBlockIndexRanges(type, data + offset, blockSize, blockCount,
+                                primitiveRestartEnabled, outRanges);
+    return gl::NoError();
+}
+
 }  // namespace rx
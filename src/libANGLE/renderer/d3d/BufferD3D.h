@@ -63,6 +63,13 @@ class BufferD3D : public BufferImpl
                             size_t count,
                             bool primitiveRestartEnabled,
                             gl::IndexRange *outRange) override;
+    gl::Error getBlockIndexRanges(const gl::Context *context,
+                                  GLenum type,
+                                  size_t offset,
+                                  size_t blockSize,
+                                  size_t blockCount,
+                                  bool primitiveRestartEnabled,
+                                  gl::IndexRange *outRanges) override;
 
     BufferFactoryD3D *getFactory() const { return mFactory; }
     D3DBufferUsage getUsage() const { return mUsage; }
@@ -1594,11 +1594,16 @@ gl::LinkResult ProgramD3D::compileProgramExecutables(const gl::Context *context,
     GetPixelExecutableTask pixelTask(this);
     GetGeometryExecutableTask geometryTask(this, context);
 
-    std::array<WaitableEvent, 3> waitEvents = {{workerPool->postWorkerTask(&vertexTask),
-                                                workerPool->postWorkerTask(&pixelTask),
-                                                workerPool->postWorkerTask(&geometryTask)}};
+    // The link blocks until all three are done, so they go ahead of other queued work.
+    std::array<WaitableEvent, 3> waitEvents = {
+        {workerPool->postWorkerTask(&vertexTask, TaskPriority::High),
+         workerPool->postWorkerTask(&pixelTask, TaskPriority::High),
+         workerPool->postWorkerTask(&geometryTask, TaskPriority::High)}};
 
-    WaitableEvent::WaitMany(&waitEvents);
+    for (WaitableEvent &waitEvent : waitEvents)
+    {
+        waitEvent.wait();
+    }
 
     if (!vertexTask.getInfoLog().empty())
     {
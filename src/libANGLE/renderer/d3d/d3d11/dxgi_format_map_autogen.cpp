@@ -318,17 +318,17 @@ const Format &GetFormat(DXGI_FORMAT dxgiFormat)
         case DXGI_FORMAT_BC3_UNORM_SRGB:
             return Format::Get(Format::ID::BC3_RGBA_UNORM_SRGB_BLOCK);
         case DXGI_FORMAT_BC4_SNORM:
-            break;
+            return Format::Get(Format::ID::BC4_RED_SNORM_BLOCK);
         case DXGI_FORMAT_BC4_TYPELESS:
             break;
         case DXGI_FORMAT_BC4_UNORM:
-            break;
+            return Format::Get(Format::ID::BC4_RED_UNORM_BLOCK);
         case DXGI_FORMAT_BC5_SNORM:
-            break;
+            return Format::Get(Format::ID::BC5_RG_SNORM_BLOCK);
         case DXGI_FORMAT_BC5_TYPELESS:
             break;
         case DXGI_FORMAT_BC5_UNORM:
-            break;
+            return Format::Get(Format::ID::BC5_RG_UNORM_BLOCK);
         case DXGI_FORMAT_BC6H_SF16:
             break;
         case DXGI_FORMAT_BC6H_TYPELESS:
@@ -56,9 +56,7 @@ template_autogen_inl = """// GENERATED FILE - DO NOT EDIT.
 namespace angle
 {{
 
-static constexpr rx::FastCopyFunctionMap::Entry BGRAEntry = {{GL_RGBA, GL_UNSIGNED_BYTE,
-                                                             CopyBGRA8ToRGBA8}};
-static constexpr rx::FastCopyFunctionMap BGRACopyFunctions = {{&BGRAEntry, 1}};
+{fast_copy_functions}
 static constexpr rx::FastCopyFunctionMap NoCopyFunctions;
 
 constexpr Format g_formatInfoTable[] = {{
@@ -146,6 +144,31 @@ def get_color_write_function(angle_format):
     return 'WriteColor<' + channel_struct + ', '+ write_component_type + '>'
 
 
+fast_copy_entry_template = """    {{{format}, {type}, {function}}},
+"""
+
+fast_copy_map_template = """static constexpr rx::FastCopyFunctionMap::Entry {id}_CopyEntries[] = {{
+{entries}}};
+static constexpr rx::FastCopyFunctionMap {id}_CopyFunctions = {{
+    {id}_CopyEntries, ArraySize({id}_CopyEntries)}};
+"""
+
+def get_fast_copy_functions_name(format_id, json):
+    if "fastCopyFunctions" not in json:
+        return "NoCopyFunctions"
+    return format_id + "_CopyFunctions"
+
+def gen_fast_copy_functions(all_angle, json_data):
+    maps = []
+    for format_id in sorted(all_angle):
+        if format_id not in json_data or "fastCopyFunctions" not in json_data[format_id]:
+            continue
+        entries = ""
+        for entry in json_data[format_id]["fastCopyFunctions"]:
+            entries += fast_copy_entry_template.format(**entry)
+        maps.append(fast_copy_map_template.format(id = format_id, entries = entries))
+    return "\n".join(maps)
+
 format_entry_template = """    {{ Format::ID::{id}, {glInternalFormat}, {fboImplementationInternalFormat}, {mipGenerationFunction}, {fastCopyFunctions}, {colorReadFunction}, {colorWriteFunction}, {namedComponentType}, {R}, {G}, {B}, {A}, {D}, {S} }},
 """
 
@@ -171,12 +194,13 @@ def json_to_table_data(format_id, json, angle_to_gl):
 
     parsed = {
         "id": format_id,
-        "fastCopyFunctions": "NoCopyFunctions",
     }
 
     for k, v in json.iteritems():
         parsed[k] = v
 
+    parsed["fastCopyFunctions"] = get_fast_copy_functions_name(format_id, json)
+
     if "glInternalFormat" not in parsed:
         parsed["glInternalFormat"] = angle_to_gl[format_id]
 
@@ -205,9 +229,6 @@ def json_to_table_data(format_id, json, angle_to_gl):
 
     parsed["namedComponentType"] = get_named_component_type(parsed["componentType"])
 
-    if format_id == "B8G8R8A8_UNORM":
-        parsed["fastCopyFunctions"] = "BGRACopyFunctions"
-
     return format_entry_template.format(**parsed)
 
 def parse_angle_format_table(all_angle, json_data, angle_to_gl):
@@ -245,9 +266,11 @@ all_angle = angle_to_gl.keys()
 angle_format_cases = parse_angle_format_table(
     all_angle, json_data, angle_to_gl)
 switch_data = gen_map_switch_string(gl_to_angle)
+fast_copy_functions = gen_fast_copy_functions(all_angle, json_data)
 output_cpp = template_autogen_inl.format(
     script_name = sys.argv[0],
     copyright_year = date.today().year,
+    fast_copy_functions = fast_copy_functions,
     angle_format_info_cases = angle_format_cases,
     angle_format_switch = switch_data,
     data_source_name = data_source_name)
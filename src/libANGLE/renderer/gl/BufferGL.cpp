@@ -224,6 +224,36 @@ gl::Error BufferGL::getIndexRange(const gl::Context *context,
     return gl::NoError();
 }
 
+gl::Error BufferGL::getBlockIndexRanges(const gl::Context *context,
+                                        GLenum type,
+                                        size_t offset,
+                                        size_t blockSize,
+                                        size_t blockCount,
+                                        bool primitiveRestartEnabled,
+                                        gl::IndexRange *outRanges)
+{
+    ASSERT(!mIsMapped);
+
+    if (mShadowBufferData)
+    {
+        gl::ComputeBlockIndexRanges(type, mShadowCopy.data() + offset, blockSize, blockCount,
+                                    primitiveRestartEnabled, outRanges);
+    }
+    else
+    {
+        mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
+
+        const uint8_t *bufferData =
+            MapBufferRangeWithFallback(mFunctions, gl::ToGLenum(DestBufferOperationTarget), offset,
+                                       blockSize * blockCount, GL_MAP_READ_BIT);
+        gl::ComputeBlockIndexRanges(type, bufferData, blockSize, blockCount,
+                                    primitiveRestartEnabled, outRanges);
+        mFunctions->unmapBuffer(gl::ToGLenum(DestBufferOperationTarget));
+    }
+
+    return gl::NoError();
+}
+
 GLuint BufferGL::getBufferID() const
 {
     return mBufferID;
@@ -55,6 +55,13 @@ class BufferGL : public BufferImpl
                             size_t count,
                             bool primitiveRestartEnabled,
                             gl::IndexRange *outRange) override;
+    gl::Error getBlockIndexRanges(const gl::Context *context,
+                                  GLenum type,
+                                  size_t offset,
+                                  size_t blockSize,
+                                  size_t blockCount,
+                                  bool primitiveRestartEnabled,
+                                  gl::IndexRange *outRanges) override;
 
     GLuint getBufferID() const;
 
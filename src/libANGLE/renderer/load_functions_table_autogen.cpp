@@ -1,7 +1,7 @@
 // GENERATED FILE - DO NOT EDIT.
 // Generated by gen_load_functions_table.py using data from load_functions_data.json
 //
-// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 //
@@ -226,6 +226,18 @@ LoadImageFunctionInfo COMPRESSED_R11_EAC_to_R16_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE_to_BC4_RED_UNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACR11ToBC4, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RG11_EAC_to_R16G16_UNORM(GLenum type)
 {
     switch (type)
@@ -238,6 +250,18 @@ LoadImageFunctionInfo COMPRESSED_RG11_EAC_to_R16G16_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE_to_BC5_RG_UNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACRG11ToBC5, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGB8_ETC2_to_R8G8B8A8_UNORM(GLenum type)
 {
     switch (type)
@@ -274,8 +298,7 @@ LoadImageFunctionInfo COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2_to_R8G8B8A8_UNORM
     }
 }
 
-LoadImageFunctionInfo
-COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE_to_BC1_RGBA_UNORM_BLOCK(GLenum type)
+LoadImageFunctionInfo COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE_to_BC1_RGBA_UNORM_BLOCK(GLenum type)
 {
     switch (type)
     {
@@ -299,6 +322,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA8_ETC2_EAC_to_R8G8B8A8_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE_to_BC3_RGBA_UNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadETC2RGBA8ToBC3, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_S3TC_DXT1_EXT_to_default(GLenum type)
 {
     switch (type)
@@ -359,6 +394,18 @@ LoadImageFunctionInfo COMPRESSED_SIGNED_R11_EAC_to_R16_SNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE_to_BC4_RED_SNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACR11SToBC4, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SIGNED_RG11_EAC_to_R16G16_SNORM(GLenum type)
 {
     switch (type)
@@ -371,6 +418,18 @@ LoadImageFunctionInfo COMPRESSED_SIGNED_RG11_EAC_to_R16G16_SNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE_to_BC5_RG_SNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACRG11SToBC5, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ETC2_EAC_to_R8G8B8A8_UNORM_SRGB(GLenum type)
 {
     switch (type)
@@ -383,6 +442,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ETC2_EAC_to_R8G8B8A8_UNORM_SRGB(GL
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE_to_BC3_RGBA_UNORM_SRGB_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadETC2SRGBA8ToBC3, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ETC2_to_R8G8B8A8_UNORM_SRGB(GLenum type)
 {
     switch (type)
@@ -395,8 +466,7 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ETC2_to_R8G8B8A8_UNORM_SRGB(GLenum type)
     }
 }
 
-LoadImageFunctionInfo COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE_to_BC1_RGB_UNORM_SRGB_BLOCK(
-    GLenum type)
+LoadImageFunctionInfo COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE_to_BC1_RGB_UNORM_SRGB_BLOCK(GLenum type)
 {
     switch (type)
     {
@@ -420,9 +490,7 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2_to_R8G8B8A8_UNOR
     }
 }
 
-LoadImageFunctionInfo
-COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE_to_BC1_RGBA_UNORM_SRGB_BLOCK(
-    GLenum type)
+LoadImageFunctionInfo COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE_to_BC1_RGBA_UNORM_SRGB_BLOCK(GLenum type)
 {
     switch (type)
     {
@@ -1609,6 +1677,16 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, Format::ID angleForma
                     break;
             }
         }
+        case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            switch (angleFormat)
+            {
+                case Format::ID::BC4_RED_UNORM_BLOCK:
+                    return COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE_to_BC4_RED_UNORM_BLOCK;
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_RG11_EAC:
         {
             switch (angleFormat)
@@ -1619,6 +1697,16 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, Format::ID angleForma
                     break;
             }
         }
+        case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            switch (angleFormat)
+            {
+                case Format::ID::BC5_RG_UNORM_BLOCK:
+                    return COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE_to_BC5_RG_UNORM_BLOCK;
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_RGB8_ETC2:
         {
             switch (angleFormat)
@@ -1669,6 +1757,16 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, Format::ID angleForma
                     break;
             }
         }
+        case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+        {
+            switch (angleFormat)
+            {
+                case Format::ID::BC3_RGBA_UNORM_BLOCK:
+                    return COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE_to_BC3_RGBA_UNORM_BLOCK;
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
             return COMPRESSED_RGBA_S3TC_DXT1_EXT_to_default;
         case GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE:
@@ -1687,6 +1785,16 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, Format::ID angleForma
                     break;
             }
         }
+        case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            switch (angleFormat)
+            {
+                case Format::ID::BC4_RED_SNORM_BLOCK:
+                    return COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE_to_BC4_RED_SNORM_BLOCK;
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_SIGNED_RG11_EAC:
         {
             switch (angleFormat)
@@ -1697,6 +1805,16 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, Format::ID angleForma
                     break;
             }
         }
+        case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            switch (angleFormat)
+            {
+                case Format::ID::BC5_RG_SNORM_BLOCK:
+                    return COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE_to_BC5_RG_SNORM_BLOCK;
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
         {
             switch (angleFormat)
@@ -1707,6 +1825,16 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, Format::ID angleForma
                     break;
             }
         }
+        case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+        {
+            switch (angleFormat)
+            {
+                case Format::ID::BC3_RGBA_UNORM_SRGB_BLOCK:
+                    return COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE_to_BC3_RGBA_UNORM_SRGB_BLOCK;
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ETC2:
         {
             switch (angleFormat)
@@ -108,6 +108,19 @@ gl::Error BufferNULL::getIndexRange(const gl::Context *context,
     return gl::NoError();
 }
 
+gl::Error BufferNULL::getBlockIndexRanges(const gl::Context *context,
+                                          GLenum type,
+                                          size_t offset,
+                                          size_t blockSize,
+                                          size_t blockCount,
+                                          bool primitiveRestartEnabled,
+                                          gl::IndexRange *outRanges)
+{
+    gl::ComputeBlockIndexRanges(type, mData.data() + offset, blockSize, blockCount,
+                                primitiveRestartEnabled, outRanges);
+    return gl::NoError();
+}
+
 uint8_t *BufferNULL::getDataPtr()
 {
     return mData.data();
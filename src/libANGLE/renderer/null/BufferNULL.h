@@ -52,6 +52,13 @@ class BufferNULL : public BufferImpl
                             size_t count,
                             bool primitiveRestartEnabled,
                             gl::IndexRange *outRange) override;
+    gl::Error getBlockIndexRanges(const gl::Context *context,
+                                  GLenum type,
+                                  size_t offset,
+                                  size_t blockSize,
+                                  size_t blockCount,
+                                  bool primitiveRestartEnabled,
+                                  gl::IndexRange *outRanges) override;
 
     uint8_t *getDataPtr();
     const uint8_t *getDataPtr() const;
@@ -29,7 +29,9 @@ ShCompileOptions ShaderNULL::prepareSourceAndReturnOptions(std::stringstream *so
     return 0;
 }
 
-bool ShaderNULL::postTranslateCompile(gl::Compiler *compiler, std::string *infoLog)
+bool ShaderNULL::postTranslateCompile(gl::Compiler *compiler,
+                                      ShHandle compilerHandle,
+                                      std::string *infoLog)
 {
     return true;
 }
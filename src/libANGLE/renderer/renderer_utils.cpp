@@ -273,10 +273,17 @@ void PackPixels(const PackPixelsParams &params,
     if (sourceGLInfo.format == params.format && sourceGLInfo.type == params.type)
     {
         // Direct copy possible
+        size_t rowBytes = params.area.width * sourceGLInfo.pixelBytes;
+        if (inputPitch > 0 && static_cast<size_t>(inputPitch) == rowBytes &&
+            params.outputPitch == rowBytes)
+        {
+            memcpy(destWithOffset, source, rowBytes * params.area.height);
+            return;
+        }
+
         for (int y = 0; y < params.area.height; ++y)
         {
-            memcpy(destWithOffset + y * params.outputPitch, source + y * inputPitch,
-                   params.area.width * sourceGLInfo.pixelBytes);
+            memcpy(destWithOffset + y * params.outputPitch, source + y * inputPitch, rowBytes);
         }
         return;
     }
@@ -290,17 +297,11 @@ void PackPixels(const PackPixelsParams &params,
 
     if (fastCopyFunc)
     {
-        // Fast copy is possible through some special function
+        // Fast copy is possible through some special function, which converts a row at a time
         for (int y = 0; y < params.area.height; ++y)
         {
-            for (int x = 0; x < params.area.width; ++x)
-            {
-                uint8_t *dest =
-                    destWithOffset + y * params.outputPitch + x * destFormatInfo.pixelBytes;
-                const uint8_t *src = source + y * inputPitch + x * sourceGLInfo.pixelBytes;
-
-                fastCopyFunc(src, dest);
-            }
+            fastCopyFunc(source + y * inputPitch, destWithOffset + y * params.outputPitch,
+                         params.area.width);
         }
         return;
     }
@@ -123,7 +123,8 @@ using MipGenerationFunction = void (*)(size_t sourceWidth,
 
 typedef void (*ColorReadFunction)(const uint8_t *source, uint8_t *dest);
 typedef void (*ColorWriteFunction)(const uint8_t *source, uint8_t *dest);
-typedef void (*ColorCopyFunction)(const uint8_t *source, uint8_t *dest);
+// Converts a row of pixelCount pixels between two formats.
+typedef void (*ColorCopyFunction)(const uint8_t *source, uint8_t *dest, size_t pixelCount);
 
 class FastCopyFunctionMap
 {
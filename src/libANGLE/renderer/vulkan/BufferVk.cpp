@@ -169,6 +169,30 @@ gl::Error BufferVk::getIndexRange(const gl::Context *context,
 
     *outRange = gl::ComputeIndexRange(type, mapPointer, count, primitiveRestartEnabled);
 
+    mBufferMemory.unmap(device);
+
+    return gl::NoError();
+}
+
+gl::Error BufferVk::getBlockIndexRanges(const gl::Context *context,
+                                        GLenum type,
+                                        size_t offset,
+                                        size_t blockSize,
+                                        size_t blockCount,
+                                        bool primitiveRestartEnabled,
+                                        gl::IndexRange *outRanges)
+{
+    VkDevice device = vk::GetImpl(context)->getDevice();
+    ASSERT(mBuffer.valid());
+
+    uint8_t *mapPointer = nullptr;
+    ANGLE_TRY(mBufferMemory.map(device, offset, blockSize * blockCount, 0, &mapPointer));
+
+    gl::ComputeBlockIndexRanges(type, mapPointer, blockSize, blockCount, primitiveRestartEnabled,
+                                outRanges);
+
+    mBufferMemory.unmap(device);
+
     return gl::NoError();
 }
 
@@ -183,29 +207,26 @@ vk::Error BufferVk::setDataImpl(ContextVk *contextVk,
     // Use map when available.
     if (renderer->isSerialInUse(getQueueSerial()))
     {
-        vk::StagingBuffer stagingBuffer;
-        ANGLE_TRY(stagingBuffer.init(contextVk, static_cast<VkDeviceSize>(size),
-                                     vk::StagingUsage::Write));
-
-        uint8_t *mapPointer = nullptr;
-        ANGLE_TRY(stagingBuffer.getDeviceMemory().map(device, 0, size, 0, &mapPointer));
-        ASSERT(mapPointer);
-
-        memcpy(mapPointer, data, size);
-        stagingBuffer.getDeviceMemory().unmap(device);
-
-        // Enqueue a copy command on the GPU.
-        // 'beginWriteOperation' will stop any subsequent rendering from using the old buffer data,
-        // by marking any current read operations / command buffers as 'finished'.
+        // Stage the data in the staging buffer of the context, which packs many updates in each
+        // of its blocks, and recycles them once the GPU is done with them.
+        vk::DynamicBuffer::Allocation staging;
+        ANGLE_TRY(contextVk->getStagingBuffer()->allocate(contextVk, size, &staging));
+        memcpy(staging.ptr, data, size);
+
+        // Enqueue a copy command on the GPU. The upload node of the context stops any subsequent
+        // rendering from using the old buffer data, and runs after the current reads of the buffer.
         vk::CommandBuffer *commandBuffer = nullptr;
-        ANGLE_TRY(beginWriteOperation(renderer, &commandBuffer));
+        ANGLE_TRY(contextVk->beginUploadOperation(this, &commandBuffer));
 
-        // Insert a barrier to ensure reads from the buffer are complete.
+        // Insert a barrier to ensure reads from the buffer are complete. Earlier copies of the
+        // upload node can also have written the same range.
         // TODO(jmadill): Insert minimal barriers.
+        VkAccessFlags srcAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+
         VkBufferMemoryBarrier bufferBarrier;
         bufferBarrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
         bufferBarrier.pNext               = nullptr;
-        bufferBarrier.srcAccessMask       = VK_ACCESS_MEMORY_READ_BIT;
+        bufferBarrier.srcAccessMask       = srcAccessMask;
         bufferBarrier.dstAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
         bufferBarrier.srcQueueFamilyIndex = 0;
         bufferBarrier.dstQueueFamilyIndex = 0;
@@ -216,12 +237,8 @@ vk::Error BufferVk::setDataImpl(ContextVk *contextVk,
         commandBuffer->singleBufferBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
                                            VK_PIPELINE_STAGE_TRANSFER_BIT, 0, bufferBarrier);
 
-        VkBufferCopy copyRegion = {offset, 0, size};
-        commandBuffer->copyBuffer(stagingBuffer.getBuffer(), mBuffer, 1, &copyRegion);
-
-        // Immediately release staging buffer.
-        // TODO(jmadill): Staging buffer re-use.
-        renderer->releaseObject(getQueueSerial(), &stagingBuffer);
+        VkBufferCopy copyRegion = {staging.offset, offset, size};
+        commandBuffer->copyBuffer(staging.buffer, mBuffer, 1, &copyRegion);
     }
     else
     {
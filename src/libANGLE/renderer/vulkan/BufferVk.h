@@ -53,6 +53,13 @@ class BufferVk : public BufferImpl, public ResourceVk
                             size_t count,
                             bool primitiveRestartEnabled,
                             gl::IndexRange *outRange) override;
+    gl::Error getBlockIndexRanges(const gl::Context *context,
+                                  GLenum type,
+                                  size_t offset,
+                                  size_t blockSize,
+                                  size_t blockCount,
+                                  bool primitiveRestartEnabled,
+                                  gl::IndexRange *outRanges) override;
 
     const vk::Buffer &getVkBuffer() const;
 
@@ -61,7 +68,7 @@ class BufferVk : public BufferImpl, public ResourceVk
     void release(RendererVk *renderer);
 
     vk::Buffer mBuffer;
-    vk::DeviceMemory mBufferMemory;
+    vk::MemoryAllocation mBufferMemory;
     size_t mCurrentRequiredSize;
 };
 
@@ -23,21 +23,15 @@ namespace
 {
 
 Error InitAndBeginCommandBuffer(VkDevice device,
-                                const CommandPool &commandPool,
+                                CommandBufferPool *commandPool,
                                 const VkCommandBufferInheritanceInfo &inheritanceInfo,
                                 VkCommandBufferUsageFlags flags,
                                 CommandBuffer *commandBuffer)
 {
     ASSERT(!commandBuffer->valid());
 
-    VkCommandBufferAllocateInfo createInfo;
-    createInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    createInfo.pNext              = nullptr;
-    createInfo.commandPool        = commandPool.getHandle();
-    createInfo.level              = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
-    createInfo.commandBufferCount = 1;
-
-    ANGLE_TRY(commandBuffer->init(device, createInfo));
+    // The pool hands out a command buffer from a previous frame if one is free.
+    ANGLE_TRY(commandPool->allocate(device, VK_COMMAND_BUFFER_LEVEL_SECONDARY, commandBuffer));
 
     VkCommandBufferBeginInfo beginInfo;
     beginInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -69,6 +63,23 @@ CommandBufferNode::~CommandBufferNode()
     mInsideRenderPassCommands.releaseHandle();
 }
 
+void CommandBufferNode::reset()
+{
+    mRenderPassDesc = RenderPassDesc();
+    mRenderPassFramebuffer.setHandle(VK_NULL_HANDLE);
+    mRenderPassRenderArea = gl::Rectangle();
+
+    // The command buffers go back to the pool when it is reset.
+    mOutsideRenderPassCommands.releaseHandle();
+    mInsideRenderPassCommands.releaseHandle();
+
+    // Clearing keeps the capacity, so reused nodes don't allocate for their dependencies.
+    mHappensBeforeDependencies.clear();
+    mHasHappensAfterDependencies = false;
+    mVisitedState                = VisitedState::Unvisited;
+    mIsFinishedRecording         = false;
+}
+
 CommandBuffer *CommandBufferNode::getOutsideRenderPassCommands()
 {
     ASSERT(!mIsFinishedRecording);
@@ -82,7 +93,7 @@ CommandBuffer *CommandBufferNode::getInsideRenderPassCommands()
 }
 
 Error CommandBufferNode::startRecording(VkDevice device,
-                                        const CommandPool &commandPool,
+                                        CommandBufferPool *commandPool,
                                         CommandBuffer **commandsOut)
 {
     ASSERT(!mIsFinishedRecording);
@@ -31,13 +31,16 @@ class CommandBufferNode final : angle::NonCopyable
     CommandBufferNode();
     ~CommandBufferNode();
 
+    // Returns the node to the state of a new node, so that the node arena can reuse it.
+    void reset();
+
     // Immutable queries for when we're walking the commands tree.
     CommandBuffer *getOutsideRenderPassCommands();
     CommandBuffer *getInsideRenderPassCommands();
 
     // For outside the render pass (copies, transitions, etc).
     Error startRecording(VkDevice device,
-                         const CommandPool &commandPool,
+                         CommandBufferPool *commandPool,
                          CommandBuffer **commandsOut);
 
     // For rendering commands (draws).
@@ -60,12 +60,18 @@ enum DescriptorPoolIndex : uint8_t
     TexturePool       = 1,
 };
 
+constexpr size_t kStreamingUniformBufferBlockSize = 1024 * 1024;
+constexpr size_t kStagingBufferBlockSize          = 4 * 1024 * 1024;
+
 }  // anonymous namespace
 
 ContextVk::ContextVk(const gl::ContextState &state, RendererVk *renderer)
     : ContextImpl(state),
       mRenderer(renderer),
       mCurrentDrawMode(GL_NONE),
+      mStreamingUniformBuffer(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, kStreamingUniformBufferBlockSize),
+      mStagingBuffer(VK_BUFFER_USAGE_TRANSFER_SRC_BIT, kStagingBufferBlockSize),
+      mUploadNode(nullptr),
       mVertexArrayDirty(false),
       mTexturesDirty(false)
 {
@@ -79,7 +85,11 @@ void ContextVk::onDestroy(const gl::Context *context)
 {
     VkDevice device = mRenderer->getDevice();
 
+    // Destroying the pool frees all of its sets.
+    mReleasedDescriptorSets.clear();
     mDescriptorPool.destroy(device);
+    mStreamingUniformBuffer.destroy(mRenderer);
+    mStagingBuffer.destroy(mRenderer);
 }
 
 gl::Error ContextVk::initialize()
@@ -87,7 +97,7 @@ gl::Error ContextVk::initialize()
     VkDevice device = mRenderer->getDevice();
 
     VkDescriptorPoolSize poolSizes[2];
-    poolSizes[UniformBufferPool].type            = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    poolSizes[UniformBufferPool].type            = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     poolSizes[UniformBufferPool].descriptorCount = 1024;
     poolSizes[TexturePool].type                  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     poolSizes[TexturePool].descriptorCount       = 1024;
@@ -95,7 +105,9 @@ gl::Error ContextVk::initialize()
     VkDescriptorPoolCreateInfo descriptorPoolInfo;
     descriptorPoolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
     descriptorPoolInfo.pNext = nullptr;
-    descriptorPoolInfo.flags = 0;
+
+    // The sets that programs release are freed once the GPU is done with them.
+    descriptorPoolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
 
     // TODO(jmadill): Pick non-arbitrary max.
     descriptorPoolInfo.maxSets = 2048;
@@ -106,6 +118,14 @@ gl::Error ContextVk::initialize()
 
     ANGLE_TRY(mDescriptorPool.init(device, descriptorPoolInfo));
 
+    mStreamingUniformBuffer.init(static_cast<size_t>(
+        mRenderer->getPhysicalDeviceProperties().limits.minUniformBufferOffsetAlignment));
+
+    // Copies to images need offsets that are multiples of 4.
+    VkDeviceSize copyOffsetAlignment =
+        mRenderer->getPhysicalDeviceProperties().limits.optimalBufferCopyOffsetAlignment;
+    mStagingBuffer.init(static_cast<size_t>(std::max<VkDeviceSize>(copyOffsetAlignment, 4)));
+
     mPipelineDesc.reset(new vk::PipelineDesc());
     mPipelineDesc->initDefaults();
 
@@ -251,9 +271,16 @@ gl::Error ContextVk::setupDraw(const gl::Context *context,
     {
         ASSERT(!descriptorSets.empty());
         const vk::PipelineLayout &pipelineLayout = mRenderer->getGraphicsPipelineLayout();
+
+        // Only the default uniforms in the first set have dynamic offsets.
+        const auto &dynamicOffsets  = programVk->getDefaultUniformOffsets();
+        uint32_t dynamicOffsetCount =
+            usedRange.contains(0) ? static_cast<uint32_t>(dynamicOffsets.size()) : 0;
+
         (*commandBuffer)
             ->bindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, usedRange.low(),
-                                 usedRange.length(), &descriptorSets[usedRange.low()], 0, nullptr);
+                                 usedRange.length(), &descriptorSets[usedRange.low()],
+                                 dynamicOffsetCount, dynamicOffsets.data());
     }
 
     return gl::NoError();
@@ -796,4 +823,52 @@ vk::DescriptorPool *ContextVk::getDescriptorPool()
     return &mDescriptorPool;
 }
 
+void ContextVk::releaseDescriptorSet(VkDescriptorSet descriptorSet)
+{
+    VkDevice device = mRenderer->getDevice();
+
+    while (!mReleasedDescriptorSets.empty() &&
+           !mRenderer->isSerialInUse(mReleasedDescriptorSets.front().first))
+    {
+        mDescriptorPool.freeDescriptorSets(device, 1, &mReleasedDescriptorSets.front().second);
+        mReleasedDescriptorSets.pop_front();
+    }
+
+    mReleasedDescriptorSets.emplace_back(mRenderer->getCurrentQueueSerial(), descriptorSet);
+}
+
+vk::DynamicBuffer *ContextVk::getStreamingUniformBuffer()
+{
+    return &mStreamingUniformBuffer;
+}
+
+vk::DynamicBuffer *ContextVk::getStagingBuffer()
+{
+    return &mStagingBuffer;
+}
+
+vk::Error ContextVk::beginUploadOperation(ResourceVk *resource,
+                                          vk::CommandBuffer **commandBufferOut)
+{
+    Serial currentSerial = mRenderer->getCurrentQueueSerial();
+
+    // Once a node depends on the upload node, later copies could overtake the commands that the
+    // node records, so they go to a new node. A flush recycles all the nodes.
+    if (mUploadNode == nullptr || mUploadNodeSerial != currentSerial ||
+        mUploadNode->isFinishedRecording())
+    {
+        mUploadNode       = mRenderer->allocateCommandNode();
+        mUploadNodeSerial = currentSerial;
+        ANGLE_TRY(mUploadNode->startRecording(getDevice(), mRenderer->getCommandPool(),
+                                              commandBufferOut));
+    }
+    else
+    {
+        *commandBufferOut = mUploadNode->getOutsideRenderPassCommands();
+    }
+
+    resource->onWriteResource(mUploadNode, currentSerial);
+    return vk::NoError();
+}
+
 }  // namespace rx
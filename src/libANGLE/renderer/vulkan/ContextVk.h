@@ -13,8 +13,11 @@
 #include <vulkan/vulkan.h>
 
 #include "libANGLE/renderer/ContextImpl.h"
+#include "libANGLE/renderer/vulkan/DynamicBuffer.h"
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 
+#include <deque>
+
 namespace rx
 {
 class RendererVk;
@@ -157,6 +160,16 @@ class ContextVk : public ContextImpl
 
     vk::DescriptorPool *getDescriptorPool();
 
+    // Frees a set of the descriptor pool once the commands recorded so far are done with it.
+    void releaseDescriptorSet(VkDescriptorSet descriptorSet);
+
+    vk::DynamicBuffer *getStreamingUniformBuffer();
+    vk::DynamicBuffer *getStagingBuffer();
+
+    // Returns the commands that copy the staged uploads to 'resource', and makes the resource wait
+    // on them. The copies of all the resources share one node until other commands depend on it.
+    vk::Error beginUploadOperation(ResourceVk *resource, vk::CommandBuffer **commandBufferOut);
+
   private:
     gl::Error initPipeline(const gl::Context *context);
     gl::Error setupDraw(const gl::Context *context,
@@ -176,6 +189,19 @@ class ContextVk : public ContextImpl
     // simulataneously. Hence, we keep it in the ContextVk instead of the RendererVk.
     vk::DescriptorPool mDescriptorPool;
 
+    // Released descriptor sets with the serial of their last use, in serial order.
+    std::deque<std::pair<Serial, VkDescriptorSet>> mReleasedDescriptorSets;
+
+    // The default uniforms of all programs are copied here when they change, and are bound with
+    // dynamic offsets, so that they can change between draws without waiting on the GPU.
+    vk::DynamicBuffer mStreamingUniformBuffer;
+
+    // The data of buffer and texture updates is packed here, and copied by the upload node. The
+    // node is only valid for the queue serial it was allocated with.
+    vk::DynamicBuffer mStagingBuffer;
+    vk::CommandBufferNode *mUploadNode;
+    Serial mUploadNodeSerial;
+
     // Triggers adding dependencies to the command graph.
     bool mVertexArrayDirty;
     bool mTexturesDirty;
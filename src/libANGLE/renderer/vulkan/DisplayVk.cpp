@@ -31,7 +31,8 @@ egl::Error DisplayVk::initialize(egl::Display *display)
 {
     ASSERT(!mRenderer && display != nullptr);
     mRenderer.reset(new RendererVk());
-    return mRenderer->initialize(display->getAttributeMap(), getWSIName())
+    return mRenderer
+        ->initialize(display->getAttributeMap(), getWSIName(), display->getMemoryProgramCache())
         .toEGL(EGL_NOT_INITIALIZED);
 }
 
@@ -0,0 +1,195 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DynamicBuffer:
+//    Streams data that changes often, like the default uniforms, to the GPU. The data is
+//    sub-allocated linearly from persistently mapped blocks of host visible memory. A full block
+//    is retired with the queue serial of its last use, and is reused once that serial completes.
+//
+
+#include "libANGLE/renderer/vulkan/DynamicBuffer.h"
+
+#include "common/mathutil.h"
+#include "libANGLE/renderer/vulkan/ContextVk.h"
+#include "libANGLE/renderer/vulkan/RendererVk.h"
+
+namespace rx
+{
+
+namespace vk
+{
+
+// DynamicBuffer::Allocation implementation.
+DynamicBuffer::Allocation::Allocation()
+    : ptr(nullptr), buffer(VK_NULL_HANDLE), offset(0), blockId(0)
+{
+}
+
+// DynamicBuffer::Block implementation.
+DynamicBuffer::Block::Block() : mappedMemory(nullptr), size(0)
+{
+}
+
+DynamicBuffer::Block::Block(Block &&other)
+    : buffer(std::move(other.buffer)),
+      memory(std::move(other.memory)),
+      mappedMemory(other.mappedMemory),
+      size(other.size),
+      serial(other.serial)
+{
+    other.mappedMemory = nullptr;
+    other.size         = 0;
+}
+
+DynamicBuffer::Block &DynamicBuffer::Block::operator=(Block &&other)
+{
+    std::swap(buffer, other.buffer);
+    std::swap(memory, other.memory);
+    std::swap(mappedMemory, other.mappedMemory);
+    std::swap(size, other.size);
+    std::swap(serial, other.serial);
+    return *this;
+}
+
+// DynamicBuffer implementation.
+DynamicBuffer::DynamicBuffer(VkBufferUsageFlags usage, size_t minBlockSize)
+    : mUsage(usage),
+      mMinBlockSize(minBlockSize),
+      mAlignment(0),
+      mCurrentBlockId(0),
+      mNextOffset(0)
+{
+}
+
+DynamicBuffer::~DynamicBuffer()
+{
+    ASSERT(!mCurrentBlock.buffer.valid() && mRetiredBlocks.empty());
+}
+
+void DynamicBuffer::init(size_t alignment)
+{
+    ASSERT(alignment > 0 && gl::isPow2(alignment));
+    mAlignment = alignment;
+}
+
+void DynamicBuffer::destroy(RendererVk *renderer)
+{
+    ReleaseBlock(renderer, &mCurrentBlock);
+    for (Block &block : mRetiredBlocks)
+    {
+        ReleaseBlock(renderer, &block);
+    }
+    mRetiredBlocks.clear();
+    mNextOffset = 0;
+}
+
+Error DynamicBuffer::allocate(ContextVk *contextVk, size_t sizeInBytes, Allocation *allocationOut)
+{
+    ASSERT(mAlignment > 0 && sizeInBytes > 0);
+
+    size_t offset = roundUp(mNextOffset, mAlignment);
+    if (!mCurrentBlock.buffer.valid() || offset + sizeInBytes > mCurrentBlock.size)
+    {
+        ANGLE_TRY(acquireBlock(contextVk, sizeInBytes));
+        offset = 0;
+    }
+
+    mCurrentBlock.serial = contextVk->getRenderer()->getCurrentQueueSerial();
+    mNextOffset          = offset + sizeInBytes;
+
+    allocationOut->ptr     = mCurrentBlock.mappedMemory + offset;
+    allocationOut->buffer  = mCurrentBlock.buffer.getHandle();
+    allocationOut->offset  = static_cast<uint32_t>(offset);
+    allocationOut->blockId = mCurrentBlockId;
+    return NoError();
+}
+
+bool DynamicBuffer::isCurrent(const Allocation &allocation) const
+{
+    // A recycled block keeps its buffer, and another DynamicBuffer can use the same block IDs.
+    return mCurrentBlock.buffer.valid() && allocation.buffer == mCurrentBlock.buffer.getHandle() &&
+           allocation.blockId == mCurrentBlockId;
+}
+
+Error DynamicBuffer::acquireBlock(ContextVk *contextVk, size_t minSize)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+
+    if (mCurrentBlock.buffer.valid())
+    {
+        mRetiredBlocks.push_back(std::move(mCurrentBlock));
+    }
+
+    // The IDs only need to differ from the ones of the allocations of the retired blocks.
+    mCurrentBlockId++;
+    mNextOffset = 0;
+
+    if (!mRetiredBlocks.empty() && !renderer->isSerialInUse(mRetiredBlocks.front().serial))
+    {
+        Block block = std::move(mRetiredBlocks.front());
+        mRetiredBlocks.pop_front();
+
+        if (block.size >= minSize)
+        {
+            mCurrentBlock = std::move(block);
+            return NoError();
+        }
+
+        // Blocks that are too small are replaced by larger ones.
+        ReleaseBlock(renderer, &block);
+    }
+
+    VkDevice device  = contextVk->getDevice();
+    size_t blockSize = std::max(mMinBlockSize, minSize);
+
+    VkBufferCreateInfo createInfo;
+    createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    createInfo.pNext                 = nullptr;
+    createInfo.flags                 = 0;
+    createInfo.size                  = blockSize;
+    createInfo.usage                 = mUsage;
+    createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    createInfo.queueFamilyIndexCount = 0;
+    createInfo.pQueueFamilyIndices   = nullptr;
+
+    Block block;
+    ANGLE_TRY(block.buffer.init(device, createInfo));
+
+    // Coherent memory doesn't need to be flushed before the data is used.
+    VkMemoryPropertyFlags flags =
+        (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    size_t requiredSize = 0;
+    Error error =
+        AllocateBufferMemory(contextVk, flags, &block.buffer, &block.memory, &requiredSize);
+    if (!error.isError())
+    {
+        error = block.memory.map(device, 0, blockSize, 0, &block.mappedMemory);
+    }
+
+    if (error.isError())
+    {
+        block.memory.destroy(device);
+        block.buffer.destroy(device);
+        return error;
+    }
+
+    block.size    = blockSize;
+    mCurrentBlock = std::move(block);
+    return NoError();
+}
+
+// static
+void DynamicBuffer::ReleaseBlock(RendererVk *renderer, Block *block)
+{
+    // The memory stays mapped until its block is freed.
+    renderer->releaseObject(block->serial, &block->buffer);
+    renderer->releaseObject(block->serial, &block->memory);
+    block->mappedMemory = nullptr;
+    block->size         = 0;
+}
+
+}  // namespace vk
+
+}  // namespace rx
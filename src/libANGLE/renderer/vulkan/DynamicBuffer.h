@@ -0,0 +1,89 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DynamicBuffer:
+//    Streams data that changes often, like the default uniforms, to the GPU. The data is
+//    sub-allocated linearly from persistently mapped blocks of host visible memory. A full block
+//    is retired with the queue serial of its last use, and is reused once that serial completes.
+//
+
+#ifndef LIBANGLE_RENDERER_VULKAN_DYNAMIC_BUFFER_H_
+#define LIBANGLE_RENDERER_VULKAN_DYNAMIC_BUFFER_H_
+
+#include <deque>
+
+#include "libANGLE/renderer/vulkan/vk_utils.h"
+
+namespace rx
+{
+
+namespace vk
+{
+
+class DynamicBuffer final : angle::NonCopyable
+{
+  public:
+    struct Allocation final
+    {
+        Allocation();
+
+        uint8_t *ptr;
+        VkBuffer buffer;
+        uint32_t offset;
+
+        // Identifies the block, which is the current one until the buffer moves on to another.
+        uint32_t blockId;
+    };
+
+    DynamicBuffer(VkBufferUsageFlags usage, size_t minBlockSize);
+    ~DynamicBuffer();
+
+    // The offsets of the allocations are multiples of the alignment, which is a power of two.
+    void init(size_t alignment);
+
+    // The blocks are released with the serial of their last use.
+    void destroy(RendererVk *renderer);
+
+    // The memory of the allocation can be written until the commands using it are submitted.
+    Error allocate(ContextVk *contextVk, size_t sizeInBytes, Allocation *allocationOut);
+
+    // The data of an allocation stays intact as long as its block is the current one. Once the
+    // block is retired, it can be recycled and overwritten at any flush.
+    bool isCurrent(const Allocation &allocation) const;
+
+  private:
+    struct Block final : angle::NonCopyable
+    {
+        Block();
+        Block(Block &&other);
+        Block &operator=(Block &&other);
+
+        Buffer buffer;
+        MemoryAllocation memory;
+        uint8_t *mappedMemory;
+        size_t size;
+        Serial serial;
+    };
+
+    Error acquireBlock(ContextVk *contextVk, size_t minSize);
+    static void ReleaseBlock(RendererVk *renderer, Block *block);
+
+    VkBufferUsageFlags mUsage;
+    size_t mMinBlockSize;
+    size_t mAlignment;
+
+    Block mCurrentBlock;
+    uint32_t mCurrentBlockId;
+    size_t mNextOffset;
+
+    // Retired in serial order, so the front block is always the first one to complete.
+    std::deque<Block> mRetiredBlocks;
+};
+
+}  // namespace vk
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_VULKAN_DYNAMIC_BUFFER_H_
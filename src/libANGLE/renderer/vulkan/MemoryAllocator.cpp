@@ -0,0 +1,585 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryAllocator:
+//    Sub-allocates the device memory of the Vulkan back-end from large blocks, which keeps the
+//    number of vkAllocateMemory calls far below maxMemoryAllocationCount. Each memory type has a
+//    heap for linear and one for optimal resources, and each block of a heap is split with a buddy
+//    allocator. Requests that are too large for the blocks get memory of their own.
+//
+
+#include "libANGLE/renderer/vulkan/MemoryAllocator.h"
+
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <utility>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+namespace rx
+{
+
+namespace vk
+{
+
+namespace
+{
+// The block index of the allocations that have their own device memory.
+constexpr size_t kDedicatedBlockIndex = std::numeric_limits<size_t>::max();
+
+constexpr size_t kTilingCount = 2;
+}  // anonymous namespace
+
+// A heap of blocks of one memory type, that are shared by the resources of one tiling. Each block
+// is split in power of two ranges by a buddy allocator: a free range of order N is split into two
+// halves of order N - 1, and a freed range merges back with its buddy when the buddy is free too.
+class MemoryHeap final : angle::NonCopyable
+{
+  public:
+    MemoryHeap(MemoryAllocator *allocator, uint32_t memoryTypeIndex, VkDeviceSize blockSize);
+    ~MemoryHeap();
+
+    void destroy();
+
+    VkResult allocate(VkDeviceSize size, VkDeviceSize alignment, SubAllocation **allocationOut);
+    void free(SubAllocation *allocation);
+
+    VkDeviceSize trim();
+    void getDefragmentationCandidates(
+        double maxOccupancy,
+        std::vector<std::pair<double, VkDeviceMemory>> *candidatesOut) const;
+    void accumulateStatistics(MemoryAllocatorStatistics *statistics) const;
+
+  private:
+    struct Block final : angle::NonCopyable
+    {
+        VkDeviceMemory memory;
+        uint8_t *mappedMemory;
+
+        // The offsets of the free ranges of each order.
+        std::vector<std::set<VkDeviceSize>> freeRanges;
+
+        size_t allocationCount;
+        VkDeviceSize usedBytes;
+    };
+
+    VkDeviceSize getRangeSize(uint32_t order) const
+    {
+        return MemoryAllocator::kMinAllocationSize << order;
+    }
+    uint32_t getOrder(VkDeviceSize size) const;
+    bool findFreeRange(uint32_t minOrder, size_t *blockIndexOut, uint32_t *orderOut) const;
+
+    VkResult allocateBlock(size_t *blockIndexOut);
+    void freeBlock(size_t blockIndex);
+    VkResult allocateDedicated(VkDeviceSize size, SubAllocation **allocationOut);
+
+    MemoryAllocator *mAllocator;
+    uint32_t mMemoryTypeIndex;
+    VkDeviceSize mBlockSize;
+    uint32_t mMaxOrder;
+
+    // The allocations refer to their block by index, so freed blocks leave a null entry that is
+    // reused by the next block.
+    std::vector<std::unique_ptr<Block>> mBlocks;
+    size_t mBlockCount;
+    size_t mEmptyBlockCount;
+
+    size_t mAllocationCount;
+    VkDeviceSize mAllocatedBytes;
+    size_t mDedicatedAllocationCount;
+    VkDeviceSize mDedicatedBytes;
+};
+
+MemoryHeap::MemoryHeap(MemoryAllocator *allocator,
+                       uint32_t memoryTypeIndex,
+                       VkDeviceSize blockSize)
+    : mAllocator(allocator),
+      mMemoryTypeIndex(memoryTypeIndex),
+      mBlockSize(blockSize),
+      mMaxOrder(0),
+      mBlockCount(0),
+      mEmptyBlockCount(0),
+      mAllocationCount(0),
+      mAllocatedBytes(0),
+      mDedicatedAllocationCount(0),
+      mDedicatedBytes(0)
+{
+    ASSERT(gl::isPow2(blockSize) && blockSize >= MemoryAllocator::kMinAllocationSize);
+    while (getRangeSize(mMaxOrder) < blockSize)
+    {
+        mMaxOrder++;
+    }
+}
+
+MemoryHeap::~MemoryHeap()
+{
+    ASSERT(mBlockCount == 0);
+}
+
+void MemoryHeap::destroy()
+{
+    ASSERT(mAllocationCount == 0);
+    for (size_t blockIndex = 0; blockIndex < mBlocks.size(); blockIndex++)
+    {
+        if (mBlocks[blockIndex])
+        {
+            freeBlock(blockIndex);
+        }
+    }
+    mBlocks.clear();
+    mEmptyBlockCount = 0;
+}
+
+VkResult MemoryHeap::allocate(VkDeviceSize size,
+                              VkDeviceSize alignment,
+                              SubAllocation **allocationOut)
+{
+    ASSERT(size > 0 && gl::isPow2(alignment));
+
+    // The ranges are aligned to their size, so the range of the alignment is aligned too.
+    VkDeviceSize rangeSize = std::max(size, alignment);
+    if (rangeSize > mBlockSize / 2)
+    {
+        return allocateDedicated(size, allocationOut);
+    }
+
+    uint32_t order     = getOrder(rangeSize);
+    size_t blockIndex  = 0;
+    uint32_t freeOrder = 0;
+    if (!findFreeRange(order, &blockIndex, &freeOrder))
+    {
+        VkResult result = allocateBlock(&blockIndex);
+        if (result != VK_SUCCESS)
+        {
+            return result;
+        }
+        freeOrder = mMaxOrder;
+    }
+
+    Block &block        = *mBlocks[blockIndex];
+    auto &freeRanges    = block.freeRanges[freeOrder];
+    VkDeviceSize offset = *freeRanges.begin();
+    freeRanges.erase(freeRanges.begin());
+
+    // The upper halves of the split ranges are the buddies of the allocation, and stay free.
+    while (freeOrder > order)
+    {
+        freeOrder--;
+        block.freeRanges[freeOrder].insert(offset + getRangeSize(freeOrder));
+    }
+
+    if (block.allocationCount == 0)
+    {
+        mEmptyBlockCount--;
+    }
+    block.allocationCount++;
+    block.usedBytes += getRangeSize(order);
+
+    SubAllocation *allocation = new SubAllocation();
+    allocation->memory        = block.memory;
+    allocation->offset        = offset;
+    allocation->size          = size;
+    allocation->mappedMemory  = block.mappedMemory ? block.mappedMemory + offset : nullptr;
+    allocation->heap          = this;
+    allocation->blockIndex    = blockIndex;
+    allocation->order         = order;
+
+    mAllocationCount++;
+    mAllocatedBytes += size;
+
+    *allocationOut = allocation;
+    return VK_SUCCESS;
+}
+
+void MemoryHeap::free(SubAllocation *allocation)
+{
+    ASSERT(allocation->heap == this && mAllocationCount > 0);
+    mAllocationCount--;
+    mAllocatedBytes -= allocation->size;
+
+    if (allocation->blockIndex == kDedicatedBlockIndex)
+    {
+        mDedicatedAllocationCount--;
+        mDedicatedBytes -= allocation->size;
+        mAllocator->freeDeviceMemory(allocation->memory, allocation->size);
+        delete allocation;
+        return;
+    }
+
+    size_t blockIndex   = allocation->blockIndex;
+    Block &block        = *mBlocks[blockIndex];
+    VkDeviceSize offset = allocation->offset;
+    uint32_t order      = allocation->order;
+    delete allocation;
+
+    block.allocationCount--;
+    block.usedBytes -= getRangeSize(order);
+
+    while (order < mMaxOrder)
+    {
+        auto &freeRanges = block.freeRanges[order];
+        auto buddy       = freeRanges.find(offset ^ getRangeSize(order));
+        if (buddy == freeRanges.end())
+        {
+            break;
+        }
+
+        offset = std::min(offset, *buddy);
+        freeRanges.erase(buddy);
+        order++;
+    }
+    block.freeRanges[order].insert(offset);
+
+    if (block.allocationCount == 0)
+    {
+        // Keeping one empty block avoids freeing and allocating again when an allocation comes and
+        // goes at the edge of a block.
+        if (mEmptyBlockCount > 0)
+        {
+            freeBlock(blockIndex);
+        }
+        else
+        {
+            mEmptyBlockCount++;
+        }
+    }
+}
+
+VkDeviceSize MemoryHeap::trim()
+{
+    VkDeviceSize freedBytes = 0;
+    for (size_t blockIndex = 0; blockIndex < mBlocks.size(); blockIndex++)
+    {
+        if (mBlocks[blockIndex] && mBlocks[blockIndex]->allocationCount == 0)
+        {
+            freeBlock(blockIndex);
+            mEmptyBlockCount--;
+            freedBytes += mBlockSize;
+        }
+    }
+    ASSERT(mEmptyBlockCount == 0);
+    return freedBytes;
+}
+
+void MemoryHeap::getDefragmentationCandidates(
+    double maxOccupancy,
+    std::vector<std::pair<double, VkDeviceMemory>> *candidatesOut) const
+{
+    for (const std::unique_ptr<Block> &block : mBlocks)
+    {
+        if (!block || block->allocationCount == 0)
+        {
+            continue;
+        }
+
+        double occupancy = static_cast<double>(block->usedBytes) / static_cast<double>(mBlockSize);
+        if (occupancy <= maxOccupancy)
+        {
+            candidatesOut->emplace_back(occupancy, block->memory);
+        }
+    }
+}
+
+void MemoryHeap::accumulateStatistics(MemoryAllocatorStatistics *statistics) const
+{
+    statistics->deviceAllocationCount += mBlockCount + mDedicatedAllocationCount;
+    statistics->deviceAllocatedBytes += mBlockCount * mBlockSize + mDedicatedBytes;
+    statistics->blockCount += mBlockCount;
+    statistics->emptyBlockCount += mEmptyBlockCount;
+    statistics->dedicatedAllocationCount += mDedicatedAllocationCount;
+    statistics->allocationCount += mAllocationCount;
+    statistics->allocatedBytes += mAllocatedBytes;
+    statistics->usedBytes += mDedicatedBytes;
+
+    for (const std::unique_ptr<Block> &block : mBlocks)
+    {
+        if (!block)
+        {
+            continue;
+        }
+
+        statistics->usedBytes += block->usedBytes;
+        for (uint32_t order = mMaxOrder + 1; order > 0; order--)
+        {
+            if (!block->freeRanges[order - 1].empty())
+            {
+                statistics->largestFreeRange =
+                    std::max(statistics->largestFreeRange, getRangeSize(order - 1));
+                break;
+            }
+        }
+    }
+}
+
+uint32_t MemoryHeap::getOrder(VkDeviceSize size) const
+{
+    uint32_t order = 0;
+    while (getRangeSize(order) < size)
+    {
+        order++;
+    }
+    ASSERT(order <= mMaxOrder);
+    return order;
+}
+
+bool MemoryHeap::findFreeRange(uint32_t minOrder, size_t *blockIndexOut, uint32_t *orderOut) const
+{
+    // The smallest free range that fits is the best fit, and leaves the large ranges for the large
+    // allocations.
+    for (uint32_t order = minOrder; order <= mMaxOrder; order++)
+    {
+        for (size_t blockIndex = 0; blockIndex < mBlocks.size(); blockIndex++)
+        {
+            if (mBlocks[blockIndex] && !mBlocks[blockIndex]->freeRanges[order].empty())
+            {
+                *blockIndexOut = blockIndex;
+                *orderOut      = order;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+VkResult MemoryHeap::allocateBlock(size_t *blockIndexOut)
+{
+    std::unique_ptr<Block> block(new Block());
+    VkResult result = mAllocator->allocateDeviceMemory(mMemoryTypeIndex, mBlockSize,
+                                                       &block->memory, &block->mappedMemory);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    block->freeRanges.resize(mMaxOrder + 1);
+    block->freeRanges[mMaxOrder].insert(0);
+    block->allocationCount = 0;
+    block->usedBytes       = 0;
+
+    auto freeSlot = std::find(mBlocks.begin(), mBlocks.end(), nullptr);
+    if (freeSlot == mBlocks.end())
+    {
+        freeSlot = mBlocks.insert(mBlocks.end(), nullptr);
+    }
+    *freeSlot = std::move(block);
+
+    mBlockCount++;
+    mEmptyBlockCount++;
+    *blockIndexOut = static_cast<size_t>(freeSlot - mBlocks.begin());
+    return VK_SUCCESS;
+}
+
+void MemoryHeap::freeBlock(size_t blockIndex)
+{
+    ASSERT(mBlocks[blockIndex]->allocationCount == 0);
+    mAllocator->freeDeviceMemory(mBlocks[blockIndex]->memory, mBlockSize);
+    mBlocks[blockIndex].reset();
+    mBlockCount--;
+}
+
+VkResult MemoryHeap::allocateDedicated(VkDeviceSize size, SubAllocation **allocationOut)
+{
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    uint8_t *mappedMemory = nullptr;
+
+    VkResult result =
+        mAllocator->allocateDeviceMemory(mMemoryTypeIndex, size, &memory, &mappedMemory);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    SubAllocation *allocation = new SubAllocation();
+    allocation->memory        = memory;
+    allocation->offset        = 0;
+    allocation->size          = size;
+    allocation->mappedMemory  = mappedMemory;
+    allocation->heap          = this;
+    allocation->blockIndex    = kDedicatedBlockIndex;
+    allocation->order         = 0;
+
+    mAllocationCount++;
+    mAllocatedBytes += size;
+    mDedicatedAllocationCount++;
+    mDedicatedBytes += size;
+
+    *allocationOut = allocation;
+    return VK_SUCCESS;
+}
+
+// MemoryAllocatorStatistics implementation.
+MemoryAllocatorStatistics::MemoryAllocatorStatistics()
+    : deviceAllocationCount(0),
+      peakDeviceAllocationCount(0),
+      deviceAllocatedBytes(0),
+      blockCount(0),
+      emptyBlockCount(0),
+      dedicatedAllocationCount(0),
+      allocationCount(0),
+      allocatedBytes(0),
+      usedBytes(0),
+      largestFreeRange(0)
+{
+}
+
+// MemoryAllocator implementation.
+constexpr VkDeviceSize MemoryAllocator::kMinAllocationSize;
+constexpr VkDeviceSize MemoryAllocator::kMinBlockSize;
+constexpr VkDeviceSize MemoryAllocator::kMaxBlockSize;
+
+MemoryAllocator::MemoryAllocator()
+    : mCallbacks(nullptr),
+      mDeviceAllocationCount(0),
+      mPeakDeviceAllocationCount(0),
+      mDeviceAllocatedBytes(0)
+{
+}
+
+MemoryAllocator::~MemoryAllocator()
+{
+    ASSERT(mHeaps.empty());
+}
+
+// static
+VkDeviceSize MemoryAllocator::GetBlockSizeForHeap(VkDeviceSize heapSize)
+{
+    // Small heaps, like the host visible device local memory of some discrete GPUs, would run out
+    // of space with a few large blocks.
+    VkDeviceSize blockSize = kMaxBlockSize;
+    while (blockSize > kMinBlockSize && blockSize * 8 > heapSize)
+    {
+        blockSize /= 2;
+    }
+    return blockSize;
+}
+
+void MemoryAllocator::init(MemoryBlockCallbacks *callbacks,
+                           const std::vector<VkDeviceSize> &blockSizes)
+{
+    ASSERT(mHeaps.empty());
+    mCallbacks = callbacks;
+
+    for (uint32_t memoryTypeIndex = 0; memoryTypeIndex < blockSizes.size(); memoryTypeIndex++)
+    {
+        for (size_t tiling = 0; tiling < kTilingCount; tiling++)
+        {
+            mHeaps.emplace_back(new MemoryHeap(this, memoryTypeIndex, blockSizes[memoryTypeIndex]));
+        }
+    }
+}
+
+void MemoryAllocator::destroy()
+{
+    for (std::unique_ptr<MemoryHeap> &heap : mHeaps)
+    {
+        heap->destroy();
+    }
+    mHeaps.clear();
+    ASSERT(mDeviceAllocationCount == 0);
+}
+
+VkResult MemoryAllocator::allocate(uint32_t memoryTypeIndex,
+                                   MemoryTiling tiling,
+                                   VkDeviceSize size,
+                                   VkDeviceSize alignment,
+                                   SubAllocation **allocationOut)
+{
+    return getHeap(memoryTypeIndex, tiling)->allocate(size, alignment, allocationOut);
+}
+
+// static
+void MemoryAllocator::Free(SubAllocation *allocation)
+{
+    allocation->heap->free(allocation);
+}
+
+VkDeviceSize MemoryAllocator::trim()
+{
+    VkDeviceSize freedBytes = 0;
+    for (std::unique_ptr<MemoryHeap> &heap : mHeaps)
+    {
+        freedBytes += heap->trim();
+    }
+    return freedBytes;
+}
+
+void MemoryAllocator::getDefragmentationCandidates(double maxOccupancy,
+                                                   std::vector<VkDeviceMemory> *blocksOut) const
+{
+    std::vector<std::pair<double, VkDeviceMemory>> candidates;
+    for (const std::unique_ptr<MemoryHeap> &heap : mHeaps)
+    {
+        heap->getDefragmentationCandidates(maxOccupancy, &candidates);
+    }
+
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const std::pair<double, VkDeviceMemory> &a,
+                        const std::pair<double, VkDeviceMemory> &b) { return a.first < b.first; });
+
+    blocksOut->clear();
+    for (const auto &candidate : candidates)
+    {
+        blocksOut->push_back(candidate.second);
+    }
+}
+
+void MemoryAllocator::getStatistics(MemoryAllocatorStatistics *statisticsOut) const
+{
+    *statisticsOut = MemoryAllocatorStatistics();
+    for (const std::unique_ptr<MemoryHeap> &heap : mHeaps)
+    {
+        heap->accumulateStatistics(statisticsOut);
+    }
+    ASSERT(statisticsOut->deviceAllocationCount == mDeviceAllocationCount);
+    statisticsOut->peakDeviceAllocationCount = mPeakDeviceAllocationCount;
+}
+
+void MemoryAllocator::getHeapStatistics(uint32_t memoryTypeIndex,
+                                        MemoryTiling tiling,
+                                        MemoryAllocatorStatistics *statisticsOut) const
+{
+    *statisticsOut = MemoryAllocatorStatistics();
+    getHeap(memoryTypeIndex, tiling)->accumulateStatistics(statisticsOut);
+}
+
+VkResult MemoryAllocator::allocateDeviceMemory(uint32_t memoryTypeIndex,
+                                               VkDeviceSize size,
+                                               VkDeviceMemory *memoryOut,
+                                               uint8_t **mappedMemoryOut)
+{
+    VkResult result = mCallbacks->allocateBlock(memoryTypeIndex, size, memoryOut, mappedMemoryOut);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    mDeviceAllocationCount++;
+    mPeakDeviceAllocationCount = std::max(mPeakDeviceAllocationCount, mDeviceAllocationCount);
+    mDeviceAllocatedBytes += size;
+    return VK_SUCCESS;
+}
+
+void MemoryAllocator::freeDeviceMemory(VkDeviceMemory memory, VkDeviceSize size)
+{
+    ASSERT(mDeviceAllocationCount > 0 && mDeviceAllocatedBytes >= size);
+    mCallbacks->freeBlock(memory);
+    mDeviceAllocationCount--;
+    mDeviceAllocatedBytes -= size;
+}
+
+MemoryHeap *MemoryAllocator::getHeap(uint32_t memoryTypeIndex, MemoryTiling tiling) const
+{
+    size_t heapIndex = memoryTypeIndex * kTilingCount + static_cast<size_t>(tiling);
+    ASSERT(heapIndex < mHeaps.size());
+    return mHeaps[heapIndex].get();
+}
+
+}  // namespace vk
+
+}  // namespace rx
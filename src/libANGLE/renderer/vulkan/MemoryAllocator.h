@@ -0,0 +1,165 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryAllocator:
+//    Sub-allocates the device memory of the Vulkan back-end from large blocks, which keeps the
+//    number of vkAllocateMemory calls far below maxMemoryAllocationCount. Each memory type has a
+//    heap for linear and one for optimal resources, and each block of a heap is split with a buddy
+//    allocator. Requests that are too large for the blocks get memory of their own.
+//
+
+#ifndef LIBANGLE_RENDERER_VULKAN_MEMORY_ALLOCATOR_H_
+#define LIBANGLE_RENDERER_VULKAN_MEMORY_ALLOCATOR_H_
+
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "common/angleutils.h"
+
+namespace rx
+{
+
+namespace vk
+{
+class MemoryHeap;
+
+// Allocates the blocks of device memory. The renderer implements it with the device, and the
+// tests with a mock.
+class MemoryBlockCallbacks : angle::NonCopyable
+{
+  public:
+    virtual ~MemoryBlockCallbacks() {}
+
+    // The blocks of host visible memory types are mapped for their whole life, and the others
+    // return a null pointer.
+    virtual VkResult allocateBlock(uint32_t memoryTypeIndex,
+                                   VkDeviceSize size,
+                                   VkDeviceMemory *memoryOut,
+                                   uint8_t **mappedMemoryOut) = 0;
+    virtual void freeBlock(VkDeviceMemory memory) = 0;
+};
+
+// Linear and optimal resources never share a block, so they can't alias within a page of
+// bufferImageGranularity. Buffers are linear.
+enum class MemoryTiling
+{
+    Linear,
+    Optimal,
+};
+
+// A range of memory handed out by the allocator. It lives until it is freed.
+struct SubAllocation final : angle::NonCopyable
+{
+    VkDeviceMemory memory;
+    VkDeviceSize offset;
+    VkDeviceSize size;
+
+    // Points at the offset in the mapped block, or is null if the memory isn't host visible.
+    uint8_t *mappedMemory;
+
+    // Bookkeeping of the heap.
+    MemoryHeap *heap;
+    size_t blockIndex;
+    uint32_t order;
+};
+
+struct MemoryAllocatorStatistics final
+{
+    MemoryAllocatorStatistics();
+
+    // The memory allocated from the device, for the blocks and the dedicated allocations. The peak
+    // count is only tracked for the whole allocator.
+    size_t deviceAllocationCount;
+    size_t peakDeviceAllocationCount;
+    VkDeviceSize deviceAllocatedBytes;
+
+    size_t blockCount;
+    size_t emptyBlockCount;
+    size_t dedicatedAllocationCount;
+
+    // The requested sizes of the allocations, and the sizes they use once rounded up to the power
+    // of two ranges of the buddy allocator.
+    size_t allocationCount;
+    VkDeviceSize allocatedBytes;
+    VkDeviceSize usedBytes;
+
+    // The largest allocation that fits in the existing blocks.
+    VkDeviceSize largestFreeRange;
+};
+
+class MemoryAllocator final : angle::NonCopyable
+{
+  public:
+    // The smallest range handed out by the buddy allocator, and the range of block sizes.
+    static constexpr VkDeviceSize kMinAllocationSize = 256;
+    static constexpr VkDeviceSize kMinBlockSize      = 1024 * 1024;
+    static constexpr VkDeviceSize kMaxBlockSize      = 32 * 1024 * 1024;
+
+    MemoryAllocator();
+    ~MemoryAllocator();
+
+    // Picks a power of two block size that lets a heap of the given size hold a few blocks.
+    static VkDeviceSize GetBlockSizeForHeap(VkDeviceSize heapSize);
+
+    // There is one block size per memory type. The callbacks must outlive the allocator.
+    void init(MemoryBlockCallbacks *callbacks, const std::vector<VkDeviceSize> &blockSizes);
+
+    // Frees all the blocks. Every allocation must have been freed.
+    void destroy();
+
+    // The alignment is a power of two.
+    VkResult allocate(uint32_t memoryTypeIndex,
+                      MemoryTiling tiling,
+                      VkDeviceSize size,
+                      VkDeviceSize alignment,
+                      SubAllocation **allocationOut);
+
+    // The range goes back to its block. A block that becomes empty is kept for the next
+    // allocations, unless the heap already has an empty one.
+    static void Free(SubAllocation *allocation);
+
+    // Frees the empty blocks, and returns the number of bytes given back to the device.
+    VkDeviceSize trim();
+
+    // Defragmentation hook. The allocator can't move the allocations itself, since their memory is
+    // bound to resources that are referenced by command buffers. The blocks that are in use at or
+    // below the given occupancy are returned sparsest first: the owners of their allocations can
+    // recreate them elsewhere and free the old ones, which empties the blocks for trim().
+    void getDefragmentationCandidates(double maxOccupancy,
+                                      std::vector<VkDeviceMemory> *blocksOut) const;
+
+    void getStatistics(MemoryAllocatorStatistics *statisticsOut) const;
+    void getHeapStatistics(uint32_t memoryTypeIndex,
+                           MemoryTiling tiling,
+                           MemoryAllocatorStatistics *statisticsOut) const;
+
+  private:
+    friend class MemoryHeap;
+
+    VkResult allocateDeviceMemory(uint32_t memoryTypeIndex,
+                                  VkDeviceSize size,
+                                  VkDeviceMemory *memoryOut,
+                                  uint8_t **mappedMemoryOut);
+    void freeDeviceMemory(VkDeviceMemory memory, VkDeviceSize size);
+
+    MemoryHeap *getHeap(uint32_t memoryTypeIndex, MemoryTiling tiling) const;
+
+    MemoryBlockCallbacks *mCallbacks;
+
+    // Two heaps per memory type, one for each tiling.
+    std::vector<std::unique_ptr<MemoryHeap>> mHeaps;
+
+    size_t mDeviceAllocationCount;
+    size_t mPeakDeviceAllocationCount;
+    VkDeviceSize mDeviceAllocatedBytes;
+};
+
+}  // namespace vk
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_VULKAN_MEMORY_ALLOCATOR_H_
@@ -0,0 +1,378 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryAllocator_unittest:
+//   Tests of the Vulkan memory sub-allocator. The blocks come from a mock instead of a device.
+//
+
+#include <cstring>
+#include <map>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/renderer/vulkan/MemoryAllocator.h"
+
+using namespace rx::vk;
+
+namespace
+{
+
+constexpr VkDeviceSize kBlockSize = 1024 * 1024;
+
+// Memory type 0 is device local, and type 1 is host visible.
+constexpr uint32_t kDeviceLocalType = 0;
+constexpr uint32_t kHostVisibleType = 1;
+
+class MockBlockCallbacks final : public MemoryBlockCallbacks
+{
+  public:
+    MockBlockCallbacks() : mAllocateCount(0), mFailAllocations(false) {}
+    ~MockBlockCallbacks() override { EXPECT_TRUE(mBlocks.empty()); }
+
+    VkResult allocateBlock(uint32_t memoryTypeIndex,
+                           VkDeviceSize size,
+                           VkDeviceMemory *memoryOut,
+                           uint8_t **mappedMemoryOut) override
+    {
+        if (mFailAllocations)
+        {
+            return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+        }
+
+        // The host memory of the blocks also gives them unique handles.
+        bool hostVisible = (memoryTypeIndex == kHostVisibleType);
+        std::unique_ptr<uint8_t[]> storage(new uint8_t[hostVisible ? size : 1]);
+        *memoryOut       = reinterpret_cast<VkDeviceMemory>(storage.get());
+        *mappedMemoryOut = hostVisible ? storage.get() : nullptr;
+
+        mBlocks[*memoryOut] = std::move(storage);
+        mAllocateCount++;
+        return VK_SUCCESS;
+    }
+
+    void freeBlock(VkDeviceMemory memory) override { EXPECT_EQ(1u, mBlocks.erase(memory)); }
+
+    size_t getBlockCount() const { return mBlocks.size(); }
+    size_t getAllocateCount() const { return mAllocateCount; }
+    void setFailAllocations(bool fail) { mFailAllocations = fail; }
+
+  private:
+    std::map<VkDeviceMemory, std::unique_ptr<uint8_t[]>> mBlocks;
+    size_t mAllocateCount;
+    bool mFailAllocations;
+};
+
+class MemoryAllocatorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override { mAllocator.init(&mCallbacks, {kBlockSize, kBlockSize}); }
+    void TearDown() override { mAllocator.destroy(); }
+
+    SubAllocation *allocate(VkDeviceSize size,
+                            VkDeviceSize alignment = 1,
+                            MemoryTiling tiling    = MemoryTiling::Linear,
+                            uint32_t memoryType    = kDeviceLocalType)
+    {
+        SubAllocation *allocation = nullptr;
+        EXPECT_EQ(VK_SUCCESS,
+                  mAllocator.allocate(memoryType, tiling, size, alignment, &allocation));
+        return allocation;
+    }
+
+    MemoryAllocatorStatistics getStatistics() const
+    {
+        MemoryAllocatorStatistics statistics;
+        mAllocator.getStatistics(&statistics);
+        return statistics;
+    }
+
+    MockBlockCallbacks mCallbacks;
+    MemoryAllocator mAllocator;
+};
+
+// Small allocations share a block, and don't overlap.
+TEST_F(MemoryAllocatorTest, SubAllocatesFromOneBlock)
+{
+    constexpr size_t kCount = 64;
+    std::vector<SubAllocation *> allocations;
+    for (size_t index = 0; index < kCount; index++)
+    {
+        allocations.push_back(allocate(4096));
+    }
+
+    EXPECT_EQ(1u, mCallbacks.getAllocateCount());
+
+    std::map<VkDeviceSize, SubAllocation *> byOffset;
+    for (SubAllocation *allocation : allocations)
+    {
+        EXPECT_EQ(allocations[0]->memory, allocation->memory);
+        byOffset[allocation->offset] = allocation;
+    }
+    ASSERT_EQ(kCount, byOffset.size());
+
+    VkDeviceSize end = 0;
+    for (const auto &offsetAndAllocation : byOffset)
+    {
+        EXPECT_GE(offsetAndAllocation.first, end);
+        end = offsetAndAllocation.first + offsetAndAllocation.second->size;
+    }
+    EXPECT_LE(end, kBlockSize);
+
+    for (SubAllocation *allocation : allocations)
+    {
+        MemoryAllocator::Free(allocation);
+    }
+}
+
+// The offsets are multiples of the alignment.
+TEST_F(MemoryAllocatorTest, Alignment)
+{
+    SubAllocation *small   = allocate(100, 4);
+    SubAllocation *aligned = allocate(100, 65536);
+    SubAllocation *odd     = allocate(12345, 256);
+
+    EXPECT_EQ(0u, aligned->offset % 65536);
+    EXPECT_EQ(0u, odd->offset % 256);
+    EXPECT_EQ(1u, mCallbacks.getAllocateCount());
+
+    MemoryAllocator::Free(small);
+    MemoryAllocator::Free(aligned);
+    MemoryAllocator::Free(odd);
+}
+
+// Freed ranges merge with their buddies, so the whole block is available again.
+TEST_F(MemoryAllocatorTest, FreedRangesMerge)
+{
+    std::vector<SubAllocation *> allocations;
+    for (size_t index = 0; index < 4; index++)
+    {
+        allocations.push_back(allocate(kBlockSize / 4));
+    }
+    EXPECT_EQ(1u, mCallbacks.getAllocateCount());
+    EXPECT_EQ(0u, getStatistics().largestFreeRange);
+
+    // Free every other quarter: the ranges don't merge.
+    MemoryAllocator::Free(allocations[0]);
+    MemoryAllocator::Free(allocations[2]);
+    EXPECT_EQ(kBlockSize / 4, getStatistics().largestFreeRange);
+
+    MemoryAllocator::Free(allocations[1]);
+    EXPECT_EQ(kBlockSize / 2, getStatistics().largestFreeRange);
+
+    MemoryAllocator::Free(allocations[3]);
+    EXPECT_EQ(kBlockSize, getStatistics().largestFreeRange);
+
+    // The empty block is kept, and serves the next allocations.
+    SubAllocation *half = allocate(kBlockSize / 2);
+    EXPECT_EQ(1u, mCallbacks.getAllocateCount());
+    MemoryAllocator::Free(half);
+}
+
+// Allocations go to the smallest free range that fits, which keeps the large ranges available.
+TEST_F(MemoryAllocatorTest, BestFit)
+{
+    SubAllocation *first  = allocate(kBlockSize / 4);
+    SubAllocation *second = allocate(kBlockSize / 4);
+    SubAllocation *third  = allocate(kBlockSize / 4);
+    MemoryAllocator::Free(second);
+
+    // The free quarter is used instead of splitting the last quarter.
+    SubAllocation *small = allocate(4096);
+    EXPECT_GE(small->offset, kBlockSize / 4);
+    EXPECT_LT(small->offset, kBlockSize / 2);
+    EXPECT_EQ(kBlockSize / 4, getStatistics().largestFreeRange);
+
+    MemoryAllocator::Free(first);
+    MemoryAllocator::Free(third);
+    MemoryAllocator::Free(small);
+}
+
+// Allocations larger than half a block get memory of their own, that is freed right away.
+TEST_F(MemoryAllocatorTest, DedicatedAllocations)
+{
+    SubAllocation *large = allocate(kBlockSize * 3);
+    EXPECT_EQ(0u, large->offset);
+    EXPECT_EQ(1u, mCallbacks.getBlockCount());
+
+    MemoryAllocatorStatistics statistics = getStatistics();
+    EXPECT_EQ(0u, statistics.blockCount);
+    EXPECT_EQ(1u, statistics.dedicatedAllocationCount);
+    EXPECT_EQ(kBlockSize * 3, statistics.deviceAllocatedBytes);
+
+    MemoryAllocator::Free(large);
+    EXPECT_EQ(0u, mCallbacks.getBlockCount());
+    EXPECT_EQ(0u, getStatistics().dedicatedAllocationCount);
+}
+
+// Linear and optimal resources never share a block.
+TEST_F(MemoryAllocatorTest, TilingsUseSeparateBlocks)
+{
+    SubAllocation *linear  = allocate(4096, 1, MemoryTiling::Linear);
+    SubAllocation *optimal = allocate(4096, 1, MemoryTiling::Optimal);
+    EXPECT_NE(linear->memory, optimal->memory);
+    EXPECT_EQ(2u, mCallbacks.getBlockCount());
+
+    MemoryAllocatorStatistics linearStatistics;
+    mAllocator.getHeapStatistics(kDeviceLocalType, MemoryTiling::Linear, &linearStatistics);
+    EXPECT_EQ(1u, linearStatistics.blockCount);
+    EXPECT_EQ(1u, linearStatistics.allocationCount);
+
+    MemoryAllocator::Free(linear);
+    MemoryAllocator::Free(optimal);
+}
+
+// The allocations of host visible memory point into their mapped block.
+TEST_F(MemoryAllocatorTest, MappedMemory)
+{
+    SubAllocation *first  = allocate(1000, 1, MemoryTiling::Linear, kHostVisibleType);
+    SubAllocation *second = allocate(1000, 1, MemoryTiling::Linear, kHostVisibleType);
+    SubAllocation *device = allocate(1000, 1, MemoryTiling::Linear, kDeviceLocalType);
+
+    ASSERT_NE(nullptr, first->mappedMemory);
+    ASSERT_NE(nullptr, second->mappedMemory);
+    EXPECT_EQ(first->mappedMemory + (second->offset - first->offset), second->mappedMemory);
+    EXPECT_EQ(nullptr, device->mappedMemory);
+
+    // The mapped ranges can be written.
+    memset(first->mappedMemory, 1, first->size);
+    memset(second->mappedMemory, 2, second->size);
+    EXPECT_EQ(1u, first->mappedMemory[first->size - 1]);
+
+    MemoryAllocator::Free(first);
+    MemoryAllocator::Free(second);
+    MemoryAllocator::Free(device);
+}
+
+// A heap keeps at most one empty block, and trim() frees it.
+TEST_F(MemoryAllocatorTest, EmptyBlocksAndTrim)
+{
+    std::vector<SubAllocation *> allocations;
+    for (size_t index = 0; index < 4; index++)
+    {
+        allocations.push_back(allocate(kBlockSize / 2));
+    }
+    EXPECT_EQ(2u, mCallbacks.getBlockCount());
+
+    for (SubAllocation *allocation : allocations)
+    {
+        MemoryAllocator::Free(allocation);
+    }
+    EXPECT_EQ(1u, mCallbacks.getBlockCount());
+    EXPECT_EQ(1u, getStatistics().emptyBlockCount);
+
+    EXPECT_EQ(kBlockSize, mAllocator.trim());
+    EXPECT_EQ(0u, mCallbacks.getBlockCount());
+    EXPECT_EQ(0u, getStatistics().blockCount);
+
+    // The slot of the freed block is reused.
+    SubAllocation *allocation = allocate(4096);
+    EXPECT_EQ(1u, getStatistics().blockCount);
+    MemoryAllocator::Free(allocation);
+}
+
+// Sparse blocks are reported first for defragmentation, and full blocks not at all.
+TEST_F(MemoryAllocatorTest, DefragmentationCandidates)
+{
+    std::vector<SubAllocation *> allocations;
+    for (size_t index = 0; index < 8; index++)
+    {
+        allocations.push_back(allocate(kBlockSize / 4));
+    }
+    VkDeviceMemory firstBlock  = allocations[0]->memory;
+    VkDeviceMemory secondBlock = allocations[4]->memory;
+    ASSERT_NE(firstBlock, secondBlock);
+
+    std::vector<VkDeviceMemory> candidates;
+    mAllocator.getDefragmentationCandidates(0.5, &candidates);
+    EXPECT_TRUE(candidates.empty());
+
+    // A quarter of the second block and half of the first are left.
+    MemoryAllocator::Free(allocations[0]);
+    MemoryAllocator::Free(allocations[1]);
+    MemoryAllocator::Free(allocations[4]);
+    MemoryAllocator::Free(allocations[5]);
+    MemoryAllocator::Free(allocations[6]);
+
+    mAllocator.getDefragmentationCandidates(0.5, &candidates);
+    ASSERT_EQ(2u, candidates.size());
+    EXPECT_EQ(secondBlock, candidates[0]);
+    EXPECT_EQ(firstBlock, candidates[1]);
+
+    mAllocator.getDefragmentationCandidates(0.25, &candidates);
+    ASSERT_EQ(1u, candidates.size());
+    EXPECT_EQ(secondBlock, candidates[0]);
+
+    MemoryAllocator::Free(allocations[2]);
+    MemoryAllocator::Free(allocations[3]);
+    MemoryAllocator::Free(allocations[7]);
+}
+
+// The statistics follow the allocations, and remember the peak number of device allocations.
+TEST_F(MemoryAllocatorTest, Statistics)
+{
+    SubAllocation *small   = allocate(1000);
+    SubAllocation *large   = allocate(kBlockSize * 2);
+    SubAllocation *optimal = allocate(5000, 1, MemoryTiling::Optimal);
+
+    MemoryAllocatorStatistics statistics = getStatistics();
+    EXPECT_EQ(3u, statistics.deviceAllocationCount);
+    EXPECT_EQ(3u, statistics.peakDeviceAllocationCount);
+    EXPECT_EQ(kBlockSize * 4, statistics.deviceAllocatedBytes);
+    EXPECT_EQ(2u, statistics.blockCount);
+    EXPECT_EQ(0u, statistics.emptyBlockCount);
+    EXPECT_EQ(3u, statistics.allocationCount);
+    EXPECT_EQ(1000u + kBlockSize * 2 + 5000u, statistics.allocatedBytes);
+    EXPECT_EQ(1024u + kBlockSize * 2 + 8192u, statistics.usedBytes);
+
+    MemoryAllocator::Free(large);
+    MemoryAllocator::Free(optimal);
+
+    statistics = getStatistics();
+    EXPECT_EQ(2u, statistics.deviceAllocationCount);
+    EXPECT_EQ(3u, statistics.peakDeviceAllocationCount);
+    EXPECT_EQ(1u, statistics.emptyBlockCount);
+    EXPECT_EQ(1u, statistics.allocationCount);
+    EXPECT_EQ(1000u, statistics.allocatedBytes);
+
+    MemoryAllocator::Free(small);
+}
+
+// Failures of the block allocation are returned, and leave the allocator unchanged.
+TEST_F(MemoryAllocatorTest, AllocationFailure)
+{
+    mCallbacks.setFailAllocations(true);
+
+    SubAllocation *allocation = nullptr;
+    EXPECT_EQ(VK_ERROR_OUT_OF_DEVICE_MEMORY,
+              mAllocator.allocate(kDeviceLocalType, MemoryTiling::Linear, 4096, 1, &allocation));
+    EXPECT_EQ(VK_ERROR_OUT_OF_DEVICE_MEMORY,
+              mAllocator.allocate(kDeviceLocalType, MemoryTiling::Linear, kBlockSize, 1,
+                                  &allocation));
+    EXPECT_EQ(nullptr, allocation);
+
+    MemoryAllocatorStatistics statistics = getStatistics();
+    EXPECT_EQ(0u, statistics.deviceAllocationCount);
+    EXPECT_EQ(0u, statistics.blockCount);
+    EXPECT_EQ(0u, statistics.allocationCount);
+
+    mCallbacks.setFailAllocations(false);
+    allocation = allocate(4096);
+    EXPECT_NE(nullptr, allocation);
+    MemoryAllocator::Free(allocation);
+}
+
+// The blocks are smaller for small heaps.
+TEST(MemoryAllocatorBlockSizeTest, GetBlockSizeForHeap)
+{
+    constexpr VkDeviceSize kMegabyte = 1024 * 1024;
+    EXPECT_EQ(MemoryAllocator::kMaxBlockSize,
+              MemoryAllocator::GetBlockSizeForHeap(8192 * kMegabyte));
+    EXPECT_EQ(32 * kMegabyte, MemoryAllocator::GetBlockSizeForHeap(256 * kMegabyte));
+    EXPECT_EQ(16 * kMegabyte, MemoryAllocator::GetBlockSizeForHeap(200 * kMegabyte));
+    EXPECT_EQ(MemoryAllocator::kMinBlockSize, MemoryAllocator::GetBlockSizeForHeap(2 * kMegabyte));
+}
+
+}  // anonymous namespace
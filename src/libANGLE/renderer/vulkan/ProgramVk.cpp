@@ -23,19 +23,17 @@ namespace rx
 namespace
 {
 
-gl::Error InitDefaultUniformBlock(const gl::Context *context,
-                                  VkDevice device,
-                                  gl::Shader *shader,
-                                  vk::BufferAndMemory *storageOut,
-                                  sh::BlockLayoutMap *blockLayoutMapOut,
-                                  size_t *requiredSizeOut)
+void InitDefaultUniformBlock(const gl::Context *context,
+                             gl::Shader *shader,
+                             sh::BlockLayoutMap *blockLayoutMapOut,
+                             size_t *requiredSizeOut)
 {
     const auto &uniforms = shader->getUniforms(context);
 
     if (uniforms.empty())
     {
         *requiredSizeOut = 0;
-        return gl::NoError();
+        return;
     }
 
     sh::Std140BlockEncoder blockEncoder;
@@ -44,31 +42,8 @@ gl::Error InitDefaultUniformBlock(const gl::Context *context,
     size_t blockSize = blockEncoder.getBlockSize();
 
     // TODO(jmadill): I think we still need a valid block for the pipeline even if zero sized.
-    if (blockSize == 0)
-    {
-        *requiredSizeOut = 0;
-        return gl::NoError();
-    }
-
-    VkBufferCreateInfo uniformBufferInfo;
-    uniformBufferInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    uniformBufferInfo.pNext                 = nullptr;
-    uniformBufferInfo.flags                 = 0;
-    uniformBufferInfo.size                  = blockSize;
-    uniformBufferInfo.usage                 = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
-    uniformBufferInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
-    uniformBufferInfo.queueFamilyIndexCount = 0;
-    uniformBufferInfo.pQueueFamilyIndices   = nullptr;
-
-    ANGLE_TRY(storageOut->buffer.init(device, uniformBufferInfo));
-
-    // Assume host vislble/coherent memory available.
-    VkMemoryPropertyFlags flags =
-        (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-    ANGLE_TRY(AllocateBufferMemory(vk::GetImpl(context), flags, &storageOut->buffer,
-                                   &storageOut->memory, requiredSizeOut));
-
-    return gl::NoError();
+    // The storage of the block is sub-allocated from the context's streaming uniform buffer.
+    *requiredSizeOut = blockSize;
 }
 
 template <typename T>
@@ -96,15 +71,14 @@ void UpdateDefaultUniformBlock(GLsizei count,
     }
 }
 
-vk::Error SyncDefaultUniformBlock(VkDevice device,
-                                  vk::DeviceMemory *bufferMemory,
-                                  const angle::MemoryBuffer &bufferData)
+vk::Error SyncDefaultUniformBlock(ContextVk *contextVk,
+                                  vk::DynamicBuffer *streamingBuffer,
+                                  const angle::MemoryBuffer &bufferData,
+                                  vk::DynamicBuffer::Allocation *allocationOut)
 {
-    ASSERT(bufferMemory->valid() && !bufferData.empty());
-    uint8_t *mapPointer = nullptr;
-    ANGLE_TRY(bufferMemory->map(device, 0, bufferData.size(), 0, &mapPointer));
-    memcpy(mapPointer, bufferData.data(), bufferData.size());
-    bufferMemory->unmap(device);
+    ASSERT(!bufferData.empty());
+    ANGLE_TRY(streamingBuffer->allocate(contextVk, bufferData.size(), allocationOut));
+    memcpy(allocationOut->ptr, bufferData.data(), bufferData.size());
     return vk::NoError();
 }
 
@@ -133,7 +107,11 @@ gl::Shader *GetShader(const gl::ProgramState &programState, uint32_t shaderIndex
 }  // anonymous namespace
 
 ProgramVk::DefaultUniformBlock::DefaultUniformBlock()
-    : storage(), uniformData(), uniformsDirty(false), uniformLayout()
+    : uniformData(),
+      uniformsDirty(false),
+      streamingAllocation(),
+      descriptorBuffer(VK_NULL_HANDLE),
+      uniformLayout()
 {
 }
 
@@ -142,7 +120,11 @@ ProgramVk::DefaultUniformBlock::~DefaultUniformBlock()
 }
 
 ProgramVk::ProgramVk(const gl::ProgramState &state)
-    : ProgramImpl(state), mDefaultUniformBlocks(), mUsedDescriptorSetRange(), mDirtyTextures(true)
+    : ProgramImpl(state),
+      mDefaultUniformBlocks(),
+      mDefaultUniformOffsets{{0, 0}},
+      mUsedDescriptorSetRange(),
+      mDirtyTextures(true)
 {
     mUsedDescriptorSetRange.invalidate();
 }
@@ -153,17 +135,23 @@ ProgramVk::~ProgramVk()
 
 void ProgramVk::destroy(const gl::Context *contextImpl)
 {
-    VkDevice device = vk::GetImpl(contextImpl)->getDevice();
-    reset(device);
+    reset(vk::GetImpl(contextImpl));
 }
 
-void ProgramVk::reset(VkDevice device)
+void ProgramVk::reset(ContextVk *contextVk)
 {
+    VkDevice device = contextVk->getDevice();
+
+    // The storage of the default uniforms belongs to the context's streaming uniform buffer.
     for (auto &uniformBlock : mDefaultUniformBlocks)
     {
-        uniformBlock.storage.memory.destroy(device);
-        uniformBlock.storage.buffer.destroy(device);
+        uniformBlock.uniformData.resize(0);
+        uniformBlock.uniformsDirty       = false;
+        uniformBlock.streamingAllocation = vk::DynamicBuffer::Allocation();
+        uniformBlock.descriptorBuffer    = VK_NULL_HANDLE;
+        uniformBlock.uniformLayout.clear();
     }
+    mDefaultUniformOffsets.fill(0);
 
     mEmptyUniformBlockStorage.memory.destroy(device);
     mEmptyUniformBlockStorage.buffer.destroy(device);
@@ -173,7 +161,11 @@ void ProgramVk::reset(VkDevice device)
     mVertexModuleSerial   = Serial();
     mFragmentModuleSerial = Serial();
 
-    // Descriptor Sets are pool allocated, so do not need to be explicitly freed.
+    // Draws that are already recorded can still use the descriptor sets.
+    for (VkDescriptorSet descriptorSet : mDescriptorSets)
+    {
+        contextVk->releaseDescriptorSet(descriptorSet);
+    }
     mDescriptorSets.clear();
     mUsedDescriptorSetRange.invalidate();
     mDirtyTextures       = false;
@@ -211,7 +203,7 @@ gl::LinkResult ProgramVk::link(const gl::Context *glContext,
     GlslangWrapper *glslangWrapper = renderer->getGlslangWrapper();
     VkDevice device                = renderer->getDevice();
 
-    reset(device);
+    reset(contextVk);
 
     std::vector<uint32_t> vertexCode;
     std::vector<uint32_t> fragmentCode;
@@ -272,10 +264,8 @@ gl::Error ProgramVk::initDefaultUniformBlocks(const gl::Context *glContext)
 
     for (uint32_t shaderIndex = MinShaderIndex; shaderIndex < MaxShaderIndex; ++shaderIndex)
     {
-        ANGLE_TRY(InitDefaultUniformBlock(glContext, device, GetShader(mState, shaderIndex),
-                                          &mDefaultUniformBlocks[shaderIndex].storage,
-                                          &layoutMap[shaderIndex],
-                                          &requiredBufferSize[shaderIndex]));
+        InitDefaultUniformBlock(glContext, GetShader(mState, shaderIndex), &layoutMap[shaderIndex],
+                                &requiredBufferSize[shaderIndex]);
     }
 
     // Init the default block layout info.
@@ -368,7 +358,8 @@ gl::Error ProgramVk::initDefaultUniformBlocks(const gl::Context *glContext)
                                            &mEmptyUniformBlockStorage.memory, &requiredSize));
         }
 
-        ANGLE_TRY(updateDefaultUniformsDescriptorSet(contextVk));
+        // The descriptor set is written when the uniforms are first copied to the streaming
+        // uniform buffer, which happens at the first draw.
 
         // Ensure the descriptor set range includes the uniform buffers at position 0.
         mUsedDescriptorSetRange.extend(0);
@@ -394,8 +385,16 @@ void ProgramVk::setUniformImpl(GLint location, GLsizei count, const T *v, GLenum
         for (auto &uniformBlock : mDefaultUniformBlocks)
         {
             const sh::BlockMemberInfo &layoutInfo = uniformBlock.uniformLayout[location];
+
+            // Assume an offset of -1 means the block is unused.
+            if (layoutInfo.offset == -1)
+            {
+                continue;
+            }
+
             UpdateDefaultUniformBlock(count, linkedUniform.typeInfo->componentCount, v, layoutInfo,
                                       &uniformBlock.uniformData);
+            uniformBlock.uniformsDirty = true;
         }
     }
     else
@@ -599,6 +598,29 @@ vk::Error ProgramVk::initDescriptorSets(ContextVk *contextVk)
     return vk::NoError();
 }
 
+vk::Error ProgramVk::allocateDefaultUniformsDescriptorSet(ContextVk *contextVk)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+    VkDevice device      = contextVk->getDevice();
+
+    vk::DescriptorPool *descriptorPool = contextVk->getDescriptorPool();
+
+    VkDescriptorSetAllocateInfo allocInfo;
+    allocInfo.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.pNext              = nullptr;
+    allocInfo.descriptorPool     = descriptorPool->getHandle();
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts        = renderer->getGraphicsDescriptorSetLayouts()[0].ptr();
+
+    VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+    ANGLE_TRY(descriptorPool->allocateDescriptorSets(device, allocInfo, &descriptorSet));
+
+    // Draws that are already recorded keep using the current set until their serial completes.
+    contextVk->releaseDescriptorSet(mDescriptorSets[0]);
+    mDescriptorSets[0] = descriptorSet;
+    return vk::NoError();
+}
+
 void ProgramVk::getUniformfv(const gl::Context *context, GLint location, GLfloat *params) const
 {
     UNIMPLEMENTED();
@@ -616,28 +638,57 @@ void ProgramVk::getUniformuiv(const gl::Context *context, GLint location, GLuint
 
 vk::Error ProgramVk::updateUniforms(ContextVk *contextVk)
 {
-    if (!mDefaultUniformBlocks[VertexShader].uniformsDirty &&
-        !mDefaultUniformBlocks[FragmentShader].uniformsDirty)
+    if (!mUsedDescriptorSetRange.contains(0))
     {
         return vk::NoError();
     }
 
-    ASSERT(mUsedDescriptorSetRange.contains(0));
+    vk::DynamicBuffer *streamingBuffer = contextVk->getStreamingUniformBuffer();
+    bool descriptorSetDirty            = false;
 
-    VkDevice device = contextVk->getDevice();
+    // The set that was allocated at link time is used until it's first written.
+    bool descriptorSetWritten = false;
+    for (const DefaultUniformBlock &uniformBlock : mDefaultUniformBlocks)
+    {
+        descriptorSetWritten |= (uniformBlock.descriptorBuffer != VK_NULL_HANDLE);
+    }
 
-    // Update buffer memory by immediate mapping. This immediate update only works once.
-    // TODO(jmadill): Handle inserting updates into the command stream, or use dynamic buffers.
-    for (auto &uniformBlock : mDefaultUniformBlocks)
+    // Copy the uniforms to a new place in the streaming buffer, so that draws that are already
+    // recorded keep reading the old values. Uniforms that didn't change must be copied too when
+    // the streaming buffer moved on to another block, since their block can be recycled.
+    for (uint32_t shaderIndex = MinShaderIndex; shaderIndex < MaxShaderIndex; ++shaderIndex)
     {
-        if (uniformBlock.uniformsDirty)
+        DefaultUniformBlock &uniformBlock = mDefaultUniformBlocks[shaderIndex];
+        if (uniformBlock.uniformData.empty() ||
+            (!uniformBlock.uniformsDirty &&
+             streamingBuffer->isCurrent(uniformBlock.streamingAllocation)))
         {
-            ANGLE_TRY(SyncDefaultUniformBlock(device, &uniformBlock.storage.memory,
-                                              uniformBlock.uniformData));
-            uniformBlock.uniformsDirty = false;
+            continue;
+        }
+
+        ANGLE_TRY(SyncDefaultUniformBlock(contextVk, streamingBuffer, uniformBlock.uniformData,
+                                          &uniformBlock.streamingAllocation));
+        uniformBlock.uniformsDirty          = false;
+        mDefaultUniformOffsets[shaderIndex] = uniformBlock.streamingAllocation.offset;
+
+        if (uniformBlock.streamingAllocation.buffer != uniformBlock.descriptorBuffer)
+        {
+            descriptorSetDirty = true;
         }
     }
 
+    // The descriptor set only needs to be written when the streaming buffer moves on to another
+    // block. Otherwise, the new offsets are given when the set is bound. Since draws that are
+    // already recorded might still use the set, a new one is written instead.
+    if (descriptorSetDirty)
+    {
+        if (descriptorSetWritten)
+        {
+            ANGLE_TRY(allocateDefaultUniformsDescriptorSet(contextVk));
+        }
+        ANGLE_TRY(updateDefaultUniformsDescriptorSet(contextVk));
+    }
+
     return vk::NoError();
 }
 
@@ -651,17 +702,21 @@ vk::Error ProgramVk::updateDefaultUniformsDescriptorSet(ContextVk *contextVk)
     {
         auto &bufferInfo = descriptorBufferInfo[bufferCount];
 
+        // The offset of the data in the buffer is added by the dynamic offset.
         if (!uniformBlock.uniformData.empty())
         {
-            bufferInfo.buffer = uniformBlock.storage.buffer.getHandle();
+            ASSERT(uniformBlock.streamingAllocation.buffer != VK_NULL_HANDLE);
+            uniformBlock.descriptorBuffer = uniformBlock.streamingAllocation.buffer;
+            bufferInfo.buffer             = uniformBlock.descriptorBuffer;
+            bufferInfo.range              = uniformBlock.uniformData.size();
         }
         else
         {
             bufferInfo.buffer = mEmptyUniformBlockStorage.buffer.getHandle();
+            bufferInfo.range  = VK_WHOLE_SIZE;
         }
 
         bufferInfo.offset = 0;
-        bufferInfo.range  = VK_WHOLE_SIZE;
 
         auto &writeInfo = writeDescriptorInfo[bufferCount];
 
@@ -671,7 +726,7 @@ vk::Error ProgramVk::updateDefaultUniformsDescriptorSet(ContextVk *contextVk)
         writeInfo.dstBinding       = bufferCount;
         writeInfo.dstArrayElement  = 0;
         writeInfo.descriptorCount  = 1;
-        writeInfo.descriptorType   = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        writeInfo.descriptorType   = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
         writeInfo.pImageInfo       = nullptr;
         writeInfo.pBufferInfo      = &bufferInfo;
         writeInfo.pTexelBufferView = nullptr;
@@ -691,6 +746,11 @@ const std::vector<VkDescriptorSet> &ProgramVk::getDescriptorSets() const
     return mDescriptorSets;
 }
 
+const std::array<uint32_t, 2> &ProgramVk::getDefaultUniformOffsets() const
+{
+    return mDefaultUniformOffsets;
+}
+
 const gl::RangeUI &ProgramVk::getUsedDescriptorSetRange() const
 {
     return mUsedDescriptorSetRange;
@@ -12,6 +12,7 @@
 
 #include "libANGLE/Constants.h"
 #include "libANGLE/renderer/ProgramImpl.h"
+#include "libANGLE/renderer/vulkan/DynamicBuffer.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
 #include <array>
@@ -108,6 +109,9 @@ class ProgramVk : public ProgramImpl
 
     const std::vector<VkDescriptorSet> &getDescriptorSets() const;
 
+    // The dynamic offsets of the vertex and fragment default uniform blocks in the first set.
+    const std::array<uint32_t, 2> &getDefaultUniformOffsets() const;
+
     // In Vulkan, it is invalid to pass in a NULL descriptor set to vkCmdBindDescriptorSets.
     // However, it's valid to leave them in an undefined, unbound state, if they are never used.
     // This means when we want to ignore a descriptor set index, we need to pass in an offset
@@ -120,8 +124,9 @@ class ProgramVk : public ProgramImpl
     void invalidateTextures();
 
   private:
-    void reset(VkDevice device);
+    void reset(ContextVk *contextVk);
     vk::Error initDescriptorSets(ContextVk *contextVk);
+    vk::Error allocateDefaultUniformsDescriptorSet(ContextVk *contextVk);
     gl::Error initDefaultUniformBlocks(const gl::Context *glContext);
     vk::Error updateDefaultUniformsDescriptorSet(ContextVk *contextVk);
 
@@ -139,18 +144,22 @@ class ProgramVk : public ProgramImpl
         DefaultUniformBlock();
         ~DefaultUniformBlock();
 
-        vk::BufferAndMemory storage;
-
         // Shadow copies of the shader uniform data.
         angle::MemoryBuffer uniformData;
         bool uniformsDirty;
 
+        // Where the uniform data was last copied in the context's streaming uniform buffer, and
+        // the buffer that the descriptor set points to.
+        vk::DynamicBuffer::Allocation streamingAllocation;
+        VkBuffer descriptorBuffer;
+
         // Since the default blocks are laid out in std140, this tells us where to write on a call
         // to a setUniform method. They are arranged in uniform location order.
         std::vector<sh::BlockMemberInfo> uniformLayout;
     };
 
     std::array<DefaultUniformBlock, 2> mDefaultUniformBlocks;
+    std::array<uint32_t, 2> mDefaultUniformOffsets;
 
     // This is a special "empty" placeholder buffer for when a shader has no uniforms.
     // It is necessary because we want to keep a compatible pipeline layout in all cases,
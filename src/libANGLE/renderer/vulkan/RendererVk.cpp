@@ -13,9 +13,13 @@
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
 #include <EGL/eglext.h>
+#include <anglebase/sha1.h>
+
+#include <iomanip>
 
 #include "common/debug.h"
 #include "common/system_utils.h"
+#include "libANGLE/MemoryProgramCache.h"
 #include "libANGLE/renderer/driver_utils.h"
 #include "libANGLE/renderer/vulkan/CommandBufferNode.h"
 #include "libANGLE/renderer/vulkan/CompilerVk.h"
@@ -34,6 +38,9 @@ namespace rx
 namespace
 {
 
+// Number of frames between the checks for new pipelines in the pipeline cache.
+constexpr uint32_t kPipelineCacheVkSyncPeriod = 60;
+
 VkResult VerifyExtensionsPresent(const std::vector<VkExtensionProperties> &extensionProps,
                                  const std::vector<const char *> &enabledExtensionNames)
 {
@@ -150,6 +157,78 @@ class ScopedVkLoaderEnvironment : angle::NonCopyable
     Optional<std::string> mPreviousCWD;
 };
 
+// The driver ignores pipeline cache data from other devices and driver versions, but keying the
+// data by them keeps the data of each GPU apart in the program cache.
+void ComputePipelineCacheVkKey(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                               gl::ProgramHash *hashOut)
+{
+    std::stringstream keyStream;
+    keyStream << "VkPipelineCache " << std::hex << physicalDeviceProperties.vendorID << " "
+              << physicalDeviceProperties.deviceID << " " << physicalDeviceProperties.driverVersion
+              << " " << std::setfill('0');
+    for (uint8_t uuidByte : physicalDeviceProperties.pipelineCacheUUID)
+    {
+        keyStream << std::setw(2) << static_cast<unsigned int>(uuidByte);
+    }
+
+    const std::string key = keyStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(key.c_str()), key.length(),
+                               hashOut->data());
+}
+
+// Allocates the blocks of the memory allocator from the device. The blocks of host visible memory
+// are mapped once, and are implicitly unmapped when they are freed.
+class DeviceMemoryBlockCallbacks final : public vk::MemoryBlockCallbacks
+{
+  public:
+    DeviceMemoryBlockCallbacks(RendererVk *renderer) : mRenderer(renderer) {}
+
+    VkResult allocateBlock(uint32_t memoryTypeIndex,
+                           VkDeviceSize size,
+                           VkDeviceMemory *memoryOut,
+                           uint8_t **mappedMemoryOut) override
+    {
+        VkDevice device = mRenderer->getDevice();
+
+        VkMemoryAllocateInfo allocInfo;
+        allocInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.pNext           = nullptr;
+        allocInfo.memoryTypeIndex = memoryTypeIndex;
+        allocInfo.allocationSize  = size;
+
+        VkResult result = vkAllocateMemory(device, &allocInfo, nullptr, memoryOut);
+        if (result != VK_SUCCESS)
+        {
+            return result;
+        }
+
+        *mappedMemoryOut = nullptr;
+        VkMemoryPropertyFlags propertyFlags =
+            mRenderer->getMemoryProperties().getMemoryTypePropertyFlags(memoryTypeIndex);
+        if ((propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0)
+        {
+            result = vkMapMemory(device, *memoryOut, 0, VK_WHOLE_SIZE, 0,
+                                 reinterpret_cast<void **>(mappedMemoryOut));
+            if (result != VK_SUCCESS)
+            {
+                vkFreeMemory(device, *memoryOut, nullptr);
+                *memoryOut = VK_NULL_HANDLE;
+                return result;
+            }
+        }
+
+        return VK_SUCCESS;
+    }
+
+    void freeBlock(VkDeviceMemory memory) override
+    {
+        vkFreeMemory(mRenderer->getDevice(), memory, nullptr);
+    }
+
+  private:
+    RendererVk *mRenderer;
+};
+
 }  // anonymous namespace
 
 // CommandBatch implementation.
@@ -187,7 +266,10 @@ RendererVk::RendererVk()
       mGlslangWrapper(nullptr),
       mLastCompletedQueueSerial(mQueueSerialFactory.generate()),
       mCurrentQueueSerial(mQueueSerialFactory.generate()),
-      mInFlightCommands()
+      mInFlightCommands(),
+      mProgramCache(nullptr),
+      mPipelineCacheVkStoredSize(0),
+      mFramesSincePipelineCacheVkSync(0)
 {
 }
 
@@ -213,6 +295,13 @@ RendererVk::~RendererVk()
     mRenderPassCache.destroy(mDevice);
     mPipelineCache.destroy(mDevice);
 
+    vk::Error error = syncPipelineCacheVk();
+    if (error.isError())
+    {
+        ERR() << "Error storing the VK pipeline cache: " << error;
+    }
+    mPipelineCacheVk.destroy(mDevice);
+
     if (mGlslangWrapper)
     {
         GlslangWrapper::ReleaseReference();
@@ -224,6 +313,14 @@ RendererVk::~RendererVk()
         mCommandPool.destroy(mDevice);
     }
 
+    for (vk::CommandBufferPool &commandPool : mFreeCommandPools)
+    {
+        commandPool.destroy(mDevice);
+    }
+    mFreeCommandPools.clear();
+
+    mMemoryAllocator.destroy();
+
     if (mDevice)
     {
         vkDestroyDevice(mDevice, nullptr);
@@ -248,8 +345,12 @@ RendererVk::~RendererVk()
     mPhysicalDevice = VK_NULL_HANDLE;
 }
 
-vk::Error RendererVk::initialize(const egl::AttributeMap &attribs, const char *wsiName)
+vk::Error RendererVk::initialize(const egl::AttributeMap &attribs,
+                                 const char *wsiName,
+                                 gl::MemoryProgramCache *programCache)
 {
+    mProgramCache = programCache;
+
     ScopedVkLoaderEnvironment scopedEnvironment(ShouldUseDebugLayers(attribs));
     mEnableValidationLayers = scopedEnvironment.canEnableValidationLayers();
 
@@ -389,6 +490,17 @@ vk::Error RendererVk::initialize(const egl::AttributeMap &attribs, const char *w
     // Store the physical device memory properties so we can find the right memory pools.
     mMemoryProperties.init(mPhysicalDevice);
 
+    // The blocks are allocated with the device, once it is created.
+    std::vector<VkDeviceSize> memoryBlockSizes;
+    for (uint32_t memoryTypeIndex = 0; memoryTypeIndex < mMemoryProperties.getMemoryTypeCount();
+         memoryTypeIndex++)
+    {
+        memoryBlockSizes.push_back(vk::MemoryAllocator::GetBlockSizeForHeap(
+            mMemoryProperties.getMemoryTypeHeapSize(memoryTypeIndex)));
+    }
+    mMemoryBlockCallbacks.reset(new DeviceMemoryBlockCallbacks(this));
+    mMemoryAllocator.init(mMemoryBlockCallbacks.get(), memoryBlockSizes);
+
     mGlslangWrapper = GlslangWrapper::GetReference();
 
     // Initialize the format table.
@@ -469,13 +581,9 @@ vk::Error RendererVk::initializeDevice(uint32_t queueFamilyIndex)
     vkGetDeviceQueue(mDevice, mCurrentQueueFamilyIndex, 0, &mQueue);
 
     // Initialize the command pool now that we know the queue family index.
-    VkCommandPoolCreateInfo commandPoolInfo;
-    commandPoolInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-    commandPoolInfo.pNext            = nullptr;
-    commandPoolInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
-    commandPoolInfo.queueFamilyIndex = mCurrentQueueFamilyIndex;
+    ANGLE_TRY(mCommandPool.init(mDevice, mCurrentQueueFamilyIndex));
 
-    ANGLE_TRY(mCommandPool.init(mDevice, commandPoolInfo));
+    ANGLE_TRY(initPipelineCacheVk());
 
     return vk::NoError();
 }
@@ -592,9 +700,9 @@ const gl::Limitations &RendererVk::getNativeLimitations() const
     return mNativeLimitations;
 }
 
-const vk::CommandPool &RendererVk::getCommandPool() const
+vk::CommandBufferPool *RendererVk::getCommandPool()
 {
-    return mCommandPool;
+    return &mCommandPool;
 }
 
 vk::Error RendererVk::finish(const gl::Context *context)
@@ -620,16 +728,16 @@ vk::Error RendererVk::finish(const gl::Context *context)
 
     ASSERT(mQueue != VK_NULL_HANDLE);
     ANGLE_VK_TRY(vkQueueWaitIdle(mQueue));
-    freeAllInFlightResources();
+    ANGLE_TRY(freeAllInFlightResources());
     return vk::NoError();
 }
 
-void RendererVk::freeAllInFlightResources()
+vk::Error RendererVk::freeAllInFlightResources()
 {
     for (CommandBatch &batch : mInFlightCommands)
     {
         batch.fence.destroy(mDevice);
-        batch.commandPool.destroy(mDevice);
+        ANGLE_TRY(recycleCommandPool(&batch.commandPool));
     }
     mInFlightCommands.clear();
 
@@ -638,6 +746,16 @@ void RendererVk::freeAllInFlightResources()
         garbage.destroy(mDevice);
     }
     mGarbage.clear();
+
+    return vk::NoError();
+}
+
+vk::Error RendererVk::recycleCommandPool(vk::CommandBufferPool *commandPool)
+{
+    // Resetting keeps the memory and the command buffers of the pool for the next frame.
+    ANGLE_TRY(commandPool->reset(mDevice));
+    mFreeCommandPools.emplace_back(std::move(*commandPool));
+    return vk::NoError();
 }
 
 vk::Error RendererVk::checkInFlightCommands()
@@ -655,7 +773,7 @@ vk::Error RendererVk::checkInFlightCommands()
         mLastCompletedQueueSerial = batch.serial;
 
         batch.fence.destroy(mDevice);
-        batch.commandPool.destroy(mDevice);
+        ANGLE_TRY(recycleCommandPool(&batch.commandPool));
         ++finishedCount;
     }
 
@@ -707,15 +825,17 @@ vk::Error RendererVk::submitFrame(const VkSubmitInfo &submitInfo, vk::CommandBuf
     // Simply null out the command buffer here - it was allocated using the command pool.
     commandBuffer.releaseHandle();
 
-    // Reallocate the command pool for next frame.
-    // TODO(jmadill): Consider reusing command pools.
-    VkCommandPoolCreateInfo poolInfo;
-    poolInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-    poolInfo.pNext            = nullptr;
-    poolInfo.flags            = 0;
-    poolInfo.queueFamilyIndex = mCurrentQueueFamilyIndex;
-
-    mCommandPool.init(mDevice, poolInfo);
+    // Take a pool of a completed frame for the next frame, or create one if the GPU is still busy
+    // with all of them.
+    if (!mFreeCommandPools.empty())
+    {
+        mCommandPool = std::move(mFreeCommandPools.back());
+        mFreeCommandPools.pop_back();
+    }
+    else
+    {
+        ANGLE_TRY(mCommandPool.init(mDevice, mCurrentQueueFamilyIndex));
+    }
 
     return vk::NoError();
 }
@@ -757,22 +877,20 @@ vk::Error RendererVk::getRenderPassWithOps(const vk::RenderPassDesc &desc,
 
 vk::CommandBufferNode *RendererVk::allocateCommandNode()
 {
-    // TODO(jmadill): Use a pool allocator for the CPU node allocations.
-    vk::CommandBufferNode *newCommands = new vk::CommandBufferNode();
+    size_t nodeIndex = mOpenCommandGraph.size();
+    if (nodeIndex == mCommandNodeArena.size())
+    {
+        mCommandNodeArena.emplace_back(new vk::CommandBufferNode());
+    }
+
+    vk::CommandBufferNode *newCommands = mCommandNodeArena[nodeIndex].get();
     mOpenCommandGraph.emplace_back(newCommands);
     return newCommands;
 }
 
 vk::Error RendererVk::flushCommandGraph(const gl::Context *context, vk::CommandBuffer *commandBatch)
 {
-    VkCommandBufferAllocateInfo primaryInfo;
-    primaryInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    primaryInfo.pNext              = nullptr;
-    primaryInfo.commandPool        = mCommandPool.getHandle();
-    primaryInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    primaryInfo.commandBufferCount = 1;
-
-    ANGLE_TRY(commandBatch->init(mDevice, primaryInfo));
+    ANGLE_TRY(mCommandPool.allocate(mDevice, VK_COMMAND_BUFFER_LEVEL_PRIMARY, commandBatch));
 
     if (mOpenCommandGraph.empty())
     {
@@ -829,10 +947,10 @@ vk::Error RendererVk::flushCommandGraph(const gl::Context *context, vk::CommandB
 
 void RendererVk::resetCommandGraph()
 {
-    // TODO(jmadill): Use pool allocation so we don't need to deallocate command graph.
+    // The nodes stay in the arena for the next command graph.
     for (vk::CommandBufferNode *node : mOpenCommandGraph)
     {
-        delete node;
+        node->reset();
     }
     mOpenCommandGraph.clear();
 }
@@ -858,6 +976,12 @@ vk::Error RendererVk::flush(const gl::Context *context,
     submitInfo.pSignalSemaphores    = signalSemaphore.ptr();
 
     ANGLE_TRY(submitFrame(submitInfo, std::move(commandBatch)));
+
+    if (++mFramesSincePipelineCacheVkSync >= kPipelineCacheVkSyncPeriod)
+    {
+        ANGLE_TRY(syncPipelineCacheVk());
+    }
+
     return vk::NoError();
 }
 
@@ -876,7 +1000,8 @@ vk::Error RendererVk::initGraphicsPipelineLayout()
     ASSERT(!mGraphicsPipelineLayout.valid());
 
     // Create two descriptor set layouts: one for default uniform info, and one for textures.
-    // Skip one or both if there are no uniforms.
+    // Skip one or both if there are no uniforms. The default uniforms are streamed through a
+    // dynamic buffer, so their offsets are given when the descriptor sets are bound.
     VkDescriptorSetLayoutBinding uniformBindings[2];
     uint32_t blockCount = 0;
 
@@ -884,7 +1009,7 @@ vk::Error RendererVk::initGraphicsPipelineLayout()
         auto &layoutBinding = uniformBindings[blockCount];
 
         layoutBinding.binding            = blockCount;
-        layoutBinding.descriptorType     = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        layoutBinding.descriptorType     = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
         layoutBinding.descriptorCount    = 1;
         layoutBinding.stageFlags         = VK_SHADER_STAGE_VERTEX_BIT;
         layoutBinding.pImmutableSamplers = nullptr;
@@ -896,7 +1021,7 @@ vk::Error RendererVk::initGraphicsPipelineLayout()
         auto &layoutBinding = uniformBindings[blockCount];
 
         layoutBinding.binding            = blockCount;
-        layoutBinding.descriptorType     = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        layoutBinding.descriptorType     = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
         layoutBinding.descriptorCount    = 1;
         layoutBinding.stageFlags         = VK_SHADER_STAGE_FRAGMENT_BIT;
         layoutBinding.pImmutableSamplers = nullptr;
@@ -978,9 +1103,68 @@ vk::Error RendererVk::getPipeline(const ProgramVk *programVk,
     vk::RenderPass *compatibleRenderPass = nullptr;
     ANGLE_TRY(getCompatibleRenderPass(desc.getRenderPassDesc(), &compatibleRenderPass));
 
-    return mPipelineCache.getPipeline(mDevice, *compatibleRenderPass, mGraphicsPipelineLayout,
-                                      activeAttribLocationsMask, programVk->getLinkedVertexModule(),
+    return mPipelineCache.getPipeline(mDevice, mPipelineCacheVk, *compatibleRenderPass,
+                                      mGraphicsPipelineLayout, activeAttribLocationsMask,
+                                      programVk->getLinkedVertexModule(),
                                       programVk->getLinkedFragmentModule(), desc, pipelineOut);
 }
 
+vk::Error RendererVk::initPipelineCacheVk()
+{
+    ASSERT(!mPipelineCacheVk.valid());
+
+    angle::MemoryBuffer initialData;
+    if (mProgramCache)
+    {
+        gl::ProgramHash key;
+        ComputePipelineCacheVkKey(mPhysicalDeviceProperties, &key);
+        if (!mProgramCache->getBackendData(key, &initialData))
+        {
+            initialData.resize(0);
+        }
+    }
+
+    VkPipelineCacheCreateInfo createInfo;
+    createInfo.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.pNext           = nullptr;
+    createInfo.flags           = 0;
+    createInfo.initialDataSize = initialData.size();
+    createInfo.pInitialData    = initialData.empty() ? nullptr : initialData.data();
+
+    ANGLE_TRY(mPipelineCacheVk.init(mDevice, createInfo));
+    mPipelineCacheVkStoredSize = initialData.size();
+
+    return vk::NoError();
+}
+
+vk::Error RendererVk::syncPipelineCacheVk()
+{
+    mFramesSincePipelineCacheVkSync = 0;
+
+    if (!mProgramCache || !mPipelineCacheVk.valid())
+    {
+        return vk::NoError();
+    }
+
+    // Pipelines are only ever added to the cache, so the data only needs to be stored again when
+    // it grows. Getting the size is much cheaper than getting the data.
+    size_t dataSize = 0;
+    ANGLE_TRY(mPipelineCacheVk.getCacheData(mDevice, &dataSize, nullptr));
+    if (dataSize == mPipelineCacheVkStoredSize)
+    {
+        return vk::NoError();
+    }
+
+    angle::MemoryBuffer data;
+    ANGLE_VK_CHECK(data.resize(dataSize), VK_ERROR_OUT_OF_HOST_MEMORY);
+    ANGLE_TRY(mPipelineCacheVk.getCacheData(mDevice, &dataSize, data.data()));
+
+    gl::ProgramHash key;
+    ComputePipelineCacheVkKey(mPhysicalDeviceProperties, &key);
+    mProgramCache->putBackendData(key, data.data(), dataSize);
+    mPipelineCacheVkStoredSize = dataSize;
+
+    return vk::NoError();
+}
+
 }  // namespace rx
@@ -23,6 +23,11 @@ namespace egl
 class AttributeMap;
 }
 
+namespace gl
+{
+class MemoryProgramCache;
+}
+
 namespace rx
 {
 class FramebufferVk;
@@ -39,13 +44,20 @@ class RendererVk : angle::NonCopyable
     RendererVk();
     ~RendererVk();
 
-    vk::Error initialize(const egl::AttributeMap &attribs, const char *wsiName);
+    // The pipeline cache is restored from and stored to the program cache, if there is one.
+    vk::Error initialize(const egl::AttributeMap &attribs,
+                         const char *wsiName,
+                         gl::MemoryProgramCache *programCache);
 
     std::string getVendorString() const;
     std::string getRendererDescription() const;
 
     VkInstance getInstance() const { return mInstance; }
     VkPhysicalDevice getPhysicalDevice() const { return mPhysicalDevice; }
+    const VkPhysicalDeviceProperties &getPhysicalDeviceProperties() const
+    {
+        return mPhysicalDeviceProperties;
+    }
     VkQueue getQueue() const { return mQueue; }
     VkDevice getDevice() const { return mDevice; }
 
@@ -56,7 +68,8 @@ class RendererVk : angle::NonCopyable
                     const vk::Semaphore &waitSemaphore,
                     const vk::Semaphore &signalSemaphore);
 
-    const vk::CommandPool &getCommandPool() const;
+    // The pool of the commands that will be submitted by the next flush.
+    vk::CommandBufferPool *getCommandPool();
 
     const gl::Caps &getNativeCaps() const;
     const gl::TextureCapsMap &getNativeTextureCaps() const;
@@ -94,6 +107,9 @@ class RendererVk : angle::NonCopyable
 
     const vk::MemoryProperties &getMemoryProperties() const { return mMemoryProperties; }
 
+    // Sub-allocates the device memory of all the resources.
+    vk::MemoryAllocator *getMemoryAllocator() { return &mMemoryAllocator; }
+
     // TODO(jmadill): We could pass angle::Format::ID here.
     const vk::Format &getFormat(GLenum internalFormat) const
     {
@@ -111,7 +127,8 @@ class RendererVk : angle::NonCopyable
                           const gl::AttributesMask &activeAttribLocationsMask,
                           vk::PipelineAndSerial **pipelineOut);
 
-    // This should only be called from ResourceVk.
+    // This should only be called from ResourceVk. The node is owned by the node arena, and is
+    // reused after the next flush.
     // TODO(jmadill): Keep in ContextVk to enable threaded rendering.
     vk::CommandBufferNode *allocateCommandNode();
 
@@ -130,10 +147,13 @@ class RendererVk : angle::NonCopyable
                       gl::Limitations *outLimitations) const;
     vk::Error submitFrame(const VkSubmitInfo &submitInfo, vk::CommandBuffer &&commandBatch);
     vk::Error checkInFlightCommands();
-    void freeAllInFlightResources();
+    vk::Error freeAllInFlightResources();
+    vk::Error recycleCommandPool(vk::CommandBufferPool *commandPool);
     vk::Error flushCommandGraph(const gl::Context *context, vk::CommandBuffer *commandBatch);
     void resetCommandGraph();
     vk::Error initGraphicsPipelineLayout();
+    vk::Error initPipelineCacheVk();
+    vk::Error syncPipelineCacheVk();
 
     mutable bool mCapsInitialized;
     mutable gl::Caps mNativeCaps;
@@ -150,7 +170,7 @@ class RendererVk : angle::NonCopyable
     VkQueue mQueue;
     uint32_t mCurrentQueueFamilyIndex;
     VkDevice mDevice;
-    vk::CommandPool mCommandPool;
+    vk::CommandBufferPool mCommandPool;
     GlslangWrapper *mGlslangWrapper;
     SerialFactory mQueueSerialFactory;
     SerialFactory mProgramSerialFactory;
@@ -164,19 +184,36 @@ class RendererVk : angle::NonCopyable
         CommandBatch(CommandBatch &&other);
         CommandBatch &operator=(CommandBatch &&other);
 
-        vk::CommandPool commandPool;
+        vk::CommandBufferPool commandPool;
         vk::Fence fence;
         Serial serial;
     };
 
     std::vector<CommandBatch> mInFlightCommands;
+
+    // Command pools cycle from mCommandPool to mInFlightCommands, and once their serial completes,
+    // are reset and wait here to be used by a later frame.
+    std::vector<vk::CommandBufferPool> mFreeCommandPools;
     std::vector<vk::GarbageObject> mGarbage;
     vk::MemoryProperties mMemoryProperties;
+    std::unique_ptr<vk::MemoryBlockCallbacks> mMemoryBlockCallbacks;
+    vk::MemoryAllocator mMemoryAllocator;
     vk::FormatTable mFormatTable;
 
     RenderPassCache mRenderPassCache;
     PipelineCache mPipelineCache;
+
+    // The driver's cache of compiled pipelines, which is used for all pipeline creation. It is
+    // stored in the program cache, so that it survives the process when the disk cache is used.
+    vk::PipelineCache mPipelineCacheVk;
+    gl::MemoryProgramCache *mProgramCache;
+    size_t mPipelineCacheVkStoredSize;
+    uint32_t mFramesSincePipelineCacheVkSync;
+
+    // The nodes of the open command graph are the first mOpenCommandGraph.size() nodes of the
+    // arena. Flushing resets them, and they are handed out again instead of being reallocated.
     std::vector<vk::CommandBufferNode *> mOpenCommandGraph;
+    std::vector<std::unique_ptr<vk::CommandBufferNode>> mCommandNodeArena;
 
     // ANGLE uses a single pipeline layout for all GL programs. It is owned here in the Renderer.
     // See the design doc for an overview of the pipeline layout structure.
@@ -10,7 +10,9 @@
 #include "libANGLE/renderer/vulkan/TextureVk.h"
 
 #include "common/debug.h"
+#include "common/mathutil.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
 #include "libANGLE/renderer/vulkan/RendererVk.h"
 #include "libANGLE/renderer/vulkan/vk_format_utils.h"
@@ -115,8 +117,8 @@ gl::Error TextureVk::setImage(const gl::Context *context,
 
         VkMemoryPropertyFlags flags = (VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
         size_t requiredSize         = 0;
-        ANGLE_TRY(
-            vk::AllocateImageMemory(contextVk, flags, &mImage, &mDeviceMemory, &requiredSize));
+        ANGLE_TRY(vk::AllocateImageMemory(contextVk, flags, imageInfo.tiling, &mImage,
+                                          &mDeviceMemory, &requiredSize));
 
         VkImageViewCreateInfo viewInfo;
         viewInfo.sType                           = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
@@ -202,15 +204,9 @@ gl::Error TextureVk::setSubImageImpl(ContextVk *contextVk,
                                      GLenum type,
                                      const uint8_t *pixels)
 {
-    RendererVk *renderer       = contextVk->getRenderer();
-    VkDevice device            = renderer->getDevice();
     const gl::Extents &size    = mRenderTarget.extents;
     const vk::Format &vkFormat = *mRenderTarget.format;
 
-    vk::StagingImage stagingImage;
-    ANGLE_TRY(stagingImage.init(contextVk, TextureDimension::TEX_2D, vkFormat, size,
-                                vk::StagingUsage::Write));
-
     GLuint inputRowPitch = 0;
     ANGLE_TRY_RESULT(
         formatInfo.computeRowPitch(type, size.width, unpack.alignment, unpack.rowLength),
@@ -230,46 +226,51 @@ gl::Error TextureVk::setSubImageImpl(ContextVk *contextVk,
 
     auto loadFunction = vkFormat.loadFunctions(type);
 
-    uint8_t *mapPointer = nullptr;
-    ANGLE_TRY(stagingImage.getDeviceMemory().map(device, 0, VK_WHOLE_SIZE, 0, &mapPointer));
+    // The texels are tightly packed in the staging buffer of the context.
+    const gl::InternalFormat &storageFormatInfo =
+        gl::GetSizedInternalFormatInfo(vkFormat.textureFormat().glInternalFormat);
+    size_t outputRowPitch   = storageFormatInfo.pixelBytes * size.width;
+    size_t outputDepthPitch = outputRowPitch * size.height;
+    size_t stagingSize      = outputDepthPitch * size.depth;
 
-    const uint8_t *source = pixels + inputSkipBytes;
+    // The offset of the copy must be a multiple of both 4 and the texel size, which isn't always
+    // a power of two, so the allocation is padded to be able to move the data up.
+    size_t copyAlignment = storageFormatInfo.pixelBytes * 4;
 
-    // Get the subresource layout. This has important parameters like row pitch.
-    // TODO(jmadill): Fill out this structure based on input parameters.
-    VkImageSubresource subresource;
-    subresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    subresource.mipLevel   = 0;
-    subresource.arrayLayer = 0;
+    vk::DynamicBuffer::Allocation staging;
+    ANGLE_TRY(contextVk->getStagingBuffer()->allocate(contextVk, stagingSize + copyAlignment - 1,
+                                                      &staging));
 
-    VkSubresourceLayout subresourceLayout;
-    vkGetImageSubresourceLayout(device, stagingImage.getImage().getHandle(), &subresource,
-                                &subresourceLayout);
+    size_t copyOffset   = roundUp<size_t>(staging.offset, copyAlignment);
+    uint8_t *mapPointer = staging.ptr + (copyOffset - staging.offset);
 
+    const uint8_t *source = pixels + inputSkipBytes;
     loadFunction.loadFunction(size.width, size.height, size.depth, source, inputRowPitch,
-                              inputDepthPitch, mapPointer,
-                              static_cast<size_t>(subresourceLayout.rowPitch),
-                              static_cast<size_t>(subresourceLayout.depthPitch));
-
-    stagingImage.getDeviceMemory().unmap(device);
+                              inputDepthPitch, mapPointer, outputRowPitch, outputDepthPitch);
 
     vk::CommandBuffer *commandBuffer = nullptr;
-    ANGLE_TRY(beginWriteOperation(renderer, &commandBuffer));
+    ANGLE_TRY(contextVk->beginUploadOperation(this, &commandBuffer));
 
-    stagingImage.getImage().changeLayoutWithStages(
-        VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, commandBuffer);
     mImage.changeLayoutWithStages(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                                   VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
                                   VK_PIPELINE_STAGE_TRANSFER_BIT, commandBuffer);
 
-    gl::Box wholeRegion(0, 0, 0, size.width, size.height, size.depth);
-    commandBuffer->copySingleImage(stagingImage.getImage(), mImage, wholeRegion,
-                                   VK_IMAGE_ASPECT_COLOR_BIT);
-
-    // Immediately release staging image.
-    // TODO(jmadill): Staging image re-use.
-    renderer->releaseObject(renderer->getCurrentQueueSerial(), &stagingImage);
+    VkBufferImageCopy region;
+    region.bufferOffset                    = static_cast<VkDeviceSize>(copyOffset);
+    region.bufferRowLength                 = 0;
+    region.bufferImageHeight               = 0;
+    region.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel       = 0;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount     = 1;
+    region.imageOffset.x                   = 0;
+    region.imageOffset.y                   = 0;
+    region.imageOffset.z                   = 0;
+    region.imageExtent.width               = size.width;
+    region.imageExtent.height              = size.height;
+    region.imageExtent.depth               = size.depth;
+
+    commandBuffer->copyBufferToImage(staging.buffer, mImage, 1, &region);
     return gl::NoError();
 }
 
@@ -124,7 +124,7 @@ class TextureVk : public TextureImpl, public ResourceVk
 
     // TODO(jmadill): support a more flexible storage back-end.
     vk::Image mImage;
-    vk::DeviceMemory mDeviceMemory;
+    vk::MemoryAllocation mDeviceMemory;
     vk::ImageView mImageView;
     vk::Sampler mSampler;
 
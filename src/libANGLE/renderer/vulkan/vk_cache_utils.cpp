@@ -351,6 +351,7 @@ void PipelineDesc::initDefaults()
 }
 
 Error PipelineDesc::initializePipeline(VkDevice device,
+                                       const PipelineCache &pipelineCacheVk,
                                        const RenderPass &compatibleRenderPass,
                                        const PipelineLayout &pipelineLayout,
                                        const gl::AttributesMask &activeAttribLocationsMask,
@@ -533,7 +534,7 @@ Error PipelineDesc::initializePipeline(VkDevice device,
     createInfo.basePipelineHandle  = VK_NULL_HANDLE;
     createInfo.basePipelineIndex   = 0;
 
-    ANGLE_TRY(pipelineOut->initGraphics(device, createInfo));
+    ANGLE_TRY(pipelineOut->initGraphics(device, createInfo, pipelineCacheVk));
 
     return NoError();
 }
@@ -784,6 +785,7 @@ void PipelineCache::destroy(VkDevice device)
 }
 
 vk::Error PipelineCache::getPipeline(VkDevice device,
+                                     const vk::PipelineCache &pipelineCacheVk,
                                      const vk::RenderPass &compatibleRenderPass,
                                      const vk::PipelineLayout &pipelineLayout,
                                      const gl::AttributesMask &activeAttribLocationsMask,
@@ -804,9 +806,9 @@ vk::Error PipelineCache::getPipeline(VkDevice device,
     // This "if" is left here for the benefit of VulkanPipelineCachePerfTest.
     if (device != VK_NULL_HANDLE)
     {
-        ANGLE_TRY(desc.initializePipeline(device, compatibleRenderPass, pipelineLayout,
-                                          activeAttribLocationsMask, vertexModule, fragmentModule,
-                                          &newPipeline));
+        ANGLE_TRY(desc.initializePipeline(device, pipelineCacheVk, compatibleRenderPass,
+                                          pipelineLayout, activeAttribLocationsMask, vertexModule,
+                                          fragmentModule, &newPipeline));
     }
 
     // The Serial will be updated outside of this query.
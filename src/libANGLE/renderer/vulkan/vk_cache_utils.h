@@ -258,6 +258,7 @@ class PipelineDesc final
     void initDefaults();
 
     Error initializePipeline(VkDevice device,
+                             const PipelineCache &pipelineCacheVk,
                              const RenderPass &compatibleRenderPass,
                              const PipelineLayout &pipelineLayout,
                              const gl::AttributesMask &activeAttribLocationsMask,
@@ -390,6 +391,7 @@ class PipelineCache final : angle::NonCopyable
 
     void populate(const vk::PipelineDesc &desc, vk::Pipeline &&pipeline);
     vk::Error getPipeline(VkDevice device,
+                          const vk::PipelineCache &pipelineCacheVk,
                           const vk::RenderPass &compatibleRenderPass,
                           const vk::PipelineLayout &pipelineLayout,
                           const gl::AttributesMask &activeAttribLocationsMask,
@@ -147,35 +147,17 @@ bool HasValidationLayers(const std::vector<VkLayerProperties> &layerProps)
     return true;
 }
 
-vk::Error FindAndAllocateCompatibleMemory(VkDevice device,
-                                          const vk::MemoryProperties &memoryProperties,
-                                          VkMemoryPropertyFlags memoryPropertyFlags,
-                                          const VkMemoryRequirements &memoryRequirements,
-                                          vk::DeviceMemory *deviceMemoryOut)
-{
-    uint32_t memoryTypeIndex = 0;
-    ANGLE_TRY(memoryProperties.findCompatibleMemoryIndex(memoryRequirements, memoryPropertyFlags,
-                                                         &memoryTypeIndex));
-
-    VkMemoryAllocateInfo allocInfo;
-    allocInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.pNext           = nullptr;
-    allocInfo.memoryTypeIndex = memoryTypeIndex;
-    allocInfo.allocationSize  = memoryRequirements.size;
-
-    ANGLE_TRY(deviceMemoryOut->allocate(device, allocInfo));
-    return vk::NoError();
-}
-
 template <typename T>
 vk::Error AllocateBufferOrImageMemory(ContextVk *contextVk,
                                       VkMemoryPropertyFlags memoryPropertyFlags,
+                                      vk::MemoryTiling tiling,
                                       T *bufferOrImage,
-                                      vk::DeviceMemory *deviceMemoryOut,
+                                      vk::MemoryAllocation *deviceMemoryOut,
                                       size_t *requiredSizeOut)
 {
     VkDevice device                              = contextVk->getDevice();
-    const vk::MemoryProperties &memoryProperties = contextVk->getRenderer()->getMemoryProperties();
+    RendererVk *renderer                         = contextVk->getRenderer();
+    const vk::MemoryProperties &memoryProperties = renderer->getMemoryProperties();
 
     // Call driver to determine memory requirements.
     VkMemoryRequirements memoryRequirements;
@@ -184,8 +166,10 @@ vk::Error AllocateBufferOrImageMemory(ContextVk *contextVk,
     // The requirements size is not always equal to the specified API size.
     *requiredSizeOut = static_cast<size_t>(memoryRequirements.size);
 
-    ANGLE_TRY(FindAndAllocateCompatibleMemory(device, memoryProperties, memoryPropertyFlags,
-                                              memoryRequirements, deviceMemoryOut));
+    uint32_t memoryTypeIndex = 0;
+    ANGLE_TRY(memoryProperties.findCompatibleMemoryIndex(memoryRequirements, memoryPropertyFlags,
+                                                         &memoryTypeIndex));
+    ANGLE_TRY(deviceMemoryOut->allocate(renderer, memoryTypeIndex, tiling, memoryRequirements));
     ANGLE_TRY(bufferOrImage->bindMemory(device, *deviceMemoryOut));
 
     return vk::NoError();
@@ -376,6 +360,13 @@ Error CommandPool::init(VkDevice device, const VkCommandPoolCreateInfo &createIn
     return NoError();
 }
 
+Error CommandPool::reset(VkDevice device)
+{
+    ASSERT(valid());
+    ANGLE_VK_TRY(vkResetCommandPool(device, mHandle, 0));
+    return NoError();
+}
+
 // CommandBuffer implementation.
 CommandBuffer::CommandBuffer()
 {
@@ -388,6 +379,12 @@ VkCommandBuffer CommandBuffer::releaseHandle()
     return handle;
 }
 
+void CommandBuffer::setHandle(VkCommandBuffer handle)
+{
+    ASSERT(!valid());
+    mHandle = handle;
+}
+
 Error CommandBuffer::init(VkDevice device, const VkCommandBufferAllocateInfo &createInfo)
 {
     ASSERT(!valid());
@@ -446,14 +443,27 @@ void CommandBuffer::destroy(VkDevice device, const vk::CommandPool &commandPool)
     }
 }
 
-void CommandBuffer::copyBuffer(const vk::Buffer &srcBuffer,
+void CommandBuffer::copyBuffer(VkBuffer srcBuffer,
                                const vk::Buffer &destBuffer,
                                uint32_t regionCount,
                                const VkBufferCopy *regions)
 {
     ASSERT(valid());
-    ASSERT(srcBuffer.valid() && destBuffer.valid());
-    vkCmdCopyBuffer(mHandle, srcBuffer.getHandle(), destBuffer.getHandle(), regionCount, regions);
+    ASSERT(srcBuffer != VK_NULL_HANDLE && destBuffer.valid());
+    vkCmdCopyBuffer(mHandle, srcBuffer, destBuffer.getHandle(), regionCount, regions);
+}
+
+void CommandBuffer::copyBufferToImage(VkBuffer srcBuffer,
+                                      const vk::Image &dstImage,
+                                      uint32_t regionCount,
+                                      const VkBufferImageCopy *regions)
+{
+    ASSERT(valid() && dstImage.valid());
+    ASSERT(srcBuffer != VK_NULL_HANDLE);
+    ASSERT(dstImage.getCurrentLayout() == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL ||
+           dstImage.getCurrentLayout() == VK_IMAGE_LAYOUT_GENERAL);
+    vkCmdCopyBufferToImage(mHandle, srcBuffer, dstImage.getHandle(), dstImage.getCurrentLayout(),
+                           regionCount, regions);
 }
 
 void CommandBuffer::clearSingleColorImage(const vk::Image &image, const VkClearColorValue &color)
@@ -589,6 +599,95 @@ void CommandBuffer::executeCommands(uint32_t commandBufferCount,
     vkCmdExecuteCommands(mHandle, commandBufferCount, commandBuffers[0].ptr());
 }
 
+// CommandBufferPool implementation.
+CommandBufferPool::CommandBufferPool() : mInUseCounts{{0, 0}}
+{
+}
+
+CommandBufferPool::~CommandBufferPool()
+{
+}
+
+CommandBufferPool::CommandBufferPool(CommandBufferPool &&other)
+    : mCommandPool(std::move(other.mCommandPool)),
+      mCommandBuffers(std::move(other.mCommandBuffers)),
+      mInUseCounts(other.mInUseCounts)
+{
+    other.mInUseCounts.fill(0);
+}
+
+CommandBufferPool &CommandBufferPool::operator=(CommandBufferPool &&other)
+{
+    std::swap(mCommandPool, other.mCommandPool);
+    std::swap(mCommandBuffers, other.mCommandBuffers);
+    std::swap(mInUseCounts, other.mInUseCounts);
+    return *this;
+}
+
+Error CommandBufferPool::init(VkDevice device, uint32_t queueFamilyIndex)
+{
+    // The command buffers are recorded once per reset of the pool.
+    VkCommandPoolCreateInfo createInfo;
+    createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    createInfo.pNext            = nullptr;
+    createInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    createInfo.queueFamilyIndex = queueFamilyIndex;
+
+    ANGLE_TRY(mCommandPool.init(device, createInfo));
+    return NoError();
+}
+
+void CommandBufferPool::destroy(VkDevice device)
+{
+    // Destroying the pool frees its command buffers.
+    mCommandPool.destroy(device);
+    for (std::vector<VkCommandBuffer> &commandBuffers : mCommandBuffers)
+    {
+        commandBuffers.clear();
+    }
+    mInUseCounts.fill(0);
+}
+
+bool CommandBufferPool::valid() const
+{
+    return mCommandPool.valid();
+}
+
+Error CommandBufferPool::reset(VkDevice device)
+{
+    ANGLE_TRY(mCommandPool.reset(device));
+    mInUseCounts.fill(0);
+    return NoError();
+}
+
+Error CommandBufferPool::allocate(VkDevice device,
+                                  VkCommandBufferLevel level,
+                                  CommandBuffer *commandBufferOut)
+{
+    ASSERT(valid() && !commandBufferOut->valid());
+    ASSERT(level == VK_COMMAND_BUFFER_LEVEL_PRIMARY || level == VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+
+    std::vector<VkCommandBuffer> &commandBuffers = mCommandBuffers[level];
+    size_t &inUseCount                           = mInUseCounts[level];
+
+    if (inUseCount == commandBuffers.size())
+    {
+        VkCommandBufferAllocateInfo allocateInfo;
+        allocateInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocateInfo.pNext              = nullptr;
+        allocateInfo.commandPool        = mCommandPool.getHandle();
+        allocateInfo.level              = level;
+        allocateInfo.commandBufferCount = 1;
+
+        VkCommandBuffer handle = VK_NULL_HANDLE;
+        ANGLE_VK_TRY(vkAllocateCommandBuffers(device, &allocateInfo, &handle));
+        commandBuffers.push_back(handle);
+    }
+
+    commandBufferOut->setHandle(commandBuffers[inUseCount++]);
+    return NoError();
+}
+
 // Image implementation.
 Image::Image() : mCurrentLayout(VK_IMAGE_LAYOUT_UNDEFINED)
 {
@@ -692,10 +791,11 @@ void Image::getMemoryRequirements(VkDevice device, VkMemoryRequirements *require
     vkGetImageMemoryRequirements(device, mHandle, requirementsOut);
 }
 
-Error Image::bindMemory(VkDevice device, const vk::DeviceMemory &deviceMemory)
+Error Image::bindMemory(VkDevice device, const MemoryAllocation &allocation)
 {
-    ASSERT(valid() && deviceMemory.valid());
-    ANGLE_VK_TRY(vkBindImageMemory(device, mHandle, deviceMemory.getHandle(), 0));
+    ASSERT(valid() && allocation.valid());
+    ANGLE_VK_TRY(
+        vkBindImageMemory(device, mHandle, allocation.getMemory(), allocation.getOffset()));
     return NoError();
 }
 
@@ -773,43 +873,59 @@ void Framebuffer::setHandle(VkFramebuffer handle)
     mHandle = handle;
 }
 
-// DeviceMemory implementation.
-DeviceMemory::DeviceMemory()
+// MemoryAllocation implementation.
+MemoryAllocation::MemoryAllocation()
 {
 }
 
-void DeviceMemory::destroy(VkDevice device)
+void MemoryAllocation::destroy(VkDevice device)
 {
     if (valid())
     {
-        vkFreeMemory(device, mHandle, nullptr);
-        mHandle = VK_NULL_HANDLE;
+        MemoryAllocator::Free(mHandle);
+        mHandle = nullptr;
     }
 }
 
-Error DeviceMemory::allocate(VkDevice device, const VkMemoryAllocateInfo &allocInfo)
+Error MemoryAllocation::allocate(RendererVk *renderer,
+                                 uint32_t memoryTypeIndex,
+                                 MemoryTiling tiling,
+                                 const VkMemoryRequirements &memoryRequirements)
 {
     ASSERT(!valid());
-    ANGLE_VK_TRY(vkAllocateMemory(device, &allocInfo, nullptr, &mHandle));
+    ANGLE_VK_TRY(renderer->getMemoryAllocator()->allocate(
+        memoryTypeIndex, tiling, memoryRequirements.size, memoryRequirements.alignment, &mHandle));
     return NoError();
 }
 
-Error DeviceMemory::map(VkDevice device,
-                        VkDeviceSize offset,
-                        VkDeviceSize size,
-                        VkMemoryMapFlags flags,
-                        uint8_t **mapPointer)
+Error MemoryAllocation::map(VkDevice device,
+                            VkDeviceSize offset,
+                            VkDeviceSize size,
+                            VkMemoryMapFlags flags,
+                            uint8_t **mapPointer)
 {
     ASSERT(valid());
-    ANGLE_VK_TRY(
-        vkMapMemory(device, mHandle, offset, size, flags, reinterpret_cast<void **>(mapPointer)));
+    ASSERT(size == VK_WHOLE_SIZE || offset + size <= mHandle->size);
+    ANGLE_VK_CHECK(mHandle->mappedMemory != nullptr, VK_ERROR_MEMORY_MAP_FAILED);
+    *mapPointer = mHandle->mappedMemory + offset;
     return NoError();
 }
 
-void DeviceMemory::unmap(VkDevice device)
+void MemoryAllocation::unmap(VkDevice device)
 {
     ASSERT(valid());
-    vkUnmapMemory(device, mHandle);
+}
+
+VkDeviceMemory MemoryAllocation::getMemory() const
+{
+    ASSERT(valid());
+    return mHandle->memory;
+}
+
+VkDeviceSize MemoryAllocation::getOffset() const
+{
+    ASSERT(valid());
+    return mHandle->offset;
 }
 
 // RenderPass implementation.
@@ -894,7 +1010,8 @@ Error StagingImage::init(ContextVk *contextVk,
     // 1) not having (enough) coherent memory and 2) coherent memory being slower
     VkMemoryPropertyFlags memoryPropertyFlags =
         (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-    ANGLE_TRY(AllocateImageMemory(contextVk, memoryPropertyFlags, &mImage, &mDeviceMemory, &mSize));
+    ANGLE_TRY(AllocateImageMemory(contextVk, memoryPropertyFlags, createInfo.tiling, &mImage,
+                                  &mDeviceMemory, &mSize));
 
     return NoError();
 }
@@ -926,10 +1043,11 @@ Error Buffer::init(VkDevice device, const VkBufferCreateInfo &createInfo)
     return NoError();
 }
 
-Error Buffer::bindMemory(VkDevice device, const DeviceMemory &deviceMemory)
+Error Buffer::bindMemory(VkDevice device, const MemoryAllocation &allocation)
 {
-    ASSERT(valid() && deviceMemory.valid());
-    ANGLE_VK_TRY(vkBindBufferMemory(device, mHandle, deviceMemory.getHandle(), 0));
+    ASSERT(valid() && allocation.valid());
+    ANGLE_VK_TRY(
+        vkBindBufferMemory(device, mHandle, allocation.getMemory(), allocation.getOffset()));
     return NoError();
 }
 
@@ -974,11 +1092,41 @@ void Pipeline::destroy(VkDevice device)
     }
 }
 
-Error Pipeline::initGraphics(VkDevice device, const VkGraphicsPipelineCreateInfo &createInfo)
+Error Pipeline::initGraphics(VkDevice device,
+                             const VkGraphicsPipelineCreateInfo &createInfo,
+                             const PipelineCache &pipelineCacheVk)
 {
     ASSERT(!valid());
-    ANGLE_VK_TRY(
-        vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &createInfo, nullptr, &mHandle));
+    ANGLE_VK_TRY(vkCreateGraphicsPipelines(device, pipelineCacheVk.getHandle(), 1, &createInfo,
+                                           nullptr, &mHandle));
+    return NoError();
+}
+
+// PipelineCache implementation.
+PipelineCache::PipelineCache()
+{
+}
+
+void PipelineCache::destroy(VkDevice device)
+{
+    if (valid())
+    {
+        vkDestroyPipelineCache(device, mHandle, nullptr);
+        mHandle = VK_NULL_HANDLE;
+    }
+}
+
+Error PipelineCache::init(VkDevice device, const VkPipelineCacheCreateInfo &createInfo)
+{
+    ASSERT(!valid());
+    ANGLE_VK_TRY(vkCreatePipelineCache(device, &createInfo, nullptr, &mHandle));
+    return NoError();
+}
+
+Error PipelineCache::getCacheData(VkDevice device, size_t *cacheSize, void *cacheData) const
+{
+    ASSERT(valid());
+    ANGLE_VK_TRY(vkGetPipelineCacheData(device, mHandle, cacheSize, cacheData));
     return NoError();
 }
 
@@ -1054,6 +1202,15 @@ Error DescriptorPool::allocateDescriptorSets(VkDevice device,
     return NoError();
 }
 
+void DescriptorPool::freeDescriptorSets(VkDevice device,
+                                        uint32_t descriptorSetCount,
+                                        const VkDescriptorSet *descriptorSets)
+{
+    ASSERT(valid());
+    // vkFreeDescriptorSets always succeeds.
+    (void)vkFreeDescriptorSets(device, mHandle, descriptorSetCount, descriptorSets);
+}
+
 // Sampler implementation.
 Sampler::Sampler()
 {
@@ -1139,6 +1296,19 @@ Error MemoryProperties::findCompatibleMemoryIndex(const VkMemoryRequirements &me
     return vk::Error(VK_ERROR_INCOMPATIBLE_DRIVER);
 }
 
+VkMemoryPropertyFlags MemoryProperties::getMemoryTypePropertyFlags(uint32_t memoryTypeIndex) const
+{
+    ASSERT(memoryTypeIndex < mMemoryProperties.memoryTypeCount);
+    return mMemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags;
+}
+
+VkDeviceSize MemoryProperties::getMemoryTypeHeapSize(uint32_t memoryTypeIndex) const
+{
+    ASSERT(memoryTypeIndex < mMemoryProperties.memoryTypeCount);
+    uint32_t heapIndex = mMemoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+    return mMemoryProperties.memoryHeaps[heapIndex].size;
+}
+
 // StagingBuffer implementation.
 StagingBuffer::StagingBuffer() : mSize(0)
 {
@@ -1181,21 +1351,24 @@ void StagingBuffer::dumpResources(Serial serial, std::vector<vk::GarbageObject>
 Error AllocateBufferMemory(ContextVk *contextVk,
                            VkMemoryPropertyFlags memoryPropertyFlags,
                            Buffer *buffer,
-                           DeviceMemory *deviceMemoryOut,
+                           MemoryAllocation *deviceMemoryOut,
                            size_t *requiredSizeOut)
 {
-    return AllocateBufferOrImageMemory(contextVk, memoryPropertyFlags, buffer, deviceMemoryOut,
-                                       requiredSizeOut);
+    return AllocateBufferOrImageMemory(contextVk, memoryPropertyFlags, MemoryTiling::Linear, buffer,
+                                       deviceMemoryOut, requiredSizeOut);
 }
 
 Error AllocateImageMemory(ContextVk *contextVk,
                           VkMemoryPropertyFlags memoryPropertyFlags,
+                          VkImageTiling tiling,
                           Image *image,
-                          DeviceMemory *deviceMemoryOut,
+                          MemoryAllocation *deviceMemoryOut,
                           size_t *requiredSizeOut)
 {
-    return AllocateBufferOrImageMemory(contextVk, memoryPropertyFlags, image, deviceMemoryOut,
-                                       requiredSizeOut);
+    MemoryTiling memoryTiling =
+        tiling == VK_IMAGE_TILING_LINEAR ? MemoryTiling::Linear : MemoryTiling::Optimal;
+    return AllocateBufferOrImageMemory(contextVk, memoryPropertyFlags, memoryTiling, image,
+                                       deviceMemoryOut, requiredSizeOut);
 }
 
 // GarbageObject implementation.
@@ -1233,8 +1406,8 @@ void GarbageObject::destroy(VkDevice device)
         case HandleType::Fence:
             vkDestroyFence(device, reinterpret_cast<VkFence>(mHandle), nullptr);
             break;
-        case HandleType::DeviceMemory:
-            vkFreeMemory(device, reinterpret_cast<VkDeviceMemory>(mHandle), nullptr);
+        case HandleType::MemoryAllocation:
+            MemoryAllocator::Free(reinterpret_cast<SubAllocation *>(mHandle));
             break;
         case HandleType::Buffer:
             vkDestroyBuffer(device, reinterpret_cast<VkBuffer>(mHandle), nullptr);
@@ -1257,6 +1430,9 @@ void GarbageObject::destroy(VkDevice device)
         case HandleType::Pipeline:
             vkDestroyPipeline(device, reinterpret_cast<VkPipeline>(mHandle), nullptr);
             break;
+        case HandleType::PipelineCache:
+            vkDestroyPipelineCache(device, reinterpret_cast<VkPipelineCache>(mHandle), nullptr);
+            break;
         case HandleType::DescriptorSetLayout:
             vkDestroyDescriptorSetLayout(device, reinterpret_cast<VkDescriptorSetLayout>(mHandle),
                                          nullptr);
@@ -1411,7 +1587,9 @@ void ResourceVk::onWriteResource(vk::CommandBufferNode *writeOperation, Serial s
         mCurrentReadOperations.clear();
     }
 
-    if (mCurrentWriteOperation)
+    // A node that batches several writes, like the upload node of the context, can write the
+    // resource again.
+    if (mCurrentWriteOperation && mCurrentWriteOperation != writeOperation)
     {
         vk::CommandBufferNode::SetHappensBeforeDependency(mCurrentWriteOperation, writeOperation);
     }
@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_VK_UTILS_H_
 #define LIBANGLE_RENDERER_VULKAN_VK_UTILS_H_
 
+#include <array>
 #include <limits>
 
 #include <vulkan/vulkan.h>
@@ -18,6 +19,7 @@
 #include "common/debug.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/renderer/renderer_utils.h"
+#include "libANGLE/renderer/vulkan/MemoryAllocator.h"
 
 #define ANGLE_GL_OBJECTS_X(PROC) \
     PROC(Buffer)                 \
@@ -171,7 +173,7 @@ inline Error NoError()
     FUNC(Semaphore)                \
     FUNC(CommandBuffer)            \
     FUNC(Fence)                    \
-    FUNC(DeviceMemory)             \
+    FUNC(MemoryAllocation)         \
     FUNC(Buffer)                   \
     FUNC(Image)                    \
     FUNC(ImageView)                \
@@ -179,6 +181,7 @@ inline Error NoError()
     FUNC(PipelineLayout)           \
     FUNC(RenderPass)               \
     FUNC(Pipeline)                 \
+    FUNC(PipelineCache)            \
     FUNC(DescriptorSetLayout)      \
     FUNC(Sampler)                  \
     FUNC(DescriptorPool)           \
@@ -290,6 +293,10 @@ class MemoryProperties final : angle::NonCopyable
                                     VkMemoryPropertyFlags memoryPropertyFlags,
                                     uint32_t *indexOut) const;
 
+    uint32_t getMemoryTypeCount() const { return mMemoryProperties.memoryTypeCount; }
+    VkMemoryPropertyFlags getMemoryTypePropertyFlags(uint32_t memoryTypeIndex) const;
+    VkDeviceSize getMemoryTypeHeapSize(uint32_t memoryTypeIndex) const;
+
   private:
     VkPhysicalDeviceMemoryProperties mMemoryProperties;
 };
@@ -302,6 +309,9 @@ class CommandPool final : public WrappedObject<CommandPool, VkCommandPool>
     void destroy(VkDevice device);
 
     Error init(VkDevice device, const VkCommandPoolCreateInfo &createInfo);
+
+    // Returns all of the command buffers allocated from the pool to the initial state.
+    Error reset(VkDevice device);
 };
 
 // Helper class that wraps a Vulkan command buffer.
@@ -312,6 +322,10 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
 
     VkCommandBuffer releaseHandle();
     void destroy(VkDevice device, const vk::CommandPool &commandPool);
+
+    // Use this method for command buffers that are owned by a CommandBufferPool.
+    void setHandle(VkCommandBuffer handle);
+
     Error init(VkDevice device, const VkCommandBufferAllocateInfo &createInfo);
     using WrappedObject::operator=;
 
@@ -332,11 +346,17 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
 
     void clearSingleColorImage(const vk::Image &image, const VkClearColorValue &color);
 
-    void copyBuffer(const vk::Buffer &srcBuffer,
+    // The sources are raw handles, so that ranges of shared staging buffers can be copied.
+    void copyBuffer(VkBuffer srcBuffer,
                     const vk::Buffer &destBuffer,
                     uint32_t regionCount,
                     const VkBufferCopy *regions);
 
+    void copyBufferToImage(VkBuffer srcBuffer,
+                           const vk::Image &dstImage,
+                           uint32_t regionCount,
+                           const VkBufferImageCopy *regions);
+
     void copySingleImage(const vk::Image &srcImage,
                          const vk::Image &destImage,
                          const gl::Box &copyRegion,
@@ -378,6 +398,36 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
     void executeCommands(uint32_t commandBufferCount, const vk::CommandBuffer *commandBuffers);
 };
 
+// A command pool that keeps the command buffers allocated from it. Once the commands recorded
+// from the pool have completed, the pool is reset and its command buffers are handed out again,
+// instead of being freed and reallocated.
+class CommandBufferPool final : angle::NonCopyable
+{
+  public:
+    CommandBufferPool();
+    ~CommandBufferPool();
+    CommandBufferPool(CommandBufferPool &&other);
+    CommandBufferPool &operator=(CommandBufferPool &&other);
+
+    Error init(VkDevice device, uint32_t queueFamilyIndex);
+    void destroy(VkDevice device);
+    bool valid() const;
+
+    // Only call this once the queue serial of all of the commands of the pool has completed.
+    Error reset(VkDevice device);
+
+    // The command buffer stays owned by the pool, so release the handle instead of freeing it.
+    Error allocate(VkDevice device, VkCommandBufferLevel level, CommandBuffer *commandBufferOut);
+
+  private:
+    CommandPool mCommandPool;
+
+    // Indexed by VkCommandBufferLevel. The first mInUseCounts[level] command buffers of each level
+    // have been handed out since the last reset.
+    std::array<std::vector<VkCommandBuffer>, 2> mCommandBuffers;
+    std::array<size_t, 2> mInUseCounts;
+};
+
 class Image final : public WrappedObject<Image, VkImage>
 {
   public:
@@ -405,7 +455,7 @@ class Image final : public WrappedObject<Image, VkImage>
                                 CommandBuffer *commandBuffer);
 
     void getMemoryRequirements(VkDevice device, VkMemoryRequirements *requirementsOut) const;
-    Error bindMemory(VkDevice device, const vk::DeviceMemory &deviceMemory);
+    Error bindMemory(VkDevice device, const MemoryAllocation &allocation);
 
     VkImageLayout getCurrentLayout() const { return mCurrentLayout; }
     void updateLayout(VkImageLayout layout) { mCurrentLayout = layout; }
@@ -444,19 +494,27 @@ class Framebuffer final : public WrappedObject<Framebuffer, VkFramebuffer>
     Error init(VkDevice device, const VkFramebufferCreateInfo &createInfo);
 };
 
-class DeviceMemory final : public WrappedObject<DeviceMemory, VkDeviceMemory>
+// Device memory sub-allocated by the MemoryAllocator of the renderer. Host visible memory stays
+// mapped for as long as it is allocated, so map() only returns a pointer and unmap() does nothing.
+class MemoryAllocation final : public WrappedObject<MemoryAllocation, SubAllocation *>
 {
   public:
-    DeviceMemory();
+    MemoryAllocation();
     void destroy(VkDevice device);
 
-    Error allocate(VkDevice device, const VkMemoryAllocateInfo &allocInfo);
+    Error allocate(RendererVk *renderer,
+                   uint32_t memoryTypeIndex,
+                   MemoryTiling tiling,
+                   const VkMemoryRequirements &memoryRequirements);
     Error map(VkDevice device,
               VkDeviceSize offset,
               VkDeviceSize size,
               VkMemoryMapFlags flags,
               uint8_t **mapPointer);
     void unmap(VkDevice device);
+
+    VkDeviceMemory getMemory() const;
+    VkDeviceSize getOffset() const;
 };
 
 class RenderPass final : public WrappedObject<RenderPass, VkRenderPass>
@@ -482,7 +540,7 @@ class Buffer final : public WrappedObject<Buffer, VkBuffer>
     void destroy(VkDevice device);
 
     Error init(VkDevice device, const VkBufferCreateInfo &createInfo);
-    Error bindMemory(VkDevice device, const DeviceMemory &deviceMemory);
+    Error bindMemory(VkDevice device, const MemoryAllocation &allocation);
     void getMemoryRequirements(VkDevice device, VkMemoryRequirements *memoryRequirementsOut);
 };
 
@@ -501,7 +559,21 @@ class Pipeline final : public WrappedObject<Pipeline, VkPipeline>
     Pipeline();
     void destroy(VkDevice device);
 
-    Error initGraphics(VkDevice device, const VkGraphicsPipelineCreateInfo &createInfo);
+    Error initGraphics(VkDevice device,
+                       const VkGraphicsPipelineCreateInfo &createInfo,
+                       const PipelineCache &pipelineCacheVk);
+};
+
+class PipelineCache final : public WrappedObject<PipelineCache, VkPipelineCache>
+{
+  public:
+    PipelineCache();
+    void destroy(VkDevice device);
+
+    Error init(VkDevice device, const VkPipelineCacheCreateInfo &createInfo);
+
+    // Gets the size of the data if cacheData is null. See vkGetPipelineCacheData.
+    Error getCacheData(VkDevice device, size_t *cacheSize, void *cacheData) const;
 };
 
 class PipelineLayout final : public WrappedObject<PipelineLayout, VkPipelineLayout>
@@ -533,6 +605,9 @@ class DescriptorPool final : public WrappedObject<DescriptorPool, VkDescriptorPo
     Error allocateDescriptorSets(VkDevice device,
                                  const VkDescriptorSetAllocateInfo &allocInfo,
                                  VkDescriptorSet *descriptorSetsOut);
+    void freeDescriptorSets(VkDevice device,
+                            uint32_t descriptorSetCount,
+                            const VkDescriptorSet *descriptorSets);
 };
 
 class Sampler final : public WrappedObject<Sampler, VkSampler>
@@ -570,15 +645,15 @@ class StagingImage final : angle::NonCopyable
 
     Image &getImage() { return mImage; }
     const Image &getImage() const { return mImage; }
-    DeviceMemory &getDeviceMemory() { return mDeviceMemory; }
-    const DeviceMemory &getDeviceMemory() const { return mDeviceMemory; }
+    MemoryAllocation &getDeviceMemory() { return mDeviceMemory; }
+    const MemoryAllocation &getDeviceMemory() const { return mDeviceMemory; }
     VkDeviceSize getSize() const { return mSize; }
 
     void dumpResources(Serial serial, std::vector<vk::GarbageObject> *garbageQueue);
 
   private:
     Image mImage;
-    DeviceMemory mDeviceMemory;
+    MemoryAllocation mDeviceMemory;
     size_t mSize;
 };
 
@@ -593,15 +668,15 @@ class StagingBuffer final : angle::NonCopyable
 
     Buffer &getBuffer() { return mBuffer; }
     const Buffer &getBuffer() const { return mBuffer; }
-    DeviceMemory &getDeviceMemory() { return mDeviceMemory; }
-    const DeviceMemory &getDeviceMemory() const { return mDeviceMemory; }
+    MemoryAllocation &getDeviceMemory() { return mDeviceMemory; }
+    const MemoryAllocation &getDeviceMemory() const { return mDeviceMemory; }
     size_t getSize() const { return mSize; }
 
     void dumpResources(Serial serial, std::vector<vk::GarbageObject> *garbageQueue);
 
   private:
     Buffer mBuffer;
-    DeviceMemory mDeviceMemory;
+    MemoryAllocation mDeviceMemory;
     size_t mSize;
 };
 
@@ -645,19 +720,21 @@ class ObjectAndSerial final : angle::NonCopyable
 Error AllocateBufferMemory(ContextVk *contextVk,
                            VkMemoryPropertyFlags memoryPropertyFlags,
                            Buffer *buffer,
-                           DeviceMemory *deviceMemoryOut,
+                           MemoryAllocation *deviceMemoryOut,
                            size_t *requiredSizeOut);
 
 struct BufferAndMemory final : private angle::NonCopyable
 {
     vk::Buffer buffer;
-    vk::DeviceMemory memory;
+    vk::MemoryAllocation memory;
 };
 
+// The tiling is the one the image was created with.
 Error AllocateImageMemory(ContextVk *contextVk,
                           VkMemoryPropertyFlags memoryPropertyFlags,
+                          VkImageTiling tiling,
                           Image *image,
-                          DeviceMemory *deviceMemoryOut,
+                          MemoryAllocation *deviceMemoryOut,
                           size_t *requiredSizeOut);
 
 }  // namespace vk
@@ -400,6 +400,34 @@ Error ValidateGetPlatformDisplayCommon(EGLenum platform,
                     }
                     break;
 
+                case EGL_PLATFORM_ANGLE_WORKER_THREAD_COUNT_ANGLE:
+                    if (!clientExtensions.platformANGLE)
+                    {
+                        return EglBadAttribute() << "EGL_ANGLE_platform_angle extension not active";
+                    }
+                    if (value < 0 && value != EGL_DONT_CARE)
+                    {
+                        return EglBadAttribute() << "EGL_PLATFORM_ANGLE_WORKER_THREAD_COUNT_ANGLE "
+                                                    "must be non-negative or EGL_DONT_CARE.";
+                    }
+                    break;
+
+                case EGL_PROGRAM_CACHE_DIRECTORY_ANGLE:
+                    if (value == 0)
+                    {
+                        return EglBadAttribute()
+                               << "EGL_PROGRAM_CACHE_DIRECTORY_ANGLE must not be null.";
+                    }
+                    break;
+
+                case EGL_PROGRAM_CACHE_DISK_SIZE_ANGLE:
+                    if (value < 0)
+                    {
+                        return EglBadAttribute()
+                               << "EGL_PROGRAM_CACHE_DISK_SIZE_ANGLE must be non-negative.";
+                    }
+                    break;
+
                 default:
                     break;
             }
@@ -2317,6 +2345,14 @@ Error ValidateGetPlatformDisplayEXT(EGLenum platform,
                                     const EGLint *attrib_list)
 {
     const auto &attribMap = AttributeMap::CreateFromIntArray(attrib_list);
+
+    // A pointer doesn't fit in an EGLint.
+    if (attribMap.contains(EGL_PROGRAM_CACHE_DIRECTORY_ANGLE))
+    {
+        return EglBadAttribute()
+               << "EGL_PROGRAM_CACHE_DIRECTORY_ANGLE requires eglGetPlatformDisplay.";
+    }
+
     return ValidateGetPlatformDisplayCommon(platform, native_display, attribMap);
 }
 
@@ -84,6 +84,7 @@ bool ValidateWebGLVertexAttribPointer(ValidationContext *context,
 // Errors INVALID_OPERATION if valid shader is given and returns NULL
 // Errors INVALID_VALUE otherwise and returns NULL
 Program *GetValidProgram(ValidationContext *context, GLuint id);
+Program *GetValidProgramNoResolveLink(ValidationContext *context, GLuint id);
 
 // Returns valid shader if id is a valid shader name
 // Errors INVALID_OPERATION if valid program is given and returns NULL
@@ -584,6 +584,12 @@ bool ValidateES2CopyTexImageParameters(ValidationContext *context,
             case GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE:
             case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
             case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
+            case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+            case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+            case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
                 ANGLE_VALIDATION_ERR(context, InvalidOperation(), InvalidFormat);
                 return false;
             case GL_DEPTH_COMPONENT:
@@ -720,6 +726,12 @@ bool ValidateES2CopyTexImageParameters(ValidationContext *context,
             case GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE:
             case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
             case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
+            case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+            case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+            case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
                 if (context->getExtensions().lossyETCDecode)
                 {
                     context->handleError(InvalidOperation()
@@ -1236,6 +1248,12 @@ bool ValidateES2TexImageParameters(Context *context,
             case GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE:
             case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
             case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
+            case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+            case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+            case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
                 if (!context->getExtensions().lossyETCDecode)
                 {
                     ANGLE_VALIDATION_ERR(context, InvalidEnum(), InvalidInternalFormat);
@@ -1481,6 +1499,12 @@ bool ValidateES2TexImageParameters(Context *context,
             case GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE:
             case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
             case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
+            case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+            case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+            case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
                 if (context->getExtensions().lossyETCDecode)
                 {
                     context->handleError(InvalidOperation()
@@ -1723,6 +1747,12 @@ bool ValidateES2TexStorageParameters(Context *context,
         case GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE:
         case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
         case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
+        case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+        case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+        case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+        case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+        case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
             if (!context->getExtensions().lossyETCDecode)
             {
                 context->handleError(InvalidEnum()
@@ -4310,6 +4340,17 @@ bool ValidateRequestExtensionANGLE(Context *context, const GLchar *name)
     return true;
 }
 
+bool ValidateMaxShaderCompilerThreadsKHR(Context *context, GLuint count)
+{
+    if (!context->getExtensions().parallelShaderCompile)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ExtensionNotEnabled);
+        return false;
+    }
+
+    return true;
+}
+
 bool ValidateActiveTexture(ValidationContext *context, GLenum texture)
 {
     if (texture < GL_TEXTURE0 ||
@@ -366,6 +366,7 @@ bool ValidateBufferSubData(ValidationContext *context,
                            const void *data);
 
 bool ValidateRequestExtensionANGLE(Context *context, const GLchar *name);
+bool ValidateMaxShaderCompilerThreadsKHR(Context *context, GLuint count);
 
 bool ValidateActiveTexture(ValidationContext *context, GLenum texture);
 bool ValidateAttachShader(ValidationContext *context, GLuint program, GLuint shader);
@@ -146,6 +146,9 @@ ANGLE_EXPORT void GL_APIENTRY CompressedCopyTextureCHROMIUM(GLuint sourceId, GLu
 // GL_ANGLE_request_extension
 ANGLE_EXPORT void GL_APIENTRY RequestExtensionANGLE(const GLchar *name);
 
+// GL_KHR_parallel_shader_compile
+ANGLE_EXPORT void GL_APIENTRY MaxShaderCompilerThreadsKHR(GLuint count);
+
 // GL_ANGLE_robust_client_memory
 ANGLE_EXPORT void GL_APIENTRY GetBooleanvRobustANGLE(GLenum pname,
                                                      GLsizei bufSize,
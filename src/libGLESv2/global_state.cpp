@@ -17,13 +17,15 @@
 namespace gl
 {
 
+thread_local Context *gCurrentContext = nullptr;
+
 Context *GetGlobalContext()
 {
     egl::Thread *thread = egl::GetCurrentThread();
     return thread->getContext();
 }
 
-Context *GetValidGlobalContext()
+Context *GetValidGlobalContextSlow()
 {
     egl::Thread *thread = egl::GetCurrentThread();
     return thread->getValidContext();
@@ -74,6 +76,12 @@ Thread *GetCurrentThread()
     return (current ? current : AllocateCurrentThread());
 }
 
+void SetContextCurrent(Thread *thread, gl::Context *context)
+{
+    thread->setCurrent(context);
+    gl::gCurrentContext = context;
+}
+
 }  // namespace egl
 
 #ifdef ANGLE_PLATFORM_WINDOWS
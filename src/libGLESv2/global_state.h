@@ -9,12 +9,29 @@
 #ifndef LIBGLESV2_GLOBALSTATE_H_
 #define LIBGLESV2_GLOBALSTATE_H_
 
+#include "libANGLE/Context.h"
+
 namespace gl
 {
-class Context;
+
+// The context current on this thread. Mirrors the current Thread's context in a native thread
+// local, so that the entry points don't have to look up the Thread through the TLS index.
+extern thread_local Context *gCurrentContext;
 
 Context *GetGlobalContext();
-Context *GetValidGlobalContext();
+Context *GetValidGlobalContextSlow();
+
+ANGLE_INLINE Context *GetValidGlobalContext()
+{
+    Context *context = gCurrentContext;
+    if (context && !context->isContextLost())
+    {
+        return context;
+    }
+
+    // Lost contexts generate an error on the slow path.
+    return GetValidGlobalContextSlow();
+}
 
 }  // namespace gl
 
@@ -24,6 +41,10 @@ class Thread;
 
 Thread *GetCurrentThread();
 
+// Makes the context current on the thread. All changes to the current context go through here
+// to keep the cached context up to date.
+void SetContextCurrent(Thread *thread, gl::Context *context);
+
 }  // namespace egl
 
 #endif // LIBGLESV2_GLOBALSTATE_H_
@@ -443,6 +443,7 @@ ProcEntry g_procTable[] = {
     {"glMaterialxv", P(gl::Materialxv)},
     {"glMatrixIndexPointerOES", P(gl::MatrixIndexPointerOES)},
     {"glMatrixMode", P(gl::MatrixMode)},
+    {"glMaxShaderCompilerThreadsKHR", P(gl::MaxShaderCompilerThreadsKHR)},
     {"glMemoryBarrier", P(gl::MemoryBarrier)},
     {"glMemoryBarrierByRegion", P(gl::MemoryBarrierByRegion)},
     {"glMultMatrixf", P(gl::MultMatrixf)},
@@ -647,5 +648,5 @@ ProcEntry g_procTable[] = {
     {"glWaitSync", P(gl::WaitSync)},
     {"glWeightPointerOES", P(gl::WeightPointerOES)}};
 
-size_t g_numProcs = 617;
+size_t g_numProcs = 618;
 }  // namespace egl
@@ -0,0 +1,244 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ConcurrentCompile_test.cpp:
+//   Stress test for translating shaders on several threads at once, each with compilers of its
+//   own. The results must be the same as when the shaders are translated one at a time.
+//
+
+#include <thread>
+#include <vector>
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "compiler/translator/TranslationCache.h"
+#include "compiler/translator/util.h"
+#include "gtest/gtest.h"
+
+using namespace sh;
+
+namespace
+{
+
+struct ShaderSource
+{
+    GLenum type;
+    const char *source;
+};
+
+const ShaderSource kShaders[] = {
+    {GL_VERTEX_SHADER,
+     R"(attribute vec4 a_position;
+    uniform mat4 u_mvp[2];
+    varying vec2 v_texCoord;
+    void main()
+    {
+        v_texCoord = a_position.xy * 0.5 + 0.5;
+        gl_Position = u_mvp[int(a_position.w)] * vec4(a_position.xyz, 1.0);
+    })"},
+    {GL_FRAGMENT_SHADER,
+     R"(precision mediump float;
+    uniform sampler2D u_tex;
+    uniform vec4 u_weights[4];
+    varying vec2 v_texCoord;
+    float blur(vec2 offset)
+    {
+        float sum = 0.0;
+        for (int i = 0; i < 4; ++i)
+        {
+            sum += texture2D(u_tex, v_texCoord + offset * float(i)).r * u_weights[i].x;
+        }
+        return sum;
+    }
+    void main()
+    {
+        gl_FragColor = vec4(blur(vec2(0.01, 0.0)), blur(vec2(0.0, 0.01)), 0.0, 1.0);
+    })"},
+    {GL_FRAGMENT_SHADER,
+     R"(#version 300 es
+    precision highp float;
+    struct Light { vec3 position; vec3 color; };
+    uniform Lights { Light lights[4]; };
+    uniform int u_lightCount;
+    in vec3 v_position;
+    in vec3 v_normal;
+    out vec4 my_FragColor;
+    void main()
+    {
+        vec3 color = vec3(0);
+        for (int i = 0; i < u_lightCount; ++i)
+        {
+            vec3 toLight = normalize(lights[i].position - v_position);
+            color += lights[i].color * max(dot(v_normal, toLight), 0.0);
+        }
+        bvec3 nan = isnan(color);
+        my_FragColor = vec4(any(nan) ? vec3(0) : pow(color, vec3(1.0 / 2.2)), 1.0);
+    })"},
+    {GL_COMPUTE_SHADER,
+     R"(#version 310 es
+    layout(local_size_x = 8, local_size_y = 8) in;
+    layout(std140, binding = 0) buffer Histogram { uint bins[64]; };
+    layout(binding = 0, r32f) uniform highp readonly image2D u_image;
+    void main()
+    {
+        float value = imageLoad(u_image, ivec2(gl_GlobalInvocationID.xy)).r;
+        atomicAdd(bins[uint(clamp(value, 0.0, 1.0) * 63.0)], 1u);
+    })"},
+    // Translations that fail must report the same errors.
+    {GL_FRAGMENT_SHADER,
+     R"(precision mediump float;
+    void main()
+    {
+        gl_FragColor = undefinedFunction(vec4(1.0));
+    })"},
+};
+
+struct TranslationResult
+{
+    bool success;
+    std::string objectCode;
+    std::string infoLog;
+};
+
+class ConcurrentCompileTest : public testing::TestWithParam<ShShaderOutput>
+{
+  public:
+    ConcurrentCompileTest() {}
+
+  protected:
+    void SetUp() override
+    {
+        // Cached results would hide translations that aren't re-entrant.
+        SetTranslationCacheMaxSize(0);
+        InitBuiltInResources(&mResources);
+        mResources.MaxDrawBuffers = 8;
+
+        // The HLSL backend can't translate the buffers and images of the ES 3.1 compute shader.
+        for (const ShaderSource &shader : kShaders)
+        {
+            if (shader.type != GL_COMPUTE_SHADER || !IsOutputHLSL(GetParam()))
+            {
+                mShaders.push_back(shader);
+            }
+        }
+    }
+
+    void TearDown() override { SetTranslationCacheMaxSize(kDefaultTranslationCacheMaxSize); }
+
+    ShHandle constructCompiler(GLenum type)
+    {
+        return ConstructCompiler(type, SH_GLES3_1_SPEC, GetParam(), &mResources);
+    }
+
+    static TranslationResult Translate(ShHandle compiler, const char *source)
+    {
+        const char *shaderStrings[] = {source};
+        ShCompileOptions compileOptions =
+            SH_OBJECT_CODE | SH_VARIABLES | SH_EMULATE_ISNAN_FLOAT_FUNCTION;
+
+        TranslationResult result;
+        result.success    = Compile(compiler, shaderStrings, 1, compileOptions);
+        result.objectCode = GetObjectCode(compiler);
+        result.infoLog    = GetInfoLog(compiler);
+        return result;
+    }
+
+    ShBuiltInResources mResources;
+    std::vector<ShaderSource> mShaders;
+};
+
+// Test that shaders translated concurrently by many threads give the same results as when they are
+// translated by a single thread. Half of the threads construct new compilers for each translation,
+// which builds their symbol tables concurrently too.
+TEST_P(ConcurrentCompileTest, ResultsMatchSingleThreaded)
+{
+    constexpr size_t kThreadCount = 8;
+    constexpr size_t kRoundCount  = 4;
+    const size_t shaderCount      = mShaders.size();
+
+    std::vector<TranslationResult> expectedResults;
+    for (const ShaderSource &shader : mShaders)
+    {
+        ShHandle compiler = constructCompiler(shader.type);
+        ASSERT_NE(nullptr, compiler);
+        expectedResults.push_back(Translate(compiler, shader.source));
+        Destruct(compiler);
+    }
+    ASSERT_FALSE(expectedResults.back().success);
+
+    // Counts of results that differ from the expected ones, per thread.
+    std::vector<size_t> mismatchCounts(kThreadCount, 0);
+
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([this, threadIndex, shaderCount, &expectedResults,
+                              &mismatchCounts]() {
+            bool reuseCompilers = threadIndex % 2 == 0;
+            std::vector<ShHandle> compilers(shaderCount, nullptr);
+            for (size_t shaderIndex = 0; shaderIndex < shaderCount; ++shaderIndex)
+            {
+                compilers[shaderIndex] =
+                    reuseCompilers ? constructCompiler(mShaders[shaderIndex].type) : nullptr;
+            }
+
+            for (size_t round = 0; round < kRoundCount; ++round)
+            {
+                // Start at a different shader on every thread, so that different shaders are
+                // translated at the same time.
+                for (size_t step = 0; step < shaderCount; ++step)
+                {
+                    size_t shaderIndex         = (threadIndex + round + step) % shaderCount;
+                    const ShaderSource &shader = mShaders[shaderIndex];
+
+                    ShHandle compiler =
+                        reuseCompilers ? compilers[shaderIndex] : constructCompiler(shader.type);
+                    TranslationResult result = Translate(compiler, shader.source);
+                    if (!reuseCompilers)
+                    {
+                        Destruct(compiler);
+                    }
+
+                    const TranslationResult &expected = expectedResults[shaderIndex];
+                    if (result.success != expected.success ||
+                        result.objectCode != expected.objectCode ||
+                        result.infoLog != expected.infoLog)
+                    {
+                        mismatchCounts[threadIndex]++;
+                    }
+                }
+            }
+
+            for (ShHandle compiler : compilers)
+            {
+                Destruct(compiler);
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        EXPECT_EQ(0u, mismatchCounts[threadIndex]) << "on thread " << threadIndex;
+    }
+}
+
+#if defined(ANGLE_ENABLE_HLSL)
+INSTANTIATE_TEST_CASE_P(,
+                        ConcurrentCompileTest,
+                        testing::Values(SH_ESSL_OUTPUT,
+                                        SH_GLSL_450_CORE_OUTPUT,
+                                        SH_HLSL_4_1_OUTPUT));
+#else
+INSTANTIATE_TEST_CASE_P(,
+                        ConcurrentCompileTest,
+                        testing::Values(SH_ESSL_OUTPUT, SH_GLSL_450_CORE_OUTPUT));
+#endif  // defined(ANGLE_ENABLE_HLSL)
+
+}  // anonymous namespace
@@ -0,0 +1,275 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser_test.cpp:
+//   Tests that traversers fused into a single walk see the same visits as when they traverse the
+//   tree on their own, and that fused passes are timed with SH_TIME_AST_PASSES.
+//
+
+#include <sstream>
+
+#include "angle_gl.h"
+#include "compiler/translator/ASTPassManager.h"
+#include "compiler/translator/FusedTraverser.h"
+#include "compiler/translator/InfoSink.h"
+#include "compiler/translator/IntermNode.h"
+#include "compiler/translator/OutputTree.h"
+#include "compiler/translator/Symbol.h"
+#include "gtest/gtest.h"
+#include "tests/test_utils/ShaderCompileTreeTest.h"
+
+using namespace sh;
+
+namespace
+{
+
+// Records every visit together with the traversal context. Returns false from the visits that
+// are selected with the constructor arguments to exercise the skipping rules of the traversal.
+class RecordingTraverser : public TFusablePass
+{
+  public:
+    RecordingTraverser(bool preVisit,
+                       bool inVisit,
+                       bool postVisit,
+                       bool skipBinaryRight,
+                       bool skipFunctionBodies,
+                       bool stopBlockInVisits)
+        : TFusablePass(preVisit, inVisit, postVisit),
+          mSkipBinaryRight(skipBinaryRight),
+          mSkipFunctionBodies(skipFunctionBodies),
+          mStopBlockInVisits(stopBlockInVisits)
+    {
+    }
+
+    void visitSymbol(TIntermSymbol *node) override { record(PreVisit, "symbol", node); }
+    void visitConstantUnion(TIntermConstantUnion *node) override
+    {
+        record(PreVisit, "constant", node);
+    }
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override
+    {
+        return record(visit, "swizzle", node);
+    }
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        record(visit, "binary", node);
+        return !(mSkipBinaryRight && visit == InVisit);
+    }
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        return record(visit, "unary", node);
+    }
+    bool visitTernary(Visit visit, TIntermTernary *node) override
+    {
+        return record(visit, "ternary", node);
+    }
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override
+    {
+        return record(visit, "ifelse", node);
+    }
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override
+    {
+        return record(visit, "switch", node);
+    }
+    bool visitCase(Visit visit, TIntermCase *node) override { return record(visit, "case", node); }
+    bool visitFunctionPrototype(Visit visit, TIntermFunctionPrototype *node) override
+    {
+        return record(visit, "prototype", node);
+    }
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override
+    {
+        record(visit, "function", node);
+        return !(mSkipFunctionBodies && visit == PreVisit && !node->getFunction()->isMain());
+    }
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        return record(visit, "aggregate", node);
+    }
+    bool visitBlock(Visit visit, TIntermBlock *node) override
+    {
+        record(visit, "block", node);
+        return !(mStopBlockInVisits && visit == InVisit);
+    }
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        return record(visit, "declaration", node);
+    }
+    bool visitLoop(Visit visit, TIntermLoop *node) override { return record(visit, "loop", node); }
+    bool visitBranch(Visit visit, TIntermBranch *node) override
+    {
+        return record(visit, "branch", node);
+    }
+
+    std::string getLog() const { return mLog.str(); }
+
+  private:
+    bool record(Visit visit, const char *nodeName, TIntermNode *node)
+    {
+        mLog << visit << " " << nodeName << " " << node << " depth=" << mDepth
+             << " parent=" << getParentNode() << " block=" << getParentBlock()
+             << " global=" << mInGlobalScope << "\n";
+        return true;
+    }
+
+    bool mSkipBinaryRight;
+    bool mSkipFunctionBodies;
+    bool mStopBlockInVisits;
+    std::stringstream mLog;
+};
+
+// Inserts a discard before every local declaration.
+class InsertDiscardTraverser : public TFusablePass
+{
+  public:
+    InsertDiscardTraverser() : TFusablePass(true, false, false) {}
+
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        if (!mInGlobalScope)
+        {
+            insertStatementInParentBlock(new TIntermBranch(EOpKill, nullptr));
+        }
+        return false;
+    }
+};
+
+class FusedTraverserTest : public ShaderCompileTreeTest
+{
+  public:
+    FusedTraverserTest() {}
+
+  protected:
+    ::GLenum getShaderType() const override { return GL_FRAGMENT_SHADER; }
+    ShShaderSpec getShaderSpec() const override { return SH_GLES3_1_SPEC; }
+
+    std::vector<RecordingTraverser *> createRecordingTraversers()
+    {
+        std::vector<RecordingTraverser *> traversers;
+        traversers.push_back(new RecordingTraverser(true, false, false, false, false, false));
+        traversers.push_back(new RecordingTraverser(true, true, true, false, false, false));
+        traversers.push_back(new RecordingTraverser(true, true, true, true, false, false));
+        traversers.push_back(new RecordingTraverser(true, true, true, false, true, false));
+        traversers.push_back(new RecordingTraverser(true, true, true, false, false, true));
+        traversers.push_back(new RecordingTraverser(false, true, true, true, true, true));
+        traversers.push_back(new RecordingTraverser(false, false, true, false, false, false));
+        return traversers;
+    }
+};
+
+const char kShader[] =
+    R"(#version 310 es
+    precision mediump float;
+    uniform vec4 u;
+    uniform int i;
+    out vec4 my_FragColor;
+    float f(float x)
+    {
+        return x > 0.5 ? x * u.x : -x;
+    }
+    void main()
+    {
+        vec4 color = u.zyxw, other;
+        for (int j = 0; j < 3; ++j)
+        {
+            color += vec4(f(color.x));
+        }
+        switch (i)
+        {
+            case 0:
+                color = vec4(0.0);
+                break;
+            default:
+                if (color.x > 1.0)
+                {
+                    color.y = 2.0;
+                }
+                else
+                {
+                    color.z = 3.0;
+                }
+        }
+        my_FragColor = color + other;
+    })";
+
+// Test that the fused traversers see the same visits and traversal context as traversers that
+// traverse the tree on their own.
+TEST_F(FusedTraverserTest, SameVisitsAsSeparateTraversal)
+{
+    compileAssumeSuccess(kShader);
+
+    std::vector<RecordingTraverser *> separateTraversers = createRecordingTraversers();
+    for (RecordingTraverser *traverser : separateTraversers)
+    {
+        mASTRoot->traverse(traverser);
+    }
+
+    std::vector<RecordingTraverser *> fusedTraversers = createRecordingTraversers();
+    TFusedTraverser fusedTraverser;
+    for (RecordingTraverser *traverser : fusedTraversers)
+    {
+        fusedTraverser.addTraverser(traverser);
+    }
+    mASTRoot->traverse(&fusedTraverser);
+
+    for (size_t index = 0; index < separateTraversers.size(); ++index)
+    {
+        EXPECT_FALSE(separateTraversers[index]->getLog().empty());
+        EXPECT_EQ(separateTraversers[index]->getLog(), fusedTraversers[index]->getLog())
+            << "traverser " << index;
+    }
+
+    for (size_t index = 0; index < separateTraversers.size(); ++index)
+    {
+        delete separateTraversers[index];
+        delete fusedTraversers[index];
+    }
+}
+
+// Test that insertions queued by a fused pass end up in the same place as insertions queued by a
+// pass that traverses the tree on its own.
+TEST_F(FusedTraverserTest, InsertionsInParentBlock)
+{
+    compileAssumeSuccess(kShader);
+    TIntermBlock *separateRoot = mASTRoot;
+    compileAssumeSuccess(kShader);
+    TIntermBlock *fusedRoot = mASTRoot;
+
+    InsertDiscardTraverser separateInsertion;
+    separateRoot->traverse(&separateInsertion);
+    separateInsertion.updateTree();
+
+    {
+        ASTPassManager passManager(fusedRoot, nullptr);
+        passManager.addFusedPass("Recording",
+                                 new RecordingTraverser(true, true, true, true, true, true));
+        passManager.addFusedPass("InsertDiscard", new InsertDiscardTraverser());
+        EXPECT_TRUE(passManager.runFusedPasses());
+    }
+
+    TInfoSinkBase separateTree;
+    OutputTree(separateRoot, separateTree);
+    TInfoSinkBase fusedTree;
+    OutputTree(fusedRoot, fusedTree);
+
+    EXPECT_NE(std::string::npos, separateTree.str().find("Branch: Kill"));
+    EXPECT_EQ(fusedTree.str(), separateTree.str());
+}
+
+// Test that SH_TIME_AST_PASSES writes the timings of the passes to the info log, with the fused
+// passes sharing an entry. Passes that don't apply to the shader aren't listed.
+TEST_F(FusedTraverserTest, TimeASTPasses)
+{
+    mExtraCompileOptions = SH_TIME_AST_PASSES;
+    compileAssumeSuccess(kShader);
+
+    EXPECT_NE(std::string::npos, mInfoLog.find("AST pass FoldExpressions: "));
+    EXPECT_NE(std::string::npos,
+              mInfoLog.find("AST pass ValidateVaryingLocations + ValidateOutputs: "));
+    EXPECT_NE(std::string::npos, mInfoLog.find("AST passes total: "));
+    EXPECT_EQ(std::string::npos, mInfoLog.find("AST pass LimitExpressionComplexity: "));
+    EXPECT_EQ(std::string::npos, mInfoLog.find("AST pass ValidateLimitations: "));
+}
+
+}  // anonymous namespace
@@ -0,0 +1,184 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PoolAlloc_test.cpp:
+//   Tests that the memory of pool allocators is recycled through the page arena, within the
+//   bounds of its cache.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "common/platform.h"
+#include "compiler/translator/PoolAlloc.h"
+#include "compiler/translator/TranslationCache.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+ShPoolAllocatorStatistics GetStatistics(const TPoolPageArena &arena)
+{
+    ShPoolAllocatorStatistics statistics;
+    arena.getStatistics(&statistics);
+    return statistics;
+}
+
+// Test that released blocks are reused by later allocations of the same size class.
+TEST(PoolPageArenaTest, ReusesReleasedBlocks)
+{
+    TPoolPageArena arena;
+
+    size_t blockSize = 0;
+    void *block      = arena.allocate(6000, &blockSize);
+    ASSERT_NE(nullptr, block);
+    EXPECT_EQ(8u * 1024u, blockSize);
+    EXPECT_EQ(1u, GetStatistics(arena).systemAllocationCount);
+    EXPECT_EQ(blockSize, GetStatistics(arena).bytesInUse);
+
+    arena.release(block, blockSize);
+    EXPECT_EQ(0u, GetStatistics(arena).bytesInUse);
+    EXPECT_EQ(blockSize, GetStatistics(arena).cachedBytes);
+
+    size_t reusedBlockSize = 0;
+    EXPECT_EQ(block, arena.allocate(8 * 1024, &reusedBlockSize));
+    EXPECT_EQ(blockSize, reusedBlockSize);
+    EXPECT_EQ(1u, GetStatistics(arena).systemAllocationCount);
+    EXPECT_EQ(0u, GetStatistics(arena).cachedBytes);
+    EXPECT_EQ(blockSize, GetStatistics(arena).peakBytesInUse);
+
+    arena.release(block, reusedBlockSize);
+}
+
+// Test that the cached blocks are bounded by the maximum cache size, and that blocks larger than
+// the size classes are not cached.
+TEST(PoolPageArenaTest, CacheIsBounded)
+{
+    TPoolPageArena arena;
+    arena.setMaxCachedSize(16 * 1024);
+
+    void *blocks[3];
+    size_t blockSizes[3];
+    for (size_t index = 0; index < 3; ++index)
+    {
+        blocks[index] = arena.allocate(8 * 1024, &blockSizes[index]);
+        ASSERT_NE(nullptr, blocks[index]);
+    }
+    EXPECT_EQ(3u, GetStatistics(arena).blocksInUse);
+
+    for (size_t index = 0; index < 3; ++index)
+    {
+        arena.release(blocks[index], blockSizes[index]);
+    }
+    EXPECT_EQ(0u, GetStatistics(arena).blocksInUse);
+    EXPECT_EQ(16u * 1024u, GetStatistics(arena).cachedBytes);
+
+    size_t largeBlockSize = 0;
+    void *largeBlock      = arena.allocate(3 * 1024 * 1024, &largeBlockSize);
+    ASSERT_NE(nullptr, largeBlock);
+    EXPECT_EQ(3u * 1024u * 1024u, largeBlockSize);
+    arena.release(largeBlock, largeBlockSize);
+    EXPECT_EQ(16u * 1024u, GetStatistics(arena).cachedBytes);
+
+    arena.setMaxCachedSize(0);
+    EXPECT_EQ(0u, GetStatistics(arena).cachedBytes);
+}
+
+#if defined(ANGLE_PLATFORM_LINUX)
+// Test that blocks in large pages are carved out of chunks, and are kept when they are released.
+TEST(PoolPageArenaTest, LargePages)
+{
+    TPoolPageArena arena;
+    arena.setMaxCachedSize(0);
+    arena.setUseLargePages(true);
+
+    size_t firstBlockSize  = 0;
+    size_t secondBlockSize = 0;
+    unsigned char *firstBlock =
+        reinterpret_cast<unsigned char *>(arena.allocate(8 * 1024, &firstBlockSize));
+    unsigned char *secondBlock =
+        reinterpret_cast<unsigned char *>(arena.allocate(8 * 1024, &secondBlockSize));
+    ASSERT_NE(nullptr, firstBlock);
+    ASSERT_EQ(firstBlock + firstBlockSize, secondBlock);
+    EXPECT_EQ(1u, GetStatistics(arena).systemAllocationCount);
+    EXPECT_EQ(2u * 1024u * 1024u, GetStatistics(arena).largePageBytes);
+
+    memset(firstBlock, 0xab, firstBlockSize);
+    arena.release(firstBlock, firstBlockSize);
+    arena.release(secondBlock, secondBlockSize);
+    EXPECT_EQ(firstBlockSize + secondBlockSize, GetStatistics(arena).cachedBytes);
+}
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+
+// Test that popping a pool gives its pages back to the arena, so that a pool that allocates the
+// same memory again doesn't allocate from the system.
+TEST(PoolAllocatorTest, PopRecyclesPages)
+{
+    ShPoolAllocatorStatistics before;
+    sh::GetPoolAllocatorStatistics(&before);
+
+    TPoolAllocator allocator;
+    allocator.push();
+    for (int index = 0; index < 1000; ++index)
+    {
+        ASSERT_NE(nullptr, allocator.allocate(100));
+    }
+    ASSERT_NE(nullptr, allocator.allocate(100 * 1024));
+    allocator.pop();
+
+    ShPoolAllocatorStatistics afterFirstPass;
+    sh::GetPoolAllocatorStatistics(&afterFirstPass);
+    EXPECT_EQ(before.bytesInUse, afterFirstPass.bytesInUse);
+
+    allocator.push();
+    for (int index = 0; index < 1000; ++index)
+    {
+        ASSERT_NE(nullptr, allocator.allocate(100));
+    }
+    ASSERT_NE(nullptr, allocator.allocate(100 * 1024));
+    allocator.pop();
+
+    ShPoolAllocatorStatistics afterSecondPass;
+    sh::GetPoolAllocatorStatistics(&afterSecondPass);
+    EXPECT_EQ(afterFirstPass.systemAllocationCount, afterSecondPass.systemAllocationCount);
+}
+
+// Test that compiling the same shader again with a new compiler doesn't allocate from the system.
+TEST(PoolAllocatorTest, BackToBackCompilesReuseMemory)
+{
+    const char *shaderStrings[] = {
+        R"(precision mediump float;
+        uniform vec4 u[4];
+        void main()
+        {
+            vec4 sum = vec4(0.0);
+            for (int i = 0; i < 4; ++i)
+            {
+                sum += u[i] * float(i);
+            }
+            gl_FragColor = sum;
+        })"};
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    sh::SetTranslationCacheMaxSize(0);
+
+    ShPoolAllocatorStatistics statistics[2];
+    for (ShPoolAllocatorStatistics &statisticsAfterCompile : statistics)
+    {
+        ShHandle compiler =
+            sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT, &resources);
+        ASSERT_NE(nullptr, compiler);
+        EXPECT_TRUE(sh::Compile(compiler, shaderStrings, 1, SH_OBJECT_CODE | SH_VARIABLES));
+        sh::Destruct(compiler);
+        sh::GetPoolAllocatorStatistics(&statisticsAfterCompile);
+    }
+
+    sh::SetTranslationCacheMaxSize(sh::kDefaultTranslationCacheMaxSize);
+
+    EXPECT_EQ(statistics[0].systemAllocationCount, statistics[1].systemAllocationCount);
+    EXPECT_LT(0u, statistics[1].cachedBytes);
+}
+
+}  // anonymous namespace
@@ -0,0 +1,256 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TranslationCache_test.cpp:
+//   Tests that the results of compilations are cached across compilers, bounded in size, and
+//   written to and read from files.
+//
+
+#include <cstdio>
+#include <fstream>
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "common/system_utils.h"
+#include "compiler/translator/TranslationCache.h"
+#include "gtest/gtest.h"
+
+using namespace sh;
+
+namespace
+{
+
+const char kFragmentShader[] =
+    R"(#version 300 es
+    precision mediump float;
+    uniform vec4 u;
+    uniform Block { vec4 b; };
+    in vec4 v;
+    out vec4 my_FragColor;
+    void main()
+    {
+        my_FragColor = u + b + v;
+    })";
+
+khronos_uint64_t HashName(const char *name, size_t length)
+{
+    khronos_uint64_t hash = 0;
+    for (size_t index = 0; index < length; ++index)
+    {
+        hash = hash * 31 + name[index];
+    }
+    return hash;
+}
+
+class TranslationCacheTest : public testing::Test
+{
+  public:
+    TranslationCacheTest() {}
+
+  protected:
+    void SetUp() override
+    {
+        InitBuiltInResources(&mResources);
+        ClearTranslationCache();
+        mCachePath = std::string(angle::GetExecutableDirectory()) + "/TranslationCache_test.bin";
+    }
+
+    void TearDown() override
+    {
+        SetTranslationCacheMaxSize(kDefaultTranslationCacheMaxSize);
+        ClearTranslationCache();
+        std::remove(mCachePath.c_str());
+    }
+
+    // Compiles the shader with a new compiler and returns its results.
+    bool compile(const char *shaderString,
+                 ShCompileOptions compileOptions,
+                 std::string *objectCodeOut,
+                 std::vector<Uniform> *uniformsOut,
+                 std::vector<InterfaceBlock> *interfaceBlocksOut)
+    {
+        ShHandle compiler =
+            ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, SH_ESSL_OUTPUT, &mResources);
+        EXPECT_NE(nullptr, compiler);
+
+        const char *shaderStrings[] = {shaderString};
+        bool success                = Compile(compiler, shaderStrings, 1, compileOptions);
+        if (success)
+        {
+            *objectCodeOut      = GetObjectCode(compiler);
+            *uniformsOut        = *GetUniforms(compiler);
+            *interfaceBlocksOut = *GetInterfaceBlocks(compiler);
+        }
+        Destruct(compiler);
+        return success;
+    }
+
+    void expectSameResults(ShCompileOptions compileOptions)
+    {
+        std::string objectCode;
+        std::vector<Uniform> uniforms;
+        std::vector<InterfaceBlock> interfaceBlocks;
+        ASSERT_TRUE(compile(kFragmentShader, compileOptions, &objectCode, &uniforms,
+                            &interfaceBlocks));
+
+        std::string cachedObjectCode;
+        std::vector<Uniform> cachedUniforms;
+        std::vector<InterfaceBlock> cachedInterfaceBlocks;
+        ASSERT_TRUE(compile(kFragmentShader, compileOptions, &cachedObjectCode, &cachedUniforms,
+                            &cachedInterfaceBlocks));
+
+        EXPECT_NE(std::string::npos, objectCode.find("void main()"));
+        EXPECT_EQ(objectCode, cachedObjectCode);
+
+        ASSERT_EQ(1u, uniforms.size());
+        ASSERT_EQ(1u, cachedUniforms.size());
+        EXPECT_TRUE(uniforms[0].isSameUniformAtLinkTime(cachedUniforms[0]));
+        EXPECT_EQ(uniforms[0].mappedName, cachedUniforms[0].mappedName);
+        EXPECT_EQ(uniforms[0].staticUse, cachedUniforms[0].staticUse);
+
+        ASSERT_EQ(1u, interfaceBlocks.size());
+        ASSERT_EQ(1u, cachedInterfaceBlocks.size());
+        EXPECT_TRUE(interfaceBlocks[0].isSameInterfaceBlockAtLinkTime(cachedInterfaceBlocks[0]));
+        EXPECT_EQ(interfaceBlocks[0].mappedName, cachedInterfaceBlocks[0].mappedName);
+    }
+
+    ShBuiltInResources mResources;
+    std::string mCachePath;
+};
+
+// Test that compiling the same shader with another compiler uses the cached results.
+TEST_F(TranslationCacheTest, SameShaderIsCachedOnce)
+{
+    expectSameResults(SH_OBJECT_CODE | SH_VARIABLES);
+    EXPECT_EQ(1u, GetTranslationCache()->entryCount());
+    EXPECT_LT(0u, GetTranslationCacheSize());
+}
+
+// Test that compilations with different options or resources get separate entries.
+TEST_F(TranslationCacheTest, DifferentInputsAreCachedSeparately)
+{
+    expectSameResults(SH_OBJECT_CODE | SH_VARIABLES);
+    expectSameResults(SH_OBJECT_CODE | SH_VARIABLES | SH_INIT_OUTPUT_VARIABLES);
+    EXPECT_EQ(2u, GetTranslationCache()->entryCount());
+
+    mResources.MaxDrawBuffers = 2;
+    expectSameResults(SH_OBJECT_CODE | SH_VARIABLES);
+    EXPECT_EQ(3u, GetTranslationCache()->entryCount());
+}
+
+// Test that failed compilations are not cached, so that they report their errors every time.
+TEST_F(TranslationCacheTest, FailedCompilationIsNotCached)
+{
+    std::string objectCode;
+    std::vector<Uniform> uniforms;
+    std::vector<InterfaceBlock> interfaceBlocks;
+    EXPECT_FALSE(compile("void main() { undefined(); }", SH_OBJECT_CODE, &objectCode, &uniforms,
+                         &interfaceBlocks));
+    EXPECT_EQ(0u, GetTranslationCache()->entryCount());
+}
+
+// Test that a size of 0 disables the cache.
+TEST_F(TranslationCacheTest, Disabled)
+{
+    SetTranslationCacheMaxSize(0);
+    expectSameResults(SH_OBJECT_CODE | SH_VARIABLES);
+    EXPECT_EQ(0u, GetTranslationCache()->entryCount());
+    EXPECT_EQ(0u, GetTranslationCacheSize());
+}
+
+// Test that the least recently used entries are evicted to stay within the maximum size.
+TEST_F(TranslationCacheTest, EvictsLeastRecentlyUsed)
+{
+    TranslationCache cache;
+    TranslationResults results;
+    results.objectCode = std::string(1000, 'x');
+
+    TranslationHash hashes[3];
+    for (uint8_t index = 0; index < 3; ++index)
+    {
+        hashes[index].fill(index);
+        cache.put(hashes[index], results, true);
+    }
+    size_t entrySize = cache.size() / 3;
+    EXPECT_EQ(3u, cache.entryCount());
+
+    // Use the first entry so that the second one is the least recently used.
+    TranslationResults cachedResults;
+    EXPECT_TRUE(cache.get(hashes[0], &cachedResults));
+    EXPECT_EQ(results.objectCode, cachedResults.objectCode);
+
+    cache.setMaxSize(entrySize * 2);
+    EXPECT_EQ(2u, cache.entryCount());
+    EXPECT_TRUE(cache.get(hashes[0], &cachedResults));
+    EXPECT_FALSE(cache.get(hashes[1], &cachedResults));
+    EXPECT_TRUE(cache.get(hashes[2], &cachedResults));
+
+    // Entries larger than the cache are not added.
+    TranslationHash largeHash;
+    largeHash.fill(3);
+    results.objectCode = std::string(entrySize * 2, 'x');
+    cache.put(largeHash, results, true);
+    EXPECT_FALSE(cache.get(largeHash, &cachedResults));
+    EXPECT_EQ(2u, cache.entryCount());
+}
+
+// Test that the cache can be written to a file and read back.
+TEST_F(TranslationCacheTest, SaveAndLoad)
+{
+    expectSameResults(SH_OBJECT_CODE | SH_VARIABLES);
+    size_t cacheSize = GetTranslationCacheSize();
+    ASSERT_TRUE(SaveTranslationCache(mCachePath.c_str()));
+
+    ClearTranslationCache();
+    EXPECT_EQ(0u, GetTranslationCacheSize());
+
+    ASSERT_TRUE(LoadTranslationCache(mCachePath.c_str()));
+    EXPECT_EQ(cacheSize, GetTranslationCacheSize());
+    EXPECT_EQ(1u, GetTranslationCache()->entryCount());
+
+    expectSameResults(SH_OBJECT_CODE | SH_VARIABLES);
+    EXPECT_EQ(1u, GetTranslationCache()->entryCount());
+}
+
+// Test that files that are missing or corrupt are rejected without changing the cache.
+TEST_F(TranslationCacheTest, LoadInvalidFile)
+{
+    std::remove(mCachePath.c_str());
+    EXPECT_FALSE(LoadTranslationCache(mCachePath.c_str()));
+
+    expectSameResults(SH_OBJECT_CODE | SH_VARIABLES);
+    ASSERT_TRUE(SaveTranslationCache(mCachePath.c_str()));
+
+    std::vector<char> contents;
+    {
+        std::ifstream file(mCachePath.c_str(), std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    ASSERT_LT(100u, contents.size());
+    contents[contents.size() / 2] ^= 1;
+    {
+        std::ofstream file(mCachePath.c_str(), std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), contents.size());
+    }
+
+    ClearTranslationCache();
+    EXPECT_FALSE(LoadTranslationCache(mCachePath.c_str()));
+    EXPECT_EQ(0u, GetTranslationCache()->entryCount());
+}
+
+// Test that results with hashed names are cached, but not written to files.
+TEST_F(TranslationCacheTest, HashedNamesAreNotSaved)
+{
+    mResources.HashFunction = HashName;
+    expectSameResults(SH_OBJECT_CODE | SH_VARIABLES);
+    EXPECT_EQ(1u, GetTranslationCache()->entryCount());
+
+    ASSERT_TRUE(SaveTranslationCache(mCachePath.c_str()));
+    ClearTranslationCache();
+    ASSERT_TRUE(LoadTranslationCache(mCachePath.c_str()));
+    EXPECT_EQ(0u, GetTranslationCache()->entryCount());
+}
+
+}  // anonymous namespace
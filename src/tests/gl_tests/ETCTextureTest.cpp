@@ -8,6 +8,9 @@
 //
 
 #include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+
+#include <algorithm>
 
 using namespace angle;
 
@@ -42,9 +45,87 @@ class ETCTextureTest : public ANGLETest
         ANGLETest::TearDown();
     }
 
+    bool isCompressedFormatSupported(GLenum format)
+    {
+        GLint formatCount = 0;
+        glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &formatCount);
+        std::vector<GLint> formats(formatCount);
+        glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, formats.data());
+        return std::find(formats.begin(), formats.end(), static_cast<GLint>(format)) !=
+               formats.end();
+    }
+
+    // Uploads an 8x4 texture made of two blocks, draws it across the window and checks the
+    // middle of each half. Red and green are mapped from [-1, 1] to [0, 1] so that signed and
+    // unsigned formats are checked the same way.
+    void checkTwoBlockTexture(GLenum format,
+                              const GLubyte *data,
+                              GLsizei dataSize,
+                              const GLColor &leftColor,
+                              const GLColor &rightColor)
+    {
+        const std::string vsSource =
+            "attribute vec4 position;\n"
+            "varying vec2 texcoord;\n"
+            "void main()\n"
+            "{\n"
+            "    gl_Position = position;\n"
+            "    texcoord = position.xy * 0.5 + 0.5;\n"
+            "}\n";
+
+        const std::string fsSource =
+            "precision mediump float;\n"
+            "uniform sampler2D tex;\n"
+            "varying vec2 texcoord;\n"
+            "void main()\n"
+            "{\n"
+            "    gl_FragColor = vec4(texture2D(tex, texcoord).rg * 0.5 + 0.5, 0.0, 1.0);\n"
+            "}\n";
+
+        ANGLE_GL_PROGRAM(program, vsSource, fsSource);
+
+        glBindTexture(GL_TEXTURE_2D, mTexture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glCompressedTexImage2D(GL_TEXTURE_2D, 0, format, 8, 4, 0, dataSize, data);
+        ASSERT_GL_NO_ERROR();
+
+        drawQuad(program.get(), "position", 0.5f);
+        ASSERT_GL_NO_ERROR();
+
+        EXPECT_PIXEL_COLOR_NEAR(getWindowWidth() / 4, getWindowHeight() / 2, leftColor, 2);
+        EXPECT_PIXEL_COLOR_NEAR(getWindowWidth() * 3 / 4, getWindowHeight() / 2, rightColor, 2);
+    }
+
     GLuint mTexture;
 };
 
+// EAC blocks with a multiplier of 0 decode every pixel to the same value. With a base codeword of
+// 0x20 an unsigned block is 257 / 2047, and 0xE0 is 1793 / 2047. A signed block is about 0.5 with
+// a base codeword of 0x40 and about -0.5 with 0xC0.
+constexpr GLubyte kEACLowBlock[8]        = {0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+constexpr GLubyte kEACHighBlock[8]       = {0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+constexpr GLubyte kSignedEACLowBlock[8]  = {0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+constexpr GLubyte kSignedEACHighBlock[8] = {0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+// The colors the blocks above draw with, after mapping from [-1, 1] to [0, 1].
+constexpr GLubyte kEACLowColor        = 143;
+constexpr GLubyte kEACHighColor       = 239;
+constexpr GLubyte kSignedEACLowColor  = 64;
+constexpr GLubyte kSignedEACHighColor = 191;
+constexpr GLubyte kZeroColor          = 128;
+
+// Concatenates 8-byte EAC blocks into texture data.
+std::vector<GLubyte> MakeEACData(std::initializer_list<const GLubyte *> blocks)
+{
+    std::vector<GLubyte> data;
+    for (const GLubyte *block : blocks)
+    {
+        data.insert(data.end(), block, block + 8);
+    }
+    return data;
+}
+
 // Tests a texture with ETC1 lossy decode format
 TEST_P(ETCTextureTest, ETC1Validation)
 {
@@ -260,6 +341,178 @@ TEST_P(ETCTextureTest, ETC2SRGB8A1Validation)
     }
 }
 
+// Tests a texture with ETC2 RGBA8 lossy decode format
+TEST_P(ETCTextureTest, ETC2RGBA8Validation)
+{
+    bool supported = extensionEnabled("GL_ANGLE_lossy_etc_decode");
+
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+
+    GLubyte pixel[] = {
+        0x7e, 0x4c, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,  // EAC alpha block
+        0x80, 0x98, 0x59, 0x02, 0x6e, 0xe7, 0x44, 0x47,  // Individual/differential block
+        0xa0, 0x8f, 0x1b, 0x6d, 0xb6, 0xdb, 0x6d, 0xb6,  // EAC alpha block
+        0xeb, 0x85, 0x68, 0x30, 0x77, 0x73, 0x44, 0x44,  // T block
+        0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // EAC alpha block
+        0xb4, 0x05, 0xab, 0x92, 0xf8, 0x8c, 0x07, 0x73,  // H block
+        0x20, 0xf4, 0xff, 0xf0, 0x00, 0x05, 0x29, 0x4a,  // EAC alpha block
+        0xbb, 0x90, 0x15, 0xba, 0x8a, 0x8c, 0xd5, 0x5f   // Planar block
+    };
+    glCompressedTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE, 8, 8,
+                           0, sizeof(pixel), pixel);
+    if (supported)
+    {
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 8, 8,
+                                  GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE, sizeof(pixel),
+                                  pixel);
+        EXPECT_GL_NO_ERROR();
+
+        const GLsizei imageSize = 16;
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 1, GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE, 4,
+                               4, 0, imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 2, GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE, 2,
+                               2, 0, imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 3, GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE, 1,
+                               1, 0, imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+    }
+    else
+    {
+        EXPECT_GL_ERROR(GL_INVALID_ENUM);
+    }
+}
+
+// Tests a texture with ETC2 SRGB8 alpha8 lossy decode format
+TEST_P(ETCTextureTest, ETC2SRGB8Alpha8Validation)
+{
+    bool supported = extensionEnabled("GL_ANGLE_lossy_etc_decode");
+
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+
+    GLubyte pixel[] = {
+        0x7e, 0x4c, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,  // EAC alpha block
+        0x80, 0x98, 0x59, 0x02, 0x6e, 0xe7, 0x44, 0x47,  // Individual/differential block
+        0xa0, 0x8f, 0x1b, 0x6d, 0xb6, 0xdb, 0x6d, 0xb6,  // EAC alpha block
+        0xeb, 0x85, 0x68, 0x30, 0x77, 0x73, 0x44, 0x44,  // T block
+        0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // EAC alpha block
+        0xb4, 0x05, 0xab, 0x92, 0xf8, 0x8c, 0x07, 0x73,  // H block
+        0x20, 0xf4, 0xff, 0xf0, 0x00, 0x05, 0x29, 0x4a,  // EAC alpha block
+        0xbb, 0x90, 0x15, 0xba, 0x8a, 0x8c, 0xd5, 0x5f   // Planar block
+    };
+    glCompressedTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE,
+                           8, 8, 0, sizeof(pixel), pixel);
+    if (supported)
+    {
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 8, 8,
+                                  GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE,
+                                  sizeof(pixel), pixel);
+        EXPECT_GL_NO_ERROR();
+
+        const GLsizei imageSize = 16;
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 1,
+                               GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE, 4, 4, 0,
+                               imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 2,
+                               GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE, 2, 2, 0,
+                               imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 3,
+                               GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE, 1, 1, 0,
+                               imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+    }
+    else
+    {
+        EXPECT_GL_ERROR(GL_INVALID_ENUM);
+    }
+}
+
+// Tests that EAC R11 lossy decode textures sample the values their blocks encode
+TEST_P(ETCTextureTest, EACR11Decode)
+{
+    if (!extensionEnabled("GL_ANGLE_lossy_etc_decode") ||
+        !isCompressedFormatSupported(GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE))
+    {
+        std::cout << "Test skipped because EAC R11 lossy decode is not available." << std::endl;
+        return;
+    }
+
+    std::vector<GLubyte> data = MakeEACData({kEACLowBlock, kEACHighBlock});
+    checkTwoBlockTexture(GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE, data.data(),
+                         static_cast<GLsizei>(data.size()),
+                         GLColor(kEACLowColor, kZeroColor, 0, 255),
+                         GLColor(kEACHighColor, kZeroColor, 0, 255));
+}
+
+// Tests that signed EAC R11 lossy decode textures sample the values their blocks encode
+TEST_P(ETCTextureTest, EACSignedR11Decode)
+{
+    if (!extensionEnabled("GL_ANGLE_lossy_etc_decode") ||
+        !isCompressedFormatSupported(GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE))
+    {
+        std::cout << "Test skipped because signed EAC R11 lossy decode is not available."
+                  << std::endl;
+        return;
+    }
+
+    std::vector<GLubyte> data = MakeEACData({kSignedEACLowBlock, kSignedEACHighBlock});
+    checkTwoBlockTexture(GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE, data.data(),
+                         static_cast<GLsizei>(data.size()),
+                         GLColor(kSignedEACLowColor, kZeroColor, 0, 255),
+                         GLColor(kSignedEACHighColor, kZeroColor, 0, 255));
+}
+
+// Tests that EAC RG11 lossy decode textures sample the values their blocks encode
+TEST_P(ETCTextureTest, EACRG11Decode)
+{
+    if (!extensionEnabled("GL_ANGLE_lossy_etc_decode") ||
+        !isCompressedFormatSupported(GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE))
+    {
+        std::cout << "Test skipped because EAC RG11 lossy decode is not available." << std::endl;
+        return;
+    }
+
+    // Each 4x4 block of RG11 is a red EAC block followed by a green one.
+    std::vector<GLubyte> data =
+        MakeEACData({kEACLowBlock, kEACHighBlock, kEACHighBlock, kEACLowBlock});
+    checkTwoBlockTexture(GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE, data.data(),
+                         static_cast<GLsizei>(data.size()),
+                         GLColor(kEACLowColor, kEACHighColor, 0, 255),
+                         GLColor(kEACHighColor, kEACLowColor, 0, 255));
+}
+
+// Tests that signed EAC RG11 lossy decode textures sample the values their blocks encode
+TEST_P(ETCTextureTest, EACSignedRG11Decode)
+{
+    if (!extensionEnabled("GL_ANGLE_lossy_etc_decode") ||
+        !isCompressedFormatSupported(GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE))
+    {
+        std::cout << "Test skipped because signed EAC RG11 lossy decode is not available."
+                  << std::endl;
+        return;
+    }
+
+    std::vector<GLubyte> data = MakeEACData(
+        {kSignedEACLowBlock, kSignedEACHighBlock, kSignedEACHighBlock, kSignedEACLowBlock});
+    checkTwoBlockTexture(GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE, data.data(),
+                         static_cast<GLsizei>(data.size()),
+                         GLColor(kSignedEACLowColor, kSignedEACHighColor, 0, 255),
+                         GLColor(kSignedEACHighColor, kSignedEACLowColor, 0, 255));
+}
+
 ANGLE_INSTANTIATE_TEST(ETCTextureTest,
                        ES2_D3D9(),
                        ES2_D3D11(),
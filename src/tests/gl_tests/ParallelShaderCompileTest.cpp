@@ -0,0 +1,340 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ParallelShaderCompileTest.cpp : Tests of the GL_KHR_parallel_shader_compile extension.
+
+#include "test_utils/ANGLETest.h"
+
+#include "system_utils.h"
+
+using namespace angle;
+
+namespace
+{
+
+class ParallelShaderCompileTest : public ANGLETest
+{
+  protected:
+    ParallelShaderCompileTest()
+    {
+        setWindowWidth(128);
+        setWindowHeight(128);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    bool hasParallelShaderCompileExtension()
+    {
+        return extensionEnabled("GL_KHR_parallel_shader_compile");
+    }
+
+    GLuint startCompile(GLenum type, const std::string &source)
+    {
+        GLuint shader              = glCreateShader(type);
+        const char *sourceArray[1] = {source.c_str()};
+        glShaderSource(shader, 1, sourceArray, nullptr);
+        glCompileShader(shader);
+        return shader;
+    }
+
+    // Polls the completion status the way an application would, without blocking on the compile.
+    void waitForCompletion(GLuint shader)
+    {
+        GLint completed = GL_FALSE;
+        glGetShaderiv(shader, GL_COMPLETION_STATUS_KHR, &completed);
+        while (completed == GL_FALSE)
+        {
+            angle::Sleep(1);
+            glGetShaderiv(shader, GL_COMPLETION_STATUS_KHR, &completed);
+        }
+    }
+
+    GLuint startLink(GLuint vertexShader, GLuint fragmentShader)
+    {
+        GLuint program = glCreateProgram();
+        glAttachShader(program, vertexShader);
+        glAttachShader(program, fragmentShader);
+        glLinkProgram(program);
+        return program;
+    }
+
+    void waitForLinkCompletion(GLuint program)
+    {
+        GLint completed = GL_FALSE;
+        glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &completed);
+        while (completed == GL_FALSE)
+        {
+            angle::Sleep(1);
+            glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &completed);
+        }
+    }
+
+    void drawGreenQuad(GLuint program)
+    {
+        glUseProgram(program);
+        glUniform4f(glGetUniformLocation(program, "color"), 0.0f, 1.0f, 0.0f, 1.0f);
+        drawQuad(program, "position", 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::green);
+    }
+
+    const std::string mVertexShader =
+        "attribute vec4 position;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_Position = position;\n"
+        "}\n";
+
+    const std::string mFragmentShader =
+        "precision mediump float;\n"
+        "uniform vec4 color;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor = color;\n"
+        "}\n";
+};
+
+// Test that the thread count query returns a sensible value and can be changed.
+TEST_P(ParallelShaderCompileTest, MaxShaderCompilerThreads)
+{
+    ANGLE_SKIP_TEST_IF(!hasParallelShaderCompileExtension());
+
+    GLint maxThreads = 0;
+    glGetIntegerv(GL_MAX_SHADER_COMPILER_THREADS_KHR, &maxThreads);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_NE(0, maxThreads);
+
+    glMaxShaderCompilerThreadsKHR(0);
+    EXPECT_GL_NO_ERROR();
+
+    glGetIntegerv(GL_MAX_SHADER_COMPILER_THREADS_KHR, &maxThreads);
+    EXPECT_EQ(0, maxThreads);
+
+    glMaxShaderCompilerThreadsKHR(8);
+    glGetIntegerv(GL_MAX_SHADER_COMPILER_THREADS_KHR, &maxThreads);
+    EXPECT_EQ(8, maxThreads);
+}
+
+// Test that many shaders compiled back to back all complete, and can be linked and drawn with.
+TEST_P(ParallelShaderCompileTest, CompileAndLinkManyShaders)
+{
+    ANGLE_SKIP_TEST_IF(!hasParallelShaderCompileExtension());
+
+    constexpr size_t kShaderPairCount = 16;
+
+    std::vector<GLuint> shaders;
+    for (size_t pairIndex = 0; pairIndex < kShaderPairCount; ++pairIndex)
+    {
+        shaders.push_back(startCompile(GL_VERTEX_SHADER, mVertexShader));
+        shaders.push_back(startCompile(GL_FRAGMENT_SHADER, mFragmentShader));
+    }
+    ASSERT_GL_NO_ERROR();
+
+    for (GLuint shader : shaders)
+    {
+        waitForCompletion(shader);
+
+        GLint compiled = GL_FALSE;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+        EXPECT_GL_TRUE(compiled);
+    }
+
+    for (size_t pairIndex = 0; pairIndex < kShaderPairCount; ++pairIndex)
+    {
+        GLuint program = glCreateProgram();
+        glAttachShader(program, shaders[pairIndex * 2]);
+        glAttachShader(program, shaders[pairIndex * 2 + 1]);
+        glLinkProgram(program);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        ASSERT_GL_TRUE(linked);
+
+        drawGreenQuad(program);
+
+        glDeleteProgram(program);
+    }
+
+    for (GLuint shader : shaders)
+    {
+        glDeleteShader(shader);
+    }
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that compile errors are reported once the compile completes.
+TEST_P(ParallelShaderCompileTest, CompileError)
+{
+    ANGLE_SKIP_TEST_IF(!hasParallelShaderCompileExtension());
+
+    GLuint shader = startCompile(GL_FRAGMENT_SHADER, "void main() { undeclared = 1.0; }");
+    waitForCompletion(shader);
+
+    GLint compiled = GL_TRUE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    EXPECT_GL_FALSE(compiled);
+
+    GLint infoLogLength = 0;
+    glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &infoLogLength);
+    EXPECT_GT(infoLogLength, 0);
+
+    glDeleteShader(shader);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that recompiling or deleting a shader with a compile in flight is safe.
+TEST_P(ParallelShaderCompileTest, RecompileAndDeleteWhilePending)
+{
+    ANGLE_SKIP_TEST_IF(!hasParallelShaderCompileExtension());
+
+    GLuint shader = startCompile(GL_FRAGMENT_SHADER, "void main() { undeclared = 1.0; }");
+
+    const char *sourceArray[1] = {mFragmentShader.c_str()};
+    glShaderSource(shader, 1, sourceArray, nullptr);
+    glCompileShader(shader);
+    waitForCompletion(shader);
+
+    GLint compiled = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    EXPECT_GL_TRUE(compiled);
+
+    glDeleteShader(shader);
+
+    GLuint deletedWhilePending = startCompile(GL_VERTEX_SHADER, mVertexShader);
+    glDeleteShader(deletedWhilePending);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that compiles still work with parallel compilation disabled.
+TEST_P(ParallelShaderCompileTest, ZeroThreads)
+{
+    ANGLE_SKIP_TEST_IF(!hasParallelShaderCompileExtension());
+
+    glMaxShaderCompilerThreadsKHR(0);
+
+    GLuint shader = startCompile(GL_VERTEX_SHADER, mVertexShader);
+
+    GLint completed = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPLETION_STATUS_KHR, &completed);
+    EXPECT_GL_TRUE(completed);
+
+    GLint compiled = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    EXPECT_GL_TRUE(compiled);
+
+    glDeleteShader(shader);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that many programs linked back to back all complete, and can be drawn with.
+TEST_P(ParallelShaderCompileTest, LinkManyPrograms)
+{
+    ANGLE_SKIP_TEST_IF(!hasParallelShaderCompileExtension());
+
+    constexpr size_t kProgramCount = 16;
+
+    GLuint vertexShader   = startCompile(GL_VERTEX_SHADER, mVertexShader);
+    GLuint fragmentShader = startCompile(GL_FRAGMENT_SHADER, mFragmentShader);
+
+    std::vector<GLuint> programs;
+    for (size_t programIndex = 0; programIndex < kProgramCount; ++programIndex)
+    {
+        programs.push_back(startLink(vertexShader, fragmentShader));
+    }
+    ASSERT_GL_NO_ERROR();
+
+    for (GLuint program : programs)
+    {
+        waitForLinkCompletion(program);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        ASSERT_GL_TRUE(linked);
+
+        drawGreenQuad(program);
+        glDeleteProgram(program);
+    }
+
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that link errors are reported once the link completes.
+TEST_P(ParallelShaderCompileTest, LinkError)
+{
+    ANGLE_SKIP_TEST_IF(!hasParallelShaderCompileExtension());
+
+    const std::string fragmentShaderSource =
+        "precision mediump float;\n"
+        "varying vec4 undeclaredInVertexShader;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor = undeclaredInVertexShader;\n"
+        "}\n";
+
+    GLuint vertexShader   = startCompile(GL_VERTEX_SHADER, mVertexShader);
+    GLuint fragmentShader = startCompile(GL_FRAGMENT_SHADER, fragmentShaderSource);
+    GLuint program        = startLink(vertexShader, fragmentShader);
+    waitForLinkCompletion(program);
+
+    GLint linked = GL_TRUE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    EXPECT_GL_FALSE(linked);
+
+    GLint infoLogLength = 0;
+    glGetProgramiv(program, GL_INFO_LOG_LENGTH, &infoLogLength);
+    EXPECT_GT(infoLogLength, 0);
+
+    glDeleteProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that changing or deleting the program's shaders while it links doesn't affect the link.
+TEST_P(ParallelShaderCompileTest, ModifyShadersWhileLinking)
+{
+    ANGLE_SKIP_TEST_IF(!hasParallelShaderCompileExtension());
+
+    GLuint vertexShader   = startCompile(GL_VERTEX_SHADER, mVertexShader);
+    GLuint fragmentShader = startCompile(GL_FRAGMENT_SHADER, mFragmentShader);
+    GLuint program        = startLink(vertexShader, fragmentShader);
+
+    const char *sourceArray[1] = {"void main() { undeclared = 1.0; }"};
+    glShaderSource(fragmentShader, 1, sourceArray, nullptr);
+    glCompileShader(fragmentShader);
+    glDetachShader(program, vertexShader);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    waitForLinkCompletion(program);
+
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    ASSERT_GL_TRUE(linked);
+    drawGreenQuad(program);
+
+    glDeleteProgram(program);
+
+    vertexShader               = startCompile(GL_VERTEX_SHADER, mVertexShader);
+    fragmentShader             = startCompile(GL_FRAGMENT_SHADER, mFragmentShader);
+    GLuint deletedWhileLinking = startLink(vertexShader, fragmentShader);
+    glDeleteProgram(deletedWhileLinking);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    ASSERT_GL_NO_ERROR();
+}
+
+ANGLE_INSTANTIATE_TEST(ParallelShaderCompileTest,
+                       ES2_D3D9(),
+                       ES2_D3D11(),
+                       ES3_D3D11(),
+                       ES2_OPENGL(),
+                       ES2_OPENGLES(),
+                       ES2_VULKAN());
+
+}  // anonymous namespace
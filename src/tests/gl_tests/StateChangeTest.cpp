@@ -1125,6 +1125,257 @@ TEST_P(SimpleStateChangeTest, ScissorTest)
     EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::red);
 }
 
+constexpr char kValidationVertexShader[] = R"(#version 300 es
+in vec4 position;
+void main()
+{
+    gl_Position = position;
+})";
+
+constexpr char kValidationFragmentShader[] = R"(#version 300 es
+precision mediump float;
+uniform block
+{
+    vec4 color;
+};
+out vec4 fragColor;
+void main()
+{
+    fragColor = color;
+})";
+
+// Tests that draw validation notices state changes that make drawing an error, after draws with
+// the same state succeeded.
+class ValidationStateChangeTest : public ANGLETest
+{
+  protected:
+    ValidationStateChangeTest()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void SetUp() override
+    {
+        ANGLETest::SetUp();
+
+        mProgram = CompileProgram(kValidationVertexShader, kValidationFragmentShader);
+        ASSERT_NE(0u, mProgram);
+        glUseProgram(mProgram);
+
+        GLint positionLocation = glGetAttribLocation(mProgram, "position");
+        ASSERT_NE(-1, positionLocation);
+
+        std::vector<GLfloat> positions(6 * 4, 0.0f);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(GLfloat), positions.data(),
+                     GL_STATIC_DRAW);
+        glVertexAttribPointer(positionLocation, 4, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glEnableVertexAttribArray(positionLocation);
+
+        glBindBuffer(GL_UNIFORM_BUFFER, mUniformBuffer);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(kFloatGreen), &kFloatGreen, GL_STATIC_DRAW);
+        glBindBufferBase(GL_UNIFORM_BUFFER, 0, mUniformBuffer);
+        glUniformBlockBinding(mProgram, 0, 0);
+
+        ASSERT_GL_NO_ERROR();
+    }
+
+    void TearDown() override
+    {
+        glDeleteProgram(mProgram);
+        ANGLETest::TearDown();
+    }
+
+    // Draws twice, so that the second draw can reuse the first draw's validation.
+    void drawTwice()
+    {
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+
+    GLuint mProgram = 0;
+    GLBuffer mVertexBuffer;
+    GLBuffer mUniformBuffer;
+};
+
+// Tests that mapping a vertex buffer makes drawing from it an error.
+TEST_P(ValidationStateChangeTest, MapVertexBuffer)
+{
+    drawTwice();
+    ASSERT_GL_NO_ERROR();
+
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glMapBufferRange(GL_ARRAY_BUFFER, 0, 16, GL_MAP_READ_BIT);
+    ASSERT_GL_NO_ERROR();
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    drawTwice();
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that mapping a buffer is noticed by a vertex array that isn't bound at the time.
+TEST_P(ValidationStateChangeTest, MapBufferOfUnboundVertexArray)
+{
+    GLint positionLocation = glGetAttribLocation(mProgram, "position");
+
+    std::vector<GLfloat> positions(6 * 4, 0.0f);
+    GLBuffer otherBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, otherBuffer);
+    glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(GLfloat), positions.data(),
+                 GL_STATIC_DRAW);
+
+    GLVertexArray vertexArray;
+    glBindVertexArray(vertexArray);
+    glVertexAttribPointer(positionLocation, 4, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+    drawTwice();
+    ASSERT_GL_NO_ERROR();
+
+    glBindVertexArray(0);
+    glMapBufferRange(GL_ARRAY_BUFFER, 0, 16, GL_MAP_READ_BIT);
+    drawTwice();
+    ASSERT_GL_NO_ERROR();
+
+    glBindVertexArray(vertexArray);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    // Disabled attributes may read from mapped buffers.
+    glDisableVertexAttribArray(positionLocation);
+    drawTwice();
+    ASSERT_GL_NO_ERROR();
+
+    glEnableVertexAttribArray(positionLocation);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    // Pointing the attribute at another buffer makes drawing valid again.
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glVertexAttribPointer(positionLocation, 4, GL_FLOAT, GL_FALSE, 0, nullptr);
+    drawTwice();
+    ASSERT_GL_NO_ERROR();
+
+    glBindBuffer(GL_ARRAY_BUFFER, otherBuffer);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that shrinking a uniform buffer below its block's size makes drawing an error.
+TEST_P(ValidationStateChangeTest, ShrinkUniformBuffer)
+{
+    drawTwice();
+    ASSERT_GL_NO_ERROR();
+
+    GLfloat smallData = 0.0f;
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(smallData), &smallData, GL_STATIC_DRAW);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+}
+
+// Tests that shrinking a uniform buffer through a shared context makes drawing an error.
+TEST_P(ValidationStateChangeTest, ShrinkUniformBufferInSharedContext)
+{
+    drawTwice();
+    ASSERT_GL_NO_ERROR();
+
+    EGLWindow *window  = getEGLWindow();
+    EGLDisplay display = window->getDisplay();
+    EGLSurface surface = window->getSurface();
+
+    EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION_KHR,
+        GetParam().majorVersion,
+        EGL_CONTEXT_MINOR_VERSION_KHR,
+        GetParam().minorVersion,
+        EGL_NONE,
+    };
+    EGLContext sharedContext =
+        eglCreateContext(display, window->getConfig(), window->getContext(), contextAttributes);
+    ASSERT_NE(EGL_NO_CONTEXT, sharedContext);
+
+    eglMakeCurrent(display, surface, surface, sharedContext);
+    GLfloat smallData = 0.0f;
+    glBindBuffer(GL_UNIFORM_BUFFER, mUniformBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(smallData), &smallData, GL_STATIC_DRAW);
+    ASSERT_GL_NO_ERROR();
+
+    eglMakeCurrent(display, surface, surface, window->getContext());
+    eglDestroyContext(display, sharedContext);
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+}
+
+// Tests that moving a uniform block to a binding without a buffer makes drawing an error.
+TEST_P(ValidationStateChangeTest, ChangeUniformBlockBinding)
+{
+    drawTwice();
+    ASSERT_GL_NO_ERROR();
+
+    glUniformBlockBinding(mProgram, 0, 1);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+}
+
+// Tests that a failed relink of the program in use makes drawing an error.
+TEST_P(ValidationStateChangeTest, FailedRelinkOfProgramInUse)
+{
+    drawTwice();
+    ASSERT_GL_NO_ERROR();
+
+    // Linking without a fragment shader fails.
+    GLuint shaders[2]   = {};
+    GLsizei shaderCount = 0;
+    glGetAttachedShaders(mProgram, 2, &shaderCount, shaders);
+    for (GLsizei shaderIndex = 0; shaderIndex < shaderCount; ++shaderIndex)
+    {
+        GLint shaderType = GL_NONE;
+        glGetShaderiv(shaders[shaderIndex], GL_SHADER_TYPE, &shaderType);
+        if (shaderType == GL_FRAGMENT_SHADER)
+        {
+            glDetachShader(mProgram, shaders[shaderIndex]);
+        }
+    }
+    glLinkProgram(mProgram);
+
+    GLint linked = GL_TRUE;
+    glGetProgramiv(mProgram, GL_LINK_STATUS, &linked);
+    ASSERT_GL_FALSE(linked);
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+}
+
+// Tests that redefining a framebuffer's attachment so the framebuffer is incomplete makes drawing
+// an error.
+TEST_P(ValidationStateChangeTest, RedefineAttachment)
+{
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 16, 16, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    drawTwice();
+    ASSERT_GL_NO_ERROR();
+
+    // Alpha textures aren't color-renderable.
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, 16, 16, 0, GL_ALPHA, GL_UNSIGNED_BYTE, nullptr);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_FRAMEBUFFER_OPERATION);
+}
+
 }  // anonymous namespace
 
 ANGLE_INSTANTIATE_TEST(StateChangeTest, ES2_D3D9(), ES2_D3D11(), ES2_OPENGL());
@@ -1136,3 +1387,4 @@ ANGLE_INSTANTIATE_TEST(StateChangeRenderTest,
 ANGLE_INSTANTIATE_TEST(StateChangeTestES3, ES3_D3D11(), ES3_OPENGL());
 
 ANGLE_INSTANTIATE_TEST(SimpleStateChangeTest, ES2_VULKAN(), ES2_OPENGL());
+ANGLE_INSTANTIATE_TEST(ValidationStateChangeTest, ES3_D3D11(), ES3_OPENGL(), ES3_OPENGLES());
@@ -269,6 +269,11 @@ void ANGLERenderTest::setRobustResourceInit(bool enabled)
     mEGLWindow->setRobustResourceInit(enabled);
 }
 
+void ANGLERenderTest::setNoErrorEnabled(bool noError)
+{
+    mEGLWindow->setNoErrorEnabled(noError);
+}
+
 // static
 EGLWindow *ANGLERenderTest::createEGLWindow(const RenderTestParams &testParams)
 {
@@ -107,6 +107,7 @@ class ANGLERenderTest : public ANGLEPerfTest
 
     void setWebGLCompatibilityEnabled(bool webglCompatibility);
     void setRobustResourceInit(bool enabled);
+    void setNoErrorEnabled(bool noError);
 
   private:
     void SetUp() override;
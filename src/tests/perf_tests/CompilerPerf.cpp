@@ -8,13 +8,28 @@
 //   compiles the same shader repeatedly. There are different variations of the tests using
 //   different shaders.
 //
+// CompilerInitPerfTest:
+//   Performance test for the latency of the first compile. Each iteration constructs and
+//   initializes a new compiler, which sets up its built-in symbols, and compiles one shader with it.
+//
+// CompilerThreadedPerfTest:
+//   Performance test for the throughput of compiling on several threads. Each iteration compiles
+//   the same number of shaders, split between threads that each have a compiler of their own, so
+//   the variations with more threads show how well the translator scales.
+//
+// The translation cache is disabled in all tests, so that every compile runs the translator.
+//
 
 #include "ANGLEPerfTest.h"
 
+#include <sstream>
+#include <thread>
+
 #include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
 #include "compiler/translator/PoolAlloc.h"
+#include "compiler/translator/TranslationCache.h"
 
 namespace
 {
@@ -215,6 +230,7 @@ void CompilerPerfTest::SetUp()
     ANGLEPerfTest::SetUp();
 
     InitializePoolIndex();
+    sh::SetTranslationCacheMaxSize(0);
     mAllocator.push();
     SetGlobalPoolAllocator(&mAllocator);
 
@@ -238,6 +254,7 @@ void CompilerPerfTest::TearDown()
     SetGlobalPoolAllocator(nullptr);
     mAllocator.pop();
 
+    sh::SetTranslationCacheMaxSize(sh::kDefaultTranslationCacheMaxSize);
     FreePoolIndex();
 
     ANGLEPerfTest::TearDown();
@@ -289,4 +306,215 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
 
+class CompilerInitPerfTest : public ANGLEPerfTest,
+                             public ::testing::WithParamInterface<CompilerPerfParameters>
+{
+  public:
+    CompilerInitPerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    ShBuiltInResources mResources;
+    TPoolAllocator mAllocator;
+};
+
+CompilerInitPerfTest::CompilerInitPerfTest()
+    : ANGLEPerfTest("CompilerInitPerf", GetParam().testId)
+{
+}
+
+void CompilerInitPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    InitializePoolIndex();
+    sh::SetTranslationCacheMaxSize(0);
+    mAllocator.push();
+    SetGlobalPoolAllocator(&mAllocator);
+
+    sh::InitBuiltInResources(&mResources);
+    mResources.FragmentPrecisionHigh = true;
+}
+
+void CompilerInitPerfTest::TearDown()
+{
+    SetGlobalPoolAllocator(nullptr);
+    mAllocator.pop();
+
+    sh::SetTranslationCacheMaxSize(sh::kDefaultTranslationCacheMaxSize);
+    FreePoolIndex();
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CompilerInitPerfTest::step()
+{
+    const auto &params          = GetParam();
+    const char *shaderStrings[] = {params.shaderSource};
+
+    ShCompileOptions compileOptions = SH_OBJECT_CODE | SH_VARIABLES |
+                                      SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_INIT_OUTPUT_VARIABLES;
+
+    const int kNumIterationsPerStep = 10;
+
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        sh::TCompiler *translator =
+            sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL2_SPEC, params.output);
+        if (translator && translator->Init(mResources))
+        {
+            translator->compile(shaderStrings, 1, compileOptions);
+        }
+        SafeDelete(translator);
+    }
+}
+
+TEST_P(CompilerInitPerfTest, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(
+    CompilerInitPerfTest,
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id));
+
+struct CompilerThreadedPerfParameters final : public angle::CompilerParameters
+{
+    CompilerThreadedPerfParameters(ShShaderOutput output, size_t threadCount)
+        : angle::CompilerParameters(output), threadCount(threadCount)
+    {
+        std::stringstream strstr;
+        strstr << kTrickyESSL300Id << "_" << angle::CompilerParameters::str() << "_" << threadCount
+               << "_threads";
+        testId = strstr.str();
+    }
+
+    size_t threadCount;
+    std::string testId;
+};
+
+std::ostream &operator<<(std::ostream &stream, const CompilerThreadedPerfParameters &p)
+{
+    stream << p.testId;
+    return stream;
+}
+
+class CompilerThreadedPerfTest
+    : public ANGLEPerfTest,
+      public ::testing::WithParamInterface<CompilerThreadedPerfParameters>
+{
+  public:
+    CompilerThreadedPerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    // One compiler per thread.
+    std::vector<ShHandle> mCompilers;
+};
+
+CompilerThreadedPerfTest::CompilerThreadedPerfTest()
+    : ANGLEPerfTest("CompilerThreadedPerf", GetParam().testId)
+{
+}
+
+void CompilerThreadedPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    sh::Initialize();
+    sh::SetTranslationCacheMaxSize(0);
+
+    const auto &params = GetParam();
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    resources.FragmentPrecisionHigh = true;
+
+    for (size_t threadIndex = 0; threadIndex < params.threadCount; ++threadIndex)
+    {
+        ShHandle compiler =
+            sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL2_SPEC, params.output, &resources);
+        if (!compiler)
+        {
+            abortTest();
+            return;
+        }
+        mCompilers.push_back(compiler);
+    }
+}
+
+void CompilerThreadedPerfTest::TearDown()
+{
+    for (ShHandle compiler : mCompilers)
+    {
+        sh::Destruct(compiler);
+    }
+    mCompilers.clear();
+
+    sh::SetTranslationCacheMaxSize(sh::kDefaultTranslationCacheMaxSize);
+    sh::Finalize();
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CompilerThreadedPerfTest::step()
+{
+    const char *shaderStrings[] = {kTrickyESSL300FragSource};
+
+    ShCompileOptions compileOptions = SH_OBJECT_CODE | SH_VARIABLES |
+                                      SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_INIT_OUTPUT_VARIABLES;
+
+    // Divisible by all the thread counts.
+    const size_t kNumCompilesPerStep = 24;
+    const size_t threadCount         = mCompilers.size();
+
+    std::vector<std::thread> threads;
+    for (ShHandle compiler : mCompilers)
+    {
+        threads.emplace_back([compiler, &shaderStrings, compileOptions, threadCount]() {
+            for (size_t iteration = 0; iteration < kNumCompilesPerStep / threadCount; ++iteration)
+            {
+                sh::Compile(compiler, shaderStrings, 1, compileOptions);
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+TEST_P(CompilerThreadedPerfTest, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(CompilerThreadedPerfTest,
+                       CompilerThreadedPerfParameters(SH_HLSL_4_1_OUTPUT, 1),
+                       CompilerThreadedPerfParameters(SH_HLSL_4_1_OUTPUT, 2),
+                       CompilerThreadedPerfParameters(SH_HLSL_4_1_OUTPUT, 4),
+                       CompilerThreadedPerfParameters(SH_HLSL_4_1_OUTPUT, 8),
+                       CompilerThreadedPerfParameters(SH_GLSL_450_CORE_OUTPUT, 1),
+                       CompilerThreadedPerfParameters(SH_GLSL_450_CORE_OUTPUT, 2),
+                       CompilerThreadedPerfParameters(SH_GLSL_450_CORE_OUTPUT, 4),
+                       CompilerThreadedPerfParameters(SH_GLSL_450_CORE_OUTPUT, 8),
+                       CompilerThreadedPerfParameters(SH_ESSL_OUTPUT, 1),
+                       CompilerThreadedPerfParameters(SH_ESSL_OUTPUT, 2),
+                       CompilerThreadedPerfParameters(SH_ESSL_OUTPUT, 4),
+                       CompilerThreadedPerfParameters(SH_ESSL_OUTPUT, 8));
+
 }  // anonymous namespace
@@ -21,6 +21,9 @@ struct DrawArraysPerfParams : public DrawCallPerfParams
     std::string suffix() const override;
 
     bool changeVertexBuffer = false;
+
+    // Skips validation, to compare against the cost of validating each draw.
+    bool noError = false;
 };
 
 std::string DrawArraysPerfParams::suffix() const
@@ -34,6 +37,11 @@ std::string DrawArraysPerfParams::suffix() const
         strstr << "_vbo_change";
     }
 
+    if (noError)
+    {
+        strstr << "_no_error";
+    }
+
     return strstr.str();
 }
 
@@ -65,6 +73,7 @@ class DrawCallPerfBenchmark : public ANGLERenderTest,
 DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf", GetParam())
 {
     mRunTimeSeconds = GetParam().runTimeSeconds;
+    setNoErrorEnabled(GetParam().noError);
 }
 
 void DrawCallPerfBenchmark::initializeBenchmark()
@@ -178,6 +187,13 @@ DrawArraysPerfParams DrawArrays(const DrawCallPerfParams &base, bool withBufferC
     return params;
 }
 
+DrawArraysPerfParams DrawArraysNoError(const DrawCallPerfParams &base)
+{
+    DrawArraysPerfParams params(base);
+    params.noError = true;
+    return params;
+}
+
 ANGLE_INSTANTIATE_TEST(DrawCallPerfBenchmark,
                        DrawArrays(DrawCallPerfD3D9Params(false, false), false),
                        DrawArrays(DrawCallPerfD3D9Params(true, false), false),
@@ -187,6 +203,8 @@ ANGLE_INSTANTIATE_TEST(DrawCallPerfBenchmark,
                        DrawArrays(DrawCallPerfOpenGLOrGLESParams(false, false), false),
                        DrawArrays(DrawCallPerfOpenGLOrGLESParams(true, false), false),
                        DrawArrays(DrawCallPerfOpenGLOrGLESParams(true, true), false),
+                       DrawArraysNoError(DrawCallPerfD3D11Params(true, false)),
+                       DrawArraysNoError(DrawCallPerfOpenGLOrGLESParams(true, false)),
                        DrawArrays(DrawCallPerfValidationOnly(), false),
                        DrawArrays(DrawCallPerfVulkanParams(false), false),
                        DrawArrays(DrawCallPerfVulkanParams(false), true));
@@ -0,0 +1,192 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EntryPointPerf:
+//   Performance test for the per-call overhead of the GL entry points. Uses calls that do very
+//   little work, so that most of the time is spent getting the current context and validating.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+
+enum class EntryPointCall
+{
+    Uniform1f,
+    BindBuffer,
+};
+
+struct EntryPointParams final : public RenderTestParams
+{
+    EntryPointParams()
+    {
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+    }
+
+    std::string suffix() const override
+    {
+        std::stringstream strstr;
+        strstr << RenderTestParams::suffix();
+
+        switch (call)
+        {
+            case EntryPointCall::Uniform1f:
+                strstr << "_uniform1f";
+                break;
+            case EntryPointCall::BindBuffer:
+                strstr << "_bind_buffer";
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+
+        if (noError)
+        {
+            strstr << "_no_error";
+        }
+
+        return strstr.str();
+    }
+
+    EntryPointCall call = EntryPointCall::Uniform1f;
+    bool noError        = false;
+
+    // Calls per step. Large enough that the loop itself doesn't show up.
+    unsigned int iterations = 10000;
+};
+
+std::ostream &operator<<(std::ostream &os, const EntryPointParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+class EntryPointPerf : public ANGLERenderTest,
+                       public ::testing::WithParamInterface<EntryPointParams>
+{
+  public:
+    EntryPointPerf() : ANGLERenderTest("EntryPointPerf", GetParam())
+    {
+        setNoErrorEnabled(GetParam().noError);
+    }
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram        = 0;
+    GLint mUniformLocation = -1;
+    GLuint mBuffers[2]     = {};
+};
+
+void EntryPointPerf::initializeBenchmark()
+{
+    const std::string vs =
+        "attribute vec4 position;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_Position = position;\n"
+        "}\n";
+
+    const std::string fs =
+        "precision mediump float;\n"
+        "uniform float value;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor = vec4(value);\n"
+        "}\n";
+
+    mProgram = CompileProgram(vs, fs);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    mUniformLocation = glGetUniformLocation(mProgram, "value");
+    ASSERT_NE(-1, mUniformLocation);
+
+    glGenBuffers(2, mBuffers);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void EntryPointPerf::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+    glDeleteBuffers(2, mBuffers);
+}
+
+void EntryPointPerf::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    switch (params.call)
+    {
+        case EntryPointCall::Uniform1f:
+            for (unsigned int iteration = 0; iteration < params.iterations; ++iteration)
+            {
+                glUniform1f(mUniformLocation, static_cast<GLfloat>(iteration & 1));
+            }
+            break;
+        case EntryPointCall::BindBuffer:
+            for (unsigned int iteration = 0; iteration < params.iterations; ++iteration)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, mBuffers[iteration & 1]);
+            }
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+EntryPointParams EntryPoint(const EGLPlatformParameters &eglParameters,
+                            EntryPointCall call,
+                            bool noError)
+{
+    EntryPointParams params;
+    params.eglParameters = eglParameters;
+    params.call          = call;
+    params.noError       = noError;
+    return params;
+}
+
+TEST_P(EntryPointPerf, Run)
+{
+    run();
+}
+
+// The null back-ends keep the driver out of the measurement.
+ANGLE_INSTANTIATE_TEST(EntryPointPerf,
+                       EntryPoint(egl_platform::D3D11_NULL(), EntryPointCall::Uniform1f, false),
+                       EntryPoint(egl_platform::D3D11_NULL(), EntryPointCall::Uniform1f, true),
+                       EntryPoint(egl_platform::D3D11_NULL(), EntryPointCall::BindBuffer, false),
+                       EntryPoint(egl_platform::D3D11_NULL(), EntryPointCall::BindBuffer, true),
+                       EntryPoint(egl_platform::OPENGL_OR_GLES(true),
+                                  EntryPointCall::Uniform1f,
+                                  false),
+                       EntryPoint(egl_platform::OPENGL_OR_GLES(true),
+                                  EntryPointCall::Uniform1f,
+                                  true),
+                       EntryPoint(egl_platform::OPENGL_OR_GLES(true),
+                                  EntryPointCall::BindBuffer,
+                                  false),
+                       EntryPoint(egl_platform::OPENGL_OR_GLES(true),
+                                  EntryPointCall::BindBuffer,
+                                  true));
+
+}  // anonymous namespace
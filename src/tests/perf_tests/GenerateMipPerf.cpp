@@ -0,0 +1,181 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GenerateMipPerf:
+//   Performance tests for the software generation of mip chains, which is used when the backend
+//   can't generate the mips of a format on the GPU. Reports the time to generate the whole chain
+//   of each format.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+#include <sstream>
+
+#include "image_util/generatemip.h"
+#include "image_util/imageformats.h"
+
+namespace
+{
+
+using MipGenerationFunction = void (*)(size_t sourceWidth,
+                                       size_t sourceHeight,
+                                       size_t sourceDepth,
+                                       const uint8_t *sourceData,
+                                       size_t sourceRowPitch,
+                                       size_t sourceDepthPitch,
+                                       uint8_t *destData,
+                                       size_t destRowPitch,
+                                       size_t destDepthPitch);
+
+struct GenerateMipPerfParams final
+{
+    std::string suffix() const
+    {
+        std::stringstream strstr;
+        strstr << "_" << formatName << "_" << size;
+        if (depth > 1)
+        {
+            strstr << "x" << depth;
+        }
+        return strstr.str();
+    }
+
+    const char *formatName;
+    MipGenerationFunction mipGenerationFunction;
+    size_t pixelBytes;
+    size_t size;
+    size_t depth;
+};
+
+std::ostream &operator<<(std::ostream &stream, const GenerateMipPerfParams &param)
+{
+    stream << param.suffix().substr(1);
+    return stream;
+}
+
+class GenerateMipPerfTest : public ANGLEPerfTest,
+                            public ::testing::WithParamInterface<GenerateMipPerfParams>
+{
+  public:
+    GenerateMipPerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  protected:
+    struct Level
+    {
+        size_t width;
+        size_t height;
+        size_t depth;
+        std::vector<uint8_t> data;
+    };
+
+    std::vector<Level> mLevels;
+};
+
+GenerateMipPerfTest::GenerateMipPerfTest()
+    : ANGLEPerfTest("GenerateMipPerf", GetParam().suffix())
+{
+}
+
+void GenerateMipPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    const auto &params = GetParam();
+
+    size_t width  = params.size;
+    size_t height = params.size;
+    size_t depth  = params.depth;
+    while (true)
+    {
+        Level level;
+        level.width  = width;
+        level.height = height;
+        level.depth  = depth;
+        level.data.resize(width * height * depth * params.pixelBytes);
+        mLevels.push_back(std::move(level));
+
+        if (width == 1 && height == 1 && depth == 1)
+        {
+            break;
+        }
+        width  = std::max<size_t>(1, width / 2);
+        height = std::max<size_t>(1, height / 2);
+        depth  = std::max<size_t>(1, depth / 2);
+    }
+
+    // Half floats with random bits are mostly normal numbers, like most 16F textures.
+    std::mt19937 generator(0);
+    for (uint8_t &byte : mLevels[0].data)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+}
+
+void GenerateMipPerfTest::TearDown()
+{
+    if (!mSkipTest)
+    {
+        printResult("mip_chain_time",
+                    mTimer->getElapsedTime() * 1000.0 / static_cast<double>(getNumStepsPerformed()),
+                    "ms", true);
+    }
+    ANGLEPerfTest::TearDown();
+}
+
+void GenerateMipPerfTest::step()
+{
+    const auto &params = GetParam();
+    for (size_t levelIndex = 1; levelIndex < mLevels.size(); levelIndex++)
+    {
+        const Level &source = mLevels[levelIndex - 1];
+        Level &dest         = mLevels[levelIndex];
+
+        size_t sourceRowPitch = source.width * params.pixelBytes;
+        size_t destRowPitch   = dest.width * params.pixelBytes;
+        params.mipGenerationFunction(source.width, source.height, source.depth, source.data.data(),
+                                     sourceRowPitch, sourceRowPitch * source.height,
+                                     dest.data.data(), destRowPitch, destRowPitch * dest.height);
+    }
+}
+
+template <typename T>
+GenerateMipPerfParams GenerateMipParams(const char *formatName, size_t size, size_t depth)
+{
+    GenerateMipPerfParams params;
+    params.formatName            = formatName;
+    params.mipGenerationFunction = angle::GenerateMip<T>;
+    params.pixelBytes            = sizeof(T);
+    params.size                  = size;
+    params.depth                 = depth;
+    return params;
+}
+
+TEST_P(GenerateMipPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(
+    ,
+    GenerateMipPerfTest,
+    ::testing::Values(GenerateMipParams<angle::R8G8B8A8>("rgba8", 256, 1),
+                      GenerateMipParams<angle::R8G8B8A8>("rgba8", 2048, 1),
+                      GenerateMipParams<angle::R8G8B8A8>("rgba8", 128, 128),
+                      GenerateMipParams<angle::B8G8R8A8>("bgra8", 2048, 1),
+                      GenerateMipParams<angle::R8G8B8A8SRGB>("srgba8", 2048, 1),
+                      GenerateMipParams<angle::R8G8>("rg8", 2048, 1),
+                      GenerateMipParams<angle::R8>("r8", 2048, 1),
+                      GenerateMipParams<angle::R16G16B16A16F>("rgba16f", 256, 1),
+                      GenerateMipParams<angle::R16G16B16A16F>("rgba16f", 2048, 1),
+                      GenerateMipParams<angle::R16G16F>("rg16f", 2048, 1),
+                      GenerateMipParams<angle::R16F>("r16f", 2048, 1),
+                      GenerateMipParams<angle::R32G32B32A32F>("rgba32f", 2048, 1)));
+
+}  // anonymous namespace
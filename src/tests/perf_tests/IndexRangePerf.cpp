@@ -0,0 +1,237 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangePerf:
+//   Performance tests for computing the range of client-side index data. Compares
+//   gl::ComputeIndexRange against a plain scalar loop.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "common/utilities.h"
+
+namespace
+{
+
+struct IndexRangePerfParams final
+{
+    std::string suffix() const
+    {
+        std::stringstream strstr;
+
+        switch (indexType)
+        {
+            case GL_UNSIGNED_BYTE:
+                strstr << "_ubyte";
+                break;
+            case GL_UNSIGNED_SHORT:
+                strstr << "_ushort";
+                break;
+            case GL_UNSIGNED_INT:
+                strstr << "_uint";
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+
+        if (primitiveRestart)
+        {
+            strstr << "_restart";
+        }
+
+        if (scalar)
+        {
+            strstr << "_scalar";
+        }
+
+        return strstr.str();
+    }
+
+    GLenum indexType;
+    bool primitiveRestart;
+    bool scalar;
+    size_t indexCount;
+};
+
+std::ostream &operator<<(std::ostream &stream, const IndexRangePerfParams &param)
+{
+    stream << param.suffix().substr(1);
+    return stream;
+}
+
+// Reference loop matching the historical one-index-at-a-time implementation.
+template <typename IndexType>
+gl::IndexRange ComputeScalarIndexRange(const IndexType *indices,
+                                       size_t count,
+                                       bool primitiveRestartEnabled)
+{
+    const IndexType restartIndex = std::numeric_limits<IndexType>::max();
+
+    IndexType minIndex = std::numeric_limits<IndexType>::max();
+    IndexType maxIndex = 0;
+    size_t vertexCount = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (primitiveRestartEnabled && indices[i] == restartIndex)
+        {
+            continue;
+        }
+        minIndex = std::min(minIndex, indices[i]);
+        maxIndex = std::max(maxIndex, indices[i]);
+        vertexCount++;
+    }
+
+    if (vertexCount == 0)
+    {
+        return gl::IndexRange();
+    }
+
+    return gl::IndexRange(minIndex, maxIndex, vertexCount);
+}
+
+class IndexRangePerfTest : public ANGLEPerfTest,
+                           public ::testing::WithParamInterface<IndexRangePerfParams>
+{
+  public:
+    IndexRangePerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+    size_t vertexIndexCount() const { return mVertexIndexCount; }
+
+  private:
+    template <typename IndexType>
+    void fillIndices();
+
+    std::vector<uint8_t> mIndexData;
+    size_t mVertexIndexCount;
+};
+
+IndexRangePerfTest::IndexRangePerfTest()
+    : ANGLEPerfTest("IndexRangePerf", GetParam().suffix()), mVertexIndexCount(0)
+{
+    mRunTimeSeconds = 3.0;
+}
+
+template <typename IndexType>
+void IndexRangePerfTest::fillIndices()
+{
+    const auto &params = GetParam();
+
+    mIndexData.resize(params.indexCount * sizeof(IndexType));
+    IndexType *indices = reinterpret_cast<IndexType *>(mIndexData.data());
+
+    // Emulate a triangle strip mesh split into strips of 64 indices with restart indices.
+    const IndexType maxValue = std::numeric_limits<IndexType>::max() - 1;
+    for (size_t i = 0; i < params.indexCount; i++)
+    {
+        if (i % 64 == 63)
+        {
+            indices[i] = std::numeric_limits<IndexType>::max();
+        }
+        else
+        {
+            indices[i] = static_cast<IndexType>((i * 31) % maxValue);
+        }
+    }
+}
+
+void IndexRangePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    switch (GetParam().indexType)
+    {
+        case GL_UNSIGNED_BYTE:
+            fillIndices<GLubyte>();
+            break;
+        case GL_UNSIGNED_SHORT:
+            fillIndices<GLushort>();
+            break;
+        case GL_UNSIGNED_INT:
+            fillIndices<GLuint>();
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
+void IndexRangePerfTest::step()
+{
+    const auto &params = GetParam();
+    gl::IndexRange range;
+
+    if (params.scalar)
+    {
+        switch (params.indexType)
+        {
+            case GL_UNSIGNED_BYTE:
+                range =
+                    ComputeScalarIndexRange(reinterpret_cast<const GLubyte *>(mIndexData.data()),
+                                            params.indexCount, params.primitiveRestart);
+                break;
+            case GL_UNSIGNED_SHORT:
+                range =
+                    ComputeScalarIndexRange(reinterpret_cast<const GLushort *>(mIndexData.data()),
+                                            params.indexCount, params.primitiveRestart);
+                break;
+            case GL_UNSIGNED_INT:
+                range =
+                    ComputeScalarIndexRange(reinterpret_cast<const GLuint *>(mIndexData.data()),
+                                            params.indexCount, params.primitiveRestart);
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+    }
+    else
+    {
+        range = gl::ComputeIndexRange(params.indexType, mIndexData.data(), params.indexCount,
+                                      params.primitiveRestart);
+    }
+
+    // Keep the result alive so the computation can't be optimized away.
+    mVertexIndexCount += range.vertexIndexCount;
+}
+
+IndexRangePerfParams IndexRangeParams(GLenum indexType, bool primitiveRestart, bool scalar)
+{
+    IndexRangePerfParams params;
+    params.indexType        = indexType;
+    params.primitiveRestart = primitiveRestart;
+    params.scalar           = scalar;
+    params.indexCount       = 1024 * 1024;
+    return params;
+}
+
+TEST_P(IndexRangePerfTest, Run)
+{
+    run();
+    EXPECT_LT(0u, vertexIndexCount());
+}
+
+INSTANTIATE_TEST_CASE_P(,
+                        IndexRangePerfTest,
+                        ::testing::Values(IndexRangeParams(GL_UNSIGNED_BYTE, false, false),
+                                          IndexRangeParams(GL_UNSIGNED_BYTE, false, true),
+                                          IndexRangeParams(GL_UNSIGNED_BYTE, true, false),
+                                          IndexRangeParams(GL_UNSIGNED_BYTE, true, true),
+                                          IndexRangeParams(GL_UNSIGNED_SHORT, false, false),
+                                          IndexRangeParams(GL_UNSIGNED_SHORT, false, true),
+                                          IndexRangeParams(GL_UNSIGNED_SHORT, true, false),
+                                          IndexRangeParams(GL_UNSIGNED_SHORT, true, true),
+                                          IndexRangeParams(GL_UNSIGNED_INT, false, false),
+                                          IndexRangeParams(GL_UNSIGNED_INT, false, true),
+                                          IndexRangeParams(GL_UNSIGNED_INT, true, false),
+                                          IndexRangeParams(GL_UNSIGNED_INT, true, true)));
+
+}  // anonymous namespace
@@ -0,0 +1,150 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// LoadImageETCPerf:
+//   Performance tests for the software decoding of ETC and EAC textures, which is used when the
+//   backend doesn't support them natively. Reports the throughput of each format in MB/s of
+//   decoded texels.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+#include <sstream>
+
+#include "image_util/loadimage.h"
+
+namespace
+{
+
+using LoadFunction = void (*)(size_t width,
+                              size_t height,
+                              size_t depth,
+                              const uint8_t *input,
+                              size_t inputRowPitch,
+                              size_t inputDepthPitch,
+                              uint8_t *output,
+                              size_t outputRowPitch,
+                              size_t outputDepthPitch);
+
+struct LoadImageETCPerfParams final
+{
+    std::string suffix() const
+    {
+        std::stringstream strstr;
+        strstr << "_" << formatName << "_" << size;
+        return strstr.str();
+    }
+
+    const char *formatName;
+    LoadFunction loadFunction;
+    size_t blockSize;
+    size_t outputPixelBytes;
+    size_t size;
+};
+
+std::ostream &operator<<(std::ostream &stream, const LoadImageETCPerfParams &param)
+{
+    stream << param.suffix().substr(1);
+    return stream;
+}
+
+class LoadImageETCPerfTest : public ANGLEPerfTest,
+                             public ::testing::WithParamInterface<LoadImageETCPerfParams>
+{
+  public:
+    LoadImageETCPerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  protected:
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+    size_t mInputRowPitch;
+    size_t mOutputRowPitch;
+};
+
+LoadImageETCPerfTest::LoadImageETCPerfTest()
+    : ANGLEPerfTest("LoadImageETCPerf", GetParam().suffix()), mInputRowPitch(0), mOutputRowPitch(0)
+{
+}
+
+void LoadImageETCPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    const auto &params = GetParam();
+
+    // Random blocks use all of the modes of the formats.
+    size_t blocksPerRow = (params.size + 3) / 4;
+    mInputRowPitch      = blocksPerRow * params.blockSize;
+    mInput.resize(mInputRowPitch * blocksPerRow);
+    std::mt19937 generator(0);
+    for (uint8_t &byte : mInput)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+
+    mOutputRowPitch = params.size * params.outputPixelBytes;
+    mOutput.resize(mOutputRowPitch * params.size);
+}
+
+void LoadImageETCPerfTest::TearDown()
+{
+    if (!mSkipTest)
+    {
+        double decodedMegabytes =
+            static_cast<double>(mOutput.size() * getNumStepsPerformed()) / (1024.0 * 1024.0);
+        printResult("decode_rate", decodedMegabytes / mTimer->getElapsedTime(), "MB/s", true);
+    }
+    ANGLEPerfTest::TearDown();
+}
+
+void LoadImageETCPerfTest::step()
+{
+    const auto &params = GetParam();
+    params.loadFunction(params.size, params.size, 1, mInput.data(), mInputRowPitch, mInput.size(),
+                        mOutput.data(), mOutputRowPitch, mOutput.size());
+}
+
+LoadImageETCPerfParams LoadImageETCParams(const char *formatName,
+                                          LoadFunction loadFunction,
+                                          size_t blockSize,
+                                          size_t outputPixelBytes,
+                                          size_t size)
+{
+    LoadImageETCPerfParams params;
+    params.formatName       = formatName;
+    params.loadFunction     = loadFunction;
+    params.blockSize        = blockSize;
+    params.outputPixelBytes = outputPixelBytes;
+    params.size             = size;
+    return params;
+}
+
+TEST_P(LoadImageETCPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(
+    ,
+    LoadImageETCPerfTest,
+    ::testing::Values(
+        LoadImageETCParams("etc1_rgb8", angle::LoadETC1RGB8ToRGBA8, 8, 4, 256),
+        LoadImageETCParams("etc1_rgb8", angle::LoadETC1RGB8ToRGBA8, 8, 4, 2048),
+        LoadImageETCParams("etc2_rgb8", angle::LoadETC2RGB8ToRGBA8, 8, 4, 2048),
+        LoadImageETCParams("etc2_rgb8a1", angle::LoadETC2RGB8A1ToRGBA8, 8, 4, 2048),
+        LoadImageETCParams("etc2_rgba8", angle::LoadETC2RGBA8ToRGBA8, 16, 4, 256),
+        LoadImageETCParams("etc2_rgba8", angle::LoadETC2RGBA8ToRGBA8, 16, 4, 2048),
+        LoadImageETCParams("eac_r11_to_r8", angle::LoadEACR11ToR8, 8, 1, 2048),
+        LoadImageETCParams("eac_r11_to_r16", angle::LoadEACR11ToR16, 8, 2, 2048),
+        LoadImageETCParams("eac_rg11_to_rg8", angle::LoadEACRG11ToRG8, 16, 2, 2048),
+        LoadImageETCParams("eac_rg11_to_rg16", angle::LoadEACRG11ToRG16, 16, 4, 2048),
+        LoadImageETCParams("eac_signed_r11_to_r16", angle::LoadEACR11SToR16, 8, 2, 2048)));
+
+}  // anonymous namespace
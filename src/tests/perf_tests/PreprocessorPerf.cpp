@@ -0,0 +1,200 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PreprocessorPerf:
+//   Performance tests for the throughput of the shader preprocessor. The shaders are generated to
+//   resemble the output of material systems, which define thousands of macros.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "compiler/preprocessor/DiagnosticsBase.h"
+#include "compiler/preprocessor/DirectiveHandlerBase.h"
+#include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
+
+namespace
+{
+
+enum class MacroUse
+{
+    // The shader doesn't define any macros, which measures the throughput of the tokenizer.
+    NoMacros,
+    ObjectLikeMacros,
+    FunctionLikeMacros,
+};
+
+struct PreprocessorPerfParams final
+{
+    std::string suffix() const
+    {
+        std::stringstream strstr;
+        switch (macroUse)
+        {
+            case MacroUse::NoMacros:
+                strstr << "_no_macros";
+                break;
+            case MacroUse::ObjectLikeMacros:
+                strstr << "_object_macros";
+                break;
+            case MacroUse::FunctionLikeMacros:
+                strstr << "_function_macros";
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+        strstr << "_" << macroCount;
+        return strstr.str();
+    }
+
+    MacroUse macroUse;
+    int macroCount;
+};
+
+std::ostream &operator<<(std::ostream &stream, const PreprocessorPerfParams &param)
+{
+    stream << param.suffix().substr(1);
+    return stream;
+}
+
+class NullDiagnostics : public pp::Diagnostics
+{
+  public:
+    void print(ID id, const pp::SourceLocation &loc, const std::string &text) override {}
+};
+
+class NullDirectiveHandler : public pp::DirectiveHandler
+{
+  public:
+    void handleError(const pp::SourceLocation &loc, const std::string &msg) override {}
+    void handlePragma(const pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {
+    }
+    void handleExtension(const pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {
+    }
+    void handleVersion(const pp::SourceLocation &loc, int version) override {}
+};
+
+class PreprocessorPerfTest : public ANGLEPerfTest,
+                             public ::testing::WithParamInterface<PreprocessorPerfParams>
+{
+  public:
+    PreprocessorPerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  protected:
+    std::string mSource;
+    size_t mTokenCount;
+};
+
+PreprocessorPerfTest::PreprocessorPerfTest()
+    : ANGLEPerfTest("PreprocessorPerf", GetParam().suffix()), mTokenCount(0)
+{
+}
+
+void PreprocessorPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    const auto &params = GetParam();
+
+    // The function-like macros use an object-like macro both in their replacement list and in an
+    // argument, so that the expansion of arguments is measured too.
+    std::stringstream source;
+    source << "precision mediump float;\n";
+    source << "uniform vec4 u_materialScale;\n";
+    for (int index = 0; index < params.macroCount; ++index)
+    {
+        if (params.macroUse != MacroUse::NoMacros)
+        {
+            source << "#define MATERIAL_PARAMETER_" << index << " (" << index
+                   << ".0 * 0.5 + u_materialScale.x)\n";
+        }
+        if (params.macroUse == MacroUse::FunctionLikeMacros)
+        {
+            source << "#define MATERIAL_BLEND_" << index << "(a, b) mix(a, b, MATERIAL_PARAMETER_"
+                   << index << ")\n";
+        }
+    }
+    source << "void main()\n{\n    float value = 0.0;\n";
+    for (int index = 0; index < params.macroCount; ++index)
+    {
+        switch (params.macroUse)
+        {
+            case MacroUse::NoMacros:
+                source << "    value += (" << index << ".0 * 0.5 + u_materialScale.x);\n";
+                break;
+            case MacroUse::ObjectLikeMacros:
+                source << "    value += MATERIAL_PARAMETER_" << index << ";\n";
+                break;
+            case MacroUse::FunctionLikeMacros:
+                source << "    value = MATERIAL_BLEND_" << index << "(value, MATERIAL_PARAMETER_"
+                       << (params.macroCount - 1 - index) << ");\n";
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+    }
+    source << "    gl_FragColor = vec4(value);\n}\n";
+    mSource = source.str();
+}
+
+void PreprocessorPerfTest::step()
+{
+    NullDiagnostics diagnostics;
+    NullDirectiveHandler directiveHandler;
+    pp::Preprocessor preprocessor(&diagnostics, &directiveHandler, pp::PreprocessorSettings());
+
+    const char *shaderStrings[] = {mSource.c_str()};
+    if (!preprocessor.init(1, shaderStrings, nullptr))
+    {
+        abortTest();
+        return;
+    }
+
+    pp::Token token;
+    do
+    {
+        preprocessor.lex(&token);
+        ++mTokenCount;
+    } while (token.type != pp::Token::LAST);
+}
+
+PreprocessorPerfParams PreprocessorParams(MacroUse macroUse, int macroCount)
+{
+    PreprocessorPerfParams params;
+    params.macroUse   = macroUse;
+    params.macroCount = macroCount;
+    return params;
+}
+
+TEST_P(PreprocessorPerfTest, Run)
+{
+    run();
+    EXPECT_LT(0u, mTokenCount);
+}
+
+INSTANTIATE_TEST_CASE_P(,
+                        PreprocessorPerfTest,
+                        ::testing::Values(PreprocessorParams(MacroUse::NoMacros, 100),
+                                          PreprocessorParams(MacroUse::NoMacros, 2000),
+                                          PreprocessorParams(MacroUse::ObjectLikeMacros, 100),
+                                          PreprocessorParams(MacroUse::ObjectLikeMacros, 2000),
+                                          PreprocessorParams(MacroUse::FunctionLikeMacros, 100),
+                                          PreprocessorParams(MacroUse::FunctionLikeMacros, 2000)));
+
+}  // anonymous namespace
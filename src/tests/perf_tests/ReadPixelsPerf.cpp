@@ -0,0 +1,214 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ReadPixelsPerf:
+//   Performance tests for glReadPixels, including the cases where the framebuffer format has to
+//   be converted to the requested format and type on the CPU.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+namespace
+{
+
+struct ReadPixelsParams final : public RenderTestParams
+{
+    ReadPixelsParams()
+    {
+        majorVersion = 3;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+    }
+
+    std::string suffix() const override
+    {
+        std::stringstream strstr;
+        strstr << RenderTestParams::suffix();
+
+        switch (internalFormat)
+        {
+            case GL_NONE:
+                strstr << "_default_framebuffer";
+                break;
+            case GL_RGBA8:
+                strstr << "_rgba8";
+                break;
+            case GL_RGBA16F:
+                strstr << "_rgba16f";
+                break;
+            default:
+                strstr << "_0x" << std::hex << internalFormat << std::dec;
+                break;
+        }
+
+        switch (readFormat)
+        {
+            case GL_RGBA:
+                strstr << "_to_rgba";
+                break;
+            case GL_BGRA_EXT:
+                strstr << "_to_bgra";
+                break;
+            default:
+                strstr << "_to_0x" << std::hex << readFormat << std::dec;
+                break;
+        }
+
+        switch (readType)
+        {
+            case GL_UNSIGNED_BYTE:
+                strstr << "8";
+                break;
+            case GL_FLOAT:
+                strstr << "32f";
+                break;
+            default:
+                strstr << "_0x" << std::hex << readType << std::dec;
+                break;
+        }
+
+        return strstr.str();
+    }
+
+    // GL_NONE reads from the default framebuffer, which is BGRA on D3D11.
+    GLenum internalFormat   = GL_RGBA8;
+    GLenum readFormat       = GL_RGBA;
+    GLenum readType         = GL_UNSIGNED_BYTE;
+    unsigned int iterations = 4;
+};
+
+std::ostream &operator<<(std::ostream &os, const ReadPixelsParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+std::vector<std::string> GetReadPixelsExtensions(const ReadPixelsParams &params)
+{
+    std::vector<std::string> extensions;
+    if (params.internalFormat == GL_RGBA16F)
+    {
+        extensions.push_back("GL_EXT_color_buffer_float");
+    }
+    if (params.readFormat == GL_BGRA_EXT)
+    {
+        extensions.push_back("GL_EXT_read_format_bgra");
+    }
+    return extensions;
+}
+
+class ReadPixelsPerf : public ANGLERenderTest,
+                       public ::testing::WithParamInterface<ReadPixelsParams>
+{
+  public:
+    ReadPixelsPerf()
+        : ANGLERenderTest("ReadPixelsPerf", GetParam(), GetReadPixelsExtensions(GetParam()))
+    {
+    }
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mFramebuffer  = 0;
+    GLuint mRenderbuffer = 0;
+    GLsizei mWidth       = 0;
+    GLsizei mHeight      = 0;
+    std::vector<uint8_t> mPixels;
+};
+
+void ReadPixelsPerf::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    if (params.internalFormat == GL_NONE)
+    {
+        mWidth  = getWindow()->getWidth();
+        mHeight = getWindow()->getHeight();
+    }
+    else
+    {
+        // Large enough to be representative of a full screen capture.
+        mWidth  = 1920;
+        mHeight = 1080;
+
+        glGenRenderbuffers(1, &mRenderbuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, mRenderbuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, params.internalFormat, mWidth, mHeight);
+
+        glGenFramebuffers(1, &mFramebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+                                  mRenderbuffer);
+        ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+    }
+
+    size_t pixelBytes = (params.readType == GL_FLOAT ? 16 : 4);
+    mPixels.resize(mWidth * mHeight * pixelBytes);
+
+    glClearColor(0.25f, 0.5f, 0.75f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void ReadPixelsPerf::destroyBenchmark()
+{
+    glDeleteFramebuffers(1, &mFramebuffer);
+    glDeleteRenderbuffers(1, &mRenderbuffer);
+}
+
+void ReadPixelsPerf::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < params.iterations; ++iteration)
+    {
+        glReadPixels(0, 0, mWidth, mHeight, params.readFormat, params.readType, mPixels.data());
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+TEST_P(ReadPixelsPerf, Run)
+{
+    run();
+}
+
+ReadPixelsParams ReadPixels(const EGLPlatformParameters &eglParameters,
+                            GLenum internalFormat,
+                            GLenum readFormat,
+                            GLenum readType)
+{
+    ReadPixelsParams params;
+    params.eglParameters  = eglParameters;
+    params.internalFormat = internalFormat;
+    params.readFormat     = readFormat;
+    params.readType       = readType;
+
+    // The Vulkan back-end only exposes ES 2.0.
+    if (eglParameters.renderer == EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE)
+    {
+        params.majorVersion = 2;
+    }
+    return params;
+}
+
+}  // anonymous namespace
+
+using namespace angle::egl_platform;
+
+ANGLE_INSTANTIATE_TEST(ReadPixelsPerf,
+                       ReadPixels(D3D11(), GL_NONE, GL_RGBA, GL_UNSIGNED_BYTE),
+                       ReadPixels(D3D11(), GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE),
+                       ReadPixels(D3D11(), GL_RGBA8, GL_BGRA_EXT, GL_UNSIGNED_BYTE),
+                       ReadPixels(D3D11(), GL_RGBA16F, GL_RGBA, GL_FLOAT),
+                       ReadPixels(OPENGL_OR_GLES(false), GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE),
+                       ReadPixels(VULKAN(), GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE),
+                       ReadPixels(VULKAN(), GL_RGBA8, GL_BGRA_EXT, GL_UNSIGNED_BYTE));
@@ -4,10 +4,12 @@
 // found in the LICENSE file.
 //
 // VulkanPipelineCachePerf:
-//   Performance benchmark for the Vulkan Pipeline cache.
+//   Performance benchmark for the Vulkan Pipeline cache. Also measures the creation of pipelines
+//   with an empty VkPipelineCache, and with one that was restored from the data of a previous run.
 
 #include "ANGLEPerfTest.h"
 
+#include "common/mathutil.h"
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 #include "random_utils.h"
 
@@ -78,6 +80,7 @@ void VulkanPipelineCachePerfTest::randomizeDesc(vk::PipelineDesc *desc)
 
 void VulkanPipelineCachePerfTest::step()
 {
+    vk::PipelineCache pc;
     vk::RenderPass rp;
     vk::PipelineLayout pl;
     vk::ShaderModule sm;
@@ -88,7 +91,7 @@ void VulkanPipelineCachePerfTest::step()
     {
         for (const auto &hit : mCacheHits)
         {
-            (void)mCache.getPipeline(VK_NULL_HANDLE, rp, pl, am, sm, sm, hit, &result);
+            (void)mCache.getPipeline(VK_NULL_HANDLE, pc, rp, pl, am, sm, sm, hit, &result);
         }
     }
 
@@ -96,7 +99,7 @@ void VulkanPipelineCachePerfTest::step()
          ++missCount, ++mMissIndex)
     {
         const auto &miss = mCacheMisses[mMissIndex];
-        (void)mCache.getPipeline(VK_NULL_HANDLE, rp, pl, am, sm, sm, miss, &result);
+        (void)mCache.getPipeline(VK_NULL_HANDLE, pc, rp, pl, am, sm, sm, miss, &result);
     }
 }
 
@@ -106,3 +109,382 @@ TEST_F(VulkanPipelineCachePerfTest, Run)
 {
     run();
 }
+
+namespace
+{
+// Shaders assembled by hand, so that the test doesn't need a shader compiler. The vertex shader
+// writes a constant to gl_Position, which is changed to make every vertex shader different, so
+// that the driver can't share compiled shaders between the pipelines.
+const uint32_t kVertexShaderCode[] = {
+    // Magic number, version 1.0, generator, bound of the IDs and schema.
+    0x07230203, 0x00010000, 0x00000000, 11, 0,
+    // OpCapability Shader
+    0x00020011, 1,
+    // OpMemoryModel Logical GLSL450
+    0x0003000E, 0, 1,
+    // OpEntryPoint Vertex %1 "main" %7
+    0x0006000F, 0, 1, 0x6E69616D, 0x00000000, 7,
+    // OpDecorate %7 BuiltIn Position
+    0x00040047, 7, 11, 0,
+    // %2 = OpTypeVoid, %3 = OpTypeFunction %2
+    0x00020013, 2, 0x00030021, 3, 2,
+    // %4 = OpTypeFloat 32, %5 = OpTypeVector %4 4
+    0x00030016, 4, 32, 0x00040017, 5, 4, 4,
+    // %6 = OpTypePointer Output %5, %7 = OpVariable %6 Output
+    0x00040020, 6, 3, 5, 0x0004003B, 6, 7, 3,
+    // %8 = OpConstant %4 0.0, %9 = OpConstantComposite %5 %8 %8 %8 %8
+    0x0004002B, 4, 8, 0x00000000, 0x0007002C, 5, 9, 8, 8, 8, 8,
+    // %1 = OpFunction %2 None %3, %10 = OpLabel
+    0x00050036, 2, 1, 0, 3, 0x000200F8, 10,
+    // OpStore %7 %9, OpReturn, OpFunctionEnd
+    0x0003003E, 7, 9, 0x000100FD, 0x00010038,
+};
+
+// Index of the value of the OpConstant in kVertexShaderCode.
+constexpr size_t kVertexShaderConstantIndex = 43;
+
+const uint32_t kFragmentShaderCode[] = {
+    // Magic number, version 1.0, generator, bound of the IDs and schema.
+    0x07230203, 0x00010000, 0x00000000, 5, 0,
+    // OpCapability Shader
+    0x00020011, 1,
+    // OpMemoryModel Logical GLSL450
+    0x0003000E, 0, 1,
+    // OpEntryPoint Fragment %1 "main"
+    0x0005000F, 4, 1, 0x6E69616D, 0x00000000,
+    // OpExecutionMode %1 OriginUpperLeft
+    0x00030010, 1, 7,
+    // %2 = OpTypeVoid, %3 = OpTypeFunction %2
+    0x00020013, 2, 0x00030021, 3, 2,
+    // %1 = OpFunction %2 None %3, %4 = OpLabel
+    0x00050036, 2, 1, 0, 3, 0x000200F8, 4,
+    // OpReturn, OpFunctionEnd
+    0x000100FD, 0x00010038,
+};
+
+constexpr size_t kPipelineCount = 32;
+
+enum class PipelineCacheState
+{
+    // Every step creates the pipelines with an empty pipeline cache.
+    Cold,
+    // Every step creates the pipelines with a pipeline cache restored from the data of a cache
+    // that already created them, like the cache that RendererVk restores from the disk.
+    Warm,
+};
+
+std::ostream &operator<<(std::ostream &stream, PipelineCacheState state)
+{
+    stream << (state == PipelineCacheState::Cold ? "cold" : "warm");
+    return stream;
+}
+
+// Drivers that keep shader caches of their own make the cold results look warmer.
+class VulkanPipelineCreationPerfTest : public ANGLEPerfTest,
+                                       public ::testing::WithParamInterface<PipelineCacheState>
+{
+  public:
+    VulkanPipelineCreationPerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    vk::Error initDevice();
+    vk::Error initPipelineObjects();
+    vk::Error createPipelines(const std::vector<uint8_t> &initialData,
+                              std::vector<uint8_t> *cacheDataOut);
+
+    VkInstance mInstance;
+    VkDevice mDevice;
+    vk::RenderPass mRenderPass;
+    vk::PipelineLayout mPipelineLayout;
+    std::vector<vk::ShaderModule> mVertexModules;
+    vk::ShaderModule mFragmentModule;
+    std::vector<vk::PipelineDesc> mPipelineDescs;
+    std::vector<uint8_t> mWarmCacheData;
+};
+
+VulkanPipelineCreationPerfTest::VulkanPipelineCreationPerfTest()
+    : ANGLEPerfTest("VulkanPipelineCreationPerf",
+                    GetParam() == PipelineCacheState::Cold ? "_cold" : "_warm"),
+      mInstance(VK_NULL_HANDLE),
+      mDevice(VK_NULL_HANDLE)
+{
+}
+
+void VulkanPipelineCreationPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    vk::Error error = initDevice();
+    if (!error.isError())
+    {
+        error = initPipelineObjects();
+    }
+    if (!error.isError() && GetParam() == PipelineCacheState::Warm)
+    {
+        error = createPipelines(std::vector<uint8_t>(), &mWarmCacheData);
+    }
+
+    if (error.isError())
+    {
+        std::cout << "Test skipped due to Vulkan error: " << error.toString() << std::endl;
+        mSkipTest = true;
+    }
+}
+
+void VulkanPipelineCreationPerfTest::TearDown()
+{
+    if (!mSkipTest)
+    {
+        double pipelineCount = static_cast<double>(getNumStepsPerformed() * kPipelineCount);
+        printResult("pipeline_creation_time", mTimer->getElapsedTime() * 1000000.0 / pipelineCount,
+                    "us", true);
+    }
+
+    for (vk::ShaderModule &vertexModule : mVertexModules)
+    {
+        vertexModule.destroy(mDevice);
+    }
+    mFragmentModule.destroy(mDevice);
+    mPipelineLayout.destroy(mDevice);
+    mRenderPass.destroy(mDevice);
+
+    if (mDevice != VK_NULL_HANDLE)
+    {
+        vkDestroyDevice(mDevice, nullptr);
+        mDevice = VK_NULL_HANDLE;
+    }
+    if (mInstance != VK_NULL_HANDLE)
+    {
+        vkDestroyInstance(mInstance, nullptr);
+        mInstance = VK_NULL_HANDLE;
+    }
+
+    ANGLEPerfTest::TearDown();
+}
+
+void VulkanPipelineCreationPerfTest::step()
+{
+    vk::Error error = createPipelines(mWarmCacheData, nullptr);
+    if (error.isError())
+    {
+        std::cout << "Error creating the pipelines: " << error.toString() << std::endl;
+        abortTest();
+    }
+}
+
+vk::Error VulkanPipelineCreationPerfTest::initDevice()
+{
+    VkApplicationInfo applicationInfo;
+    applicationInfo.sType              = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.pNext              = nullptr;
+    applicationInfo.pApplicationName   = "VulkanPipelineCreationPerf";
+    applicationInfo.applicationVersion = 1;
+    applicationInfo.pEngineName        = "ANGLE";
+    applicationInfo.engineVersion      = 1;
+    applicationInfo.apiVersion         = VK_API_VERSION_1_0;
+
+    VkInstanceCreateInfo instanceInfo;
+    instanceInfo.sType                   = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceInfo.pNext                   = nullptr;
+    instanceInfo.flags                   = 0;
+    instanceInfo.pApplicationInfo        = &applicationInfo;
+    instanceInfo.enabledLayerCount       = 0;
+    instanceInfo.ppEnabledLayerNames     = nullptr;
+    instanceInfo.enabledExtensionCount   = 0;
+    instanceInfo.ppEnabledExtensionNames = nullptr;
+
+    ANGLE_VK_TRY(vkCreateInstance(&instanceInfo, nullptr, &mInstance));
+
+    uint32_t physicalDeviceCount = 1;
+    VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
+    VkResult result = vkEnumeratePhysicalDevices(mInstance, &physicalDeviceCount, &physicalDevice);
+    ANGLE_VK_CHECK(result == VK_SUCCESS || result == VK_INCOMPLETE, result);
+    ANGLE_VK_CHECK(physicalDeviceCount > 0, VK_ERROR_INITIALIZATION_FAILED);
+
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount,
+                                             queueFamilies.data());
+
+    uint32_t graphicsQueueFamily = 0;
+    while (graphicsQueueFamily < queueFamilyCount &&
+           (queueFamilies[graphicsQueueFamily].queueFlags & VK_QUEUE_GRAPHICS_BIT) == 0)
+    {
+        graphicsQueueFamily++;
+    }
+    ANGLE_VK_CHECK(graphicsQueueFamily < queueFamilyCount, VK_ERROR_INITIALIZATION_FAILED);
+
+    float queuePriority = 1.0f;
+
+    VkDeviceQueueCreateInfo queueCreateInfo;
+    queueCreateInfo.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.pNext            = nullptr;
+    queueCreateInfo.flags            = 0;
+    queueCreateInfo.queueFamilyIndex = graphicsQueueFamily;
+    queueCreateInfo.queueCount       = 1;
+    queueCreateInfo.pQueuePriorities = &queuePriority;
+
+    VkDeviceCreateInfo deviceInfo;
+    deviceInfo.sType                   = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceInfo.pNext                   = nullptr;
+    deviceInfo.flags                   = 0;
+    deviceInfo.queueCreateInfoCount    = 1;
+    deviceInfo.pQueueCreateInfos       = &queueCreateInfo;
+    deviceInfo.enabledLayerCount       = 0;
+    deviceInfo.ppEnabledLayerNames     = nullptr;
+    deviceInfo.enabledExtensionCount   = 0;
+    deviceInfo.ppEnabledExtensionNames = nullptr;
+    deviceInfo.pEnabledFeatures        = nullptr;
+
+    ANGLE_VK_TRY(vkCreateDevice(physicalDevice, &deviceInfo, nullptr, &mDevice));
+    return vk::NoError();
+}
+
+vk::Error VulkanPipelineCreationPerfTest::initPipelineObjects()
+{
+    // PipelineDesc::initDefaults enables blending state for one color attachment.
+    VkAttachmentDescription colorAttachment;
+    colorAttachment.flags          = 0;
+    colorAttachment.format         = VK_FORMAT_R8G8B8A8_UNORM;
+    colorAttachment.samples        = VK_SAMPLE_COUNT_1_BIT;
+    colorAttachment.loadOp         = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    colorAttachment.storeOp        = VK_ATTACHMENT_STORE_OP_STORE;
+    colorAttachment.stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    colorAttachment.initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
+    colorAttachment.finalLayout    = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentReference colorReference;
+    colorReference.attachment = 0;
+    colorReference.layout     = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkSubpassDescription subpass;
+    subpass.flags                   = 0;
+    subpass.pipelineBindPoint       = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.inputAttachmentCount    = 0;
+    subpass.pInputAttachments       = nullptr;
+    subpass.colorAttachmentCount    = 1;
+    subpass.pColorAttachments       = &colorReference;
+    subpass.pResolveAttachments     = nullptr;
+    subpass.pDepthStencilAttachment = nullptr;
+    subpass.preserveAttachmentCount = 0;
+    subpass.pPreserveAttachments    = nullptr;
+
+    VkRenderPassCreateInfo renderPassInfo;
+    renderPassInfo.sType           = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.pNext           = nullptr;
+    renderPassInfo.flags           = 0;
+    renderPassInfo.attachmentCount = 1;
+    renderPassInfo.pAttachments    = &colorAttachment;
+    renderPassInfo.subpassCount    = 1;
+    renderPassInfo.pSubpasses      = &subpass;
+    renderPassInfo.dependencyCount = 0;
+    renderPassInfo.pDependencies   = nullptr;
+
+    ANGLE_TRY(mRenderPass.init(mDevice, renderPassInfo));
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo;
+    pipelineLayoutInfo.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.pNext                  = nullptr;
+    pipelineLayoutInfo.flags                  = 0;
+    pipelineLayoutInfo.setLayoutCount         = 0;
+    pipelineLayoutInfo.pSetLayouts            = nullptr;
+    pipelineLayoutInfo.pushConstantRangeCount = 0;
+    pipelineLayoutInfo.pPushConstantRanges    = nullptr;
+
+    ANGLE_TRY(mPipelineLayout.init(mDevice, pipelineLayoutInfo));
+
+    VkShaderModuleCreateInfo shaderModuleInfo;
+    shaderModuleInfo.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    shaderModuleInfo.pNext    = nullptr;
+    shaderModuleInfo.flags    = 0;
+    shaderModuleInfo.codeSize = sizeof(kFragmentShaderCode);
+    shaderModuleInfo.pCode    = kFragmentShaderCode;
+
+    ANGLE_TRY(mFragmentModule.init(mDevice, shaderModuleInfo));
+
+    std::vector<uint32_t> vertexShaderCode(std::begin(kVertexShaderCode),
+                                           std::end(kVertexShaderCode));
+    shaderModuleInfo.codeSize = sizeof(kVertexShaderCode);
+    shaderModuleInfo.pCode    = vertexShaderCode.data();
+
+    const GLenum drawModes[] = {GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_LINES, GL_LINE_STRIP};
+
+    mVertexModules.resize(kPipelineCount);
+    mPipelineDescs.resize(kPipelineCount);
+    for (size_t pipelineIndex = 0; pipelineIndex < kPipelineCount; ++pipelineIndex)
+    {
+        float position = static_cast<float>(pipelineIndex) / static_cast<float>(kPipelineCount);
+        vertexShaderCode[kVertexShaderConstantIndex] = gl::bitCast<uint32_t>(position);
+        ANGLE_TRY(mVertexModules[pipelineIndex].init(mDevice, shaderModuleInfo));
+
+        gl::RasterizerState rasterState;
+        rasterState.cullFace  = (pipelineIndex % 2) != 0;
+        rasterState.cullMode  = gl::CullFaceMode::Back;
+        rasterState.frontFace = GL_CCW;
+
+        vk::PipelineDesc &desc = mPipelineDescs[pipelineIndex];
+        desc.initDefaults();
+        desc.updateViewport(gl::Rectangle(0, 0, 64, 64), 0.0f, 1.0f);
+        desc.updateTopology(drawModes[pipelineIndex % ArraySize(drawModes)]);
+        desc.updateCullMode(rasterState);
+        desc.updateFrontFace(rasterState);
+    }
+
+    return vk::NoError();
+}
+
+vk::Error VulkanPipelineCreationPerfTest::createPipelines(const std::vector<uint8_t> &initialData,
+                                                          std::vector<uint8_t> *cacheDataOut)
+{
+    VkPipelineCacheCreateInfo pipelineCacheInfo;
+    pipelineCacheInfo.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipelineCacheInfo.pNext           = nullptr;
+    pipelineCacheInfo.flags           = 0;
+    pipelineCacheInfo.initialDataSize = initialData.size();
+    pipelineCacheInfo.pInitialData    = initialData.empty() ? nullptr : initialData.data();
+
+    vk::PipelineCache pipelineCacheVk;
+    ANGLE_TRY(pipelineCacheVk.init(mDevice, pipelineCacheInfo));
+
+    vk::Error error = vk::NoError();
+    for (size_t pipelineIndex = 0; pipelineIndex < kPipelineCount && !error.isError();
+         ++pipelineIndex)
+    {
+        vk::Pipeline pipeline;
+        error = mPipelineDescs[pipelineIndex].initializePipeline(
+            mDevice, pipelineCacheVk, mRenderPass, mPipelineLayout, gl::AttributesMask(),
+            mVertexModules[pipelineIndex], mFragmentModule, &pipeline);
+        pipeline.destroy(mDevice);
+    }
+
+    if (!error.isError() && cacheDataOut)
+    {
+        size_t dataSize = 0;
+        error = pipelineCacheVk.getCacheData(mDevice, &dataSize, nullptr);
+        if (!error.isError())
+        {
+            cacheDataOut->resize(dataSize);
+            error = pipelineCacheVk.getCacheData(mDevice, &dataSize, cacheDataOut->data());
+        }
+    }
+
+    pipelineCacheVk.destroy(mDevice);
+    return error;
+}
+
+TEST_P(VulkanPipelineCreationPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(,
+                        VulkanPipelineCreationPerfTest,
+                        ::testing::Values(PipelineCacheState::Cold, PipelineCacheState::Warm));
+
+}  // anonymous namespace